@@ -117,8 +117,11 @@ LOCAL_SRC_FILES := \
     src/agent/thread_helper.cpp \
     src/common/dns_utils.cpp \
     src/common/logging.cpp \
+    src/common/mainloop_manager.cpp \
     src/common/task_runner.cpp \
+    src/common/timer_wheel.cpp \
     src/common/types.cpp \
+    src/common/worker_pool.cpp \
     src/dbus/common/dbus_message_dump.cpp \
     src/dbus/common/dbus_message_helper.cpp \
     src/dbus/common/dbus_message_helper_openthread.cpp \
@@ -38,30 +38,156 @@ endif()
 option(OTBR_BORDER_ROUTING "Enable Border Routing Manager" OFF)
 
 option(OTBR_DBUS "Enable DBus support" OFF)
+set(OTBR_DBUS_SIGNAL_RATE_LIMIT "10" CACHE STRING
+    "The max number of high-rate DBus signals per second sent to one subscriber, for each signal")
+set(OTBR_DBUS_SIGNAL_BURST "32" CACHE STRING
+    "The max number of back-to-back high-rate DBus signals sent to one subscriber, for each signal")
+set(OTBR_DBUS_MAX_SIGNAL_SUBSCRIBERS "16" CACHE STRING "The max number of subscribers of a high-rate DBus signal")
 if(OTBR_DBUS)
     pkg_check_modules(DBUS REQUIRED dbus-1)
     pkg_get_variable(OTBR_DBUS_SYSTEM_BUS_SERVICES_DIR dbus-1 system_bus_services_dir)
-    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DBUS_SERVER=1)
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_ENABLE_DBUS_SERVER=1
+        OTBR_DBUS_SIGNAL_RATE_LIMIT=${OTBR_DBUS_SIGNAL_RATE_LIMIT}
+        OTBR_DBUS_SIGNAL_BURST=${OTBR_DBUS_SIGNAL_BURST}
+        OTBR_DBUS_MAX_SIGNAL_SUBSCRIBERS=${OTBR_DBUS_MAX_SIGNAL_SUBSCRIBERS}
+    )
 endif()
 
 option(OTBR_DUA_ROUTING "Enable Backbone Router DUA Routing" OFF)
 if (OTBR_DUA_ROUTING)
-    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DUA_ROUTING=1)
+    set(OTBR_ND_PROXY_RX_BUDGET "64" CACHE STRING
+        "The max number of multicast NS handled by the ND Proxy in one mainloop iteration")
+    set(OTBR_ND_PROXY_RCVBUF_SIZE "0" CACHE STRING
+        "The receive buffer size (in bytes) of the ND Proxy ICMPv6 socket, 0 to use the system default")
+    set(OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES "1" CACHE STRING
+        "The number of NFQUEUEs the unicast NS are balanced over")
+    option(OTBR_ND_PROXY_NFQUEUE_THREAD "Handle the unicast NS of the ND Proxy on a dedicated thread" OFF)
+    set(OTBR_ND_PROXY_UNSOLICITED_NA_RATE "0" CACHE STRING
+        "The max rate (per second) of unsolicited NAs for proxied DUAs, sent when becoming Primary, 0 for unpaced")
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_ENABLE_DUA_ROUTING=1
+        OTBR_ND_PROXY_RX_BUDGET=${OTBR_ND_PROXY_RX_BUDGET}
+        OTBR_ND_PROXY_RCVBUF_SIZE=${OTBR_ND_PROXY_RCVBUF_SIZE}
+        OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES=${OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES}
+        OTBR_ND_PROXY_UNSOLICITED_NA_RATE=${OTBR_ND_PROXY_UNSOLICITED_NA_RATE}
+    )
+    if (OTBR_ND_PROXY_NFQUEUE_THREAD)
+        target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ND_PROXY_NFQUEUE_THREAD=1)
+    endif()
 endif()
 
+option(OTBR_EPOLL "Use epoll instead of select for the agent mainloop (Linux only)" OFF)
+if (OTBR_EPOLL)
+    if (NOT CMAKE_SYSTEM_NAME STREQUAL "Linux")
+        message(FATAL_ERROR "OTBR_EPOLL is only supported on Linux")
+    endif()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPOLL=1)
+endif()
+
+option(OTBR_FUZZ "Build the libFuzzer targets, requires clang" OFF)
+if (OTBR_FUZZ AND NOT CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    message(FATAL_ERROR "OTBR_FUZZ requires clang")
+endif()
+
+option(OTBR_IO_URING "Use io_uring for the socket I/O of the Rest Server when the kernel supports it" OFF)
+if (OTBR_IO_URING)
+    if (NOT CMAKE_SYSTEM_NAME STREQUAL "Linux")
+        message(FATAL_ERROR "OTBR_IO_URING is only supported on Linux")
+    endif()
+    pkg_check_modules(LIBURING REQUIRED liburing)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_IO_URING=1)
+endif()
+
+set(OTBR_COMPILE_LOG_LEVEL "7" CACHE STRING
+    "The most verbose log level compiled in, from 0 (emergency) to 7 (debug), more verbose log calls are compiled out")
+target_compile_definitions(otbr-config INTERFACE OTBR_COMPILE_LOG_LEVEL=${OTBR_COMPILE_LOG_LEVEL})
+
+option(OTBR_MDNS_SHARED_CONNECTION "Share one mDNSResponder connection among all mDNS subscriptions" OFF)
+if (OTBR_MDNS_SHARED_CONNECTION)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MDNS_SHARED_CONNECTION=1)
+endif()
+
+set(OTBR_MESHCOP_REPUBLISH_DELAY "100" CACHE STRING
+    "The time window (in milliseconds) to coalesce republishing the MeshCoP service, 0 to republish immediately")
+target_compile_definitions(otbr-config INTERFACE OTBR_MESHCOP_REPUBLISH_DELAY=${OTBR_MESHCOP_REPUBLISH_DELAY})
+
 option(OTBR_OPENWRT "Enable OpenWrt support" OFF)
 if(OTBR_OPENWRT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_OPENWRT=1)
 endif()
 
+option(OTBR_RADIO_STATS "Record frame counters and transmit latencies of the RCP link" OFF)
+if(OTBR_RADIO_STATS)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_RADIO_STATS=1)
+endif()
+
 option(OTBR_REST "Enable Rest Server" OFF)
+set(OTBR_REST_LISTEN_BACKLOG "128" CACHE STRING "The listen backlog of the Rest Server")
+set(OTBR_REST_MAX_CONNECTIONS "500" CACHE STRING "The max number of concurrent connections of the Rest Server")
+set(OTBR_REST_MAX_CLIENT_CONNECTIONS "32" CACHE STRING
+    "The max number of concurrent connections of the Rest Server from one IP address")
+set(OTBR_REST_CONNECTION_POOL_SIZE "32" CACHE STRING
+    "The max number of closed connections of the Rest Server kept for reuse")
+set(OTBR_REST_CLIENT_RATE_LIMIT "20" CACHE STRING
+    "The max number of requests per second to the Rest Server from one IP address, 0 to disable")
+set(OTBR_REST_CLIENT_BURST "40" CACHE STRING
+    "The max number of back-to-back requests to the Rest Server from one IP address")
+set(OTBR_REST_MAX_DIAG_REQUESTS "4" CACHE STRING
+    "The max number of diagnostics requests of the Rest Server waiting for the network at a time")
+set(OTBR_REST_DIAG_REFRESH_INTERVAL "0" CACHE STRING
+    "The interval (in milliseconds) of collecting diagnostics in the background for the Rest Server, 0 to disable")
+option(OTBR_REST_JSON_COMPACT "Write compact JSON in Rest Server responses" OFF)
+option(OTBR_REST_GZIP "Enable gzip compression of large Rest Server responses" OFF)
+set(OTBR_REST_GZIP_THRESHOLD "1024" CACHE STRING
+    "The min size (in bytes) of Rest Server response bodies to be compressed with gzip")
+option(OTBR_REST_WORKER_SERIALIZE "Serialize the diagnostics of the Rest Server on a worker thread" OFF)
+option(OTBR_REST_LOAD_TEST "Register the load test of the Rest Server with ctest, which takes a while" OFF)
+set(OTBR_REST_UNIX_SOCKET "" CACHE STRING
+    "The path of a Unix domain socket the Rest Server also listens on, exempt from the per IP limits, empty to disable")
+set(OTBR_REST_UNIX_SOCKET_MODE "0660" CACHE STRING
+    "The file mode of the Unix domain socket of the Rest Server, which controls the local clients allowed")
 if(OTBR_REST)
-    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_REST_SERVER=1)
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_ENABLE_REST_SERVER=1
+        OTBR_REST_LISTEN_BACKLOG=${OTBR_REST_LISTEN_BACKLOG}
+        OTBR_REST_MAX_CONNECTIONS=${OTBR_REST_MAX_CONNECTIONS}
+        OTBR_REST_MAX_CLIENT_CONNECTIONS=${OTBR_REST_MAX_CLIENT_CONNECTIONS}
+        OTBR_REST_CONNECTION_POOL_SIZE=${OTBR_REST_CONNECTION_POOL_SIZE}
+        OTBR_REST_CLIENT_RATE_LIMIT=${OTBR_REST_CLIENT_RATE_LIMIT}
+        OTBR_REST_CLIENT_BURST=${OTBR_REST_CLIENT_BURST}
+        OTBR_REST_MAX_DIAG_REQUESTS=${OTBR_REST_MAX_DIAG_REQUESTS}
+        OTBR_REST_JSON_COMPACT=$<BOOL:${OTBR_REST_JSON_COMPACT}>
+        OTBR_REST_DIAG_REFRESH_INTERVAL=${OTBR_REST_DIAG_REFRESH_INTERVAL}
+        OTBR_REST_GZIP=$<BOOL:${OTBR_REST_GZIP}>
+        OTBR_REST_GZIP_THRESHOLD=${OTBR_REST_GZIP_THRESHOLD}
+        OTBR_REST_WORKER_SERIALIZE=$<BOOL:${OTBR_REST_WORKER_SERIALIZE}>
+    )
+    if(OTBR_REST_UNIX_SOCKET)
+        target_compile_definitions(otbr-config INTERFACE
+            "OTBR_REST_UNIX_SOCKET=\"${OTBR_REST_UNIX_SOCKET}\""
+            OTBR_REST_UNIX_SOCKET_MODE=${OTBR_REST_UNIX_SOCKET_MODE}
+        )
+    endif()
 endif()
 
 option(OTBR_SRP_ADVERTISING_PROXY "Enable Advertising Proxy" OFF)
 if (OTBR_SRP_ADVERTISING_PROXY)
-    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_SRP_ADVERTISING_PROXY=1)
+    set(OTBR_SRP_MAX_IN_FLIGHT_UPDATES "8" CACHE STRING
+        "The max number of SRP updates being advertised at a time, later updates are queued")
+    set(OTBR_SRP_MAX_QUEUED_UPDATES "256" CACHE STRING
+        "The max number of queued SRP updates, later updates are rejected for the SRP clients to retry")
+    set(OTBR_SRP_READVERTISE_BATCH_SIZE "16" CACHE STRING
+        "The number of SRP hosts re-advertised at a time after the mDNS publisher restarts")
+    set(OTBR_SRP_READVERTISE_INTERVAL "100" CACHE STRING
+        "The interval (in milliseconds) between re-advertising batches of SRP hosts")
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_ENABLE_SRP_ADVERTISING_PROXY=1
+        OTBR_SRP_MAX_IN_FLIGHT_UPDATES=${OTBR_SRP_MAX_IN_FLIGHT_UPDATES}
+        OTBR_SRP_MAX_QUEUED_UPDATES=${OTBR_SRP_MAX_QUEUED_UPDATES}
+        OTBR_SRP_READVERTISE_BATCH_SIZE=${OTBR_SRP_READVERTISE_BATCH_SIZE}
+        OTBR_SRP_READVERTISE_INTERVAL=${OTBR_SRP_READVERTISE_INTERVAL}
+    )
 endif()
 
 option(OTBR_DNSSD_DISCOVERY_PROXY   "Enable DNS-SD Discovery Proxy support" OFF)
@@ -69,6 +195,36 @@ if (OTBR_DNSSD_DISCOVERY_PROXY)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DNSSD_DISCOVERY_PROXY=1)
 endif()
 
+set(OTBR_COUNTER_HISTORY_INTERVAL "10000" CACHE STRING
+    "The interval (in milliseconds) of sampling the Thread counters into the counter history, 0 to disable")
+set(OTBR_COUNTER_HISTORY_SIZE "360" CACHE STRING "The number of sampling intervals kept in the counter history")
+target_compile_definitions(otbr-config INTERFACE
+    OTBR_COUNTER_HISTORY_INTERVAL=${OTBR_COUNTER_HISTORY_INTERVAL}
+    OTBR_COUNTER_HISTORY_SIZE=${OTBR_COUNTER_HISTORY_SIZE}
+)
+
+set(OTBR_MALLOC_TRIM_INTERVAL "0" CACHE STRING
+    "The interval (in seconds) of returning the free heap memory to the system with glibc, 0 to disable")
+target_compile_definitions(otbr-config INTERFACE OTBR_MALLOC_TRIM_INTERVAL=${OTBR_MALLOC_TRIM_INTERVAL})
+
+set(OTBR_NETIF_STATS_INTERVAL "10000" CACHE STRING
+    "The interval (in milliseconds) of sampling the throughput of the Thread and Backbone interfaces, 0 to disable")
+target_compile_definitions(otbr-config INTERFACE OTBR_NETIF_STATS_INTERVAL=${OTBR_NETIF_STATS_INTERVAL})
+
+option(OTBR_TRACE "Record hot path events in an in-memory binary trace buffer" ON)
+set(OTBR_TRACE_BUFFER_SIZE "8192" CACHE STRING "The number of records in the trace buffer, must be a power of two")
+if(OTBR_TRACE)
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_ENABLE_TRACE=1
+        OTBR_TRACE_BUFFER_SIZE=${OTBR_TRACE_BUFFER_SIZE}
+    )
+endif()
+
+option(OTBR_USDT "Compile in USDT probes at hot paths, requires sys/sdt.h" OFF)
+if(OTBR_USDT)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_USDT=1)
+endif()
+
 option(OTBR_UNSECURE_JOIN "Enable unsecure joining" OFF)
 if(OTBR_UNSECURE_JOIN)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_UNSECURE_JOIN=1)
@@ -41,16 +41,60 @@
 #error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 
 #include <assert.h>
+#include <inttypes.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/trace.hpp"
+
+#ifndef OTBR_SRP_MAX_IN_FLIGHT_UPDATES
+#define OTBR_SRP_MAX_IN_FLIGHT_UPDATES 8
+#endif
+
+#ifndef OTBR_SRP_MAX_QUEUED_UPDATES
+#define OTBR_SRP_MAX_QUEUED_UPDATES 256
+#endif
+
+#ifndef OTBR_SRP_READVERTISE_BATCH_SIZE
+#define OTBR_SRP_READVERTISE_BATCH_SIZE 16
+#endif
+
+#ifndef OTBR_SRP_READVERTISE_INTERVAL
+#define OTBR_SRP_READVERTISE_INTERVAL 100
+#endif
+
+#ifndef OTBR_SRP_WITHDRAW_BATCH_SIZE
+#define OTBR_SRP_WITHDRAW_BATCH_SIZE 16
+#endif
+
+#ifndef OTBR_SRP_WITHDRAW_INTERVAL
+#define OTBR_SRP_WITHDRAW_INTERVAL 100
+#endif
 
 namespace otbr {
 
+namespace {
+
+// The change of an SRP service to be advertised.
+struct ServiceChange
+{
+    std::string               mName;              // The service instance name.
+    std::string               mType;              // The service type.
+    InternedName              mKey;               // The key by `Mdns::Publisher::MakeServiceKey()`.
+    const otSrpServerService *mService;           // The SRP service.
+    bool                      mPublish   = false; // Whether the service is new or changed.
+    bool                      mUnpublish = false; // Whether the advertised service is deleted.
+};
+
+} // namespace
+
 static otError OtbrErrorToOtError(otbrError aError)
 {
     otError error;
@@ -81,6 +125,14 @@ static otError OtbrErrorToOtError(otbrError aError)
         error = OT_ERROR_DUPLICATED;
         break;
 
+    case OTBR_ERROR_TIMEOUT:
+        error = OT_ERROR_RESPONSE_TIMEOUT;
+        break;
+
+    case OTBR_ERROR_BUSY:
+        error = OT_ERROR_BUSY;
+        break;
+
     default:
         error = OT_ERROR_FAILED;
         break;
@@ -92,6 +144,13 @@ static otError OtbrErrorToOtError(otbrError aError)
 AdvertisingProxy::AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mDispatching(false)
+    , mWithdrawScheduled(false)
+    , mUpdatesMemory("otbr_srp_updates",
+                     "SRP updates outstanding or queued in the advertising proxy.",
+                     "otbr_srp_updates_memory_bytes",
+                     "Estimated memory of the SRP updates outstanding or queued in the advertising proxy.",
+                     [this](size_t &aNumEntries, size_t &aNumBytes) { EstimateUpdatesMemory(aNumEntries, aNumBytes); })
 {
 }
 
@@ -113,7 +172,10 @@ void AdvertisingProxy::Stop()
     mPublisher.SetPublishHostHandler(nullptr, nullptr);
 
     // Outstanding updates will fail on the SRP server because of timeout.
-    // TODO: handle this case gracefully.
+    ClearOutstandingUpdates();
+    ClearAdvertised();
+    ClearWithdrawals();
+    StopReadvertising();
 
     // Stop receiving SRP server events.
     if (GetInstance() != nullptr)
@@ -136,95 +198,388 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                           const otSrpServerHost *    aHost,
                                           uint32_t                   aTimeout)
 {
-    // TODO: There are corner cases that the `aHost` is freed by SRP server because
-    // of timeout, but this `aHost` is passed back to SRP server and matches a newly
-    // allocated otSrpServerHost object which has the same pointer value as this
-    // `aHost`. This results in mismatching of the outstanding SRP updates. Solutions
-    // are cleaning up the outstanding update entries before timing out or using
-    // incremental ID to match oustanding SRP updates.
-    OTBR_UNUSED_VARIABLE(aTimeout);
-
-    otbrError                 error = OTBR_ERROR_NONE;
-    const char *              fullHostName;
-    std::string               hostName;
-    std::string               hostDomain;
-    const otIp6Address *      hostAddress;
-    uint8_t                   hostAddressNum;
-    bool                      hostDeleted;
-    const otSrpServerService *service;
-    OutstandingUpdate *       update;
-
-    mOutstandingUpdates.resize(mOutstandingUpdates.size() + 1);
-    update = &mOutstandingUpdates.back();
+    InternedName fullHostName = otSrpServerHostGetFullName(aHost);
+
+    otbrTrace(TraceEvent::kSrpUpdate, aId, static_cast<uint32_t>(mOutstandingUpdates.size()),
+              static_cast<uint32_t>(mQueuedUpdates.size()));
+    otbrProbe(srp__update__start, aId, fullHostName.c_str());
+
+    if (mQueuedUpdates.empty() && mOutstandingUpdates.size() < OTBR_SRP_MAX_IN_FLIGHT_UPDATES &&
+        !HasOutstandingUpdate(fullHostName))
+    {
+        AdvertiseHost(aHost, &aId, aTimeout);
+    }
+    else if (mQueuedUpdates.size() >= OTBR_SRP_MAX_QUEUED_UPDATES)
+    {
+        // The SRP client retries later, which spreads a registration storm out.
+        otbrLogWarningRateLimited("Too many SRP service updates, reject update %" PRIu32 " of host %s", aId,
+                                  fullHostName.c_str());
+        otbrTrace(TraceEvent::kSrpUpdateResult, aId, static_cast<uint32_t>(OtbrErrorToOtError(OTBR_ERROR_BUSY)));
+        otbrProbe(srp__update__finish, aId, static_cast<int>(OTBR_ERROR_BUSY));
+        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(OTBR_ERROR_BUSY));
+    }
+    else
+    {
+        QueuedUpdate update;
+
+        update.mId           = aId;
+        update.mHost         = aHost;
+        update.mFullHostName = fullHostName;
+        update.mTimeout      = aTimeout;
+        update.mQueueTime    = Clock::now();
+
+        // The SRP server frees the host when the update times out, so it must leave the queue well before.
+        update.mTimeoutTask =
+            mNcp.PostTimerTask(Milliseconds(aTimeout / 2), [this, aId]() { HandleQueuedUpdateTimeout(aId); });
+        mQueuedUpdates.push_back(std::move(update));
+
+        otbrLogInfoRateLimited("Queue SRP service updates %" PRIu32 " of host %s, %zu queued", aId,
+                               fullHostName.c_str(), mQueuedUpdates.size());
+
+        // The update may wait only for an outstanding update of the same host.
+        DispatchQueuedUpdates();
+    }
+}
+
+bool AdvertisingProxy::HasOutstandingUpdate(const InternedName &aFullHostName) const
+{
+    return std::any_of(mOutstandingUpdates.begin(), mOutstandingUpdates.end(),
+                       [&aFullHostName](const std::pair<const otSrpServerServiceUpdateId, OutstandingUpdate> &aPair) {
+                           return aPair.second.mFullHostName == aFullHostName;
+                       });
+}
+
+void AdvertisingProxy::DispatchQueuedUpdates(void)
+{
+    VerifyOrExit(!mDispatching);
+    mDispatching = true;
+
+    // Updates of a host are advertised in order, one at a time, while other hosts don't wait for a busy host.
+    for (auto it = mQueuedUpdates.begin();
+         it != mQueuedUpdates.end() && mOutstandingUpdates.size() < OTBR_SRP_MAX_IN_FLIGHT_UPDATES;)
+    {
+        QueuedUpdate update;
+        Milliseconds elapsed;
+
+        if (HasOutstandingUpdate(it->mFullHostName))
+        {
+            ++it;
+            continue;
+        }
+
+        update = std::move(*it);
+        mQueuedUpdates.erase(it);
+        update.mTimeoutTask.Cancel();
+
+        elapsed = std::chrono::duration_cast<Milliseconds>(Clock::now() - update.mQueueTime);
+        AdvertiseHost(update.mHost, &update.mId, update.mTimeout - static_cast<uint32_t>(elapsed.count()));
+
+        // Earlier updates skipped for their host may be advertised now.
+        it = mQueuedUpdates.begin();
+    }
+
+    mDispatching = false;
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandleQueuedUpdateTimeout(otSrpServerServiceUpdateId aId)
+{
+    auto it = std::find_if(mQueuedUpdates.begin(), mQueuedUpdates.end(),
+                           [aId](const QueuedUpdate &aUpdate) { return aUpdate.mId == aId; });
+
+    VerifyOrExit(it != mQueuedUpdates.end());
+
+    otbrLogWarning("SRP service updates %" PRIu32 " of host %s queued for too long", aId, it->mFullHostName.c_str());
+    mQueuedUpdates.erase(it);
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(OTBR_ERROR_BUSY));
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::FailQueuedUpdates(otbrError aError)
+{
+    std::list<QueuedUpdate> updates = std::move(mQueuedUpdates);
+
+    mQueuedUpdates.clear();
+
+    for (QueuedUpdate &update : updates)
+    {
+        update.mTimeoutTask.Cancel();
+        otSrpServerHandleServiceUpdateResult(GetInstance(), update.mId, OtbrErrorToOtError(aError));
+    }
+}
+
+void AdvertisingProxy::AdvertiseHost(const otSrpServerHost *           aHost,
+                                     const otSrpServerServiceUpdateId *aId,
+                                     uint32_t                          aTimeout)
+{
+    otbrError                    error = OTBR_ERROR_NONE;
+    const char *                 fullHostName;
+    DnsNameParts                 hostNameParts;
+    std::string                  hostNameString;
+    InternedName                 hostName;
+    const otIp6Address *         hostAddress;
+    uint8_t                      hostAddressNum;
+    Mdns::Publisher::AddressList hostAddresses;
+    bool                         hostDeleted;
+    bool                         publishHost   = false;
+    bool                         unpublishHost = false;
+    bool                         hasPublishes  = false;
+    bool                         hasChanges    = false;
+    const otSrpServerService *   service;
+    std::vector<ServiceChange>   changes;
+    bool                         tracked  = false;
+    bool                         batching = false;
 
     fullHostName = otSrpServerHostGetFullName(aHost);
 
-    otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName);
+    otbrLogInfoRateLimited("Advertise SRP service updates: host=%s", fullHostName);
 
-    SuccessOrExit(error = SplitFullHostName(fullHostName, hostName, hostDomain));
+    hostNameParts = ParseFullDnsName(fullHostName);
+    VerifyOrExit(hostNameParts.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+    hostNameParts.mHostName.CopyTo(hostNameString);
+    hostName    = hostNameString;
     hostAddress = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
     hostDeleted = otSrpServerHostIsDeleted(aHost);
 
-    update->mId = aId;
-    update->mCallbackCount += !hostDeleted;
-    update->mHostName = hostName;
+    for (uint8_t i = 0; i < hostAddressNum; ++i)
+    {
+        hostAddresses.emplace_back(hostAddress[i].mFields.m8);
+    }
+
+    hostAddresses = Mdns::Publisher::MakeAddressSet(hostAddresses);
 
+    // Compare the update with what has been advertised, lease renewals usually change nothing.
     service = nullptr;
     while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
     {
-        update->mCallbackCount += !hostDeleted && !otSrpServerServiceIsDeleted(service);
+        ServiceChange change;
+        DnsNameParts  serviceNameParts = ParseFullDnsName(otSrpServerServiceGetFullName(service));
+
+        VerifyOrExit(serviceNameParts.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+        serviceNameParts.mInstanceName.CopyTo(change.mName);
+        serviceNameParts.mServiceName.CopyTo(change.mType);
+        change.mService = service;
+        change.mKey     = Mdns::Publisher::MakeServiceKey(change.mName.c_str(), change.mType.c_str());
+
+        if (hostDeleted || otSrpServerServiceIsDeleted(service))
+        {
+            change.mUnpublish = (mAdvertisedServices.count(change.mKey) != 0);
+        }
+        else
+        {
+            change.mPublish = !IsServiceAdvertised(hostName, change.mKey, service);
+        }
+
+        hasPublishes |= change.mPublish;
+        hasChanges   |= change.mPublish || change.mUnpublish;
+        changes.push_back(std::move(change));
     }
 
-    if (!hostDeleted)
+    if (hostDeleted)
     {
-        // TODO: select a preferred address or advertise all addresses from SRP client.
-        otbrLogInfo("Publish SRP host: %s", fullHostName);
-        SuccessOrExit(error =
-                          mPublisher.PublishHost(hostName.c_str(), hostAddress[0].mFields.m8, sizeof(hostAddress[0])));
+        unpublishHost = (mAdvertisedHosts.count(hostName) != 0);
     }
     else
     {
-        otbrLogInfo("Unpublish SRP host: %s", fullHostName);
-        SuccessOrExit(error = mPublisher.UnpublishHost(hostName.c_str()));
+        auto hostIt = mAdvertisedHosts.find(hostName);
+
+        // The host is published together with changed services, so that they are probed and announced at once.
+        publishHost = hasPublishes || hostIt == mAdvertisedHosts.end() || hostIt->second != hostAddresses;
     }
 
-    service = nullptr;
-    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    // The SRP update is tracked before publishing, because the publish handlers may be called synchronously.
+    // Names still being published for a previous update are waited for, rather than published again.
+    if (aId != nullptr)
     {
-        const char *fullServiceName = otSrpServerServiceGetFullName(service);
-        std::string serviceName;
-        std::string serviceType;
-        std::string serviceDomain;
+        otSrpServerServiceUpdateId id = *aId;
+        OutstandingUpdate          update;
 
-        SuccessOrExit(error = SplitFullServiceInstanceName(fullServiceName, serviceName, serviceType, serviceDomain));
+        update.mFullHostName = fullHostName;
+        update.mHostName     = hostName;
+        update.mWaitsForHost = publishHost || (!hostDeleted && mHostUpdates.count(hostName) != 0);
 
-        update->mServiceNames.emplace_back(serviceName, serviceType);
+        for (const ServiceChange &change : changes)
+        {
+            if (change.mPublish || (!hostDeleted && !otSrpServerServiceIsDeleted(change.mService) &&
+                                    mServiceUpdates.count(change.mKey) != 0))
+            {
+                update.mServiceKeys.push_back(change.mKey);
+            }
+        }
+
+        update.mCallbackCount = update.mWaitsForHost + static_cast<uint32_t>(update.mServiceKeys.size());
 
-        if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
+        if (update.mCallbackCount > 0)
         {
-            Mdns::Publisher::TxtList txtList = MakeTxtList(service);
+            if (update.mWaitsForHost)
+            {
+                mHostUpdates.emplace(hostName, id);
+            }
 
-            otbrLogInfo("Publish SRP service: %s", fullServiceName);
-            SuccessOrExit(error = mPublisher.PublishService(hostName.c_str(), otSrpServerServiceGetPort(service),
-                                                            serviceName.c_str(), serviceType.c_str(), txtList));
+            for (const InternedName &serviceKey : update.mServiceKeys)
+            {
+                mServiceUpdates.emplace(serviceKey, id);
+            }
+
+            update.mTimeoutTask = mNcp.PostTimerTask(Milliseconds(aTimeout), [this, id]() { HandleUpdateTimeout(id); });
+            mOutstandingUpdates.emplace(id, std::move(update));
+            tracked = true;
         }
-        else
+    }
+
+    if (!publishHost && !unpublishHost && !hasChanges)
+    {
+        otbrLogInfoRateLimited("SRP service updates of host %s change nothing", fullHostName);
+        ExitNow();
+    }
+
+    // Deleted hosts, e.g. of expired leases, often come in bursts and are withdrawn at a limited pace, so that the
+    // goodbye announcements do not flood the infrastructure link. Nothing is waited for.
+    if (hostDeleted)
+    {
+        PendingWithdrawal withdrawal;
+
+        withdrawal.mHostName      = hostName;
+        withdrawal.mUnpublishHost = unpublishHost;
+
+        for (ServiceChange &change : changes)
+        {
+            if (change.mUnpublish)
+            {
+                withdrawal.mServices.push_back({std::move(change.mName), std::move(change.mType), change.mKey});
+            }
+        }
+
+        QueueWithdrawal(std::move(withdrawal));
+        ExitNow();
+    }
+
+    // Names still to be withdrawn are withdrawn before, not after, being published again.
+    if (!mWithdrawingNames.empty())
+    {
+        bool withdrawing = IsWithdrawing(hostName);
+
+        for (const ServiceChange &change : changes)
+        {
+            withdrawing = withdrawing || IsWithdrawing(change.mKey);
+        }
+
+        if (withdrawing)
+        {
+            FlushWithdrawals();
+        }
+    }
+
+    mPublisher.BeginBatch(hostName.c_str());
+    batching = true;
+
+    if (publishHost)
+    {
+        // All addresses are advertised, so that a host with both an OMR and an ML-EID address is not republished
+        // whenever the order of its addresses changes.
+        otbrLogInfoRateLimited("Publish SRP host: %s", fullHostName);
+        SuccessOrExit(error = mPublisher.PublishHost(hostName.c_str(), hostAddresses));
+        mAdvertisedHosts[hostName] = hostAddresses;
+    }
+    else if (unpublishHost)
+    {
+        otbrLogInfoRateLimited("Unpublish SRP host: %s", fullHostName);
+        SuccessOrExit(error = mPublisher.UnpublishHost(hostName.c_str()));
+        mAdvertisedHosts.erase(hostName);
+    }
+
+    for (const ServiceChange &change : changes)
+    {
+        if (change.mPublish)
+        {
+            uint16_t           txtLength = 0;
+            const uint8_t *    txtData   = otSrpServerServiceGetTxtData(change.mService, &txtLength);
+            uint16_t           port      = otSrpServerServiceGetPort(change.mService);
+            AdvertisedService *advertised;
+
+            // The TXT data of the SRP update is already in the wire format, it's published as is.
+            otbrLogInfoRateLimited("Publish SRP service: %s", otSrpServerServiceGetFullName(change.mService));
+            SuccessOrExit(error = mPublisher.PublishService(hostName.c_str(), port, change.mName.c_str(),
+                                                            change.mType.c_str(),
+                                                            Mdns::Publisher::TxtData(txtData, txtLength)));
+
+            advertised            = &mAdvertisedServices[change.mKey];
+            advertised->mHostName = hostName;
+            advertised->mPort     = port;
+            advertised->mTxtData.assign(txtData, txtData + txtLength);
+        }
+        else if (change.mUnpublish)
         {
-            otbrLogInfo("Unpublish SRP service: %s", fullServiceName);
-            SuccessOrExit(error = mPublisher.UnpublishService(serviceName.c_str(), serviceType.c_str()));
+            otbrLogInfoRateLimited("Unpublish SRP service: %s", otSrpServerServiceGetFullName(change.mService));
+            SuccessOrExit(error = mPublisher.UnpublishService(change.mName.c_str(), change.mType.c_str()));
+            mAdvertisedServices.erase(change.mKey);
         }
     }
 
 exit:
-    if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
+    if (batching)
     {
-        if (error != OTBR_ERROR_NONE)
+        otbrError commitError = mPublisher.CommitBatch();
+
+        if (error == OTBR_ERROR_NONE)
         {
-            otbrLogInfo("Failed to advertise SRP service updates %p", aHost);
+            error = commitError;
         }
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogInfoRateLimited("Failed to advertise SRP service updates %p", aHost);
 
-        mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        // It's unknown what has been advertised, the next update of the host publishes everything again.
+        ForgetAdvertisedHost(hostName);
+    }
+
+    // The publish handlers may have been called synchronously and finished the update already.
+    if (aId != nullptr && (!tracked || (error != OTBR_ERROR_NONE && mOutstandingUpdates.count(*aId) != 0)))
+    {
+        CompleteUpdate(*aId, error);
+    }
+}
+
+bool AdvertisingProxy::IsServiceAdvertised(const InternedName &      aHostName,
+                                           const InternedName &      aServiceKey,
+                                           const otSrpServerService *aService) const
+{
+    bool           advertised = false;
+    auto           it         = mAdvertisedServices.find(aServiceKey);
+    uint16_t       txtLength  = 0;
+    const uint8_t *txtData;
+
+    VerifyOrExit(it != mAdvertisedServices.end());
+    VerifyOrExit(it->second.mHostName == aHostName && it->second.mPort == otSrpServerServiceGetPort(aService));
+
+    txtData = otSrpServerServiceGetTxtData(aService, &txtLength);
+    VerifyOrExit(it->second.mTxtData.size() == txtLength);
+    advertised = (txtLength == 0 || memcmp(it->second.mTxtData.data(), txtData, txtLength) == 0);
+
+exit:
+    return advertised;
+}
+
+void AdvertisingProxy::ForgetAdvertisedHost(const InternedName &aHostName)
+{
+    mAdvertisedHosts.erase(aHostName);
+
+    for (auto it = mAdvertisedServices.begin(); it != mAdvertisedServices.end();)
+    {
+        if (it->second.mHostName == aHostName)
+        {
+            it = mAdvertisedServices.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
     }
 }
 
@@ -235,38 +590,22 @@ void AdvertisingProxy::PublishServiceHandler(const char *aName, const char *aTyp
 
 void AdvertisingProxy::PublishServiceHandler(const char *aName, const char *aType, otbrError aError)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    InternedName serviceKey;
 
-    otbrLogInfo("Handle publish service '%s.%s' result: %d", aName, aType, aError);
+    otbrLogInfoRateLimited("Handle publish service '%s.%s' result: %d", aName, aType, aError);
 
-    // TODO: there may be same names between two SRP updates.
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
-    {
-        for (const auto &nameAndType : update->mServiceNames)
-        {
-            if (aName != nameAndType.first || !Mdns::Publisher::IsServiceTypeEqual(aType, nameAndType.second.c_str()))
-            {
-                continue;
-            }
+    // A key which isn't interned is neither advertised nor waited for.
+    VerifyOrExit(NamePool::Get().Find(Mdns::Publisher::MakeServiceKey(aName, aType), serviceKey));
 
-            if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
-            {
-                otSrpServerHandleServiceUpdateResult(GetInstance(), update->mId, OtbrErrorToOtError(aError));
-                mOutstandingUpdates.erase(update);
-            }
-            else
-            {
-                --update->mCallbackCount;
-            }
-            ExitNow();
-        }
+    if (aError != OTBR_ERROR_NONE)
+    {
+        mAdvertisedServices.erase(serviceKey);
     }
 
+    HandlePublishResult(mServiceUpdates, serviceKey, aError);
+
 exit:
-    if (error != OTBR_ERROR_NONE)
-    {
-        otbrLogWarning("Failed to handle result of service %s", aName);
-    }
+    return;
 }
 
 void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError, void *aContext)
@@ -276,54 +615,380 @@ void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError, v
 
 void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    InternedName hostName;
 
-    otbrLogInfo("Handle publish host '%s' result: %d", aName, aError);
+    otbrLogInfoRateLimited("Handle publish host '%s' result: %d", aName, aError);
 
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    // A name which isn't interned is neither advertised nor waited for.
+    VerifyOrExit(NamePool::Get().Find(aName, hostName));
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        mAdvertisedHosts.erase(hostName);
+    }
+
+    HandlePublishResult(mHostUpdates, hostName, aError);
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandlePublishResult(UpdateIndex &aIndex, const InternedName &aKey, otbrError aError)
+{
+    auto                                    range = aIndex.equal_range(aKey);
+    std::vector<otSrpServerServiceUpdateId> ids;
+
+    // The same name may be waited for by several SRP updates, e.g. when a client retries before the result.
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        ids.push_back(it->second);
+    }
+
+    for (otSrpServerServiceUpdateId id : ids)
     {
-        if (aName != update->mHostName)
+        auto updateIt = mOutstandingUpdates.find(id);
+
+        assert(updateIt != mOutstandingUpdates.end());
+
+        if (aError != OTBR_ERROR_NONE || updateIt->second.mCallbackCount == 1)
         {
-            continue;
+            CompleteUpdate(id, aError);
         }
+        else
+        {
+            --updateIt->second.mCallbackCount;
+            RemoveFromIndex(aIndex, aKey, id);
+        }
+    }
+}
 
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
+void AdvertisingProxy::HandleUpdateTimeout(otSrpServerServiceUpdateId aId)
+{
+    auto updateIt = mOutstandingUpdates.find(aId);
+
+    otbrLogWarning("Timed out advertising SRP service updates %" PRIu32, aId);
+
+    // Whether the host and its services are advertised is unknown, so the next update of the host publishes them all.
+    if (updateIt != mOutstandingUpdates.end())
+    {
+        ForgetAdvertisedHost(updateIt->second.mHostName);
+    }
+
+    CompleteUpdate(aId, OTBR_ERROR_TIMEOUT);
+}
+
+void AdvertisingProxy::CompleteUpdate(otSrpServerServiceUpdateId aId, otbrError aError)
+{
+    auto updateIt = mOutstandingUpdates.find(aId);
+
+    if (updateIt != mOutstandingUpdates.end())
+    {
+        OutstandingUpdate &update = updateIt->second;
+
+        update.mTimeoutTask.Cancel();
+
+        if (update.mWaitsForHost)
         {
-            otSrpServerHandleServiceUpdateResult(GetInstance(), update->mId, OtbrErrorToOtError(aError));
-            mOutstandingUpdates.erase(update);
+            RemoveFromIndex(mHostUpdates, update.mHostName, aId);
         }
-        else
+
+        for (const InternedName &serviceKey : update.mServiceKeys)
+        {
+            RemoveFromIndex(mServiceUpdates, serviceKey, aId);
+        }
+
+        mOutstandingUpdates.erase(updateIt);
+    }
+
+    otbrTrace(TraceEvent::kSrpUpdateResult, aId, static_cast<uint32_t>(OtbrErrorToOtError(aError)));
+    otbrProbe(srp__update__finish, aId, static_cast<int>(aError));
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(aError));
+    DispatchQueuedUpdates();
+}
+
+void AdvertisingProxy::ClearOutstandingUpdates(void)
+{
+    for (auto &idAndUpdate : mOutstandingUpdates)
+    {
+        idAndUpdate.second.mTimeoutTask.Cancel();
+    }
+
+    mOutstandingUpdates.clear();
+    mServiceUpdates.clear();
+    mHostUpdates.clear();
+
+    for (QueuedUpdate &update : mQueuedUpdates)
+    {
+        update.mTimeoutTask.Cancel();
+    }
+
+    mQueuedUpdates.clear();
+}
+
+void AdvertisingProxy::ClearAdvertised(void)
+{
+    mAdvertisedHosts.clear();
+    mAdvertisedServices.clear();
+}
+
+void AdvertisingProxy::FailOutstandingUpdates(otbrError aError)
+{
+    std::vector<otSrpServerServiceUpdateId> ids;
+
+    for (const auto &idAndUpdate : mOutstandingUpdates)
+    {
+        ids.push_back(idAndUpdate.first);
+    }
+
+    for (otSrpServerServiceUpdateId id : ids)
+    {
+        CompleteUpdate(id, aError);
+    }
+}
+
+void AdvertisingProxy::HandleMdnsState(Mdns::Publisher::State aState)
+{
+    // Everything advertised is gone with the publisher, so are the publications of outstanding updates. The SRP
+    // clients of these updates will retry.
+    StopReadvertising();
+    FailQueuedUpdates(OTBR_ERROR_MDNS);
+    FailOutstandingUpdates(OTBR_ERROR_MDNS);
+    ClearAdvertised();
+    ClearWithdrawals();
+
+    if (aState == Mdns::Publisher::State::kReady)
+    {
+        StartReadvertising();
+    }
+}
+
+SrpReadvertiseStats AdvertisingProxy::GetReadvertiseStats(void) const
+{
+    SrpReadvertiseStats stats = mReadvertiseStats;
+
+    stats.mHostsPending = static_cast<uint32_t>(mReadvertisePending.size());
+
+    return stats;
+}
+
+void AdvertisingProxy::StartReadvertising(void)
+{
+    const otSrpServerHost *host = nullptr;
+
+    VerifyOrExit(GetInstance() != nullptr);
+
+    while ((host = otSrpServerGetNextHost(GetInstance(), host)) != nullptr)
+    {
+        if (!otSrpServerHostIsDeleted(host))
+        {
+            mReadvertisePending.insert(otSrpServerHostGetFullName(host));
+        }
+    }
+
+    VerifyOrExit(!mReadvertisePending.empty());
+
+    otbrLogInfo("Re-advertise %zu SRP hosts", mReadvertisePending.size());
+    ++mReadvertiseStats.mRecoveries;
+    mReadvertiseStartTime = Clock::now();
+    ReadvertiseHosts();
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::StopReadvertising(void)
+{
+    if (!mReadvertisePending.empty())
+    {
+        otbrLogWarning("Stop re-advertising, %zu SRP hosts left", mReadvertisePending.size());
+        mReadvertiseTask.Cancel();
+        mReadvertisePending.clear();
+    }
+}
+
+void AdvertisingProxy::ReadvertiseHosts(void)
+{
+    const otSrpServerHost *host  = otSrpServerGetNextHost(GetInstance(), nullptr);
+    uint32_t               count = 0;
+
+    while (host != nullptr && count < OTBR_SRP_READVERTISE_BATCH_SIZE)
+    {
+        // Advertising may finish a pending update of the same host and replace it in the host list.
+        const otSrpServerHost *next = otSrpServerGetNextHost(GetInstance(), host);
+
+        if (mReadvertisePending.erase(otSrpServerHostGetFullName(host)) != 0 && !otSrpServerHostIsDeleted(host))
         {
-            --update->mCallbackCount;
+            AdvertiseHost(host, /* aId */ nullptr, /* aTimeout */ 0);
+            ++count;
         }
+
+        host = next;
+    }
+
+    mReadvertiseStats.mHostsReadvertised += count;
+
+    if (host == nullptr)
+    {
+        // The whole host list has been walked, the hosts left have been removed by the SRP server.
+        mReadvertisePending.clear();
+    }
+
+    if (mReadvertisePending.empty())
+    {
+        mReadvertiseStats.mLastRecoveryTime =
+            std::chrono::duration_cast<Milliseconds>(Clock::now() - mReadvertiseStartTime);
+        otbrLogInfo("Re-advertised SRP hosts in %" PRId64 " ms",
+                    static_cast<int64_t>(mReadvertiseStats.mLastRecoveryTime.count()));
+    }
+    else
+    {
+        otbrLogInfo("Re-advertised %u SRP hosts, %zu left", count, mReadvertisePending.size());
+        mReadvertiseTask =
+            mNcp.PostTimerTask(Milliseconds(OTBR_SRP_READVERTISE_INTERVAL), [this]() { ReadvertiseHosts(); });
+    }
+}
+
+void AdvertisingProxy::QueueWithdrawal(PendingWithdrawal &&aWithdrawal)
+{
+    // What is queued is no longer considered advertised, an update publishing it again flushes the queue first.
+    if (aWithdrawal.mUnpublishHost)
+    {
+        mAdvertisedHosts.erase(aWithdrawal.mHostName);
+    }
+
+    mWithdrawingNames.insert(aWithdrawal.mHostName);
+
+    for (const WithdrawnService &service : aWithdrawal.mServices)
+    {
+        mAdvertisedServices.erase(service.mKey);
+        mWithdrawingNames.insert(service.mKey);
+    }
+
+    mPendingWithdrawals.push_back(std::move(aWithdrawal));
+
+    // A single deletion is withdrawn at once, the following ones wait for the next batch.
+    if (!mWithdrawScheduled)
+    {
+        mWithdrawScheduled = true;
+        WithdrawHosts();
+    }
+}
+
+void AdvertisingProxy::WithdrawHosts(void)
+{
+    uint32_t count = 0;
+
+    while (!mPendingWithdrawals.empty() && count < OTBR_SRP_WITHDRAW_BATCH_SIZE)
+    {
+        PendingWithdrawal withdrawal = std::move(mPendingWithdrawals.front());
+
+        mPendingWithdrawals.pop_front();
+        Withdraw(withdrawal);
+        ++count;
+    }
+
+    if (mPendingWithdrawals.empty())
+    {
+        mWithdrawingNames.clear();
+    }
+
+    // The pace is kept until a whole interval passes without deletions.
+    if (count == 0)
+    {
+        mWithdrawScheduled = false;
         ExitNow();
     }
 
+    if (!mPendingWithdrawals.empty())
+    {
+        otbrLogInfo("Withdrew %u SRP hosts, %zu left", count, mPendingWithdrawals.size());
+    }
+
+    mWithdrawTask = mNcp.PostTimerTask(Milliseconds(OTBR_SRP_WITHDRAW_INTERVAL), [this]() { WithdrawHosts(); });
+
 exit:
-    if (error != OTBR_ERROR_NONE)
+    return;
+}
+
+void AdvertisingProxy::FlushWithdrawals(void)
+{
+    std::list<PendingWithdrawal> withdrawals = std::move(mPendingWithdrawals);
+
+    mPendingWithdrawals.clear();
+    mWithdrawingNames.clear();
+
+    for (const PendingWithdrawal &withdrawal : withdrawals)
     {
-        otbrLogWarning("Failed to handle result of host %s", aName);
+        Withdraw(withdrawal);
     }
 }
 
-Mdns::Publisher::TxtList AdvertisingProxy::MakeTxtList(const otSrpServerService *aSrpService)
+void AdvertisingProxy::ClearWithdrawals(void)
 {
-    const uint8_t *          txtData;
-    uint16_t                 txtDataLength = 0;
-    otDnsTxtEntryIterator    iterator;
-    otDnsTxtEntry            txtEntry;
-    Mdns::Publisher::TxtList txtList;
+    mWithdrawTask.Cancel();
+    mWithdrawScheduled = false;
+    mPendingWithdrawals.clear();
+    mWithdrawingNames.clear();
+}
 
-    txtData = otSrpServerServiceGetTxtData(aSrpService, &txtDataLength);
+void AdvertisingProxy::Withdraw(const PendingWithdrawal &aWithdrawal)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    otbrError commitError;
 
-    otDnsInitTxtEntryIterator(&iterator, txtData, txtDataLength);
+    mPublisher.BeginBatch(aWithdrawal.mHostName.c_str());
 
-    while (otDnsGetNextTxtEntry(&iterator, &txtEntry) == OT_ERROR_NONE)
+    if (aWithdrawal.mUnpublishHost)
     {
-        txtList.emplace_back(txtEntry.mKey, txtEntry.mValue, txtEntry.mValueLength);
+        otbrLogInfoRateLimited("Unpublish SRP host: %s", aWithdrawal.mHostName.c_str());
+        SuccessOrExit(error = mPublisher.UnpublishHost(aWithdrawal.mHostName.c_str()));
     }
 
-    return txtList;
+    for (const WithdrawnService &service : aWithdrawal.mServices)
+    {
+        otbrLogInfoRateLimited("Unpublish SRP service: %s.%s", service.mName.c_str(), service.mType.c_str());
+        SuccessOrExit(error = mPublisher.UnpublishService(service.mName.c_str(), service.mType.c_str()));
+    }
+
+exit:
+    commitError = mPublisher.CommitBatch();
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        error = commitError;
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to withdraw SRP host %s: %s", aWithdrawal.mHostName.c_str(), otbrErrorString(error));
+    }
+}
+
+void AdvertisingProxy::EstimateUpdatesMemory(size_t &aNumEntries, size_t &aNumBytes) const
+{
+    aNumEntries = mOutstandingUpdates.size() + mQueuedUpdates.size();
+    aNumBytes   = MemoryUsage::GetHashTableSize(mOutstandingUpdates) + MemoryUsage::GetHashTableSize(mServiceUpdates) +
+                MemoryUsage::GetHashTableSize(mHostUpdates) + MemoryUsage::GetListSize(mQueuedUpdates);
+
+    // The names are shared and counted by the name pool.
+    for (const auto &entry : mOutstandingUpdates)
+    {
+        aNumBytes += MemoryUsage::GetHeapSize(entry.second.mServiceKeys);
+    }
+}
+
+void AdvertisingProxy::RemoveFromIndex(UpdateIndex &aIndex, const InternedName &aKey, otSrpServerServiceUpdateId aId)
+{
+    auto range = aIndex.equal_range(aKey);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == aId)
+        {
+            aIndex.erase(it);
+            break;
+        }
+    }
 }
 
 } // namespace otbr
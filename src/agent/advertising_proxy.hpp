@@ -38,10 +38,21 @@
 
 #include <stdint.h>
 
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "common/interned_name.hpp"
+#include "common/memory_usage.hpp"
+#include "common/srp_readvertise_stats.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 
 namespace otbr {
@@ -77,30 +88,111 @@ public:
      */
     void Stop();
 
+    /**
+     * This method handles the state change of the mDNS publisher.
+     *
+     * Everything advertised is lost when the mDNS publisher (re)starts, e.g. after the mDNS daemon restarts. When
+     * the publisher becomes ready, all SRP hosts and services are advertised again, in batches of
+     * `OTBR_SRP_READVERTISE_BATCH_SIZE` hosts every `OTBR_SRP_READVERTISE_INTERVAL` milliseconds.
+     *
+     * @param[in]  aState  The state of the mDNS publisher.
+     *
+     */
+    void HandleMdnsState(Mdns::Publisher::State aState);
+
+    /**
+     * This method returns the statistics of re-advertising the SRP hosts.
+     *
+     * @returns  The re-advertisement statistics.
+     *
+     */
+    SrpReadvertiseStats GetReadvertiseStats(void) const;
+
 private:
     struct OutstandingUpdate
     {
-        typedef std::vector<std::pair<std::string, std::string>> ServiceNameList;
+        InternedName              mFullHostName;         // The full name of the SRP host.
+        InternedName              mHostName;             // The host name.
+        bool                      mWaitsForHost = false; // Whether the result of the host is expected.
+        std::vector<InternedName> mServiceKeys;          // The keys of the services whose results are expected.
+        uint32_t                  mCallbackCount = 0;    // The number of callbacks which we are waiting for.
+        TaskRunner::TaskHandle    mTimeoutTask;          // The task failing the update when it times out.
+    };
+
+    struct QueuedUpdate
+    {
+        otSrpServerServiceUpdateId mId;           // The ID of the SRP update.
+        const otSrpServerHost *    mHost;         // The SRP host, valid until the SRP server gets the result.
+        InternedName               mFullHostName; // The full name of the SRP host.
+        uint32_t                   mTimeout;      // The timeout of the SRP update in milliseconds.
+        Timepoint                  mQueueTime;    // When the SRP update was queued.
+        TaskRunner::TaskHandle     mTimeoutTask;  // The task rejecting the update when it's queued for too long.
+    };
 
-        otSrpServerServiceUpdateId mId;                // The ID of the SRP service update transaction.
-        std::string                mHostName;          // The host name.
-        ServiceNameList            mServiceNames;      // The list of service instance and name pair.
-        uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
+    struct WithdrawnService
+    {
+        std::string  mName; // The service instance name.
+        std::string  mType; // The service type.
+        InternedName mKey;  // The key by `Mdns::Publisher::MakeServiceKey()`.
+    };
+
+    struct PendingWithdrawal
+    {
+        InternedName                  mHostName;              // The host name.
+        bool                          mUnpublishHost = false; // Whether the host is advertised.
+        std::vector<WithdrawnService> mServices;              // The advertised services of the host.
     };
 
+    struct AdvertisedService
+    {
+        InternedName         mHostName; // The host name.
+        uint16_t             mPort = 0; // The port.
+        std::vector<uint8_t> mTxtData;  // The TXT data in the wire format.
+    };
+
+    typedef std::unordered_map<otSrpServerServiceUpdateId, OutstandingUpdate>                   OutstandingUpdates;
+    typedef std::unordered_multimap<InternedName, otSrpServerServiceUpdateId, InternedNameHash> UpdateIndex;
+
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                    const otSrpServerHost *    aHost,
                                    uint32_t                   aTimeout,
                                    void *                     aContext);
     void        AdvertisingHandler(otSrpServerServiceUpdateId aId, const otSrpServerHost *aHost, uint32_t aTimeout);
-
-    static Mdns::Publisher::TxtList MakeTxtList(const otSrpServerService *aSrpService);
+    void        AdvertiseHost(const otSrpServerHost *aHost, const otSrpServerServiceUpdateId *aId, uint32_t aTimeout);
 
     static void PublishServiceHandler(const char *aName, const char *aType, otbrError aError, void *aContext);
     void        PublishServiceHandler(const char *aName, const char *aType, otbrError aError);
     static void PublishHostHandler(const char *aName, otbrError aError, void *aContext);
     void        PublishHostHandler(const char *aName, otbrError aError);
 
+    bool HasOutstandingUpdate(const InternedName &aFullHostName) const;
+    void DispatchQueuedUpdates(void);
+    void HandleQueuedUpdateTimeout(otSrpServerServiceUpdateId aId);
+    void FailQueuedUpdates(otbrError aError);
+    void HandlePublishResult(UpdateIndex &aIndex, const InternedName &aKey, otbrError aError);
+    void HandleUpdateTimeout(otSrpServerServiceUpdateId aId);
+    void CompleteUpdate(otSrpServerServiceUpdateId aId, otbrError aError);
+    void ClearOutstandingUpdates(void);
+    bool IsServiceAdvertised(const InternedName &      aHostName,
+                             const InternedName &      aServiceKey,
+                             const otSrpServerService *aService) const;
+    void ForgetAdvertisedHost(const InternedName &aHostName);
+    void ClearAdvertised(void);
+    void FailOutstandingUpdates(otbrError aError);
+    void StartReadvertising(void);
+    void StopReadvertising(void);
+    void ReadvertiseHosts(void);
+    void QueueWithdrawal(PendingWithdrawal &&aWithdrawal);
+    bool IsWithdrawing(const InternedName &aName) const { return mWithdrawingNames.count(aName) != 0; }
+    void WithdrawHosts(void);
+    void FlushWithdrawals(void);
+    void ClearWithdrawals(void);
+    void Withdraw(const PendingWithdrawal &aWithdrawal);
+
+    static void RemoveFromIndex(UpdateIndex &aIndex, const InternedName &aKey, otSrpServerServiceUpdateId aId);
+
+    void EstimateUpdatesMemory(size_t &aNumEntries, size_t &aNumBytes) const;
+
     otInstance *GetInstance(void) { return mNcp.GetInstance(); }
 
     // A reference to the NCP controller, has no ownership.
@@ -109,8 +201,34 @@ private:
     // A reference to the mDNS publisher, has no ownership.
     Mdns::Publisher &mPublisher;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // The outstanding updates by ID, and the updates waiting for the result of each service and host.
+    OutstandingUpdates mOutstandingUpdates;
+    UpdateIndex        mServiceUpdates; // By `Mdns::Publisher::MakeServiceKey()`.
+    UpdateIndex        mHostUpdates;    // By host name.
+
+    // The SRP updates waiting for `OTBR_SRP_MAX_IN_FLIGHT_UPDATES` outstanding updates, in the order of arrival.
+    std::list<QueuedUpdate> mQueuedUpdates;
+    bool                    mDispatching;
+
+    // What has been advertised on mDNS for the SRP hosts and services, so that unchanged ones are not republished.
+    // The sorted addresses by host name, and the services by `MakeServiceKey()`.
+    std::unordered_map<InternedName, Mdns::Publisher::AddressList, InternedNameHash> mAdvertisedHosts;
+    std::unordered_map<InternedName, AdvertisedService, InternedNameHash>            mAdvertisedServices;
+
+    // The full names of the SRP hosts to be re-advertised after the mDNS publisher restarts.
+    std::unordered_set<std::string> mReadvertisePending;
+    TaskRunner::TaskHandle          mReadvertiseTask;
+    Timepoint                       mReadvertiseStartTime;
+    SrpReadvertiseStats             mReadvertiseStats;
+
+    // The withdrawals of deleted SRP hosts, e.g. on lease expiry, waiting to be paced out in batches of
+    // `OTBR_SRP_WITHDRAW_BATCH_SIZE` hosts every `OTBR_SRP_WITHDRAW_INTERVAL` milliseconds.
+    std::list<PendingWithdrawal>                       mPendingWithdrawals;
+    std::unordered_set<InternedName, InternedNameHash> mWithdrawingNames; // The host names and service keys.
+    TaskRunner::TaskHandle                             mWithdrawTask;
+    bool                                               mWithdrawScheduled;
+
+    MemoryReporter mUpdatesMemory;
 };
 
 } // namespace otbr
@@ -36,16 +36,42 @@
 #include "agent/agent_instance.hpp"
 
 #include <assert.h>
+#include <errno.h>
+#include <string.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
+#include "agent/instance_params.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/startup_profiler.hpp"
+
+#ifndef OTBR_MALLOC_TRIM_INTERVAL
+#define OTBR_MALLOC_TRIM_INTERVAL 0
+#endif
+
+#ifndef OTBR_NETIF_STATS_INTERVAL
+#define OTBR_NETIF_STATS_INTERVAL 10000
+#endif
 
 namespace otbr {
 
 AgentInstance::AgentInstance(Ncp::ControllerOpenThread &aNcp)
     : mNcp(aNcp)
     , mBorderAgent(aNcp)
+    , mLogMemory("otbr_log_queued_records",
+                 "Log messages queued for the background logging thread.",
+                 "otbr_log_buffer_memory_bytes",
+                 "Memory of the ring buffer of the asynchronous logging backend.",
+                 [](size_t &aNumEntries, size_t &aNumBytes) { otbrLogGetBufferUsage(&aNumEntries, &aNumBytes); })
+{
+}
+
+AgentInstance::~AgentInstance(void)
 {
+    mTrimHeapTask.Cancel();
+    mNetifStatsTask.Cancel();
 }
 
 otbrError AgentInstance::Init(void)
@@ -53,8 +79,32 @@ otbrError AgentInstance::Init(void)
     otbrError error = OTBR_ERROR_NONE;
 
     SuccessOrExit(error = mNcp.Init());
+    StartupProfiler::Get().EndPhase("ncp");
 
     mBorderAgent.Init();
+    StartupProfiler::Get().EndPhase("border-agent");
+
+    if (OTBR_MALLOC_TRIM_INTERVAL > 0)
+    {
+        mTrimHeapTask.Cancel();
+        mTrimHeapTask = mNcp.PostTimerTask(Seconds(OTBR_MALLOC_TRIM_INTERVAL), [this]() { TrimHeap(); });
+    }
+
+    if (OTBR_NETIF_STATS_INTERVAL > 0)
+    {
+        const char *backboneIfName = InstanceParams::Get().GetBackboneIfName();
+
+        // The throughput between both interfaces is what the border router forwards.
+        mNetifStats.AddInterface(NetifStatsSampler::Role::kThread, InstanceParams::Get().GetThreadIfName());
+
+        if (backboneIfName != nullptr && backboneIfName[0] != '\0')
+        {
+            mNetifStats.AddInterface(NetifStatsSampler::Role::kBackbone, backboneIfName);
+        }
+
+        mNetifStatsTask.Cancel();
+        SampleNetifStats();
+    }
 
 exit:
     otbrLogResult(error, "Initialize OpenThread Border Router Agent");
@@ -73,4 +123,28 @@ void AgentInstance::Process(const MainloopContext &aMainloop)
     mBorderAgent.Process(aMainloop);
 }
 
+void AgentInstance::TrimHeap(void)
+{
+#ifdef __GLIBC__
+    // Returns the memory freed after bursts, e.g. of mDNS browse results or Rest responses, to the system.
+    int released = malloc_trim(0);
+
+    otbrLogDebug("Trimmed the heap, memory %s released", released ? "was" : "wasn't");
+#endif
+
+    mTrimHeapTask = mNcp.PostTimerTask(Seconds(OTBR_MALLOC_TRIM_INTERVAL), [this]() { TrimHeap(); });
+}
+
+void AgentInstance::SampleNetifStats(void)
+{
+    otbrError error = mNetifStats.Sample(Clock::now());
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarningRateLimited("Failed to sample the network interface statistics: %s", strerror(errno));
+    }
+
+    mNetifStatsTask = mNcp.PostTimerTask(Milliseconds(OTBR_NETIF_STATS_INTERVAL), [this]() { SampleNetifStats(); });
+}
+
 } // namespace otbr
@@ -45,6 +45,9 @@
 #include "agent/instance_params.hpp"
 #include "agent/ncp_openthread.hpp"
 #include "common/mainloop.hpp"
+#include "common/memory_usage.hpp"
+#include "common/task_runner.hpp"
+#include "utils/netif_stats.hpp"
 
 namespace otbr {
 
@@ -63,6 +66,12 @@ public:
      */
     AgentInstance(Ncp::ControllerOpenThread &aNcp);
 
+    /**
+     * The destructor of the Thread border router agent instance.
+     *
+     */
+    ~AgentInstance(void) override;
+
     /**
      * This method initialize the agent.
      *
@@ -96,9 +105,24 @@ public:
      */
     otbr::Ncp::ControllerOpenThread &GetNcp(void) { return mNcp; }
 
+    /**
+     * This method returns the border agent.
+     *
+     * @returns  A reference to the border agent.
+     *
+     */
+    BorderAgent &GetBorderAgent(void) { return mBorderAgent; }
+
 private:
+    void TrimHeap(void);
+    void SampleNetifStats(void);
+
     otbr::Ncp::ControllerOpenThread &mNcp;
     BorderAgent                      mBorderAgent;
+    MemoryReporter                   mLogMemory;
+    TaskRunner::TaskHandle           mTrimHeapTask;
+    NetifStatsSampler                mNetifStats;
+    TaskRunner::TaskHandle           mNetifStatsTask;
 };
 
 } // namespace otbr
@@ -56,11 +56,16 @@
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/startup_profiler.hpp"
 #include "common/tlv.hpp"
 #include "common/types.hpp"
 #include "utils/hex.hpp"
 #include "utils/strcpy_utils.hpp"
 
+#ifndef OTBR_MESHCOP_REPUBLISH_DELAY
+#define OTBR_MESHCOP_REPUBLISH_DELAY 100
+#endif
+
 namespace otbr {
 
 static const char kBorderAgentServiceType[] = "_meshcop._udp"; ///< Border agent service type of mDNS
@@ -75,6 +80,65 @@ enum
     kInvalidLocator = 0xffff, ///< invalid locator.
 };
 
+/**
+ * This constant requests all MeshCoP TXT entries to be refreshed.
+ *
+ */
+static constexpr otChangedFlags kMeshCopTxtRefreshAll = 0xffffffff;
+
+/**
+ * The time the services are kept published after a reset of the OpenThread instance for Thread to be up again.
+ *
+ */
+static constexpr Milliseconds kResumeTimeout = Milliseconds(60000);
+
+/**
+ * The state changes the border agent is notified of.
+ *
+ */
+static constexpr otChangedFlags kBorderAgentChangedFlags =
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_THREAD_NETWORK_NAME | OT_CHANGED_ACTIVE_DATASET |
+    OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE | OT_CHANGED_THREAD_LL_ADDR |
+    OT_CHANGED_PSKC;
+
+/**
+ * The state changes affecting each MeshCoP TXT entry, indexed by `MeshCopTxtField`.
+ *
+ * Entries with no flags are constant and only read on a full refresh.
+ *
+ */
+static const otChangedFlags kMeshCopTxtFieldFlags[] = {
+    0,                                                                // rv
+    OT_CHANGED_THREAD_NETWORK_NAME,                                   // nn
+    OT_CHANGED_THREAD_EXT_PANID,                                      // xp
+    0,                                                                // tv
+    OT_CHANGED_THREAD_LL_ADDR,                                        // dd
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE, // sb
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_ACTIVE_DATASET,               // at
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID,          // pt
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE, // sq
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE, // bb
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE, // dn
+};
+
+static void AppendTxtEntry(std::vector<uint8_t> &aTxt, const char *aName, const void *aValue, size_t aValueLength)
+{
+    size_t         nameLength = strlen(aName);
+    const uint8_t *value      = static_cast<const uint8_t *>(aValue);
+
+    assert(nameLength + 1 + aValueLength <= UINT8_MAX);
+
+    aTxt.push_back(static_cast<uint8_t>(nameLength + 1 + aValueLength));
+    aTxt.insert(aTxt.end(), aName, aName + nameLength);
+    aTxt.push_back('=');
+    aTxt.insert(aTxt.end(), value, value + aValueLength);
+}
+
+static void AppendTxtEntry(std::vector<uint8_t> &aTxt, const char *aName, const char *aValue)
+{
+    AppendTxtEntry(aTxt, aName, aValue, strlen(aValue));
+}
+
 uint32_t BorderAgent::StateBitmap::ToUint32(void) const
 {
     uint32_t bitmap = 0;
@@ -92,11 +156,17 @@ BorderAgent::BorderAgent(otbr::Ncp::ControllerOpenThread &aNcp)
     : mNcp(aNcp)
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
     , mPublisher(Mdns::Publisher::Create(AF_UNSPEC, /* aDomain */ nullptr, HandleMdnsState, this))
+#else
+    , mPublisher(nullptr)
+#endif
+    , mMeshCopUpdatePending(false)
+    , mIsResuming(false)
+    , mMeshCopPort(0)
+    , mMeshCopTxtChangedFlags(kMeshCopTxtRefreshAll)
+#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     , mAdvertisingProxy(aNcp, *mPublisher)
 #endif
-#else
-    , mPublisher(nullptr)
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     , mDiscoveryProxy(aNcp, *mPublisher)
@@ -109,7 +179,9 @@ BorderAgent::BorderAgent(otbr::Ncp::ControllerOpenThread &aNcp)
 
 void BorderAgent::Init(void)
 {
-    mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); },
+                                       kBorderAgentChangedFlags, "border-agent");
+    mNcp.RegisterResetHandler([this]() { HandleNcpReset(); });
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
     mBackboneAgent.Init();
@@ -117,7 +189,15 @@ void BorderAgent::Init(void)
 
     if (IsThreadStarted())
     {
-        Start();
+        // The mDNS publisher is started from the mainloop, so that the Thread interface is served first.
+        mNcp.PostTimerTask(Milliseconds::zero(), [this]() {
+            VerifyOrExit(IsThreadStarted() && mPublisher != nullptr && !mPublisher->IsStarted());
+            Start();
+            StartupProfiler::Get().EndPhase("mdns");
+
+        exit:
+            return;
+        });
     }
     else
     {
@@ -134,6 +214,8 @@ otbrError BorderAgent::Start(void)
     // In case we didn't receive Thread down event.
     Stop();
 
+    mMeshCopTxtChangedFlags = kMeshCopTxtRefreshAll;
+
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy.Start();
@@ -155,6 +237,15 @@ void BorderAgent::Stop(void)
 {
     otbrLogInfo("Stop Thread Border Agent");
 
+    if (mIsResuming)
+    {
+        mResumeTimeoutTask.Cancel();
+        mIsResuming = false;
+    }
+
+    CancelMeshCopServiceUpdate();
+    mMeshCopTxtData.clear();
+
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
     mPublisher->Stop();
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
@@ -168,6 +259,51 @@ void BorderAgent::Stop(void)
 #endif
 }
 
+void BorderAgent::Resume(void)
+{
+    otbrLogInfo("Resume Thread Border Agent");
+
+    mResumeTimeoutTask.Cancel();
+    mIsResuming = false;
+
+    // The published services are kept, the MeshCoP service is only republished if its TXT data changed.
+    mMeshCopTxtChangedFlags = kMeshCopTxtRefreshAll;
+
+#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mAdvertisingProxy.Start();
+#endif
+    UpdateMeshCopService();
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    mDiscoveryProxy.Stop();
+    mDiscoveryProxy.Start();
+#endif
+
+#endif // OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
+}
+
+void BorderAgent::HandleNcpReset(void)
+{
+    // The new OpenThread instance is not attached yet. Instead of tearing down the mDNS publisher, the published
+    // services are kept for a while so that SRP clients re-registering unchanged services cause no mDNS churn.
+    VerifyOrExit(mPublisher != nullptr && mPublisher->IsStarted() && !mMeshCopTxtData.empty());
+
+    otbrLogInfo("Keep Thread Border Agent services across reset");
+
+    CancelMeshCopServiceUpdate();
+    mResumeTimeoutTask.Cancel();
+    mIsResuming        = true;
+    mResumeTimeoutTask = mNcp.PostTimerTask(kResumeTimeout, [this]() {
+        otbrLogWarning("Thread is not up after reset");
+        mIsResuming = false;
+        Stop();
+    });
+
+exit:
+    return;
+}
+
 void BorderAgent::HandleMdnsState(void *aContext, Mdns::Publisher::State aState)
 {
     static_cast<BorderAgent *>(aContext)->HandleMdnsState(aState);
@@ -186,10 +322,20 @@ BorderAgent::~BorderAgent(void)
 
 void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
 {
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mAdvertisingProxy.HandleMdnsState(aState);
+#endif
+
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
-        UpdateMeshCopService();
+        // The services published before are lost when the publisher (re)starts.
+        mMeshCopTxtData.clear();
+        // Thread may still be down while resuming after a reset.
+        if (IsThreadStarted())
+        {
+            UpdateMeshCopService();
+        }
         break;
     default:
         otbrLogWarning("MDNS service not available!");
@@ -220,53 +366,80 @@ void BorderAgent::Process(const MainloopContext &aMainloop)
     }
 }
 
-void BorderAgent::PublishMeshCopService(void)
+uint8_t BorderAgent::GetThreadIfStatus(void) const
 {
-    StateBitmap              state;
-    uint32_t                 stateUint32;
-    otInstance *             instance    = mNcp.GetInstance();
-    const otExtendedPanId *  extPanId    = otThreadGetExtendedPanId(instance);
-    const otExtAddress *     extAddr     = otLinkGetExtendedAddress(instance);
-    const char *             networkName = otThreadGetNetworkName(instance);
-    Mdns::Publisher::TxtList txtList{{"rv", "1"}};
-
-    otbrLogInfo("Publish meshcop service %s.%s.local.", networkName, kBorderAgentServiceType);
+    uint8_t status;
 
-    txtList.emplace_back("nn", networkName);
-    txtList.emplace_back("xp", extPanId->m8, sizeof(extPanId->m8));
-    txtList.emplace_back("tv", mNcp.GetThreadVersion());
-
-    // "dd" represents for device discriminator which
-    // should always be the IEEE 802.15.4 extended address.
-    txtList.emplace_back("dd", extAddr->m8, sizeof(extAddr->m8));
-
-    state.mConnectionMode = kConnectionModePskc;
-    state.mAvailability   = kAvailabilityHigh;
-#if OTBR_ENABLE_BACKBONE_ROUTER
-    state.mBbrIsActive  = otBackboneRouterGetState(instance) != OT_BACKBONE_ROUTER_STATE_DISABLED;
-    state.mBbrIsPrimary = otBackboneRouterGetState(instance) == OT_BACKBONE_ROUTER_STATE_PRIMARY;
-#endif
-    switch (otThreadGetDeviceRole(instance))
+    switch (otThreadGetDeviceRole(mNcp.GetInstance()))
     {
     case OT_DEVICE_ROLE_DISABLED:
-        state.mThreadIfStatus = kThreadIfStatusNotInitialized;
+        status = kThreadIfStatusNotInitialized;
         break;
     case OT_DEVICE_ROLE_DETACHED:
-        state.mThreadIfStatus = kThreadIfStatusInitialized;
+        status = kThreadIfStatusInitialized;
         break;
     default:
-        state.mThreadIfStatus = kThreadIfStatusActive;
+        status = kThreadIfStatusActive;
     }
 
-    stateUint32 = htobe32(state.ToUint32());
-    txtList.emplace_back("sb", reinterpret_cast<uint8_t *>(&stateUint32), sizeof(stateUint32));
+    return status;
+}
+
+void BorderAgent::EncodeMeshCopTxtEntry(MeshCopTxtField aField, std::vector<uint8_t> &aEntry) const
+{
+    otInstance *instance = mNcp.GetInstance();
+
+    aEntry.clear();
+
+    switch (aField)
+    {
+    case kMeshCopTxtRecordVersion:
+        AppendTxtEntry(aEntry, "rv", "1");
+        break;
+
+    case kMeshCopTxtNetworkName:
+        AppendTxtEntry(aEntry, "nn", otThreadGetNetworkName(instance));
+        break;
+
+    case kMeshCopTxtExtPanId:
+        AppendTxtEntry(aEntry, "xp", otThreadGetExtendedPanId(instance)->m8, sizeof(otExtendedPanId));
+        break;
 
-    if (state.mThreadIfStatus == kThreadIfStatusActive)
+    case kMeshCopTxtThreadVersion:
+        AppendTxtEntry(aEntry, "tv", mNcp.GetThreadVersion());
+        break;
+
+    case kMeshCopTxtDiscriminator:
+        // "dd" represents for device discriminator which
+        // should always be the IEEE 802.15.4 extended address.
+        AppendTxtEntry(aEntry, "dd", otLinkGetExtendedAddress(instance)->m8, sizeof(otExtAddress));
+        break;
+
+    case kMeshCopTxtStateBitmap:
+    {
+        StateBitmap state;
+        uint32_t    stateUint32;
+
+        state.mConnectionMode = kConnectionModePskc;
+        state.mAvailability   = kAvailabilityHigh;
+#if OTBR_ENABLE_BACKBONE_ROUTER
+        state.mBbrIsActive  = otBackboneRouterGetState(instance) != OT_BACKBONE_ROUTER_STATE_DISABLED;
+        state.mBbrIsPrimary = otBackboneRouterGetState(instance) == OT_BACKBONE_ROUTER_STATE_PRIMARY;
+#endif
+        state.mThreadIfStatus = GetThreadIfStatus();
+
+        stateUint32 = htobe32(state.ToUint32());
+        AppendTxtEntry(aEntry, "sb", &stateUint32, sizeof(stateUint32));
+        break;
+    }
+
+    case kMeshCopTxtActiveTimestamp:
     {
         otError              error;
         otOperationalDataset activeDataset;
         uint64_t             activeTimestamp;
-        uint32_t             partitionId;
+
+        VerifyOrExit(GetThreadIfStatus() == kThreadIfStatusActive);
 
         if ((error = otDatasetGetActive(instance, &activeDataset)) != OT_ERROR_NONE)
         {
@@ -275,29 +448,128 @@ void BorderAgent::PublishMeshCopService(void)
         else
         {
             activeTimestamp = htobe64(activeDataset.mActiveTimestamp);
-            txtList.emplace_back("at", reinterpret_cast<uint8_t *>(&activeTimestamp), sizeof(activeTimestamp));
+            AppendTxtEntry(aEntry, "at", &activeTimestamp, sizeof(activeTimestamp));
         }
+        break;
+    }
+
+    case kMeshCopTxtPartitionId:
+    {
+        uint32_t partitionId;
+
+        VerifyOrExit(GetThreadIfStatus() == kThreadIfStatusActive);
 
         partitionId = otThreadGetPartitionId(instance);
-        txtList.emplace_back("pt", reinterpret_cast<uint8_t *>(&partitionId), sizeof(partitionId));
+        AppendTxtEntry(aEntry, "pt", &partitionId, sizeof(partitionId));
+        break;
     }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    if (state.mBbrIsActive)
+    case kMeshCopTxtBbrSequenceNumber:
     {
         otBackboneRouterConfig bbrConfig;
-        uint16_t               bbrPort = htobe16(BackboneRouter::BackboneAgent::kBackboneUdpPort);
+
+        VerifyOrExit(otBackboneRouterGetState(instance) != OT_BACKBONE_ROUTER_STATE_DISABLED);
 
         otBackboneRouterGetConfig(instance, &bbrConfig);
-        txtList.emplace_back("sq", &bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
-        txtList.emplace_back("bb", reinterpret_cast<const uint8_t *>(&bbrPort), sizeof(bbrPort));
+        AppendTxtEntry(aEntry, "sq", &bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
+        break;
+    }
+
+    case kMeshCopTxtBbrPort:
+    {
+        uint16_t bbrPort = htobe16(BackboneRouter::BackboneAgent::kBackboneUdpPort);
+
+        VerifyOrExit(otBackboneRouterGetState(instance) != OT_BACKBONE_ROUTER_STATE_DISABLED);
+
+        AppendTxtEntry(aEntry, "bb", &bbrPort, sizeof(bbrPort));
+        break;
     }
 
-    txtList.emplace_back("dn", otThreadGetDomainName(instance));
+    case kMeshCopTxtDomainName:
+        AppendTxtEntry(aEntry, "dn", otThreadGetDomainName(instance));
+        break;
 #endif
 
-    mPublisher->PublishService(/* aHostName */ nullptr, otBorderAgentGetUdpPort(instance), networkName,
-                               kBorderAgentServiceType, txtList);
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+void BorderAgent::UpdateMeshCopTxt(void)
+{
+    bool changed = false;
+
+    static_assert(sizeof(kMeshCopTxtFieldFlags) / sizeof(kMeshCopTxtFieldFlags[0]) == kMeshCopTxtNumFields,
+                  "kMeshCopTxtFieldFlags doesn't match MeshCopTxtField");
+
+    VerifyOrExit(mMeshCopTxtChangedFlags != 0);
+
+    for (uint8_t i = 0; i < kMeshCopTxtNumFields; ++i)
+    {
+        std::vector<uint8_t> entry;
+
+        if (mMeshCopTxtChangedFlags != kMeshCopTxtRefreshAll &&
+            (mMeshCopTxtChangedFlags & kMeshCopTxtFieldFlags[i]) == 0)
+        {
+            continue;
+        }
+
+        EncodeMeshCopTxtEntry(static_cast<MeshCopTxtField>(i), entry);
+
+        if (entry != mMeshCopTxtEntries[i])
+        {
+            mMeshCopTxtEntries[i].swap(entry);
+            changed = true;
+        }
+    }
+
+    mMeshCopTxtChangedFlags = 0;
+
+    if (changed)
+    {
+        mMeshCopTxt.clear();
+
+        for (const std::vector<uint8_t> &entry : mMeshCopTxtEntries)
+        {
+            mMeshCopTxt.insert(mMeshCopTxt.end(), entry.begin(), entry.end());
+        }
+    }
+
+exit:
+    return;
+}
+
+void BorderAgent::PublishMeshCopService(void)
+{
+    otInstance *instance    = mNcp.GetInstance();
+    const char *networkName = otThreadGetNetworkName(instance);
+    uint16_t    port        = otBorderAgentGetUdpPort(instance);
+
+    UpdateMeshCopTxt();
+
+    VerifyOrExit(mMeshCopTxtData.empty() || mNetworkName != networkName || mMeshCopPort != port ||
+                     mMeshCopTxtData != mMeshCopTxt,
+                 otbrLogDebug("Meshcop service is not changed"));
+
+    otbrLogInfo("Publish meshcop service %s.%s.local.", networkName, kBorderAgentServiceType);
+
+    if (mPublisher->PublishService(/* aHostName */ nullptr, port, networkName, kBorderAgentServiceType,
+                                   {mMeshCopTxt.data(), static_cast<uint16_t>(mMeshCopTxt.size())}) == OTBR_ERROR_NONE)
+    {
+        mMeshCopPort    = port;
+        mMeshCopTxtData = mMeshCopTxt;
+    }
+    else
+    {
+        mMeshCopTxtData.clear();
+    }
+
+exit:
+    return;
 }
 
 void BorderAgent::UnpublishMeshCopService(void)
@@ -308,6 +580,7 @@ void BorderAgent::UnpublishMeshCopService(void)
     otbrLogInfo("Unpublish meshcop service %s.%s.local.", mNetworkName.c_str(), kBorderAgentServiceType);
 
     mPublisher->UnpublishService(mNetworkName.c_str(), kBorderAgentServiceType);
+    mMeshCopTxtData.clear();
 
 exit:
     return;
@@ -341,12 +614,47 @@ exit:
     return;
 }
 
+void BorderAgent::ScheduleMeshCopServiceUpdate(void)
+{
+    // Changes within the window are coalesced, the window is not extended so that the update is never starved.
+    VerifyOrExit(!mMeshCopUpdatePending);
+
+    if (OTBR_MESHCOP_REPUBLISH_DELAY == 0)
+    {
+        UpdateMeshCopService();
+        ExitNow();
+    }
+
+    mMeshCopUpdatePending = true;
+    mMeshCopUpdateTask    = mNcp.PostTimerTask(Milliseconds(OTBR_MESHCOP_REPUBLISH_DELAY), [this]() {
+        mMeshCopUpdatePending = false;
+
+        if (IsThreadStarted())
+        {
+            UpdateMeshCopService();
+        }
+    });
+
+exit:
+    return;
+}
+
+void BorderAgent::CancelMeshCopServiceUpdate(void)
+{
+    VerifyOrExit(mMeshCopUpdatePending);
+
+    mMeshCopUpdateTask.Cancel();
+    mMeshCopUpdatePending = false;
+
+exit:
+    return;
+}
+
 void BorderAgent::HandleThreadStateChanged(otChangedFlags aFlags)
 {
     VerifyOrExit(mPublisher != nullptr);
-    VerifyOrExit(aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_THREAD_NETWORK_NAME |
-                           OT_CHANGED_ACTIVE_DATASET | OT_CHANGED_THREAD_PARTITION_ID |
-                           OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE | OT_CHANGED_PSKC));
+
+    mMeshCopTxtChangedFlags |= aFlags;
 
     if (aFlags & OT_CHANGED_THREAD_ROLE)
     {
@@ -354,16 +662,23 @@ void BorderAgent::HandleThreadStateChanged(otChangedFlags aFlags)
 
         if (IsThreadStarted())
         {
-            Start();
+            if (mIsResuming)
+            {
+                Resume();
+            }
+            else
+            {
+                Start();
+            }
         }
-        else
+        else if (!mIsResuming)
         {
             Stop();
         }
     }
     else if (IsThreadStarted())
     {
-        UpdateMeshCopService();
+        ScheduleMeshCopServiceUpdate();
     }
 
 exit:
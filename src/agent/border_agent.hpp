@@ -43,6 +43,7 @@
 #include "agent/instance_params.hpp"
 #include "agent/ncp_openthread.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 #include "mdns/mdns.hpp"
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
@@ -99,6 +100,34 @@ public:
      */
     void Process(const MainloopContext &aMainloop) override;
 
+    /**
+     * This method returns the mDNS publisher of the border agent.
+     *
+     * @returns  A pointer to the mDNS publisher, or nullptr if mDNS is disabled.
+     *
+     */
+    Mdns::Publisher *GetPublisher(void) { return mPublisher; }
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method returns the SRP Advertising Proxy.
+     *
+     * @returns  The SRP Advertising Proxy.
+     *
+     */
+    AdvertisingProxy &GetAdvertisingProxy(void) { return mAdvertisingProxy; }
+#endif
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    /**
+     * This method returns the Backbone agent.
+     *
+     * @returns A reference to the Backbone agent.
+     *
+     */
+    BackboneRouter::BackboneAgent &GetBackboneAgent(void) { return mBackboneAgent; }
+#endif
+
 private:
     enum : uint8_t
     {
@@ -142,13 +171,37 @@ private:
         uint32_t ToUint32(void) const;
     };
 
+    // The entries of the MeshCoP TXT record, in the order they are published.
+    enum MeshCopTxtField : uint8_t
+    {
+        kMeshCopTxtRecordVersion,
+        kMeshCopTxtNetworkName,
+        kMeshCopTxtExtPanId,
+        kMeshCopTxtThreadVersion,
+        kMeshCopTxtDiscriminator,
+        kMeshCopTxtStateBitmap,
+        kMeshCopTxtActiveTimestamp,
+        kMeshCopTxtPartitionId,
+        kMeshCopTxtBbrSequenceNumber,
+        kMeshCopTxtBbrPort,
+        kMeshCopTxtDomainName,
+        kMeshCopTxtNumFields,
+    };
+
     otbrError   Start(void);
     void        Stop(void);
+    void        Resume(void);
+    void        HandleNcpReset(void);
     static void HandleMdnsState(void *aContext, Mdns::Publisher::State aState);
     void        HandleMdnsState(Mdns::Publisher::State aState);
     void        PublishMeshCopService(void);
     void        UnpublishMeshCopService(void);
     void        UpdateMeshCopService(void);
+    void        ScheduleMeshCopServiceUpdate(void);
+    void        CancelMeshCopServiceUpdate(void);
+    void        UpdateMeshCopTxt(void);
+    void        EncodeMeshCopTxtEntry(MeshCopTxtField aField, std::vector<uint8_t> &aEntry) const;
+    uint8_t     GetThreadIfStatus(void) const;
 
     void HandleThreadStateChanged(otChangedFlags aFlags);
 
@@ -159,6 +212,25 @@ private:
     Mdns::Publisher *                mPublisher;
     std::string                      mNetworkName;
 
+    // The pending republish of the MeshCoP service, see `ScheduleMeshCopServiceUpdate()`.
+    TaskRunner::TaskHandle mMeshCopUpdateTask;
+    bool                   mMeshCopUpdatePending;
+
+    // Whether the services published before a reset of the OpenThread instance are kept until Thread is up again,
+    // see `HandleNcpReset()`.
+    TaskRunner::TaskHandle mResumeTimeoutTask;
+    bool                   mIsResuming;
+
+    // The port and TXT data of the published MeshCoP service, so that identical updates are skipped.
+    uint16_t             mMeshCopPort;
+    std::vector<uint8_t> mMeshCopTxtData;
+
+    // The MeshCoP TXT entries in wire format and the TXT record built from them, see `UpdateMeshCopTxt()`. Only the
+    // entries affected by the accumulated state changes are read again from OpenThread.
+    std::vector<uint8_t> mMeshCopTxtEntries[kMeshCopTxtNumFields];
+    std::vector<uint8_t> mMeshCopTxt;
+    otChangedFlags       mMeshCopTxtChangedFlags;
+
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     AdvertisingProxy mAdvertisingProxy;
 #endif
@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the history of the Thread counters.
+ */
+
+#include "agent/counter_history.hpp"
+
+#include <assert.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+// Subtracts each `uint32_t` counter of a counters structure.
+template <typename CountersType>
+static void SubtractCounters(const CountersType &aNew, const CountersType &aOld, CountersType &aDelta)
+{
+    static_assert(sizeof(CountersType) % sizeof(uint32_t) == 0, "Counters must be made of uint32_t");
+
+    constexpr size_t kNumCounters = sizeof(CountersType) / sizeof(uint32_t);
+    uint32_t         newCounters[kNumCounters];
+    uint32_t         oldCounters[kNumCounters];
+
+    memcpy(newCounters, &aNew, sizeof(newCounters));
+    memcpy(oldCounters, &aOld, sizeof(oldCounters));
+
+    for (size_t i = 0; i < kNumCounters; ++i)
+    {
+        newCounters[i] = (newCounters[i] >= oldCounters[i]) ? newCounters[i] - oldCounters[i] : newCounters[i];
+    }
+
+    memcpy(&aDelta, newCounters, sizeof(newCounters));
+}
+
+CounterHistory::CounterHistory(size_t aCapacity)
+    : mSamples(aCapacity + 1)
+    , mNext(0)
+    , mCount(0)
+{
+    assert(aCapacity > 0);
+}
+
+void CounterHistory::TakeSample(otInstance *aInstance)
+{
+    Sample sample;
+
+    sample.mTime           = Clock::now();
+    sample.mMacCounters    = *otLinkGetCounters(aInstance);
+    sample.mIpCounters     = *otThreadGetIp6Counters(aInstance);
+    sample.mCcaFailureRate = otLinkGetCcaFailureRate(aInstance);
+
+    Record(sample);
+}
+
+void CounterHistory::Record(const Sample &aSample)
+{
+    mSamples[mNext] = aSample;
+    mNext           = (mNext + 1) % mSamples.size();
+
+    if (mCount < mSamples.size())
+    {
+        ++mCount;
+    }
+}
+
+void CounterHistory::Clear(void)
+{
+    mNext  = 0;
+    mCount = 0;
+}
+
+const CounterHistory::Sample &CounterHistory::GetSample(size_t aIndex) const
+{
+    // Index 0 is the oldest sample.
+    return mSamples[(mNext + mSamples.size() - mCount + aIndex) % mSamples.size()];
+}
+
+std::vector<CounterHistory::Interval> CounterHistory::GetIntervals(Milliseconds aPeriod) const
+{
+    std::vector<Interval> intervals;
+    size_t                first = 1;
+
+    VerifyOrExit(mCount > 1);
+
+    if (aPeriod > Milliseconds::zero())
+    {
+        Timepoint start = GetSample(mCount - 1).mTime - aPeriod;
+
+        while (first < mCount && GetSample(first).mTime <= start)
+        {
+            ++first;
+        }
+    }
+
+    intervals.reserve(mCount - first);
+
+    for (size_t i = first; i < mCount; ++i)
+    {
+        const Sample &older = GetSample(i - 1);
+        const Sample &newer = GetSample(i);
+        Interval      interval;
+
+        interval.mEnd            = newer.mTime;
+        interval.mDuration       = std::chrono::duration_cast<Milliseconds>(newer.mTime - older.mTime);
+        interval.mCcaFailureRate = newer.mCcaFailureRate;
+        SubtractCounters(newer.mMacCounters, older.mMacCounters, interval.mMacCounters);
+        SubtractCounters(newer.mIpCounters, older.mIpCounters, interval.mIpCounters);
+        intervals.push_back(interval);
+    }
+
+exit:
+    return intervals;
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the history of the Thread counters.
+ */
+
+#ifndef OTBR_AGENT_COUNTER_HISTORY_HPP_
+#define OTBR_AGENT_COUNTER_HISTORY_HPP_
+
+#include <openthread-br/config.h>
+
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class keeps the recent history of the MAC, IPv6 and CCA counters in a fixed-size ring buffer.
+ *
+ * The counters are sampled at a fixed interval, so that one infrequent query returns the increase of each counter
+ * in every interval instead of collectors polling the totals often to compute rates.
+ *
+ * This class must be used on the mainloop.
+ *
+ */
+class CounterHistory
+{
+public:
+    /**
+     * This structure represents the counters sampled at a time.
+     *
+     */
+    struct Sample
+    {
+        Timepoint     mTime;           ///< The time the sample was taken.
+        otMacCounters mMacCounters;    ///< The MAC counters.
+        otIpCounters  mIpCounters;     ///< The IPv6 counters.
+        uint16_t      mCcaFailureRate; ///< The CCA failure rate, 0xffff for 100%.
+    };
+
+    /**
+     * This structure represents the increase of the counters between two consecutive samples.
+     *
+     */
+    struct Interval
+    {
+        Timepoint     mEnd;            ///< The end of the interval.
+        Milliseconds  mDuration;       ///< The duration of the interval.
+        otMacCounters mMacCounters;    ///< The increase of the MAC counters.
+        otIpCounters  mIpCounters;     ///< The increase of the IPv6 counters.
+        uint16_t      mCcaFailureRate; ///< The CCA failure rate at the end of the interval, 0xffff for 100%.
+    };
+
+    /**
+     * This constructor initializes an empty history.
+     *
+     * @param[in]  aCapacity  The maximum number of intervals kept, older intervals are dropped.
+     *
+     */
+    explicit CounterHistory(size_t aCapacity);
+
+    /**
+     * This method samples the counters now and records the sample.
+     *
+     * @param[in]  aInstance  The OpenThread instance.
+     *
+     */
+    void TakeSample(otInstance *aInstance);
+
+    /**
+     * This method records a sample, which must be taken after the previously recorded one.
+     *
+     * @param[in]  aSample  The sample.
+     *
+     */
+    void Record(const Sample &aSample);
+
+    /**
+     * This method drops all samples, e.g. after the counters are reset.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the intervals which ended in a recent period.
+     *
+     * A counter which went backwards, i.e. was reset, counts from zero in the interval.
+     *
+     * @param[in]  aPeriod  The period before the last sample, all the intervals kept if zero.
+     *
+     * @returns  The intervals from the oldest to the newest.
+     *
+     */
+    std::vector<Interval> GetIntervals(Milliseconds aPeriod) const;
+
+    /**
+     * This method returns the maximum number of intervals kept.
+     *
+     * @returns  The capacity of the history.
+     *
+     */
+    size_t GetCapacity(void) const { return mSamples.size() - 1; }
+
+private:
+    const Sample &GetSample(size_t aIndex) const;
+
+    // A ring of `capacity + 1` samples, as each interval is between two samples
+    std::vector<Sample> mSamples;
+    size_t              mNext;
+    size_t              mCount;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_COUNTER_HISTORY_HPP_
@@ -38,7 +38,9 @@
 #include "agent/discovery_proxy.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <string>
+#include <vector>
 
 #include <assert.h>
 
@@ -47,6 +49,7 @@
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 
 namespace otbr {
 namespace Dnssd {
@@ -54,6 +57,9 @@ namespace Dnssd {
 DiscoveryProxy::DiscoveryProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mMdnsPublisher(aPublisher)
+    , mRefreshTime(Timepoint::max())
+    , mAnsweringName(nullptr)
+    , mAnsweringFinalized(false)
 {
 }
 
@@ -69,7 +75,13 @@ void DiscoveryProxy::Start(void)
 
         [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo) {
             OnHostDiscovered(aHostName, aHostInfo);
-        });
+        },
+
+        [this](const std::string &aType, const std::string &aInstanceName) {
+            OnServiceNotFound(aType, aInstanceName);
+        },
+
+        [this](const std::string &aHostName) { OnHostNotFound(aHostName); });
 
     otbrLogInfo("started");
 }
@@ -77,7 +89,12 @@ void DiscoveryProxy::Start(void)
 void DiscoveryProxy::Stop(void)
 {
     otDnssdQuerySetCallbacks(mNcp.GetInstance(), nullptr, nullptr, nullptr);
+    StopRefreshing();
     mMdnsPublisher.SetSubscriptionCallbacks(nullptr, nullptr);
+    mAnswerTask.Cancel();
+    mPendingInstances.clear();
+    mPendingHosts.clear();
+    ClearCache();
 
     otbrLogInfo("stopped");
 }
@@ -93,20 +110,28 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
     otbrError   error    = OTBR_ERROR_NONE;
     DnsNameInfo nameInfo = SplitFullDnsName(fullName);
 
-    otbrLogInfo("subscribe: %s", fullName.c_str());
+    otbrLogInfoRateLimited("subscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    if (IsNegativelyCached(MakeCacheKey(nameInfo)))
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
-        }
+        otbrLogInfoRateLimited("%s does not exist (cached), not forwarded to mDNS", fullName.c_str());
+        ++mUnforwardedSubscriptions[InternedName(fullName)];
+        ExitNow();
     }
 
+    AddHotName(MakeCacheKey(nameInfo), nameInfo);
+
+    // Answering from cache may finalize the query, the unsubscription is then reported within this call.
+    mAnsweringName      = &fullName;
+    mAnsweringFinalized = false;
+    AnswerFromCache(nameInfo);
+    mAnsweringName = nullptr;
+
+    VerifyOrExit(!mAnsweringFinalized, otbrLogInfoRateLimited("%s is answered from cache", fullName.c_str()));
+
+    SubscribeMdns(nameInfo);
+
+exit:
     if (error != OTBR_ERROR_NONE)
     {
         otbrLogWarning("failed to subscribe %s: %s", fullName.c_str(), otbrErrorString(error));
@@ -124,19 +149,38 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
     otbrError   error    = OTBR_ERROR_NONE;
     DnsNameInfo nameInfo = SplitFullDnsName(fullName);
 
-    otbrLogInfo("unsubscribe: %s", fullName.c_str());
+    otbrLogInfoRateLimited("unsubscribe: %s", fullName.c_str());
+
+    if (mAnsweringName != nullptr && !mAnsweringFinalized && *mAnsweringName == fullName)
+    {
+        mAnsweringFinalized = true;
+        ExitNow();
+    }
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
     {
-        if (nameInfo.mHostName.empty())
+        InternedName subscription;
+        auto         unforwarded = mUnforwardedSubscriptions.end();
+
+        // A name which isn't interned can't be an unforwarded subscription.
+        if (NamePool::Get().Find(fullName, subscription))
         {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+            unforwarded = mUnforwardedSubscriptions.find(subscription);
         }
-        else
+
+        if (unforwarded != mUnforwardedSubscriptions.end())
         {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
+            if (--unforwarded->second == 0)
+            {
+                mUnforwardedSubscriptions.erase(unforwarded);
+            }
+
+            ExitNow();
         }
     }
+
+    UnsubscribeMdns(nameInfo);
+
+exit:
     if (error != OTBR_ERROR_NONE)
     {
         otbrLogWarning("failed to unsubscribe %s: %s", fullName.c_str(), otbrErrorString(error));
@@ -146,185 +190,611 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 void DiscoveryProxy::OnServiceDiscovered(const std::string &                            aType,
                                          const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
-    otDnssdServiceInstanceInfo instanceInfo;
-    const otDnssdQuery *       query = nullptr;
+    std::string key = Mdns::Publisher::MakeServiceKey(aInstanceInfo.mName.c_str(), aType.c_str());
 
-    otbrLogInfo("service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
-                "weight %d",
-                aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
-                aInstanceInfo.mAddresses.size(), aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
+    otbrLogInfoRateLimited("service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
+                           "weight %d",
+                           aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
+                           aInstanceInfo.mAddresses.size(), aInstanceInfo.mPort, aInstanceInfo.mPriority,
+                           aInstanceInfo.mWeight);
 
     CheckServiceNameSanity(aType);
     CheckHostnameSanity(aInstanceInfo.mHostName);
 
-    instanceInfo.mAddressNum = aInstanceInfo.mAddresses.size();
+    mNegativeCache.erase(key);
+    mNegativeCache.erase(Mdns::Publisher::MakeServiceKey("", aType.c_str()));
 
-    if (!aInstanceInfo.mAddresses.empty())
+    if (aInstanceInfo.mTtl > 0 && (mInstanceCache.count(key) > 0 || mInstanceCache.size() < kMaxCacheEntries))
     {
-        instanceInfo.mAddresses = reinterpret_cast<const otIp6Address *>(&aInstanceInfo.mAddresses[0]);
+        CachedInstance &entry = mInstanceCache[key];
+
+        entry.mInfo       = aInstanceInfo;
+        entry.mExpireTime = MainloopManager::GetInstance().GetNow() + Seconds(CapTtl(aInstanceInfo.mTtl));
+
+        if (!mHotNames.empty())
+        {
+            ScheduleRefresh(entry.mExpireTime - Seconds(kRefreshAheadTime));
+        }
     }
-    else
+
+    ScheduleAnswers();
+
+    DiscoveredInstance &pending = mPendingInstances[key];
+
+    pending.mType = aType;
+    pending.mInfo = aInstanceInfo;
+}
+
+void DiscoveryProxy::OnHostDiscovered(const std::string &                        aHostName,
+                                      const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
+{
+    otbrLogInfoRateLimited("host discovered: %s hostname %s addresses %zu", aHostName.c_str(),
+                           aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size());
+
+    CheckHostnameSanity(aHostInfo.mHostName);
+
+    mNegativeCache.erase(aHostName);
+
+    if (aHostInfo.mTtl > 0 && (mHostCache.count(aHostName) > 0 || mHostCache.size() < kMaxCacheEntries))
     {
-        instanceInfo.mAddresses = nullptr;
+        CachedHost &entry = mHostCache[aHostName];
+
+        entry.mInfo       = aHostInfo;
+        entry.mExpireTime = MainloopManager::GetInstance().GetNow() + Seconds(CapTtl(aHostInfo.mTtl));
+
+        if (!mHotNames.empty())
+        {
+            ScheduleRefresh(entry.mExpireTime - Seconds(kRefreshAheadTime));
+        }
     }
 
-    instanceInfo.mPort      = aInstanceInfo.mPort;
-    instanceInfo.mPriority  = aInstanceInfo.mPriority;
-    instanceInfo.mWeight    = aInstanceInfo.mWeight;
-    instanceInfo.mTxtLength = static_cast<uint16_t>(aInstanceInfo.mTxtData.size());
-    instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
-    instanceInfo.mTtl       = CapTtl(aInstanceInfo.mTtl);
+    ScheduleAnswers();
+    mPendingHosts[aHostName] = aHostInfo;
+}
+
+void DiscoveryProxy::ScheduleAnswers(void)
+{
+    // Results discovered in the same mainloop iteration, e.g. all instances of a browse, are answered together.
+    VerifyOrExit(mPendingInstances.empty() && mPendingHosts.empty());
+    mAnswerTask = mNcp.PostTimerTask(Milliseconds(0), [this]() { FlushAnswers(); });
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::FlushAnswers(void)
+{
+    InstanceMap instances;
+    HostMap     hosts;
+
+    // Answering may finalize queries and so discover more results, which start the next batch.
+    instances.swap(mPendingInstances);
+    hosts.swap(mPendingHosts);
+
+    AnswerQueries(instances, hosts);
+}
+
+void DiscoveryProxy::AnswerQueries(const InstanceMap &aInstances, const HostMap &aHosts)
+{
+    struct ServiceAnswer
+    {
+        std::string                                    mServiceFullName;
+        std::string                                    mHostName;
+        const Mdns::Publisher::DiscoveredInstanceInfo *mInfo;
+    };
+
+    struct HostAnswer
+    {
+        const Mdns::Publisher::DiscoveredHostInfo *mInfo;
+    };
+
+    // Answers by the instance full name and the host full name, so that each of them is built once.
+    std::map<std::string, ServiceAnswer> serviceAnswers;
+    std::map<std::string, HostAnswer>    hostAnswers;
+    const otDnssdQuery *                 query = nullptr;
 
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
-        std::string      instanceName;
-        std::string      serviceName;
-        std::string      hostName;
-        std::string      domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
+        DnsNameParts     parts;
+        std::string      domain;
 
         switch (type)
         {
         case OT_DNSSD_QUERY_TYPE_BROWSE:
-            splitError = SplitFullServiceName(queryName, serviceName, domain);
-            assert(splitError == OTBR_ERROR_NONE);
-            break;
         case OT_DNSSD_QUERY_TYPE_RESOLVE:
-            splitError = SplitFullServiceInstanceName(queryName, instanceName, serviceName, domain);
-            assert(splitError == OTBR_ERROR_NONE);
+        {
+            std::string serviceName;
+            std::string prefix;
+            std::string key;
+            bool        valid;
+
+            if (aInstances.empty())
+            {
+                break;
+            }
+
+            parts = ParseFullDnsName(queryName);
+            valid = (type == OT_DNSSD_QUERY_TYPE_BROWSE) ? parts.IsService() : parts.IsServiceInstance();
+            assert(valid);
+            if (!valid)
+            {
+                break;
+            }
+
+            serviceName = parts.mServiceName.ToString();
+            prefix      = Mdns::Publisher::MakeServiceKey("", serviceName.c_str());
+            key         = parts.mInstanceName.IsEmpty()
+                      ? prefix
+                      : Mdns::Publisher::MakeServiceKey(parts.mInstanceName.ToString().c_str(), serviceName.c_str());
+            parts.CopyDomainTo(domain);
+
+            // All instances of a service type share the key prefix of the service type, see `MakeServiceKey()`.
+            for (auto it = aInstances.lower_bound(key);
+                 it != aInstances.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+            {
+                const Mdns::Publisher::DiscoveredInstanceInfo &info = it->second.mInfo;
+                std::string                                    serviceFullName;
+
+                if (!parts.mInstanceName.IsEmpty() && it->first != key)
+                {
+                    break;
+                }
+
+                serviceFullName = it->second.mType + "." + domain;
+
+                ServiceAnswer &answer = serviceAnswers[info.mName + "." + serviceFullName];
+
+                if (answer.mServiceFullName.empty())
+                {
+                    answer.mServiceFullName = std::move(serviceFullName);
+                    answer.mHostName        = TranslateDomain(info.mHostName, domain);
+                    answer.mInfo            = &info;
+                }
+            }
             break;
+        }
+        case OT_DNSSD_QUERY_TYPE_RESOLVE_HOST:
+        {
+            decltype(aHosts.begin()) it;
+
+            if (aHosts.empty())
+            {
+                break;
+            }
+
+            parts = ParseFullDnsName(queryName);
+            assert(parts.IsHost());
+            if (!parts.IsHost() || (it = aHosts.find(parts.mHostName.ToString())) == aHosts.end())
+            {
+                break;
+            }
+
+            parts.CopyDomainTo(domain);
+            hostAnswers[TranslateDomain(it->second.mHostName, domain)].mInfo = &it->second;
+            break;
+        }
         default:
-            splitError = OTBR_ERROR_NOT_FOUND;
             break;
         }
-        if (splitError != OTBR_ERROR_NONE)
+    }
+
+    // Answers are delivered after the walk, as answering may finalize and remove queries.
+    for (const auto &entry : serviceAnswers)
+    {
+        const Mdns::Publisher::DiscoveredInstanceInfo &info = *entry.second.mInfo;
+        otDnssdServiceInstanceInfo                     instanceInfo;
+
+        instanceInfo.mFullName   = entry.first.c_str();
+        instanceInfo.mHostName   = entry.second.mHostName.c_str();
+        instanceInfo.mAddressNum = info.mAddresses.size();
+        instanceInfo.mAddresses =
+            info.mAddresses.empty() ? nullptr : reinterpret_cast<const otIp6Address *>(&info.mAddresses[0]);
+        instanceInfo.mPort      = info.mPort;
+        instanceInfo.mPriority  = info.mPriority;
+        instanceInfo.mWeight    = info.mWeight;
+        instanceInfo.mTxtLength = static_cast<uint16_t>(info.mTxtData.size());
+        instanceInfo.mTxtData   = info.mTxtData.data();
+        instanceInfo.mTtl       = CapTtl(info.mTtl);
+
+        otDnssdQueryHandleDiscoveredServiceInstance(mNcp.GetInstance(), entry.second.mServiceFullName.c_str(),
+                                                    &instanceInfo);
+    }
+
+    for (const auto &entry : hostAnswers)
+    {
+        const Mdns::Publisher::DiscoveredHostInfo &info = *entry.second.mInfo;
+        otDnssdHostInfo                            hostInfo;
+
+        hostInfo.mAddressNum = info.mAddresses.size();
+        hostInfo.mAddresses =
+            info.mAddresses.empty() ? nullptr : reinterpret_cast<const otIp6Address *>(&info.mAddresses[0]);
+        hostInfo.mTtl = CapTtl(info.mTtl);
+
+        otDnssdQueryHandleDiscoveredHost(mNcp.GetInstance(), entry.first.c_str(), &hostInfo);
+    }
+}
+
+std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
+{
+    std::string  targetName;
+    DnsNameParts parts = ParseFullDnsName(aName);
+
+    VerifyOrExit(parts.IsHost() && parts.mDomain.Equals("local"), targetName = aName);
+
+    targetName.reserve(parts.mHostName.mLength + 1 + aTargetDomain.length());
+    targetName.assign(parts.mHostName.mData, parts.mHostName.mLength);
+    targetName += '.';
+    targetName += aTargetDomain;
+
+exit:
+    otbrLogDebugRateLimited("translate domain: %s => %s", aName.c_str(), targetName.c_str());
+    return targetName;
+}
+
+void DiscoveryProxy::CheckServiceNameSanity(const std::string &aType)
+{
+    size_t dotpos;
+
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(dotpos);
+
+    assert(aType.length() > 0);
+    assert(aType[aType.length() - 1] != '.');
+    dotpos = aType.find_first_of('.');
+    assert(dotpos != std::string::npos);
+    assert(dotpos == aType.find_last_of('.'));
+}
+
+void DiscoveryProxy::CheckHostnameSanity(const std::string &aHostName)
+{
+    OTBR_UNUSED_VARIABLE(aHostName);
+
+    assert(aHostName.length() > 0);
+    assert(aHostName[aHostName.length() - 1] == '.');
+}
+
+uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
+{
+    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+}
+
+void DiscoveryProxy::OnServiceNotFound(const std::string &aType, const std::string &aInstanceName)
+{
+    std::string key = Mdns::Publisher::MakeServiceKey(aInstanceName.c_str(), aType.c_str());
+
+    otbrLogInfoRateLimited("service not found: %s.%s", aInstanceName.c_str(), aType.c_str());
+
+    mInstanceCache.erase(key);
+    AddNegativeCacheEntry(key);
+}
+
+void DiscoveryProxy::OnHostNotFound(const std::string &aHostName)
+{
+    otbrLogInfoRateLimited("host not found: %s", aHostName.c_str());
+
+    mHostCache.erase(aHostName);
+    AddNegativeCacheEntry(aHostName);
+}
+
+bool DiscoveryProxy::AnswerFromCache(const DnsNameInfo &aNameInfo)
+{
+    Timepoint now      = MainloopManager::GetInstance().GetNow();
+    bool      answered = false;
+
+    if (!aNameInfo.mHostName.empty())
+    {
+        auto    it = mHostCache.find(aNameInfo.mHostName);
+        HostMap hosts;
+
+        VerifyOrExit(it != mHostCache.end());
+        VerifyOrExit(it->second.mExpireTime > now, mHostCache.erase(it));
+
+        Mdns::Publisher::DiscoveredHostInfo &hostInfo = hosts[aNameInfo.mHostName];
+
+        hostInfo      = it->second.mInfo;
+        hostInfo.mTtl = GetRemainingTtl(it->second.mExpireTime, now);
+        AnswerQueries(InstanceMap(), hosts);
+        answered = true;
+    }
+    else
+    {
+        InstanceMap instances;
+
+        // All instances of a service type share the key prefix of the service type, see `MakeServiceKey()`.
+        std::string prefix = Mdns::Publisher::MakeServiceKey("", aNameInfo.mServiceName.c_str());
+        std::string key    = MakeCacheKey(aNameInfo);
+
+        for (auto it = mInstanceCache.lower_bound(aNameInfo.mInstanceName.empty() ? prefix : key);
+             it != mInstanceCache.end() && it->first.compare(0, prefix.size(), prefix) == 0;)
         {
-            continue;
+            if (!aNameInfo.mInstanceName.empty() && it->first != key)
+            {
+                break;
+            }
+
+            if (it->second.mExpireTime <= now)
+            {
+                it = mInstanceCache.erase(it);
+                continue;
+            }
+
+            DiscoveredInstance &instance = instances[it->first];
+
+            instance.mType      = aNameInfo.mServiceName;
+            instance.mInfo      = it->second.mInfo;
+            instance.mInfo.mTtl = GetRemainingTtl(it->second.mExpireTime, now);
+            ++it;
         }
 
-        if (serviceName == aType && (instanceName.empty() || instanceName == aInstanceInfo.mName))
+        // Answering may finalize queries, which never touches the cache, but copies are used to be safe.
+        if (!instances.empty())
         {
-            std::string serviceFullName  = aType + "." + domain;
-            std::string hostName         = TranslateDomain(aInstanceInfo.mHostName, domain);
-            std::string instanceFullName = aInstanceInfo.mName + "." + serviceFullName;
+            AnswerQueries(instances, HostMap());
+            answered = true;
+        }
+    }
+
+exit:
+    return answered;
+}
 
-            instanceInfo.mFullName = instanceFullName.c_str();
-            instanceInfo.mHostName = hostName.c_str();
+bool DiscoveryProxy::IsNegativelyCached(const std::string &aKey)
+{
+    auto it     = mNegativeCache.find(aKey);
+    bool cached = false;
 
-            otDnssdQueryHandleDiscoveredServiceInstance(mNcp.GetInstance(), serviceFullName.c_str(), &instanceInfo);
-        }
+    VerifyOrExit(it != mNegativeCache.end());
+    VerifyOrExit(it->second > MainloopManager::GetInstance().GetNow(), mNegativeCache.erase(it));
+
+    cached = true;
+
+exit:
+    return cached;
+}
+
+void DiscoveryProxy::AddNegativeCacheEntry(const std::string &aKey)
+{
+    if (mNegativeCache.size() >= kMaxCacheEntries)
+    {
+        PruneCache();
     }
+
+    VerifyOrExit(mNegativeCache.count(aKey) > 0 || mNegativeCache.size() < kMaxCacheEntries);
+
+    mNegativeCache[aKey] = MainloopManager::GetInstance().GetNow() + Seconds(kNegativeCacheTtl);
+
+exit:
+    return;
 }
 
-void DiscoveryProxy::OnHostDiscovered(const std::string &                        aHostName,
-                                      const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
+void DiscoveryProxy::PruneCache(void)
 {
-    otDnssdHostInfo     hostInfo;
-    const otDnssdQuery *query = nullptr;
+    Timepoint now = MainloopManager::GetInstance().GetNow();
 
-    otbrLogInfo("host discovered: %s hostname %s addresses %zu", aHostName.c_str(), aHostInfo.mHostName.c_str(),
-                aHostInfo.mAddresses.size());
+    for (auto it = mInstanceCache.begin(); it != mInstanceCache.end();)
+    {
+        it = (it->second.mExpireTime <= now) ? mInstanceCache.erase(it) : std::next(it);
+    }
 
-    CheckHostnameSanity(aHostInfo.mHostName);
+    for (auto it = mHostCache.begin(); it != mHostCache.end();)
+    {
+        it = (it->second.mExpireTime <= now) ? mHostCache.erase(it) : std::next(it);
+    }
+
+    for (auto it = mNegativeCache.begin(); it != mNegativeCache.end();)
+    {
+        it = (it->second <= now) ? mNegativeCache.erase(it) : std::next(it);
+    }
+}
 
-    hostInfo.mAddressNum = aHostInfo.mAddresses.size();
-    if (!aHostInfo.mAddresses.empty())
+void DiscoveryProxy::ClearCache(void)
+{
+    mInstanceCache.clear();
+    mHostCache.clear();
+    mNegativeCache.clear();
+    mUnforwardedSubscriptions.clear();
+}
+
+void DiscoveryProxy::SubscribeMdns(const DnsNameInfo &aNameInfo)
+{
+    // The publisher counts the subscriptions, duplicate queries share one browse or resolve.
+    if (aNameInfo.mHostName.empty())
     {
-        hostInfo.mAddresses = reinterpret_cast<const otIp6Address *>(&aHostInfo.mAddresses[0]);
+        mMdnsPublisher.SubscribeService(aNameInfo.mServiceName, aNameInfo.mInstanceName);
     }
     else
     {
-        hostInfo.mAddresses = nullptr;
+        mMdnsPublisher.SubscribeHost(aNameInfo.mHostName);
     }
+}
 
-    hostInfo.mTtl = CapTtl(aHostInfo.mTtl);
+void DiscoveryProxy::UnsubscribeMdns(const DnsNameInfo &aNameInfo)
+{
+    if (aNameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.UnsubscribeService(aNameInfo.mServiceName, aNameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.UnsubscribeHost(aNameInfo.mHostName);
+    }
+}
 
-    while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
+void DiscoveryProxy::AddHotName(const std::string &aKey, const DnsNameInfo &aNameInfo)
+{
+    Timepoint now = MainloopManager::GetInstance().GetNow();
+    auto      it  = mHotNames.find(aKey);
+    Timepoint expireTime;
+
+    if (it != mHotNames.end())
     {
-        std::string      hostName, domain;
-        char             queryName[OT_DNS_MAX_NAME_SIZE];
-        otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
+        it->second.mLastQueryTime = now;
+        ExitNow();
+    }
+
+    VerifyOrExit(mHotNames.size() < kMaxCacheEntries);
+    mHotNames.emplace(aKey, HotName{aNameInfo, now, now, false});
+
+    // Names which are not cached yet are scheduled once they are discovered.
+    if (GetCacheExpireTime(aKey, aNameInfo, expireTime))
+    {
+        ScheduleRefresh(expireTime - Seconds(kRefreshAheadTime));
+    }
+
+exit:
+    return;
+}
+
+bool DiscoveryProxy::GetCacheExpireTime(const std::string &aKey, const DnsNameInfo &aNameInfo, Timepoint &aExpireTime)
+{
+    Timepoint now    = MainloopManager::GetInstance().GetNow();
+    bool      cached = false;
+
+    aExpireTime = Timepoint::max();
+
+    if (!aNameInfo.mHostName.empty())
+    {
+        auto it = mHostCache.find(aKey);
 
-        if (type != OT_DNSSD_QUERY_TYPE_RESOLVE_HOST)
+        if (it != mHostCache.end() && it->second.mExpireTime > now)
         {
-            continue;
+            aExpireTime = it->second.mExpireTime;
+            cached      = true;
         }
-        splitError = SplitFullHostName(queryName, hostName, domain);
-        assert(splitError == OTBR_ERROR_NONE);
-
-        if (hostName == aHostName)
+    }
+    else
+    {
+        // The key of a service type is the prefix of the keys of all its instances, and a browse is answered with
+        // all of them, so it expires with the first of them.
+        for (auto it = mInstanceCache.lower_bound(aKey);
+             it != mInstanceCache.end() && it->first.compare(0, aKey.size(), aKey) == 0; ++it)
         {
-            std::string hostFullName = TranslateDomain(aHostInfo.mHostName, domain);
-
-            otDnssdQueryHandleDiscoveredHost(mNcp.GetInstance(), hostFullName.c_str(), &hostInfo);
+            if (!aNameInfo.mInstanceName.empty() && it->first != aKey)
+            {
+                break;
+            }
+
+            if (it->second.mExpireTime > now)
+            {
+                aExpireTime = std::min(aExpireTime, it->second.mExpireTime);
+                cached      = true;
+            }
         }
     }
+
+    return cached;
 }
 
-std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
+void DiscoveryProxy::ScheduleRefresh(Timepoint aTime)
 {
-    std::string targetName;
-    std::string hostName;
-    std::string domain;
+    Timepoint    now   = MainloopManager::GetInstance().GetNow();
+    Milliseconds delay = Milliseconds(0);
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(domain == "local.", targetName = aName);
+    VerifyOrExit(aTime < mRefreshTime);
 
-    targetName = hostName + "." + aTargetDomain;
+    if (aTime > now)
+    {
+        // Rounds up, so that the names are due when the task runs.
+        delay = std::chrono::duration_cast<Milliseconds>(aTime - now) + Milliseconds(1);
+    }
+
+    mRefreshTask.Cancel();
+    mRefreshTime = aTime;
+    mRefreshTask = mNcp.PostTimerTask(delay, [this]() {
+        mRefreshTime = Timepoint::max();
+        RefreshHotNames();
+    });
 
 exit:
-    otbrLogDebug("translate domain: %s => %s", aName.c_str(), targetName.c_str());
-    return targetName;
+    return;
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const
+void DiscoveryProxy::RefreshHotNames(void)
 {
-    const otDnssdQuery *query = nullptr;
-    int                 count = 0;
+    Timepoint now         = MainloopManager::GetInstance().GetNow();
+    Timepoint nextRefresh = Timepoint::max();
 
-    while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
+    for (auto it = mHotNames.begin(); it != mHotNames.end();)
     {
-        char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
+        HotName & hotName = it->second;
+        Timepoint expireTime;
+
+        if (hotName.mRefreshing)
+        {
+            if (now < hotName.mRefreshEndTime)
+            {
+                nextRefresh = std::min(nextRefresh, hotName.mRefreshEndTime);
+                ++it;
+                continue;
+            }
+
+            UnsubscribeMdns(hotName.mNameInfo);
+            hotName.mRefreshing = false;
+        }
+
+        if (now - hotName.mLastQueryTime >= Seconds(kHotNameTime))
+        {
+            it = mHotNames.erase(it);
+            continue;
+        }
 
-        otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
+        // The answers found by the refresh update the cache, names which are not cached anymore are scheduled again
+        // once they are discovered.
+        if (GetCacheExpireTime(it->first, hotName.mNameInfo, expireTime))
+        {
+            Timepoint refreshTime = expireTime - Seconds(kRefreshAheadTime);
+
+            if (refreshTime <= now)
+            {
+                otbrLogDebugRateLimited("refresh hot name: %s %s", hotName.mNameInfo.mInstanceName.c_str(),
+                                        hotName.mNameInfo.mHostName.empty() ? hotName.mNameInfo.mServiceName.c_str()
+                                                                            : hotName.mNameInfo.mHostName.c_str());
+                SubscribeMdns(hotName.mNameInfo);
+                hotName.mRefreshing     = true;
+                hotName.mRefreshEndTime = now + Seconds(kRefreshAheadTime);
+                refreshTime             = hotName.mRefreshEndTime;
+            }
+
+            nextRefresh = std::min(nextRefresh, refreshTime);
+        }
 
-        count += (aNameInfo.mInstanceName == queryInfo.mInstanceName &&
-                  aNameInfo.mServiceName == queryInfo.mServiceName && aNameInfo.mHostName == queryInfo.mHostName);
+        ++it;
     }
 
-    return count;
+    if (nextRefresh != Timepoint::max())
+    {
+        ScheduleRefresh(nextRefresh);
+    }
 }
 
-void DiscoveryProxy::CheckServiceNameSanity(const std::string &aType)
+void DiscoveryProxy::StopRefreshing(void)
 {
-    size_t dotpos;
-
-    OTBR_UNUSED_VARIABLE(aType);
-    OTBR_UNUSED_VARIABLE(dotpos);
+    for (const auto &hotName : mHotNames)
+    {
+        if (hotName.second.mRefreshing)
+        {
+            UnsubscribeMdns(hotName.second.mNameInfo);
+        }
+    }
 
-    assert(aType.length() > 0);
-    assert(aType[aType.length() - 1] != '.');
-    dotpos = aType.find_first_of('.');
-    assert(dotpos != std::string::npos);
-    assert(dotpos == aType.find_last_of('.'));
+    mHotNames.clear();
+    mRefreshTask.Cancel();
+    mRefreshTime = Timepoint::max();
 }
 
-void DiscoveryProxy::CheckHostnameSanity(const std::string &aHostName)
+std::string DiscoveryProxy::MakeCacheKey(const DnsNameInfo &aNameInfo)
 {
-    OTBR_UNUSED_VARIABLE(aHostName);
-
-    assert(aHostName.length() > 0);
-    assert(aHostName[aHostName.length() - 1] == '.');
+    return aNameInfo.mHostName.empty()
+               ? Mdns::Publisher::MakeServiceKey(aNameInfo.mInstanceName.c_str(), aNameInfo.mServiceName.c_str())
+               : aNameInfo.mHostName;
 }
 
-uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
+uint32_t DiscoveryProxy::GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow)
 {
-    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+    // Rounds up, so that an entry which has not expired is never answered with a zero TTL.
+    return static_cast<uint32_t>((std::chrono::duration_cast<Milliseconds>(aExpireTime - aNow).count() + 999) / 1000);
 }
 
 } // namespace Dnssd
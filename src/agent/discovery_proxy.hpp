@@ -36,7 +36,10 @@
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
+#include <map>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <stdint.h>
@@ -46,6 +49,9 @@
 
 #include "agent/ncp_openthread.hpp"
 #include "common/dns_utils.hpp"
+#include "common/interned_name.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 
 namespace otbr {
@@ -54,6 +60,14 @@ namespace Dnssd {
 /**
  * This class implements the DNS-SD Discovery Proxy.
  *
+ * Discovered service instances and hosts are cached for their (capped) TTLs, so that repeated queries are answered
+ * immediately without waiting for mDNS. Names which are known not to exist are cached as well, queries of such names
+ * are not forwarded to mDNS until the negative cache entry expires. Names which have been queried recently are
+ * resolved again shortly before their cached answers expire, so that they stay in the cache while they are hot.
+ *
+ * The results discovered by mDNS during a mainloop iteration are handed to the DNS-SD server together, so that the
+ * queries are walked once per batch and each answer is built once however many queries it matches.
+ *
  */
 class DiscoveryProxy
 {
@@ -83,23 +97,99 @@ private:
     enum : uint32_t
     {
         kServiceTtlCapLimit = 10, // TTL cap limit for Discovery Proxy (in seconds).
+        kNegativeCacheTtl   = 5,  // TTL of the negative cache entries (in seconds).
+        kRefreshAheadTime   = 2,  // Time before the cached answers expire to resolve hot names again (in seconds).
+        kHotNameTime        = 30, // Time since the last query during which a name is hot (in seconds).
+        kMaxCacheEntries    = 256,
+    };
+
+    struct CachedInstance
+    {
+        Mdns::Publisher::DiscoveredInstanceInfo mInfo;
+        Timepoint                               mExpireTime;
+    };
+
+    struct CachedHost
+    {
+        Mdns::Publisher::DiscoveredHostInfo mInfo;
+        Timepoint                           mExpireTime;
+    };
+
+    struct DiscoveredInstance
+    {
+        std::string                             mType; // The service type.
+        Mdns::Publisher::DiscoveredInstanceInfo mInfo;
+    };
+
+    using InstanceMap = std::map<std::string, DiscoveredInstance>;                  // By `MakeServiceKey()`.
+    using HostMap     = std::map<std::string, Mdns::Publisher::DiscoveredHostInfo>; // By host name.
+
+    struct HotName
+    {
+        DnsNameInfo mNameInfo;
+        Timepoint   mLastQueryTime;
+        Timepoint   mRefreshEndTime; // The time to stop the mDNS subscription of the refresh.
+        bool        mRefreshing;
     };
 
     static void        OnDiscoveryProxySubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const;
     static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
     static void        CheckServiceNameSanity(const std::string &aType);
     static void        CheckHostnameSanity(const std::string &aHostName);
     void               OnServiceDiscovered(const std::string &                            aSubscription,
                                            const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
-    static uint32_t CapTtl(uint32_t aTtl);
+
+    void ScheduleAnswers(void);
+    void FlushAnswers(void);
+    void AnswerQueries(const InstanceMap &aInstances, const HostMap &aHosts);
+    void OnServiceNotFound(const std::string &aType, const std::string &aInstanceName);
+    void OnHostNotFound(const std::string &aHostName);
+    bool AnswerFromCache(const DnsNameInfo &aNameInfo);
+    bool IsNegativelyCached(const std::string &aKey);
+    void AddNegativeCacheEntry(const std::string &aKey);
+    void PruneCache(void);
+    void ClearCache(void);
+    void SubscribeMdns(const DnsNameInfo &aNameInfo);
+    void UnsubscribeMdns(const DnsNameInfo &aNameInfo);
+    void AddHotName(const std::string &aKey, const DnsNameInfo &aNameInfo);
+    bool GetCacheExpireTime(const std::string &aKey, const DnsNameInfo &aNameInfo, Timepoint &aExpireTime);
+    void ScheduleRefresh(Timepoint aTime);
+    void RefreshHotNames(void);
+    void StopRefreshing(void);
+
+    static std::string MakeCacheKey(const DnsNameInfo &aNameInfo);
+    static uint32_t    CapTtl(uint32_t aTtl);
+    static uint32_t    GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow);
 
     Ncp::ControllerOpenThread &mNcp;
     Mdns::Publisher &          mMdnsPublisher;
+
+    std::map<std::string, CachedInstance> mInstanceCache; // By `Mdns::Publisher::MakeServiceKey()`.
+    std::map<std::string, CachedHost>     mHostCache;     // By host name.
+
+    // By service key or host name, they never collide because a service key contains a NUL character.
+    std::map<std::string, Timepoint> mNegativeCache;
+
+    // The number of subscriptions of names which are negatively cached, they are not forwarded to mDNS.
+    std::unordered_map<InternedName, uint32_t, InternedNameHash> mUnforwardedSubscriptions;
+
+    // By cache key, the names which have been queried recently and the task refreshing them at `mRefreshTime`.
+    std::map<std::string, HotName> mHotNames;
+    TaskRunner::TaskHandle         mRefreshTask;
+    Timepoint                      mRefreshTime;
+
+    // The results discovered since the last batch of answers, by `mAnswerTask`, the latest result of a name wins.
+    InstanceMap            mPendingInstances;
+    HostMap                mPendingHosts;
+    TaskRunner::TaskHandle mAnswerTask;
+
+    // The name of the subscription being answered from cache and whether its query has been finalized.
+    const std::string *mAnsweringName;
+    bool               mAnsweringFinalized;
 };
 
 } // namespace Dnssd
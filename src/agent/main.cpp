@@ -28,10 +28,10 @@
 
 #include <openthread-br/config.h>
 
+#include <deque>
 #include <fstream>
-#include <mutex>
+#include <functional>
 #include <sstream>
-#include <thread>
 
 #include <errno.h>
 #include <getopt.h>
@@ -50,28 +50,33 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/startup_profiler.hpp"
+#include "common/thread_schedule.hpp"
+#include "common/time.hpp"
+#include "common/trace.hpp"
 #include "common/types.hpp"
 #if OTBR_ENABLE_REST_SERVER
 #include "rest/rest_web_server.hpp"
 using otbr::rest::RestWebServer;
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
+#include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/server/dbus_agent.hpp"
 using otbr::DBus::DBusAgent;
 #endif
-using otbr::Ncp::ControllerOpenThread;
-
 #if OTBR_ENABLE_OPENWRT
-extern void       UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd);
-extern void       UbusProcess(const fd_set &aReadFdSet);
-extern void       UbusServerRun(void);
-extern void       UbusServerInit(otbr::Ncp::ControllerOpenThread *aController, std::mutex *aNcpThreadMutex);
-static std::mutex sThreadMutex;
+#include "openwrt/ubus/otubus.hpp"
+using otbr::ubus::UbusServer;
 #endif
+using otbr::Ncp::ControllerOpenThread;
 
 static const char kSyslogIdent[]          = "otbr-agent";
 static const char kDefaultInterfaceName[] = "wpan0";
 
+// The default max size of the log file before it is rotated.
+static const size_t kDefaultLogFileSize = 1024 * 1024;
+
 enum
 {
     OTBR_OPT_BACKBONE_INTERFACE_NAME = 'B',
@@ -82,11 +87,28 @@ enum
     OTBR_OPT_VERSION                 = 'V',
     OTBR_OPT_SHORTMAX                = 128,
     OTBR_OPT_RADIO_VERSION,
+    OTBR_OPT_TIMER_SLACK,
+    OTBR_OPT_DBUS_TRACE,
+    OTBR_OPT_ASYNC_LOG,
+    OTBR_OPT_LOG_FILE,
+    OTBR_OPT_LOG_FILE_SIZE,
+    OTBR_OPT_WARM_RESET,
+    OTBR_OPT_MAINLOOP_SCHED,
+    OTBR_OPT_MAINLOOP_CPUS,
+    OTBR_OPT_HOUSEKEEPING_CPUS,
+    OTBR_OPT_HOUSEKEEPING_NICE,
 };
 
 static jmp_buf sResetJump;
 static bool    sShouldTerminate = false;
 
+// The NCP controller re-initialized on software resets instead of restarting the process, see `otPlatReset()`.
+static ControllerOpenThread *sWarmResetNcp     = nullptr;
+static bool                  sWarmResetPending = false;
+
+// The schedule of the main thread when the process started, restored before re-executing on software resets.
+static otbr::ThreadSchedule sInitialSchedule;
+
 void __gcov_flush();
 
 // Default poll timeout.
@@ -99,6 +121,18 @@ static const struct option  kOptions[]   = {
     {"verbose", no_argument, nullptr, OTBR_OPT_VERBOSE},
     {"version", no_argument, nullptr, OTBR_OPT_VERSION},
     {"radio-version", no_argument, nullptr, OTBR_OPT_RADIO_VERSION},
+    {"timer-slack", required_argument, nullptr, OTBR_OPT_TIMER_SLACK},
+    {"async-log", no_argument, nullptr, OTBR_OPT_ASYNC_LOG},
+    {"log-file", required_argument, nullptr, OTBR_OPT_LOG_FILE},
+    {"log-file-size", required_argument, nullptr, OTBR_OPT_LOG_FILE_SIZE},
+    {"warm-reset", no_argument, nullptr, OTBR_OPT_WARM_RESET},
+    {"mainloop-sched", required_argument, nullptr, OTBR_OPT_MAINLOOP_SCHED},
+    {"mainloop-cpus", required_argument, nullptr, OTBR_OPT_MAINLOOP_CPUS},
+    {"housekeeping-cpus", required_argument, nullptr, OTBR_OPT_HOUSEKEEPING_CPUS},
+    {"housekeeping-nice", required_argument, nullptr, OTBR_OPT_HOUSEKEEPING_NICE},
+#if OTBR_ENABLE_DBUS_SERVER
+    {"dbus-trace", no_argument, nullptr, OTBR_OPT_DBUS_TRACE},
+#endif
     {0, 0, 0, 0}};
 
 static void HandleSignal(int aSignal)
@@ -107,26 +141,81 @@ static void HandleSignal(int aSignal)
     signal(aSignal, SIG_DFL);
 }
 
+#if OTBR_ENABLE_TRACE
+static void HandleTraceDumpSignal(int aSignal)
+{
+    int savedErrno = errno;
+
+    OTBR_UNUSED_VARIABLE(aSignal);
+
+    // Dumping is async-signal-safe, so that the trace can be taken even if the mainloop is stuck.
+    OTBR_UNUSED_VARIABLE(otbr::TraceBuffer::DumpToFile(OTBR_TRACE_DUMP_FILE));
+    errno = savedErrno;
+}
+#endif
+
 static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 {
-    int                   error         = EXIT_SUCCESS;
-    ControllerOpenThread &ncpOpenThread = static_cast<ControllerOpenThread &>(aInstance.GetNcp());
+    int                    error           = EXIT_SUCCESS;
+    ControllerOpenThread & ncpOpenThread   = static_cast<ControllerOpenThread &>(aInstance.GetNcp());
+    otbr::MainloopManager &mainloopManager = otbr::MainloopManager::GetInstance();
+
+    // The listeners are brought up one per mainloop iteration after the Thread interface is served, see below.
+    std::deque<std::function<void(void)>> startupSteps;
 
     OT_UNUSED_VARIABLE(ncpOpenThread);
 
+#if OTBR_ENABLE_OPENWRT
+    mainloopManager.AddMainloopProcessor(&UbusServer::GetInstance(), "ubus");
+#endif
+    mainloopManager.AddMainloopProcessor(&aInstance, "agent");
+
+#if OTBR_ENABLE_REST_SERVER
+    RestWebServer *restServer = RestWebServer::GetRestWebServer(&ncpOpenThread);
+
+    startupSteps.push_back([&aInstance, &mainloopManager, restServer]() {
+        otbr::Mdns::Publisher *publisher = aInstance.GetBorderAgent().GetPublisher();
+
+        restServer->Init();
+        if (publisher != nullptr)
+        {
+            restServer->SetMdnsStatsGetter([publisher]() { return publisher->GetStats(); });
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+            restServer->SetSrpReadvertiseStatsGetter(
+                [&aInstance]() { return aInstance.GetBorderAgent().GetAdvertisingProxy().GetReadvertiseStats(); });
+#endif
+        }
+#if OTBR_ENABLE_BACKBONE_ROUTER
+        restServer->SetBackboneRouterCountersGetter(
+            [&aInstance]() { return aInstance.GetBorderAgent().GetBackboneAgent().GetCounters(); });
+#endif
+        mainloopManager.AddMainloopProcessor(restServer, "rest");
+        otbr::StartupProfiler::Get().EndPhase("rest");
+    });
+#endif
 #if OTBR_ENABLE_DBUS_SERVER
     std::unique_ptr<DBusAgent> dbusAgent = std::unique_ptr<DBusAgent>(new DBusAgent(aInterfaceName, &ncpOpenThread));
-    dbusAgent->Init();
+
+    startupSteps.push_back([&aInstance, &mainloopManager, &dbusAgent]() {
+        dbusAgent->Init();
+#if OTBR_ENABLE_BACKBONE_ROUTER
+        dbusAgent->SetBackboneRouterCountersGetter(
+            [&aInstance]() { return aInstance.GetBorderAgent().GetBackboneAgent().GetCounters(); });
 #else
-    OTBR_UNUSED_VARIABLE(aInterfaceName);
+        OTBR_UNUSED_VARIABLE(aInstance);
 #endif
-#if OTBR_ENABLE_REST_SERVER
-    RestWebServer *restServer = RestWebServer::GetRestWebServer(&ncpOpenThread);
-    restServer->Init();
+        mainloopManager.AddMainloopProcessor(dbusAgent.get(), "dbus");
+        otbr::StartupProfiler::Get().EndPhase("dbus");
+    });
+#else
+    OTBR_UNUSED_VARIABLE(aInterfaceName);
 #endif
     otbrLogInfo("Border router agent started.");
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
+#if OTBR_ENABLE_TRACE
+    signal(SIGUSR2, HandleTraceDumpSignal);
+#endif
 
     while (!sShouldTerminate)
     {
@@ -140,59 +229,74 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        aInstance.Update(mainloop);
+        mainloopManager.Update(mainloop);
 
-#if OTBR_ENABLE_DBUS_SERVER
-        dbusAgent->Update(mainloop);
-#endif
-
-#if OTBR_ENABLE_REST_SERVER
-        restServer->Update(mainloop);
-#endif
-
-#if OTBR_ENABLE_OPENWRT
-        UbusUpdateFdSet(mainloop.mReadFdSet, mainloop.mMaxFd);
-        sThreadMutex.unlock();
-#endif
+        // The remaining startup steps run right after the events already pending are handled.
+        if (!startupSteps.empty())
+        {
+            mainloop.mTimeout = {0, 0};
+        }
 
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      &mainloop.mTimeout);
+        rval = mainloopManager.Poll(mainloop);
 
         if (rval >= 0)
         {
-#if OTBR_ENABLE_OPENWRT
-            sThreadMutex.lock();
-            UbusProcess(mainloop.mReadFdSet);
-#endif
-
-#if OTBR_ENABLE_REST_SERVER
-            restServer->Process(mainloop);
-#endif
-
-            aInstance.Process(mainloop);
-
-#if OTBR_ENABLE_DBUS_SERVER
-            dbusAgent->Process(mainloop);
-#endif
+            mainloopManager.Process(mainloop);
         }
         else if (errno != EINTR)
         {
-#if OTBR_ENABLE_OPENWRT
-            sThreadMutex.lock();
-#endif
             error = OTBR_ERROR_ERRNO;
-            otbrLogErr("select() failed: %s", strerror(errno));
+            otbrLogErr("Failed to poll the mainloop: %s", strerror(errno));
             break;
         }
+
+        // Processors are not added while the mainloop manager is iterating them.
+        if (!startupSteps.empty())
+        {
+            startupSteps.front()();
+            startupSteps.pop_front();
+        }
+        else
+        {
+            otbr::StartupProfiler::Get().Finish();
+        }
     }
 
+#if OTBR_ENABLE_REST_SERVER
+    mainloopManager.RemoveMainloopProcessor(restServer);
+#endif
+#if OTBR_ENABLE_DBUS_SERVER
+    mainloopManager.RemoveMainloopProcessor(dbusAgent.get());
+#endif
+    mainloopManager.RemoveMainloopProcessor(&aInstance);
+#if OTBR_ENABLE_OPENWRT
+    mainloopManager.RemoveMainloopProcessor(&UbusServer::GetInstance());
+#endif
+
     return error;
 }
 
 static void PrintHelp(const char *aProgramName)
 {
-    fprintf(stderr, "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] RADIO_URL [RADIO_URL]\n",
+    fprintf(stderr,
+            "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] [--timer-slack SLACK_MS] RADIO_URL "
+            "[RADIO_URL]\n",
             aProgramName);
+    fprintf(stderr, "    --async-log: Write logs from a background thread, dropping verbose logs on overflow.\n");
+    fprintf(stderr, "    --log-file PATH: Write logs to a buffered file instead of syslog.\n");
+    fprintf(stderr, "    --log-file-size BYTES: Rotate the log file at this size, %zu by default, 0 to never rotate.\n",
+            kDefaultLogFileSize);
+    fprintf(stderr, "    --warm-reset: Re-initialize only the OpenThread instance on software resets.\n");
+    fprintf(stderr,
+            "    --mainloop-sched POLICY: Schedule the mainloop as fifo:PRIORITY, rr:PRIORITY or other[:NICE].\n");
+    fprintf(stderr, "    --mainloop-cpus CPUS: Run the mainloop on a CPU list, e.g. 2,3 or 2-3.\n");
+    fprintf(stderr,
+            "    --housekeeping-cpus CPUS: Run worker, logging and other threads on a CPU list, the agent CPUs by "
+            "default.\n");
+    fprintf(stderr, "    --housekeeping-nice NICE: Run worker, logging and other threads at a niceness.\n");
+#if OTBR_ENABLE_DBUS_SERVER
+    fprintf(stderr, "    --dbus-trace: Dump D-Bus messages; requires debug level %d.\n", OTBR_LOG_DEBUG);
+#endif
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
@@ -206,6 +310,23 @@ static void PrintRadioVersion(otInstance *aInstance)
     printf("%s\n", otPlatRadioGetVersionString(aInstance));
 }
 
+static bool ParseNonNegative(const char *aArg, long &aValue)
+{
+    bool  ok = false;
+    char *end;
+    long  value;
+
+    errno = 0;
+    value = strtol(aArg, &end, 10);
+
+    VerifyOrExit(end != aArg && *end == '\0' && errno == 0 && value >= 0);
+    aValue = value;
+    ok     = true;
+
+exit:
+    return ok;
+}
+
 static void OnAllocateFailed(void)
 {
     otbrLogCrit("Allocate failure, exiting...");
@@ -221,8 +342,18 @@ static int realmain(int argc, char *argv[])
     const char *              backboneInterfaceName = "";
     bool                      verbose               = false;
     bool                      printRadioVersion     = false;
+    bool                      asyncLog              = false;
+    const char *              logFile               = nullptr;
+    long                      logFileSize           = static_cast<long>(kDefaultLogFileSize);
+    bool                      warmReset             = false;
+    long                      timerSlack            = 0;
+    bool                      hasSchedule           = false;
+    otbr::ThreadSchedule      mainloopSchedule      = sInitialSchedule;
+    otbr::ThreadSchedule      housekeepingSchedule  = sInitialSchedule;
     std::vector<const char *> radioUrls;
 
+    // The startup begins now.
+    otbr::StartupProfiler::Get();
     std::set_new_handler(OnAllocateFailed);
 
     while ((opt = getopt_long(argc, argv, "B:d:hI:Vv", kOptions, nullptr)) != -1)
@@ -260,6 +391,53 @@ static int realmain(int argc, char *argv[])
             printRadioVersion = true;
             break;
 
+        case OTBR_OPT_TIMER_SLACK:
+            VerifyOrExit(ParseNonNegative(optarg, timerSlack), ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_ASYNC_LOG:
+            asyncLog = true;
+            break;
+
+        case OTBR_OPT_LOG_FILE:
+            logFile = optarg;
+            break;
+
+        case OTBR_OPT_LOG_FILE_SIZE:
+            VerifyOrExit(ParseNonNegative(optarg, logFileSize), ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_WARM_RESET:
+            warmReset = true;
+            break;
+
+        case OTBR_OPT_MAINLOOP_SCHED:
+            VerifyOrExit(otbr::ParseSchedulePolicy(optarg, mainloopSchedule) == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+            hasSchedule = true;
+            break;
+
+        case OTBR_OPT_MAINLOOP_CPUS:
+            VerifyOrExit(otbr::ParseCpuList(optarg, mainloopSchedule.mCpus) == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+            hasSchedule = true;
+            break;
+
+        case OTBR_OPT_HOUSEKEEPING_CPUS:
+            VerifyOrExit(otbr::ParseCpuList(optarg, housekeepingSchedule.mCpus) == OTBR_ERROR_NONE,
+                         ret = EXIT_FAILURE);
+            hasSchedule = true;
+            break;
+
+        case OTBR_OPT_HOUSEKEEPING_NICE:
+            VerifyOrExit(otbr::ParseNice(optarg, housekeepingSchedule.mNice) == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+            hasSchedule = true;
+            break;
+
+#if OTBR_ENABLE_DBUS_SERVER
+        case OTBR_OPT_DBUS_TRACE:
+            otbr::DBus::SetDBusMessageDumpEnabled(true);
+            break;
+#endif
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -268,11 +446,40 @@ static int realmain(int argc, char *argv[])
     }
 
     otbrLogInit(kSyslogIdent, logLevel, verbose);
+
+    // Threads inherit the schedule of the thread creating them, so the housekeeping threads reset theirs when they
+    // start. Both schedules default to the one the process started with.
+    if (hasSchedule)
+    {
+        otbr::SetHousekeepingSchedule(housekeepingSchedule);
+    }
+
+    if (logFile != nullptr && otbrLogEnableFile(logFile, static_cast<size_t>(logFileSize)) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to open log file %s: %s, logging to syslog", logFile, strerror(errno));
+    }
+
+    if (asyncLog)
+    {
+        otbrLogEnableAsync(OTBR_LOG_OVERFLOW_DROP_VERBOSE);
+    }
+
+    if (hasSchedule && otbr::ApplyThreadSchedule(mainloopSchedule) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to set the schedule of the mainloop: %s", strerror(errno));
+    }
+
     otbrLogInfo("Running %s", OTBR_PACKAGE_VERSION);
     otbrLogInfo("Thread version: %s", otbr::Ncp::ControllerOpenThread::GetThreadVersion());
     otbrLogInfo("Thread interface: %s", interfaceName);
     otbrLogInfo("Backbone interface: %s", backboneInterfaceName);
 
+    if (timerSlack > 0)
+    {
+        otbrLogInfo("Timer slack: %ld ms", timerSlack);
+        otbr::MainloopManager::GetInstance().SetTimerSlack(otbr::Milliseconds(timerSlack));
+    }
+
     for (int i = optind; i < argc; i++)
     {
         otbrLogInfo("Radio URL: %s", argv[i]);
@@ -295,27 +502,62 @@ static int realmain(int argc, char *argv[])
         }
 
 #if OTBR_ENABLE_OPENWRT
-        UbusServerInit(&ncpOpenThread, &sThreadMutex);
-        std::thread(UbusServerRun).detach();
+        UbusServer::Initialize(&ncpOpenThread);
+        UbusServer::GetInstance().InstallUbusObject();
+        otbr::StartupProfiler::Get().EndPhase("ubus");
 #endif
-        SuccessOrExit(ret = Mainloop(instance, interfaceName));
-    }
+        if (warmReset)
+        {
+            sWarmResetNcp = &ncpOpenThread;
+        }
 
-    otbrLogDeinit();
+        ret           = Mainloop(instance, interfaceName);
+        sWarmResetNcp = nullptr;
+    }
 
 exit:
+    // The worker and ND proxy threads are joined with the controller and agent instance above.
+    otbrLogDeinit();
     return ret;
 }
 
+static void WarmReset(void)
+{
+    otbr::Timepoint start = otbr::Clock::now();
+
+    sWarmResetPending = false;
+    sWarmResetNcp->Reset();
+
+    otbrLogInfo("Warm reset done in %lld ms",
+                static_cast<long long>(
+                    std::chrono::duration_cast<otbr::Milliseconds>(otbr::Clock::now() - start).count()));
+}
+
 void otPlatReset(otInstance *aInstance)
 {
     gPlatResetReason = OT_PLAT_RESET_REASON_SOFTWARE;
 
+    if (sWarmResetNcp != nullptr)
+    {
+        // The caller keeps using the OpenThread instance after this returns, so the instance is re-initialized
+        // from the mainloop. The mDNS publisher, D-Bus, Rest and ND Proxy sockets are kept.
+        if (!sWarmResetPending)
+        {
+            sWarmResetPending = true;
+            sWarmResetNcp->PostTimerTask(otbr::Milliseconds::zero(), WarmReset);
+        }
+
+        ExitNow();
+    }
+
     otInstanceFinalize(aInstance);
     otSysDeinit();
 
     longjmp(sResetJump, 1);
     assert(false);
+
+exit:
+    return;
 }
 
 int main(int argc, char *argv[])
@@ -323,11 +565,18 @@ int main(int argc, char *argv[])
     if (setjmp(sResetJump))
     {
         alarm(0);
+        // Writes the queued logs before they are lost. The threads of the agent were not stopped by the jump and may
+        // still log, so the logging backend is only flushed.
+        otbrLogFlush();
 #if OPENTHREAD_ENABLE_COVERAGE
         __gcov_flush();
 #endif
+        // The new process image keeps the schedule of this thread.
+        OTBR_UNUSED_VARIABLE(otbr::ApplyThreadSchedule(sInitialSchedule));
         execvp(argv[0], argv);
     }
 
+    OTBR_UNUSED_VARIABLE(otbr::GetThreadSchedule(sInitialSchedule));
+
     return realmain(argc, argv);
 }
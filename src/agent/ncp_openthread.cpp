@@ -48,6 +48,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/types.hpp"
 
 #if OTBR_ENABLE_LEGACY
@@ -60,12 +61,36 @@ namespace Ncp {
 static const uint16_t kThreadVersion11 = 2; ///< Thread Version 1.1
 static const uint16_t kThreadVersion12 = 3; ///< Thread Version 1.2
 
+// The radio platform API is called on the mainloop only, so the statistics need no locking.
+static ControllerOpenThread::RadioStats sRadioStats;
+
+// The counters do not trigger state changed events, so the snapshot is also refreshed periodically.
+static constexpr Milliseconds kStateSnapshotInterval = Milliseconds(5000);
+
+#ifndef OTBR_COUNTER_HISTORY_INTERVAL
+#define OTBR_COUNTER_HISTORY_INTERVAL 10000
+#endif
+
+#ifndef OTBR_COUNTER_HISTORY_SIZE
+#define OTBR_COUNTER_HISTORY_SIZE 360
+#endif
+
+static_assert(OTBR_COUNTER_HISTORY_SIZE > 0, "OTBR_COUNTER_HISTORY_SIZE must be positive");
+
+// The OpenThread POSIX platform keeps its radio, netif and settings state process-wide.
+static bool sIsConstructed = false;
+
 ControllerOpenThread::ControllerOpenThread(const char *                     aInterfaceName,
                                            const std::vector<const char *> &aRadioUrls,
                                            const char *                     aBackboneInterfaceName)
     : mInstance(nullptr)
+    , mWorkerPool(mTaskRunner)
+    , mStateSnapshotVersion(0)
+    , mCounterHistory(OTBR_COUNTER_HISTORY_SIZE)
 {
     VerifyOrDie(aRadioUrls.size() <= OT_PLATFORM_CONFIG_MAX_RADIO_URLS, "Too many Radio URLs!");
+    VerifyOrDie(!sIsConstructed, "Only one Thread interface per process is supported!");
+    sIsConstructed = true;
 
     memset(&mConfig, 0, sizeof(mConfig));
 
@@ -82,6 +107,7 @@ ControllerOpenThread::~ControllerOpenThread(void)
 {
     otInstanceFinalize(mInstance);
     otSysDeinit();
+    sIsConstructed = false;
 }
 
 otbrError ControllerOpenThread::Init(void)
@@ -133,6 +159,18 @@ otbrError ControllerOpenThread::Init(void)
 
     mThreadHelper = std::unique_ptr<otbr::agent::ThreadHelper>(new otbr::agent::ThreadHelper(mInstance, this));
 
+    mStateSnapshotTask.Cancel();
+    HandleStateSnapshotTimer();
+
+    // The counters restart from zero with the instance.
+    mCounterHistoryTask.Cancel();
+    mCounterHistory.Clear();
+
+    if (OTBR_COUNTER_HISTORY_INTERVAL > 0)
+    {
+        HandleCounterHistoryTimer();
+    }
+
 exit:
     return error;
 }
@@ -160,14 +198,45 @@ void ControllerOpenThread::HandleStateChanged(otChangedFlags aFlags)
         }
     }
 
-    for (auto &stateCallback : mThreadStateChangedCallbacks)
+    // Listeners may read the snapshot, so it is refreshed before they are notified.
+    RefreshStateSnapshot();
+
+    for (StateChangedListener &listener : mThreadStateChangedListeners)
     {
-        stateCallback(aFlags);
+        if (listener.mFlags & aFlags)
+        {
+            Timepoint start = Clock::now();
+
+            listener.mCallback(aFlags);
+            listener.mLatency.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+        }
     }
 
     mThreadHelper->StateChangedCallback(aFlags);
 }
 
+void ControllerOpenThread::RefreshStateSnapshot(void)
+{
+    std::atomic_store(&mStateSnapshot, ThreadStateSnapshot::Take(mInstance, ++mStateSnapshotVersion, GetNetworkData()));
+}
+
+void ControllerOpenThread::HandleStateSnapshotTimer(void)
+{
+    RefreshStateSnapshot();
+    mStateSnapshotTask = PostTimerTask(kStateSnapshotInterval, [this]() { HandleStateSnapshotTimer(); });
+}
+
+Milliseconds ControllerOpenThread::GetCounterHistoryInterval(void)
+{
+    return Milliseconds(OTBR_COUNTER_HISTORY_INTERVAL);
+}
+
+void ControllerOpenThread::HandleCounterHistoryTimer(void)
+{
+    mCounterHistory.TakeSample(mInstance);
+    mCounterHistoryTask = PostTimerTask(GetCounterHistoryInterval(), [this]() { HandleCounterHistoryTimer(); });
+}
+
 void ControllerOpenThread::Update(MainloopContext &aMainloop)
 {
     mTaskRunner.Update(aMainloop);
@@ -194,9 +263,9 @@ void ControllerOpenThread::Process(const MainloopContext &aMainloop)
     }
 }
 
-void ControllerOpenThread::PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask)
+TaskRunner::TaskHandle ControllerOpenThread::PostTimerTask(Milliseconds aDelay, InlineTask aTask)
 {
-    mTaskRunner.Post(std::move(aDelay), std::move(aTask));
+    return mTaskRunner.Post(std::move(aDelay), std::move(aTask));
 }
 
 void ControllerOpenThread::RegisterResetHandler(std::function<void(void)> aHandler)
@@ -204,17 +273,39 @@ void ControllerOpenThread::RegisterResetHandler(std::function<void(void)> aHandl
     mResetHandlers.emplace_back(std::move(aHandler));
 }
 
-void ControllerOpenThread::AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback)
+void ControllerOpenThread::AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback,
+                                                         otChangedFlags             aFlags,
+                                                         const char *               aName)
+{
+    mThreadStateChangedListeners.push_back({std::move(aCallback), aFlags, aName, LatencyHistogram()});
+}
+
+std::vector<MainloopManager::Latency> ControllerOpenThread::GetStateChangedLatencies(void) const
+{
+    std::vector<MainloopManager::Latency> latencies;
+
+    for (const StateChangedListener &listener : mThreadStateChangedListeners)
+    {
+        latencies.push_back({"state-changed." + listener.mName, listener.mLatency});
+    }
+
+    return latencies;
+}
+
+const ControllerOpenThread::RadioStats &ControllerOpenThread::GetRadioStats(void)
 {
-    mThreadStateChangedCallbacks.emplace_back(std::move(aCallback));
+    return sRadioStats;
 }
 
 void ControllerOpenThread::Reset(void)
 {
+    ++sRadioStats.mResets;
     gPlatResetReason = OT_PLAT_RESET_REASON_SOFTWARE;
 
     otInstanceFinalize(mInstance);
     otSysDeinit();
+    // All file descriptors of the OpenThread instance are closed and re-opened.
+    MainloopManager::GetInstance().RemoveAllFds();
     Init();
     for (auto &handler : mResetHandlers)
     {
@@ -282,5 +373,89 @@ extern "C" void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const ch
     va_end(ap);
 }
 
+#if OTBR_ENABLE_RADIO_STATS
+/*
+ * The calls between the OpenThread core and the RCP driver are redirected here with the `--wrap` option of the
+ * linker, see `OTBR_RADIO_STATS`.
+ */
+static Timepoint sTxStartTime;
+static bool      sIsTransmitting = false;
+
+extern "C" otError __real_otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame);
+extern "C" void    __real_otPlatRadioTxDone(otInstance *  aInstance,
+                                            otRadioFrame *aFrame,
+                                            otRadioFrame *aAckFrame,
+                                            otError       aError);
+extern "C" void    __real_otPlatRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError);
+
+extern "C" otError __wrap_otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    otError error;
+
+    // The start time is taken first in case the driver completes the transmission within the call.
+    sTxStartTime    = Clock::now();
+    sIsTransmitting = true;
+
+    error = __real_otPlatRadioTransmit(aInstance, aFrame);
+
+    if (error == OT_ERROR_NONE)
+    {
+        ++sRadioStats.mTxFrames;
+        sRadioStats.mTxBytes += aFrame->mLength;
+    }
+    else
+    {
+        sIsTransmitting = false;
+        ++sRadioStats.mTxErrors;
+    }
+
+    return error;
+}
+
+extern "C" void __wrap_otPlatRadioTxDone(otInstance *  aInstance,
+                                         otRadioFrame *aFrame,
+                                         otRadioFrame *aAckFrame,
+                                         otError       aError)
+{
+    if (sIsTransmitting)
+    {
+        sIsTransmitting = false;
+        sRadioStats.mTxLatency.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - sTxStartTime));
+    }
+
+    switch (aError)
+    {
+    case OT_ERROR_NONE:
+        break;
+    case OT_ERROR_NO_ACK:
+        ++sRadioStats.mTxNoAck;
+        break;
+    case OT_ERROR_CHANNEL_ACCESS_FAILURE:
+        ++sRadioStats.mTxChannelAccessFailures;
+        break;
+    default:
+        ++sRadioStats.mTxErrors;
+        break;
+    }
+
+    __real_otPlatRadioTxDone(aInstance, aFrame, aAckFrame, aError);
+}
+
+extern "C" void __wrap_otPlatRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
+{
+    if (aError == OT_ERROR_NONE && aFrame != nullptr)
+    {
+        ++sRadioStats.mRxFrames;
+        sRadioStats.mRxBytes += aFrame->mLength;
+    }
+    else
+    {
+        ++sRadioStats.mRxErrors;
+    }
+
+    __real_otPlatRadioReceiveDone(aInstance, aFrame, aError);
+}
+#endif // OTBR_ENABLE_RADIO_STATS
+
 } // namespace Ncp
 } // namespace otbr
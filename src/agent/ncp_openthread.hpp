@@ -34,18 +34,27 @@
 #ifndef OTBR_AGENT_NCP_OPENTHREAD_HPP_
 #define OTBR_AGENT_NCP_OPENTHREAD_HPP_
 
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <openthread/backbone_router_ftd.h>
 #include <openthread/cli.h>
 #include <openthread/instance.h>
 #include <openthread/openthread-system.h>
 
+#include "agent/counter_history.hpp"
+#include "agent/network_data_cache.hpp"
 #include "agent/thread_helper.hpp"
+#include "agent/thread_state_snapshot.hpp"
+#include "common/latency_histogram.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/task_runner.hpp"
 #include "common/types.hpp"
+#include "common/worker_pool.hpp"
 
 namespace otbr {
 namespace Ncp {
@@ -53,12 +62,37 @@ namespace Ncp {
 /**
  * This interface defines NCP Controller functionality.
  *
+ * Only one instance may exist in a process, because the OpenThread POSIX platform is built for a single OpenThread
+ * instance and keeps its radio, network interface and settings state process-wide. Each Thread interface is
+ * served by its own otbr-agent.
+ *
  */
 class ControllerOpenThread : public MainloopProcessor
 {
 public:
     using ThreadStateChangedCallback = std::function<void(otChangedFlags aFlags)>;
 
+    /**
+     * This structure represents the statistics of the radio link to the RCP.
+     *
+     * The frame counters and the transmit latency are only recorded when built with `OTBR_RADIO_STATS`, which
+     * intercepts the radio platform API between the OpenThread core and the RCP driver.
+     *
+     */
+    struct RadioStats
+    {
+        uint64_t         mTxFrames;                ///< The number of frames handed to the RCP for transmission.
+        uint64_t         mTxBytes;                 ///< The number of PSDU bytes handed to the RCP for transmission.
+        uint64_t         mTxNoAck;                 ///< The number of transmissions not acknowledged by the peer.
+        uint64_t         mTxChannelAccessFailures; ///< The number of transmissions failed for a busy channel.
+        uint64_t         mTxErrors;                ///< The number of transmissions failed for other reasons.
+        uint64_t         mRxFrames;                ///< The number of frames received from the RCP.
+        uint64_t         mRxBytes;                 ///< The number of PSDU bytes received from the RCP.
+        uint64_t         mRxErrors;                ///< The number of receive errors reported by the RCP.
+        uint64_t         mResets;                  ///< The number of resets of the OpenThread instance and the RCP.
+        LatencyHistogram mTxLatency;               ///< The latencies from a transmission request to its completion.
+    };
+
     /**
      * This constructor initializes this object.
      *
@@ -117,8 +151,20 @@ public:
      * @param[in]   aDelay  The delay in milliseconds before executing the task.
      * @param[in]   aTask   The task function.
      *
+     * @returns  A handle to cancel or reschedule the task.
+     *
+     */
+    TaskRunner::TaskHandle PostTimerTask(Milliseconds aDelay, InlineTask aTask);
+
+    /**
+     * This method returns the worker pool for blocking operations.
+     *
+     * The completions of the jobs are executed on the mainloop.
+     *
+     * @returns  A reference to the worker pool.
+     *
      */
-    void PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask);
+    WorkerPool &GetWorkerPool(void) { return mWorkerPool; }
 
     /**
      * This method registers a reset handler.
@@ -131,10 +177,77 @@ public:
     /**
      * This method adds a event listener for Thread state changes.
      *
+     * The callback is only called for events which contain at least one of the flags in @p aFlags, with all the
+     * flags of the event.
+     *
      * @param[in]  aCallback  The callback to receive Thread state changed events.
+     * @param[in]  aFlags     The `otChangedFlags` the listener is interested in.
+     * @param[in]  aName      The name of the listener in the state changed statistics.
+     *
+     */
+    void AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback,
+                                       otChangedFlags             aFlags,
+                                       const char *               aName);
+
+    /**
+     * This method returns the time spent by each Thread state changed listener.
+     *
+     * @returns  The latencies of the listeners, named "state-changed.<listener>".
+     *
+     */
+    std::vector<MainloopManager::Latency> GetStateChangedLatencies(void) const;
+
+    /**
+     * This method returns the statistics of the radio link to the RCP.
+     *
+     * @returns  The radio link statistics since the agent started.
+     *
+     */
+    static const RadioStats &GetRadioStats(void);
+
+    /**
+     * This method returns the latest snapshot of the Thread state.
+     *
+     * The snapshot is refreshed on the mainloop whenever the Thread state changes, and periodically for the
+     * counters. It is safe to call this method in any thread, and the returned snapshot never changes.
+     *
+     * @returns  The latest Thread state snapshot, or nullptr before the NCP is initialized.
+     *
+     */
+    std::shared_ptr<const ThreadStateSnapshot> GetStateSnapshot(void) const
+    {
+        return std::atomic_load(&mStateSnapshot);
+    }
+
+    /**
+     * This method returns the network data, parsed into its entries.
+     *
+     * The network data is only read and parsed again after its version changes, so this method is cheap to call for
+     * every request. This method must be called on the mainloop.
+     *
+     * @returns  The network data.
      *
      */
-    void AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback);
+    std::shared_ptr<const NetworkData> GetNetworkData(void) { return mNetworkDataCache.Get(mInstance); }
+
+    /**
+     * This method returns the history of the MAC, IPv6 and CCA counters.
+     *
+     * The counters are sampled every `GetCounterHistoryInterval()` on the mainloop, so this method must be called on
+     * the mainloop.
+     *
+     * @returns  The counter history.
+     *
+     */
+    const CounterHistory &GetCounterHistory(void) const { return mCounterHistory; }
+
+    /**
+     * This method returns the interval of sampling the counter history.
+     *
+     * @returns  The sampling interval, zero if the counter history is disabled.
+     *
+     */
+    static Milliseconds GetCounterHistoryInterval(void);
 
     /**
      * This method resets the OpenThread instance.
@@ -153,11 +266,22 @@ public:
     ~ControllerOpenThread(void) override;
 
 private:
+    struct StateChangedListener
+    {
+        ThreadStateChangedCallback mCallback;
+        otChangedFlags             mFlags;
+        std::string                mName;
+        LatencyHistogram           mLatency;
+    };
+
     static void HandleStateChanged(otChangedFlags aFlags, void *aContext)
     {
         static_cast<ControllerOpenThread *>(aContext)->HandleStateChanged(aFlags);
     }
     void HandleStateChanged(otChangedFlags aFlags);
+    void RefreshStateSnapshot(void);
+    void HandleStateSnapshotTimer(void);
+    void HandleCounterHistoryTimer(void);
 
     static void HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
@@ -178,7 +302,14 @@ private:
     std::unique_ptr<otbr::agent::ThreadHelper> mThreadHelper;
     std::vector<std::function<void(void)>>     mResetHandlers;
     TaskRunner                                 mTaskRunner;
-    std::vector<ThreadStateChangedCallback>    mThreadStateChangedCallbacks;
+    WorkerPool                                 mWorkerPool;
+    std::vector<StateChangedListener>          mThreadStateChangedListeners;
+    std::shared_ptr<const ThreadStateSnapshot> mStateSnapshot;
+    uint64_t                                   mStateSnapshotVersion;
+    TaskRunner::TaskHandle                     mStateSnapshotTask;
+    NetworkDataCache                           mNetworkDataCache;
+    CounterHistory                             mCounterHistory;
+    TaskRunner::TaskHandle                     mCounterHistoryTask;
 };
 
 } // namespace Ncp
@@ -0,0 +1,110 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the cache of the parsed Thread network data.
+ */
+
+#include "agent/network_data_cache.hpp"
+
+#include <openthread/thread.h>
+
+namespace otbr {
+namespace Ncp {
+
+std::shared_ptr<const NetworkData> NetworkDataCache::Get(otInstance *aInstance)
+{
+    otLeaderData leaderData;
+
+    // The network data of a detached device has no version, so it is never served from the cache.
+    if (mNetworkData == nullptr || otThreadGetLeaderData(aInstance, &leaderData) != OT_ERROR_NONE ||
+        !mNetworkData->mHasVersion || mNetworkData->mPartitionId != leaderData.mPartitionId ||
+        mNetworkData->mVersion != leaderData.mDataVersion ||
+        mNetworkData->mStableVersion != leaderData.mStableDataVersion)
+    {
+        mNetworkData = Build(aInstance);
+    }
+
+    return mNetworkData;
+}
+
+std::shared_ptr<const NetworkData> NetworkDataCache::Build(otInstance *aInstance)
+{
+    std::shared_ptr<NetworkData> networkData = std::make_shared<NetworkData>();
+    uint8_t                      data[255];
+    uint8_t                      length = sizeof(data);
+    otLeaderData                 leaderData;
+    otNetworkDataIterator        iterator;
+    otBorderRouterConfig         prefix;
+    otExternalRouteConfig        route;
+    otServiceConfig              service;
+
+    networkData->mHasVersion    = (otThreadGetLeaderData(aInstance, &leaderData) == OT_ERROR_NONE);
+    networkData->mPartitionId   = networkData->mHasVersion ? leaderData.mPartitionId : 0;
+    networkData->mVersion       = networkData->mHasVersion ? leaderData.mDataVersion : 0;
+    networkData->mStableVersion = networkData->mHasVersion ? leaderData.mStableDataVersion : 0;
+
+    if (otNetDataGet(aInstance, /* aStable */ false, data, &length) == OT_ERROR_NONE)
+    {
+        networkData->mFull.assign(data, data + length);
+    }
+
+    length = sizeof(data);
+
+    if (otNetDataGet(aInstance, /* aStable */ true, data, &length) == OT_ERROR_NONE)
+    {
+        networkData->mStable.assign(data, data + length);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+
+    while (otNetDataGetNextOnMeshPrefix(aInstance, &iterator, &prefix) == OT_ERROR_NONE)
+    {
+        networkData->mOnMeshPrefixes.push_back(prefix);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+
+    while (otNetDataGetNextRoute(aInstance, &iterator, &route) == OT_ERROR_NONE)
+    {
+        networkData->mExternalRoutes.push_back(route);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+
+    while (otNetDataGetNextService(aInstance, &iterator, &service) == OT_ERROR_NONE)
+    {
+        networkData->mServices.push_back(service);
+    }
+
+    return networkData;
+}
+
+} // namespace Ncp
+} // namespace otbr
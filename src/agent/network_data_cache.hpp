@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the cache of the parsed Thread network data.
+ */
+
+#ifndef OTBR_AGENT_NETWORK_DATA_CACHE_HPP_
+#define OTBR_AGENT_NETWORK_DATA_CACHE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <memory>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/netdata.h>
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This structure represents an immutable copy of the network data, parsed into its entries.
+ *
+ */
+struct NetworkData
+{
+    bool                               mHasVersion;     ///< Whether the versions below are valid, i.e. attached.
+    uint32_t                           mPartitionId;    ///< The partition ID the network data belongs to.
+    uint8_t                            mVersion;        ///< The version of the full network data.
+    uint8_t                            mStableVersion;  ///< The version of the stable network data.
+    std::vector<uint8_t>               mFull;           ///< The full network data.
+    std::vector<uint8_t>               mStable;         ///< The stable network data.
+    std::vector<otBorderRouterConfig>  mOnMeshPrefixes; ///< The on-mesh prefixes.
+    std::vector<otExternalRouteConfig> mExternalRoutes; ///< The external routes.
+    std::vector<otServiceConfig>       mServices;       ///< The services.
+};
+
+/**
+ * This class caches the network data, so that it is only read and parsed again after the leader changes its version.
+ *
+ * The cached network data is shared as `std::shared_ptr<const NetworkData>`, so it may be read on any thread once
+ * returned. This class itself must be used on the mainloop.
+ *
+ */
+class NetworkDataCache
+{
+public:
+    /**
+     * This method returns the current network data, which is rebuilt if its version has changed.
+     *
+     * @param[in]  aInstance  The OpenThread instance.
+     *
+     * @returns  The network data.
+     *
+     */
+    std::shared_ptr<const NetworkData> Get(otInstance *aInstance);
+
+    /**
+     * This method drops the cached network data.
+     *
+     */
+    void Clear(void) { mNetworkData.reset(); }
+
+private:
+    static std::shared_ptr<const NetworkData> Build(otInstance *aInstance);
+
+    std::shared_ptr<const NetworkData> mNetworkData;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_NETWORK_DATA_CACHE_HPP_
@@ -34,10 +34,13 @@
 #include <limits.h>
 #include <string.h>
 
+#include <algorithm>
 #include <string>
 
 #include <openthread/border_router.h>
 #include <openthread/channel_manager.h>
+#include <openthread/channel_monitor.h>
+#include <openthread/commissioner.h>
 #include <openthread/jam_detection.h>
 #include <openthread/joiner.h>
 #include <openthread/thread_ftd.h>
@@ -47,13 +50,24 @@
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "utils/joiner_info.hpp"
 
 namespace otbr {
 namespace agent {
 
+// The time the results of a scan are served to new callers.
+static constexpr Milliseconds kScanCacheTimeout = Milliseconds(10000);
+
+// The energy scan duration per channel in milliseconds when selecting the channel to attach on.
+static constexpr uint16_t kEnergyScanDuration = 30;
+
+// The channel monitor samples per channel needed to select the channel to attach on without an energy scan.
+static constexpr uint32_t kMinChannelMonitorSamples = 32;
+
 ThreadHelper::ThreadHelper(otInstance *aInstance, otbr::Ncp::ControllerOpenThread *aNcp)
     : mInstance(aInstance)
     , mNcp(aNcp)
+    , mIsScanCacheValid(false)
 {
 }
 
@@ -89,12 +103,28 @@ void ThreadHelper::AddDeviceRoleHandler(DeviceRoleHandler aHandler)
     mDeviceRoleHandlers.emplace_back(aHandler);
 }
 
+void ThreadHelper::AddScanResultHandler(ScanResultHandler aHandler)
+{
+    mScanResultHandlers.emplace_back(aHandler);
+}
+
 void ThreadHelper::Scan(ScanHandler aHandler)
 {
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aHandler != nullptr);
-    mScanHandler = aHandler;
+
+    if (mIsScanCacheValid && Clock::now() < mScanCacheExpiry)
+    {
+        otbrLogInfo("Serve scan from cache with %zu results", mScanResults.size());
+        aHandler(OT_ERROR_NONE, mScanResults);
+        ExitNow();
+    }
+
+    mScanHandlers.emplace_back(std::move(aHandler));
+    VerifyOrExit(mScanHandlers.size() == 1, otbrLogInfo("Join the scan in progress"));
+
+    mIsScanCacheValid = false;
     mScanResults.clear();
 
     error =
@@ -103,11 +133,25 @@ void ThreadHelper::Scan(ScanHandler aHandler)
 exit:
     if (error != OT_ERROR_NONE)
     {
-        if (aHandler)
+        std::vector<ScanHandler> handlers = std::move(mScanHandlers);
+
+        mScanHandlers.clear();
+        for (const auto &handler : handlers)
         {
-            mScanHandler(error, {});
+            handler(error, {});
         }
-        mScanHandler = nullptr;
+    }
+}
+
+void ThreadHelper::CancelScan(void)
+{
+    std::vector<ScanHandler> handlers = std::move(mScanHandlers);
+
+    mScanHandlers.clear();
+
+    for (const auto &handler : handlers)
+    {
+        handler(OT_ERROR_ABORT, {});
     }
 }
 
@@ -133,14 +177,26 @@ void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mScanHandler != nullptr)
+        // Handlers may start another scan, which is served from the cache.
+        std::vector<ScanHandler> handlers = std::move(mScanHandlers);
+
+        mScanHandlers.clear();
+        mIsScanCacheValid = true;
+        mScanCacheExpiry  = Clock::now() + kScanCacheTimeout;
+
+        for (const auto &handler : handlers)
         {
-            mScanHandler(OT_ERROR_NONE, mScanResults);
+            handler(OT_ERROR_NONE, mScanResults);
         }
     }
     else
     {
         mScanResults.push_back(*aResult);
+
+        for (const auto &handler : mScanResultHandlers)
+        {
+            handler(*aResult);
+        }
     }
 }
 
@@ -184,18 +240,82 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
                           ResultHandler               aHandler)
 
 {
-    otError         error = OT_ERROR_NONE;
-    otExtendedPanId extPanId;
-    otMasterKey     masterKey;
-    otPskc          pskc;
-    uint32_t        channelMask;
-    uint8_t         channel;
+    otError  error = OT_ERROR_NONE;
+    uint32_t channelMask;
 
     VerifyOrExit(aHandler != nullptr, error = OT_ERROR_INVALID_ARGS);
     VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = OT_ERROR_INVALID_STATE);
     mAttachHandler = aHandler;
+
+    SuccessOrExit(error =
+                      PrepareAttach(aNetworkName, aPanId, aExtPanId, aMasterKey, aPSKc, aChannelMask, channelMask));
+    SuccessOrExit(error = StartAttach(RandomChannelFromChannelMask(channelMask)));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        if (aHandler)
+        {
+            aHandler(error);
+        }
+        mAttachHandler = nullptr;
+    }
+}
+
+void ThreadHelper::AttachOnQuietestChannel(const std::string &         aNetworkName,
+                                           uint16_t                    aPanId,
+                                           uint64_t                    aExtPanId,
+                                           const std::vector<uint8_t> &aMasterKey,
+                                           const std::vector<uint8_t> &aPSKc,
+                                           uint32_t                    aChannelMask,
+                                           ChannelSelectionHandler     aHandler)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t channelMask;
+
+    VerifyOrExit(aHandler != nullptr, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = OT_ERROR_INVALID_STATE);
+    mChannelSelection = ChannelSelection();
+    mAttachHandler    = [this, aHandler](otError aError) { aHandler(aError, mChannelSelection); };
+
+    SuccessOrExit(error =
+                      PrepareAttach(aNetworkName, aPanId, aExtPanId, aMasterKey, aPSKc, aChannelMask, channelMask));
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    if (otChannelMonitorIsRunning(mInstance) && otChannelMonitorGetSampleCount(mInstance) >= kMinChannelMonitorSamples)
+    {
+        SelectChannelFromChannelMonitor(channelMask);
+        ExitNow(error = StartAttach(mChannelSelection.mChannel));
+    }
+#endif
+
+    error = otLinkEnergyScan(mInstance, channelMask, kEnergyScanDuration, &ThreadHelper::sEnergyScanHandler, this);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        if (aHandler)
+        {
+            aHandler(error, mChannelSelection);
+        }
+        mAttachHandler = nullptr;
+    }
+}
+
+otError ThreadHelper::PrepareAttach(const std::string &         aNetworkName,
+                                    uint16_t                    aPanId,
+                                    uint64_t                    aExtPanId,
+                                    const std::vector<uint8_t> &aMasterKey,
+                                    const std::vector<uint8_t> &aPSKc,
+                                    uint32_t                    aChannelMask,
+                                    uint32_t &                  aValidChannelMask)
+{
+    otError         error = OT_ERROR_NONE;
+    otExtendedPanId extPanId;
+    otMasterKey     masterKey;
+
     VerifyOrExit(aMasterKey.empty() || aMasterKey.size() == sizeof(masterKey.m8), error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(aPSKc.empty() || aPSKc.size() == sizeof(pskc.m8), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aPSKc.empty() || aPSKc.size() == sizeof(mAttachPskc.m8), error = OT_ERROR_INVALID_ARGS);
     VerifyOrExit(aChannelMask != 0, error = OT_ERROR_INVALID_ARGS);
 
     while (aPanId == UINT16_MAX)
@@ -228,11 +348,11 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
 
     if (!aPSKc.empty())
     {
-        memcpy(pskc.m8, &aPSKc[0], sizeof(pskc.m8));
+        memcpy(mAttachPskc.m8, &aPSKc[0], sizeof(mAttachPskc.m8));
     }
     else
     {
-        RandomFill(pskc.m8, sizeof(pskc.m8));
+        RandomFill(mAttachPskc.m8, sizeof(mAttachPskc.m8));
     }
 
     if (!otIp6IsEnabled(mInstance))
@@ -245,31 +365,108 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
     SuccessOrExit(error = otThreadSetExtendedPanId(mInstance, &extPanId));
     SuccessOrExit(error = otThreadSetMasterKey(mInstance, &masterKey));
 
-    channelMask = otPlatRadioGetPreferredChannelMask(mInstance) & aChannelMask;
+    aValidChannelMask = otPlatRadioGetPreferredChannelMask(mInstance) & aChannelMask;
 
-    if (channelMask == 0)
+    if (aValidChannelMask == 0)
     {
-        channelMask = otLinkGetSupportedChannelMask(mInstance) & aChannelMask;
+        aValidChannelMask = otLinkGetSupportedChannelMask(mInstance) & aChannelMask;
     }
-    VerifyOrExit(channelMask != 0, otbrLogWarning("Invalid channel mask"), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aValidChannelMask != 0, otbrLogWarning("Invalid channel mask"), error = OT_ERROR_INVALID_ARGS);
 
-    channel = RandomChannelFromChannelMask(channelMask);
-    SuccessOrExit(otLinkSetChannel(mInstance, channel));
+exit:
+    return error;
+}
 
-    SuccessOrExit(error = otThreadSetPskc(mInstance, &pskc));
+otError ThreadHelper::StartAttach(uint8_t aChannel)
+{
+    otError error = OT_ERROR_NONE;
+
+    otbrLogInfo("Attach on channel %u", aChannel);
 
+    SuccessOrExit(error = otLinkSetChannel(mInstance, aChannel));
+    SuccessOrExit(error = otThreadSetPskc(mInstance, &mAttachPskc));
     SuccessOrExit(error = otThreadSetEnabled(mInstance, true));
+
 exit:
-    if (error != OT_ERROR_NONE)
+    return error;
+}
+
+void ThreadHelper::sEnergyScanHandler(otEnergyScanResult *aResult, void *aThreadHelper)
+{
+    static_cast<ThreadHelper *>(aThreadHelper)->EnergyScanHandler(aResult);
+}
+
+void ThreadHelper::EnergyScanHandler(otEnergyScanResult *aResult)
+{
+    otError  error = OT_ERROR_NONE;
+    int8_t   minRssi;
+    uint32_t quietest = 0;
+
+    // The attach may have been aborted, e.g. by a reset.
+    VerifyOrExit(mAttachHandler != nullptr);
+
+    if (aResult != nullptr)
     {
-        if (aHandler)
+        mChannelSelection.mEnergies.push_back(*aResult);
+        ExitNow();
+    }
+
+    VerifyOrExit(!mChannelSelection.mEnergies.empty(), error = OT_ERROR_FAILED);
+
+    minRssi = mChannelSelection.mEnergies.front().mMaxRssi;
+    for (const otEnergyScanResult &energy : mChannelSelection.mEnergies)
+    {
+        minRssi = std::min(minRssi, energy.mMaxRssi);
+    }
+    for (const otEnergyScanResult &energy : mChannelSelection.mEnergies)
+    {
+        if (energy.mMaxRssi == minRssi)
         {
-            aHandler(error);
+            quietest |= (1U << energy.mChannel);
         }
+    }
+
+    mChannelSelection.mChannel = RandomChannelFromChannelMask(quietest);
+    otbrLogInfo("Energy scan selected channel %u with max RSSI %d dBm", mChannelSelection.mChannel, minRssi);
+    error = StartAttach(mChannelSelection.mChannel);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        mAttachHandler(error);
         mAttachHandler = nullptr;
     }
 }
 
+void ThreadHelper::SelectChannelFromChannelMonitor(uint32_t aChannelMask)
+{
+    // 8 bit per byte
+    constexpr uint8_t kNumChannels = sizeof(aChannelMask) * 8;
+    uint16_t          minOccupancy = UINT16_MAX;
+    uint32_t          quietest     = 0;
+
+    for (uint8_t channel = 0; channel < kNumChannels; channel++)
+    {
+        if (aChannelMask & (1U << channel))
+        {
+            uint16_t occupancy = otChannelMonitorGetChannelOccupancy(mInstance, channel);
+
+            mChannelSelection.mOccupancies.emplace_back(channel, occupancy);
+            minOccupancy = std::min(minOccupancy, occupancy);
+        }
+    }
+    for (const auto &occupancy : mChannelSelection.mOccupancies)
+    {
+        if (occupancy.second == minOccupancy)
+        {
+            quietest |= (1U << occupancy.first);
+        }
+    }
+
+    mChannelSelection.mChannel = RandomChannelFromChannelMask(quietest);
+    otbrLogInfo("Channel monitor selected channel %u with occupancy %u", mChannelSelection.mChannel, minOccupancy);
+}
+
 void ThreadHelper::Attach(ResultHandler aHandler)
 {
     otError error = OT_ERROR_NONE;
@@ -399,6 +596,101 @@ void ThreadHelper::LogOpenThreadResult(const char *aAction, otError aError)
     }
 }
 
+otError ThreadHelper::AddJoiners(const std::vector<std::string> &aJoinerIds,
+                                 const std::vector<std::string> &aPskds,
+                                 uint32_t                        aTimeout,
+                                 SteeringData &                  aSteeringData)
+{
+    otError                   error = OT_ERROR_NONE;
+    std::vector<otJoinerInfo> joiners(aJoinerIds.size());
+    std::vector<otJoinerInfo> existingJoiners;
+    std::vector<otJoinerInfo> addedJoiners;
+
+    VerifyOrExit(otCommissionerGetState(mInstance) == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(!aJoinerIds.empty() && aJoinerIds.size() == aPskds.size(), error = OT_ERROR_INVALID_ARGS);
+
+    for (size_t i = 0; i < aJoinerIds.size(); i++)
+    {
+        SuccessOrExit(error = Utils::ParseJoinerInfo(aJoinerIds[i], aPskds[i], joiners[i]));
+    }
+
+    GetJoiners(existingJoiners);
+
+    for (const otJoinerInfo &joiner : joiners)
+    {
+        // Adding a joiner the commissioner already has only updates it, so it must not be removed on rollback.
+        bool isNew = !Utils::ContainsJoiner(existingJoiners, joiner) && !Utils::ContainsJoiner(addedJoiners, joiner);
+
+        if (joiner.mType == OT_JOINER_INFO_TYPE_DISCERNER)
+        {
+            error = otCommissionerAddJoinerWithDiscerner(mInstance, &joiner.mSharedId.mDiscerner, joiner.mPskd.m8,
+                                                         aTimeout);
+        }
+        else
+        {
+            error = otCommissionerAddJoiner(
+                mInstance, joiner.mType == OT_JOINER_INFO_TYPE_EUI64 ? &joiner.mSharedId.mEui64 : nullptr,
+                joiner.mPskd.m8, aTimeout);
+        }
+        SuccessOrExit(error);
+
+        if (isNew)
+        {
+            addedJoiners.push_back(joiner);
+        }
+    }
+
+    GetJoiners(existingJoiners);
+    Utils::ComputeSteeringData(existingJoiners, aSteeringData);
+    otbrLogInfo("Added %zu joiners, %zu new, steering data length %u", joiners.size(), addedJoiners.size(),
+                aSteeringData.GetLength());
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        for (const otJoinerInfo &joiner : addedJoiners)
+        {
+            RemoveJoiner(joiner);
+        }
+        otbrLogWarning("Failed to add joiners: %s", otThreadErrorToString(error));
+    }
+
+    return error;
+}
+
+void ThreadHelper::RemoveJoiner(const otJoinerInfo &aJoinerInfo)
+{
+    otError error;
+
+    switch (aJoinerInfo.mType)
+    {
+    case OT_JOINER_INFO_TYPE_DISCERNER:
+        error = otCommissionerRemoveJoinerWithDiscerner(mInstance, &aJoinerInfo.mSharedId.mDiscerner);
+        break;
+    case OT_JOINER_INFO_TYPE_EUI64:
+        error = otCommissionerRemoveJoiner(mInstance, &aJoinerInfo.mSharedId.mEui64);
+        break;
+    default:
+        error = otCommissionerRemoveJoiner(mInstance, nullptr);
+        break;
+    }
+
+    LogOpenThreadResult("Remove joiner", error);
+}
+
+void ThreadHelper::GetJoiners(std::vector<otJoinerInfo> &aJoiners)
+{
+    uint16_t     iterator = 0;
+    otJoinerInfo joiner;
+
+    aJoiners.clear();
+
+    while (otCommissionerGetNextJoinerInfo(mInstance, &iterator, &joiner) == OT_ERROR_NONE)
+    {
+        aJoiners.push_back(joiner);
+    }
+}
+
 #if OTBR_ENABLE_UNSECURE_JOIN
 otError ThreadHelper::PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds)
 {
@@ -39,15 +39,21 @@
 #include <map>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <openthread/commissioner.h>
 #include <openthread/instance.h>
 #include <openthread/ip6.h>
 #include <openthread/jam_detection.h>
 #include <openthread/joiner.h>
+#include <openthread/link.h>
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
 
+#include "common/time.hpp"
+#include "utils/steering_data.hpp"
+
 namespace otbr {
 namespace Ncp {
 class ControllerOpenThread;
@@ -65,8 +71,22 @@ class ThreadHelper
 public:
     using DeviceRoleHandler = std::function<void(otDeviceRole)>;
     using ScanHandler       = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
+    using ScanResultHandler = std::function<void(const otActiveScanResult &)>;
     using ResultHandler     = std::function<void(otError)>;
 
+    /**
+     * This structure represents the data the channel of an attach was selected from.
+     *
+     */
+    struct ChannelSelection
+    {
+        uint8_t                                   mChannel;     ///< The selected channel.
+        std::vector<otEnergyScanResult>           mEnergies;    ///< The max RSSI of each channel from an energy scan.
+        std::vector<std::pair<uint8_t, uint16_t>> mOccupancies; ///< The occupancy of each channel from the monitor.
+    };
+
+    using ChannelSelectionHandler = std::function<void(otError, const ChannelSelection &)>;
+
     /**
      * The constructor of a Thread helper.
      *
@@ -95,14 +115,56 @@ public:
      */
     otError PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds);
 
+    /**
+     * This method adds a list of joiners to the commissioner.
+     *
+     * A joiner id is either `*` for any joiner, an EUI64 in hex, or a discerner as `value/length`. All the joiners
+     * are validated before any is added, and the joiners this call added are removed again if one of them fails.
+     * Joiners the commissioner already had are only updated, and are kept on failure.
+     *
+     * OpenThread still sends a MGMT_COMMISSIONER_SET for each joiner added, which cannot be batched from outside the
+     * stack. The steering data is computed once over all the joiners when they are all added.
+     *
+     * @param[in]   aJoinerIds      The joiner ids.
+     * @param[in]   aPskds          The pre-shared keys of the joiners, one for each joiner id.
+     * @param[in]   aTimeout        The timeout in seconds the joiners are kept, 0 for the commissioner default.
+     * @param[out]  aSteeringData   The steering data of all the joiners of the commissioner.
+     *
+     * @returns The error value of underlying OpenThread api calls.
+     *
+     */
+    otError AddJoiners(const std::vector<std::string> &aJoinerIds,
+                       const std::vector<std::string> &aPskds,
+                       uint32_t                        aTimeout,
+                       SteeringData &                  aSteeringData);
+
+    /**
+     * This method adds a callback for each beacon received during a Thread network scan.
+     *
+     * @param[in]   aHandler  The scan result handler.
+     *
+     */
+    void AddScanResultHandler(ScanResultHandler aHandler);
+
     /**
      * This method performs a Thread network scan.
      *
+     * Calls during a scan are served by the scan in progress, and calls shortly after a scan are served by its
+     * results without scanning again.
+     *
      * @param[in]   aHandler  The scan result handler.
      *
      */
     void Scan(ScanHandler aHandler);
 
+    /**
+     * This method drops the scan in progress, e.g. when its callers have given up on it.
+     *
+     * The handlers of the scan are called with OT_ERROR_ABORT, and the next call of `Scan()` starts a new scan.
+     *
+     */
+    void CancelScan(void);
+
     /**
      * This method attaches the device to the Thread network.
      *
@@ -125,6 +187,31 @@ public:
                 uint32_t                    aChannelMask,
                 ResultHandler               aHandler);
 
+    /**
+     * This method attaches the device to the Thread network on the quietest channel of a channel mask.
+     *
+     * The channel monitor samples are used when there are enough of them, otherwise a quick energy scan of the
+     * channel mask is performed. Of the channels equally quiet, one is selected at random.
+     *
+     * @note The joiner start and the attach proccesses are exclusive
+     *
+     * @param[in]   aNetworkName    The network name.
+     * @param[in]   aPanId          The pan id, UINT16_MAX for random.
+     * @param[in]   aExtPanId       The extended pan id, UINT64_MAX for random.
+     * @param[in]   aMasterKey      The master key, empty for random.
+     * @param[in]   aPSKc           The pre-shared commissioner key, empty for random.
+     * @param[in]   aChannelMask    A bitmask for valid channels.
+     * @param[in]   aHandler        The attach result handler, receiving the data the channel was selected from.
+     *
+     */
+    void AttachOnQuietestChannel(const std::string &         aNetworkName,
+                                 uint16_t                    aPanId,
+                                 uint64_t                    aExtPanId,
+                                 const std::vector<uint8_t> &aMasterKey,
+                                 const std::vector<uint8_t> &aPSKc,
+                                 uint32_t                    aChannelMask,
+                                 ChannelSelectionHandler     aHandler);
+
     /**
      * This method detaches the device from the Thread network.
      *
@@ -211,9 +298,25 @@ private:
     static void sActiveScanHandler(otActiveScanResult *aResult, void *aThreadHelper);
     void        ActiveScanHandler(otActiveScanResult *aResult);
 
+    otError PrepareAttach(const std::string &         aNetworkName,
+                          uint16_t                    aPanId,
+                          uint64_t                    aExtPanId,
+                          const std::vector<uint8_t> &aMasterKey,
+                          const std::vector<uint8_t> &aPSKc,
+                          uint32_t                    aChannelMask,
+                          uint32_t &                  aValidChannelMask);
+    otError StartAttach(uint8_t aChannel);
+
+    static void sEnergyScanHandler(otEnergyScanResult *aResult, void *aThreadHelper);
+    void        EnergyScanHandler(otEnergyScanResult *aResult);
+    void        SelectChannelFromChannelMonitor(uint32_t aChannelMask);
+
     static void sJoinerCallback(otError aError, void *aThreadHelper);
     void        JoinerCallback(otError aResult);
 
+    void RemoveJoiner(const otJoinerInfo &aJoinerInfo);
+    void GetJoiners(std::vector<otJoinerInfo> &aJoiners);
+
     void    RandomFill(void *aBuf, size_t size);
     uint8_t RandomChannelFromChannelMask(uint32_t aChannelMask);
 
@@ -221,15 +324,22 @@ private:
 
     otbr::Ncp::ControllerOpenThread *mNcp;
 
-    ScanHandler                     mScanHandler;
+    // The callers of the scan in progress, and the results of the last scan which are cached until
+    // `mScanCacheExpiry`.
+    std::vector<ScanHandler>        mScanHandlers;
+    std::vector<ScanResultHandler>  mScanResultHandlers;
     std::vector<otActiveScanResult> mScanResults;
+    bool                            mIsScanCacheValid;
+    Timepoint                       mScanCacheExpiry;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
 
     std::map<uint16_t, size_t> mUnsecurePortRefCounter;
 
-    ResultHandler mAttachHandler;
-    ResultHandler mJoinerHandler;
+    ResultHandler    mAttachHandler;
+    ResultHandler    mJoinerHandler;
+    otPskc           mAttachPskc;
+    ChannelSelection mChannelSelection;
 
     std::random_device mRandomDevice;
 };
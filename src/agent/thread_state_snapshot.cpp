@@ -0,0 +1,77 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Thread state snapshot.
+ */
+
+#include "agent/thread_state_snapshot.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+std::shared_ptr<const ThreadStateSnapshot> ThreadStateSnapshot::Take(otInstance *                       aInstance,
+                                                                     uint64_t                           aVersion,
+                                                                     std::shared_ptr<const NetworkData> aNetworkData)
+{
+    std::shared_ptr<ThreadStateSnapshot> snapshot    = std::make_shared<ThreadStateSnapshot>();
+    uint16_t                             maxChildren = otThreadGetMaxAllowedChildren(aInstance);
+    otNeighborInfoIterator               iterator    = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo                       neighborInfo;
+
+    snapshot->mVersion       = aVersion;
+    snapshot->mTime          = Clock::now();
+    snapshot->mRole          = otThreadGetDeviceRole(aInstance);
+    snapshot->mRloc16        = otThreadGetRloc16(aInstance);
+    snapshot->mPartitionId   = otThreadGetPartitionId(aInstance);
+    snapshot->mHasLeaderData = (otThreadGetLeaderData(aInstance, &snapshot->mLeaderData) == OT_ERROR_NONE);
+    snapshot->mMacCounters   = *otLinkGetCounters(aInstance);
+    snapshot->mIpCounters    = *otThreadGetIp6Counters(aInstance);
+    snapshot->mNetworkData   = std::move(aNetworkData);
+
+    for (uint16_t i = 0; i < maxChildren; ++i)
+    {
+        otChildInfo childInfo;
+
+        if (otThreadGetChildInfoByIndex(aInstance, i, &childInfo) == OT_ERROR_NONE)
+        {
+            snapshot->mChildTable.push_back(childInfo);
+        }
+    }
+
+    while (otThreadGetNextNeighborInfo(aInstance, &iterator, &neighborInfo) == OT_ERROR_NONE)
+    {
+        snapshot->mNeighborTable.push_back(neighborInfo);
+    }
+
+    return snapshot;
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,97 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the Thread state snapshot.
+ */
+
+#ifndef OTBR_AGENT_THREAD_STATE_SNAPSHOT_HPP_
+#define OTBR_AGENT_THREAD_STATE_SNAPSHOT_HPP_
+
+#include <openthread-br/config.h>
+
+#include <memory>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/link.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "agent/network_data_cache.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This structure represents an immutable snapshot of the commonly read Thread state.
+ *
+ * Snapshots are taken on the mainloop and shared as `std::shared_ptr<const ThreadStateSnapshot>`, so that any thread
+ * can read them without locks or round trips to the mainloop.
+ *
+ */
+struct ThreadStateSnapshot
+{
+    uint64_t                           mVersion;       ///< The version, increased by each snapshot.
+    Timepoint                          mTime;          ///< The time the snapshot was taken.
+    otDeviceRole                       mRole;          ///< The device role.
+    uint16_t                           mRloc16;        ///< The RLOC16.
+    uint32_t                           mPartitionId;   ///< The partition ID.
+    bool                               mHasLeaderData; ///< Whether `mLeaderData` is valid, i.e. the device is attached.
+    otLeaderData                       mLeaderData;    ///< The leader data.
+    std::shared_ptr<const NetworkData> mNetworkData;   ///< The network data.
+    otMacCounters                      mMacCounters;   ///< The MAC counters.
+    otIpCounters                       mIpCounters;    ///< The IPv6 counters.
+    std::vector<otChildInfo>           mChildTable;    ///< The valid entries of the child table.
+    std::vector<otNeighborInfo>        mNeighborTable; ///< The neighbor table.
+
+    /**
+     * This method takes a snapshot of the Thread state.
+     *
+     * This method must be called on the mainloop.
+     *
+     * @param[in]  aInstance     The OpenThread instance.
+     * @param[in]  aVersion      The version of the snapshot.
+     * @param[in]  aNetworkData  The current network data, which is shared rather than read again.
+     *
+     * @returns  The snapshot.
+     *
+     */
+    static std::shared_ptr<const ThreadStateSnapshot> Take(otInstance *                       aInstance,
+                                                           uint64_t                           aVersion,
+                                                           std::shared_ptr<const NetworkData> aNetworkData);
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_THREAD_STATE_SNAPSHOT_HPP_
@@ -48,6 +48,8 @@ namespace BackboneRouter {
 BackboneAgent::BackboneAgent(otbr::Ncp::ControllerOpenThread &aNcp)
     : mNcp(aNcp)
     , mBackboneRouterState(OT_BACKBONE_ROUTER_STATE_DISABLED)
+    , mPrimaryTransitions(0)
+    , mDomainPrefixChanges(0)
 #if OTBR_ENABLE_DUA_ROUTING
     , mNdProxyManager(aNcp)
 #endif
@@ -56,17 +58,42 @@ BackboneAgent::BackboneAgent(otbr::Ncp::ControllerOpenThread &aNcp)
 
 void BackboneAgent::Init(void)
 {
-    mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); },
+                                       OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE, "backbone-agent");
+    mNcp.RegisterResetHandler([this]() { HandleNcpReset(); });
+#if OTBR_ENABLE_DUA_ROUTING
+    mNdProxyManager.Init();
+#endif
+
+    EnableBackboneRouter();
+}
+
+void BackboneAgent::EnableBackboneRouter(void)
+{
     otBackboneRouterSetDomainPrefixCallback(mNcp.GetInstance(), &BackboneAgent::HandleBackboneRouterDomainPrefixEvent,
                                             this);
 #if OTBR_ENABLE_DUA_ROUTING
     otBackboneRouterSetNdProxyCallback(mNcp.GetInstance(), &BackboneAgent::HandleBackboneRouterNdProxyEvent, this);
-    mNdProxyManager.Init();
 #endif
 
     otBackboneRouterSetEnabled(mNcp.GetInstance(), /* aEnabled */ true);
 }
 
+void BackboneAgent::HandleNcpReset(void)
+{
+    // The new OpenThread instance starts as a disabled Backbone Router, the ND Proxy sockets are kept.
+    bool wasPrimary = IsPrimary();
+
+    mBackboneRouterState = OT_BACKBONE_ROUTER_STATE_DISABLED;
+
+    if (wasPrimary)
+    {
+        OnResignPrimary();
+    }
+
+    EnableBackboneRouter();
+}
+
 void BackboneAgent::HandleThreadStateChanged(otChangedFlags aFlags)
 {
     if (aFlags & OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE)
@@ -103,6 +130,8 @@ void BackboneAgent::OnBecomePrimary(void)
 {
     otbrLogNotice("BackboneAgent: Backbone Router becomes Primary!");
 
+    mPrimaryTransitions++;
+
 #if OTBR_ENABLE_DUA_ROUTING
     if (mDomainPrefix.IsValid())
     {
@@ -142,22 +171,27 @@ const char *BackboneAgent::StateToString(otBackboneRouterState aState)
     return ret;
 }
 
-void BackboneAgent::Update(MainloopContext &aMainloop)
+BackboneAgent::Counters BackboneAgent::GetCounters(void) const
 {
-    OTBR_UNUSED_VARIABLE(aMainloop);
+    Counters counters;
 
+    counters.mPrimaryTransitions  = mPrimaryTransitions;
+    counters.mDomainPrefixChanges = mDomainPrefixChanges;
 #if OTBR_ENABLE_DUA_ROUTING
-    mNdProxyManager.Update(aMainloop);
+    counters.mNdProxy = mNdProxyManager.GetCounters();
 #endif
+
+    return counters;
 }
 
-void BackboneAgent::Process(const MainloopContext &aMainloop)
+void BackboneAgent::Update(MainloopContext &aMainloop)
 {
     OTBR_UNUSED_VARIABLE(aMainloop);
+}
 
-#if OTBR_ENABLE_DUA_ROUTING
-    mNdProxyManager.Process(aMainloop);
-#endif
+void BackboneAgent::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
 }
 
 void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
@@ -170,6 +204,8 @@ void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(void *
 void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomainPrefixEvent aEvent,
                                                           const otIp6Prefix *               aDomainPrefix)
 {
+    mDomainPrefixChanges++;
+
     if (aEvent == OT_BACKBONE_ROUTER_DOMAIN_PREFIX_REMOVED)
     {
         mDomainPrefix.Clear();
@@ -184,11 +220,9 @@ void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomain
     VerifyOrExit(IsPrimary() && aEvent != OT_BACKBONE_ROUTER_DOMAIN_PREFIX_REMOVED);
 
 #if OTBR_ENABLE_DUA_ROUTING
-    mDuaRoutingManager.Disable();
-    mNdProxyManager.Disable();
-
-    mDuaRoutingManager.Enable(mDomainPrefix);
-    mNdProxyManager.Enable(mDomainPrefix);
+    // Move to the new prefix in place, so that the DUAs are routed and proxied all along.
+    mDuaRoutingManager.UpdateDomainPrefix(mDomainPrefix);
+    mNdProxyManager.UpdateDomainPrefix(mDomainPrefix);
 #endif
 
 exit:
@@ -93,10 +93,33 @@ public:
      */
     void Process(const MainloopContext &aMainloop) override;
 
+    /**
+     * This structure represents the counters of the Backbone agent.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mPrimaryTransitions;  ///< The number of times the Backbone Router became Primary.
+        uint64_t mDomainPrefixChanges; ///< The number of Domain Prefix events.
+#if OTBR_ENABLE_DUA_ROUTING
+        NdProxyManager::Counters mNdProxy; ///< The counters of the ND Proxy manager.
+#endif
+    };
+
+    /**
+     * This method returns the counters of the Backbone agent.
+     *
+     * @returns  A snapshot of the counters.
+     *
+     */
+    Counters GetCounters(void) const;
+
 private:
     void        OnBecomePrimary(void);
     void        OnResignPrimary(void);
     bool        IsPrimary(void) const { return mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_PRIMARY; }
+    void        EnableBackboneRouter(void);
+    void        HandleNcpReset(void);
     void        HandleThreadStateChanged(otChangedFlags aFlags);
     void        HandleBackboneRouterState(void);
     static void HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
@@ -116,6 +139,8 @@ private:
     otbr::Ncp::ControllerOpenThread &mNcp;
     otBackboneRouterState            mBackboneRouterState;
     Ip6Prefix                        mDomainPrefix;
+    uint64_t                         mPrimaryTransitions;
+    uint64_t                         mDomainPrefixChanges;
 #if OTBR_ENABLE_DUA_ROUTING
     NdProxyManager    mNdProxyManager;
     DuaRoutingManager mDuaRoutingManager;
@@ -52,7 +52,9 @@ namespace BackboneRouter {
  */
 enum
 {
-    kDuaRecentTime = 20, ///< Time period (in seconds) during which a DUA registration is considered 'recent' at a BBR.
+    kDuaRecentTime        = 20, ///< Time period (in seconds) during which a DUA registration is considered 'recent'
+                                ///< at a BBR.
+    kOpenThreadRouteTable = 88, ///< The routing table ("openthread") for packets from the Thread interface.
 };
 
 /**
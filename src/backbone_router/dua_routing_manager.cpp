@@ -35,7 +35,12 @@
 
 #if OTBR_ENABLE_DUA_ROUTING
 
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+
+#include "backbone_router/constants.hpp"
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
 
 namespace otbr {
 
@@ -43,55 +48,134 @@ namespace BackboneRouter {
 
 void DuaRoutingManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(!mEnabled);
     mEnabled = true;
 
     mDomainPrefix = aDomainPrefix;
 
-    AddDefaultRouteToThread();
-    AddPolicyRouteToBackbone();
+    SuccessOrExit(error = AddDefaultRouteToThread(mDomainPrefix));
+    SuccessOrExit(error = AddPolicyRouteToBackbone());
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
+}
+
+void DuaRoutingManager::UpdateDomainPrefix(const Ip6Prefix &aDomainPrefix)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    Ip6Prefix oldPrefix;
+
+    if (!mEnabled)
+    {
+        Enable(aDomainPrefix);
+        ExitNow();
+    }
+
+    VerifyOrExit(aDomainPrefix != mDomainPrefix);
+
+    // The policy rule does not depend on the prefix and is kept, only the routes are replaced.
+    SuccessOrExit(error = AddDefaultRouteToThread(aDomainPrefix));
+    SuccessOrExit(error = AddRouteToBackbone(aDomainPrefix));
+
+    oldPrefix     = mDomainPrefix;
+    mDomainPrefix = aDomainPrefix;
+
+    // Try deleting all the routes even if one of them fails.
+    error = DelDefaultRouteToThread(oldPrefix);
+
+    if (DelRouteToBackbone(oldPrefix) != OTBR_ERROR_NONE)
+    {
+        error = OTBR_ERROR_ERRNO;
+    }
+
+exit:
+    otbrLogResult(error, "DuaRoutingManager: %s %s", __FUNCTION__, aDomainPrefix.ToString().c_str());
 }
 
 void DuaRoutingManager::Disable(void)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(mEnabled);
     mEnabled = false;
 
-    DelDefaultRouteToThread();
-    DelPolicyRouteToBackbone();
+    // Try deleting all the routes even if one of them fails.
+    error = DelDefaultRouteToThread(mDomainPrefix);
+
+    if (DelPolicyRouteToBackbone() != OTBR_ERROR_NONE)
+    {
+        error = OTBR_ERROR_ERRNO;
+    }
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
-void DuaRoutingManager::AddDefaultRouteToThread(void)
+otbrError DuaRoutingManager::AddDefaultRouteToThread(const Ip6Prefix &aDomainPrefix)
 {
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                InstanceParams::Get().GetThreadIfName());
+    otbrError error = mNetlink.AddRoute(aDomainPrefix, if_nametoindex(InstanceParams::Get().GetThreadIfName()),
+                                        RT_TABLE_MAIN, kDefaultRouteMetric);
+
+    otbrLogResult(error, "DuaRoutingManager: add route %s dev %s metric %d", aDomainPrefix.ToString().c_str(),
+                  InstanceParams::Get().GetThreadIfName(), kDefaultRouteMetric);
+
+    return error;
 }
 
-void DuaRoutingManager::DelDefaultRouteToThread(void)
+otbrError DuaRoutingManager::DelDefaultRouteToThread(const Ip6Prefix &aDomainPrefix)
 {
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                InstanceParams::Get().GetThreadIfName());
+    otbrError error = mNetlink.DelRoute(aDomainPrefix, if_nametoindex(InstanceParams::Get().GetThreadIfName()),
+                                        RT_TABLE_MAIN, kDefaultRouteMetric);
+
+    otbrLogResult(error, "DuaRoutingManager: delete route %s dev %s metric %d", aDomainPrefix.ToString().c_str(),
+                  InstanceParams::Get().GetThreadIfName(), kDefaultRouteMetric);
+
+    return error;
 }
 
-void DuaRoutingManager::AddPolicyRouteToBackbone(void)
+otbrError DuaRoutingManager::AddPolicyRouteToBackbone(void)
 {
+    otbrError error;
+
     // Packets from Thread interface use route table "openthread"
-    SystemUtils::ExecuteCommand("ip -6 rule add iif %s table openthread", InstanceParams::Get().GetThreadIfName());
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName());
+    SuccessOrExit(error = mNetlink.AddRule(InstanceParams::Get().GetThreadIfName(), kOpenThreadRouteTable));
+    SuccessOrExit(error = AddRouteToBackbone(mDomainPrefix));
+
+exit:
+    otbrLogResult(error, "DuaRoutingManager: add policy route %s dev %s for iif %s", mDomainPrefix.ToString().c_str(),
+                  InstanceParams::Get().GetBackboneIfName(), InstanceParams::Get().GetThreadIfName());
+
+    return error;
+}
+
+otbrError DuaRoutingManager::DelPolicyRouteToBackbone(void)
+{
+    otbrError error = mNetlink.DelRule(InstanceParams::Get().GetThreadIfName(), kOpenThreadRouteTable);
+
+    if (DelRouteToBackbone(mDomainPrefix) != OTBR_ERROR_NONE)
+    {
+        error = OTBR_ERROR_ERRNO;
+    }
+
+    otbrLogResult(error, "DuaRoutingManager: delete policy route %s dev %s for iif %s",
+                  mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName(),
+                  InstanceParams::Get().GetThreadIfName());
+
+    return error;
+}
+
+otbrError DuaRoutingManager::AddRouteToBackbone(const Ip6Prefix &aDomainPrefix)
+{
+    return mNetlink.AddRoute(aDomainPrefix, if_nametoindex(InstanceParams::Get().GetBackboneIfName()),
+                             kOpenThreadRouteTable, /* aMetric */ 0);
 }
 
-void DuaRoutingManager::DelPolicyRouteToBackbone(void)
+otbrError DuaRoutingManager::DelRouteToBackbone(const Ip6Prefix &aDomainPrefix)
 {
-    SystemUtils::ExecuteCommand("ip -6 rule del iif %s table openthread", InstanceParams::Get().GetThreadIfName());
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName());
+    return mNetlink.DelRoute(aDomainPrefix, if_nametoindex(InstanceParams::Get().GetBackboneIfName()),
+                             kOpenThreadRouteTable, /* aMetric */ 0);
 }
 
 } // namespace BackboneRouter
@@ -37,11 +37,11 @@
 #if OTBR_ENABLE_DUA_ROUTING
 
 #include <set>
+#include <string>
 #include <openthread/backbone_router_ftd.h>
 
 #include "agent/instance_params.hpp"
-#include "agent/ncp_openthread.hpp"
-#include "utils/system_utils.hpp"
+#include "backbone_router/netlink_route.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -66,7 +66,7 @@ public:
      * This constructor initializes a DUA routing manager instance.
      *
      */
-    explicit DuaRoutingManager()
+    DuaRoutingManager(void)
         : mEnabled(false)
     {
     }
@@ -83,14 +83,33 @@ public:
      */
     void Disable(void);
 
-private:
-    void AddDefaultRouteToThread(void);
-    void DelDefaultRouteToThread(void);
-    void AddPolicyRouteToBackbone(void);
-    void DelPolicyRouteToBackbone(void);
+    /**
+     * This method moves the DUA routes to a new Domain Prefix.
+     *
+     * The routes of the new prefix are added before the ones of the old prefix are deleted, so that
+     * DUAs are routed all along. The DUA routing manager is enabled if it is not yet.
+     *
+     * @param[in] aDomainPrefix  The new Domain Prefix.
+     *
+     */
+    void UpdateDomainPrefix(const Ip6Prefix &aDomainPrefix);
 
-    Ip6Prefix mDomainPrefix;
-    bool      mEnabled : 1;
+private:
+    enum
+    {
+        kDefaultRouteMetric = 1, ///< The metric of the Domain Prefix route to the Thread interface.
+    };
+
+    otbrError AddDefaultRouteToThread(const Ip6Prefix &aDomainPrefix);
+    otbrError DelDefaultRouteToThread(const Ip6Prefix &aDomainPrefix);
+    otbrError AddPolicyRouteToBackbone(void);
+    otbrError DelPolicyRouteToBackbone(void);
+    otbrError AddRouteToBackbone(const Ip6Prefix &aDomainPrefix);
+    otbrError DelRouteToBackbone(const Ip6Prefix &aDomainPrefix);
+
+    NetlinkRouteSocket mNetlink;
+    Ip6Prefix          mDomainPrefix;
+    bool               mEnabled : 1;
 };
 
 /**
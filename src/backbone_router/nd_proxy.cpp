@@ -39,14 +39,19 @@
 
 #include <openthread/backbone_router_ftd.h>
 
+#include <algorithm>
 #include <assert.h>
+#include <errno.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
+#include <poll.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 
 #if __linux__
+#include <linux/filter.h>
 #include <linux/netfilter.h>
 #else
 #error "Platform not supported"
@@ -56,9 +61,33 @@
 #include "backbone_router/constants.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/thread_schedule.hpp"
+#include "common/trace.hpp"
 #include "common/types.hpp"
+#include "utils/socket_utils.hpp"
 #include "utils/system_utils.hpp"
 
+#ifndef OTBR_ND_PROXY_RX_BUDGET
+#define OTBR_ND_PROXY_RX_BUDGET 64
+#endif
+
+#ifndef OTBR_ND_PROXY_RCVBUF_SIZE
+#define OTBR_ND_PROXY_RCVBUF_SIZE 0
+#endif
+
+#ifndef OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES
+#define OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES 1
+#endif
+
+#ifndef OTBR_ENABLE_ND_PROXY_NFQUEUE_THREAD
+#define OTBR_ENABLE_ND_PROXY_NFQUEUE_THREAD 0
+#endif
+
+#ifndef OTBR_ND_PROXY_UNSOLICITED_NA_RATE
+#define OTBR_ND_PROXY_UNSOLICITED_NA_RATE 0
+#endif
+
 namespace otbr {
 namespace BackboneRouter {
 
@@ -75,12 +104,19 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
     SuccessOrExit(error = UpdateMacAddress());
     SuccessOrExit(error = InitNetfilterQueue());
 
+    // Refresh the neighbor caches on the backbone link after a takeover instead of relying on NUD of the hosts.
+    if (OTBR_ND_PROXY_UNSOLICITED_NA_RATE > 0)
+    {
+        for (const Ip6Address &dua : mNdProxySet)
+        {
+            AnnounceNdProxy(dua);
+        }
+    }
+
     // Add ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    UpdateIp6tablesRule("-A", mDomainPrefix, [this](otbrError aError, const std::string &aDomainPrefix) {
+        HandleIp6tablesRuleAdded(aError, aDomainPrefix);
+    });
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -102,92 +138,244 @@ void NdProxyManager::Disable(void)
     FiniIcmp6RawSocket();
 
     // Remove ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    UpdateIp6tablesRule("-D", mDomainPrefix, nullptr);
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
+void NdProxyManager::UpdateDomainPrefix(const Ip6Prefix &aDomainPrefix)
+{
+    Ip6Prefix oldPrefix = mDomainPrefix;
+
+    if (!IsEnabled())
+    {
+        Enable(aDomainPrefix);
+        ExitNow();
+    }
+
+    assert(aDomainPrefix.IsValid());
+    VerifyOrExit(aDomainPrefix != mDomainPrefix);
+
+    mDomainPrefix = aDomainPrefix;
+
+    // The sockets, the NFQUEUE bindings and the proxied DUAs are kept, only the ip6tables rule is swapped.
+    // The rules are updated in order on the worker, so the new rule is in place before the old one goes.
+    UpdateIp6tablesRule("-A", mDomainPrefix, [this](otbrError aError, const std::string &aDomainPrefix) {
+        HandleIp6tablesRuleAdded(aError, aDomainPrefix);
+    });
+    UpdateIp6tablesRule("-D", oldPrefix, nullptr);
+
+    otbrLogInfo("NdProxyManager: Domain Prefix changed from %s to %s", oldPrefix.ToString().c_str(),
+                mDomainPrefix.ToString().c_str());
+
+exit:
+    return;
+}
+
+void NdProxyManager::HandleIp6tablesRuleAdded(otbrError aError, const std::string &aDomainPrefix)
+{
+    // Only tear down if the failed rule is still the one in use.
+    if (aError != OTBR_ERROR_NONE && IsEnabled() && mDomainPrefix.ToString() == aDomainPrefix)
+    {
+        FiniNetfilterQueue();
+        FiniIcmp6RawSocket();
+    }
+}
+
+void NdProxyManager::UpdateIp6tablesRule(const char *         aAction,
+                                         const Ip6Prefix &    aDomainPrefix,
+                                         Ip6tablesRuleHandler aHandler)
+{
+    otbrError   error;
+    std::string domainPrefix = aDomainPrefix.ToString();
+    const char *queueOption  = "--queue-num";
+    std::string queues       = std::to_string(kNfQueueNum);
+
+    // Spread the unicast NS over several queues by flow, the packets of a flow always go to the same queue.
+    if (OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES > 1)
+    {
+        queueOption = "--queue-balance";
+        queues += ":" + std::to_string(kNfQueueNum + OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES - 1);
+    }
+
+    // Running `ip6tables` takes long, so it's done on a worker thread. The serial key makes sure
+    // that adding and removing the rule are executed in order. The packets bypass the queues while
+    // no user space program is listening.
+    error = mNcp.GetWorkerPool().Post<int>(
+        [aAction, domainPrefix, queueOption, queues]() {
+            const char *argv[] = {"ip6tables",
+                                  "-t",
+                                  "raw",
+                                  aAction,
+                                  "PREROUTING",
+                                  "-6",
+                                  "-d",
+                                  domainPrefix.c_str(),
+                                  "-p",
+                                  "icmpv6",
+                                  "--icmpv6-type",
+                                  "neighbor-solicitation",
+                                  "-i",
+                                  InstanceParams::Get().GetBackboneIfName(),
+                                  "-j",
+                                  "NFQUEUE",
+                                  queueOption,
+                                  queues.c_str(),
+                                  "--queue-bypass",
+                                  nullptr};
+
+            return SystemUtils::ExecuteCommand(argv);
+        },
+        [aAction, aHandler, domainPrefix](int aExitCode) {
+            otbrError error = (aExitCode == 0) ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO;
+
+            otbrLogResult(error, "NdProxyManager: ip6tables %s %s", aAction, domainPrefix.c_str());
+
+            if (aHandler != nullptr)
+            {
+                aHandler(error, domainPrefix);
+            }
+        },
+        this);
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("NdProxyManager: failed to post ip6tables %s %s: %s", aAction, domainPrefix.c_str(),
+                       otbrErrorString(error));
+
+        if (aHandler != nullptr)
+        {
+            aHandler(error, domainPrefix);
+        }
+    }
+}
+
 void NdProxyManager::Init(void)
 {
     mBackboneIfIndex = if_nametoindex(InstanceParams::Get().GetBackboneIfName());
     VerifyOrDie(mBackboneIfIndex > 0, "if_nametoindex failed");
 }
 
-void NdProxyManager::Update(MainloopContext &aMainloop)
+void NdProxyManager::ProcessMulticastNeighborSolicition(void)
 {
-    if (mIcmp6RawSock >= 0)
+    struct mmsghdr msgs[kNsBatchSize];
+    struct iovec   iovecs[kNsBatchSize];
+    sockaddr_in6   srcs[kNsBatchSize];
+    unsigned char  cbufs[kNsBatchSize][kNsControlSize];
+    uint8_t        packets[kNsBatchSize][kMaxICMP6PacketSize];
+    otbrError      error     = OTBR_ERROR_NONE;
+    uint32_t       processed = 0;
+    uint32_t       dropped   = 0;
+
+    // Drain the socket in batches so that a burst of NS does not overflow the socket queue,
+    // but stop after the budget to give other file descriptors a chance.
+    while (processed < OTBR_ND_PROXY_RX_BUDGET)
     {
-        FD_SET(mIcmp6RawSock, &aMainloop.mReadFdSet);
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mIcmp6RawSock);
+        unsigned int batchSize = std::min<unsigned int>(kNsBatchSize, OTBR_ND_PROXY_RX_BUDGET - processed);
+        int          count;
+
+        for (unsigned int i = 0; i < batchSize; i++)
+        {
+            iovecs[i].iov_base = packets[i];
+            iovecs[i].iov_len  = sizeof(packets[i]);
+
+            msgs[i].msg_hdr.msg_name       = &srcs[i];
+            msgs[i].msg_hdr.msg_namelen    = sizeof(srcs[i]);
+            msgs[i].msg_hdr.msg_iov        = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen     = 1;
+            msgs[i].msg_hdr.msg_control    = cbufs[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(cbufs[i]);
+            msgs[i].msg_hdr.msg_flags      = 0;
+            msgs[i].msg_len                = 0;
+        }
+
+        count = recvmmsg(mIcmp6RawSock, msgs, batchSize, MSG_DONTWAIT, nullptr);
+
+        if (count < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, error = OTBR_ERROR_ERRNO);
+            break;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            dropped += UpdateRxQueueOverflows(msgs[i].msg_hdr);
+            HandleMulticastNeighborSolicit(packets[i], msgs[i].msg_len, msgs[i].msg_hdr);
+        }
+
+        processed += static_cast<uint32_t>(count);
+
+        if (static_cast<unsigned int>(count) < batchSize)
+        {
+            break;
+        }
     }
 
-    if (mUnicastNsQueueSock >= 0)
+exit:
+    FlushNeighborAdvertisements();
+
+    if (processed > 0)
     {
-        FD_SET(mUnicastNsQueueSock, &aMainloop.mReadFdSet);
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mUnicastNsQueueSock);
+        mCounters.mMulticastNsBatches++;
+        mCounters.mMulticastNsReceived += processed;
+        mCounters.mMulticastNsDropped += dropped;
+
+        otbrLogDebug("NdProxyManager: processed %u multicast NS, %u dropped by kernel", processed, dropped);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        mCounters.mSocketErrors++;
+        otbrLogWarningRateLimited("NdProxyManager: %s: %s", __FUNCTION__, otbrErrorString(error));
     }
 }
 
-void NdProxyManager::Process(const MainloopContext &aMainloop)
+uint32_t NdProxyManager::UpdateRxQueueOverflows(struct msghdr &aMsg)
 {
-    VerifyOrExit(IsEnabled());
+    uint32_t dropped = 0;
 
-    if (FD_ISSET(mIcmp6RawSock, &aMainloop.mReadFdSet))
+    for (struct cmsghdr *cmsghdr = CMSG_FIRSTHDR(&aMsg); cmsghdr; cmsghdr = CMSG_NXTHDR(&aMsg, cmsghdr))
     {
-        ProcessMulticastNeighborSolicition();
-    }
+        if (cmsghdr->cmsg_level == SOL_SOCKET && cmsghdr->cmsg_type == SO_RXQ_OVFL &&
+            cmsghdr->cmsg_len == CMSG_LEN(sizeof(uint32_t)))
+        {
+            uint32_t overflows;
 
-    if (FD_ISSET(mUnicastNsQueueSock, &aMainloop.mReadFdSet))
-    {
-        ProcessUnicastNeighborSolicition();
+            memcpy(&overflows, CMSG_DATA(cmsghdr), sizeof(overflows));
+
+            // The kernel reports the total number of packets dropped on this socket so far.
+            dropped           = overflows - mRxQueueOverflows;
+            mRxQueueOverflows = overflows;
+            break;
+        }
     }
-exit:
-    return;
+
+    return dropped;
 }
 
-void NdProxyManager::ProcessMulticastNeighborSolicition()
+void NdProxyManager::HandleMulticastNeighborSolicit(uint8_t *aPacket, size_t aLength, struct msghdr &aMsg)
 {
-    struct msghdr     msghdr;
-    sockaddr_in6      sin6;
-    struct iovec      iovec;
-    ssize_t           len;
     struct icmp6_hdr *icmp6header;
     struct cmsghdr *  cmsghdr;
-    unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
-    uint8_t           packet[kMaxICMP6PacketSize];
     otbrError         error = OTBR_ERROR_NONE;
     bool              found = false;
 
-    iovec.iov_len  = kMaxICMP6PacketSize;
-    iovec.iov_base = packet;
-
-    msghdr.msg_name       = &sin6;
-    msghdr.msg_namelen    = sizeof(sin6);
-    msghdr.msg_iov        = &iovec;
-    msghdr.msg_iovlen     = 1;
-    msghdr.msg_control    = cbuf;
-    msghdr.msg_controllen = sizeof(cbuf);
-
-    len = recvmsg(mIcmp6RawSock, &msghdr, 0);
-
-    VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+    otbrProbe(nd__ns__receive, 0);
+    VerifyOrExit(aLength >= sizeof(struct nd_neighbor_solicit), error = OTBR_ERROR_PARSE);
 
     {
-        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&static_cast<sockaddr_in6 *>(aMsg.msg_name)->sin6_addr);
+        char        srcString[Ip6Address::kStringSize];
 
-        icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
+        icmp6header = reinterpret_cast<icmp6_hdr *>(aPacket);
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
 
-        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+        otbrLogDebugRateLimited("NdProxyManager: Received ND-NS from %s", src.ToString(srcString));
 
-        for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
+        for (cmsghdr = CMSG_FIRSTHDR(&aMsg); cmsghdr; cmsghdr = CMSG_NXTHDR(&aMsg, cmsghdr))
         {
             if (cmsghdr->cmsg_level != IPPROTO_IPV6)
             {
@@ -202,18 +390,12 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                     struct in6_pktinfo *pktinfo = (struct in6_pktinfo *)CMSG_DATA(cmsghdr);
                     Ip6Address &        dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
                     uint32_t            ifindex = pktinfo->ipi6_ifindex;
+                    char                dstString[Ip6Address::kStringSize];
+
+                    found = (mSolicitedNodeGroups.find(dst) != mSolicitedNodeGroups.end());
 
-                    for (const Ip6Address &ipaddr : mNdProxySet)
-                    {
-                        if (ipaddr.ToSolicitedNodeMulticastAddress() == dst)
-                        {
-                            found = true;
-                            break;
-                        }
-                    }
-
-                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
-                                 found ? "Y" : "N");
+                    otbrLogDebugRateLimited("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString(dstString),
+                                            ifindex, found ? "Y" : "N");
                 }
                 break;
 
@@ -222,7 +404,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                 {
                     int hops = *(int *)CMSG_DATA(cmsghdr);
 
-                    otbrLogDebug("NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
+                    otbrLogDebugRateLimited("NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
 
                     VerifyOrExit(hops == 255);
                 }
@@ -233,18 +415,22 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
         VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
 
         {
-            struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
+            struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(aPacket);
             Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
+            char                        targetString[Ip6Address::kStringSize];
 
-            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
-                        target.ToString().c_str());
+            otbrLogDebugRateLimited("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s",
+                                    src.ToString(srcString), target.ToString(targetString));
 
+            mCounters.mNsMatched++;
             SendNeighborAdvertisement(target, src);
         }
     }
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    otbrTrace(TraceEvent::kNdProxyMulticastNs, static_cast<uint32_t>(error));
+    // This runs for every NS on the backbone link, most of which are not for us.
+    otbrLogDebugRateLimited("NdProxyManager: %s: %s", __FUNCTION__, otbrErrorString(error));
 }
 
 void NdProxyManager::ProcessUnicastNeighborSolicition(void)
@@ -253,13 +439,87 @@ void NdProxyManager::ProcessUnicastNeighborSolicition(void)
     char      packet[kMaxICMP6PacketSize];
     ssize_t   len;
 
-    VerifyOrExit((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), 0)) >= 0, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    // Verdicts of accepted packets are collected while draining the socket and issued
+    // with a single batch verdict per queue afterwards.
+    for (uint32_t i = 0; i < OTBR_ND_PROXY_RX_BUDGET; i++)
+    {
+        if ((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), MSG_DONTWAIT)) < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, error = OTBR_ERROR_ERRNO);
+            break;
+        }
 
-    error = OTBR_ERROR_NONE;
+        mUnicastNsCounters.mReceived++;
+        VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, static_cast<int>(len)) == 0, error = OTBR_ERROR_ERRNO);
+    }
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    FlushNetfilterQueueVerdicts();
+#if !OTBR_ENABLE_ND_PROXY_NFQUEUE_THREAD
+    FlushNeighborAdvertisements();
+#endif
+    if (error != OTBR_ERROR_NONE)
+    {
+        mUnicastNsCounters.mErrors++;
+        otbrLogWarningRateLimited("NdProxyManager: %s: %s", __FUNCTION__, otbrErrorString(error));
+    }
+}
+
+void NdProxyManager::FlushNetfilterQueueVerdicts(void)
+{
+    for (NfQueue &queue : mNfQueues)
+    {
+        if (queue.mHasPendingAccept)
+        {
+            if (nfq_set_verdict_batch(queue.mHandle, queue.mPendingAcceptId, NF_ACCEPT) < 0)
+            {
+                mUnicastNsCounters.mErrors++;
+                otbrLogWarning("NdProxyManager: failed to accept packets up to id %u: %s", queue.mPendingAcceptId,
+                               strerror(errno));
+            }
+
+            queue.mHasPendingAccept = false;
+        }
+    }
+}
+
+void NdProxyManager::RunNetfilterQueue(void)
+{
+    struct pollfd fds[2];
+
+    if (ApplyHousekeepingSchedule() != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("NdProxyManager: failed to set the schedule of the queue thread: %s", strerror(errno));
+    }
+
+    fds[0].fd     = mUnicastNsQueueSock;
+    fds[0].events = POLLIN;
+    fds[1].fd     = mNfqStopEvent;
+    fds[1].events = POLLIN;
+
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            otbrLogErr("NdProxyManager: NFQUEUE thread failed to poll: %s", strerror(errno));
+            break;
+        }
+
+        if (fds[1].revents != 0)
+        {
+            break;
+        }
+
+        if (fds[0].revents != 0)
+        {
+            ProcessUnicastNeighborSolicition();
+        }
+    }
 }
 
 void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
@@ -272,78 +532,235 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
         target = Ip6Address(aDua->mFields.m8);
     }
 
+    std::unique_lock<std::mutex> lock(mNdProxySetMutex);
+
     switch (aEvent)
     {
     case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
     case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
-    {
-        bool isNewInsert = mNdProxySet.insert(target).second;
-
-        if (isNewInsert)
+        if (aEvent == OT_BACKBONE_ROUTER_NDPROXY_ADDED)
         {
-            JoinSolicitedNodeMulticastGroup(target);
+            mCounters.mDuaAdded++;
         }
-
-        SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        else
+        {
+            mCounters.mDuaRenewed++;
+        }
+        AddNdProxy(target);
+        lock.unlock();
+        AnnounceNdProxy(target);
         break;
-    }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
+        mCounters.mDuaRemoved++;
+        RemoveNdProxy(target);
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
-        for (const Ip6Address &proxingTarget : mNdProxySet)
+        mCounters.mDuaRemoved += mNdProxySet.size();
+        for (auto &group : mSolicitedNodeGroups)
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            LeaveSolicitedNodeMulticastGroup(group.first, group.second);
         }
+        mSolicitedNodeGroups.clear();
         mNdProxySet.clear();
+        ScheduleNsFilterUpdate();
         break;
     }
 }
 
+void NdProxyManager::AddNdProxy(const Ip6Address &aTarget)
+{
+    Ip6Address          groupAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    SolicitedNodeGroup *group;
+
+    VerifyOrExit(mNdProxySet.insert(aTarget).second);
+
+    group = &mSolicitedNodeGroups.emplace(groupAddress, SolicitedNodeGroup{0, -1}).first->second;
+
+    // Several DUAs may share a solicited-node group, only join it for the first one.
+    if (group->mNumDuas++ == 0)
+    {
+        JoinSolicitedNodeMulticastGroup(groupAddress, *group);
+        ScheduleNsFilterUpdate();
+    }
+
+exit:
+    return;
+}
+
+void NdProxyManager::RemoveNdProxy(const Ip6Address &aTarget)
+{
+    SolicitedNodeGroupMap::iterator group;
+
+    VerifyOrExit(mNdProxySet.erase(aTarget) != 0);
+
+    group = mSolicitedNodeGroups.find(aTarget.ToSolicitedNodeMulticastAddress());
+    assert(group != mSolicitedNodeGroups.end());
+
+    // Only leave the solicited-node group once no proxied DUA is left in it.
+    if (--group->second.mNumDuas == 0)
+    {
+        LeaveSolicitedNodeMulticastGroup(group->first, group->second);
+        mSolicitedNodeGroups.erase(group);
+        ScheduleNsFilterUpdate();
+    }
+
+exit:
+    return;
+}
+
 void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
 {
-    uint8_t                    packet[kMaxICMP6PacketSize];
-    uint16_t                   len = 0;
-    struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(packet);
-    struct nd_opt_hdr &        opt = *reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(struct nd_neighbor_advert));
-    bool                       isSolicited = !aDst.IsMulticast();
-    sockaddr_in6               dst;
-    otbrError                  error = OTBR_ERROR_NONE;
+    otbrError                   error = OTBR_ERROR_NONE;
     otBackboneRouterNdProxyInfo aNdProxyInfo;
 
     VerifyOrExit(otBackboneRouterGetNdProxyInfo(mNcp.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
                                                 &aNdProxyInfo) == OT_ERROR_NONE,
                  error = OTBR_ERROR_OPENTHREAD);
 
-    memset(packet, 0, sizeof(packet));
+    // The NAs are sent together when the current batch of events is processed.
+    if (mPendingNas.empty())
+    {
+        mNaFlushTask = mNcp.PostTimerTask(Milliseconds(0), [this]() { FlushNeighborAdvertisements(); });
+    }
 
-    na.nd_na_type = ND_NEIGHBOR_ADVERT;
-    na.nd_na_code = 0;
-    // set Solicited
-    na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
-    // set Router
-    na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
-    // set Override
-    na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
+    mPendingNas.emplace_back();
 
-    memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
-    len += sizeof(struct nd_neighbor_advert);
+    {
+        PendingNa &                pending = mPendingNas.back();
+        struct nd_neighbor_advert &na      = pending.mPacket.mHeader;
 
-    opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
-    opt.nd_opt_len  = 1;
+        pending.mPacket = mNaTemplate;
 
-    memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
+        // set Solicited
+        na.nd_na_flags_reserved |= aDst.IsMulticast() ? 0 : ND_NA_FLAG_SOLICITED;
+        // set Override
+        na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
+        memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
 
-    len += (opt.nd_opt_len * 8);
+        aDst.CopyTo(pending.mDst);
+    }
 
-    aDst.CopyTo(dst);
+    if (mPendingNas.size() >= kMaxNaBatchSize)
+    {
+        FlushNeighborAdvertisements();
+    }
 
-    VerifyOrExit(sendto(mIcmp6RawSock, packet, len, 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)) == len,
-                 error = OTBR_ERROR_ERRNO);
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarningRateLimited("NdProxyManager: %s: %s", __FUNCTION__, otbrErrorString(error));
+    }
+}
+
+void NdProxyManager::AnnounceNdProxy(const Ip6Address &aTarget)
+{
+    if (OTBR_ND_PROXY_UNSOLICITED_NA_RATE == 0)
+    {
+        SendNeighborAdvertisement(aTarget, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        ExitNow();
+    }
+
+    VerifyOrExit(IsEnabled() && mAnnouncementSet.insert(aTarget).second);
+
+    if (mAnnouncementQueue.empty())
+    {
+        mAnnouncementTask = mNcp.PostTimerTask(Milliseconds(0), [this]() { ProcessAnnouncements(); });
+    }
+
+    mAnnouncementQueue.push_back(aTarget);
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return;
+}
+
+void NdProxyManager::ProcessAnnouncements(void)
+{
+    // Send the NAs in bursts every `kAnnounceInterval` to keep to the configured rate.
+    uint32_t burst = std::max<uint32_t>(1, OTBR_ND_PROXY_UNSOLICITED_NA_RATE * kAnnounceInterval / 1000);
+
+    while (burst > 0 && !mAnnouncementQueue.empty())
+    {
+        Ip6Address target = mAnnouncementQueue.front();
+
+        mAnnouncementQueue.pop_front();
+        mAnnouncementSet.erase(target);
+
+        // The DUA may have been removed while waiting.
+        if (IsNdProxy(target))
+        {
+            SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+            burst--;
+        }
+    }
+
+    if (!mAnnouncementQueue.empty())
+    {
+        mAnnouncementTask =
+            mNcp.PostTimerTask(Milliseconds(kAnnounceInterval), [this]() { ProcessAnnouncements(); });
+    }
+}
+
+void NdProxyManager::StopAnnouncements(void)
+{
+    mAnnouncementTask.Cancel();
+    mAnnouncementQueue.clear();
+    mAnnouncementSet.clear();
+}
+
+void NdProxyManager::FlushNeighborAdvertisements(void)
+{
+    struct mmsghdr msgs[kMaxNaBatchSize];
+    struct iovec   iovecs[kMaxNaBatchSize];
+    otbrError      error = OTBR_ERROR_NONE;
+    size_t         count = mPendingNas.size();
+    size_t         sent  = 0;
+
+    VerifyOrExit(count > 0);
+    assert(count <= kMaxNaBatchSize);
+
+    mNaFlushTask.Cancel();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        iovecs[i].iov_base = &mPendingNas[i].mPacket;
+        iovecs[i].iov_len  = sizeof(mPendingNas[i].mPacket);
+
+        memset(&msgs[i], 0, sizeof(msgs[i]));
+        msgs[i].msg_hdr.msg_name    = &mPendingNas[i].mDst;
+        msgs[i].msg_hdr.msg_namelen = sizeof(mPendingNas[i].mDst);
+        msgs[i].msg_hdr.msg_iov     = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    while (sent < count)
+    {
+        int ret = sendmmsg(mIcmp6RawSock, msgs + sent, static_cast<unsigned int>(count - sent), 0);
+
+        if (ret < 0)
+        {
+            VerifyOrExit(errno == EINTR, error = OTBR_ERROR_ERRNO);
+            continue;
+        }
+
+        sent += static_cast<size_t>(ret);
+    }
+
+exit:
+    mCounters.mNaSent += sent;
+    otbrTrace(TraceEvent::kNdProxyNeighborAdvert, static_cast<uint32_t>(sent), static_cast<uint32_t>(error));
+    otbrProbe(nd__na__send, sent, static_cast<int>(error));
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        mCounters.mSocketErrors++;
+        otbrLogWarning("NdProxyManager: sent %zu of %zu NA: %s", sent, count, otbrErrorString(error));
+    }
+    else if (count > 0)
+    {
+        otbrLogDebug("NdProxyManager: sent %zu NA", sent);
+    }
+
+    mPendingNas.clear();
 }
 
 otbrError NdProxyManager::UpdateMacAddress(void)
@@ -358,6 +775,17 @@ otbrError NdProxyManager::UpdateMacAddress(void)
 
     VerifyOrExit(ioctl(mIcmp6RawSock, SIOCGIFHWADDR, &ifr) != -1, error = OTBR_ERROR_ERRNO);
     memcpy(mMacAddress.m8, ifr.ifr_hwaddr.sa_data, sizeof(mMacAddress));
+
+    // Only the target and the Solicited and Override flags differ between the NAs we send.
+    static_assert(sizeof(NeighborAdvertisement) == sizeof(struct nd_neighbor_advert) + 8,
+                  "The Target Link-Layer Address option must take 8 bytes");
+    memset(&mNaTemplate, 0, sizeof(mNaTemplate));
+    mNaTemplate.mHeader.nd_na_type                = ND_NEIGHBOR_ADVERT;
+    mNaTemplate.mHeader.nd_na_code                = 0;
+    mNaTemplate.mHeader.nd_na_flags_reserved      = ND_NA_FLAG_ROUTER;
+    mNaTemplate.mTargetLinkAddrOption.nd_opt_type = ND_OPT_TARGET_LINKADDR;
+    mNaTemplate.mTargetLinkAddrOption.nd_opt_len  = 1; // In units of 8 bytes.
+    memcpy(mNaTemplate.mTargetLinkAddr, mMacAddress.m8, sizeof(mMacAddress));
 #else
     ExitNow(error = OTBR_ERROR_NOT_IMPLEMENTED);
 #endif
@@ -368,9 +796,10 @@ exit:
 
 otbrError NdProxyManager::InitIcmp6RawSocket(void)
 {
-    otbrError           error = OTBR_ERROR_NONE;
-    int                 on    = 1;
-    int                 hops  = 255;
+    otbrError           error  = OTBR_ERROR_NONE;
+    int                 on     = 1;
+    int                 hops   = 255;
+    int                 rcvbuf = OTBR_ND_PROXY_RCVBUF_SIZE;
     struct icmp6_filter filter;
 
     mIcmp6RawSock = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
@@ -385,6 +814,16 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
                  error = OTBR_ERROR_ERRNO);
 #endif // __linux__
 
+    if (OTBR_ND_PROXY_RCVBUF_SIZE > 0)
+    {
+        VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) == 0,
+                     error = OTBR_ERROR_ERRNO);
+    }
+
+    // Have the kernel report how many packets it dropped because the socket queue was full.
+    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_RXQ_OVFL, &on, sizeof(on)) == 0, error = OTBR_ERROR_ERRNO);
+    mRxQueueOverflows = 0;
+
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_RECVPKTINFO, &on, sizeof(on)) == 0,
                  error = OTBR_ERROR_ERRNO);
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_RECVHOPLIMIT, &on, sizeof(on)) == 0,
@@ -399,6 +838,15 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+    // The NS are still matched in user space without the socket filter.
+    OTBR_UNUSED_VARIABLE(UpdateNsFilter());
+
+    MainloopManager::GetInstance().RegisterFd(mIcmp6RawSock, MainloopManager::kEventReadable,
+                                              [this](uint8_t) { ProcessMulticastNeighborSolicition(); });
+
+    // The ND Proxy table may have been populated while the ND Proxy was disabled.
+    JoinSolicitedNodeMulticastGroups();
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -408,10 +856,115 @@ exit:
     return error;
 }
 
+otbrError NdProxyManager::UpdateNsFilter(void)
+{
+    // In the socket filter of an IPv6 raw socket, offset 0 is the ICMPv6 header and the IPv6 header is
+    // accessed relative to `SKF_NET_OFF`.
+    static constexpr uint32_t kIp6HopLimitOffset =
+        static_cast<uint32_t>(SKF_NET_OFF + static_cast<int>(offsetof(struct ip6_hdr, ip6_hlim)));
+    static constexpr uint32_t kIp6DstOffset =
+        static_cast<uint32_t>(SKF_NET_OFF + static_cast<int>(offsetof(struct ip6_hdr, ip6_dst)));
+    static constexpr uint32_t kAcceptPacket = 0xffffffff;
+    static constexpr uint32_t kDropPacket   = 0;
+    static constexpr size_t   kNsOnlyLength = 12; // The statements matching an NS to any solicited-node group.
+
+    // The filter matches hop limit 255, the NS type and the solicited-node prefix (ff02::1:ff00:0/104),
+    // then compares the last 32 bits of the destination with each proxied group.
+    std::vector<struct sock_filter> program = {
+        BPF_STMT(BPF_LD | BPF_B | BPF_ABS, kIp6HopLimitOffset),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 255, 0, 8),
+        BPF_STMT(BPF_LD | BPF_B | BPF_ABS, offsetof(struct icmp6_hdr, icmp6_type)),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_NEIGHBOR_SOLICIT, 0, 6),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kIp6DstOffset),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 0xff020000, 0, 4),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kIp6DstOffset + 4),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 0, 0, 2),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kIp6DstOffset + 8),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 1, 1, 0),
+        BPF_STMT(BPF_RET | BPF_K, kDropPacket),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kIp6DstOffset + 12),
+    };
+    struct sock_fprog fprog;
+    otbrError         error = OTBR_ERROR_NONE;
+
+    assert(program.size() == kNsOnlyLength);
+
+    VerifyOrExit(mIcmp6RawSock >= 0);
+
+    if (mSolicitedNodeGroups.size() <= kMaxNsFilterGroups)
+    {
+        for (const auto &group : mSolicitedNodeGroups)
+        {
+            program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, be32toh(group.first.m32[3]), 0, 1));
+            program.push_back(BPF_STMT(BPF_RET | BPF_K, kAcceptPacket));
+        }
+        program.push_back(BPF_STMT(BPF_RET | BPF_K, kDropPacket));
+    }
+    else
+    {
+        // Too many groups to fit in a filter, leave it to user space to match the group.
+        program.back() = BPF_STMT(BPF_RET | BPF_K, kAcceptPacket);
+    }
+
+    fprog.len    = static_cast<unsigned short>(program.size());
+    fprog.filter = program.data();
+
+    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) != 0);
+
+    // The previous filter would keep dropping the NS of the groups joined since, so it is replaced by the filter
+    // leaving the group to user space, or removed.
+    error = OTBR_ERROR_ERRNO;
+    mCounters.mSocketErrors++;
+    otbrLogWarning("NdProxyManager: failed to attach the NS filter: %s", strerror(errno));
+
+    program.resize(kNsOnlyLength);
+    program.back() = BPF_STMT(BPF_RET | BPF_K, kAcceptPacket);
+    fprog.len      = static_cast<unsigned short>(program.size());
+    fprog.filter   = program.data();
+
+    if (setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) != 0 &&
+        setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_DETACH_FILTER, nullptr, 0) != 0 && errno != ENOENT)
+    {
+        otbrLogErr("NdProxyManager: failed to detach the NS filter: %s", strerror(errno));
+    }
+
+exit:
+    otbrLogResult(error, "NdProxyManager: UpdateNsFilter with %zu solicited-node groups", mSolicitedNodeGroups.size());
+    return error;
+}
+
+void NdProxyManager::ScheduleNsFilterUpdate(void)
+{
+    // A burst of ND Proxy events, e.g. when the BBR becomes primary, is coalesced into one update.
+    VerifyOrExit(IsEnabled() && !mNsFilterUpdatePending);
+
+    mNsFilterUpdatePending = true;
+    mNsFilterUpdateTask    = mNcp.PostTimerTask(Milliseconds(0), [this]() {
+        mNsFilterUpdatePending = false;
+        UpdateNsFilter();
+    });
+
+exit:
+    return;
+}
+
 void NdProxyManager::FiniIcmp6RawSocket(void)
 {
+    CloseMembershipSockets();
+    StopAnnouncements();
+
+    mNaFlushTask.Cancel();
+    mPendingNas.clear();
+
+    if (mNsFilterUpdatePending)
+    {
+        mNsFilterUpdateTask.Cancel();
+        mNsFilterUpdatePending = false;
+    }
+
     if (mIcmp6RawSock != -1)
     {
+        MainloopManager::GetInstance().UnregisterFd(mIcmp6RawSock);
         close(mIcmp6RawSock);
         mIcmp6RawSock = -1;
     }
@@ -425,10 +978,36 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit(nfq_unbind_pf(mNfqHandler, AF_INET6) >= 0);
     VerifyOrExit(nfq_bind_pf(mNfqHandler, AF_INET6) >= 0);
 
-    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
-    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
+    // The queues are referenced by the NFQUEUE callbacks, so they must not be moved after being created.
+    mNfQueues.resize(OTBR_ND_PROXY_NFQUEUE_NUM_QUEUES, NfQueue{this, nullptr, 0, false});
+
+    for (uint16_t i = 0; i < mNfQueues.size(); i++)
+    {
+        NfQueue &queue = mNfQueues[i];
+
+        VerifyOrExit((queue.mHandle = nfq_create_queue(mNfqHandler, kNfQueueNum + i, HandleNetfilterQueue, &queue)) !=
+                     nullptr);
+        VerifyOrExit(nfq_set_mode(queue.mHandle, NFQNL_COPY_PACKET, 0xffff) >= 0);
+
+        // Accept the packets instead of dropping them when the queue is full, so that DAD and NUD
+        // on the backbone link keep working even if we fall behind.
+        if (nfq_set_queue_flags(queue.mHandle, NFQA_CFG_F_FAIL_OPEN, NFQA_CFG_F_FAIL_OPEN) < 0)
+        {
+            otbrLogWarning("NdProxyManager: failed to enable fail-open on NFQUEUE %u: %s", kNfQueueNum + i,
+                           strerror(errno));
+        }
+    }
+
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
 
+#if OTBR_ENABLE_ND_PROXY_NFQUEUE_THREAD
+    VerifyOrExit((mNfqStopEvent = eventfd(0, EFD_CLOEXEC)) >= 0);
+    mNfqThread = std::thread(&NdProxyManager::RunNetfilterQueue, this);
+#else
+    MainloopManager::GetInstance().RegisterFd(mUnicastNsQueueSock, MainloopManager::kEventReadable,
+                                              [this](uint8_t) { ProcessUnicastNeighborSolicition(); });
+#endif
+
     error = OTBR_ERROR_NONE;
 
 exit:
@@ -444,18 +1023,43 @@ exit:
 
 void NdProxyManager::FiniNetfilterQueue(void)
 {
+    if (mNfqThread.joinable())
+    {
+        uint64_t stop = 1;
+
+        if (write(mNfqStopEvent, &stop, sizeof(stop)) != sizeof(stop))
+        {
+            otbrLogErr("NdProxyManager: failed to stop the NFQUEUE thread: %s", strerror(errno));
+        }
+
+        mNfqThread.join();
+    }
+
+    if (mNfqStopEvent != -1)
+    {
+        close(mNfqStopEvent);
+        mNfqStopEvent = -1;
+    }
+
     if (mUnicastNsQueueSock != -1)
     {
+#if !OTBR_ENABLE_ND_PROXY_NFQUEUE_THREAD
+        MainloopManager::GetInstance().UnregisterFd(mUnicastNsQueueSock);
+#endif
         close(mUnicastNsQueueSock);
         mUnicastNsQueueSock = -1;
     }
 
-    if (mNfqQueueHandler != nullptr)
+    for (NfQueue &queue : mNfQueues)
     {
-        nfq_destroy_queue(mNfqQueueHandler);
-        mNfqQueueHandler = nullptr;
+        if (queue.mHandle != nullptr)
+        {
+            nfq_destroy_queue(queue.mHandle);
+        }
     }
 
+    mNfQueues.clear();
+
     if (mNfqHandler != nullptr)
     {
         nfq_close(mNfqHandler);
@@ -468,15 +1072,50 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                          struct nfq_data *    aNfData,
                                          void *               aContext)
 {
-    return static_cast<NdProxyManager *>(aContext)->HandleNetfilterQueue(aNfQueueHandler, aNfMsg, aNfData);
+    NfQueue &queue = *static_cast<NfQueue *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aNfQueueHandler);
+    OTBR_UNUSED_VARIABLE(aNfMsg);
+
+    return queue.mOwner->HandleNetfilterQueue(queue, aNfData);
+}
+
+bool NdProxyManager::IsNdProxy(const Ip6Address &aAddress)
+{
+    std::lock_guard<std::mutex> _(mNdProxySetMutex);
+
+    return mNdProxySet.find(aAddress) != mNdProxySet.end();
 }
 
-int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
-                                         struct nfgenmsg *    aNfMsg,
-                                         struct nfq_data *    aNfData)
+void NdProxyManager::EstimateMemory(size_t &aNumEntries, size_t &aNumBytes)
 {
-    OTBR_UNUSED_VARIABLE(aNfMsg);
+    {
+        std::lock_guard<std::mutex> _(mNdProxySetMutex);
+
+        aNumEntries = mNdProxySet.size();
+        aNumBytes   = MemoryUsage::GetTreeSize(mNdProxySet);
+    }
 
+    aNumBytes += MemoryUsage::GetHashTableSize(mSolicitedNodeGroups) + MemoryUsage::GetHashTableSize(mAnnouncementSet) +
+                 mAnnouncementQueue.size() * sizeof(Ip6Address) + MemoryUsage::GetHeapSize(mPendingNas) +
+                 MemoryUsage::GetHeapSize(mMembershipSockets);
+}
+
+NdProxyManager::Counters NdProxyManager::GetCounters(void) const
+{
+    Counters counters = mCounters;
+
+    counters.mUnicastNsReceived = mUnicastNsCounters.mReceived;
+    counters.mNsMatched += mUnicastNsCounters.mMatched;
+    counters.mNfqAccepted = mUnicastNsCounters.mAccepted;
+    counters.mNfqDropped  = mUnicastNsCounters.mDropped;
+    counters.mSocketErrors += mUnicastNsCounters.mErrors;
+
+    return counters;
+}
+
+int NdProxyManager::HandleNetfilterQueue(NfQueue &aQueue, struct nfq_data *aNfData)
+{
     struct nfqnl_msg_packet_hdr *ph;
     unsigned char *              data;
     uint32_t                     id      = 0;
@@ -486,17 +1125,23 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     Ip6Address        dst;
     Ip6Address        src;
+    char              srcString[Ip6Address::kStringSize];
+    char              dstString[Ip6Address::kStringSize];
     struct icmp6_hdr *icmp6header = nullptr;
     struct ip6_hdr *  ip6header   = nullptr;
     otbrError         error       = OTBR_ERROR_NONE;
 
+    otbrProbe(nd__ns__receive, 1);
+
     if ((ph = nfq_get_msg_packet_hdr(aNfData)) != nullptr)
     {
         id = ntohl(ph->packet_id);
-        otbrLogDebug("NdProxyManager: %s: id %d", __FUNCTION__, id);
+        otbrLogDebugRateLimited("NdProxyManager: %s: id %d", __FUNCTION__, id);
     }
 
     VerifyOrExit((len = nfq_get_payload(aNfData, &data)) > 0, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(static_cast<size_t>(len) >= sizeof(struct ip6_hdr) + sizeof(struct nd_neighbor_solicit),
+                 error = OTBR_ERROR_PARSE);
 
     ip6header = reinterpret_cast<struct ip6_hdr *>(data);
     src       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_src);
@@ -504,64 +1149,203 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     VerifyOrExit(ip6header->ip6_nxt == IPPROTO_ICMPV6);
 
-    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
-                 dst.ToString().c_str());
+    otbrLogDebugRateLimited("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString(srcString),
+                            dst.ToString(dstString));
 
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
 
-    VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(IsNdProxy(dst), error = OTBR_ERROR_NOT_FOUND);
 
     {
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
-        Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
+        Ip6Address                  target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
+        char                        targetString[Ip6Address::kStringSize];
 
-        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
-                     ip6header->ip6_hlim);
+        otbrLogDebugRateLimited("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__,
+                                target.ToString(targetString), ip6header->ip6_hlim);
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
+        mUnicastNsCounters.mMatched++;
+#if OTBR_ENABLE_ND_PROXY_NFQUEUE_THREAD
+        // The NA needs the ND Proxy info from OpenThread, which is only accessible on the mainloop.
+        mNcp.PostTimerTask(Milliseconds(0), [this, target, src]() { SendNeighborAdvertisement(target, src); });
+#else
         SendNeighborAdvertisement(target, src);
+#endif
         verdict = NF_DROP;
     }
 
 exit:
-    ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
+    if (verdict == NF_ACCEPT)
+    {
+        mUnicastNsCounters.mAccepted++;
 
-    otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
-                  verdict);
+        // Packet IDs increase within a queue, so accepted packets are given a single batch verdict later.
+        aQueue.mPendingAcceptId  = id;
+        aQueue.mHasPendingAccept = true;
+    }
+    else
+    {
+        mUnicastNsCounters.mDropped++;
+
+        if (aQueue.mHasPendingAccept)
+        {
+            ret                      = nfq_set_verdict_batch(aQueue.mHandle, aQueue.mPendingAcceptId, NF_ACCEPT);
+            aQueue.mHasPendingAccept = false;
+        }
+
+        if (ret >= 0)
+        {
+            ret = nfq_set_verdict(aQueue.mHandle, id, verdict, 0, nullptr);
+        }
+    }
+
+    if (ret < 0)
+    {
+        mUnicastNsCounters.mErrors++;
+    }
+
+    otbrTrace(TraceEvent::kNdProxyUnicastNs, id, static_cast<uint32_t>(verdict), static_cast<uint32_t>(error));
+    otbrLogDebugRateLimited("NdProxyManager: %s (id %u, ret %d verdict %d): %s", __FUNCTION__, id, ret, verdict,
+                            otbrErrorString(error));
 
     return ret;
 }
 
-void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+int NdProxyManager::AllocateMembershipSocket(void)
+{
+    int index = -1;
+
+    for (size_t i = 0; i < mMembershipSockets.size(); i++)
+    {
+        const MembershipSocket &socket = mMembershipSockets[i];
+
+        if (socket.mFd >= 0 && !socket.mIsFull && socket.mNumGroups < kMaxGroupsPerSocket)
+        {
+            ExitNow(index = static_cast<int>(i));
+        }
+
+        if (socket.mFd < 0 && index < 0)
+        {
+            index = static_cast<int>(i);
+        }
+    }
+
+    if (index < 0)
+    {
+        index = static_cast<int>(mMembershipSockets.size());
+        mMembershipSockets.push_back(MembershipSocket{-1, 0, false});
+    }
+
+    {
+        MembershipSocket &socket = mMembershipSockets[index];
+
+        // An unbound UDP socket never receives anything, it only holds the memberships.
+        VerifyOrExit((socket.mFd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, kSocketBlock)) >= 0,
+                     index = -1);
+        socket.mNumGroups = 0;
+        socket.mIsFull    = false;
+    }
+
+exit:
+    return index;
+}
+
+void NdProxyManager::CloseMembershipSockets(void)
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    for (MembershipSocket &socket : mMembershipSockets)
+    {
+        if (socket.mFd >= 0)
+        {
+            close(socket.mFd);
+        }
+    }
+
+    mMembershipSockets.clear();
+
+    for (auto &group : mSolicitedNodeGroups)
+    {
+        group.second.mSocketIndex = -1;
+    }
+}
+
+void NdProxyManager::JoinSolicitedNodeMulticastGroups(void)
+{
+    for (auto &group : mSolicitedNodeGroups)
+    {
+        JoinSolicitedNodeMulticastGroup(group.first, group.second);
+    }
+}
+
+void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aGroup, SolicitedNodeGroup &aGroupInfo)
+{
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(IsEnabled() && aGroupInfo.mSocketIndex < 0);
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
+
+    while (true)
+    {
+        int index;
+
+        VerifyOrExit((index = AllocateMembershipSocket()) >= 0, error = OTBR_ERROR_ERRNO);
+
+        if (setsockopt(mMembershipSockets[index].mFd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0)
+        {
+            mMembershipSockets[index].mNumGroups++;
+            aGroupInfo.mSocketIndex = index;
+            break;
+        }
+
+        // The socket ran out of option memory, continue with another socket unless even a new one fails.
+        VerifyOrExit((errno == ENOBUFS || errno == ENOMEM) && mMembershipSockets[index].mNumGroups > 0,
+                     error = OTBR_ERROR_ERRNO);
+        mMembershipSockets[index].mIsFull = true;
+    }
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
-                 error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    if (error != OTBR_ERROR_NONE)
+    {
+        mCounters.mSocketErrors++;
+    }
+
+    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup %s", aGroup.ToString().c_str());
 }
 
-void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aGroup, SolicitedNodeGroup &aGroupInfo)
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    ipv6_mreq         mreq;
+    otbrError         error = OTBR_ERROR_NONE;
+    MembershipSocket *socket;
+
+    VerifyOrExit(aGroupInfo.mSocketIndex >= 0);
+
+    socket                  = &mMembershipSockets[aGroupInfo.mSocketIndex];
+    aGroupInfo.mSocketIndex = -1;
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
+
+    if (setsockopt(socket->mFd, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) != 0)
+    {
+        error = OTBR_ERROR_ERRNO;
+        mCounters.mSocketErrors++;
+    }
+
+    socket->mNumGroups--;
+    socket->mIsFull = false;
+
+    if (socket->mNumGroups == 0)
+    {
+        close(socket->mFd);
+        socket->mFd = -1;
+    }
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
-                 error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup %s", aGroup.ToString().c_str());
 }
 
 } // namespace BackboneRouter
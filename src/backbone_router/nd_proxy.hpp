@@ -40,17 +40,27 @@
 #define __APPLE_USE_RFC_3542
 #endif
 
+#include <atomic>
+#include <functional>
 #include <inttypes.h>
 #include <libnetfilter_queue/libnetfilter_queue.h>
+#include <deque>
 #include <map>
+#include <mutex>
+#include <netinet/icmp6.h>
 #include <netinet/in.h>
 #include <set>
 #include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <openthread/backbone_router_ftd.h>
 
 #include "agent/ncp_openthread.hpp"
-#include "common/mainloop.hpp"
+#include "common/memory_usage.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
@@ -69,7 +79,7 @@ namespace BackboneRouter {
  * This class implements ND Proxy manager.
  *
  */
-class NdProxyManager : public MainloopProcessor
+class NdProxyManager
 {
 public:
     /**
@@ -78,10 +88,19 @@ public:
      */
     explicit NdProxyManager(otbr::Ncp::ControllerOpenThread &aNcp)
         : mNcp(aNcp)
+        , mNsFilterUpdatePending(false)
         , mIcmp6RawSock(-1)
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
-        , mNfqQueueHandler(nullptr)
+        , mNfqStopEvent(-1)
+        , mRxQueueOverflows(0)
+        , mCounters()
+        , mUnicastNsCounters()
+        , mNdProxyMemory("otbr_nd_proxy_addresses",
+                         "Addresses proxied by the ND Proxy manager.",
+                         "otbr_nd_proxy_addresses_memory_bytes",
+                         "Estimated memory of the proxied addresses and their multicast groups and announcements.",
+                         [this](size_t &aNumEntries, size_t &aNumBytes) { EstimateMemory(aNumEntries, aNumBytes); })
     {
     }
 
@@ -106,20 +125,15 @@ public:
     void Disable(void);
 
     /**
-     * This method updates the mainloop context.
+     * This method moves the ND Proxy manager to a new Domain Prefix.
      *
-     * @param[inout]  aMainloop  A reference to the mainloop to be updated.
+     * Unlike `Disable()` and `Enable()`, this keeps the sockets, the NFQUEUE bindings and the proxied DUAs,
+     * so that NS keep being answered during the change. The ND Proxy manager is enabled if it is not yet.
      *
-     */
-    void Update(MainloopContext &aMainloop) override;
-
-    /**
-     * This method processes mainloop events.
-     *
-     * @param[in]  aMainloop  A reference to the mainloop context.
+     * @param[in] aDomainPrefix  The new Domain Prefix.
      *
      */
-    void Process(const MainloopContext &aMainloop) override;
+    void UpdateDomainPrefix(const Ip6Prefix &aDomainPrefix);
 
     /**
      * This method handles a Backbone Router ND Proxy event.
@@ -139,37 +153,195 @@ public:
      */
     bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
 
+    /**
+     * This structure represents the counters of the ND Proxy manager.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mMulticastNsReceived; ///< The number of multicast NS received on the backbone link.
+        uint64_t mMulticastNsDropped;  ///< The number of multicast NS dropped by the kernel on a full socket queue.
+        uint64_t mMulticastNsBatches;  ///< The number of batches the multicast NS were received in.
+        uint64_t mUnicastNsReceived;   ///< The number of unicast NS received from NFQUEUE.
+        uint64_t mNsMatched;           ///< The number of NS (multicast or unicast) targeting a proxied DUA.
+        uint64_t mNaSent;              ///< The number of NA sent.
+        uint64_t mNfqAccepted;         ///< The number of unicast NS given an accept verdict.
+        uint64_t mNfqDropped;          ///< The number of unicast NS given a drop verdict.
+        uint64_t mDuaAdded;            ///< The number of DUAs added to ND Proxy.
+        uint64_t mDuaRenewed;          ///< The number of DUAs renewed.
+        uint64_t mDuaRemoved;          ///< The number of DUAs removed from ND Proxy.
+        uint64_t mSocketErrors;        ///< The number of failed socket or NFQUEUE operations.
+    };
+
+    /**
+     * This method returns the counters of the ND Proxy manager.
+     *
+     * @returns  A snapshot of the counters.
+     *
+     */
+    Counters GetCounters(void) const;
+
 private:
     enum
     {
         kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kNsBatchSize        = 8,    ///< Max number of multicast NS received with a single `recvmmsg` call.
+        kNsControlSize      = 2 * CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(uint32_t)),
+        kMaxNsFilterGroups  = 2000, ///< Max number of solicited-node groups matched by the kernel socket filter.
+        kNfQueueNum         = 88,   ///< The first NFQUEUE number of unicast NS.
+        kMaxGroupsPerSocket = 128,  ///< Max number of multicast groups joined on one membership socket.
+        kMaxNaBatchSize     = 32,   ///< Max number of NA sent with a single `sendmmsg` call.
+        kAnnounceInterval   = 100,  ///< The interval (in milliseconds) between bursts of paced unsolicited NAs.
+    };
+
+    /**
+     * This structure represents a Neighbor Advertisement with the Target Link-Layer Address option.
+     *
+     */
+    struct NeighborAdvertisement
+    {
+        struct nd_neighbor_advert mHeader;
+        struct nd_opt_hdr         mTargetLinkAddrOption;
+        uint8_t                   mTargetLinkAddr[sizeof(MacAddress)];
+    };
+
+    /**
+     * This structure represents a Neighbor Advertisement waiting to be sent.
+     *
+     */
+    struct PendingNa
+    {
+        NeighborAdvertisement mPacket;
+        sockaddr_in6          mDst;
+    };
+
+    /**
+     * This structure represents a NFQUEUE of unicast NS.
+     *
+     */
+    struct NfQueue
+    {
+        NdProxyManager *     mOwner;            ///< The ND Proxy manager owning the queue.
+        struct nfq_q_handle *mHandle;           ///< A pointer to the queue handler.
+        uint32_t             mPendingAcceptId;  ///< The packet ID up to which packets are waiting to be accepted.
+        bool                 mHasPendingAccept; ///< Whether there are packets waiting to be accepted.
+    };
+
+    /**
+     * This structure represents the counters updated by the NFQUEUE handler, which may run on its own thread.
+     *
+     */
+    struct UnicastNsCounters
+    {
+        std::atomic<uint64_t> mReceived;
+        std::atomic<uint64_t> mMatched;
+        std::atomic<uint64_t> mAccepted;
+        std::atomic<uint64_t> mDropped;
+        std::atomic<uint64_t> mErrors;
+    };
+
+    using Ip6tablesRuleHandler = std::function<void(otbrError aError, const std::string &aDomainPrefix)>;
+
+    struct Ip6AddressHash
+    {
+        size_t operator()(const Ip6Address &aAddress) const
+        {
+            // Solicited-node groups only differ in the last 24 bits, so fold those into the low-order bits.
+            uint64_t hash = aAddress.m64[0] * 0x9e3779b97f4a7c15ULL ^ aAddress.m64[1];
+
+            return static_cast<size_t>(hash ^ (hash >> 32));
+        }
     };
 
+    /**
+     * This structure represents a solicited-node multicast group of proxied DUAs.
+     *
+     */
+    struct SolicitedNodeGroup
+    {
+        uint32_t mNumDuas;     ///< The number of proxied DUAs in the group.
+        int      mSocketIndex; ///< The index of the membership socket joined to the group, or -1 if not joined.
+    };
+
+    /**
+     * This structure represents a socket only used to hold multicast group memberships.
+     *
+     * The memberships of a socket are charged to its option memory (`optmem_max`), so the groups are
+     * spread over several sockets. The raw ICMPv6 socket receives the NS sent to any group joined on
+     * the backbone interface.
+     *
+     */
+    struct MembershipSocket
+    {
+        int      mFd;        ///< The file descriptor of the socket, or -1 if the slot is unused.
+        uint32_t mNumGroups; ///< The number of groups joined on the socket.
+        bool     mIsFull;    ///< Whether the kernel rejected more memberships on the socket.
+    };
+
+    using SolicitedNodeGroupMap = std::unordered_map<Ip6Address, SolicitedNodeGroup, Ip6AddressHash>;
+    using Ip6AddressSet         = std::unordered_set<Ip6Address, Ip6AddressHash>;
+
     void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    void       FlushNeighborAdvertisements(void);
+    void       AnnounceNdProxy(const Ip6Address &aTarget);
+    void       ProcessAnnouncements(void);
+    void       StopAnnouncements(void);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
+    otbrError  UpdateNsFilter(void);
+    void       ScheduleNsFilterUpdate(void);
     void       FiniIcmp6RawSocket(void);
     otbrError  InitNetfilterQueue(void);
     void       FiniNetfilterQueue(void);
+    void       UpdateIp6tablesRule(const char *aAction, const Ip6Prefix &aDomainPrefix, Ip6tablesRuleHandler aHandler);
+    void       HandleIp6tablesRuleAdded(otbrError aError, const std::string &aDomainPrefix);
     void       ProcessMulticastNeighborSolicition(void);
+    void       HandleMulticastNeighborSolicit(uint8_t *aPacket, size_t aLength, struct msghdr &aMsg);
+    uint32_t   UpdateRxQueueOverflows(struct msghdr &aMsg);
     void       ProcessUnicastNeighborSolicition(void);
-    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
-    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    void       RunNetfilterQueue(void);
+    void       FlushNetfilterQueueVerdicts(void);
+    void       AddNdProxy(const Ip6Address &aTarget);
+    void       RemoveNdProxy(const Ip6Address &aTarget);
+    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aGroup, SolicitedNodeGroup &aGroupInfo);
+    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aGroup, SolicitedNodeGroup &aGroupInfo);
+    void       JoinSolicitedNodeMulticastGroups(void);
+    void       CloseMembershipSockets(void);
+    int        AllocateMembershipSocket(void);
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg *    aNfMsg,
                                     struct nfq_data *    aNfData,
                                     void *               aContext);
-    int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
+    int        HandleNetfilterQueue(NfQueue &aQueue, struct nfq_data *aNfData);
+    bool       IsNdProxy(const Ip6Address &aAddress);
+    void       EstimateMemory(size_t &aNumEntries, size_t &aNumBytes);
 
     otbr::Ncp::ControllerOpenThread &mNcp;
+    std::mutex                       mNdProxySetMutex; ///< Guards `mNdProxySet` against the NFQUEUE thread.
     std::set<Ip6Address>             mNdProxySet;
+    SolicitedNodeGroupMap            mSolicitedNodeGroups;
+    std::vector<MembershipSocket>    mMembershipSockets;
+    TaskRunner::TaskHandle           mNsFilterUpdateTask;
+    bool                             mNsFilterUpdatePending;
     uint32_t                         mBackboneIfIndex;
     int                              mIcmp6RawSock;
     int                              mUnicastNsQueueSock;
-    struct nfq_handle *              mNfqHandler;      ///< A pointer to an NFQUEUE handler.
-    struct nfq_q_handle *            mNfqQueueHandler; ///< A pointer to a newly created queue.
+    struct nfq_handle *              mNfqHandler; ///< A pointer to an NFQUEUE handler.
+    std::vector<NfQueue>             mNfQueues;
+    std::thread                      mNfqThread;
+    int                              mNfqStopEvent; ///< An eventfd to stop `mNfqThread`.
     MacAddress                       mMacAddress;
+    NeighborAdvertisement            mNaTemplate; ///< The NA with our MAC address, only the target is left to fill.
+    std::vector<PendingNa>           mPendingNas;
+    TaskRunner::TaskHandle           mNaFlushTask;
+    std::deque<Ip6Address>           mAnnouncementQueue; ///< The DUAs waiting for a paced unsolicited NA.
+    Ip6AddressSet                    mAnnouncementSet;   ///< The DUAs in `mAnnouncementQueue`.
+    TaskRunner::TaskHandle           mAnnouncementTask;
     Ip6Prefix                        mDomainPrefix;
+    uint32_t                         mRxQueueOverflows; ///< The last reported total of kernel drops on the socket.
+    Counters                         mCounters;
+    UnicastNsCounters                mUnicastNsCounters;
+    MemoryReporter                   mNdProxyMemory;
 };
 
 /**
@@ -0,0 +1,248 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements programming routes and routing rules over rtnetlink.
+ */
+
+#include "backbone_router/netlink_route.hpp"
+
+#if OTBR_ENABLE_DUA_ROUTING
+
+#include <assert.h>
+#include <errno.h>
+#include <linux/fib_rules.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+namespace {
+
+void AppendAttribute(struct nlmsghdr &aMessage, size_t aMaxSize, uint16_t aType, const void *aData, size_t aLength)
+{
+    struct rtattr *attr =
+        reinterpret_cast<struct rtattr *>(reinterpret_cast<uint8_t *>(&aMessage) + NLMSG_ALIGN(aMessage.nlmsg_len));
+
+    assert(NLMSG_ALIGN(aMessage.nlmsg_len) + RTA_SPACE(aLength) <= aMaxSize);
+    OTBR_UNUSED_VARIABLE(aMaxSize);
+
+    attr->rta_type = aType;
+    attr->rta_len  = static_cast<unsigned short>(RTA_LENGTH(aLength));
+    memcpy(RTA_DATA(attr), aData, aLength);
+
+    aMessage.nlmsg_len = NLMSG_ALIGN(aMessage.nlmsg_len) + RTA_ALIGN(attr->rta_len);
+}
+
+void AppendAttribute(struct nlmsghdr &aMessage, size_t aMaxSize, uint16_t aType, uint32_t aValue)
+{
+    AppendAttribute(aMessage, aMaxSize, aType, &aValue, sizeof(aValue));
+}
+
+} // namespace
+
+otbrError NetlinkRouteSocket::Open(void)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    struct sockaddr_nl addr;
+
+    VerifyOrExit(mFd < 0);
+
+    mFd = SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE, kSocketBlock);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    VerifyOrExit(bind(mFd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Close();
+    }
+
+    return error;
+}
+
+void NetlinkRouteSocket::Close(void)
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+otbrError NetlinkRouteSocket::UpdateRoute(bool             aAdd,
+                                          const Ip6Prefix &aPrefix,
+                                          uint32_t         aIfIndex,
+                                          uint32_t         aTable,
+                                          uint32_t         aMetric)
+{
+    union
+    {
+        struct nlmsghdr mHeader;
+        uint8_t         mBuffer[kMaxRequestSize];
+    } request;
+    struct rtmsg *route;
+
+    memset(&request, 0, sizeof(request));
+
+    request.mHeader.nlmsg_len   = NLMSG_LENGTH(sizeof(struct rtmsg));
+    request.mHeader.nlmsg_type  = aAdd ? RTM_NEWROUTE : RTM_DELROUTE;
+    request.mHeader.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aAdd ? NLM_F_CREATE | NLM_F_EXCL : 0);
+
+    route               = static_cast<struct rtmsg *>(NLMSG_DATA(&request.mHeader));
+    route->rtm_family   = AF_INET6;
+    route->rtm_dst_len  = aPrefix.mLength;
+    route->rtm_table    = aTable < 256 ? static_cast<uint8_t>(aTable) : static_cast<uint8_t>(RT_TABLE_UNSPEC);
+    route->rtm_protocol = RTPROT_STATIC;
+    // Like `ip route del`, match routes of any scope when deleting.
+    route->rtm_scope = aAdd ? RT_SCOPE_UNIVERSE : RT_SCOPE_NOWHERE;
+    route->rtm_type  = RTN_UNICAST;
+
+    AppendAttribute(request.mHeader, sizeof(request), RTA_DST, &aPrefix.mPrefix, sizeof(aPrefix.mPrefix));
+    AppendAttribute(request.mHeader, sizeof(request), RTA_OIF, aIfIndex);
+    AppendAttribute(request.mHeader, sizeof(request), RTA_TABLE, aTable);
+
+    if (aMetric != 0)
+    {
+        AppendAttribute(request.mHeader, sizeof(request), RTA_PRIORITY, aMetric);
+    }
+
+    return Request(request.mHeader, aAdd);
+}
+
+otbrError NetlinkRouteSocket::AddRule(const char *aIifName, uint32_t aTable)
+{
+    otbrError error;
+
+    // The kernel gives every new rule without a priority its own priority, so it never finds the rule
+    // to exist already. Delete it first to not pile up duplicates.
+    SuccessOrExit(error = UpdateRule(/* aAdd */ false, aIifName, aTable));
+    error = UpdateRule(/* aAdd */ true, aIifName, aTable);
+
+exit:
+    return error;
+}
+
+otbrError NetlinkRouteSocket::UpdateRule(bool aAdd, const char *aIifName, uint32_t aTable)
+{
+    union
+    {
+        struct nlmsghdr mHeader;
+        uint8_t         mBuffer[kMaxRequestSize];
+    } request;
+    struct fib_rule_hdr *rule;
+
+    memset(&request, 0, sizeof(request));
+
+    request.mHeader.nlmsg_len   = NLMSG_LENGTH(sizeof(struct fib_rule_hdr));
+    request.mHeader.nlmsg_type  = aAdd ? RTM_NEWRULE : RTM_DELRULE;
+    request.mHeader.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aAdd ? NLM_F_CREATE | NLM_F_EXCL : 0);
+
+    rule         = static_cast<struct fib_rule_hdr *>(NLMSG_DATA(&request.mHeader));
+    rule->family = AF_INET6;
+    rule->table  = aTable < 256 ? static_cast<uint8_t>(aTable) : static_cast<uint8_t>(RT_TABLE_UNSPEC);
+    rule->action = FR_ACT_TO_TBL;
+
+    AppendAttribute(request.mHeader, sizeof(request), FRA_IIFNAME, aIifName, strlen(aIifName) + 1);
+    AppendAttribute(request.mHeader, sizeof(request), FRA_TABLE, aTable);
+
+    return Request(request.mHeader, aAdd);
+}
+
+otbrError NetlinkRouteSocket::Request(struct nlmsghdr &aRequest, bool aAdd)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    struct sockaddr_nl kernel;
+    int                result = -1;
+
+    SuccessOrExit(error = Open());
+
+    memset(&kernel, 0, sizeof(kernel));
+    kernel.nl_family = AF_NETLINK;
+
+    aRequest.nlmsg_seq = ++mSequence;
+    VerifyOrExit(sendto(mFd, &aRequest, aRequest.nlmsg_len, 0, reinterpret_cast<struct sockaddr *>(&kernel),
+                        sizeof(kernel)) == static_cast<ssize_t>(aRequest.nlmsg_len),
+                 error = OTBR_ERROR_ERRNO);
+
+    // Wait for the acknowledgment of this request, which carries the result of the operation.
+    while (result < 0)
+    {
+        union
+        {
+            struct nlmsghdr mHeader;
+            uint8_t         mBuffer[kMaxReplySize];
+        } reply;
+        ssize_t len = recv(mFd, &reply, sizeof(reply), 0);
+
+        if (len < 0)
+        {
+            VerifyOrExit(errno == EINTR, error = OTBR_ERROR_ERRNO);
+            continue;
+        }
+
+        for (struct nlmsghdr *header = &reply.mHeader; NLMSG_OK(header, len); header = NLMSG_NEXT(header, len))
+        {
+            if (header->nlmsg_seq != mSequence || header->nlmsg_type != NLMSG_ERROR)
+            {
+                continue;
+            }
+
+            VerifyOrExit(header->nlmsg_len >= NLMSG_LENGTH(sizeof(struct nlmsgerr)), errno = EBADMSG,
+                         error = OTBR_ERROR_ERRNO);
+            result = -static_cast<struct nlmsgerr *>(NLMSG_DATA(header))->error;
+            break;
+        }
+    }
+
+    // Adding what exists or deleting what does not exist leaves the kernel in the requested state.
+    if (result != 0 && !(aAdd && result == EEXIST) && !(!aAdd && (result == ESRCH || result == ENOENT)))
+    {
+        errno = result;
+        ExitNow(error = OTBR_ERROR_ERRNO);
+    }
+
+exit:
+    return error;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_ROUTING
@@ -0,0 +1,188 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for programming routes and routing rules over rtnetlink.
+ */
+
+#ifndef BACKBONE_ROUTER_NETLINK_ROUTE_HPP_
+#define BACKBONE_ROUTER_NETLINK_ROUTE_HPP_
+
+#if OTBR_ENABLE_DUA_ROUTING
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+struct nlmsghdr;
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-backbone
+ *
+ * @{
+ */
+
+/**
+ * This class implements a rtnetlink socket for adding and deleting IPv6 routes and routing rules.
+ *
+ * Each operation is acknowledged by the kernel before the method returns, so it costs a round trip
+ * to the kernel instead of spawning `ip`.
+ *
+ */
+class NetlinkRouteSocket
+{
+public:
+    /**
+     * This constructor initializes a rtnetlink socket instance.
+     *
+     */
+    NetlinkRouteSocket(void)
+        : mFd(-1)
+        , mSequence(0)
+    {
+    }
+
+    /**
+     * This destructor closes the rtnetlink socket.
+     *
+     */
+    ~NetlinkRouteSocket(void) { Close(); }
+
+    /**
+     * This method opens the rtnetlink socket if it is not opened yet.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the socket.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the socket, error code in `errno`.
+     *
+     */
+    otbrError Open(void);
+
+    /**
+     * This method closes the rtnetlink socket.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method adds an IPv6 route.
+     *
+     * Adding a route which already exists succeeds.
+     *
+     * @param[in]  aPrefix   The destination prefix.
+     * @param[in]  aIfIndex  The index of the output interface.
+     * @param[in]  aTable    The routing table.
+     * @param[in]  aMetric   The metric of the route, 0 to use the kernel default.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully added the route.
+     * @retval OTBR_ERROR_ERRNO  Failed to add the route, error code in `errno`.
+     *
+     */
+    otbrError AddRoute(const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric)
+    {
+        return UpdateRoute(/* aAdd */ true, aPrefix, aIfIndex, aTable, aMetric);
+    }
+
+    /**
+     * This method deletes an IPv6 route.
+     *
+     * Deleting a route which does not exist succeeds.
+     *
+     * @param[in]  aPrefix   The destination prefix.
+     * @param[in]  aIfIndex  The index of the output interface.
+     * @param[in]  aTable    The routing table.
+     * @param[in]  aMetric   The metric of the route, 0 to use the kernel default.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully deleted the route.
+     * @retval OTBR_ERROR_ERRNO  Failed to delete the route, error code in `errno`.
+     *
+     */
+    otbrError DelRoute(const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric)
+    {
+        return UpdateRoute(/* aAdd */ false, aPrefix, aIfIndex, aTable, aMetric);
+    }
+
+    /**
+     * This method adds an IPv6 routing rule looking up @p aTable for packets received on an interface.
+     *
+     * Adding a rule which already exists succeeds.
+     *
+     * @param[in]  aIifName  The name of the input interface.
+     * @param[in]  aTable    The routing table.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully added the rule.
+     * @retval OTBR_ERROR_ERRNO  Failed to add the rule, error code in `errno`.
+     *
+     */
+    otbrError AddRule(const char *aIifName, uint32_t aTable);
+
+    /**
+     * This method deletes an IPv6 routing rule looking up @p aTable for packets received on an interface.
+     *
+     * Deleting a rule which does not exist succeeds.
+     *
+     * @param[in]  aIifName  The name of the input interface.
+     * @param[in]  aTable    The routing table.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully deleted the rule.
+     * @retval OTBR_ERROR_ERRNO  Failed to delete the rule, error code in `errno`.
+     *
+     */
+    otbrError DelRule(const char *aIifName, uint32_t aTable) { return UpdateRule(/* aAdd */ false, aIifName, aTable); }
+
+private:
+    enum
+    {
+        kMaxRequestSize = 256,  ///< Max size of a rtnetlink request in bytes.
+        kMaxReplySize   = 1024, ///< Max size of a rtnetlink reply in bytes.
+    };
+
+    NetlinkRouteSocket(const NetlinkRouteSocket &) = delete;
+    NetlinkRouteSocket &operator=(const NetlinkRouteSocket &) = delete;
+
+    otbrError UpdateRoute(bool aAdd, const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric);
+    otbrError UpdateRule(bool aAdd, const char *aIifName, uint32_t aTable);
+    otbrError Request(struct nlmsghdr &aRequest, bool aAdd);
+
+    int      mFd;
+    uint32_t mSequence;
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_ROUTING
+
+#endif // BACKBONE_ROUTER_NETLINK_ROUTE_HPP_
@@ -28,68 +28,112 @@
 
 #include "common/dns_utils.hpp"
 
-#include <assert.h>
+#include <string.h>
+
+#include <algorithm>
 
 #include "common/code_utils.hpp"
 
-static bool NameEndsWithDot(const std::string &aName)
+namespace {
+
+constexpr size_t kTransportLength = sizeof("._udp") - 1;
+
+DnsNameRef MakeRef(const char *aName, size_t aBegin, size_t aEnd)
 {
-    return !aName.empty() && aName.back() == '.';
+    DnsNameRef ref;
+
+    ref.mData   = aName + aBegin;
+    ref.mLength = aEnd - aBegin;
+
+    return ref;
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+// Finds the last `aTransport` label in the first `aLength` characters of `aName`, which must be followed by
+// another label or end the name.
+size_t FindLastTransport(const char *aName, size_t aLength, const char *aTransport)
+{
+    size_t pos = std::string::npos;
+
+    for (size_t i = aLength; i >= kTransportLength; i--)
+    {
+        size_t begin = i - kTransportLength;
+
+        if ((i == aLength || aName[i] == '.') && memcmp(aName + begin, aTransport, kTransportLength) == 0)
+        {
+            pos = begin;
+            break;
+        }
+    }
+
+    return pos;
+}
+
+} // namespace
+
+DnsNameParts ParseFullDnsName(const char *aName, size_t aLength)
 {
-    size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+    DnsNameParts parts;
+    size_t       transportPos;
 
-    if (!NameEndsWithDot(fullName))
+    if (aLength > 0 && aName[aLength - 1] == '.')
     {
-        fullName += '.';
+        aLength--;
     }
 
-    transportPos = fullName.rfind("._udp.");
+    transportPos = FindLastTransport(aName, aLength, "._udp");
 
     if (transportPos == std::string::npos)
     {
-        transportPos = fullName.rfind("._tcp.");
+        transportPos = FindLastTransport(aName, aLength, "._tcp");
     }
 
     if (transportPos == std::string::npos)
     {
         // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
-
-        assert(dotPos != std::string::npos);
+        const char *dot    = static_cast<const char *>(memchr(aName, '.', aLength));
+        size_t      dotPos = (dot != nullptr) ? static_cast<size_t>(dot - aName) : aLength;
 
-        // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        parts.mHostName = MakeRef(aName, 0, dotPos);
+        parts.mDomain   = MakeRef(aName, std::min(dotPos + 1, aLength), aLength);
     }
     else
     {
         // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        size_t serviceEnd = transportPos + kTransportLength;
+        size_t dotPos     = transportPos;
+
+        while (dotPos > 0 && aName[dotPos - 1] != '.')
+        {
+            dotPos--;
+        }
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        parts.mDomain = MakeRef(aName, std::min(serviceEnd + 1, aLength), aLength);
 
-        if (dotPos == std::string::npos)
+        if (dotPos == 0)
         {
             // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+            parts.mServiceName = MakeRef(aName, 0, serviceEnd);
         }
         else
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            parts.mInstanceName = MakeRef(aName, 0, dotPos - 1);
+            parts.mServiceName  = MakeRef(aName, dotPos, serviceEnd);
         }
     }
 
-    if (!NameEndsWithDot(nameInfo.mDomain))
-    {
-        nameInfo.mDomain += '.';
-    }
+    return parts;
+}
+
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    DnsNameParts parts = ParseFullDnsName(aName);
+    DnsNameInfo  nameInfo;
+
+    parts.mInstanceName.CopyTo(nameInfo.mInstanceName);
+    parts.mServiceName.CopyTo(nameInfo.mServiceName);
+    parts.mHostName.CopyTo(nameInfo.mHostName);
+    parts.CopyDomainTo(nameInfo.mDomain);
 
     return nameInfo;
 }
@@ -99,14 +143,14 @@ otbrError SplitFullServiceInstanceName(const std::string &aFullName,
                                        std::string &      aType,
                                        std::string &      aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError    error = OTBR_ERROR_NONE;
+    DnsNameParts parts = ParseFullDnsName(aFullName);
 
-    VerifyOrExit(nameInfo.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(parts.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aInstanceName = std::move(nameInfo.mInstanceName);
-    aType         = std::move(nameInfo.mServiceName);
-    aDomain       = std::move(nameInfo.mDomain);
+    parts.mInstanceName.CopyTo(aInstanceName);
+    parts.mServiceName.CopyTo(aType);
+    parts.CopyDomainTo(aDomain);
 
 exit:
     return error;
@@ -114,13 +158,13 @@ exit:
 
 otbrError SplitFullServiceName(const std::string &aFullName, std::string &aType, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError    error = OTBR_ERROR_NONE;
+    DnsNameParts parts = ParseFullDnsName(aFullName);
 
-    VerifyOrExit(nameInfo.IsService(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(parts.IsService(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aType   = std::move(nameInfo.mServiceName);
-    aDomain = std::move(nameInfo.mDomain);
+    parts.mServiceName.CopyTo(aType);
+    parts.CopyDomainTo(aDomain);
 
 exit:
     return error;
@@ -128,13 +172,13 @@ exit:
 
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError    error = OTBR_ERROR_NONE;
+    DnsNameParts parts = ParseFullDnsName(aFullName);
 
-    VerifyOrExit(nameInfo.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(parts.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aHostName = std::move(nameInfo.mHostName);
-    aDomain   = std::move(nameInfo.mDomain);
+    parts.mHostName.CopyTo(aHostName);
+    parts.CopyDomainTo(aDomain);
 
 exit:
     return error;
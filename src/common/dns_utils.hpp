@@ -34,8 +34,123 @@
 #ifndef OTBR_COMMON_DNS_UTILS_HPP_
 #define OTBR_COMMON_DNS_UTILS_HPP_
 
+#include <string.h>
+
 #include "common/types.hpp"
 
+/**
+ * This structure references a part of a DNS name without owning or copying it.
+ *
+ */
+struct DnsNameRef
+{
+    const char *mData   = ""; ///< The first character of the referenced part.
+    size_t      mLength = 0;  ///< The number of characters referenced.
+
+    /**
+     * This method returns if the referenced part is empty.
+     *
+     * @returns Whether the referenced part is empty.
+     *
+     */
+    bool IsEmpty(void) const { return mLength == 0; }
+
+    /**
+     * This method returns if the referenced part equals a given string.
+     *
+     * @param[in] aString  The string to compare with.
+     *
+     * @returns Whether the referenced part equals @p aString.
+     *
+     */
+    bool Equals(const std::string &aString) const
+    {
+        return aString.length() == mLength && aString.compare(0, mLength, mData, mLength) == 0;
+    }
+
+    /**
+     * This method returns if the referenced part equals a given null-terminated string.
+     *
+     * @param[in] aString  The string to compare with.
+     *
+     * @returns Whether the referenced part equals @p aString.
+     *
+     */
+    bool Equals(const char *aString) const
+    {
+        return strlen(aString) == mLength && memcmp(aString, mData, mLength) == 0;
+    }
+
+    /**
+     * This method copies the referenced part into a string, reusing the string's storage.
+     *
+     * @param[out] aString  A reference to the string to receive the referenced part.
+     *
+     */
+    void CopyTo(std::string &aString) const { aString.assign(mData, mLength); }
+
+    /**
+     * This method returns a copy of the referenced part.
+     *
+     * @returns The referenced part as a string.
+     *
+     */
+    std::string ToString(void) const { return std::string(mData, mLength); }
+};
+
+/**
+ * This structure represents the components of a DNS name, referencing the name being parsed.
+ *
+ * Unlike `DnsNameInfo`, the domain excludes the trailing dot and the components remain valid only as long as the
+ * parsed name does.
+ *
+ * @sa ParseFullDnsName
+ *
+ */
+struct DnsNameParts
+{
+    DnsNameRef mInstanceName; ///< Instance name, or empty if the DNS name is not a service instance.
+    DnsNameRef mServiceName;  ///< Service name, or empty if the DNS name is not a service or service instance.
+    DnsNameRef mHostName;     ///< Host name, or empty if the DNS name is not a host name.
+    DnsNameRef mDomain;       ///< Domain name, without the trailing dot.
+
+    /**
+     * This method returns if the DNS name is a service instance.
+     *
+     * @returns Whether the DNS name is a service instance.
+     *
+     */
+    bool IsServiceInstance(void) const { return !mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a service.
+     *
+     * @returns Whether the DNS name is a service.
+     *
+     */
+    bool IsService(void) const { return !mServiceName.IsEmpty() && mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a host.
+     *
+     * @returns Whether the DNS name is a host.
+     *
+     */
+    bool IsHost(void) const { return mServiceName.IsEmpty(); }
+
+    /**
+     * This method copies the domain into a string, reusing the string's storage and adding the trailing dot.
+     *
+     * @param[out] aDomain  A reference to the string to receive the domain.
+     *
+     */
+    void CopyDomainTo(std::string &aDomain) const
+    {
+        mDomain.CopyTo(aDomain);
+        aDomain += '.';
+    }
+};
+
 /**
  * This structure represents DNS Name information.
  *
@@ -74,6 +189,45 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This function parses a full DNS name into name components without allocating memory.
+ *
+ * The name may be given with or without the trailing dot.
+ *
+ * @param[in] aName    The full DNS name to parse.
+ * @param[in] aLength  The length of @p aName.
+ *
+ * @returns  A `DnsNameParts` structure referencing the components of @p aName.
+ *
+ */
+DnsNameParts ParseFullDnsName(const char *aName, size_t aLength);
+
+/**
+ * This function parses a null-terminated full DNS name into name components without allocating memory.
+ *
+ * @param[in] aName  The full DNS name to parse.
+ *
+ * @returns  A `DnsNameParts` structure referencing the components of @p aName.
+ *
+ */
+inline DnsNameParts ParseFullDnsName(const char *aName)
+{
+    return ParseFullDnsName(aName, strlen(aName));
+}
+
+/**
+ * This function parses a full DNS name into name components without allocating memory.
+ *
+ * @param[in] aName  The full DNS name to parse.
+ *
+ * @returns  A `DnsNameParts` structure referencing the components of @p aName.
+ *
+ */
+inline DnsNameParts ParseFullDnsName(const std::string &aName)
+{
+    return ParseFullDnsName(aName.data(), aName.length());
+}
+
 /**
  * This method splits a full DNS name into name components.
  *
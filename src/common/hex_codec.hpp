@@ -0,0 +1,91 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines a table-driven hex codec.
+ */
+
+#ifndef OTBR_COMMON_HEX_CODEC_HPP_
+#define OTBR_COMMON_HEX_CODEC_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace otbr {
+
+/**
+ * This class implements encoding bytes to hex digits and decoding hex digits with lookup tables.
+ *
+ * A byte is encoded with a single lookup of its two digits, and a digit is decoded with a single lookup of its value.
+ *
+ */
+class HexCodec
+{
+public:
+    /**
+     * This method encodes bytes to hex digits, two digits per byte and without a null terminator.
+     *
+     * @param[in]  aBytes      A pointer to the bytes.
+     * @param[in]  aLength     The number of bytes.
+     * @param[out] aHex        A pointer to the output buffer, which must hold at least `2 * aLength` chars.
+     * @param[in]  aLowerCase  Whether to encode with lower case digits.
+     *
+     */
+    static void Encode(const uint8_t *aBytes, size_t aLength, char *aHex, bool aLowerCase = false)
+    {
+        const char *pairs = aLowerCase ? kLowerCasePairs : kUpperCasePairs;
+
+        for (size_t i = 0; i < aLength; ++i)
+        {
+            memcpy(aHex + 2 * i, pairs + 2 * aBytes[i], 2);
+        }
+    }
+
+    /**
+     * This method decodes a hex digit.
+     *
+     * @param[in]  aHex  The hex digit, in upper or lower case.
+     *
+     * @returns  The value of the digit, or -1 if @p aHex is not a hex digit.
+     *
+     */
+    static int DecodeDigit(char aHex) { return kDigitValues[static_cast<uint8_t>(aHex)]; }
+
+private:
+    static const char   kUpperCasePairs[];
+    static const char   kLowerCasePairs[];
+    static const int8_t kDigitValues[];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_HEX_CODEC_HPP_
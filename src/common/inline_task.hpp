@@ -0,0 +1,265 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a move-only task which keeps small callables inline.
+ */
+
+#ifndef OTBR_COMMON_INLINE_TASK_HPP_
+#define OTBR_COMMON_INLINE_TASK_HPP_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <assert.h>
+
+namespace otbr {
+
+/**
+ * This class implements a move-only task, i.e. a callable taking no arguments and returning nothing.
+ *
+ * Unlike `std::function`, the task never copies its callable and keeps callables of up to `kCapacity` bytes in an
+ * inline buffer, so creating, moving and executing such a task never allocates. Callables may be move-only, e.g.
+ * capture a `std::unique_ptr`. Larger callables are still accepted but allocated on the heap.
+ *
+ */
+class InlineTask
+{
+public:
+    /**
+     * The size (in bytes) of the inline buffer.
+     *
+     */
+    static constexpr size_t kCapacity = 64;
+
+    /**
+     * This constructor initializes an empty task.
+     *
+     */
+    InlineTask(void)
+        : mInvoke(nullptr)
+        , mManage(nullptr)
+    {
+    }
+
+    /**
+     * This constructor initializes an empty task.
+     *
+     */
+    InlineTask(std::nullptr_t)
+        : InlineTask()
+    {
+    }
+
+    /**
+     * This constructor initializes a task with a callable.
+     *
+     * @param[in]  aCallable  The callable to be executed, which is moved into the task when it is an rvalue.
+     *
+     */
+    template <typename Callable,
+              typename Type = typename std::decay<Callable>::type,
+              typename      = typename std::enable_if<!std::is_same<Type, InlineTask>::value &&
+                                                 !std::is_same<Type, std::nullptr_t>::value>::type>
+    InlineTask(Callable &&aCallable)
+        : InlineTask()
+    {
+        Emplace<Type>(std::forward<Callable>(aCallable), std::integral_constant<bool, IsInline<Type>()>());
+    }
+
+    /**
+     * The move constructor of the task, which leaves @p aOther empty.
+     *
+     * @param[in]  aOther  The task to be moved from.
+     *
+     */
+    InlineTask(InlineTask &&aOther)
+        : InlineTask()
+    {
+        MoveFrom(aOther);
+    }
+
+    /**
+     * The move assignment operator of the task, which leaves @p aOther empty.
+     *
+     * @param[in]  aOther  The task to be moved from.
+     *
+     */
+    InlineTask &operator=(InlineTask &&aOther)
+    {
+        if (this != &aOther)
+        {
+            Reset();
+            MoveFrom(aOther);
+        }
+
+        return *this;
+    }
+
+    /**
+     * This assignment operator empties the task.
+     *
+     */
+    InlineTask &operator=(std::nullptr_t)
+    {
+        Reset();
+
+        return *this;
+    }
+
+    InlineTask(const InlineTask &) = delete;
+    InlineTask &operator=(const InlineTask &) = delete;
+
+    /**
+     * The destructor destroys the callable of the task.
+     *
+     */
+    ~InlineTask(void) { Reset(); }
+
+    /**
+     * This method indicates whether the task has a callable.
+     *
+     * @returns  Whether the task has a callable.
+     *
+     */
+    explicit operator bool(void) const { return mInvoke != nullptr; }
+
+    /**
+     * This method executes the task, which must not be empty.
+     *
+     */
+    void operator()(void)
+    {
+        assert(mInvoke != nullptr);
+        mInvoke(mStorage);
+    }
+
+    /**
+     * This method indicates whether a callable type is kept in the inline buffer, i.e. without allocation.
+     *
+     * @returns  Whether the callable type is kept inline.
+     *
+     */
+    template <typename Callable> static constexpr bool IsInline(void)
+    {
+        // The callable is moved between buffers, which must not throw.
+        return sizeof(Callable) <= kCapacity && alignof(Storage) % alignof(Callable) == 0 &&
+               std::is_nothrow_move_constructible<Callable>::value;
+    }
+
+private:
+    using Storage = typename std::aligned_storage<kCapacity, alignof(std::max_align_t)>::type;
+
+    // Moves the callable of `aFrom` to `aTo`, or destroys it when `aTo` is nullptr.
+    using Manager = void (*)(Storage &aFrom, Storage *aTo);
+
+    template <typename Callable> static void InvokeInline(Storage &aStorage)
+    {
+        (*reinterpret_cast<Callable *>(&aStorage))();
+    }
+
+    template <typename Callable> static void ManageInline(Storage &aFrom, Storage *aTo)
+    {
+        Callable *from = reinterpret_cast<Callable *>(&aFrom);
+
+        if (aTo != nullptr)
+        {
+            new (aTo) Callable(std::move(*from));
+        }
+
+        from->~Callable();
+    }
+
+    template <typename Callable> static void InvokeHeap(Storage &aStorage)
+    {
+        (**reinterpret_cast<Callable **>(&aStorage))();
+    }
+
+    template <typename Callable> static void ManageHeap(Storage &aFrom, Storage *aTo)
+    {
+        Callable **from = reinterpret_cast<Callable **>(&aFrom);
+
+        if (aTo != nullptr)
+        {
+            new (aTo) Callable *(*from);
+        }
+        else
+        {
+            delete *from;
+        }
+    }
+
+    template <typename Callable, typename Arg> void Emplace(Arg &&aCallable, std::true_type)
+    {
+        new (&mStorage) Callable(std::forward<Arg>(aCallable));
+        mInvoke = &InvokeInline<Callable>;
+        mManage = &ManageInline<Callable>;
+    }
+
+    template <typename Callable, typename Arg> void Emplace(Arg &&aCallable, std::false_type)
+    {
+        new (&mStorage) Callable *(new Callable(std::forward<Arg>(aCallable)));
+        mInvoke = &InvokeHeap<Callable>;
+        mManage = &ManageHeap<Callable>;
+    }
+
+    void MoveFrom(InlineTask &aOther)
+    {
+        if (aOther.mManage != nullptr)
+        {
+            aOther.mManage(aOther.mStorage, &mStorage);
+        }
+
+        mInvoke        = aOther.mInvoke;
+        mManage        = aOther.mManage;
+        aOther.mInvoke = nullptr;
+        aOther.mManage = nullptr;
+    }
+
+    void Reset(void)
+    {
+        if (mManage != nullptr)
+        {
+            mManage(mStorage, nullptr);
+        }
+
+        mInvoke = nullptr;
+        mManage = nullptr;
+    }
+
+    void (*mInvoke)(Storage &aStorage);
+    Manager mManage;
+    Storage mStorage;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_INLINE_TASK_HPP_
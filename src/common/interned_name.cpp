@@ -0,0 +1,174 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements interning the host and service names shared across the agent tables.
+ */
+
+#include "common/interned_name.hpp"
+
+#include <assert.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+// The empty name is shared by all empty names and never released, so empty names need no pool lookup.
+static const std::shared_ptr<const std::string> &GetEmptyString(void)
+{
+    static const std::shared_ptr<const std::string> sEmptyString = std::make_shared<const std::string>();
+
+    return sEmptyString;
+}
+
+InternedName::InternedName(void)
+    : mString(GetEmptyString())
+{
+}
+
+InternedName::InternedName(const std::string &aName)
+    : InternedName(NamePool::Get().Intern(aName))
+{
+}
+
+InternedName::InternedName(const char *aName)
+    : InternedName(NamePool::Get().Intern(aName))
+{
+    assert(aName != nullptr);
+}
+
+NamePool::NamePool(void)
+    : mMemory("otbr_interned_names",
+              "Distinct host and service names interned by the agent.",
+              "otbr_interned_names_memory_bytes",
+              "Estimated memory of the interned host and service names.",
+              [this](size_t &aNumEntries, size_t &aNumBytes) { EstimateMemory(aNumEntries, aNumBytes); })
+{
+}
+
+NamePool &NamePool::Get(void)
+{
+    static NamePool sPool;
+
+    return sPool;
+}
+
+InternedName NamePool::Intern(const std::string &aName)
+{
+    std::shared_ptr<const std::string> string;
+
+    VerifyOrExit(!aName.empty(), string = GetEmptyString());
+
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+        auto                        it = mNames.find(&aName);
+
+        if (it != mNames.end())
+        {
+            string = it->second.lock();
+            VerifyOrExit(string == nullptr);
+
+            // The last name referring to the string is being destroyed, and `Release()` is waiting for the lock.
+            mNames.erase(it);
+        }
+
+        string = std::shared_ptr<const std::string>(new std::string(aName),
+                                                    [this](const std::string *aString) { Release(aString); });
+        mNames.emplace(string.get(), string);
+    }
+
+exit:
+    return InternedName(std::move(string));
+}
+
+bool NamePool::Find(const std::string &aName, InternedName &aInterned)
+{
+    std::shared_ptr<const std::string> string;
+    bool                               found = true;
+
+    if (aName.empty())
+    {
+        string = GetEmptyString();
+    }
+    else
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+        auto                        it = mNames.find(&aName);
+
+        if (it != mNames.end())
+        {
+            string = it->second.lock();
+        }
+    }
+
+    VerifyOrExit(string != nullptr, found = false);
+    aInterned = InternedName(std::move(string));
+
+exit:
+    return found;
+}
+
+size_t NamePool::GetSize(void)
+{
+    std::lock_guard<std::mutex> _(mMutex);
+
+    return mNames.size();
+}
+
+void NamePool::Release(const std::string *aString)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+        auto                        it = mNames.find(aString);
+
+        // The string may have been replaced by `Intern()` since its last reference was dropped.
+        if (it != mNames.end() && it->first == aString)
+        {
+            mNames.erase(it);
+        }
+    }
+
+    delete aString;
+}
+
+void NamePool::EstimateMemory(size_t &aNumEntries, size_t &aNumBytes)
+{
+    std::lock_guard<std::mutex> _(mMutex);
+
+    aNumEntries = mNames.size();
+    aNumBytes   = MemoryUsage::GetHashTableSize(mNames);
+
+    for (const auto &name : mNames)
+    {
+        // The string and the control block of its shared pointer.
+        aNumBytes += sizeof(std::string) + MemoryUsage::GetHeapSize(*name.first) + 4 * sizeof(void *);
+    }
+}
+
+} // namespace otbr
@@ -0,0 +1,320 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for interning the host and service names shared across the agent tables.
+ */
+
+#ifndef OTBR_COMMON_INTERNED_NAME_HPP_
+#define OTBR_COMMON_INTERNED_NAME_HPP_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+
+#include "common/code_utils.hpp"
+#include "common/memory_usage.hpp"
+
+namespace otbr {
+
+/**
+ * This class represents a name shared with all equal names interned in the `NamePool`.
+ *
+ * Equal interned names share one string, so copying a name costs a reference count increment, and interned names
+ * compare by pointer. The string is released when the last name referring to it is destroyed.
+ *
+ * Interned names must not outlive the name pool, i.e. they must not be held by objects of static storage duration.
+ *
+ */
+class InternedName
+{
+public:
+    /**
+     * This constructor initializes an empty name.
+     *
+     */
+    InternedName(void);
+
+    /**
+     * This constructor interns a name.
+     *
+     * @param[in]  aName  The name.
+     *
+     */
+    InternedName(const std::string &aName);
+
+    /**
+     * This constructor interns a name.
+     *
+     * @param[in]  aName  The name, must not be nullptr.
+     *
+     */
+    InternedName(const char *aName);
+
+    /**
+     * This method returns the string of the name.
+     *
+     * @returns  The string, which is valid as long as this name refers to it.
+     *
+     */
+    const std::string &GetString(void) const { return *mString; }
+
+    /**
+     * This method returns the string of the name.
+     *
+     * @returns  The string, which is valid as long as this name refers to it.
+     *
+     */
+    operator const std::string &(void) const { return *mString; }
+
+    /**
+     * This method returns the name as a C string.
+     *
+     * @returns  The C string, which is valid as long as this name refers to it.
+     *
+     */
+    const char *c_str(void) const { return mString->c_str(); }
+
+    /**
+     * This method indicates whether the name is empty.
+     *
+     * @returns  Whether the name is empty.
+     *
+     */
+    bool empty(void) const { return mString->empty(); }
+
+    /**
+     * This method returns the length of the name.
+     *
+     * @returns  The length of the name.
+     *
+     */
+    size_t size(void) const { return mString->size(); }
+
+    /**
+     * This method compares two interned names by pointer.
+     *
+     * @param[in]  aOther  The other name.
+     *
+     * @returns  Whether the names are equal.
+     *
+     */
+    bool operator==(const InternedName &aOther) const { return mString == aOther.mString; }
+
+    /**
+     * This method compares two interned names by pointer.
+     *
+     * @param[in]  aOther  The other name.
+     *
+     * @returns  Whether the names are different.
+     *
+     */
+    bool operator!=(const InternedName &aOther) const { return mString != aOther.mString; }
+
+    /**
+     * This method compares the name with a string.
+     *
+     * @param[in]  aOther  The string.
+     *
+     * @returns  Whether the name equals the string.
+     *
+     */
+    bool operator==(const std::string &aOther) const { return *mString == aOther; }
+
+    /**
+     * This method compares the name with a string.
+     *
+     * @param[in]  aOther  The string.
+     *
+     * @returns  Whether the name differs from the string.
+     *
+     */
+    bool operator!=(const std::string &aOther) const { return *mString != aOther; }
+
+    /**
+     * This method compares the name with a C string.
+     *
+     * @param[in]  aOther  The C string, must not be nullptr.
+     *
+     * @returns  Whether the name equals the C string.
+     *
+     */
+    bool operator==(const char *aOther) const { return *mString == aOther; }
+
+    /**
+     * This method compares the name with a C string.
+     *
+     * @param[in]  aOther  The C string, must not be nullptr.
+     *
+     * @returns  Whether the name differs from the C string.
+     *
+     */
+    bool operator!=(const char *aOther) const { return *mString != aOther; }
+
+    /**
+     * This method orders interned names by their strings.
+     *
+     * @param[in]  aOther  The other name.
+     *
+     * @returns  Whether this name sorts before @p aOther.
+     *
+     */
+    bool operator<(const InternedName &aOther) const { return mString != aOther.mString && *mString < *aOther.mString; }
+
+    /**
+     * This method returns the hash of the name, which is computed from its pointer.
+     *
+     * @returns  The hash of the name.
+     *
+     */
+    size_t GetHash(void) const { return std::hash<const std::string *>()(mString.get()); }
+
+private:
+    friend class NamePool;
+
+    explicit InternedName(std::shared_ptr<const std::string> aString)
+        : mString(std::move(aString))
+    {
+    }
+
+    std::shared_ptr<const std::string> mString;
+};
+
+/**
+ * This class implements the pool of the interned names.
+ *
+ * The pool reports the number of distinct names and their memory as metrics. It's safe to intern and release names
+ * in different threads concurrently.
+ *
+ */
+class NamePool
+{
+public:
+    /**
+     * This method returns the name pool of the process.
+     *
+     * @returns  The name pool.
+     *
+     */
+    static NamePool &Get(void);
+
+    /**
+     * This method interns a name.
+     *
+     * @param[in]  aName  The name.
+     *
+     * @returns  The interned name, which shares its string with all equal interned names.
+     *
+     */
+    InternedName Intern(const std::string &aName);
+
+    /**
+     * This method finds an interned name without interning it.
+     *
+     * A name which is not interned can't be in any table of interned names, so lookups may find the name first and
+     * then compare by pointer.
+     *
+     * @param[in]   aName       The name.
+     * @param[out]  aInterned   The interned name if found.
+     *
+     * @returns  Whether the name is interned.
+     *
+     */
+    bool Find(const std::string &aName, InternedName &aInterned);
+
+    /**
+     * This method returns the number of distinct interned names.
+     *
+     * @returns  The number of distinct interned names.
+     *
+     */
+    size_t GetSize(void);
+
+    NamePool(const NamePool &) = delete;
+    NamePool &operator=(const NamePool &) = delete;
+
+private:
+    struct StringPtrHash
+    {
+        size_t operator()(const std::string *aString) const { return std::hash<std::string>()(*aString); }
+    };
+
+    struct StringPtrEqual
+    {
+        bool operator()(const std::string *aLhs, const std::string *aRhs) const { return *aLhs == *aRhs; }
+    };
+
+    // Keyed by the interned string itself, so the string isn't stored twice.
+    using NameTable =
+        std::unordered_map<const std::string *, std::weak_ptr<const std::string>, StringPtrHash, StringPtrEqual>;
+
+    NamePool(void);
+
+    void Release(const std::string *aString);
+    void EstimateMemory(size_t &aNumEntries, size_t &aNumBytes);
+
+    std::mutex     mMutex;
+    NameTable      mNames;
+    MemoryReporter mMemory;
+};
+
+/**
+ * This structure implements the hash of interned names for unordered containers.
+ *
+ */
+struct InternedNameHash
+{
+    size_t operator()(const InternedName &aName) const { return aName.GetHash(); }
+};
+
+namespace MemoryUsage {
+
+/**
+ * This function estimates the heap memory used by an interned name.
+ *
+ * @param[in]  aName  The interned name.
+ *
+ * @returns  0, the strings are shared and counted by the name pool.
+ *
+ */
+inline size_t GetHeapSize(const InternedName &aName)
+{
+    OTBR_UNUSED_VARIABLE(aName);
+
+    return 0;
+}
+
+} // namespace MemoryUsage
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_INTERNED_NAME_HPP_
@@ -0,0 +1,368 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the io_uring queue for socket I/O of the mainloop.
+ */
+
+#define OTBR_LOG_TAG "URING"
+
+#include "common/io_uring.hpp"
+
+#include <algorithm>
+
+#include <poll.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <liburing.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+
+namespace otbr {
+
+struct IoUring::Operation
+{
+    Handler              mHandler;     // Cleared when the operation is cancelled.
+    int                  mBufferIndex; // The registered buffer of a read, or -1.
+    std::vector<uint8_t> mHeapBuffer;  // The buffer of a read when no registered buffer is free.
+    struct iovec         mIov[kMaxIovCount];
+};
+
+// The user data of the poll linked in front of an operation, the operation itself has the untagged pointer.
+static constexpr uintptr_t kPollTag = 1;
+
+static void *GetPollData(IoUring::Operation *aOperation)
+{
+    return reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(aOperation) | kPollTag);
+}
+
+static bool IsSupported(struct io_uring &aRing)
+{
+    static const int kOpcodes[] = {IORING_OP_READ, IORING_OP_READ_FIXED, IORING_OP_WRITEV, IORING_OP_POLL_ADD,
+                                   IORING_OP_ASYNC_CANCEL};
+    bool             supported  = true;
+    io_uring_probe * probe      = io_uring_get_probe_ring(&aRing);
+
+    VerifyOrExit(probe != nullptr, supported = false);
+
+    for (int opcode : kOpcodes)
+    {
+        supported = supported && io_uring_opcode_supported(probe, opcode);
+    }
+
+    io_uring_free_probe(probe);
+
+exit:
+    return supported;
+}
+
+IoUring::IoUring(void)
+    : mRing(new struct io_uring)
+    , mNumQueued(0)
+{
+    int          rval;
+    struct iovec iov[kNumBuffers];
+
+    memset(mRing.get(), 0, sizeof(*mRing));
+
+    if ((rval = io_uring_queue_init(kQueueDepth, mRing.get(), 0)) != 0)
+    {
+        otbrLogNotice("io_uring is unavailable: %s, using non-blocking system calls", strerror(-rval));
+        mRing.reset();
+        ExitNow();
+    }
+
+    if (!IsSupported(*mRing))
+    {
+        otbrLogNotice("io_uring lacks required operations, using non-blocking system calls");
+        io_uring_queue_exit(mRing.get());
+        mRing.reset();
+        ExitNow();
+    }
+
+    mBuffers.resize(kNumBuffers * kBufferSize);
+
+    for (size_t i = 0; i < kNumBuffers; ++i)
+    {
+        iov[i].iov_base = GetBuffer(static_cast<int>(i));
+        iov[i].iov_len  = kBufferSize;
+    }
+
+    // Registering may fail for the locked memory limit, reads then go to heap buffers.
+    if ((rval = io_uring_register_buffers(mRing.get(), iov, kNumBuffers)) == 0)
+    {
+        for (size_t i = kNumBuffers; i > 0; --i)
+        {
+            mFreeBuffers.push_back(static_cast<int>(i - 1));
+        }
+    }
+    else
+    {
+        otbrLogWarning("Failed to register io_uring buffers: %s", strerror(-rval));
+        mBuffers.clear();
+        mBuffers.shrink_to_fit();
+    }
+
+    MainloopManager::GetInstance().RegisterFd(mRing->ring_fd, MainloopManager::kEventReadable,
+                                              [this](uint8_t) { HandleCompletions(); });
+
+exit:
+    return;
+}
+
+IoUring::~IoUring(void)
+{
+    VerifyOrExit(IsAvailable());
+
+    MainloopManager::GetInstance().UnregisterFd(mRing->ring_fd);
+    io_uring_queue_exit(mRing.get());
+    mRing.reset();
+
+exit:
+    return;
+}
+
+struct io_uring_sqe *IoUring::GetSqe(void)
+{
+    struct io_uring_sqe *sqe = io_uring_get_sqe(mRing.get());
+
+    if (sqe == nullptr)
+    {
+        // The submission queue is full, make room for more.
+        Submit();
+        sqe = io_uring_get_sqe(mRing.get());
+    }
+
+    if (sqe != nullptr)
+    {
+        ++mNumQueued;
+    }
+
+    return sqe;
+}
+
+struct io_uring_sqe *IoUring::GetPolledSqe(int aFd, unsigned aPollMask, Operation *aOperation)
+{
+    struct io_uring_sqe *poll;
+    struct io_uring_sqe *sqe = nullptr;
+
+    // The poll and the operation must be submitted together to stay linked.
+    if (io_uring_sq_space_left(mRing.get()) < 2)
+    {
+        Submit();
+    }
+
+    VerifyOrExit((poll = GetSqe()) != nullptr);
+
+    if ((sqe = GetSqe()) == nullptr)
+    {
+        io_uring_prep_nop(poll);
+        io_uring_sqe_set_data(poll, nullptr);
+        ExitNow();
+    }
+
+    // Sockets are non-blocking for the readiness fallback, and io_uring honors that by completing an operation which
+    // would block with -EAGAIN right away. Waiting for readiness first keeps an idle connection from spinning.
+    io_uring_prep_poll_add(poll, aFd, aPollMask);
+    io_uring_sqe_set_data(poll, GetPollData(aOperation));
+    io_uring_sqe_set_flags(poll, IOSQE_IO_LINK);
+
+exit:
+    return sqe;
+}
+
+IoUring::Operation *IoUring::Read(int aFd, size_t aLength, Handler aHandler)
+{
+    Operation *          operation = nullptr;
+    struct io_uring_sqe *sqe;
+
+    VerifyOrExit(IsAvailable() && aLength > 0);
+
+    operation = new Operation;
+
+    if ((sqe = GetPolledSqe(aFd, POLLIN, operation)) == nullptr)
+    {
+        delete operation;
+        ExitNow(operation = nullptr);
+    }
+
+    operation->mHandler     = std::move(aHandler);
+    operation->mBufferIndex = -1;
+
+    if (aLength <= kBufferSize && !mFreeBuffers.empty())
+    {
+        operation->mBufferIndex = mFreeBuffers.back();
+        mFreeBuffers.pop_back();
+        io_uring_prep_read_fixed(sqe, aFd, GetBuffer(operation->mBufferIndex), static_cast<unsigned>(aLength), 0,
+                                 operation->mBufferIndex);
+    }
+    else
+    {
+        operation->mHeapBuffer.resize(aLength);
+        io_uring_prep_read(sqe, aFd, operation->mHeapBuffer.data(), static_cast<unsigned>(aLength), 0);
+    }
+
+    io_uring_sqe_set_data(sqe, operation);
+
+exit:
+    return operation;
+}
+
+IoUring::Operation *IoUring::Writev(int aFd, const struct iovec *aIov, int aIovCount, Handler aHandler)
+{
+    Operation *          operation = nullptr;
+    struct io_uring_sqe *sqe;
+
+    VerifyOrExit(IsAvailable() && aIovCount > 0 && aIovCount <= kMaxIovCount);
+
+    operation = new Operation;
+
+    if ((sqe = GetPolledSqe(aFd, POLLOUT, operation)) == nullptr)
+    {
+        delete operation;
+        ExitNow(operation = nullptr);
+    }
+
+    operation->mHandler     = std::move(aHandler);
+    operation->mBufferIndex = -1;
+    memcpy(operation->mIov, aIov, sizeof(*aIov) * static_cast<size_t>(aIovCount));
+
+    io_uring_prep_writev(sqe, aFd, operation->mIov, static_cast<unsigned>(aIovCount), 0);
+    io_uring_sqe_set_data(sqe, operation);
+
+exit:
+    return operation;
+}
+
+void IoUring::Cancel(Operation *aOperation)
+{
+    struct io_uring_sqe *sqe;
+
+    VerifyOrExit(aOperation != nullptr);
+
+    // The operation is released when its own completion arrives, be it cancelled or not.
+    aOperation->mHandler = nullptr;
+
+    // An operation waiting for its poll is only cancelled through the poll, which fails the linked operation.
+    if ((sqe = GetSqe()) != nullptr)
+    {
+        io_uring_prep_cancel(sqe, GetPollData(aOperation), 0);
+        io_uring_sqe_set_data(sqe, nullptr);
+    }
+
+    if ((sqe = GetSqe()) != nullptr)
+    {
+        io_uring_prep_cancel(sqe, aOperation, 0);
+        io_uring_sqe_set_data(sqe, nullptr);
+    }
+
+    // Submit now so that the operation is bound to its file before the file descriptor is closed and reused.
+    Submit();
+
+exit:
+    return;
+}
+
+void IoUring::Submit(void)
+{
+    int rval;
+
+    VerifyOrExit(IsAvailable() && mNumQueued > 0);
+
+    rval = io_uring_submit(mRing.get());
+
+    if (rval >= 0)
+    {
+        mNumQueued -= std::min(mNumQueued, static_cast<unsigned>(rval));
+    }
+    else
+    {
+        // The queued operations are kept in the ring and submitted again next time.
+        otbrLogWarning("Failed to submit io_uring operations: %s", strerror(-rval));
+    }
+
+exit:
+    return;
+}
+
+void IoUring::HandleCompletions(void)
+{
+    struct io_uring_cqe *cqe;
+
+    while (io_uring_peek_cqe(mRing.get(), &cqe) == 0)
+    {
+        void *     data      = io_uring_cqe_get_data(cqe);
+        Operation *operation = static_cast<Operation *>(data);
+        int        result    = cqe->res;
+
+        io_uring_cqe_seen(mRing.get(), cqe);
+
+        // Cancellations carry no operation, and an operation completes after its poll.
+        if (operation == nullptr || (reinterpret_cast<uintptr_t>(data) & kPollTag) != 0)
+        {
+            continue;
+        }
+
+        if (operation->mHandler != nullptr)
+        {
+            // Call a copy so that the handler may queue or cancel other operations.
+            Handler  handler = std::move(operation->mHandler);
+            uint8_t *data    = nullptr;
+
+            if (operation->mBufferIndex >= 0)
+            {
+                data = GetBuffer(operation->mBufferIndex);
+            }
+            else if (!operation->mHeapBuffer.empty())
+            {
+                data = operation->mHeapBuffer.data();
+            }
+
+            operation->mHandler = nullptr;
+            handler(result, data);
+        }
+
+        Release(operation);
+    }
+}
+
+void IoUring::Release(Operation *aOperation)
+{
+    if (aOperation->mBufferIndex >= 0)
+    {
+        mFreeBuffers.push_back(aOperation->mBufferIndex);
+    }
+
+    delete aOperation;
+}
+
+} // namespace otbr
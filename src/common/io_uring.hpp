@@ -0,0 +1,178 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the io_uring queue for socket I/O of the mainloop.
+ */
+
+#ifndef OTBR_COMMON_IO_URING_HPP_
+#define OTBR_COMMON_IO_URING_HPP_
+
+#include <openthread-br/config.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+struct io_uring;
+struct io_uring_sqe;
+
+namespace otbr {
+
+/**
+ * This class implements a queue of socket reads and writes completed by the kernel through io_uring.
+ *
+ * Operations are queued while the mainloop processes events and are all submitted by a single system call right
+ * before the mainloop waits, see `MainloopManager::Poll()`. Their completions are handled as the events of one file
+ * descriptor registered to the mainloop, so the ring works along with either mainloop backend.
+ *
+ * Reads go to a pool of buffers registered to the kernel once, so the kernel doesn't map the pages of every read.
+ * Each read and write is linked behind a poll of its file descriptor, so it waits for the socket to become ready
+ * rather than failing with -EAGAIN on the non-blocking sockets.
+ *
+ * The queue is unavailable when the kernel lacks io_uring or any of the operations used, in which case the
+ * components must fall back to non-blocking system calls after readiness events, see `IsAvailable()`.
+ *
+ */
+class IoUring
+{
+public:
+    struct Operation;
+
+    /**
+     * This function is called when an operation is completed.
+     *
+     * @param[in]  aResult  The result of the operation, the number of bytes transferred or a negative `errno`.
+     * @param[in]  aData    The received data of a read, only valid during the call, or nullptr for a write.
+     *
+     */
+    using Handler = std::function<void(int aResult, const uint8_t *aData)>;
+
+    /**
+     * This method returns the singleton instance of the io_uring queue.
+     *
+     * @returns  A reference to the io_uring queue.
+     *
+     */
+    static IoUring &Get(void)
+    {
+        static IoUring sIoUring;
+
+        return sIoUring;
+    }
+
+    /**
+     * This destructor tears down the ring.
+     *
+     */
+    ~IoUring(void);
+
+    /**
+     * This method indicates whether io_uring is supported by the kernel.
+     *
+     * @returns  Whether operations can be queued.
+     *
+     */
+    bool IsAvailable(void) const { return mRing != nullptr; }
+
+    /**
+     * This method queues a read.
+     *
+     * @param[in]  aFd       The file descriptor.
+     * @param[in]  aLength   The max number of bytes to read.
+     * @param[in]  aHandler  The handler called with the received data.
+     *
+     * @returns  The queued operation, or nullptr if it could not be queued.
+     *
+     */
+    Operation *Read(int aFd, size_t aLength, Handler aHandler);
+
+    /**
+     * This method queues a vectored write.
+     *
+     * The io vectors are copied, the data they point to must stay valid until the operation is completed or
+     * cancelled.
+     *
+     * @param[in]  aFd        The file descriptor.
+     * @param[in]  aIov       The io vectors to be written.
+     * @param[in]  aIovCount  The number of io vectors, at most `kMaxIovCount`.
+     * @param[in]  aHandler   The handler called with the number of bytes written.
+     *
+     * @returns  The queued operation, or nullptr if it could not be queued.
+     *
+     */
+    Operation *Writev(int aFd, const struct iovec *aIov, int aIovCount, Handler aHandler);
+
+    /**
+     * This method cancels an operation.
+     *
+     * The handler of @p aOperation is never called afterwards. The cancellation is submitted right away, so the file
+     * descriptor of the operation may be closed once this method returns.
+     *
+     * @param[in]  aOperation  The operation, may be nullptr.
+     *
+     */
+    void Cancel(Operation *aOperation);
+
+    /**
+     * This method submits all queued operations to the kernel.
+     *
+     * This is a no-op if no operation has been queued since the last submission.
+     *
+     */
+    void Submit(void);
+
+    static constexpr int kMaxIovCount = 4; ///< The max number of io vectors of a write.
+
+private:
+    static constexpr unsigned kQueueDepth = 512;
+    static constexpr size_t   kNumBuffers = 64;
+    static constexpr size_t   kBufferSize = 2048;
+
+    IoUring(void);
+
+    struct io_uring_sqe *GetSqe(void);
+    struct io_uring_sqe *GetPolledSqe(int aFd, unsigned aPollMask, Operation *aOperation);
+    void                 HandleCompletions(void);
+    void                 Release(Operation *aOperation);
+    uint8_t *            GetBuffer(int aIndex) { return &mBuffers[static_cast<size_t>(aIndex) * kBufferSize]; }
+
+    std::unique_ptr<struct io_uring> mRing;
+    unsigned                         mNumQueued;
+    std::vector<uint8_t>             mBuffers;
+    std::vector<int>                 mFreeBuffers;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_IO_URING_HPP_
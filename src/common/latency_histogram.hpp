@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions of a latency histogram.
+ */
+
+#ifndef OTBR_COMMON_LATENCY_HISTOGRAM_HPP_
+#define OTBR_COMMON_LATENCY_HISTOGRAM_HPP_
+
+#include <openthread-br/config.h>
+
+#include <algorithm>
+#include <array>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a histogram of latencies with exponentially growing buckets.
+ *
+ * Bucket 0 counts the latencies shorter than 1 microsecond, bucket `i` counts the latencies in
+ * [2^(i-1), 2^i) microseconds, and the last bucket counts all the longer latencies. Recording a
+ * sample is a few arithmetic operations, so that it can be done in every mainloop iteration.
+ *
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr size_t kNumBuckets = 24; ///< The number of buckets, the last one starts at about 4 seconds.
+
+    /**
+     * This constructor initializes an empty histogram.
+     *
+     */
+    LatencyHistogram(void) { Reset(); }
+
+    /**
+     * This method records a sample.
+     *
+     * @param[in]  aLatency  The latency to record.
+     *
+     */
+    void Record(Microseconds aLatency)
+    {
+        uint64_t latency = static_cast<uint64_t>(std::max(aLatency.count(), static_cast<Microseconds::rep>(0)));
+        size_t   bucket  = (latency == 0) ? 0 : static_cast<size_t>(64 - __builtin_clzll(latency));
+
+        ++mBuckets[std::min(bucket, kNumBuckets - 1)];
+        ++mCount;
+        mTotal += latency;
+        mMax = std::max(mMax, latency);
+    }
+
+    /**
+     * This method clears all samples.
+     *
+     */
+    void Reset(void)
+    {
+        mBuckets.fill(0);
+        mCount = 0;
+        mTotal = 0;
+        mMax   = 0;
+    }
+
+    /**
+     * This method returns the number of samples.
+     *
+     * @returns  The number of samples.
+     *
+     */
+    uint64_t GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the sum of all samples.
+     *
+     * @returns  The total latency.
+     *
+     */
+    Microseconds GetTotal(void) const { return Microseconds(mTotal); }
+
+    /**
+     * This method returns the longest sample.
+     *
+     * @returns  The maximum latency.
+     *
+     */
+    Microseconds GetMax(void) const { return Microseconds(mMax); }
+
+    /**
+     * This method returns the number of samples in a bucket.
+     *
+     * @param[in]  aIndex  The index of the bucket, must be less than `kNumBuckets`.
+     *
+     * @returns  The number of samples in the bucket.
+     *
+     */
+    uint64_t GetBucketCount(size_t aIndex) const { return mBuckets[aIndex]; }
+
+    /**
+     * This method returns the exclusive upper bound of a bucket.
+     *
+     * @param[in]  aIndex  The index of the bucket, must be less than `kNumBuckets - 1`.
+     *
+     * @returns  The upper bound of the bucket.
+     *
+     */
+    static Microseconds GetBucketUpperBound(size_t aIndex) { return Microseconds(static_cast<uint64_t>(1) << aIndex); }
+
+private:
+    std::array<uint64_t, kNumBuckets> mBuckets;
+    uint64_t                          mCount;
+    uint64_t                          mTotal;
+    uint64_t                          mMax;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_LATENCY_HISTOGRAM_HPP_
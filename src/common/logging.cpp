@@ -32,21 +32,130 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <syslog.h>
-
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "common/code_utils.hpp"
+#include "common/hex_codec.hpp"
+#include "common/mpsc_ring_buffer.hpp"
+#include "common/thread_schedule.hpp"
 #include "common/time.hpp"
 
-static otbrLogLevel sLevel            = OTBR_LOG_INFO;
-static const char   sLevelString[][8] = {
+namespace otbr {
+namespace {
+
+/**
+ * This class writes log messages to syslog in a background thread.
+ *
+ */
+class AsyncLogger
+{
+public:
+    explicit AsyncLogger(otbrLogOverflowPolicy aPolicy);
+    ~AsyncLogger(void);
+
+    void   Log(otbrLogLevel aLevel, const char *aFormat, va_list aArgs);
+    void   Flush(void);
+    size_t GetQueuedCount(void) const { return mRecords.GetSize(); }
+
+private:
+    // The formatted message, plus the level and tag prefix.
+    static constexpr size_t kMessageSize = 1024 + 32;
+    static constexpr size_t kCapacity    = 128;
+    // The number of queued messages from which info and debug messages are dropped with
+    // `OTBR_LOG_OVERFLOW_DROP_VERBOSE`, so that the rest of the ring buffer is left to more severe messages.
+    static constexpr size_t kVerboseLimit = kCapacity * 3 / 4;
+    // A producer may miss waking up the drain thread, which then wakes up by itself after this interval.
+    static constexpr Milliseconds kMaxDrainDelay = Milliseconds(10);
+
+    struct Record
+    {
+        otbrLogLevel mLevel;
+        char         mMessage[kMessageSize];
+    };
+
+    void Run(void);
+    void Drain(void);
+
+    otbrLogOverflowPolicy             mPolicy;
+    MpscRingBuffer<Record, kCapacity> mRecords;
+    std::atomic<bool>                 mSleeping;
+    std::atomic<bool>                 mStopping;
+    uint64_t                          mReportedDroppedCount;
+    std::mutex                        mMutex;
+    std::condition_variable           mCondition;
+    bool                              mFlushing; // Protected by `mMutex`.
+    std::condition_variable           mFlushed;
+    std::thread                       mThread;
+};
+
+/**
+ * This class writes log messages to a file through a large buffer, and rotates the file by size.
+ *
+ */
+class FileLogSink
+{
+public:
+    FileLogSink(const char *aIdent, bool aPrintStderr);
+    ~FileLogSink(void);
+
+    otbrError Open(const char *aPath, size_t aMaxFileSize);
+    void      Write(otbrLogLevel aLevel, const char *aMessage);
+    void      FlushIfDue(void);
+    void      FlushNow(void);
+    size_t    GetMemorySize(void) const { return sizeof(*this) + mBuffer.capacity(); }
+
+private:
+    static_assert(OTBR_LOG_FILE_BUFFER_SIZE >= 4096, "OTBR_LOG_FILE_BUFFER_SIZE must hold a few messages");
+
+    void Flush(void);
+    void Rotate(void);
+
+    std::mutex        mMutex;
+    std::string       mIdent;
+    bool              mPrintStderr;
+    int               mPid;
+    std::string       mPath;
+    size_t            mMaxFileSize;
+    int               mFd;
+    size_t            mFileSize;
+    std::vector<char> mBuffer;
+    size_t            mLength;
+    Timepoint         mFirstBufferedTime; // The time the oldest message in the buffer was written.
+    time_t            mTimestampSecond;   // The second of the cached timestamp.
+    char              mTimestamp[sizeof("YYYY-MM-DD HH:MM:SS")];
+};
+
+} // namespace
+} // namespace otbr
+
+static otbrLogLevel                       sLevel            = OTBR_LOG_INFO;
+static std::unique_ptr<otbr::AsyncLogger> sAsyncLogger      = nullptr;
+static std::unique_ptr<otbr::FileLogSink> sFileLogSink      = nullptr;
+static std::atomic<uint64_t>              sDroppedCount     = {0};
+static const char *                       sIdent            = "";
+static bool                               sPrintStderr      = false;
+static const char                         sLevelString[][8] = {
     "[EMERG]", "[ALERT]", "[CRIT]", "[ERR ]", "[WARN]", "[NOTE]", "[INFO]", "[DEBG]",
 };
 
@@ -63,17 +172,103 @@ void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr)
     assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
 
     openlog(aIdent, (LOG_CONS | LOG_PID) | (aPrintStderr ? LOG_PERROR : 0), LOG_USER);
-    sLevel = aLevel;
+    sIdent       = aIdent;
+    sPrintStderr = aPrintStderr;
+    sLevel       = aLevel > OTBR_COMPILE_LOG_LEVEL ? static_cast<otbrLogLevel>(OTBR_COMPILE_LOG_LEVEL) : aLevel;
+    sDroppedCount.store(0, std::memory_order_relaxed);
+}
+
+void otbrLogEnableAsync(otbrLogOverflowPolicy aPolicy)
+{
+    if (sAsyncLogger == nullptr)
+    {
+        sAsyncLogger = std::unique_ptr<otbr::AsyncLogger>(new otbr::AsyncLogger(aPolicy));
+    }
+}
+
+otbrError otbrLogEnableFile(const char *aPath, size_t aMaxFileSize)
+{
+    otbrError                          error = OTBR_ERROR_NONE;
+    std::unique_ptr<otbr::FileLogSink> sink(new otbr::FileLogSink(sIdent, sPrintStderr));
+
+    assert(aPath != nullptr && sAsyncLogger == nullptr);
+
+    SuccessOrExit(error = sink->Open(aPath, aMaxFileSize));
+    sFileLogSink = std::move(sink);
+
+exit:
+    return error;
+}
+
+uint64_t otbrLogGetDroppedCount(void)
+{
+    return sDroppedCount.load(std::memory_order_relaxed);
+}
+
+void otbrLogGetBufferUsage(size_t *aNumRecords, size_t *aNumBytes)
+{
+    assert(aNumRecords != nullptr && aNumBytes != nullptr);
+
+    *aNumRecords = (sAsyncLogger != nullptr) ? sAsyncLogger->GetQueuedCount() : 0;
+    *aNumBytes   = (sAsyncLogger != nullptr) ? sizeof(otbr::AsyncLogger) : 0;
+
+    if (sFileLogSink != nullptr)
+    {
+        *aNumBytes += sFileLogSink->GetMemorySize();
+    }
+}
+
+// Writes a formatted message to the log file or syslog.
+static void WriteMessage(otbrLogLevel aLevel, const char *aMessage)
+{
+    if (sFileLogSink != nullptr)
+    {
+        sFileLogSink->Write(aLevel, aMessage);
+    }
+    else
+    {
+        syslog(static_cast<int>(aLevel), "%s", aMessage);
+    }
+}
+
+static void WriteLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgs)
+{
+    if (sAsyncLogger != nullptr)
+    {
+        sAsyncLogger->Log(aLevel, aFormat, aArgs);
+    }
+    else if (sFileLogSink != nullptr)
+    {
+        char message[1024 + 32];
+
+        vsnprintf(message, sizeof(message), aFormat, aArgs);
+        sFileLogSink->Write(aLevel, message);
+    }
+    else
+    {
+        vsyslog(static_cast<int>(aLevel), aFormat, aArgs);
+    }
+}
+
+static void WriteLog(otbrLogLevel aLevel, const char *aFormat, ...)
+{
+    va_list ap;
+
+    va_start(ap, aFormat);
+    WriteLogv(aLevel, aFormat, ap);
+    va_end(ap);
 }
 
 static const char *GetPrefix(const char *aLogTag)
 {
-    // Log prefix format : -xxx-----
-    const uint8_t kMaxTagSize = 7;
-    const uint8_t kBufferSize = kMaxTagSize + 3;
-    static char   prefix[kBufferSize];
-    uint8_t       tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
-    int           index     = 0;
+    // Log prefix format : -xxx-----, a tag of up to `kMaxTagSize` characters padded with '-' to `kPrefixLength`.
+    const uint8_t kMaxTagSize   = 7;
+    const uint8_t kPrefixLength = kMaxTagSize + 2;
+    const uint8_t kBufferSize   = kPrefixLength + 1;
+    // Messages may be logged from several threads.
+    static thread_local char prefix[kBufferSize];
+    uint8_t                  tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
+    int                      index     = 0;
 
     if (strlen(aLogTag) > 0)
     {
@@ -82,11 +277,11 @@ static const char *GetPrefix(const char *aLogTag)
 
         index = tagLength + 1;
 
-        memset(&prefix[index], '-', kMaxTagSize - tagLength + 1);
-        index += kMaxTagSize - tagLength + 1;
+        memset(&prefix[index], '-', kPrefixLength - index);
+        index = kPrefixLength;
     }
 
-    prefix[index++] = '\0';
+    prefix[index] = '\0';
 
     return prefix;
 }
@@ -102,7 +297,7 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 
     if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
     {
-        syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+        WriteLog(aLevel, "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
     }
 
     va_end(ap);
@@ -117,16 +312,14 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list ap)
 
     if (aLevel <= sLevel)
     {
-        vsyslog(static_cast<int>(aLevel), aFormat, ap);
+        WriteLogv(aLevel, aFormat, ap);
     }
 }
 
 /** Hex dump data to the log */
 void otbrDump(otbrLogLevel aLevel, const char *aPrefix, const void *aMemory, size_t aSize)
 {
-    static const char kHexChars[] = "0123456789abcdef";
     assert(aPrefix && (aMemory || aSize == 0));
-    const uint8_t *pEnd;
     const uint8_t *p8;
     int            addr;
 
@@ -158,17 +351,14 @@ void otbrDump(otbrLogLevel aLevel, const char *aPrefix, const void *aMemory, siz
         }
         aSize = aSize - this_size;
 
-        char *ch = hex - 1;
-
-        for (pEnd = p8 + this_size; p8 < pEnd; p8++)
+        for (size_t i = 0; i < this_size; i++)
         {
-            *++ch = kHexChars[(*p8) >> 4];
-            *++ch = kHexChars[(*p8) & 0x0f];
-            *++ch = ' ';
+            otbr::HexCodec::Encode(&p8[i], 1, &hex[3 * i], /* aLowerCase */ true);
+            hex[3 * i + 2] = ' ';
         }
-        *ch = 0;
+        hex[3 * this_size - 1] = '\0';
 
-        syslog(static_cast<int>(aLevel), "%s: %04x: %s", aPrefix, addr, hex);
+        WriteLog(aLevel, "%s: %04x: %s", aPrefix, addr, hex);
     }
 }
 
@@ -214,6 +404,14 @@ const char *otbrErrorString(otbrError aError)
         error = "Invalid arguments";
         break;
 
+    case OTBR_ERROR_TIMEOUT:
+        error = "Timeout";
+        break;
+
+    case OTBR_ERROR_BUSY:
+        error = "Busy";
+        break;
+
     default:
         error = "Unknown";
     }
@@ -221,7 +419,367 @@ const char *otbrErrorString(otbrError aError)
     return error;
 }
 
+void otbrLogFlush(void)
+{
+    if (sAsyncLogger != nullptr)
+    {
+        sAsyncLogger->Flush();
+    }
+
+    if (sFileLogSink != nullptr)
+    {
+        sFileLogSink->FlushNow();
+    }
+}
+
 void otbrLogDeinit(void)
 {
+    // Writes the queued messages before closing the log file and syslog.
+    sAsyncLogger.reset();
+    sFileLogSink.reset();
     closelog();
 }
+
+namespace otbr {
+namespace {
+
+constexpr Milliseconds AsyncLogger::kMaxDrainDelay;
+
+AsyncLogger::AsyncLogger(otbrLogOverflowPolicy aPolicy)
+    : mPolicy(aPolicy)
+    , mSleeping(false)
+    , mStopping(false)
+    , mReportedDroppedCount(sDroppedCount.load(std::memory_order_relaxed))
+    , mFlushing(false)
+    , mThread(&AsyncLogger::Run, this)
+{
+}
+
+AsyncLogger::~AsyncLogger(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+    }
+
+    mCondition.notify_one();
+    mThread.join();
+}
+
+void AsyncLogger::Log(otbrLogLevel aLevel, const char *aFormat, va_list aArgs)
+{
+    Record record;
+
+    if (mPolicy == OTBR_LOG_OVERFLOW_DROP_VERBOSE && aLevel >= OTBR_LOG_INFO && mRecords.GetSize() >= kVerboseLimit)
+    {
+        ExitNow(sDroppedCount.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    record.mLevel = aLevel;
+    vsnprintf(record.mMessage, sizeof(record.mMessage), aFormat, aArgs);
+
+    VerifyOrExit(mRecords.TryPush(record), sDroppedCount.fetch_add(1, std::memory_order_relaxed));
+
+    if (mSleeping.load())
+    {
+        mCondition.notify_one();
+    }
+
+exit:
+    return;
+}
+
+void AsyncLogger::Run(void)
+{
+    // Failures are not logged, the records would be queued to this very thread.
+    OTBR_UNUSED_VARIABLE(ApplyHousekeepingSchedule());
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (!mStopping)
+    {
+        // The records queued before a flush was requested are all written by the drain below.
+        bool flushing = mFlushing;
+
+        lock.unlock();
+        Drain();
+        lock.lock();
+
+        if (flushing)
+        {
+            mFlushing = false;
+            mFlushed.notify_all();
+        }
+
+        mSleeping = true;
+
+        if (mRecords.GetSize() == 0 && !mStopping && !mFlushing)
+        {
+            mCondition.wait_for(lock, kMaxDrainDelay);
+        }
+
+        mSleeping = false;
+    }
+
+    // No thread logs anymore, see `otbrLogDeinit()`.
+    lock.unlock();
+    Drain();
+    lock.lock();
+
+    mFlushing = false;
+    mFlushed.notify_all();
+}
+
+void AsyncLogger::Flush(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    mFlushing = true;
+    mCondition.notify_one();
+    mFlushed.wait(lock, [this]() { return !mFlushing; });
+}
+
+void AsyncLogger::Drain(void)
+{
+    Record   record;
+    uint64_t droppedCount;
+
+    while (mRecords.TryPop(record))
+    {
+        WriteMessage(record.mLevel, record.mMessage);
+    }
+
+    droppedCount = sDroppedCount.load(std::memory_order_relaxed);
+
+    if (droppedCount != mReportedDroppedCount)
+    {
+        snprintf(record.mMessage, sizeof(record.mMessage), "%s%s: %" PRIu64 " log messages were dropped",
+                 sLevelString[OTBR_LOG_WARNING], GetPrefix(OTBR_LOG_TAG), droppedCount - mReportedDroppedCount);
+        WriteMessage(OTBR_LOG_WARNING, record.mMessage);
+        mReportedDroppedCount = droppedCount;
+    }
+
+    if (sFileLogSink != nullptr)
+    {
+        sFileLogSink->FlushIfDue();
+    }
+}
+
+FileLogSink::FileLogSink(const char *aIdent, bool aPrintStderr)
+    : mIdent(aIdent)
+    , mPrintStderr(aPrintStderr)
+    , mPid(static_cast<int>(getpid()))
+    , mMaxFileSize(0)
+    , mFd(-1)
+    , mFileSize(0)
+    , mBuffer(OTBR_LOG_FILE_BUFFER_SIZE)
+    , mLength(0)
+    , mTimestampSecond(0)
+{
+    mTimestamp[0] = '\0';
+}
+
+FileLogSink::~FileLogSink(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Flush();
+
+    if (mFd != -1)
+    {
+        close(mFd);
+    }
+}
+
+otbrError FileLogSink::Open(const char *aPath, size_t aMaxFileSize)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    struct stat st;
+
+    mPath        = aPath;
+    mMaxFileSize = aMaxFileSize;
+    mFd          = open(aPath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    VerifyOrExit(mFd != -1, error = OTBR_ERROR_ERRNO);
+
+    mFileSize = (fstat(mFd, &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+
+exit:
+    return error;
+}
+
+void FileLogSink::Write(otbrLogLevel aLevel, const char *aMessage)
+{
+    struct timeval now;
+    char           prefix[sizeof(mTimestamp) + 64];
+    int            prefixLength;
+    size_t         messageLength = strlen(aMessage);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    gettimeofday(&now, nullptr);
+
+    // Formatting the local time is costly, and most messages are logged within the same second as the previous one.
+    if (now.tv_sec != mTimestampSecond || mTimestamp[0] == '\0')
+    {
+        struct tm local;
+
+        localtime_r(&now.tv_sec, &local);
+        strftime(mTimestamp, sizeof(mTimestamp), "%Y-%m-%d %H:%M:%S", &local);
+        mTimestampSecond = now.tv_sec;
+    }
+
+    prefixLength  = snprintf(prefix, sizeof(prefix), "%s.%03ld %s[%d]: ", mTimestamp,
+                             static_cast<long>(now.tv_usec / 1000), mIdent.c_str(), mPid);
+    prefixLength  = std::min(std::max(prefixLength, 0), static_cast<int>(sizeof(prefix) - 1));
+    messageLength = std::min(messageLength, mBuffer.size() / 2);
+
+    if (mPrintStderr)
+    {
+        fprintf(stderr, "%s%.*s\n", prefix, static_cast<int>(messageLength), aMessage);
+    }
+
+    if (mLength + static_cast<size_t>(prefixLength) + messageLength + 1 > mBuffer.size())
+    {
+        Flush();
+    }
+
+    if (mLength == 0)
+    {
+        mFirstBufferedTime = Clock::now();
+    }
+
+    memcpy(&mBuffer[mLength], prefix, static_cast<size_t>(prefixLength));
+    mLength += static_cast<size_t>(prefixLength);
+    memcpy(&mBuffer[mLength], aMessage, messageLength);
+    mLength += messageLength;
+    mBuffer[mLength++] = '\n';
+
+    // Severe messages are written right away, they are likely followed by a crash.
+    if (aLevel <= OTBR_LOG_ERR || Clock::now() - mFirstBufferedTime >= Milliseconds(OTBR_LOG_FILE_FLUSH_INTERVAL))
+    {
+        Flush();
+    }
+}
+
+void FileLogSink::FlushIfDue(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mLength > 0 && Clock::now() - mFirstBufferedTime >= Milliseconds(OTBR_LOG_FILE_FLUSH_INTERVAL))
+    {
+        Flush();
+    }
+}
+
+void FileLogSink::FlushNow(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Flush();
+}
+
+void FileLogSink::Flush(void)
+{
+    size_t written = 0;
+
+    VerifyOrExit(mLength > 0 && mFd != -1);
+
+    if (mMaxFileSize > 0 && mFileSize > 0 && mFileSize + mLength > mMaxFileSize)
+    {
+        Rotate();
+        VerifyOrExit(mFd != -1);
+    }
+
+    while (written < mLength)
+    {
+        ssize_t rval = write(mFd, &mBuffer[written], mLength - written);
+
+        if (rval < 0)
+        {
+            // Messages are dropped rather than blocking logging when the file system is full or failing.
+            VerifyOrExit(errno == EINTR);
+            continue;
+        }
+
+        written += static_cast<size_t>(rval);
+    }
+
+exit:
+    mFileSize += written;
+    mLength = 0;
+}
+
+void FileLogSink::Rotate(void)
+{
+    int flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC;
+
+    close(mFd);
+
+    for (int i = OTBR_LOG_FILE_ROTATIONS; i > 1; --i)
+    {
+        OTBR_UNUSED_VARIABLE(
+            rename((mPath + "." + std::to_string(i - 1)).c_str(), (mPath + "." + std::to_string(i)).c_str()));
+    }
+
+    if (OTBR_LOG_FILE_ROTATIONS > 0)
+    {
+        OTBR_UNUSED_VARIABLE(rename(mPath.c_str(), (mPath + ".1").c_str()));
+    }
+    else
+    {
+        flags |= O_TRUNC;
+    }
+
+    mFd       = open(mPath.c_str(), flags, 0644);
+    mFileSize = 0;
+}
+
+} // namespace
+} // namespace otbr
+
+namespace otbr {
+
+bool LogRateLimiter::Allow(uint32_t &aSuppressedCount, Timepoint aNow)
+{
+    int64_t now     = std::chrono::duration_cast<Milliseconds>(aNow.time_since_epoch()).count();
+    bool    allowed = false;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mRefillTime == 0)
+    {
+        mRefillTime = now;
+    }
+    else if (now - mRefillTime >= OTBR_LOG_RATE_LIMIT_INTERVAL)
+    {
+        int64_t refilled = (now - mRefillTime) / OTBR_LOG_RATE_LIMIT_INTERVAL;
+
+        if (refilled >= OTBR_LOG_RATE_LIMIT_BURST - mTokens)
+        {
+            mTokens     = OTBR_LOG_RATE_LIMIT_BURST;
+            mRefillTime = now;
+        }
+        else
+        {
+            mTokens += static_cast<uint32_t>(refilled);
+            mRefillTime += refilled * OTBR_LOG_RATE_LIMIT_INTERVAL;
+        }
+    }
+
+    if (mTokens > 0)
+    {
+        --mTokens;
+        aSuppressedCount = mSuppressedCount;
+        mSuppressedCount = 0;
+        allowed          = true;
+    }
+    else
+    {
+        ++mSuppressedCount;
+    }
+
+    return allowed;
+}
+
+} // namespace otbr
@@ -35,13 +35,17 @@
 
 #include "openthread-br/config.h"
 
+#include <mutex>
+
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifndef OTBR_LOG_TAG
 #error "OTBR_LOG_TAG is not defined"
 #endif
 
+#include "common/time.hpp"
 #include "common/types.hpp"
 
 /**
@@ -60,6 +64,78 @@ typedef enum
     OTBR_LOG_DEBUG,   /* debug-level messages */
 } otbrLogLevel;
 
+/**
+ * @def OTBR_COMPILE_LOG_LEVEL
+ *
+ * The most verbose log level compiled in. The log macros of more verbose levels compile to nothing, and the runtime
+ * log level is capped to this level.
+ *
+ */
+#ifndef OTBR_COMPILE_LOG_LEVEL
+#define OTBR_COMPILE_LOG_LEVEL OTBR_LOG_DEBUG
+#endif
+
+/**
+ * @def OTBR_LOG_RATE_LIMIT_BURST
+ *
+ * The number of messages a rate-limited call site may log in a burst.
+ *
+ */
+#ifndef OTBR_LOG_RATE_LIMIT_BURST
+#define OTBR_LOG_RATE_LIMIT_BURST 10
+#endif
+
+/**
+ * @def OTBR_LOG_RATE_LIMIT_INTERVAL
+ *
+ * The interval (in milliseconds) after which a rate-limited call site may log one more message.
+ *
+ */
+#ifndef OTBR_LOG_RATE_LIMIT_INTERVAL
+#define OTBR_LOG_RATE_LIMIT_INTERVAL 100
+#endif
+
+/**
+ * @def OTBR_LOG_FILE_BUFFER_SIZE
+ *
+ * The size (in bytes) of the buffer of the log file, which is written to the file when full.
+ *
+ */
+#ifndef OTBR_LOG_FILE_BUFFER_SIZE
+#define OTBR_LOG_FILE_BUFFER_SIZE 65536
+#endif
+
+/**
+ * @def OTBR_LOG_FILE_FLUSH_INTERVAL
+ *
+ * The max time (in milliseconds) a message waits in the buffer of the log file.
+ *
+ */
+#ifndef OTBR_LOG_FILE_FLUSH_INTERVAL
+#define OTBR_LOG_FILE_FLUSH_INTERVAL 5000
+#endif
+
+/**
+ * @def OTBR_LOG_FILE_ROTATIONS
+ *
+ * The number of rotated log files kept, named `<path>.1` (the newest) to `<path>.<N>`. With zero, the log file is
+ * truncated instead of rotated.
+ *
+ */
+#ifndef OTBR_LOG_FILE_ROTATIONS
+#define OTBR_LOG_FILE_ROTATIONS 2
+#endif
+
+/**
+ * The policies of the asynchronous logging backend when its ring buffer is full or almost full.
+ *
+ */
+typedef enum
+{
+    OTBR_LOG_OVERFLOW_DROP_NEWEST,  /* drop new messages while the ring buffer is full */
+    OTBR_LOG_OVERFLOW_DROP_VERBOSE, /* also drop info and debug messages while the ring buffer is almost full */
+} otbrLogOverflowPolicy;
+
 /**
  * Get current log level
  */
@@ -83,6 +159,61 @@ void otbrLogEnableSyslog(bool aEnabled);
  */
 void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr);
 
+/**
+ * This function makes logging asynchronous.
+ *
+ * Messages are formatted on the calling thread and queued in a lock-free ring buffer, then written to syslog or the
+ * log file by a background thread, so that logging never blocks on the syslog socket or the file system. Messages
+ * which don't fit in the ring buffer are dropped according to @p aPolicy and counted, see `otbrLogGetDroppedCount()`.
+ * Logging is synchronous until this function is called, and becomes synchronous again in `otbrLogDeinit()` once the
+ * queued messages are written.
+ *
+ * This function must be called after `otbrLogInit()` and before other threads start logging.
+ *
+ * @param[in]   aPolicy     The policy of dropping messages on overflow.
+ *
+ */
+void otbrLogEnableAsync(otbrLogOverflowPolicy aPolicy);
+
+/**
+ * This function writes logs to a file instead of syslog.
+ *
+ * Messages are appended to a buffer of `OTBR_LOG_FILE_BUFFER_SIZE` bytes, which is written to the file when it is
+ * full, when a message of level error or more severe is logged, and once its oldest message has waited for
+ * `OTBR_LOG_FILE_FLUSH_INTERVAL`. The interval is checked by the background thread of the asynchronous logging
+ * backend, or only when a message is logged otherwise. Before the file grows larger than @p aMaxFileSize, it is
+ * rotated, see `OTBR_LOG_FILE_ROTATIONS`. Messages are still copied to stderr if requested in `otbrLogInit()`. The
+ * buffer is written to the file in `otbrLogDeinit()`, which closes the file.
+ *
+ * This function must be called after `otbrLogInit()` and before `otbrLogEnableAsync()` or other threads start logging.
+ *
+ * @param[in]   aPath           The path of the log file, appended to if it exists.
+ * @param[in]   aMaxFileSize    The max size (in bytes) of the log file, 0 to never rotate it.
+ *
+ * @returns OTBR_ERROR_NONE if the log file is opened, or OTBR_ERROR_ERRNO and logs are kept in syslog.
+ *
+ */
+otbrError otbrLogEnableFile(const char *aPath, size_t aMaxFileSize);
+
+/**
+ * This function returns the number of messages dropped by the asynchronous logging backend.
+ *
+ * @returns The number of dropped messages since the logging service was initialized.
+ *
+ */
+uint64_t otbrLogGetDroppedCount(void);
+
+/**
+ * This function returns the usage of the ring buffer of the asynchronous logging backend.
+ *
+ * The ring buffer and the log file buffer are preallocated, so their memory is in use as long as they are enabled.
+ *
+ * @param[out]  aNumRecords     The number of queued messages, 0 if logging is synchronous.
+ * @param[out]  aNumBytes       The memory of the asynchronous logging backend and the log file buffer.
+ *
+ */
+void otbrLogGetBufferUsage(size_t *aNumRecords, size_t *aNumBytes);
+
 /**
  * This function log at level @p aLevel.
  *
@@ -123,9 +254,19 @@ void otbrDump(otbrLogLevel aLevel, const char *aPrefix, const void *aMemory, siz
  */
 const char *otbrErrorString(otbrError aError);
 
+/**
+ * This function writes the queued messages and the buffered messages of the log file.
+ *
+ * Unlike `otbrLogDeinit()`, this function may be called while other threads are still logging.
+ *
+ */
+void otbrLogFlush(void);
+
 /**
  * This function deinitializes the logging service.
  *
+ * No other thread may log while or after this function is called, see `otbrLogFlush()` otherwise.
+ *
  */
 void otbrLogDeinit(void);
 
@@ -140,14 +281,31 @@ void otbrLogDeinit(void);
  * @param[in]   ...       Arguments for the format specification.
  *
  */
-#define otbrLogResult(aError, aFormat, ...)                                                               \
-    do                                                                                                    \
-    {                                                                                                     \
-        otbrError _err = (aError);                                                                        \
-        otbrLog(_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG, aFormat ": %s", \
-                ##__VA_ARGS__, otbrErrorString(_err));                                                    \
+#define otbrLogResult(aError, aFormat, ...)                                                 \
+    do                                                                                      \
+    {                                                                                       \
+        otbrError    _err   = (aError);                                                     \
+        otbrLogLevel _level = (_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING); \
+        otbrLogIfEnabled(_level, aFormat ": %s", ##__VA_ARGS__, otbrErrorString(_err));     \
     } while (0)
 
+/**
+ * @def otbrLogIfEnabled
+ *
+ * Log at the given level. The arguments are only evaluated if the level is enabled, so that
+ * formatting them costs nothing on the hot paths while verbose logging is off. With a constant
+ * @p aLevel more verbose than `OTBR_COMPILE_LOG_LEVEL`, the whole call is compiled out, while the
+ * arguments are still type-checked.
+ *
+ * @param[in] aLevel  The log level.
+ * @param[in] ...     Arguments for the format specification.
+ *
+ */
+#define otbrLogIfEnabled(aLevel, ...)                                      \
+    (((aLevel) <= OTBR_COMPILE_LOG_LEVEL && (aLevel) <= otbrLogGetLevel()) \
+         ? otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__)                    \
+         : static_cast<void>(0))
+
 /**
  * @def otbrLogEmerg
  *
@@ -219,13 +377,133 @@ void otbrLogDeinit(void);
  * @param[in] ...  Arguments for the format specification.
  *
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+#define otbrLogEmerg(...) otbrLogIfEnabled(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogIfEnabled(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogIfEnabled(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogIfEnabled(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogIfEnabled(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogIfEnabled(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogIfEnabled(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogIfEnabled(OTBR_LOG_DEBUG, __VA_ARGS__)
+
+namespace otbr {
+
+/**
+ * This class implements the token bucket of a rate-limited log call site.
+ *
+ * Every call site of the rate-limited log macros has its own token bucket, which holds up to
+ * `OTBR_LOG_RATE_LIMIT_BURST` tokens and regains one every `OTBR_LOG_RATE_LIMIT_INTERVAL` milliseconds.
+ *
+ */
+class LogRateLimiter
+{
+public:
+    /**
+     * This constructor initializes a full token bucket.
+     *
+     */
+    constexpr LogRateLimiter(void)
+        : mTokens(OTBR_LOG_RATE_LIMIT_BURST)
+        , mSuppressedCount(0)
+        , mRefillTime(0)
+    {
+    }
+
+    /**
+     * This method takes a token to log a message.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[out]  aSuppressedCount  The number of messages suppressed since the last allowed one, only set when
+     *                                the message is allowed.
+     *
+     * @retval  TRUE   The message should be logged.
+     * @retval  FALSE  The message should be suppressed.
+     *
+     */
+    bool Allow(uint32_t &aSuppressedCount) { return Allow(aSuppressedCount, Clock::now()); }
+
+    /**
+     * This method takes a token to log a message at a given time.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[out]  aSuppressedCount  The number of messages suppressed since the last allowed one, only set when
+     *                                the message is allowed.
+     * @param[in]   aNow              The current time.
+     *
+     * @retval  TRUE   The message should be logged.
+     * @retval  FALSE  The message should be suppressed.
+     *
+     */
+    bool Allow(uint32_t &aSuppressedCount, Timepoint aNow);
+
+private:
+    std::mutex mMutex;
+    uint32_t   mTokens;
+    uint32_t   mSuppressedCount;
+    int64_t    mRefillTime; // The time (in milliseconds of the steady clock) the tokens were last refilled.
+};
+
+} // namespace otbr
+
+/**
+ * @def otbrLogRateLimited
+ *
+ * Log at the given level, unless the call site has logged too many messages recently, see `otbr::LogRateLimiter`.
+ *
+ * Suppressed messages are counted, and the count is logged right before the next message the call site is allowed
+ * to log. The arguments are only evaluated if the message is logged.
+ *
+ * @param[in] aLevel  The log level.
+ * @param[in] ...     Arguments for the format specification.
+ *
+ */
+#define otbrLogRateLimited(aLevel, ...)                                                                         \
+    do                                                                                                          \
+    {                                                                                                           \
+        static otbr::LogRateLimiter _limiter;                                                                   \
+        uint32_t                    _suppressed;                                                                \
+                                                                                                                \
+        if ((aLevel) <= OTBR_COMPILE_LOG_LEVEL && (aLevel) <= otbrLogGetLevel() && _limiter.Allow(_suppressed)) \
+        {                                                                                                       \
+            if (_suppressed > 0)                                                                                \
+            {                                                                                                   \
+                otbrLog((aLevel), OTBR_LOG_TAG, "%u similar messages were suppressed", _suppressed);            \
+            }                                                                                                   \
+                                                                                                                \
+            otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__);                                                       \
+        }                                                                                                       \
+    } while (0)
+
+/**
+ * @def otbrLogWarningRateLimited
+ *
+ * Log at level warning with rate limiting, see `otbrLogRateLimited`.
+ *
+ * @param[in] ...  Arguments for the format specification.
+ *
+ */
+
+/**
+ * @def otbrLogInfoRateLimited
+ *
+ * Log at level information with rate limiting, see `otbrLogRateLimited`.
+ *
+ * @param[in] ...  Arguments for the format specification.
+ *
+ */
+
+/**
+ * @def otbrLogDebugRateLimited
+ *
+ * Log at level debug with rate limiting, see `otbrLogRateLimited`.
+ *
+ * @param[in] ...  Arguments for the format specification.
+ *
+ */
+#define otbrLogWarningRateLimited(...) otbrLogRateLimited(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogInfoRateLimited(...) otbrLogRateLimited(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebugRateLimited(...) otbrLogRateLimited(OTBR_LOG_DEBUG, __VA_ARGS__)
 
 #endif // OTBR_COMMON_LOGGING_HPP_
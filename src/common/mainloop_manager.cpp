@@ -0,0 +1,678 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the mainloop manager.
+ */
+
+#define OTBR_LOG_TAG "MAINLOOP"
+
+#include "common/mainloop_manager.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#if OTBR_ENABLE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#include "common/code_utils.hpp"
+#if OTBR_ENABLE_IO_URING
+#include "common/io_uring.hpp"
+#endif
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "common/trace.hpp"
+
+namespace otbr {
+
+#if OTBR_ENABLE_EPOLL
+// The max number of events returned by one `epoll_wait()`, the remaining are returned in the next iteration.
+static constexpr int kMaxEpollEvents = 64;
+
+static uint32_t ToEpollEvents(uint8_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & MainloopManager::kEventReadable)
+    {
+        events |= EPOLLIN;
+    }
+
+    if (aEvents & MainloopManager::kEventWritable)
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (aEvents & MainloopManager::kEventError)
+    {
+        events |= EPOLLPRI;
+    }
+
+    return events;
+}
+
+static uint8_t FromEpollEvents(uint32_t aEvents)
+{
+    uint8_t events = 0;
+
+    // Like `select()`, errors and hang-ups make a file descriptor both readable and writable.
+    if (aEvents & (EPOLLIN | EPOLLERR | EPOLLHUP))
+    {
+        events |= MainloopManager::kEventReadable;
+    }
+
+    if (aEvents & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+    {
+        events |= MainloopManager::kEventWritable;
+    }
+
+    if (aEvents & (EPOLLPRI | EPOLLERR))
+    {
+        events |= MainloopManager::kEventError;
+    }
+
+    if (aEvents & EPOLLHUP)
+    {
+        events |= MainloopManager::kEventHangup;
+    }
+
+    return events;
+}
+#endif
+
+MainloopManager::MainloopManager(void)
+    : mNow(Clock::now())
+    , mInIteration(false)
+    , mTimerSlack(Milliseconds::zero())
+    , mIterations(0)
+    , mTimerWakeups(0)
+    , mStatsStartTime(Clock::now())
+#if OTBR_ENABLE_EPOLL
+    , mEpollFd(-1)
+#endif
+{
+#if OTBR_ENABLE_EPOLL
+    ResetEpoll();
+#endif
+}
+
+MainloopManager::~MainloopManager(void)
+{
+#if OTBR_ENABLE_EPOLL
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+#endif
+}
+
+void MainloopManager::AddMainloopProcessor(MainloopProcessor *aProcessor, const char *aName)
+{
+    assert(aProcessor != nullptr && aName != nullptr);
+
+    if (std::find_if(mProcessors.begin(), mProcessors.end(), [aProcessor](const ProcessorEntry &aEntry) {
+            return aEntry.mProcessor == aProcessor;
+        }) == mProcessors.end())
+    {
+        mProcessors.push_back({aProcessor, aName, LatencyHistogram(), LatencyHistogram()});
+    }
+}
+
+void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aProcessor)
+{
+    mProcessors.erase(std::remove_if(mProcessors.begin(), mProcessors.end(),
+                                     [aProcessor](const ProcessorEntry &aEntry) {
+                                         return aEntry.mProcessor == aProcessor;
+                                     }),
+                      mProcessors.end());
+}
+
+void MainloopManager::Update(MainloopContext &aMainloop)
+{
+    Timepoint start = Clock::now();
+
+    mNow         = start;
+    mInIteration = true;
+    otbrProbe(mainloop__iteration__start, mIterations);
+
+    for (ProcessorEntry &entry : mProcessors)
+    {
+        Timepoint end;
+
+        entry.mProcessor->Update(aMainloop);
+
+        end = Clock::now();
+        entry.mUpdateLatency.Record(std::chrono::duration_cast<Microseconds>(end - start));
+        start = end;
+    }
+
+#if !OTBR_ENABLE_EPOLL
+    for (const auto &registration : mFdRegistrations)
+    {
+        int     fd     = registration.first;
+        uint8_t events = registration.second.mEvents;
+
+        VerifyOrDie(fd < FD_SETSIZE, "The file descriptor is too large for select()");
+
+        if (events & kEventReadable)
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+        }
+
+        if (events & kEventWritable)
+        {
+            FD_SET(fd, &aMainloop.mWriteFdSet);
+        }
+
+        if (events & kEventError)
+        {
+            FD_SET(fd, &aMainloop.mErrorFdSet);
+        }
+
+        if (events != 0)
+        {
+            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+        }
+    }
+#endif
+}
+
+int MainloopManager::Poll(MainloopContext &aMainloop)
+{
+    Timepoint start = Clock::now();
+    int       rval;
+
+#if OTBR_ENABLE_IO_URING
+    // All I/O queued by this iteration is submitted by one system call.
+    IoUring::Get().Submit();
+#endif
+
+    // The timeouts are computed by the mainloop processors against `mNow`.
+    CoalesceTimeout(aMainloop, mNow, start);
+    rval = Wait(aMainloop);
+
+    mNow = Clock::now();
+    mPollLatency.Record(std::chrono::duration_cast<Microseconds>(mNow - start));
+    otbrTrace(TraceEvent::kMainloopPoll, static_cast<uint32_t>(rval),
+              static_cast<uint32_t>(std::chrono::duration_cast<Microseconds>(mNow - start).count()));
+    ++mIterations;
+
+    if (rval == 0)
+    {
+        ++mTimerWakeups;
+    }
+
+    return rval;
+}
+
+void MainloopManager::CoalesceTimeout(MainloopContext &aMainloop, Timepoint aNow, Timepoint aStart) const
+{
+    Microseconds timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+    Clock::rep   slots;
+    Timepoint    deadline;
+
+    VerifyOrExit(mTimerSlack > Milliseconds::zero() && timeout > Microseconds::zero());
+
+    deadline = aNow + timeout;
+    slots    = (deadline.time_since_epoch() + mTimerSlack - Clock::duration(1)) / mTimerSlack;
+    deadline = Timepoint(slots * std::chrono::duration_cast<Clock::duration>(mTimerSlack));
+
+    if (deadline > aStart)
+    {
+        aMainloop.mTimeout = ToTimeval(std::chrono::duration_cast<Microseconds>(deadline - aStart));
+    }
+    else
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+
+exit:
+    return;
+}
+
+void MainloopManager::Process(const MainloopContext &aMainloop)
+{
+    Timepoint start = Clock::now();
+    Timepoint end;
+
+    DispatchFdEvents();
+
+    end = Clock::now();
+    mFdHandlerLatency.Record(std::chrono::duration_cast<Microseconds>(end - start));
+    start = end;
+
+    for (ProcessorEntry &entry : mProcessors)
+    {
+        Microseconds latency;
+
+        entry.mProcessor->Process(aMainloop);
+
+        end     = Clock::now();
+        latency = std::chrono::duration_cast<Microseconds>(end - start);
+        entry.mProcessLatency.Record(latency);
+        otbrTrace(TraceEvent::kMainloopProcess, static_cast<uint32_t>(&entry - mProcessors.data()),
+                  static_cast<uint32_t>(latency.count()));
+        start = end;
+    }
+
+    mInIteration = false;
+    otbrProbe(mainloop__iteration__end, mIterations);
+}
+
+MainloopManager::Stats MainloopManager::GetStats(void) const
+{
+    Stats stats;
+
+    stats.mIterations   = mIterations;
+    stats.mTimerWakeups = mTimerWakeups;
+    stats.mDuration     = std::chrono::duration_cast<Milliseconds>(Clock::now() - mStatsStartTime);
+    stats.mLatencies.push_back({"poll", mPollLatency});
+    stats.mLatencies.push_back({"fd-handlers", mFdHandlerLatency});
+
+    for (const ProcessorEntry &entry : mProcessors)
+    {
+        stats.mLatencies.push_back({entry.mName + ".update", entry.mUpdateLatency});
+        stats.mLatencies.push_back({entry.mName + ".process", entry.mProcessLatency});
+    }
+
+    return stats;
+}
+
+void MainloopManager::ResetStats(void)
+{
+    mIterations     = 0;
+    mTimerWakeups   = 0;
+    mStatsStartTime = Clock::now();
+    mPollLatency.Reset();
+    mFdHandlerLatency.Reset();
+
+    for (ProcessorEntry &entry : mProcessors)
+    {
+        entry.mUpdateLatency.Reset();
+        entry.mProcessLatency.Reset();
+    }
+}
+
+void MainloopManager::RegisterFd(int aFd, uint8_t aEvents, FdHandler aHandler)
+{
+    assert(aFd >= 0 && aHandler != nullptr);
+
+    FdRegistration &registration = mFdRegistrations[aFd];
+
+    registration.mEvents  = aEvents;
+    registration.mHandler = std::move(aHandler);
+
+#if OTBR_ENABLE_EPOLL
+    SyncRegisteredFd(aFd);
+#endif
+}
+
+void MainloopManager::UpdateFd(int aFd, uint8_t aEvents)
+{
+    auto it = mFdRegistrations.find(aFd);
+
+    VerifyOrExit(it != mFdRegistrations.end() && it->second.mEvents != aEvents);
+    it->second.mEvents = aEvents;
+
+#if OTBR_ENABLE_EPOLL
+    SyncRegisteredFd(aFd);
+#endif
+
+exit:
+    return;
+}
+
+void MainloopManager::UnregisterFd(int aFd)
+{
+    VerifyOrExit(mFdRegistrations.erase(aFd) > 0);
+
+#if OTBR_ENABLE_EPOLL
+    SyncRegisteredFd(aFd);
+#endif
+
+exit:
+    return;
+}
+
+uint8_t MainloopManager::GetRegisteredEvents(int aFd) const
+{
+    auto it = mFdRegistrations.find(aFd);
+
+    return it == mFdRegistrations.end() ? 0 : it->second.mEvents;
+}
+
+void MainloopManager::DispatchFdEvents(void)
+{
+    for (const auto &ready : mReadyFds)
+    {
+        auto    it = mFdRegistrations.find(ready.first);
+        uint8_t events;
+
+        // The file descriptor may have been unregistered by a previous handler.
+        if (it == mFdRegistrations.end())
+        {
+            continue;
+        }
+
+        events = it->second.mEvents;
+
+        // Hang-ups are reported by the kernel even if not asked for, as long as the fd is watched at all.
+        if (events != 0)
+        {
+            events |= kEventHangup;
+        }
+
+        events &= ready.second;
+
+        if (events != 0)
+        {
+            // Call a copy so that the handler may safely unregister itself.
+            FdHandler handler = it->second.mHandler;
+
+            handler(events);
+        }
+    }
+
+    mReadyFds.clear();
+}
+
+#if !OTBR_ENABLE_EPOLL
+
+int MainloopManager::Wait(MainloopContext &aMainloop)
+{
+    int rval = select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                      &aMainloop.mTimeout);
+
+    mReadyFds.clear();
+    VerifyOrExit(rval > 0);
+
+    for (const auto &registration : mFdRegistrations)
+    {
+        int     fd     = registration.first;
+        uint8_t events = 0;
+
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            events |= kEventReadable;
+        }
+
+        if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        {
+            events |= kEventWritable;
+        }
+
+        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        {
+            events |= kEventError;
+        }
+
+        if (events != 0)
+        {
+            mReadyFds.emplace_back(fd, events);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+void MainloopManager::RemoveFd(int aFd)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+}
+
+void MainloopManager::RemoveAllFds(void)
+{
+}
+
+#else // OTBR_ENABLE_EPOLL
+
+int MainloopManager::Wait(MainloopContext &aMainloop)
+{
+    int                rval;
+    struct epoll_event events[kMaxEpollEvents];
+    auto               timeout = FromTimeval<Microseconds>(aMainloop.mTimeout).count();
+    int                timeoutMs;
+
+    SyncEpollSet(aMainloop);
+
+    // Round up so that we never wake up before the earliest deadline.
+    timeout   = (timeout + 999) / 1000;
+    timeoutMs = static_cast<int>(std::min<decltype(timeout)>(timeout, std::numeric_limits<int>::max()));
+
+    rval = epoll_wait(mEpollFd, events, kMaxEpollEvents, timeoutMs);
+
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+    mReadyFds.clear();
+
+    for (int i = 0; i < rval; ++i)
+    {
+        int      fd         = events[i].data.fd;
+        uint8_t  happened   = FromEpollEvents(events[i].events);
+        uint32_t interested = (fd <= mLastMainloop.mMaxFd) ? GetEpollEvents(mLastMainloop, fd) : 0;
+        uint8_t  registered = GetRegisteredEvents(fd);
+
+        if ((interested & EPOLLIN) && (happened & kEventReadable))
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+        }
+
+        if ((interested & EPOLLOUT) && (happened & kEventWritable))
+        {
+            FD_SET(fd, &aMainloop.mWriteFdSet);
+        }
+
+        if ((interested & EPOLLPRI) && (happened & kEventError))
+        {
+            FD_SET(fd, &aMainloop.mErrorFdSet);
+        }
+
+        if (registered != 0)
+        {
+            registered |= kEventHangup;
+        }
+
+        if (registered & happened)
+        {
+            mReadyFds.emplace_back(fd, registered & happened);
+        }
+    }
+
+    return rval;
+}
+
+void MainloopManager::RemoveFd(int aFd)
+{
+    VerifyOrExit(aFd >= 0);
+
+    if (aFd <= mLastMainloop.mMaxFd)
+    {
+        FD_CLR(aFd, &mLastMainloop.mReadFdSet);
+        FD_CLR(aFd, &mLastMainloop.mWriteFdSet);
+        FD_CLR(aFd, &mLastMainloop.mErrorFdSet);
+    }
+
+    SyncRegisteredFd(aFd);
+
+exit:
+    return;
+}
+
+void MainloopManager::RemoveAllFds(void)
+{
+    ResetEpoll();
+}
+
+void MainloopManager::ResetEpoll(void)
+{
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+    }
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(mEpollFd != -1, strerror(errno));
+
+    mEpollEvents.clear();
+    FD_ZERO(&mLastMainloop.mReadFdSet);
+    FD_ZERO(&mLastMainloop.mWriteFdSet);
+    FD_ZERO(&mLastMainloop.mErrorFdSet);
+    mLastMainloop.mMaxFd = -1;
+
+    for (const auto &registration : mFdRegistrations)
+    {
+        SetEpollEvents(registration.first, ToEpollEvents(registration.second.mEvents));
+    }
+}
+
+void MainloopManager::SyncEpollSet(const MainloopContext &aMainloop)
+{
+    int maxFd;
+
+    VerifyOrExit(aMainloop.mMaxFd != mLastMainloop.mMaxFd ||
+                 memcmp(&aMainloop.mReadFdSet, &mLastMainloop.mReadFdSet, sizeof(fd_set)) != 0 ||
+                 memcmp(&aMainloop.mWriteFdSet, &mLastMainloop.mWriteFdSet, sizeof(fd_set)) != 0 ||
+                 memcmp(&aMainloop.mErrorFdSet, &mLastMainloop.mErrorFdSet, sizeof(fd_set)) != 0);
+
+    maxFd = std::max(aMainloop.mMaxFd, static_cast<int>(mEpollEvents.size()) - 1);
+
+    for (int fd = 0; fd <= maxFd; ++fd)
+    {
+        uint32_t events = (fd <= aMainloop.mMaxFd) ? GetEpollEvents(aMainloop, fd) : 0;
+
+        if (static_cast<size_t>(fd) < mEpollEvents.size() && mEpollEvents[static_cast<size_t>(fd)] != 0)
+        {
+            events |= ToEpollEvents(GetRegisteredEvents(fd));
+        }
+
+        SetEpollEvents(fd, events);
+    }
+
+    mLastMainloop = aMainloop;
+
+exit:
+    return;
+}
+
+void MainloopManager::SyncRegisteredFd(int aFd)
+{
+    uint32_t events = ToEpollEvents(GetRegisteredEvents(aFd));
+
+    if (aFd <= mLastMainloop.mMaxFd)
+    {
+        events |= GetEpollEvents(mLastMainloop, aFd);
+    }
+
+    SetEpollEvents(aFd, events);
+}
+
+uint32_t MainloopManager::GetEpollEvents(const MainloopContext &aMainloop, int aFd) const
+{
+    uint32_t events = 0;
+
+    if (FD_ISSET(aFd, &aMainloop.mReadFdSet))
+    {
+        events |= EPOLLIN;
+    }
+
+    if (FD_ISSET(aFd, &aMainloop.mWriteFdSet))
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (FD_ISSET(aFd, &aMainloop.mErrorFdSet))
+    {
+        events |= EPOLLPRI;
+    }
+
+    return events;
+}
+
+void MainloopManager::SetEpollEvents(int aFd, uint32_t aEvents)
+{
+    struct epoll_event event;
+    uint32_t           registered;
+    int                op;
+    int                rval;
+
+    if (static_cast<size_t>(aFd) >= mEpollEvents.size())
+    {
+        VerifyOrExit(aEvents != 0);
+        mEpollEvents.resize(static_cast<size_t>(aFd) + 1, 0);
+    }
+
+    registered = mEpollEvents[static_cast<size_t>(aFd)];
+    VerifyOrExit(registered != aEvents);
+
+    memset(&event, 0, sizeof(event));
+    event.events  = aEvents;
+    event.data.fd = aFd;
+
+    op   = (registered == 0) ? EPOLL_CTL_ADD : (aEvents == 0 ? EPOLL_CTL_DEL : EPOLL_CTL_MOD);
+    rval = epoll_ctl(mEpollFd, op, aFd, &event);
+
+    if (rval == -1 && op == EPOLL_CTL_MOD && errno == ENOENT)
+    {
+        // The file descriptor was closed and re-opened without `RemoveFd()`.
+        rval = epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event);
+    }
+    else if (rval == -1 && op == EPOLL_CTL_ADD && errno == EEXIST)
+    {
+        rval = epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event);
+    }
+    else if (op == EPOLL_CTL_DEL)
+    {
+        // The kernel drops closed file descriptors by itself.
+        rval = 0;
+    }
+
+    if (rval == -1)
+    {
+        otbrLogWarning("Failed to watch fd %d: %s", aFd, strerror(errno));
+        aEvents = 0;
+    }
+
+    mEpollEvents[static_cast<size_t>(aFd)] = aEvents;
+
+exit:
+    return;
+}
+
+#endif // OTBR_ENABLE_EPOLL
+
+} // namespace otbr
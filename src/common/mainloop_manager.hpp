@@ -0,0 +1,360 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the mainloop manager that drives all mainloop processors.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_MANAGER_HPP_
+#define OTBR_COMMON_MAINLOOP_MANAGER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/latency_histogram.hpp"
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the mainloop manager.
+ *
+ * The mainloop manager owns the list of mainloop processors and waits for events on the file descriptors
+ * they add to the mainloop context. The waiting backend is selected at build time: `select()` by default,
+ * or `epoll` when `OTBR_ENABLE_EPOLL` is set.
+ *
+ * File descriptors can be handed to the mainloop in two ways. Mainloop processors may add them to the fd sets
+ * of the mainloop context in every `Update()`. Alternatively, a component may register a file descriptor once
+ * with `RegisterFd()` and receive a callback when it becomes ready. Registered file descriptors cost nothing per
+ * iteration with the epoll backend, so this is the preferred way for long-lived file descriptors.
+ *
+ * With the epoll backend, the fd sets filled by the processors are compared with the registrations of the
+ * previous iteration and only the differences are applied to the epoll instance, so a wakeup costs as much
+ * as the number of ready file descriptors.
+ *
+ * When `OTBR_ENABLE_IO_URING` is set, the socket I/O queued to `IoUring` during an iteration is submitted right
+ * before waiting, and its completions are handled along with the other file descriptor events.
+ *
+ * The mainloop manager also keeps latency histograms of polling and of every mainloop processor, see
+ * `GetStats()`.
+ *
+ * To save power on idle devices, the mainloop may coalesce timers, see `SetTimerSlack()`. Mainloop processors
+ * should compute their timeouts with `GetNow()` so that timers of all processors are compared against the same
+ * time in every iteration.
+ *
+ */
+class MainloopManager
+{
+public:
+    /**
+     * File descriptor events.
+     *
+     */
+    enum FdEvent : uint8_t
+    {
+        kEventReadable = 1 << 0, ///< The file descriptor is readable.
+        kEventWritable = 1 << 1, ///< The file descriptor is writable.
+        kEventError    = 1 << 2, ///< An exceptional condition happened on the file descriptor.
+        kEventHangup   = 1 << 3, ///< The peer hung up, always reported and never needs to be registered.
+    };
+
+    /**
+     * This function is called when a registered file descriptor becomes ready.
+     *
+     * @param[in]  aEvents  The ready events, a combination of `FdEvent`.
+     *
+     */
+    using FdHandler = std::function<void(uint8_t aEvents)>;
+
+    /**
+     * This structure represents a named latency histogram of the mainloop.
+     *
+     */
+    struct Latency
+    {
+        std::string      mName;      ///< The name of the measured step, e.g. "poll" or "<processor>.update".
+        LatencyHistogram mHistogram; ///< The latencies of the step.
+    };
+
+    /**
+     * This structure represents the statistics of the mainloop since the last reset.
+     *
+     */
+    struct Stats
+    {
+        uint64_t             mIterations;   ///< The number of mainloop iterations.
+        uint64_t             mTimerWakeups; ///< The number of iterations woken up by a timeout rather than a fd.
+        Milliseconds         mDuration;     ///< The time elapsed since the statistics were reset.
+        std::vector<Latency> mLatencies;    ///< The latencies of polling, fd handlers and each mainloop processor.
+    };
+
+    /**
+     * This method returns the singleton instance of the mainloop manager.
+     *
+     * @returns  A reference to the mainloop manager.
+     *
+     */
+    static MainloopManager &GetInstance(void)
+    {
+        static MainloopManager sMainloopManager;
+
+        return sMainloopManager;
+    }
+
+    /**
+     * This destructor destroys the mainloop manager.
+     *
+     */
+    ~MainloopManager(void);
+
+    /**
+     * This method adds a mainloop processor to the mainloop.
+     *
+     * Processors are updated and processed in the order they are added.
+     *
+     * @param[in]  aProcessor  A pointer to the mainloop processor.
+     * @param[in]  aName       The name of the mainloop processor in the mainloop statistics.
+     *
+     */
+    void AddMainloopProcessor(MainloopProcessor *aProcessor, const char *aName = "unnamed");
+
+    /**
+     * This method removes a mainloop processor from the mainloop.
+     *
+     * @param[in]  aProcessor  A pointer to the mainloop processor.
+     *
+     */
+    void RemoveMainloopProcessor(MainloopProcessor *aProcessor);
+
+    /**
+     * This method updates the mainloop context with all mainloop processors.
+     *
+     * @param[inout]  aMainloop  A reference to the mainloop to be updated.
+     *
+     */
+    void Update(MainloopContext &aMainloop);
+
+    /**
+     * This method waits for events of the file descriptors in the mainloop context.
+     *
+     * On return, the fd sets of @p aMainloop only contain the ready file descriptors, exactly as `select()`.
+     *
+     * @param[inout]  aMainloop  A reference to the mainloop context.
+     *
+     * @returns  The number of ready file descriptors, or -1 on failure with `errno` set.
+     *
+     */
+    int Poll(MainloopContext &aMainloop);
+
+    /**
+     * This method processes mainloop events with all mainloop processors.
+     *
+     * @param[in]  aMainloop  A reference to the mainloop context.
+     *
+     */
+    void Process(const MainloopContext &aMainloop);
+
+    /**
+     * This method tells the mainloop manager that a file descriptor is being closed.
+     *
+     * The epoll backend keeps its registrations across iterations, so a component which closes a file
+     * descriptor that has been added to the mainloop must call this method. Otherwise, a new file descriptor
+     * reusing the same number with the same interests would never be registered. This method is a no-op
+     * with the `select()` backend.
+     *
+     * @param[in]  aFd  The file descriptor.
+     *
+     */
+    void RemoveFd(int aFd);
+
+    /**
+     * This method drops all file descriptor registrations of the epoll backend.
+     *
+     * This method should be called when a large number of file descriptors are closed and re-opened at once,
+     * e.g. when the OpenThread instance is re-initialized.
+     *
+     */
+    void RemoveAllFds(void);
+
+    /**
+     * This method registers a file descriptor to the mainloop.
+     *
+     * The registration stays valid until `UnregisterFd()` is called, the handler is called in `Process()` every
+     * time the file descriptor is ready for any of @p aEvents. A registered file descriptor must be unregistered
+     * before it is closed.
+     *
+     * Like `poll()`, the handler is also called with `kEventHangup` when the peer hangs up, unless the file
+     * descriptor is paused. The handler must then stop watching the file descriptor, or it will be called again
+     * in every iteration. Only the epoll backend detects hang-ups, `select()` reports the file descriptor as
+     * readable and writable instead.
+     *
+     * @param[in]  aFd       The file descriptor.
+     * @param[in]  aEvents   The interested events, a combination of `FdEvent`.
+     * @param[in]  aHandler  The handler to be called when the file descriptor is ready.
+     *
+     */
+    void RegisterFd(int aFd, uint8_t aEvents, FdHandler aHandler);
+
+    /**
+     * This method changes the interested events of a registered file descriptor.
+     *
+     * @param[in]  aFd      The file descriptor.
+     * @param[in]  aEvents  The interested events, a combination of `FdEvent`. Zero pauses the file descriptor
+     *                      without dropping the registration.
+     *
+     */
+    void UpdateFd(int aFd, uint8_t aEvents);
+
+    /**
+     * This method unregisters a file descriptor from the mainloop.
+     *
+     * It is safe to call this method from within any `FdHandler`, the handler of @p aFd will not be called
+     * again afterwards.
+     *
+     * @param[in]  aFd  The file descriptor.
+     *
+     */
+    void UnregisterFd(int aFd);
+
+    /**
+     * This method returns the statistics of the mainloop.
+     *
+     * @returns  The mainloop statistics since the last call to `ResetStats()`.
+     *
+     */
+    Stats GetStats(void) const;
+
+    /**
+     * This method resets the statistics of the mainloop.
+     *
+     */
+    void ResetStats(void);
+
+    /**
+     * This method returns the time of the current mainloop iteration.
+     *
+     * Within `Update()`, this is the time the update started. Within `Process()`, this is the time `Poll()`
+     * returned. Outside of the mainloop, this is the current time.
+     *
+     * @returns  The time of the current mainloop iteration.
+     *
+     */
+    Timepoint GetNow(void) const { return mInIteration ? mNow : Clock::now(); }
+
+    /**
+     * This method sets the timer slack of the mainloop.
+     *
+     * With a non-zero slack, the deadline of every `Poll()` is postponed to the next multiple of @p aSlack of the
+     * steady clock, so that timers expiring within a slack period are handled by a single wakeup. Zero timeouts
+     * are never postponed. The slack is zero by default, which disables timer coalescing.
+     *
+     * @param[in]  aSlack  The timer slack.
+     *
+     */
+    void SetTimerSlack(Milliseconds aSlack) { mTimerSlack = aSlack; }
+
+    /**
+     * This method returns the timer slack of the mainloop.
+     *
+     * @returns  The timer slack.
+     *
+     */
+    Milliseconds GetTimerSlack(void) const { return mTimerSlack; }
+
+    /**
+     * This method postpones the timeout of a mainloop context to the timer slack.
+     *
+     * @param[inout]  aMainloop  The mainloop context, its timeout is relative to @p aNow.
+     * @param[in]     aNow       The time the timeout is computed against.
+     * @param[in]     aStart     The time the poll starts, the postponed timeout is relative to it.
+     *
+     */
+    void CoalesceTimeout(MainloopContext &aMainloop, Timepoint aNow, Timepoint aStart) const;
+
+private:
+    struct FdRegistration
+    {
+        uint8_t   mEvents;
+        FdHandler mHandler;
+    };
+
+    struct ProcessorEntry
+    {
+        MainloopProcessor *mProcessor;
+        std::string        mName;
+        LatencyHistogram   mUpdateLatency;
+        LatencyHistogram   mProcessLatency;
+    };
+
+    MainloopManager(void);
+
+    void    DispatchFdEvents(void);
+    uint8_t GetRegisteredEvents(int aFd) const;
+    int     Wait(MainloopContext &aMainloop);
+
+    Timepoint    mNow;
+    bool         mInIteration;
+    Milliseconds mTimerSlack;
+
+    uint64_t         mIterations;
+    uint64_t         mTimerWakeups;
+    Timepoint        mStatsStartTime;
+    LatencyHistogram mPollLatency;
+    LatencyHistogram mFdHandlerLatency;
+
+#if OTBR_ENABLE_EPOLL
+    void     ResetEpoll(void);
+    void     SyncEpollSet(const MainloopContext &aMainloop);
+    void     SetEpollEvents(int aFd, uint32_t aEvents);
+    uint32_t GetEpollEvents(const MainloopContext &aMainloop, int aFd) const;
+    void     SyncRegisteredFd(int aFd);
+
+    int                   mEpollFd;
+    std::vector<uint32_t> mEpollEvents; // The epoll events watched by the kernel, indexed by file descriptor.
+
+    // The mainloop context of the previous iteration, to fast path the common case that nothing changes.
+    MainloopContext mLastMainloop;
+#endif
+
+    std::vector<ProcessorEntry>          mProcessors;
+    std::map<int, FdRegistration>        mFdRegistrations;
+    std::vector<std::pair<int, uint8_t>> mReadyFds; // The ready registered fds and events of the last `Poll()`.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
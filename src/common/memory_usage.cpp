@@ -0,0 +1,64 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the reporting of the memory used by the agent subsystems.
+ */
+
+#include "common/memory_usage.hpp"
+
+namespace otbr {
+
+MemoryReporter::MemoryReporter(const char *     aEntriesName,
+                               const char *     aEntriesHelp,
+                               const char *     aBytesName,
+                               const char *     aBytesHelp,
+                               Estimator        aEstimator,
+                               MetricsRegistry &aRegistry)
+    : mRegistry(aRegistry)
+{
+    MetricsRegistry::Gauge &entries = aRegistry.AddGauge(aEntriesName, aEntriesHelp);
+    MetricsRegistry::Gauge &bytes   = aRegistry.AddGauge(aBytesName, aBytesHelp);
+
+    mCollectorId = aRegistry.AddCollector([&entries, &bytes, aEstimator]() {
+        size_t numEntries = 0;
+        size_t numBytes   = 0;
+
+        aEstimator(numEntries, numBytes);
+        entries.Set(static_cast<int64_t>(numEntries));
+        bytes.Set(static_cast<int64_t>(numBytes));
+    });
+}
+
+MemoryReporter::~MemoryReporter(void)
+{
+    mRegistry.RemoveCollector(mCollectorId);
+}
+
+} // namespace otbr
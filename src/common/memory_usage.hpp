@@ -0,0 +1,181 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for estimating and reporting the memory used by the agent subsystems.
+ */
+
+#ifndef OTBR_COMMON_MEMORY_USAGE_HPP_
+#define OTBR_COMMON_MEMORY_USAGE_HPP_
+
+#include <functional>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "common/metrics_registry.hpp"
+
+namespace otbr {
+
+/**
+ * This namespace includes estimations of the heap memory used by the standard containers.
+ *
+ * The estimations count the nodes and buffers allocated by the containers, the memory owned by the elements is
+ * counted separately by the callers.
+ *
+ */
+namespace MemoryUsage {
+
+constexpr size_t kListNodeOverhead = 2 * sizeof(void *); ///< Previous and next pointers of a list node.
+constexpr size_t kTreeNodeOverhead = 4 * sizeof(void *); ///< Parent and child pointers and color of a tree node.
+constexpr size_t kHashNodeOverhead = 2 * sizeof(void *); ///< Next pointer and cached hash of a hash table node.
+
+/**
+ * This function estimates the heap memory used by a string.
+ *
+ * @param[in]  aString  The string.
+ *
+ * @returns  The number of bytes allocated, 0 if the string is stored inline.
+ *
+ */
+inline size_t GetHeapSize(const std::string &aString)
+{
+    static const size_t kInlineCapacity = std::string().capacity();
+
+    return aString.capacity() > kInlineCapacity ? aString.capacity() + 1 : 0;
+}
+
+/**
+ * This function estimates the heap memory used by the buffer of a vector.
+ *
+ * @param[in]  aVector  The vector.
+ *
+ * @returns  The number of bytes allocated.
+ *
+ */
+template <typename T> size_t GetHeapSize(const std::vector<T> &aVector)
+{
+    return aVector.capacity() * sizeof(T);
+}
+
+/**
+ * This function estimates the heap memory used by the nodes of a `std::list`.
+ *
+ * @param[in]  aList  The list.
+ *
+ * @returns  The number of bytes allocated.
+ *
+ */
+template <typename List> size_t GetListSize(const List &aList)
+{
+    return aList.size() * (sizeof(typename List::value_type) + kListNodeOverhead);
+}
+
+/**
+ * This function estimates the heap memory used by the nodes of a `std::map` or a `std::set`.
+ *
+ * @param[in]  aTree  The map or set.
+ *
+ * @returns  The number of bytes allocated.
+ *
+ */
+template <typename Tree> size_t GetTreeSize(const Tree &aTree)
+{
+    return aTree.size() * (sizeof(typename Tree::value_type) + kTreeNodeOverhead);
+}
+
+/**
+ * This function estimates the heap memory used by the nodes and buckets of an unordered container.
+ *
+ * @param[in]  aHashTable  The unordered container.
+ *
+ * @returns  The number of bytes allocated.
+ *
+ */
+template <typename HashTable> size_t GetHashTableSize(const HashTable &aHashTable)
+{
+    return aHashTable.size() * (sizeof(typename HashTable::value_type) + kHashNodeOverhead) +
+           aHashTable.bucket_count() * sizeof(void *);
+}
+
+} // namespace MemoryUsage
+
+/**
+ * This class reports the number of entries and the estimated memory of a subsystem as metrics.
+ *
+ * The estimation runs each time the metrics are rendered, so it costs nothing while nobody reads the metrics.
+ *
+ */
+class MemoryReporter
+{
+public:
+    /**
+     * This type represents a function which estimates the memory used by a subsystem.
+     *
+     * @param[out]  aNumEntries  The number of entries of the subsystem.
+     * @param[out]  aNumBytes    The estimated number of bytes used by the entries.
+     *
+     */
+    using Estimator = std::function<void(size_t &aNumEntries, size_t &aNumBytes)>;
+
+    /**
+     * This constructor registers the metrics of a subsystem.
+     *
+     * @param[in]  aEntriesName  The name of the metric of the number of entries, must outlive the registry.
+     * @param[in]  aEntriesHelp  The description of the metric of the number of entries, must outlive the registry.
+     * @param[in]  aBytesName    The name of the metric of the estimated memory, must outlive the registry.
+     * @param[in]  aBytesHelp    The description of the metric of the estimated memory, must outlive the registry.
+     * @param[in]  aEstimator    The function estimating the memory, run in the thread rendering the metrics.
+     * @param[in]  aRegistry     The registry of the metrics.
+     *
+     */
+    MemoryReporter(const char *     aEntriesName,
+                   const char *     aEntriesHelp,
+                   const char *     aBytesName,
+                   const char *     aBytesHelp,
+                   Estimator        aEstimator,
+                   MetricsRegistry &aRegistry = MetricsRegistry::Get());
+
+    /**
+     * This destructor stops estimating the memory, the metrics keep their last values.
+     *
+     */
+    ~MemoryReporter(void);
+
+    MemoryReporter(const MemoryReporter &) = delete;
+    MemoryReporter &operator=(const MemoryReporter &) = delete;
+
+private:
+    MetricsRegistry &            mRegistry;
+    MetricsRegistry::CollectorId mCollectorId;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MEMORY_USAGE_HPP_
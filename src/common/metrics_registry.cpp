@@ -0,0 +1,274 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the registry of the agent metrics.
+ */
+
+#include "common/metrics_registry.hpp"
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace otbr {
+
+static void AppendHeader(std::string &aOutput, const char *aName, const char *aType, const char *aHelp)
+{
+    aOutput += "# HELP ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aHelp;
+    aOutput += "\n# TYPE ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aType;
+    aOutput += '\n';
+}
+
+static void AppendFormat(std::string &aOutput, const char *aFormat, ...) __attribute__((format(printf, 2, 3)));
+
+static void AppendFormat(std::string &aOutput, const char *aFormat, ...)
+{
+    char    buffer[32];
+    va_list args;
+
+    va_start(args, aFormat);
+    vsnprintf(buffer, sizeof(buffer), aFormat, args);
+    va_end(args);
+    aOutput += buffer;
+}
+
+static void AppendScaled(std::string &aOutput, uint64_t aValue, double aScale)
+{
+    if (aScale == 1)
+    {
+        AppendFormat(aOutput, "%" PRIu64, aValue);
+    }
+    else
+    {
+        AppendFormat(aOutput, "%.9g", aValue * aScale);
+    }
+}
+
+MetricsRegistry::Histogram::Histogram(const uint64_t *aBounds, size_t aNumBounds, double aScale)
+    : mNumBounds(aNumBounds < kMaxBounds ? aNumBounds : kMaxBounds)
+    , mScale(aScale)
+    , mCount(0)
+    , mSum(0)
+{
+    for (size_t i = 0; i < mNumBounds; ++i)
+    {
+        assert(i == 0 || aBounds[i - 1] < aBounds[i]);
+        mBounds[i] = aBounds[i];
+    }
+
+    for (std::atomic<uint64_t> &bucket : mBuckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricsRegistry::Histogram::Observe(uint64_t aValue)
+{
+    size_t index = 0;
+
+    // A handful of bounds, so a linear search is faster than a binary one.
+    while (index < mNumBounds && aValue > mBounds[index])
+    {
+        ++index;
+    }
+
+    mBuckets[index].fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(aValue, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+MetricsRegistry &MetricsRegistry::Get(void)
+{
+    static MetricsRegistry sRegistry;
+
+    return sRegistry;
+}
+
+void *MetricsRegistry::Find(const char *aName, Type aType) const
+{
+    void *metric = nullptr;
+
+    for (const Entry &entry : mEntries)
+    {
+        if (strcmp(entry.mName, aName) == 0)
+        {
+            assert(entry.mType == aType);
+            metric = (entry.mType == aType ? entry.mMetric : nullptr);
+            break;
+        }
+    }
+
+    return metric;
+}
+
+MetricsRegistry::Counter &MetricsRegistry::AddCounter(const char *aName, const char *aHelp)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    Counter *                   counter = static_cast<Counter *>(Find(aName, Type::kCounter));
+
+    if (counter == nullptr)
+    {
+        mCounters.emplace_back();
+        counter = &mCounters.back();
+        mEntries.push_back({aName, aHelp, Type::kCounter, counter});
+    }
+
+    return *counter;
+}
+
+MetricsRegistry::Gauge &MetricsRegistry::AddGauge(const char *aName, const char *aHelp)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    Gauge *                     gauge = static_cast<Gauge *>(Find(aName, Type::kGauge));
+
+    if (gauge == nullptr)
+    {
+        mGauges.emplace_back();
+        gauge = &mGauges.back();
+        mEntries.push_back({aName, aHelp, Type::kGauge, gauge});
+    }
+
+    return *gauge;
+}
+
+MetricsRegistry::Histogram &MetricsRegistry::AddHistogram(const char *    aName,
+                                                          const char *    aHelp,
+                                                          const uint64_t *aBounds,
+                                                          size_t          aNumBounds,
+                                                          double          aScale)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    Histogram *                 histogram = static_cast<Histogram *>(Find(aName, Type::kHistogram));
+
+    if (histogram == nullptr)
+    {
+        mHistograms.emplace_back(aBounds, aNumBounds, aScale);
+        histogram = &mHistograms.back();
+        mEntries.push_back({aName, aHelp, Type::kHistogram, histogram});
+    }
+
+    return *histogram;
+}
+
+MetricsRegistry::CollectorId MetricsRegistry::AddCollector(Collector aCollector)
+{
+    std::lock_guard<std::mutex> lock(mCollectorMutex);
+    CollectorId                 id = mNextCollectorId++;
+
+    mCollectors.emplace_back(id, std::move(aCollector));
+
+    return id;
+}
+
+void MetricsRegistry::RemoveCollector(CollectorId aId)
+{
+    std::lock_guard<std::mutex> lock(mCollectorMutex);
+
+    for (auto it = mCollectors.begin(); it != mCollectors.end(); ++it)
+    {
+        if (it->first == aId)
+        {
+            mCollectors.erase(it);
+            break;
+        }
+    }
+}
+
+void MetricsRegistry::Render(std::string &aOutput) const
+{
+    {
+        std::lock_guard<std::mutex> collectorLock(mCollectorMutex);
+
+        for (const auto &collector : mCollectors)
+        {
+            collector.second();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (const Entry &entry : mEntries)
+    {
+        switch (entry.mType)
+        {
+        case Type::kCounter:
+            AppendHeader(aOutput, entry.mName, "counter", entry.mHelp);
+            aOutput += entry.mName;
+            AppendFormat(aOutput, " %" PRIu64 "\n", static_cast<const Counter *>(entry.mMetric)->Get());
+            break;
+
+        case Type::kGauge:
+            AppendHeader(aOutput, entry.mName, "gauge", entry.mHelp);
+            aOutput += entry.mName;
+            AppendFormat(aOutput, " %" PRId64 "\n", static_cast<const Gauge *>(entry.mMetric)->Get());
+            break;
+
+        case Type::kHistogram:
+        {
+            const Histogram &histogram = *static_cast<const Histogram *>(entry.mMetric);
+            uint64_t         count     = 0;
+
+            AppendHeader(aOutput, entry.mName, "histogram", entry.mHelp);
+
+            // The buckets are cumulative, the last bucket has no upper bound.
+            for (size_t i = 0; i < histogram.GetNumBounds(); ++i)
+            {
+                count += histogram.GetBucketCount(i);
+                aOutput += entry.mName;
+                aOutput += "_bucket{le=\"";
+                AppendScaled(aOutput, histogram.GetBound(i), histogram.GetScale());
+                AppendFormat(aOutput, "\"} %" PRIu64 "\n", count);
+            }
+
+            // Sums the buckets instead of reading the count, so the samples stay consistent during updates.
+            count += histogram.GetBucketCount(histogram.GetNumBounds());
+            aOutput += entry.mName;
+            AppendFormat(aOutput, "_bucket{le=\"+Inf\"} %" PRIu64 "\n", count);
+            aOutput += entry.mName;
+            aOutput += "_sum ";
+            AppendScaled(aOutput, histogram.GetSum(), histogram.GetScale());
+            aOutput += '\n';
+            aOutput += entry.mName;
+            AppendFormat(aOutput, "_count %" PRIu64 "\n", count);
+            break;
+        }
+        }
+    }
+}
+
+} // namespace otbr
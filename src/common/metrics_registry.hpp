@@ -0,0 +1,342 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions of the registry of the agent metrics.
+ */
+
+#ifndef OTBR_COMMON_METRICS_REGISTRY_HPP_
+#define OTBR_COMMON_METRICS_REGISTRY_HPP_
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class implements a registry of metrics shared by all the management interfaces of the agent.
+ *
+ * Metrics are registered by name at startup and updated with relaxed atomic operations, so updating a metric costs
+ * about the same as updating a plain counter and is safe from any thread. The Rest server, D-Bus and ubus all render
+ * the registry in the Prometheus text exposition format.
+ *
+ * Values which are costly to track on each change, e.g. the sizes of containers, are updated by collectors instead,
+ * which are run each time the registry is rendered.
+ *
+ */
+class MetricsRegistry
+{
+public:
+    /**
+     * This class represents a monotonically increasing counter.
+     *
+     */
+    class Counter
+    {
+    public:
+        /**
+         * This method increases the counter.
+         *
+         * @param[in]  aValue  The value to add.
+         *
+         */
+        void Increment(uint64_t aValue = 1) { mValue.fetch_add(aValue, std::memory_order_relaxed); }
+
+        /**
+         * This method returns the value of the counter.
+         *
+         * @returns  The value of the counter.
+         *
+         */
+        uint64_t Get(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint64_t> mValue{0};
+    };
+
+    /**
+     * This class represents a gauge, a value which may go up and down.
+     *
+     */
+    class Gauge
+    {
+    public:
+        /**
+         * This method sets the gauge.
+         *
+         * @param[in]  aValue  The value of the gauge.
+         *
+         */
+        void Set(int64_t aValue) { mValue.store(aValue, std::memory_order_relaxed); }
+
+        /**
+         * This method adds to the gauge.
+         *
+         * @param[in]  aValue  The value to add, may be negative.
+         *
+         */
+        void Add(int64_t aValue) { mValue.fetch_add(aValue, std::memory_order_relaxed); }
+
+        /**
+         * This method returns the value of the gauge.
+         *
+         * @returns  The value of the gauge.
+         *
+         */
+        int64_t Get(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<int64_t> mValue{0};
+    };
+
+    /**
+     * This class represents a histogram with fixed bucket upper bounds.
+     *
+     */
+    class Histogram
+    {
+    public:
+        static constexpr size_t kMaxBounds = 16; ///< The maximum number of bucket upper bounds.
+
+        /**
+         * This constructor initializes the histogram.
+         *
+         * @param[in]  aBounds     The increasing upper bounds of the buckets.
+         * @param[in]  aNumBounds  The number of upper bounds, at most `kMaxBounds`, more are ignored.
+         * @param[in]  aScale      The unit of the observed values in the rendered unit, e.g. 1e-6 for microseconds
+         *                         rendered as seconds.
+         *
+         */
+        Histogram(const uint64_t *aBounds, size_t aNumBounds, double aScale);
+
+        /**
+         * This method records a value.
+         *
+         * @param[in]  aValue  The observed value.
+         *
+         */
+        void Observe(uint64_t aValue);
+
+        /**
+         * This method returns the number of bucket upper bounds.
+         *
+         * @returns  The number of bucket upper bounds, the overflow bucket excluded.
+         *
+         */
+        size_t GetNumBounds(void) const { return mNumBounds; }
+
+        /**
+         * This method returns the upper bound of a bucket.
+         *
+         * @param[in]  aIndex  The index of the bucket, less than `GetNumBounds()`.
+         *
+         * @returns  The inclusive upper bound of the bucket.
+         *
+         */
+        uint64_t GetBound(size_t aIndex) const { return mBounds[aIndex]; }
+
+        /**
+         * This method returns the number of values recorded in a bucket.
+         *
+         * @param[in]  aIndex  The index of the bucket, `GetNumBounds()` for the overflow bucket.
+         *
+         * @returns  The number of values in the bucket, not cumulative.
+         *
+         */
+        uint64_t GetBucketCount(size_t aIndex) const { return mBuckets[aIndex].load(std::memory_order_relaxed); }
+
+        /**
+         * This method returns the number of recorded values.
+         *
+         * @returns  The number of recorded values.
+         *
+         */
+        uint64_t GetCount(void) const { return mCount.load(std::memory_order_relaxed); }
+
+        /**
+         * This method returns the sum of recorded values.
+         *
+         * @returns  The sum of recorded values.
+         *
+         */
+        uint64_t GetSum(void) const { return mSum.load(std::memory_order_relaxed); }
+
+        /**
+         * This method returns the unit of the observed values in the rendered unit.
+         *
+         * @returns  The scale of the rendered values.
+         *
+         */
+        double GetScale(void) const { return mScale; }
+
+    private:
+        uint64_t              mBounds[kMaxBounds];
+        size_t                mNumBounds;
+        double                mScale;
+        std::atomic<uint64_t> mBuckets[kMaxBounds + 1];
+        std::atomic<uint64_t> mCount;
+        std::atomic<uint64_t> mSum;
+    };
+
+    /**
+     * This type represents a function which updates some metrics before they are rendered.
+     *
+     */
+    using Collector = std::function<void(void)>;
+
+    /**
+     * This type represents the id of a registered collector.
+     *
+     */
+    using CollectorId = uint32_t;
+
+    /**
+     * This method returns the registry of the agent metrics.
+     *
+     * @returns  The metrics registry.
+     *
+     */
+    static MetricsRegistry &Get(void);
+
+    /**
+     * This method registers a counter.
+     *
+     * Registering a name again returns the metric registered first, so components may register their metrics each
+     * time they are initialized.
+     *
+     * @param[in]  aName  The name of the metric, must outlive the registry.
+     * @param[in]  aHelp  The description of the metric, must outlive the registry.
+     *
+     * @returns  The counter, valid as long as the registry.
+     *
+     */
+    Counter &AddCounter(const char *aName, const char *aHelp);
+
+    /**
+     * This method registers a gauge.
+     *
+     * @param[in]  aName  The name of the metric, must outlive the registry.
+     * @param[in]  aHelp  The description of the metric, must outlive the registry.
+     *
+     * @returns  The gauge, valid as long as the registry.
+     *
+     */
+    Gauge &AddGauge(const char *aName, const char *aHelp);
+
+    /**
+     * This method registers a histogram.
+     *
+     * @param[in]  aName       The name of the metric, must outlive the registry.
+     * @param[in]  aHelp       The description of the metric, must outlive the registry.
+     * @param[in]  aBounds     The increasing upper bounds of the buckets.
+     * @param[in]  aNumBounds  The number of upper bounds, at most `Histogram::kMaxBounds`.
+     * @param[in]  aScale      The unit of the observed values in the rendered unit.
+     *
+     * @returns  The histogram, valid as long as the registry.
+     *
+     */
+    Histogram &AddHistogram(const char *    aName,
+                            const char *    aHelp,
+                            const uint64_t *aBounds,
+                            size_t          aNumBounds,
+                            double          aScale = 1);
+
+    /**
+     * This method registers a collector.
+     *
+     * Collectors are run in the thread rendering the registry, which is the main loop thread for all the management
+     * interfaces of the agent.
+     *
+     * @param[in]  aCollector  The collector, must not register or remove collectors.
+     *
+     * @returns  The id of the collector to remove it.
+     *
+     */
+    CollectorId AddCollector(Collector aCollector);
+
+    /**
+     * This method removes a collector.
+     *
+     * The collector is not running anymore once this method returns.
+     *
+     * @param[in]  aId  The id of the collector.
+     *
+     */
+    void RemoveCollector(CollectorId aId);
+
+    /**
+     * This method appends all the registered metrics in the Prometheus text exposition format.
+     *
+     * The collectors are run first.
+     *
+     * @param[inout]  aOutput  The output buffer.
+     *
+     */
+    void Render(std::string &aOutput) const;
+
+private:
+    enum class Type : uint8_t
+    {
+        kCounter,
+        kGauge,
+        kHistogram,
+    };
+
+    struct Entry
+    {
+        const char *mName;
+        const char *mHelp;
+        Type        mType;
+        void *      mMetric;
+    };
+
+    void *Find(const char *aName, Type aType) const;
+
+    mutable std::mutex    mMutex;
+    std::vector<Entry>    mEntries;
+    std::deque<Counter>   mCounters;
+    std::deque<Gauge>     mGauges;
+    std::deque<Histogram> mHistograms;
+
+    mutable std::mutex                             mCollectorMutex;
+    std::vector<std::pair<CollectorId, Collector>> mCollectors;
+    CollectorId                                    mNextCollectorId = 1;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_METRICS_REGISTRY_HPP_
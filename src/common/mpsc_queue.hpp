@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a lock-free multi-producer single-consumer queue.
+ */
+
+#ifndef OTBR_COMMON_MPSC_QUEUE_HPP_
+#define OTBR_COMMON_MPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <utility>
+
+namespace otbr {
+
+/**
+ * This class implements an unbounded lock-free multi-producer single-consumer FIFO queue.
+ *
+ * `Push()` may be called from any thread concurrently, while `Pop()` must only be called from a single consumer
+ * thread. Neither of them blocks: a `Push()` which is in progress may not be visible to `Pop()` yet, in which case
+ * `Pop()` reports an empty queue and the element is returned by a later `Pop()`.
+ *
+ */
+template <typename T> class MpscQueue
+{
+public:
+    /**
+     * This constructor initializes an empty queue.
+     *
+     */
+    MpscQueue(void)
+        : mHead(new Node())
+        , mTail(mHead)
+    {
+    }
+
+    /**
+     * This destructor destroys the queue and all the remaining elements.
+     *
+     * There must be no concurrent `Push()` when the queue is destroyed.
+     *
+     */
+    ~MpscQueue(void)
+    {
+        T value;
+
+        while (Pop(value))
+        {
+        }
+
+        delete mHead;
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    /**
+     * This method pushes an element to the tail of the queue.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in]  aValue  The element to be pushed.
+     *
+     */
+    void Push(T aValue)
+    {
+        Node *node = new Node(std::move(aValue));
+        Node *prev = mTail.exchange(node, std::memory_order_acq_rel);
+
+        // Between the two statements, the consumer sees the queue ending at `prev`.
+        prev->mNext.store(node, std::memory_order_release);
+    }
+
+    /**
+     * This method pops an element from the head of the queue.
+     *
+     * This method must only be called by the consumer thread.
+     *
+     * @param[out]  aValue  A reference to receive the element.
+     *
+     * @retval  TRUE   An element is popped.
+     * @retval  FALSE  The queue is empty.
+     *
+     */
+    bool Pop(T &aValue)
+    {
+        Node *next = mHead->mNext.load(std::memory_order_acquire);
+
+        if (next != nullptr)
+        {
+            // The head is always a dummy node, `next` becomes the new dummy node once its value is taken.
+            aValue = std::move(next->mValue);
+            delete mHead;
+            mHead = next;
+        }
+
+        return next != nullptr;
+    }
+
+private:
+    struct Node
+    {
+        Node(void)
+            : mNext(nullptr)
+        {
+        }
+
+        explicit Node(T aValue)
+            : mNext(nullptr)
+            , mValue(std::move(aValue))
+        {
+        }
+
+        std::atomic<Node *> mNext;
+        T                   mValue;
+    };
+
+    Node *              mHead; // Only accessed by the consumer.
+    std::atomic<Node *> mTail;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MPSC_QUEUE_HPP_
@@ -0,0 +1,196 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a bounded lock-free multi-producer single-consumer ring buffer.
+ */
+
+#ifndef OTBR_COMMON_MPSC_RING_BUFFER_HPP_
+#define OTBR_COMMON_MPSC_RING_BUFFER_HPP_
+
+#include <atomic>
+#include <utility>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class implements a bounded lock-free multi-producer single-consumer FIFO ring buffer.
+ *
+ * Unlike `MpscQueue`, the ring buffer never allocates: all the elements are stored in place and `TryPush()` fails
+ * when the ring buffer is full. `TryPush()` may be called from any thread concurrently, while `TryPop()` must only
+ * be called from a single consumer thread.
+ *
+ * @tparam T          The type of the elements, which must be default constructible.
+ * @tparam kCapacity  The maximum number of elements, which must be a power of two.
+ *
+ */
+template <typename T, size_t kCapacity> class MpscRingBuffer
+{
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "kCapacity must be a power of two");
+
+public:
+    /**
+     * This constructor initializes an empty ring buffer.
+     *
+     */
+    MpscRingBuffer(void)
+        : mPushPosition(0)
+        , mPopPosition(0)
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mCells[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer &) = delete;
+    MpscRingBuffer &operator=(const MpscRingBuffer &) = delete;
+
+    /**
+     * This method pushes an element to the tail of the ring buffer.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in]  aValue  The element to be pushed.
+     *
+     * @retval  TRUE   The element is pushed.
+     * @retval  FALSE  The ring buffer is full.
+     *
+     */
+    bool TryPush(const T &aValue)
+    {
+        size_t position = mPushPosition.load(std::memory_order_relaxed);
+        Cell * cell;
+
+        while (true)
+        {
+            intptr_t diff;
+
+            cell = &mCells[position & kMask];
+            diff = static_cast<intptr_t>(cell->mSequence.load(std::memory_order_acquire)) -
+                   static_cast<intptr_t>(position);
+
+            if (diff == 0)
+            {
+                // The cell is free, claim it unless another producer did first.
+                if (mPushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The cell still holds the element pushed one lap earlier.
+                return false;
+            }
+            else
+            {
+                position = mPushPosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->mValue = aValue;
+        cell->mSequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * This method pops an element from the head of the ring buffer.
+     *
+     * This method must only be called by the consumer thread.
+     *
+     * @param[out]  aValue  A reference to receive the element.
+     *
+     * @retval  TRUE   An element is popped.
+     * @retval  FALSE  The ring buffer is empty, or the oldest push is still in progress.
+     *
+     */
+    bool TryPop(T &aValue)
+    {
+        size_t position = mPopPosition.load(std::memory_order_relaxed);
+        Cell & cell     = mCells[position & kMask];
+
+        if (cell.mSequence.load(std::memory_order_acquire) != position + 1)
+        {
+            return false;
+        }
+
+        aValue = std::move(cell.mValue);
+        cell.mSequence.store(position + kCapacity, std::memory_order_release);
+        mPopPosition.store(position + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /**
+     * This method returns the number of elements in the ring buffer.
+     *
+     * The number is only an estimate while elements are pushed or popped concurrently.
+     *
+     * @returns  The number of elements.
+     *
+     */
+    size_t GetSize(void) const
+    {
+        size_t pushPosition = mPushPosition.load(std::memory_order_relaxed);
+        size_t popPosition  = mPopPosition.load(std::memory_order_relaxed);
+
+        return pushPosition > popPosition ? pushPosition - popPosition : 0;
+    }
+
+    /**
+     * This method returns the capacity of the ring buffer.
+     *
+     * @returns  The maximum number of elements.
+     *
+     */
+    static constexpr size_t GetCapacity(void) { return kCapacity; }
+
+private:
+    static constexpr size_t kMask = kCapacity - 1;
+
+    struct Cell
+    {
+        // The position this cell is free to be pushed at, or that position plus one once it holds an element.
+        std::atomic<size_t> mSequence;
+        T                   mValue;
+    };
+
+    Cell                mCells[kCapacity];
+    std::atomic<size_t> mPushPosition;
+    std::atomic<size_t> mPopPosition; // Only written by the consumer.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MPSC_RING_BUFFER_HPP_
@@ -0,0 +1,59 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions of the statistics of re-advertising the SRP hosts.
+ */
+
+#ifndef OTBR_COMMON_SRP_READVERTISE_STATS_HPP_
+#define OTBR_COMMON_SRP_READVERTISE_STATS_HPP_
+
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This structure represents the statistics of re-advertising the SRP hosts after the mDNS publisher restarts.
+ *
+ * It is shared by the Advertising Proxy, which collects it, and the Rest server, which exports it.
+ *
+ */
+struct SrpReadvertiseStats
+{
+    uint32_t     mRecoveries        = 0;                    ///< The number of re-advertisements started.
+    uint32_t     mHostsPending      = 0;                    ///< The number of hosts not re-advertised yet.
+    uint64_t     mHostsReadvertised = 0;                    ///< The number of hosts re-advertised.
+    Milliseconds mLastRecoveryTime  = Milliseconds::zero(); ///< The duration of the last re-advertisement.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_SRP_READVERTISE_STATS_HPP_
@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the startup phase profiler.
+ */
+
+#define OTBR_LOG_TAG "STARTUP"
+
+#include "common/startup_profiler.hpp"
+
+#include <string>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+StartupProfiler::StartupProfiler(void)
+    : StartupProfiler(Clock::now())
+{
+}
+
+StartupProfiler::StartupProfiler(Timepoint aStart)
+    : mStart(aStart)
+    , mPhaseStart(mStart)
+    , mEnd(mStart)
+    , mFinished(false)
+{
+}
+
+StartupProfiler &StartupProfiler::Get(void)
+{
+    static StartupProfiler sStartupProfiler;
+
+    return sStartupProfiler;
+}
+
+void StartupProfiler::EndPhase(const char *aName, Timepoint aNow)
+{
+    Phase phase;
+
+    VerifyOrExit(!mFinished);
+
+    phase.mName     = aName;
+    phase.mDuration = std::chrono::duration_cast<Milliseconds>(aNow - mPhaseStart);
+    phase.mEnd      = std::chrono::duration_cast<Milliseconds>(aNow - mStart);
+    mPhases.push_back(phase);
+    mPhaseStart = aNow;
+
+    otbrLogInfo("Startup phase %s done in %lld ms, %lld ms since startup", aName,
+                static_cast<long long>(phase.mDuration.count()), static_cast<long long>(phase.mEnd.count()));
+
+exit:
+    return;
+}
+
+void StartupProfiler::Finish(Timepoint aNow)
+{
+    std::string summary;
+
+    VerifyOrExit(!mFinished);
+
+    mFinished = true;
+    mEnd      = aNow;
+
+    for (const Phase &phase : mPhases)
+    {
+        summary += (summary.empty() ? "" : ", ");
+        summary += phase.mName;
+        summary += " " + std::to_string(phase.mDuration.count()) + " ms";
+    }
+
+    otbrLogNotice("Startup done in %lld ms: %s", static_cast<long long>(GetDuration(aNow).count()), summary.c_str());
+
+exit:
+    return;
+}
+
+Milliseconds StartupProfiler::GetDuration(Timepoint aNow) const
+{
+    return std::chrono::duration_cast<Milliseconds>((mFinished ? mEnd : aNow) - mStart);
+}
+
+} // namespace otbr
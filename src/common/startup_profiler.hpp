@@ -0,0 +1,169 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions of the startup phase profiler.
+ */
+
+#ifndef OTBR_COMMON_STARTUP_PROFILER_HPP_
+#define OTBR_COMMON_STARTUP_PROFILER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <vector>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class measures the phases of the agent startup, from the start of the process to the time all the
+ * subsystems are up.
+ *
+ */
+class StartupProfiler
+{
+public:
+    /**
+     * This structure represents a finished startup phase.
+     *
+     */
+    struct Phase
+    {
+        const char * mName;     ///< The name of the phase.
+        Milliseconds mDuration; ///< The duration of the phase.
+        Milliseconds mEnd;      ///< The end of the phase since the startup began.
+    };
+
+    /**
+     * This constructor initializes the profiler, the startup begins now.
+     *
+     */
+    StartupProfiler(void);
+
+    /**
+     * This constructor initializes the profiler, the startup begins at a given time.
+     *
+     * @param[in]  aStart  The time the startup begins.
+     *
+     */
+    explicit StartupProfiler(Timepoint aStart);
+
+    /**
+     * This method returns the profiler of the agent startup.
+     *
+     * @returns  The startup profiler.
+     *
+     */
+    static StartupProfiler &Get(void);
+
+    /**
+     * This method ends the current phase, the next one begins now.
+     *
+     * This method does nothing once the startup finished.
+     *
+     * @param[in]  aName  The name of the phase, must outlive the profiler.
+     *
+     */
+    void EndPhase(const char *aName) { EndPhase(aName, Clock::now()); }
+
+    /**
+     * This method ends the current phase at a given time, the next one begins then.
+     *
+     * This method does nothing once the startup finished.
+     *
+     * @param[in]  aName  The name of the phase, must outlive the profiler.
+     * @param[in]  aNow   The time the phase ends.
+     *
+     */
+    void EndPhase(const char *aName, Timepoint aNow);
+
+    /**
+     * This method finishes the startup and logs a summary of its phases.
+     *
+     * This method does nothing if the startup already finished.
+     *
+     */
+    void Finish(void) { Finish(Clock::now()); }
+
+    /**
+     * This method finishes the startup at a given time and logs a summary of its phases.
+     *
+     * This method does nothing if the startup already finished.
+     *
+     * @param[in]  aNow  The time the startup finishes.
+     *
+     */
+    void Finish(Timepoint aNow);
+
+    /**
+     * This method indicates whether the startup finished.
+     *
+     * @returns  Whether the startup finished.
+     *
+     */
+    bool IsFinished(void) const { return mFinished; }
+
+    /**
+     * This method returns the finished phases.
+     *
+     * @returns  The finished phases in the order they ended.
+     *
+     */
+    const std::vector<Phase> &GetPhases(void) const { return mPhases; }
+
+    /**
+     * This method returns the duration of the startup.
+     *
+     * @returns  The time from the startup beginning to its end, or until now if not finished yet.
+     *
+     */
+    Milliseconds GetDuration(void) const { return GetDuration(Clock::now()); }
+
+    /**
+     * This method returns the duration of the startup.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     * @returns  The time from the startup beginning to its end, or until @p aNow if not finished yet.
+     *
+     */
+    Milliseconds GetDuration(Timepoint aNow) const;
+
+private:
+    Timepoint          mStart;
+    Timepoint          mPhaseStart;
+    Timepoint          mEnd;
+    bool               mFinished;
+    std::vector<Phase> mPhases;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STARTUP_PROFILER_HPP_
@@ -39,11 +39,12 @@
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
+#include "common/trace.hpp"
 
 namespace otbr {
 
 TaskRunner::TaskRunner(void)
-    : mTaskQueue(DelayedTask::Comparator{})
+    : mWakeUpPending(false)
 {
     int flags;
 
@@ -70,29 +71,92 @@ TaskRunner::~TaskRunner(void)
     }
 }
 
-void TaskRunner::Post(const Task<void> aTask)
+void TaskRunner::Post(InlineTask aTask)
 {
-    Post(Milliseconds::zero(), std::move(aTask));
+    otbrProbe(task__post, 0);
+    mImmediateTasks.Push(std::move(aTask));
+    WakeUp();
 }
 
-void TaskRunner::Post(Milliseconds aDelay, const Task<void> aTask)
+TaskRunner::TaskHandle TaskRunner::Post(Milliseconds aDelay, InlineTask aTask)
 {
-    PushTask(aDelay, std::move(aTask));
+    TimerWheel::TimerId timerId;
+    bool                isEarliest;
+
+    otbrProbe(task__post, static_cast<int64_t>(aDelay.count()));
+
+    // The braces here are necessary for auto-releasing of the mutex.
+    {
+        std::lock_guard<std::mutex> _(mTimersMutex);
+        Timepoint                   deadline = Clock::now() + aDelay;
+
+        isEarliest = deadline < mTimers.GetNextDeadline();
+        timerId    = mTimers.Add(deadline, std::move(aTask));
+    }
+
+    // The mainloop only needs to recalculate its timeout when the new task is the earliest.
+    if (isEarliest)
+    {
+        WakeUp();
+    }
+
+    return TaskHandle(*this, timerId);
+}
+
+bool TaskRunner::TaskHandle::Cancel(void)
+{
+    return mTaskRunner != nullptr && mTaskRunner->Cancel(mTimerId);
+}
+
+bool TaskRunner::TaskHandle::Reschedule(Milliseconds aDelay)
+{
+    return mTaskRunner != nullptr && mTaskRunner->Reschedule(mTimerId, aDelay);
+}
+
+bool TaskRunner::Cancel(TimerWheel::TimerId aTimerId)
+{
+    std::lock_guard<std::mutex> _(mTimersMutex);
+
+    return mTimers.Cancel(aTimerId);
+}
+
+bool TaskRunner::Reschedule(TimerWheel::TimerId aTimerId, Milliseconds aDelay)
+{
+    bool rescheduled;
+    bool isEarliest;
+
+    // The braces here are necessary for auto-releasing of the mutex.
+    {
+        std::lock_guard<std::mutex> _(mTimersMutex);
+        Timepoint                   deadline = Clock::now() + aDelay;
+
+        isEarliest  = deadline < mTimers.GetNextDeadline();
+        rescheduled = mTimers.Reschedule(aTimerId, deadline);
+    }
+
+    if (rescheduled && isEarliest)
+    {
+        WakeUp();
+    }
+
+    return rescheduled;
 }
 
 void TaskRunner::Update(MainloopContext &aMainloop)
 {
+    std::lock_guard<std::mutex> _(mTimersMutex);
+
     FD_SET(mEventFd[kRead], &aMainloop.mReadFdSet);
     aMainloop.mMaxFd = std::max(mEventFd[kRead], aMainloop.mMaxFd);
 
-    if (!mTaskQueue.empty())
+    if (!mTimers.IsEmpty())
     {
-        auto  now     = Clock::now();
-        auto &task    = mTaskQueue.top();
-        auto  delay   = std::chrono::duration_cast<Microseconds>(task.GetTimeExecute() - now);
-        auto  timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+        auto now      = Clock::now();
+        auto deadline = mTimers.GetNextDeadline();
+        auto delay    = std::chrono::duration_cast<Microseconds>(deadline - now);
+        auto timeout  = FromTimeval<Microseconds>(aMainloop.mTimeout);
 
-        if (task.GetTimeExecute() < now)
+        if (deadline < now)
         {
             delay = Microseconds::zero();
         }
@@ -107,14 +171,14 @@ void TaskRunner::Update(MainloopContext &aMainloop)
 
 void TaskRunner::Process(const MainloopContext &aMainloop)
 {
-    OTBR_UNUSED_VARIABLE(aMainloop);
-
     ssize_t rval;
 
+    VerifyOrExit(FD_ISSET(mEventFd[kRead], &aMainloop.mReadFdSet));
+
     // Read any data in the pipe.
     do
     {
-        uint8_t n;
+        uint8_t n[16];
 
         rval = read(mEventFd[kRead], &n, sizeof(n));
     } while (rval > 0 || (rval == -1 && errno == EINTR));
@@ -122,16 +186,20 @@ void TaskRunner::Process(const MainloopContext &aMainloop)
     // Critical error happens, simply die.
     VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
 
+    // Tasks posted from now on must wake up the mainloop again.
+    mWakeUpPending.store(false);
+
+exit:
     PopTasks();
 }
 
-void TaskRunner::PushTask(Milliseconds aDelay, const Task<void> aTask)
+void TaskRunner::WakeUp(void)
 {
-    ssize_t                     rval;
-    const uint8_t               kOne = 1;
-    std::lock_guard<std::mutex> _(mTaskQueueMutex);
+    ssize_t       rval;
+    const uint8_t kOne = 1;
+
+    VerifyOrExit(!mWakeUpPending.exchange(true));
 
-    mTaskQueue.emplace(aDelay, std::move(aTask));
     do
     {
         rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
@@ -152,26 +220,31 @@ exit:
 
 void TaskRunner::PopTasks(void)
 {
-    while (true)
+    InlineTask task;
+
+    // Tasks posted by the tasks executed here are also executed in this round.
+    while (mImmediateTasks.Pop(task))
     {
-        Task<void> task;
+        otbrProbe(task__run__start, 0);
+        task();
+        otbrProbe(task__run__end, 0);
+    }
 
+    while (true)
+    {
         // The braces here are necessary for auto-releasing of the mutex.
         {
-            std::lock_guard<std::mutex> _(mTaskQueueMutex);
+            std::lock_guard<std::mutex> _(mTimersMutex);
 
-            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= Clock::now())
-            {
-                task = std::move(mTaskQueue.top().mTask);
-                mTaskQueue.pop();
-            }
-            else
+            if (!mTimers.PopExpired(Clock::now(), task))
             {
                 break;
             }
         }
 
+        otbrProbe(task__run__start, 1);
         task();
+        otbrProbe(task__run__end, 1);
     }
 }
 
@@ -36,14 +36,19 @@
 
 #include <openthread-br/config.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
-#include <queue>
 
+#include "common/inline_task.hpp"
 #include "common/mainloop.hpp"
+#include "common/mpsc_queue.hpp"
 #include "common/time.hpp"
+#include "common/timer_wheel.hpp"
+#include "common/types.hpp"
 
 namespace otbr {
 
@@ -61,6 +66,63 @@ public:
      */
     template <class T> using Task = std::function<T(void)>;
 
+    /**
+     * This class represents a delayed task posted to a task runner.
+     *
+     * A handle is cheap to copy and may outlive both the task and the task runner, as long as it is not used
+     * after the task runner is destroyed.
+     *
+     */
+    class TaskHandle
+    {
+    public:
+        /**
+         * This constructor initializes a handle which refers to no task.
+         *
+         */
+        TaskHandle(void)
+            : mTaskRunner(nullptr)
+            , mTimerId(TimerWheel::kInvalidTimerId)
+        {
+        }
+
+        /**
+         * This method cancels the task, and releases it immediately.
+         *
+         * It is safe to call this method in different threads concurrently.
+         *
+         * @retval  TRUE   The task is cancelled and will not be executed.
+         * @retval  FALSE  The task has been executed, is being executed, or has been cancelled already.
+         *
+         */
+        bool Cancel(void);
+
+        /**
+         * This method delays the task to `aDelay` milliseconds from now.
+         *
+         * It is safe to call this method in different threads concurrently.
+         *
+         * @param[in]  aDelay  The new delay before executing the task (in milliseconds).
+         *
+         * @retval  TRUE   The task is rescheduled.
+         * @retval  FALSE  The task has been executed, is being executed, or has been cancelled already.
+         *
+         */
+        bool Reschedule(Milliseconds aDelay);
+
+    private:
+        friend class TaskRunner;
+
+        TaskHandle(TaskRunner &aTaskRunner, TimerWheel::TimerId aTimerId)
+            : mTaskRunner(&aTaskRunner)
+            , mTimerId(aTimerId)
+        {
+        }
+
+        TaskRunner *        mTaskRunner;
+        TimerWheel::TimerId mTimerId;
+    };
+
     /**
      * This constructor initializes the Task Runner instance.
      *
@@ -77,12 +139,16 @@ public:
      * This method posts a task to the task runner and returns immediately.
      *
      * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
-     * It is safe to call this method in different threads concurrently.
+     * It is safe to call this method in different threads concurrently. This method
+     * is lock-free and only wakes up the mainloop if it is not already woken up.
+     *
+     * The task is moved rather than copied, and a lambda of up to `InlineTask::kCapacity`
+     * bytes is posted without allocating for the task itself.
      *
      * @param[in]  aTask  The task to be executed.
      *
      */
-    void Post(const Task<void> aTask);
+    void Post(InlineTask aTask);
 
     /**
      * This method posts a task to the task runner and returns immediately.
@@ -92,8 +158,10 @@ public:
      * @param[in]  aDelay  The delay before executing the task (in milliseconds).
      * @param[in]  aTask   The task to be executed.
      *
+     * @returns  A handle to cancel or reschedule the task.
+     *
      */
-    void Post(Milliseconds aDelay, const Task<void> aTask);
+    TaskHandle Post(Milliseconds aDelay, InlineTask aTask);
 
     /**
      * This method posts a task and waits for the completion of the task.
@@ -114,6 +182,57 @@ public:
         return pro.get_future().get();
     }
 
+    /**
+     * This method posts a task and returns a future of the result of the task.
+     *
+     * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
+     * This method returns immediately, so that a thread other than the mainloop thread
+     * can issue many tasks before waiting for any of them.
+     *
+     * @param[in]  aTask  The task to be executed.
+     *
+     * @returns  A future which becomes ready when the task @p aTask has been executed.
+     *
+     */
+    template <class T> std::future<T> PostAsync(Task<T> aTask)
+    {
+        auto task   = std::make_shared<std::packaged_task<T(void)>>(std::move(aTask));
+        auto future = task->get_future();
+
+        Post([task]() { (*task)(); });
+
+        return future;
+    }
+
+    /**
+     * This method posts a task and waits for the completion of the task for at most @p aTimeout.
+     *
+     * This method must be called in a thread other than the mainloop thread. If the wait
+     * times out, the task is still executed later on the mainloop and its result is dropped,
+     * so @p aTask must not capture anything by reference that it may outlive.
+     *
+     * @param[in]   aTask     The task to be executed.
+     * @param[in]   aTimeout  The maximum time to wait for the task to complete.
+     * @param[out]  aResult   The result returned by the task @p aTask.
+     *
+     * @retval  OTBR_ERROR_NONE     The task completed and @p aResult is set.
+     * @retval  OTBR_ERROR_TIMEOUT  The task did not complete within @p aTimeout.
+     *
+     */
+    template <class T> otbrError PostAndWait(Task<T> aTask, Milliseconds aTimeout, T &aResult)
+    {
+        otbrError      error  = OTBR_ERROR_TIMEOUT;
+        std::future<T> future = PostAsync<T>(std::move(aTask));
+
+        if (future.wait_for(aTimeout) == std::future_status::ready)
+        {
+            aResult = future.get();
+            error   = OTBR_ERROR_NONE;
+        }
+
+        return error;
+    }
+
     /**
      * This method updates the mainloop context.
      *
@@ -137,47 +256,29 @@ private:
         kWrite = 1,
     };
 
-    struct DelayedTask
-    {
-        friend class Comparator;
-
-        struct Comparator
-        {
-            bool operator()(const DelayedTask &aLhs, const DelayedTask &aRhs) const { return aRhs < aLhs; }
-        };
-
-        DelayedTask(Milliseconds aDelay, Task<void> aTask)
-            : mTimeCreated(Clock::now())
-            , mDelay(aDelay)
-            , mTask(std::move(aTask))
-        {
-        }
-
-        bool operator<(const DelayedTask &aOther) const
-        {
-            return GetTimeExecute() <= aOther.GetTimeExecute() ||
-                   (GetTimeExecute() == aOther.GetTimeExecute() && mTimeCreated < aOther.mTimeCreated);
-        }
-
-        Timepoint GetTimeExecute(void) const { return mTimeCreated + mDelay; }
-
-        Timepoint    mTimeCreated;
-        Milliseconds mDelay;
-        Task<void>   mTask;
-    };
-
-    void PushTask(Milliseconds aDelay, const Task<void> aTask);
+    bool Cancel(TimerWheel::TimerId aTimerId);
+    bool Reschedule(TimerWheel::TimerId aTimerId, Milliseconds aDelay);
     void PopTasks(void);
+    void WakeUp(void);
 
     // The event fds which are used to wakeup the mainloop
     // when there are pending tasks in the task queue.
     int mEventFd[2];
 
-    std::priority_queue<DelayedTask, std::vector<DelayedTask>, DelayedTask::Comparator> mTaskQueue;
+    // Whether the mainloop has been woken up and not yet processed
+    // the tasks, so that only the first of a batch of tasks writes
+    // to the pipe.
+    std::atomic<bool> mWakeUpPending;
+
+    // The tasks to be executed immediately.
+    MpscQueue<InlineTask> mImmediateTasks;
+
+    // The delayed tasks.
+    TimerWheel mTimers;
 
-    // The mutex which protects the `mTaskQueue` from being
+    // The mutex which protects the `mTimers` from being
     // simultaneously accessed by multiple threads.
-    std::mutex mTaskQueueMutex;
+    std::mutex mTimersMutex;
 };
 
 } // namespace otbr
@@ -0,0 +1,248 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the scheduling policy and CPU affinity of the agent threads.
+ */
+
+#include "common/thread_schedule.hpp"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace {
+
+bool           sHasHousekeepingSchedule = false;
+ThreadSchedule sHousekeepingSchedule;
+
+bool ParseInt(const char *aArg, char *&aEnd, long aMin, long aMax, int &aValue)
+{
+    bool ok = false;
+    long value;
+
+    errno = 0;
+    value = strtol(aArg, &aEnd, 10);
+
+    VerifyOrExit(aEnd != aArg && errno == 0 && value >= aMin && value <= aMax);
+    aValue = static_cast<int>(value);
+    ok     = true;
+
+exit:
+    return ok;
+}
+
+} // namespace
+
+ThreadSchedule::ThreadSchedule(void)
+    : mPolicy(SCHED_OTHER)
+    , mPriority(0)
+    , mNice(0)
+{
+    CPU_ZERO(&mCpus);
+}
+
+otbrError ParseSchedulePolicy(const char *aArg, ThreadSchedule &aSchedule)
+{
+    otbrError   error      = OTBR_ERROR_INVALID_ARGS;
+    const char *colon      = strchr(aArg, ':');
+    size_t      nameLength = (colon != nullptr) ? static_cast<size_t>(colon - aArg) : strlen(aArg);
+    char *      end;
+    int         policy;
+    int         value = 0;
+
+    if (nameLength == strlen("fifo") && !strncmp(aArg, "fifo", nameLength))
+    {
+        policy = SCHED_FIFO;
+    }
+    else if (nameLength == strlen("rr") && !strncmp(aArg, "rr", nameLength))
+    {
+        policy = SCHED_RR;
+    }
+    else if (nameLength == strlen("other") && !strncmp(aArg, "other", nameLength))
+    {
+        policy = SCHED_OTHER;
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    if (policy == SCHED_OTHER)
+    {
+        // The niceness is optional for the normal policy.
+        if (colon != nullptr)
+        {
+            SuccessOrExit(ParseNice(colon + 1, value));
+        }
+        aSchedule.mNice     = value;
+        aSchedule.mPriority = 0;
+    }
+    else
+    {
+        VerifyOrExit(colon != nullptr);
+        VerifyOrExit(ParseInt(colon + 1, end, sched_get_priority_min(policy), sched_get_priority_max(policy), value));
+        VerifyOrExit(*end == '\0');
+        aSchedule.mPriority = value;
+    }
+
+    aSchedule.mPolicy = policy;
+    error             = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError ParseCpuList(const char *aArg, cpu_set_t &aCpus)
+{
+    otbrError   error = OTBR_ERROR_INVALID_ARGS;
+    const char *cur   = aArg;
+    char *      end;
+    int         first;
+    int         last;
+
+    CPU_ZERO(&aCpus);
+
+    while (true)
+    {
+        VerifyOrExit(ParseInt(cur, end, 0, CPU_SETSIZE - 1, first));
+        last = first;
+
+        if (*end == '-')
+        {
+            cur = end + 1;
+            VerifyOrExit(ParseInt(cur, end, first, CPU_SETSIZE - 1, last));
+        }
+
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            CPU_SET(cpu, &aCpus);
+        }
+
+        if (*end == '\0')
+        {
+            break;
+        }
+
+        VerifyOrExit(*end == ',');
+        cur = end + 1;
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError ParseNice(const char *aArg, int &aNice)
+{
+    otbrError error = OTBR_ERROR_INVALID_ARGS;
+    char *    end;
+
+    VerifyOrExit(ParseInt(aArg, end, -20, 19, aNice));
+    VerifyOrExit(*end == '\0');
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError GetThreadSchedule(ThreadSchedule &aSchedule)
+{
+    otbrError          error = OTBR_ERROR_ERRNO;
+    ThreadSchedule     schedule;
+    struct sched_param param;
+
+    VerifyOrExit(sched_getaffinity(0, sizeof(schedule.mCpus), &schedule.mCpus) == 0);
+    VerifyOrExit((schedule.mPolicy = sched_getscheduler(0)) >= 0);
+    VerifyOrExit(sched_getparam(0, &param) == 0);
+    schedule.mPriority = param.sched_priority;
+
+    // A niceness of -1 is valid, so failures are only told by errno.
+    errno          = 0;
+    schedule.mNice = getpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)));
+    VerifyOrExit(errno == 0);
+
+    aSchedule = schedule;
+    error     = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError ApplyThreadSchedule(const ThreadSchedule &aSchedule)
+{
+    otbrError          error = OTBR_ERROR_ERRNO;
+    struct sched_param param;
+
+    // On Linux, these calls with a zero pid or the thread ID change the calling thread only.
+    if (CPU_COUNT(&aSchedule.mCpus) > 0)
+    {
+        VerifyOrExit(sched_setaffinity(0, sizeof(aSchedule.mCpus), &aSchedule.mCpus) == 0);
+    }
+
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = (aSchedule.mPolicy == SCHED_OTHER) ? 0 : aSchedule.mPriority;
+    VerifyOrExit(sched_setscheduler(0, aSchedule.mPolicy, &param) == 0);
+
+    if (aSchedule.mPolicy == SCHED_OTHER)
+    {
+        VerifyOrExit(setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), aSchedule.mNice) == 0);
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+void SetHousekeepingSchedule(const ThreadSchedule &aSchedule)
+{
+    sHousekeepingSchedule    = aSchedule;
+    sHasHousekeepingSchedule = true;
+}
+
+void ClearHousekeepingSchedule(void)
+{
+    sHasHousekeepingSchedule = false;
+}
+
+otbrError ApplyHousekeepingSchedule(void)
+{
+    return sHasHousekeepingSchedule ? ApplyThreadSchedule(sHousekeepingSchedule) : OTBR_ERROR_NONE;
+}
+
+} // namespace otbr
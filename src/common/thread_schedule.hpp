@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the scheduling policy and CPU affinity of the agent threads.
+ */
+
+#ifndef OTBR_COMMON_THREAD_SCHEDULE_HPP_
+#define OTBR_COMMON_THREAD_SCHEDULE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <sched.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This structure represents the scheduling parameters of a thread.
+ *
+ */
+struct ThreadSchedule
+{
+    /**
+     * This constructor initializes the parameters of a normal thread on all CPUs allowed to the process.
+     *
+     */
+    ThreadSchedule(void);
+
+    int       mPolicy;   ///< The scheduling policy, `SCHED_OTHER`, `SCHED_FIFO` or `SCHED_RR`.
+    int       mPriority; ///< The static priority of `SCHED_FIFO` and `SCHED_RR`.
+    int       mNice;     ///< The niceness of `SCHED_OTHER`.
+    cpu_set_t mCpus;     ///< The CPUs the thread may run on, empty to keep the CPUs of the thread.
+};
+
+/**
+ * This function parses a scheduling policy of the form `fifo:PRIORITY`, `rr:PRIORITY` or `other[:NICE]`.
+ *
+ * @param[in]   aArg       The string to parse.
+ * @param[out]  aSchedule  The schedule whose policy and priority or niceness are set.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully parsed the policy.
+ * @retval OTBR_ERROR_INVALID_ARGS  @p aArg is not a valid policy, or the priority is out of the range of the policy.
+ *
+ */
+otbrError ParseSchedulePolicy(const char *aArg, ThreadSchedule &aSchedule);
+
+/**
+ * This function parses a CPU list of the form `0,2-3`.
+ *
+ * @param[in]   aArg   The string to parse.
+ * @param[out]  aCpus  The CPU set.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully parsed the CPU list.
+ * @retval OTBR_ERROR_INVALID_ARGS  @p aArg is not a valid CPU list.
+ *
+ */
+otbrError ParseCpuList(const char *aArg, cpu_set_t &aCpus);
+
+/**
+ * This function parses a niceness between -20 and 19.
+ *
+ * @param[in]   aArg   The string to parse.
+ * @param[out]  aNice  The niceness.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully parsed the niceness.
+ * @retval OTBR_ERROR_INVALID_ARGS  @p aArg is not a valid niceness.
+ *
+ */
+otbrError ParseNice(const char *aArg, int &aNice);
+
+/**
+ * This function gets the schedule of the calling thread.
+ *
+ * @param[out]  aSchedule  The schedule.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully got the schedule.
+ * @retval OTBR_ERROR_ERRNO  Failed to get the schedule, @p aSchedule is left unchanged.
+ *
+ */
+otbrError GetThreadSchedule(ThreadSchedule &aSchedule);
+
+/**
+ * This function applies a schedule to the calling thread.
+ *
+ * @param[in]  aSchedule  The schedule.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully applied the schedule.
+ * @retval OTBR_ERROR_ERRNO  Failed to apply the schedule, e.g. a real-time policy without `CAP_SYS_NICE`.
+ *
+ */
+otbrError ApplyThreadSchedule(const ThreadSchedule &aSchedule);
+
+/**
+ * This function sets the schedule of the housekeeping threads, i.e. the workers, the logging thread and other
+ * threads that do not serve the radio.
+ *
+ * Threads inherit the schedule of the thread creating them, so this must be called before the mainloop thread gets
+ * a real-time schedule and before any housekeeping thread is started.
+ *
+ * @param[in]  aSchedule  The schedule.
+ *
+ */
+void SetHousekeepingSchedule(const ThreadSchedule &aSchedule);
+
+/**
+ * This function clears the schedule of the housekeeping threads, so that they keep the inherited schedule.
+ *
+ */
+void ClearHousekeepingSchedule(void);
+
+/**
+ * This function applies the housekeeping schedule to the calling thread.
+ *
+ * Housekeeping threads call this when they start. It does nothing if no housekeeping schedule is set.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully applied the schedule, or there is no housekeeping schedule.
+ * @retval OTBR_ERROR_ERRNO  Failed to apply the schedule.
+ *
+ */
+otbrError ApplyHousekeepingSchedule(void);
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_THREAD_SCHEDULE_HPP_
@@ -0,0 +1,344 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the hierarchical timer wheel.
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+constexpr uint8_t  TimerWheel::kSlotBits;
+constexpr uint8_t  TimerWheel::kSlots;
+constexpr uint64_t TimerWheel::kSlotMask;
+constexpr uint8_t  TimerWheel::kLevels;
+constexpr uint8_t  TimerWheel::kLevelOverflow;
+constexpr uint8_t  TimerWheel::kLevelExpired;
+
+constexpr TimerWheel::TimerId TimerWheel::kInvalidTimerId;
+
+TimerWheel::TimerWheel(Timepoint aStart)
+    : mStart(aStart)
+    , mCurrentTick(0)
+    , mNextTimerId(kInvalidTimerId + 1)
+{
+    std::fill(std::begin(mOccupied), std::end(mOccupied), 0);
+}
+
+TimerWheel::TimerId TimerWheel::Add(Timepoint aDeadline, Task aTask)
+{
+    TimerList timers;
+    TimerId   id = mNextTimerId++;
+
+    timers.emplace_back(id, ToTick(aDeadline, /* aRoundUp */ true), std::move(aTask));
+    mTimers[id] = timers.begin();
+    Schedule(timers, timers.begin());
+
+    return id;
+}
+
+bool TimerWheel::Cancel(TimerId aTimerId)
+{
+    auto      it     = mTimers.find(aTimerId);
+    bool      cancel = (it != mTimers.end());
+    TimerList timers;
+
+    VerifyOrExit(cancel);
+
+    // The task is destroyed together with `timers`.
+    Unlink(it->second, timers);
+    mTimers.erase(it);
+
+exit:
+    return cancel;
+}
+
+bool TimerWheel::Reschedule(TimerId aTimerId, Timepoint aDeadline)
+{
+    auto      it         = mTimers.find(aTimerId);
+    bool      reschedule = (it != mTimers.end());
+    TimerList timers;
+
+    VerifyOrExit(reschedule);
+
+    Unlink(it->second, timers);
+    it->second->mExpire = ToTick(aDeadline, /* aRoundUp */ true);
+    Schedule(timers, it->second);
+
+exit:
+    return reschedule;
+}
+
+Timepoint TimerWheel::GetNextDeadline(void) const
+{
+    uint64_t next = std::numeric_limits<uint64_t>::max();
+
+    VerifyOrExit(mExpired.empty(), next = mExpired.front().mExpire);
+
+    // Timers of a lower level always expire before timers of a higher level, and the slots of a level are ordered
+    // by expiration since all timers of a level share the higher slot indexes with the current tick.
+    for (uint8_t level = 0; level < kLevels; ++level)
+    {
+        uint8_t slot;
+
+        if (mOccupied[level] == 0)
+        {
+            continue;
+        }
+
+        slot = CountTrailingZeros(mOccupied[level]);
+
+        if (level == 0)
+        {
+            // All timers of a level 0 slot expire at the tick of that slot.
+            next = (mCurrentTick & ~kSlotMask) | slot;
+        }
+        else
+        {
+            for (const Timer &timer : mSlots[level][slot])
+            {
+                next = std::min(next, timer.mExpire);
+            }
+        }
+
+        ExitNow();
+    }
+
+    for (const Timer &timer : mOverflow)
+    {
+        next = std::min(next, timer.mExpire);
+    }
+
+exit:
+    return next == std::numeric_limits<uint64_t>::max() ? Timepoint::max() : mStart + Milliseconds(next);
+}
+
+bool TimerWheel::PopExpired(Timepoint aNow, Task &aTask)
+{
+    bool popped = false;
+
+    Advance(ToTick(aNow, /* aRoundUp */ false));
+    VerifyOrExit(!mExpired.empty());
+
+    aTask = std::move(mExpired.front().mTask);
+    mTimers.erase(mExpired.front().mId);
+    mExpired.pop_front();
+    popped = true;
+
+exit:
+    return popped;
+}
+
+uint8_t TimerWheel::CountTrailingZeros(uint64_t aBits)
+{
+    return static_cast<uint8_t>(__builtin_ctzll(aBits));
+}
+
+uint64_t TimerWheel::ToTick(Timepoint aTimepoint, bool aRoundUp) const
+{
+    int64_t us = std::chrono::duration_cast<Microseconds>(aTimepoint - mStart).count();
+
+    if (us <= 0)
+    {
+        us = 0;
+    }
+    else if (aRoundUp)
+    {
+        us += 999;
+    }
+
+    return static_cast<uint64_t>(us / 1000);
+}
+
+TimerWheel::TimerList &TimerWheel::GetList(const Timer &aTimer)
+{
+    return aTimer.mLevel == kLevelExpired
+               ? mExpired
+               : (aTimer.mLevel == kLevelOverflow ? mOverflow : mSlots[aTimer.mLevel][aTimer.mSlot]);
+}
+
+void TimerWheel::Unlink(TimerList::iterator aTimer, TimerList &aTo)
+{
+    TimerList &from = GetList(*aTimer);
+
+    aTo.splice(aTo.end(), from, aTimer);
+
+    if (aTimer->mLevel < kLevels && from.empty())
+    {
+        mOccupied[aTimer->mLevel] &= ~(1ULL << aTimer->mSlot);
+    }
+}
+
+void TimerWheel::Schedule(TimerList &aFrom, TimerList::iterator aTimer)
+{
+    // The ticks before the current tick have been processed, timers for them have already expired.
+    if (aTimer->mExpire < mCurrentTick)
+    {
+        aTimer->mLevel = kLevelExpired;
+        mExpired.splice(mExpired.end(), aFrom, aTimer);
+    }
+    else
+    {
+        Place(aFrom, aTimer);
+    }
+}
+
+void TimerWheel::Place(TimerList &aFrom, TimerList::iterator aTimer)
+{
+    uint64_t   expire = aTimer->mExpire;
+    TimerList *to     = &mOverflow;
+
+    for (uint8_t level = 0; level < kLevels; ++level)
+    {
+        uint8_t shift = level * kSlotBits;
+
+        // A timer is placed in the level of the highest slot index which differs from the current tick, so that
+        // all timers with the same expiration tick are always in the same slot and keep their order.
+        if ((expire >> (shift + kSlotBits)) == (mCurrentTick >> (shift + kSlotBits)))
+        {
+            uint8_t slot = static_cast<uint8_t>((expire >> shift) & kSlotMask);
+
+            to = &mSlots[level][slot];
+            mOccupied[level] |= (1ULL << slot);
+            aTimer->mLevel = level;
+            aTimer->mSlot  = slot;
+            break;
+        }
+    }
+
+    if (to == &mOverflow)
+    {
+        aTimer->mLevel = kLevelOverflow;
+    }
+
+    to->splice(to->end(), aFrom, aTimer);
+}
+
+void TimerWheel::Cascade(uint8_t aLevel, uint8_t aSlot)
+{
+    TimerList timers;
+
+    timers.splice(timers.end(), mSlots[aLevel][aSlot]);
+    mOccupied[aLevel] &= ~(1ULL << aSlot);
+
+    while (!timers.empty())
+    {
+        Place(timers, timers.begin());
+    }
+}
+
+void TimerWheel::Advance(uint64_t aNowTick)
+{
+    while (mCurrentTick <= aNowTick)
+    {
+        uint8_t slot = static_cast<uint8_t>(mCurrentTick & kSlotMask);
+
+        if (mOccupied[0] & (1ULL << slot))
+        {
+            for (Timer &timer : mSlots[0][slot])
+            {
+                timer.mLevel = kLevelExpired;
+            }
+
+            mExpired.splice(mExpired.end(), mSlots[0][slot]);
+            mOccupied[0] &= ~(1ULL << slot);
+        }
+
+        mCurrentTick = std::min(GetNextTickToProcess(), aNowTick + 1);
+
+        // Cascade as soon as a boundary is reached, so that the timers are always in the level matching the current
+        // tick, even for timers added before the tick is processed.
+        CascadeAt(mCurrentTick);
+    }
+}
+
+void TimerWheel::CascadeAt(uint64_t aTick)
+{
+    // Cascade from the top level so that the timers reach level 0 before their tick is processed.
+    if ((aTick & ((1ULL << (kLevels * kSlotBits)) - 1)) == 0 && !mOverflow.empty())
+    {
+        TimerList timers;
+
+        timers.splice(timers.end(), mOverflow);
+
+        while (!timers.empty())
+        {
+            Place(timers, timers.begin());
+        }
+    }
+
+    for (uint8_t level = kLevels - 1; level > 0; --level)
+    {
+        uint8_t shift = level * kSlotBits;
+
+        if ((aTick & ((1ULL << shift) - 1)) == 0)
+        {
+            Cascade(level, static_cast<uint8_t>((aTick >> shift) & kSlotMask));
+        }
+    }
+}
+
+uint64_t TimerWheel::GetNextTickToProcess(void) const
+{
+    uint64_t next = mCurrentTick + 1;
+    uint64_t nextTick;
+    uint64_t bits;
+
+    // Every slot boundary of level 0 may need to cascade timers.
+    VerifyOrExit((next & kSlotMask) != 0, nextTick = next);
+
+    bits = mOccupied[0] >> (next & kSlotMask);
+    VerifyOrExit(bits == 0, nextTick = next + CountTrailingZeros(bits));
+
+    nextTick = std::numeric_limits<uint64_t>::max();
+
+    // Skip to the boundary of the lowest level which has timers, nothing happens before it.
+    for (uint8_t level = 1; level <= kLevels; ++level)
+    {
+        if (level == kLevels ? !mOverflow.empty() : mOccupied[level] != 0)
+        {
+            uint64_t range = 1ULL << (level * kSlotBits);
+
+            nextTick = (next + range - 1) & ~(range - 1);
+            break;
+        }
+    }
+
+exit:
+    return nextTick;
+}
+
+} // namespace otbr
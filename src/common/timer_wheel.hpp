@@ -0,0 +1,211 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the hierarchical timer wheel.
+ */
+
+#ifndef OTBR_COMMON_TIMER_WHEEL_HPP_
+#define OTBR_COMMON_TIMER_WHEEL_HPP_
+
+#include <list>
+#include <unordered_map>
+
+#include <stdint.h>
+
+#include "common/inline_task.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a hierarchical timer wheel with a resolution of one millisecond.
+ *
+ * Adding a timer and expiring a timer are O(1). Timers are kept in `kLevels` wheels of `kSlots` slots, each
+ * level covering `kSlots` times the range of the previous one. Timers of a higher level are cascaded to the
+ * lower levels when their slot is reached, timers beyond the range of the top level (about 4.6 hours) wait in
+ * an overflow list.
+ *
+ * Timers with the same deadline expire in the order they are added. Timers never expire before their deadline,
+ * but may expire up to one millisecond after it.
+ *
+ * This class is not thread-safe.
+ *
+ */
+class TimerWheel
+{
+public:
+    /**
+     * This type represents the task to be executed when a timer expires.
+     *
+     */
+    using Task = InlineTask;
+
+    /**
+     * This type represents the identifier of a timer.
+     *
+     */
+    using TimerId = uint64_t;
+
+    /**
+     * The invalid timer identifier, which never refers to a timer.
+     *
+     */
+    static constexpr TimerId kInvalidTimerId = 0;
+
+    /**
+     * This constructor initializes an empty timer wheel.
+     *
+     * @param[in]  aStart  The time point where the wheel starts, no deadline may be earlier than it.
+     *
+     */
+    explicit TimerWheel(Timepoint aStart = Clock::now());
+
+    /**
+     * This method adds a timer.
+     *
+     * @param[in]  aDeadline  The time point when the timer expires.
+     * @param[in]  aTask      The task to be executed when the timer expires.
+     *
+     * @returns  The identifier of the timer, which is valid until the timer is popped or cancelled.
+     *
+     */
+    TimerId Add(Timepoint aDeadline, Task aTask);
+
+    /**
+     * This method cancels a timer and destroys its task.
+     *
+     * @param[in]  aTimerId  The identifier of the timer.
+     *
+     * @retval  TRUE   The timer is cancelled.
+     * @retval  FALSE  The timer has been popped or cancelled already.
+     *
+     */
+    bool Cancel(TimerId aTimerId);
+
+    /**
+     * This method changes the deadline of a timer.
+     *
+     * The timer is ordered as if it were added again with the new deadline.
+     *
+     * @param[in]  aTimerId   The identifier of the timer.
+     * @param[in]  aDeadline  The new time point when the timer expires.
+     *
+     * @retval  TRUE   The timer is rescheduled.
+     * @retval  FALSE  The timer has been popped or cancelled already.
+     *
+     */
+    bool Reschedule(TimerId aTimerId, Timepoint aDeadline);
+
+    /**
+     * This method indicates whether there are no timers.
+     *
+     * @retval  TRUE   There are no timers.
+     * @retval  FALSE  There are timers, expired or not.
+     *
+     */
+    bool IsEmpty(void) const { return mTimers.empty(); }
+
+    /**
+     * This method returns the earliest deadline of all timers.
+     *
+     * @returns  The earliest deadline, or `Timepoint::max()` if there are no timers.
+     *
+     */
+    Timepoint GetNextDeadline(void) const;
+
+    /**
+     * This method pops the task of the next expired timer.
+     *
+     * @param[in]   aNow   The current time.
+     * @param[out]  aTask  A reference to receive the task.
+     *
+     * @retval  TRUE   A task is popped.
+     * @retval  FALSE  No timer has expired by @p aNow.
+     *
+     */
+    bool PopExpired(Timepoint aNow, Task &aTask);
+
+private:
+    static constexpr uint8_t  kSlotBits = 6;
+    static constexpr uint8_t  kSlots    = 1 << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlots - 1;
+    static constexpr uint8_t  kLevels   = 4;
+
+    // The pseudo levels of the timers which are not in a wheel.
+    static constexpr uint8_t kLevelOverflow = kLevels;
+    static constexpr uint8_t kLevelExpired  = kLevels + 1;
+
+    struct Timer
+    {
+        Timer(TimerId aId, uint64_t aExpire, Task aTask)
+            : mId(aId)
+            , mExpire(aExpire)
+            , mLevel(kLevelExpired)
+            , mSlot(0)
+            , mTask(std::move(aTask))
+        {
+        }
+
+        TimerId  mId;
+        uint64_t mExpire; // The expiration tick.
+        uint8_t  mLevel;  // The level of the list holding this timer.
+        uint8_t  mSlot;   // The slot of the list holding this timer, only meaningful in the wheels.
+        Task     mTask;
+    };
+
+    using TimerList = std::list<Timer>;
+
+    static uint8_t CountTrailingZeros(uint64_t aBits);
+
+    uint64_t   ToTick(Timepoint aTimepoint, bool aRoundUp) const;
+    TimerList &GetList(const Timer &aTimer);
+    void       Unlink(TimerList::iterator aTimer, TimerList &aTo);
+    void       Schedule(TimerList &aFrom, TimerList::iterator aTimer);
+    void       Place(TimerList &aFrom, TimerList::iterator aTimer);
+    void       Cascade(uint8_t aLevel, uint8_t aSlot);
+    void       CascadeAt(uint64_t aTick);
+    void       Advance(uint64_t aNowTick);
+    uint64_t   GetNextTickToProcess(void) const;
+
+    Timepoint mStart;
+    uint64_t  mCurrentTick; // The next tick to be processed, its cascades are already done.
+    TimerId   mNextTimerId;
+
+    std::unordered_map<TimerId, TimerList::iterator> mTimers;
+
+    TimerList mSlots[kLevels][kSlots];
+    uint64_t  mOccupied[kLevels]; // Bit `i` is set if `mSlots[level][i]` is not empty.
+    TimerList mOverflow;
+    TimerList mExpired;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_WHEEL_HPP_
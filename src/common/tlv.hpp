@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -49,7 +50,9 @@ class Tlv
 {
     enum
     {
-        kLengthEscape = 0xff, ///< This length value indicates the actual length is of two-bytes length.
+        kLengthEscape       = 0xff, ///< This length value indicates the actual length is of two-bytes length.
+        kBaseHeaderSize     = 2,    ///< The size of the type and length fields.
+        kExtendedHeaderSize = 4,    ///< The size of the type and length fields with a two-bytes length.
     };
 
 public:
@@ -196,6 +199,27 @@ public:
      */
     Tlv *GetNext(void) { return reinterpret_cast<Tlv *>(static_cast<uint8_t *>(GetValue()) + GetLength()); }
 
+    /**
+     * This method returns the size of the Tlv header whose first bytes are in a buffer.
+     *
+     * @param[in] aBuffer  A pointer to the Tlv.
+     * @param[in] aLength  The number of bytes available at @p aBuffer.
+     *
+     * @returns The size of the Tlv header, or 0 if @p aLength is too short to hold it.
+     *
+     */
+    static uint16_t GetHeaderSize(const uint8_t *aBuffer, uint16_t aLength)
+    {
+        uint16_t size = 0;
+
+        if (aLength >= kBaseHeaderSize)
+        {
+            size = (aBuffer[1] != kLengthEscape ? kBaseHeaderSize : kExtendedHeaderSize);
+        }
+
+        return (size <= aLength ? size : 0);
+    }
+
 private:
     void *GetValue(void)
     {
@@ -206,6 +230,229 @@ private:
     uint8_t mLength;
 };
 
+/**
+ * This class template maps a Tlv type to the type of its value at compile time.
+ *
+ * The value type must have an alignment of 1 so that it can be read in place from any position of a buffer.
+ *
+ * @tparam kTlvType    The Tlv type.
+ * @tparam ValueType   The type of the Tlv value.
+ *
+ */
+template <uint8_t kTlvType, typename ValueType> struct TlvInfo
+{
+    static_assert(alignof(ValueType) == 1, "Tlv values are read in place and must not require alignment");
+
+    static constexpr uint8_t kType = kTlvType; ///< The Tlv type.
+    typedef ValueType        Value;            ///< The type of the Tlv value.
+};
+
+/**
+ * This class implements a read-only view of the Tlvs in a buffer.
+ *
+ * The buffer is not copied and must outlive the view. The lengths of all Tlvs are validated once on construction,
+ * so iterating and finding Tlvs never reads beyond the buffer. A truncated or malformed Tlv ends the view.
+ *
+ */
+class TlvView
+{
+public:
+    /**
+     * This class implements a forward iterator over the Tlvs in a view.
+     *
+     */
+    class Iterator
+    {
+    public:
+        explicit Iterator(const uint8_t *aCursor)
+            : mCursor(aCursor)
+        {
+        }
+
+        const Tlv &operator*(void) const { return *reinterpret_cast<const Tlv *>(mCursor); }
+        const Tlv *operator->(void) const { return reinterpret_cast<const Tlv *>(mCursor); }
+
+        Iterator &operator++(void)
+        {
+            mCursor = reinterpret_cast<const uint8_t *>((**this).GetNext());
+            return *this;
+        }
+
+        bool operator==(const Iterator &aOther) const { return mCursor == aOther.mCursor; }
+        bool operator!=(const Iterator &aOther) const { return mCursor != aOther.mCursor; }
+
+    private:
+        const uint8_t *mCursor;
+    };
+
+    /**
+     * The constructor validates the Tlvs in a buffer.
+     *
+     * @param[in] aBuffer  A pointer to the Tlvs.
+     * @param[in] aLength  The length of the Tlvs in bytes.
+     *
+     */
+    TlvView(const uint8_t *aBuffer, uint16_t aLength)
+        : mBuffer(aBuffer)
+        , mLength(0)
+        , mIsValid(true)
+    {
+        while (mLength < aLength)
+        {
+            uint16_t remaining  = aLength - mLength;
+            uint16_t headerSize = Tlv::GetHeaderSize(mBuffer + mLength, remaining);
+
+            if (headerSize == 0 ||
+                reinterpret_cast<const Tlv *>(mBuffer + mLength)->GetLength() > remaining - headerSize)
+            {
+                mIsValid = false;
+                break;
+            }
+
+            mLength += headerSize + reinterpret_cast<const Tlv *>(mBuffer + mLength)->GetLength();
+        }
+    }
+
+    /**
+     * This method indicates whether the whole buffer consists of well-formed Tlvs.
+     *
+     * @returns Whether the whole buffer consists of well-formed Tlvs.
+     *
+     */
+    bool IsValid(void) const { return mIsValid; }
+
+    /**
+     * This method returns the length of the well-formed Tlvs, which is covered by this view.
+     *
+     * @returns The length of the well-formed Tlvs in bytes.
+     *
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    Iterator begin(void) const { return Iterator(mBuffer); }
+    Iterator end(void) const { return Iterator(mBuffer + mLength); }
+
+    /**
+     * This method finds the first Tlv of a given type.
+     *
+     * @param[in] aType  The Tlv type.
+     *
+     * @returns A pointer to the Tlv, or nullptr if not found.
+     *
+     */
+    const Tlv *Find(uint8_t aType) const
+    {
+        const Tlv *found = nullptr;
+
+        for (const Tlv &tlv : *this)
+        {
+            if (tlv.GetType() == aType)
+            {
+                found = &tlv;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+    /**
+     * This method finds the value of the first Tlv of the type described by a `TlvInfo`.
+     *
+     * @tparam TlvInfoType  The `TlvInfo` of the Tlv.
+     *
+     * @returns A pointer to the value in the buffer, or nullptr if not found or too short for the value type.
+     *
+     */
+    template <typename TlvInfoType> const typename TlvInfoType::Value *Find(void) const
+    {
+        return GetValue<TlvInfoType>(Find(TlvInfoType::kType));
+    }
+
+    /**
+     * This method returns the value of a Tlv as the type described by a `TlvInfo`.
+     *
+     * @tparam TlvInfoType  The `TlvInfo` of the Tlv.
+     *
+     * @param[in] aTlv  A pointer to the Tlv, may be nullptr.
+     *
+     * @returns A pointer to the value, or nullptr if @p aTlv is nullptr or too short for the value type.
+     *
+     */
+    template <typename TlvInfoType> static const typename TlvInfoType::Value *GetValue(const Tlv *aTlv)
+    {
+        const typename TlvInfoType::Value *value = nullptr;
+
+        if (aTlv != nullptr && aTlv->GetLength() >= sizeof(typename TlvInfoType::Value))
+        {
+            value = static_cast<const typename TlvInfoType::Value *>(aTlv->GetValue());
+        }
+
+        return value;
+    }
+
+private:
+    const uint8_t *mBuffer;
+    uint16_t       mLength;
+    bool           mIsValid;
+};
+
+/**
+ * This class implements an index of the Tlvs in a view, built in a single pass.
+ *
+ * Looking up a Tlv type in the index takes constant time, so several lookups don't each rescan the buffer. The first
+ * Tlv of each type is indexed, consistent with `TlvView::Find()`.
+ *
+ */
+class TlvIndex
+{
+public:
+    /**
+     * The constructor indexes the Tlvs in a view.
+     *
+     * @param[in] aView  The Tlv view, whose buffer must outlive the index.
+     *
+     */
+    explicit TlvIndex(const TlvView &aView)
+    {
+        memset(mTlvs, 0, sizeof(mTlvs));
+
+        for (const Tlv &tlv : aView)
+        {
+            if (mTlvs[tlv.GetType()] == nullptr)
+            {
+                mTlvs[tlv.GetType()] = &tlv;
+            }
+        }
+    }
+
+    /**
+     * This method finds the first Tlv of a given type.
+     *
+     * @param[in] aType  The Tlv type.
+     *
+     * @returns A pointer to the Tlv, or nullptr if not found.
+     *
+     */
+    const Tlv *Find(uint8_t aType) const { return mTlvs[aType]; }
+
+    /**
+     * This method finds the value of the first Tlv of the type described by a `TlvInfo`.
+     *
+     * @tparam TlvInfoType  The `TlvInfo` of the Tlv.
+     *
+     * @returns A pointer to the value in the buffer, or nullptr if not found or too short for the value type.
+     *
+     */
+    template <typename TlvInfoType> const typename TlvInfoType::Value *Find(void) const
+    {
+        return TlvView::GetValue<TlvInfoType>(Find(TlvInfoType::kType));
+    }
+
+private:
+    const Tlv *mTlvs[UINT8_MAX + 1];
+};
+
 namespace Meshcop {
 
 enum
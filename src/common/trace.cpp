@@ -0,0 +1,222 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the binary trace buffer.
+ */
+
+#include "common/trace.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+std::atomic<uint64_t> TraceBuffer::sNumRecorded{0};
+TraceRecord           TraceBuffer::sRecords[TraceBuffer::kCapacity];
+
+static otbrError WriteAll(int aFd, const void *aBuffer, size_t aLength)
+{
+    otbrError      error  = OTBR_ERROR_NONE;
+    const uint8_t *buffer = static_cast<const uint8_t *>(aBuffer);
+
+    while (aLength > 0)
+    {
+        ssize_t rval = write(aFd, buffer, aLength);
+
+        if (rval < 0)
+        {
+            VerifyOrExit(errno == EINTR, error = OTBR_ERROR_ERRNO);
+            continue;
+        }
+
+        buffer += rval;
+        aLength -= static_cast<size_t>(rval);
+    }
+
+exit:
+    return error;
+}
+
+TraceHeader TraceBuffer::MakeHeader(uint64_t aNumRecorded)
+{
+    TraceHeader header;
+
+    header.mMagic       = TraceHeader::kMagic;
+    header.mVersion     = TraceHeader::kVersion;
+    header.mRecordSize  = sizeof(TraceRecord);
+    header.mNumRecords  = static_cast<uint32_t>(aNumRecorded < kCapacity ? aNumRecorded : kCapacity);
+    header.mNumRecorded = aNumRecorded;
+    header.mTimestamp   = GetTimestamp();
+
+    return header;
+}
+
+std::vector<uint8_t> TraceBuffer::Dump(void)
+{
+    uint64_t             numRecorded = sNumRecorded.load(std::memory_order_relaxed);
+    TraceHeader          header      = MakeHeader(numRecorded);
+    std::vector<uint8_t> dump(sizeof(header) + header.mNumRecords * sizeof(TraceRecord));
+    uint8_t *            cursor = dump.data();
+
+    memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+
+    for (uint64_t index = numRecorded - header.mNumRecords; index < numRecorded; ++index)
+    {
+        memcpy(cursor, &sRecords[index & (kCapacity - 1)], sizeof(TraceRecord));
+        cursor += sizeof(TraceRecord);
+    }
+
+    return dump;
+}
+
+otbrError TraceBuffer::Dump(int aFd)
+{
+    otbrError   error       = OTBR_ERROR_NONE;
+    uint64_t    numRecorded = sNumRecorded.load(std::memory_order_relaxed);
+    TraceHeader header      = MakeHeader(numRecorded);
+    size_t      oldest      = static_cast<size_t>((numRecorded - header.mNumRecords) & (kCapacity - 1));
+    size_t      firstPart   = header.mNumRecords < kCapacity - oldest ? header.mNumRecords : kCapacity - oldest;
+
+    // The records wrap around the end of the ring at most once.
+    SuccessOrExit(error = WriteAll(aFd, &header, sizeof(header)));
+    SuccessOrExit(error = WriteAll(aFd, &sRecords[oldest], firstPart * sizeof(TraceRecord)));
+    SuccessOrExit(error = WriteAll(aFd, &sRecords[0], (header.mNumRecords - firstPart) * sizeof(TraceRecord)));
+
+exit:
+    return error;
+}
+
+// Makes the path of the temporary file of a dump, `<aPath>.<pid>`, without any function which is not
+// async-signal-safe.
+static bool MakeTempPath(const char *aPath, char *aTempPath, size_t aSize)
+{
+    bool   made = false;
+    char   digits[16];
+    size_t numDigits = 0;
+    size_t length    = strlen(aPath);
+    pid_t  pid       = getpid();
+
+    do
+    {
+        digits[numDigits++] = static_cast<char>('0' + pid % 10);
+        pid /= 10;
+    } while (pid > 0);
+
+    VerifyOrExit(length + 1 + numDigits < aSize);
+
+    memcpy(aTempPath, aPath, length);
+    aTempPath[length++] = '.';
+
+    while (numDigits > 0)
+    {
+        aTempPath[length++] = digits[--numDigits];
+    }
+
+    aTempPath[length] = '\0';
+    made              = true;
+
+exit:
+    return made;
+}
+
+otbrError TraceBuffer::DumpToFile(const char *aPath)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      tempPath[PATH_MAX];
+    int       fd = -1;
+    int       savedErrno;
+
+    VerifyOrExit(MakeTempPath(aPath, tempPath, sizeof(tempPath)), errno = ENAMETOOLONG, error = OTBR_ERROR_ERRNO);
+
+    // A file left by an interrupted dump is removed. If anyone else creates the file again, the dump fails.
+    unlink(tempPath);
+    fd = open(tempPath, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+    error = Dump(fd);
+
+    if (close(fd) != 0 && error == OTBR_ERROR_NONE)
+    {
+        error = OTBR_ERROR_ERRNO;
+    }
+
+    SuccessOrExit(error);
+
+    // Renaming replaces a symlink at the path itself rather than the file it points to.
+    VerifyOrExit(rename(tempPath, aPath) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE && fd >= 0)
+    {
+        savedErrno = errno;
+        unlink(tempPath);
+        errno = savedErrno;
+    }
+
+    return error;
+}
+
+void TraceBuffer::Clear(void)
+{
+    memset(sRecords, 0, sizeof(sRecords));
+    sNumRecorded.store(0, std::memory_order_relaxed);
+}
+
+const char *TraceBuffer::EventToString(uint32_t aEvent)
+{
+    static const char *const kEventNames[] = {
+        "None",                  // kNone
+        "MainloopPoll",          // kMainloopPoll
+        "MainloopProcess",       // kMainloopProcess
+        "SrpUpdate",             // kSrpUpdate
+        "SrpUpdateResult",       // kSrpUpdateResult
+        "MdnsPublishService",    // kMdnsPublishService
+        "MdnsPublishHost",       // kMdnsPublishHost
+        "MdnsPublishResult",     // kMdnsPublishResult
+        "RestRequest",           // kRestRequest
+        "RestResponse",          // kRestResponse
+        "NdProxyMulticastNs",    // kNdProxyMulticastNs
+        "NdProxyUnicastNs",      // kNdProxyUnicastNs
+        "NdProxyNeighborAdvert", // kNdProxyNeighborAdvert
+    };
+
+    static_assert(sizeof(kEventNames) / sizeof(kEventNames[0]) == static_cast<size_t>(TraceEvent::kNumEvents),
+                  "kEventNames must have a name for every event");
+
+    return aEvent < static_cast<uint32_t>(TraceEvent::kNumEvents) ? kEventNames[aEvent] : "Unknown";
+}
+
+} // namespace otbr
@@ -0,0 +1,277 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a fixed-size in-memory binary trace buffer of hot path events.
+ */
+
+#ifndef OTBR_COMMON_TRACE_HPP_
+#define OTBR_COMMON_TRACE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+/**
+ * @def OTBR_TRACE_BUFFER_SIZE
+ *
+ * The number of trace records kept in memory, which must be a power of two.
+ *
+ */
+#ifndef OTBR_TRACE_BUFFER_SIZE
+#define OTBR_TRACE_BUFFER_SIZE 8192
+#endif
+
+/**
+ * @def OTBR_TRACE_DUMP_FILE
+ *
+ * The file the trace buffer is dumped to on `SIGUSR2`, in a directory only writable by the otbr-agent.
+ *
+ */
+#ifndef OTBR_TRACE_DUMP_FILE
+#define OTBR_TRACE_DUMP_FILE "/run/otbr-agent.trace"
+#endif
+
+/**
+ * @def otbrTrace
+ *
+ * Record a trace event if the trace buffer is enabled, see `otbr::TraceBuffer::Record()`.
+ *
+ * The arguments are not evaluated if the trace buffer is disabled.
+ *
+ */
+#if OTBR_ENABLE_TRACE
+#define otbrTrace(...) otbr::TraceBuffer::Record(__VA_ARGS__)
+#else
+#define otbrTrace(...) static_cast<void>(0)
+#endif
+
+/**
+ * @def otbrProbe
+ *
+ * Fire the USDT probe `otbr:aName` with up to six integer or pointer arguments, if USDT probes are enabled.
+ *
+ * A probe compiles to a single `nop` and a note read by tracers like bpftrace and perf, so it costs nothing but the
+ * evaluation of its arguments when no tracer is attached. The arguments are not evaluated if USDT probes are disabled.
+ *
+ * The probes and their arguments are:
+ *   - `mainloop__iteration__start`, `mainloop__iteration__end`: iteration count.
+ *   - `task__post`: delay (ms), 0 for immediate tasks.
+ *   - `task__run__start`, `task__run__end`: 0 for immediate tasks, 1 for delayed tasks.
+ *   - `rest__request__start`: connection fd, URL.
+ *   - `rest__request__end`: connection fd, body length.
+ *   - `srp__update__start`: update ID, host name.
+ *   - `srp__update__finish`: update ID, otbrError.
+ *   - `mdns__publish__service`, `mdns__service__callback`: instance name, service type, otbrError (callback only).
+ *   - `mdns__publish__host`, `mdns__host__callback`: host name, otbrError (callback only).
+ *   - `nd__ns__receive`: 0 for multicast NS, 1 for unicast NS.
+ *   - `nd__na__send`: number of NAs sent, otbrError.
+ *   - `dbus__method__start`, `dbus__method__end`: interface and method name.
+ *
+ */
+#if OTBR_ENABLE_USDT
+#include <sys/sdt.h>
+#define otbrProbe(aName, ...) STAP_PROBEV(otbr, aName, ##__VA_ARGS__)
+#else
+#define otbrProbe(aName, ...) static_cast<void>(0)
+#endif
+
+namespace otbr {
+
+/**
+ * This enumeration defines the trace events.
+ *
+ * The values are part of the dump format, so new events must be appended before `kNumEvents`.
+ *
+ */
+enum class TraceEvent : uint32_t
+{
+    kNone                  = 0,  ///< An empty record.
+    kMainloopPoll          = 1,  ///< Polled the mainloop: number of ready fds, poll latency (us).
+    kMainloopProcess       = 2,  ///< Processed a mainloop processor: processor index, latency (us).
+    kSrpUpdate             = 3,  ///< Received an SRP update: update ID, outstanding and queued updates.
+    kSrpUpdateResult       = 4,  ///< Replied to an SRP update: update ID, OpenThread error.
+    kMdnsPublishService    = 5,  ///< Started publishing an mDNS service: services in flight.
+    kMdnsPublishHost       = 6,  ///< Started publishing an mDNS host: hosts in flight.
+    kMdnsPublishResult     = 7,  ///< Finished an mDNS publication: 0 for service 1 for host, otbrError, latency (us).
+    kRestRequest           = 8,  ///< Received a REST request: connection fd, requests on the connection.
+    kRestResponse          = 9,  ///< Started sending a REST response: connection fd, body length.
+    kNdProxyMulticastNs    = 10, ///< Processed a multicast NS: otbrError, `OTBR_ERROR_NONE` if proxied.
+    kNdProxyUnicastNs      = 11, ///< Processed a unicast NS: NFQUEUE packet ID, verdict, otbrError.
+    kNdProxyNeighborAdvert = 12, ///< Sent neighbor advertisements: number sent, otbrError.
+    kNumEvents,                  ///< The number of trace events.
+};
+
+/**
+ * This structure represents a trace record, as stored in memory and in dumps.
+ *
+ */
+struct TraceRecord
+{
+    uint64_t mTimestamp; ///< The time (in nanoseconds of the steady clock) the event happened.
+    uint32_t mEvent;     ///< The event, see `TraceEvent`.
+    uint32_t mArgs[3];   ///< The event specific arguments.
+};
+
+static_assert(sizeof(TraceRecord) == 24, "TraceRecord is part of the dump format");
+
+/**
+ * This structure represents the header of a trace dump, which is followed by the records from the oldest to the
+ * newest. All fields are in the host byte order.
+ *
+ */
+struct TraceHeader
+{
+    static constexpr uint32_t kMagic   = 0x4f545254; ///< The magic number, "OTRT".
+    static constexpr uint32_t kVersion = 1;          ///< The version of the dump format.
+
+    uint32_t mMagic;       ///< The magic number, `kMagic`.
+    uint32_t mVersion;     ///< The version of the dump format, `kVersion`.
+    uint32_t mRecordSize;  ///< The size of a record.
+    uint32_t mNumRecords;  ///< The number of records following the header.
+    uint64_t mNumRecorded; ///< The number of records ever recorded, older ones were overwritten.
+    uint64_t mTimestamp;   ///< The time (in nanoseconds of the steady clock) the dump was taken.
+};
+
+static_assert(sizeof(TraceHeader) == 32, "TraceHeader is part of the dump format");
+
+/**
+ * This class implements the process-wide binary trace buffer.
+ *
+ * The trace buffer is a ring of `OTBR_TRACE_BUFFER_SIZE` records; recording an event overwrites the oldest one and
+ * costs little more than reading the clock, so that events can be recorded on the hot paths in production. Events
+ * may be recorded from any thread. A record being written while the buffer is dumped may be torn.
+ *
+ */
+class TraceBuffer
+{
+public:
+    static constexpr size_t kCapacity = OTBR_TRACE_BUFFER_SIZE; ///< The number of records kept.
+
+    /**
+     * This method records an event.
+     *
+     * @param[in]  aEvent  The event.
+     * @param[in]  aArg0   The first argument of the event.
+     * @param[in]  aArg1   The second argument of the event.
+     * @param[in]  aArg2   The third argument of the event.
+     *
+     */
+    static void Record(TraceEvent aEvent, uint32_t aArg0 = 0, uint32_t aArg1 = 0, uint32_t aArg2 = 0)
+    {
+        uint64_t     index  = sNumRecorded.fetch_add(1, std::memory_order_relaxed);
+        TraceRecord &record = sRecords[index & (kCapacity - 1)];
+
+        record.mTimestamp = GetTimestamp();
+        record.mEvent     = static_cast<uint32_t>(aEvent);
+        record.mArgs[0]   = aArg0;
+        record.mArgs[1]   = aArg1;
+        record.mArgs[2]   = aArg2;
+    }
+
+    /**
+     * This method dumps the trace buffer.
+     *
+     * @returns  The trace dump, a `TraceHeader` followed by the records.
+     *
+     */
+    static std::vector<uint8_t> Dump(void);
+
+    /**
+     * This method writes a dump of the trace buffer to a file descriptor.
+     *
+     * This method is async-signal-safe.
+     *
+     * @param[in]  aFd  The file descriptor.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully wrote the dump.
+     * @retval  OTBR_ERROR_ERRNO  Failed to write the dump, see `errno`.
+     *
+     */
+    static otbrError Dump(int aFd);
+
+    /**
+     * This method writes a dump of the trace buffer to a new file.
+     *
+     * This method is async-signal-safe. The dump is written to a new file next to @p aPath, which then replaces
+     * @p aPath, so that a file or a symlink put at @p aPath by someone else is never written through.
+     *
+     * @param[in]  aPath  The path of the file, which is replaced if it exists.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully wrote the dump.
+     * @retval  OTBR_ERROR_ERRNO  Failed to write the dump, see `errno`.
+     *
+     */
+    static otbrError DumpToFile(const char *aPath);
+
+    /**
+     * This method clears the trace buffer.
+     *
+     * It must not be called while events are being recorded.
+     *
+     */
+    static void Clear(void);
+
+    /**
+     * This method returns the name of an event.
+     *
+     * @param[in]  aEvent  The event.
+     *
+     * @returns  The name of the event, or "Unknown".
+     *
+     */
+    static const char *EventToString(uint32_t aEvent);
+
+private:
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0,
+                  "OTBR_TRACE_BUFFER_SIZE must be a power of two");
+
+    static uint64_t GetTimestamp(void)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+    }
+
+    static TraceHeader MakeHeader(uint64_t aNumRecorded);
+
+    static std::atomic<uint64_t> sNumRecorded;
+    static TraceRecord           sRecords[kCapacity];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TRACE_HPP_
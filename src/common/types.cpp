@@ -27,15 +27,127 @@
  */
 
 #include <arpa/inet.h>
-#include <sstream>
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
+#include "common/hex_codec.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
 
+constexpr size_t Ip6Address::kStringSize;
+constexpr size_t Ip6Prefix::kStringSize;
+constexpr size_t MacAddress::kStringSize;
+
+static char *AppendHexWord(char *aCur, uint16_t aWord)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+    int               shift        = 12;
+
+    // Leading zeros are omitted, but a zero word is still written as "0".
+    while (shift > 0 && (aWord >> shift) == 0)
+    {
+        shift -= 4;
+    }
+
+    for (; shift >= 0; shift -= 4)
+    {
+        *aCur++ = kHexDigits[(aWord >> shift) & 0xf];
+    }
+
+    return aCur;
+}
+
+static char *AppendDecimal(char *aCur, uint8_t aValue)
+{
+    if (aValue >= 100)
+    {
+        *aCur++ = static_cast<char>('0' + aValue / 100);
+    }
+
+    if (aValue >= 10)
+    {
+        *aCur++ = static_cast<char>('0' + aValue / 10 % 10);
+    }
+
+    *aCur++ = static_cast<char>('0' + aValue % 10);
+
+    return aCur;
+}
+
+static char *AppendIp6Address(char *aCur, const Ip6Address &aAddress)
+{
+    const uint8_t *bytes = aAddress.m8;
+    uint16_t       words[8];
+    int            zerosStart  = -1;
+    int            zerosLength = 0;
+
+    for (int i = 0; i < 8; i++)
+    {
+        words[i] = static_cast<uint16_t>(bytes[2 * i] << 8 | bytes[2 * i + 1]);
+    }
+
+    // The longest run of at least two zero words is compressed to "::", the first one if there is a tie.
+    for (int i = 0, runStart = -1; i <= 8; i++)
+    {
+        if (i < 8 && words[i] == 0)
+        {
+            runStart = (runStart < 0) ? i : runStart;
+        }
+        else if (runStart >= 0)
+        {
+            if (i - runStart >= 2 && i - runStart > zerosLength)
+            {
+                zerosStart  = runStart;
+                zerosLength = i - runStart;
+            }
+
+            runStart = -1;
+        }
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        if (zerosStart >= 0 && i >= zerosStart && i < zerosStart + zerosLength)
+        {
+            if (i == zerosStart)
+            {
+                *aCur++ = ':';
+            }
+
+            continue;
+        }
+
+        if (i != 0)
+        {
+            *aCur++ = ':';
+        }
+
+        // IPv4-compatible and IPv4-mapped addresses end with the IPv4 address, as `inet_ntop()` does.
+        if (i == 6 && zerosStart == 0 && (zerosLength == 6 || (zerosLength == 5 && words[5] == 0xffff)))
+        {
+            aCur    = AppendDecimal(aCur, bytes[12]);
+            *aCur++ = '.';
+            aCur    = AppendDecimal(aCur, bytes[13]);
+            *aCur++ = '.';
+            aCur    = AppendDecimal(aCur, bytes[14]);
+            *aCur++ = '.';
+            aCur    = AppendDecimal(aCur, bytes[15]);
+            break;
+        }
+
+        aCur = AppendHexWord(aCur, words[i]);
+    }
+
+    if (zerosStart >= 0 && zerosStart + zerosLength == 8)
+    {
+        *aCur++ = ':';
+    }
+
+    return aCur;
+}
+
 Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
 {
     memcpy(m8, aAddress, sizeof(m8));
@@ -43,12 +155,18 @@ Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
 
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
+
+    return std::string(ToString(strbuf));
+}
+
+const char *Ip6Address::ToString(char (&aBuffer)[kStringSize]) const
+{
+    static_assert(kStringSize == INET6_ADDRSTRLEN, "kStringSize must be INET6_ADDRSTRLEN");
 
-    VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 address to string");
+    *AppendIp6Address(aBuffer, *this) = '\0';
 
-    return std::string(strbuf);
+    return aBuffer;
 }
 
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
@@ -111,28 +229,42 @@ void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 
 std::string Ip6Prefix::ToString() const
 {
-    std::stringbuf strBuilder;
-    char           strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
 
-    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 prefix to string");
+    return std::string(ToString(strbuf));
+}
 
-    strBuilder.sputn(strbuf, strlen(strbuf));
-    strBuilder.sputc('/');
+const char *Ip6Prefix::ToString(char (&aBuffer)[kStringSize]) const
+{
+    char *cur = AppendIp6Address(aBuffer, mPrefix);
 
-    sprintf(strbuf, "%d", mLength);
-    strBuilder.sputn(strbuf, strlen(strbuf));
+    *cur++ = '/';
+    cur    = AppendDecimal(cur, mLength);
+    *cur   = '\0';
 
-    return strBuilder.str();
+    return aBuffer;
 }
 
 std::string MacAddress::ToString(void) const
 {
-    char strbuf[sizeof(m8) * 3];
+    char strbuf[kStringSize];
+
+    return std::string(ToString(strbuf));
+}
+
+const char *MacAddress::ToString(char (&aBuffer)[kStringSize]) const
+{
+    static_assert(kStringSize == sizeof(m8) * 3, "kStringSize must hold two digits and a separator per byte");
+
+    for (size_t i = 0; i < sizeof(m8); i++)
+    {
+        HexCodec::Encode(&m8[i], 1, &aBuffer[3 * i], /* aLowerCase */ true);
+        aBuffer[3 * i + 2] = ':';
+    }
 
-    snprintf(strbuf, sizeof(strbuf), "%02x:%02x:%02x:%02x:%02x:%02x", m8[0], m8[1], m8[2], m8[3], m8[4], m8[5]);
+    aBuffer[kStringSize - 1] = '\0';
 
-    return std::string(strbuf);
+    return aBuffer;
 }
 
 } // namespace otbr
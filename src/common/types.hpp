@@ -81,6 +81,8 @@ enum otbrError
     OTBR_ERROR_NOT_IMPLEMENTED = -9,  ///< Not implemented error.
     OTBR_ERROR_INVALID_ARGS    = -10, ///< Invalid arguments error.
     OTBR_ERROR_DUPLICATED      = -11, ///< Duplicated operation, resource or name.
+    OTBR_ERROR_TIMEOUT         = -12, ///< The operation timed out.
+    OTBR_ERROR_BUSY            = -13, ///< Too busy to handle the operation.
 };
 
 namespace otbr {
@@ -104,6 +106,8 @@ static constexpr char kLinkLocalAllNodesMulticastAddress[] = "ff02::01";
 class Ip6Address
 {
 public:
+    static constexpr size_t kStringSize = 46; ///< The size of the string representation, including the terminator.
+
     /**
      * Default constructor.
      *
@@ -181,6 +185,18 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 address into a buffer.
+     *
+     * The representation is the same as `inet_ntop()`, i.e. the RFC 5952 form, but nothing is allocated.
+     *
+     * @param[out] aBuffer  The buffer to write the string representation into.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     /**
      * This method indicates whether or not the Ip6 address is the Unspecified Address.
      *
@@ -304,6 +320,8 @@ private:
 class Ip6Prefix
 {
 public:
+    static constexpr size_t kStringSize = Ip6Address::kStringSize + 4; ///< The size of the string representation.
+
     /**
      * Default constructor.
      *
@@ -326,6 +344,16 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 prefix into a buffer.
+     *
+     * @param[out] aBuffer  The buffer to write the string representation into.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     /**
      * This method clears the Ip6 prefix to be unspecified.
      *
@@ -340,6 +368,26 @@ public:
      */
     bool IsValid(void) const { return mLength > 0 && mLength <= 128; }
 
+    /**
+     * This method overloads `==` operator and compares if the Ip6 prefix is equal to the other prefix.
+     *
+     * @param[in] aOther  The other Ip6 prefix to compare with.
+     *
+     * @returns  Whether the Ip6 prefix is equal to the other prefix.
+     *
+     */
+    bool operator==(const Ip6Prefix &aOther) const { return mLength == aOther.mLength && mPrefix == aOther.mPrefix; }
+
+    /**
+     * This method overloads `!=` operator and compares if the Ip6 prefix is not equal to the other prefix.
+     *
+     * @param[in] aOther  The other Ip6 prefix to compare with.
+     *
+     * @returns  Whether the Ip6 prefix is not equal to the other prefix.
+     *
+     */
+    bool operator!=(const Ip6Prefix &aOther) const { return !(*this == aOther); }
+
     Ip6Address mPrefix; ///< The IPv6 prefix.
     uint8_t    mLength; ///< The IPv6 prefix length (in bits).
 };
@@ -350,6 +398,8 @@ public:
 class MacAddress
 {
 public:
+    static constexpr size_t kStringSize = sizeof("00:00:00:00:00:00"); ///< The size of the string representation.
+
     /**
      * Default constructor.
      *
@@ -369,6 +419,16 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the MAC address into a buffer.
+     *
+     * @param[out] aBuffer  The buffer to write the string representation into.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     union
     {
         uint8_t  m8[6];
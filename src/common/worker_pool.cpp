@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the pool of worker threads.
+ */
+
+#define OTBR_LOG_TAG "WORKER"
+
+#include "common/worker_pool.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/thread_schedule.hpp"
+
+namespace otbr {
+
+WorkerPool::WorkerPool(TaskRunner &aTaskRunner, size_t aNumWorkers, size_t aMaxPendingJobs)
+    : mTaskRunner(aTaskRunner)
+    , mMaxPendingJobs(aMaxPendingJobs)
+    , mStopping(false)
+{
+    assert(aNumWorkers > 0 && aMaxPendingJobs > 0);
+
+    for (size_t i = 0; i < aNumWorkers; ++i)
+    {
+        mWorkers.emplace_back(&WorkerPool::Run, this);
+    }
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    // The braces here are necessary for auto-releasing of the mutex.
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        mStopping = true;
+    }
+
+    mJobAvailable.notify_all();
+
+    for (std::thread &worker : mWorkers)
+    {
+        worker.join();
+    }
+}
+
+otbrError WorkerPool::Post(TaskRunner::Task<void> aJob, TaskRunner::Task<void> aCompletion, const void *aSerialKey)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // The braces here are necessary for auto-releasing of the mutex.
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        assert(!mStopping);
+
+        VerifyOrExit(mJobs.size() < mMaxPendingJobs, error = OTBR_ERROR_BUSY);
+        mJobs.push_back({std::move(aJob), std::move(aCompletion), aSerialKey});
+    }
+
+    mJobAvailable.notify_one();
+
+exit:
+    return error;
+}
+
+bool WorkerPool::IsRunnable(const Job &aJob) const
+{
+    return aJob.mSerialKey == nullptr ||
+           std::find(mRunningKeys.begin(), mRunningKeys.end(), aJob.mSerialKey) == mRunningKeys.end();
+}
+
+void WorkerPool::Run(void)
+{
+    if (ApplyHousekeepingSchedule() != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to set the schedule of a worker thread: %s", strerror(errno));
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true)
+    {
+        // A job of a running serial key is never selected, so the jobs of the same
+        // serial key are started in the order they were posted.
+        auto it = std::find_if(mJobs.begin(), mJobs.end(), [this](const Job &aJob) { return IsRunnable(aJob); });
+        Job  job;
+
+        if (it == mJobs.end())
+        {
+            if (mStopping && mJobs.empty())
+            {
+                break;
+            }
+
+            mJobAvailable.wait(lock);
+            continue;
+        }
+
+        job = std::move(*it);
+        mJobs.erase(it);
+
+        if (job.mSerialKey != nullptr)
+        {
+            mRunningKeys.push_back(job.mSerialKey);
+        }
+
+        lock.unlock();
+
+        job.mWork();
+
+        if (job.mCompletion != nullptr)
+        {
+            mTaskRunner.Post(std::move(job.mCompletion));
+        }
+
+        lock.lock();
+
+        if (job.mSerialKey != nullptr)
+        {
+            mRunningKeys.erase(std::find(mRunningKeys.begin(), mRunningKeys.end(), job.mSerialKey));
+
+            // A job waiting for this serial key may be runnable now.
+            mJobAvailable.notify_all();
+        }
+    }
+}
+
+} // namespace otbr
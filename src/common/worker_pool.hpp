@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a pool of worker threads for blocking operations.
+ */
+
+#ifndef OTBR_COMMON_WORKER_POOL_HPP_
+#define OTBR_COMMON_WORKER_POOL_HPP_
+
+#include <openthread-br/config.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <stddef.h>
+
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a bounded pool of worker threads.
+ *
+ * Blocking operations, e.g. running shell commands, are executed on the worker threads
+ * so that they do not stall the mainloop. The completion of a job is handed back to the
+ * mainloop through a task runner.
+ *
+ * Jobs posted with the same serial key are executed one at a time and in the order they are
+ * posted, jobs with different serial keys may be executed concurrently.
+ *
+ */
+class WorkerPool
+{
+public:
+    static constexpr size_t kDefaultNumWorkers     = 2;  ///< The default number of worker threads.
+    static constexpr size_t kDefaultMaxPendingJobs = 32; ///< The default max number of jobs waiting for a worker.
+
+    /**
+     * This constructor initializes the worker pool and starts the worker threads.
+     *
+     * @param[in]  aTaskRunner      The task runner which executes the completions on the mainloop.
+     * @param[in]  aNumWorkers      The number of worker threads.
+     * @param[in]  aMaxPendingJobs  The max number of jobs waiting for a worker.
+     *
+     */
+    explicit WorkerPool(TaskRunner &aTaskRunner,
+                        size_t      aNumWorkers     = kDefaultNumWorkers,
+                        size_t      aMaxPendingJobs = kDefaultMaxPendingJobs);
+
+    /**
+     * This destructor waits for all posted jobs to finish and stops the worker threads.
+     *
+     * Completions of the jobs that have not been executed by the task runner yet are dropped
+     * if the task runner is destroyed before executing them.
+     *
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method posts a job to the worker threads.
+     *
+     * This method never blocks, so it is safe to call on the mainloop. If there are already
+     * `aMaxPendingJobs` jobs waiting for a worker, the job is not posted.
+     *
+     * @param[in]  aJob         The job to be executed on a worker thread.
+     * @param[in]  aCompletion  The task to be executed on the mainloop after @p aJob, may be `nullptr`.
+     * @param[in]  aSerialKey   The serial key of the job, `nullptr` if the job may run concurrently with any job.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully posted the job.
+     * @retval OTBR_ERROR_BUSY  Too many jobs are waiting for a worker, neither @p aJob nor @p aCompletion is executed.
+     *
+     */
+    otbrError Post(TaskRunner::Task<void> aJob, TaskRunner::Task<void> aCompletion, const void *aSerialKey = nullptr);
+
+    /**
+     * This method posts a job returning a result to the worker threads.
+     *
+     * @param[in]  aJob         The job to be executed on a worker thread.
+     * @param[in]  aCompletion  The handler to be called on the mainloop with the result of @p aJob.
+     * @param[in]  aSerialKey   The serial key of the job, `nullptr` if the job may run concurrently with any job.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully posted the job.
+     * @retval OTBR_ERROR_BUSY  Too many jobs are waiting for a worker, neither @p aJob nor @p aCompletion is executed.
+     *
+     */
+    template <class T>
+    otbrError Post(TaskRunner::Task<T> aJob, std::function<void(T)> aCompletion, const void *aSerialKey = nullptr)
+    {
+        auto result = std::make_shared<T>();
+
+        return Post([aJob, result]() { *result = aJob(); },
+                    [aCompletion, result]() { aCompletion(std::move(*result)); }, aSerialKey);
+    }
+
+private:
+    struct Job
+    {
+        TaskRunner::Task<void> mWork;
+        TaskRunner::Task<void> mCompletion;
+        const void *           mSerialKey;
+    };
+
+    void Run(void);
+    bool IsRunnable(const Job &aJob) const;
+
+    TaskRunner &             mTaskRunner;
+    size_t                   mMaxPendingJobs;
+    std::vector<std::thread> mWorkers;
+
+    // The mutex protects all members below.
+    std::mutex                mMutex;
+    std::condition_variable   mJobAvailable;
+    std::deque<Job>           mJobs;
+    std::vector<const void *> mRunningKeys; // The serial keys of the running jobs.
+    bool                      mStopping;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_WORKER_POOL_HPP_
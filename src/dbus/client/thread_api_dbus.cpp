@@ -28,6 +28,7 @@
 
 #include <map>
 #include <string.h>
+#include <unistd.h>
 
 #include "common/code_utils.hpp"
 #include "dbus/client/client_error.hpp"
@@ -35,6 +36,7 @@
 #include "dbus/common/constants.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
+#include "dbus/common/table_blob.hpp"
 
 namespace otbr {
 namespace DBus {
@@ -61,6 +63,45 @@ static ClientError NameToDeviceRole(const std::string &aRoleName, DeviceRole &aD
     return error;
 }
 
+static ClientError FindChangedProperty(DBusMessage *      aSignal,
+                                       const std::string &aPropertyName,
+                                       DBusMessageIter &  aValueIter)
+{
+    ClientError     error = ClientError::OT_ERROR_NOT_FOUND;
+    DBusMessageIter iter, subIter;
+    std::string     interfaceName;
+
+    VerifyOrExit(dbus_message_iter_init(aSignal, &iter), error = ClientError::ERROR_DBUS);
+    VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, error = ClientError::ERROR_DBUS);
+    dbus_message_iter_recurse(&iter, &subIter);
+
+    while (dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY)
+    {
+        std::string propertyName;
+
+        dbus_message_iter_recurse(&subIter, &aValueIter);
+        dbus_message_iter_next(&subIter);
+
+        if (DBusMessageExtract(&aValueIter, propertyName) == OTBR_ERROR_NONE && propertyName == aPropertyName)
+        {
+            error = ClientError::ERROR_NONE;
+            break;
+        }
+    }
+
+exit:
+    return error;
+}
+
+static ClientError ConvertFromDBusError(const DBusError &aError)
+{
+    ClientError error = DBus::ConvertFromDBusErrorName(aError.name);
+
+    // Errors not defined by OpenThread, e.g. an unknown method, are reported as d-bus errors.
+    return error == ClientError::ERROR_NONE ? ClientError::ERROR_DBUS : error;
+}
+
 bool IsThreadActive(DeviceRole aRole)
 {
     bool isActive = false;
@@ -83,14 +124,22 @@ bool IsThreadActive(DeviceRole aRole)
 
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection)
     : mInterfaceName("wpan0")
+    , mServiceName(OTBR_DBUS_SERVER_PREFIX + mInterfaceName)
+    , mObjectPath(OTBR_DBUS_OBJECT_PREFIX + mInterfaceName)
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
+    , mPropertyCacheMaxAge(0)
 {
     SubscribeDeviceRoleSignal();
 }
 
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aInterfaceName)
     : mInterfaceName(aInterfaceName)
+    , mServiceName(OTBR_DBUS_SERVER_PREFIX + mInterfaceName)
+    , mObjectPath(OTBR_DBUS_OBJECT_PREFIX + mInterfaceName)
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
+    , mPropertyCacheMaxAge(0)
 {
     SubscribeDeviceRoleSignal();
 }
@@ -112,6 +161,12 @@ exit:
     return ret;
 }
 
+ClientError ThreadApiDBus::SubscribeSignal(const std::string &aSignalName)
+{
+    // High-rate signals are only sent to the subscribed connections, which receive them without a match rule.
+    return CallDBusMethodSync(OTBR_DBUS_SUBSCRIBE_SIGNAL_METHOD, std::tie(aSignalName));
+}
+
 DBusHandlerResult ThreadApiDBus::sDBusMessageFilter(DBusConnection *aConnection,
                                                     DBusMessage *   aMessage,
                                                     void *          aThreadApiDBus)
@@ -125,9 +180,24 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 {
     OTBR_UNUSED_VARIABLE(aConnection);
 
-    DBusMessageIter iter, subIter, dictEntryIter, valIter;
-    std::string     interfaceName, propertyName, val;
-    DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
+    DBusMessageIter iter, subIter;
+    std::string     interfaceName;
+    const char *    path = dbus_message_get_path(aMessage);
+
+    // All signals are received by every client on the connection, only those of this Thread interface are handled.
+    VerifyOrExit(path != nullptr && mObjectPath == path);
+
+    if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL))
+    {
+        HandleChildTableChanged(aMessage);
+        ExitNow();
+    }
+
+    if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL))
+    {
+        HandleScanResult(aMessage);
+        ExitNow();
+    }
 
     VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
     VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
@@ -136,15 +206,42 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
-    VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
-    dbus_message_iter_recurse(&dictEntryIter, &valIter);
-    SuccessOrExit(DBusMessageExtract(&valIter, val));
 
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
-    SuccessOrExit(NameToDeviceRole(val, role));
+    // One signal carries every property changed during an iteration of the server mainloop.
+    while (dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY)
+    {
+        DBusMessageIter dictEntryIter;
+        std::string     propertyName;
+
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        dbus_message_iter_next(&subIter);
+
+        if (DBusMessageExtract(&dictEntryIter, propertyName) == OTBR_ERROR_NONE &&
+            dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT)
+        {
+            HandlePropertyChanged(aMessage, propertyName, dictEntryIter);
+        }
+    }
+
+exit:
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+void ThreadApiDBus::HandlePropertyChanged(DBusMessage *      aMessage,
+                                          const std::string &aPropertyName,
+                                          DBusMessageIter &  aValueIter)
+{
+    std::string roleName;
+    DeviceRole  role = OTBR_DEVICE_ROLE_DISABLED;
+
+    if (mPropertyCacheEnabled)
+    {
+        CacheProperty(aPropertyName, aMessage);
+    }
+
+    VerifyOrExit(aPropertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
+    SuccessOrExit(DBusMessageExtractFromVariant(&aValueIter, roleName));
+    SuccessOrExit(NameToDeviceRole(roleName, role));
 
     for (const auto &f : mDeviceRoleHandlers)
     {
@@ -152,7 +249,41 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
     }
 
 exit:
-    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    return;
+}
+
+void ThreadApiDBus::HandleChildTableChanged(DBusMessage *aMessage)
+{
+    std::vector<ChildInfo> added;
+    std::vector<uint64_t>  removed;
+    std::vector<ChildInfo> updated;
+    auto                   args = std::tie(added, removed, updated);
+
+    SuccessOrExit(DBusMessageToTuple(*aMessage, args));
+
+    for (const auto &f : mChildTableChangedHandlers)
+    {
+        f(added, removed, updated);
+    }
+
+exit:
+    return;
+}
+
+void ThreadApiDBus::HandleScanResult(DBusMessage *aMessage)
+{
+    ActiveScanResult result;
+    auto             args = std::tie(result);
+
+    SuccessOrExit(DBusMessageToTuple(*aMessage, args));
+
+    for (const auto &f : mScanResultHandlers)
+    {
+        f(result);
+    }
+
+exit:
+    return;
 }
 
 void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
@@ -160,6 +291,38 @@ void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
     mDeviceRoleHandlers.push_back(aHandler);
 }
 
+ClientError ThreadApiDBus::AddChildTableChangedHandler(const ChildTableChangedHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+
+    if (mChildTableChangedHandlers.empty())
+    {
+        error = SubscribeSignal(OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL);
+        VerifyOrExit(error == ClientError::ERROR_NONE);
+    }
+
+    mChildTableChangedHandlers.push_back(aHandler);
+
+exit:
+    return error;
+}
+
+ClientError ThreadApiDBus::AddScanResultHandler(const ScanResultHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+
+    if (mScanResultHandlers.empty())
+    {
+        error = SubscribeSignal(OTBR_DBUS_SCAN_RESULT_SIGNAL);
+        VerifyOrExit(error == ClientError::ERROR_NONE);
+    }
+
+    mScanResultHandlers.push_back(aHandler);
+
+exit:
+    return error;
+}
+
 ClientError ThreadApiDBus::Scan(const ScanHandler &aHandler)
 {
     ClientError error = ClientError::ERROR_NONE;
@@ -252,6 +415,56 @@ exit:
     return error;
 }
 
+ClientError ThreadApiDBus::AttachOnQuietestChannel(const std::string &            aNetworkName,
+                                                   uint16_t                       aPanId,
+                                                   uint64_t                       aExtPanId,
+                                                   const std::vector<uint8_t> &   aMasterKey,
+                                                   const std::vector<uint8_t> &   aPSKc,
+                                                   uint32_t                       aChannelMask,
+                                                   const ChannelSelectionHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+    const auto  args  = std::tie(aMasterKey, aPanId, aNetworkName, aExtPanId, aPSKc, aChannelMask);
+
+    VerifyOrExit(aHandler != nullptr, error = ClientError::OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mAttachHandler == nullptr && mChannelSelectionHandler == nullptr && mJoinerHandler == nullptr,
+                 error = ClientError::OT_ERROR_INVALID_STATE);
+    mChannelSelectionHandler = aHandler;
+
+    error = CallDBusMethodAsync(
+        OTBR_DBUS_ATTACH_ON_QUIETEST_CHANNEL_METHOD, args,
+        &ThreadApiDBus::sHandleDBusPendingCall<&ThreadApiDBus::AttachOnQuietestChannelPendingCallHandler>);
+    if (error != ClientError::ERROR_NONE)
+    {
+        mChannelSelectionHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
+void ThreadApiDBus::AttachOnQuietestChannelPendingCallHandler(DBusPendingCall *aPending)
+{
+    ClientError                 ret = ClientError::OT_ERROR_FAILED;
+    UniqueDBusMessage           message(dbus_pending_call_steal_reply(aPending));
+    auto                        handler = mChannelSelectionHandler;
+    uint8_t                     channel = 0;
+    std::vector<ChannelEnergy>  energies;
+    std::vector<ChannelQuality> occupancies;
+    auto                        args = std::tie(channel, energies, occupancies);
+
+    if (message != nullptr)
+    {
+        ret = CheckErrorMessage(message.get());
+        if (ret == ClientError::ERROR_NONE && DBusMessageToTuple(*message, args) != OTBR_ERROR_NONE)
+        {
+            ret = ClientError::ERROR_DBUS;
+        }
+    }
+
+    mChannelSelectionHandler = nullptr;
+    handler(ret, channel, energies, occupancies);
+}
+
 void ThreadApiDBus::AttachPendingCallHandler(DBusPendingCall *aPending)
 {
     ClientError       ret = ClientError::OT_ERROR_FAILED;
@@ -363,6 +576,16 @@ ClientError ThreadApiDBus::JoinerStop(void)
     return CallDBusMethodSync(OTBR_DBUS_JOINER_STOP_METHOD);
 }
 
+ClientError ThreadApiDBus::AddJoiners(const std::vector<std::string> &aJoinerIds,
+                                      const std::vector<std::string> &aPskds,
+                                      uint32_t                        aTimeout,
+                                      std::vector<uint8_t> &          aSteeringData)
+{
+    auto reply = std::tie(aSteeringData);
+
+    return CallDBusMethodSync(OTBR_DBUS_ADD_JOINERS_METHOD, std::tie(aJoinerIds, aPskds, aTimeout), reply);
+}
+
 ClientError ThreadApiDBus::AddOnMeshPrefix(const OnMeshPrefix &aPrefix)
 {
     return CallDBusMethodSync(OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD, std::tie(aPrefix));
@@ -383,6 +606,15 @@ ClientError ThreadApiDBus::RemoveExternalRoute(const Ip6Prefix &aPrefix)
     return CallDBusMethodSync(OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD, std::tie(aPrefix));
 }
 
+ClientError ThreadApiDBus::UpdateNetworkData(const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                             const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                             const std::vector<ExternalRoute> &aAddedRoutes,
+                                             const std::vector<Ip6Prefix> &    aRemovedRoutes)
+{
+    return CallDBusMethodSync(OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD,
+                              std::tie(aAddedPrefixes, aRemovedPrefixes, aAddedRoutes, aRemovedRoutes));
+}
+
 ClientError ThreadApiDBus::SetMeshLocalPrefix(const std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> &aPrefix)
 {
     return SetProperty(OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX, aPrefix);
@@ -524,6 +756,36 @@ ClientError ThreadApiDBus::GetNeighborTable(std::vector<NeighborInfo> &aNeighbor
     return GetProperty(OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY, aNeighborTable);
 }
 
+ClientError ThreadApiDBus::GetChildTablePage(uint16_t                aOffset,
+                                             uint16_t                aCount,
+                                             std::vector<ChildInfo> &aChildren,
+                                             uint16_t &              aTotal)
+{
+    auto reply = std::tie(aChildren, aTotal);
+
+    return CallDBusMethodSync(OTBR_DBUS_GET_CHILD_TABLE_PAGE_METHOD, std::tie(aOffset, aCount), reply);
+}
+
+ClientError ThreadApiDBus::GetNeighborTablePage(uint16_t                   aOffset,
+                                                uint16_t                   aCount,
+                                                std::vector<NeighborInfo> &aNeighbors,
+                                                uint16_t &                 aTotal)
+{
+    auto reply = std::tie(aNeighbors, aTotal);
+
+    return CallDBusMethodSync(OTBR_DBUS_GET_NEIGHBOR_TABLE_PAGE_METHOD, std::tie(aOffset, aCount), reply);
+}
+
+ClientError ThreadApiDBus::ExportChildTable(std::vector<ChildInfo> &aChildTable)
+{
+    return ExportTable(OTBR_DBUS_EXPORT_CHILD_TABLE_METHOD, aChildTable);
+}
+
+ClientError ThreadApiDBus::ExportNeighborTable(std::vector<NeighborInfo> &aNeighborTable)
+{
+    return ExportTable(OTBR_DBUS_EXPORT_NEIGHBOR_TABLE_METHOD, aNeighborTable);
+}
+
 ClientError ThreadApiDBus::GetPartitionId(uint32_t &aPartitionId)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY, aPartitionId);
@@ -554,6 +816,45 @@ ClientError ThreadApiDBus::GetRadioRegion(std::string &aRadioRegion)
     return GetProperty(OTBR_DBUS_PROPERTY_RADIO_REGION, aRadioRegion);
 }
 
+ClientError ThreadApiDBus::GetMainloopStats(MainloopStats &aStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MAINLOOP_STATS, aStats);
+}
+
+ClientError ThreadApiDBus::GetRadioStats(RadioStats &aStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_RADIO_STATS, aStats);
+}
+
+ClientError ThreadApiDBus::GetTraceBuffer(std::vector<uint8_t> &aDump)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE,
+                                                                 OTBR_DBUS_DUMP_TRACE_BUFFER_METHOD));
+    DBus::UniqueDBusMessage reply = nullptr;
+    auto                    args  = std::tie(aDump);
+    DBusError               error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ConvertFromDBusError(error));
+    ret = CheckReply(reply.get());
+    VerifyOrExit(ret == ClientError::ERROR_NONE);
+    VerifyOrExit(otbr::DBus::DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::GetBackboneRouterCounters(BackboneRouterCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_BACKBONE_ROUTER_COUNTERS, aCounters);
+}
+
 std::string ThreadApiDBus::GetInterfaceName(void)
 {
     return mInterfaceName;
@@ -562,8 +863,7 @@ std::string ThreadApiDBus::GetInterfaceName(void)
 ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName)
 {
     ClientError       ret = ClientError::ERROR_NONE;
-    UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                           (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+    UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
                                                            OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
     UniqueDBusMessage reply = nullptr;
     DBusError         error;
@@ -583,8 +883,7 @@ exit:
 ClientError ThreadApiDBus::CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction)
 {
     ClientError       ret = ClientError::ERROR_NONE;
-    UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                           (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+    UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
                                                            OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
     DBusPendingCall * pending = nullptr;
 
@@ -603,8 +902,7 @@ template <typename ArgType>
 ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs)
 {
     ClientError             ret = ClientError::ERROR_NONE;
-    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
                                                                  OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
     DBus::UniqueDBusMessage reply = nullptr;
     DBusError               error;
@@ -622,6 +920,61 @@ exit:
     return ret;
 }
 
+template <typename ArgType, typename ReplyType>
+ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs, ReplyType &aReply)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBusError               error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ConvertFromDBusError(error));
+    ret = CheckReply(reply.get());
+    VerifyOrExit(ret == ClientError::ERROR_NONE);
+    VerifyOrExit(otbr::DBus::DBusMessageToTuple(*reply, aReply) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+template <typename TableType> ClientError ThreadApiDBus::ExportTable(const std::string &aMethodName, TableType &aTable)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBus::UnixFd            table{-1};
+    auto                    args = std::tie(table);
+    DBusError               error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(dbus_connection_can_send_type(mConnection, DBUS_TYPE_UNIX_FD),
+                 ret = ClientError::OT_ERROR_NOT_CAPABLE);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ConvertFromDBusError(error));
+    ret = CheckReply(reply.get());
+    VerifyOrExit(ret == ClientError::ERROR_NONE);
+    VerifyOrExit(otbr::DBus::DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(DBus::DecodeTableMemfd(table.mFd, aTable) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+
+exit:
+    if (table.mFd != -1)
+    {
+        close(table.mFd);
+    }
+
+    dbus_error_free(&error);
+    return ret;
+}
+
 template <typename ArgType>
 ClientError ThreadApiDBus::CallDBusMethodAsync(const std::string &           aMethodName,
                                                const ArgType &               aArgs,
@@ -629,8 +982,7 @@ ClientError ThreadApiDBus::CallDBusMethodAsync(const std::string &           aMe
 {
     ClientError ret = ClientError::ERROR_NONE;
 
-    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
                                                                  OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
     DBusPendingCall *       pending = nullptr;
 
@@ -649,14 +1001,15 @@ exit:
 template <typename ValType>
 ClientError ThreadApiDBus::SetProperty(const std::string &aPropertyName, const ValType &aValue)
 {
-    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
                                                                  DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_SET_METHOD));
     DBus::UniqueDBusMessage reply = nullptr;
     ClientError             ret   = ClientError::ERROR_NONE;
     DBusError               error;
     DBusMessageIter         iter;
 
+    mPropertyCache.erase(aPropertyName);
+
     dbus_error_init(&error);
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
 
@@ -679,26 +1032,202 @@ exit:
 
 template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::string &aPropertyName, ValType &aValue)
 {
-    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
-                                                                 DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
     DBus::UniqueDBusMessage reply = nullptr;
+    DBusMessageIter         iter;
+    ClientError             error = FindCachedProperty(aPropertyName, iter);
 
+    if (error != ClientError::ERROR_NONE)
+    {
+        SuccessOrExit(error = CallGetProperty(aPropertyName, reply));
+        VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), error = ClientError::ERROR_DBUS);
+    }
+
+    VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE,
+                 error = ClientError::ERROR_DBUS);
+
+exit:
+    return error;
+}
+
+ClientError ThreadApiDBus::CallGetProperty(const std::string &aPropertyName, UniqueDBusMessage &aReply)
+{
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
+                                                                 DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
+    ClientError ret = ClientError::ERROR_NONE;
+    DBusError   error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+    otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
+    aReply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(aReply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(aReply.get()));
+
+    if (mPropertyCacheEnabled)
+    {
+        CacheProperty(aPropertyName, aReply.get());
+    }
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+UniqueDBusMessage ThreadApiDBus::NewMethodCall(const std::string &aInterfaceName, const std::string &aMethodName)
+{
+    return UniqueDBusMessage(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
+                                                          aInterfaceName.c_str(), aMethodName.c_str()));
+}
+
+ClientError ThreadApiDBus::SendAsync(DBusMessage &aMessage, const ReplyHandler &aHandler)
+{
+    ClientError      error   = ClientError::ERROR_NONE;
+    DBusPendingCall *pending = nullptr;
+    ReplyHandler *   handler = nullptr;
+
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, &aMessage, &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 error = ClientError::ERROR_DBUS);
+
+    handler = new ReplyHandler(aHandler);
+    if (!dbus_pending_call_set_notify(pending, sHandleAsyncReply, handler, sFreeReplyHandler))
+    {
+        delete handler;
+        dbus_pending_call_cancel(pending);
+        ExitNow(error = ClientError::ERROR_DBUS);
+    }
+
+exit:
+    if (pending != nullptr)
+    {
+        // The connection keeps its own reference until the reply arrives or the call times out.
+        dbus_pending_call_unref(pending);
+    }
+    return error;
+}
+
+ClientError ThreadApiDBus::CheckReply(DBusMessage *aReply)
+{
+    ClientError error = ClientError::ERROR_DBUS;
+
+    VerifyOrExit(aReply != nullptr);
+    error = DBus::CheckErrorMessage(aReply);
+
+    // Errors not defined by OpenThread, e.g. an unknown method, are reported as d-bus errors.
+    if (error == ClientError::ERROR_NONE && dbus_message_get_type(aReply) == DBUS_MESSAGE_TYPE_ERROR)
+    {
+        error = ClientError::ERROR_DBUS;
+    }
+
+exit:
+    return error;
+}
+
+void ThreadApiDBus::sHandleAsyncReply(DBusPendingCall *aPending, void *aReplyHandler)
+{
+    UniqueDBusMessage reply(dbus_pending_call_steal_reply(aPending));
+
+    (*static_cast<ReplyHandler *>(aReplyHandler))(reply.get());
+}
+
+void ThreadApiDBus::sFreeReplyHandler(void *aReplyHandler)
+{
+    delete static_cast<ReplyHandler *>(aReplyHandler);
+}
+
+void ThreadApiDBus::SetPropertyCacheEnabled(bool aEnabled, Milliseconds aMaxAge)
+{
+    mPropertyCacheEnabled = aEnabled;
+    mPropertyCacheMaxAge  = aMaxAge;
+
+    if (!aEnabled)
+    {
+        InvalidatePropertyCache();
+    }
+}
+
+ClientError ThreadApiDBus::GetPropertyCacheAge(const std::string &aPropertyName, Milliseconds &aAge) const
+{
+    ClientError error = ClientError::ERROR_NONE;
+    auto        iter  = mPropertyCache.find(aPropertyName);
+
+    VerifyOrExit(iter != mPropertyCache.end(), error = ClientError::OT_ERROR_NOT_FOUND);
+    aAge = std::chrono::duration_cast<Milliseconds>(Clock::now() - iter->second.mUpdateTime);
+
+exit:
+    return error;
+}
+
+void ThreadApiDBus::InvalidatePropertyCache(void)
+{
+    mPropertyCache.clear();
+}
+
+void ThreadApiDBus::CacheProperty(const std::string &aPropertyName, DBusMessage *aMessage)
+{
+    CachedProperty &cachedProperty = mPropertyCache[aPropertyName];
+
+    cachedProperty.mMessage    = UniqueDBusMessage(dbus_message_ref(aMessage));
+    cachedProperty.mUpdateTime = Clock::now();
+}
+
+ClientError ThreadApiDBus::FindCachedProperty(const std::string &aPropertyName, DBusMessageIter &aIter)
+{
+    ClientError  error = ClientError::OT_ERROR_NOT_FOUND;
+    auto         iter  = mPropertyCache.find(aPropertyName);
+    DBusMessage *message;
+
+    VerifyOrExit(mPropertyCacheEnabled && iter != mPropertyCache.end());
+
+    if (Clock::now() - iter->second.mUpdateTime > mPropertyCacheMaxAge)
+    {
+        mPropertyCache.erase(iter);
+        ExitNow();
+    }
+
+    message = iter->second.mMessage.get();
+
+    if (dbus_message_get_type(message) == DBUS_MESSAGE_TYPE_SIGNAL)
+    {
+        error = FindChangedProperty(message, aPropertyName, aIter);
+    }
+    else
+    {
+        VerifyOrExit(dbus_message_iter_init(message, &aIter), error = ClientError::ERROR_DBUS);
+        error = ClientError::ERROR_NONE;
+    }
+
+exit:
+    return error;
+}
+
+ClientError ThreadApiDBus::CallGetProperties(const std::vector<std::string> &aPropertyNames,
+                                             UniqueDBusMessage &             aReply,
+                                             DBusMessageIter &               aIter)
+{
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call(mServiceName.c_str(), mObjectPath.c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE,
+                                                                 OTBR_DBUS_GET_PROPERTIES_METHOD));
     ClientError     ret = ClientError::ERROR_NONE;
     DBusError       error;
     DBusMessageIter iter;
 
     dbus_error_init(&error);
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
-    otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
-    reply = DBus::UniqueDBusMessage(
+    VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    aReply = DBus::UniqueDBusMessage(
         dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
 
     VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
-    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
-    SuccessOrExit(DBus::CheckErrorMessage(reply.get()));
-    VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
-    VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(aReply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(aReply.get()));
+    VerifyOrExit(dbus_message_iter_init(aReply.get(), &iter), ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+    dbus_message_iter_recurse(&iter, &aIter);
 
 exit:
     dbus_error_free(&error);
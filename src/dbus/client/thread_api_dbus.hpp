@@ -35,11 +35,15 @@
 #define OTBR_THREAD_API_DBUS_HPP_
 
 #include <functional>
+#include <unordered_map>
 
 #include <dbus/dbus.h>
 
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -51,9 +55,17 @@ bool IsThreadActive(DeviceRole aRole);
 class ThreadApiDBus
 {
 public:
-    using DeviceRoleHandler = std::function<void(DeviceRole)>;
-    using ScanHandler       = std::function<void(const std::vector<ActiveScanResult> &)>;
-    using OtResultHandler   = std::function<void(ClientError)>;
+    using DeviceRoleHandler        = std::function<void(DeviceRole)>;
+    using ChildTableChangedHandler = std::function<void(const std::vector<ChildInfo> &aAdded,
+                                                        const std::vector<uint64_t> & aRemoved,
+                                                        const std::vector<ChildInfo> &aUpdated)>;
+    using ScanHandler             = std::function<void(const std::vector<ActiveScanResult> &)>;
+    using ScanResultHandler       = std::function<void(const ActiveScanResult &)>;
+    using OtResultHandler         = std::function<void(ClientError)>;
+    using ChannelSelectionHandler = std::function<void(ClientError                        aError,
+                                                       uint8_t                            aChannel,
+                                                       const std::vector<ChannelEnergy> & aEnergies,
+                                                       const std::vector<ChannelQuality> &aOccupancies)>;
 
     /**
      * The constructor of a d-bus object.
@@ -82,6 +94,38 @@ public:
      */
     void AddDeviceRoleHandler(const DeviceRoleHandler &aHandler);
 
+    /**
+     * This method adds a callback for child table changes.
+     *
+     * The handler receives the children added, the extended addresses of the children removed and the children
+     * updated since the previous `ChildTableChanged` signal. Together with `GetChildTablePage()` this keeps a copy of
+     * the child table without fetching the whole table again.
+     *
+     * The first handler subscribes this connection to the signal, whose deltas start from the child table at that
+     * time, so the table is better fetched after adding the handler.
+     *
+     * @param[in]   aHandler  The child table changed handler.
+     *
+     * @retval ERROR_NONE successfully subscribed to the signal
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AddChildTableChangedHandler(const ChildTableChangedHandler &aHandler);
+
+    /**
+     * This method adds a callback for each beacon received during a Thread network scan.
+     *
+     * The handler receives the results as they arrive, of scans started by any client. The first handler subscribes
+     * this connection to the signal, the results over its rate limit are only in the reply of `Scan()`.
+     *
+     * @param[in]   aHandler  The scan result handler.
+     *
+     * @retval ERROR_NONE successfully subscribed to the signal
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AddScanResultHandler(const ScanResultHandler &aHandler);
+
     /**
      * This method permits unsecure join on port.
      *
@@ -98,6 +142,8 @@ public:
     /**
      * This method performs a Thread network scan.
      *
+     * The agent may serve the call by a scan already in progress or by the results of a recent scan.
+     *
      * @param[in]   aHandler  The scan result handler.
      *
      * @retval ERROR_NONE successfully performed the dbus function call
@@ -145,6 +191,31 @@ public:
      */
     ClientError Attach(const OtResultHandler &aHandler);
 
+    /**
+     * This method attaches the device to the Thread network on the quietest channel of a channel mask.
+     *
+     * @param[in]   aNetworkName    The network name.
+     * @param[in]   aPanId          The pan id, UINT16_MAX for random.
+     * @param[in]   aExtPanId       The extended pan id, UINT64_MAX for random.
+     * @param[in]   aMasterKey      The master key, empty for random.
+     * @param[in]   aPSKc           The pre-shared commissioner key, empty for random.
+     * @param[in]   aChannelMask    A bitmask for valid channels.
+     * @param[in]   aHandler        The attach result handler, receiving the selected channel and the energy scan or
+     *                              channel monitor data it was selected from.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AttachOnQuietestChannel(const std::string &            aNetworkName,
+                                        uint16_t                       aPanId,
+                                        uint64_t                       aExtPanId,
+                                        const std::vector<uint8_t> &   aMasterKey,
+                                        const std::vector<uint8_t> &   aPSKc,
+                                        uint32_t                       aChannelMask,
+                                        const ChannelSelectionHandler &aHandler);
+
     /**
      * This method performs a factory reset.
      *
@@ -203,6 +274,25 @@ public:
      */
     ClientError JoinerStop(void);
 
+    /**
+     * This method adds several joiners to the commissioner in one call.
+     *
+     * @param[in]   aJoinerIds      The joiner ids, each `*` for any joiner, an EUI64 in hex, or a discerner as
+     *                              `value/length`.
+     * @param[in]   aPskds          The pre-shared keys of the joiners, one for each joiner id.
+     * @param[in]   aTimeout        The timeout in seconds the joiners are kept, 0 for the commissioner default.
+     * @param[out]  aSteeringData   The steering data of all the joiners of the commissioner.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AddJoiners(const std::vector<std::string> &aJoinerIds,
+                           const std::vector<std::string> &aPskds,
+                           uint32_t                        aTimeout,
+                           std::vector<uint8_t> &          aSteeringData);
+
     /**
      * This method adds a on-mesh address prefix.
      *
@@ -251,6 +341,27 @@ public:
      */
     ClientError RemoveExternalRoute(const Ip6Prefix &aPrefix);
 
+    /**
+     * This method adds and removes on-mesh prefixes and external routes, then registers the network data once.
+     *
+     * The removals are applied before the additions. The changes stop at the first failure, the changes applied
+     * before it are kept and registered.
+     *
+     * @param[in]   aAddedPrefixes      The on-mesh prefixes to add.
+     * @param[in]   aRemovedPrefixes    The on-mesh prefixes to remove.
+     * @param[in]   aAddedRoutes        The external routes to add.
+     * @param[in]   aRemovedRoutes      The external route prefixes to remove.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError UpdateNetworkData(const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                  const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                  const std::vector<ExternalRoute> &aAddedRoutes,
+                                  const std::vector<Ip6Prefix> &    aRemovedRoutes);
+
     /**
      * This method sets the mesh-local prefix.
      *
@@ -495,6 +606,8 @@ public:
     /**
      * This method gets the network data.
      *
+     * The network data is decoded into @p aNetworkData in place, so a vector reused across calls keeps its capacity.
+     *
      * @param[out]  aNetworkData   The network data.
      *
      * @retval ERROR_NONE successfully performed the dbus function call
@@ -555,6 +668,8 @@ public:
     /**
      * This method gets the child table.
      *
+     * The child table is decoded into @p aChildTable in place, so a vector reused across calls keeps its capacity.
+     *
      * @param[out]  aChildTable     The child table.
      *
      * @retval ERROR_NONE successfully performed the dbus function call
@@ -567,6 +682,9 @@ public:
     /**
      * This method gets the neighbor table.
      *
+     * The neighbor table is decoded into @p aNeighborTable in place, so a vector reused across calls keeps its
+     * capacity.
+     *
      * @param[out]  aNeighborTable     The neighbor table.
      *
      * @retval ERROR_NONE successfully performed the dbus function call
@@ -576,6 +694,71 @@ public:
      */
     ClientError GetNeighborTable(std::vector<NeighborInfo> &aNeighborTable);
 
+    /**
+     * This method gets a page of the child table.
+     *
+     * @param[in]   aOffset     The index of the first child entry to get.
+     * @param[in]   aCount      The maximum number of child entries to get.
+     * @param[out]  aChildren   The child entries.
+     * @param[out]  aTotal      The number of entries in the whole child table.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetChildTablePage(uint16_t                aOffset,
+                                  uint16_t                aCount,
+                                  std::vector<ChildInfo> &aChildren,
+                                  uint16_t &              aTotal);
+
+    /**
+     * This method gets a page of the neighbor table.
+     *
+     * @param[in]   aOffset     The index of the first neighbor entry to get.
+     * @param[in]   aCount      The maximum number of neighbor entries to get.
+     * @param[out]  aNeighbors  The neighbor entries.
+     * @param[out]  aTotal      The number of entries in the whole neighbor table.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetNeighborTablePage(uint16_t                   aOffset,
+                                     uint16_t                   aCount,
+                                     std::vector<NeighborInfo> &aNeighbors,
+                                     uint16_t &                 aTotal);
+
+    /**
+     * This method exports the whole child table through a sealed memfd.
+     *
+     * The agent hands over the table as one compact binary blob instead of marshalling every entry, which is
+     * cheaper than `GetChildTable()` for large tables. It requires a connection supporting Unix fd passing.
+     *
+     * @param[out]  aChildTable   The child table.
+     *
+     * @retval ERROR_NONE               successfully performed the dbus function call
+     * @retval ERROR_DBUS               dbus encode/decode error, or the memfd could not be decoded
+     * @retval OT_ERROR_NOT_CAPABLE     the connection does not support Unix fd passing
+     * @retval ...                      OpenThread defined error value otherwise
+     *
+     */
+    ClientError ExportChildTable(std::vector<ChildInfo> &aChildTable);
+
+    /**
+     * This method exports the whole neighbor table through a sealed memfd.
+     *
+     * @param[out]  aNeighborTable  The neighbor table.
+     *
+     * @retval ERROR_NONE               successfully performed the dbus function call
+     * @retval ERROR_DBUS               dbus encode/decode error, or the memfd could not be decoded
+     * @retval OT_ERROR_NOT_CAPABLE     the connection does not support Unix fd passing
+     * @retval ...                      OpenThread defined error value otherwise
+     *
+     */
+    ClientError ExportNeighborTable(std::vector<NeighborInfo> &aNeighborTable);
+
     /**
      * This method gets the network's parition id.
      *
@@ -627,6 +810,8 @@ public:
     /**
      * This method gets the active operational dataset
      *
+     * The dataset is decoded into @p aDataset in place, so a vector reused across calls keeps its capacity.
+     *
      * @param[out]  aDataset    The active operational dataset
      *
      * @retval ERROR_NONE successfully performed the dbus function call
@@ -648,6 +833,197 @@ public:
      */
     ClientError GetRadioRegion(std::string &aRadioRegion);
 
+    /**
+     * This method gets the latency statistics of the otbr-agent mainloop.
+     *
+     * @param[out]  aStats  The mainloop statistics.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMainloopStats(MainloopStats &aStats);
+
+    /**
+     * This method gets the statistics of the radio link to the RCP.
+     *
+     * @param[out]  aStats  The radio link statistics.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetRadioStats(RadioStats &aStats);
+
+    /**
+     * This method gets a binary dump of the hot path trace buffer of the otbr-agent.
+     *
+     * @param[out]  aDump  The trace dump, which can be decoded with `otbr-trace-decode`.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetTraceBuffer(std::vector<uint8_t> &aDump);
+
+    /**
+     * This method gets the event counters of the Backbone Router.
+     *
+     * @param[out]  aCounters  The Backbone Router counters.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetBackboneRouterCounters(BackboneRouterCounters &aCounters);
+
+    /**
+     * This method gets several properties with a single dbus call.
+     *
+     * @param[in]   aPropertyNames  The names of the properties, e.g. `OTBR_DBUS_PROPERTY_LINK_COUNTERS`.
+     * @param[out]  aValues         The values of the properties, in the order of @p aPropertyNames.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    template <typename... ValTypes>
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, ValTypes &... aValues)
+    {
+        UniqueDBusMessage reply;
+        DBusMessageIter   iter;
+        ClientError       error;
+
+        VerifyOrExit(aPropertyNames.size() == sizeof...(ValTypes), error = ClientError::OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = CallGetProperties(aPropertyNames, reply, iter));
+        error = ExtractProperties(iter, aValues...);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method reads a property without waiting for the reply.
+     *
+     * The handler is called when the caller's event loop dispatches the connection, e.g. with
+     * `dbus_connection_read_write_dispatch()`, so that many requests may be in flight at once.
+     *
+     * @param[in]   aPropertyName   The property name.
+     * @param[in]   aHandler        The handler called with the result and the property value.
+     *
+     * @retval ERROR_NONE successfully sent the request
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    template <typename ValType>
+    ClientError GetPropertyAsync(const std::string &                                      aPropertyName,
+                                 const std::function<void(ClientError, const ValType &)> &aHandler)
+    {
+        ClientError       error   = ClientError::ERROR_NONE;
+        UniqueDBusMessage message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD);
+
+        VerifyOrExit(message != nullptr, error = ClientError::ERROR_DBUS);
+        VerifyOrExit(TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName)) ==
+                         OTBR_ERROR_NONE,
+                     error = ClientError::ERROR_DBUS);
+
+        error = SendAsync(*message, [aHandler](DBusMessage *aReply) {
+            ValType         value{};
+            DBusMessageIter iter;
+            ClientError     replyError = CheckReply(aReply);
+
+            if (replyError == ClientError::ERROR_NONE &&
+                (!dbus_message_iter_init(aReply, &iter) ||
+                 DBusMessageExtractFromVariant(&iter, value) != OTBR_ERROR_NONE))
+            {
+                replyError = ClientError::ERROR_DBUS;
+            }
+
+            aHandler(replyError, value);
+        });
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method writes a property without waiting for the reply.
+     *
+     * @param[in]   aPropertyName   The property name.
+     * @param[in]   aValue          The property value.
+     * @param[in]   aHandler        The handler called with the result, may be nullptr.
+     *
+     * @retval ERROR_NONE successfully sent the request
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    template <typename ValType>
+    ClientError SetPropertyAsync(const std::string &    aPropertyName,
+                                 const ValType &        aValue,
+                                 const OtResultHandler &aHandler)
+    {
+        ClientError       error   = ClientError::ERROR_NONE;
+        UniqueDBusMessage message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_SET_METHOD);
+        DBusMessageIter   iter;
+
+        mPropertyCache.erase(aPropertyName);
+
+        VerifyOrExit(message != nullptr, error = ClientError::ERROR_DBUS);
+        dbus_message_iter_init_append(message.get(), &iter);
+        VerifyOrExit(DBusMessageEncode(&iter, OTBR_DBUS_THREAD_INTERFACE) == OTBR_ERROR_NONE,
+                     error = ClientError::ERROR_DBUS);
+        VerifyOrExit(DBusMessageEncode(&iter, aPropertyName) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+        VerifyOrExit(DBusMessageEncodeToVariant(&iter, aValue) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+
+        error = SendAsync(*message, [aHandler](DBusMessage *aReply) {
+            if (aHandler != nullptr)
+            {
+                aHandler(CheckReply(aReply));
+            }
+        });
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method calls a method of the Thread interface without waiting for the reply.
+     *
+     * @param[in]   aMethodName     The method name, e.g. `OTBR_DBUS_DETACH_METHOD`.
+     * @param[in]   aArgs           The tuple of the method arguments.
+     * @param[in]   aHandler        The handler called with the result, may be nullptr.
+     *
+     * @retval ERROR_NONE successfully sent the request
+     * @retval ERROR_DBUS dbus encode/decode error
+     *
+     */
+    template <typename... ArgTypes>
+    ClientError CallMethodAsync(const std::string &            aMethodName,
+                                const std::tuple<ArgTypes...> &aArgs,
+                                const OtResultHandler &        aHandler)
+    {
+        ClientError       error   = ClientError::ERROR_NONE;
+        UniqueDBusMessage message = NewMethodCall(OTBR_DBUS_THREAD_INTERFACE, aMethodName);
+
+        VerifyOrExit(message != nullptr, error = ClientError::ERROR_DBUS);
+        VerifyOrExit(TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+
+        error = SendAsync(*message, [aHandler](DBusMessage *aReply) {
+            if (aHandler != nullptr)
+            {
+                aHandler(CheckReply(aReply));
+            }
+        });
+
+    exit:
+        return error;
+    }
+
     /**
      * This method returns the network interface name the client is bound to.
      *
@@ -656,29 +1032,111 @@ public:
      */
     std::string GetInterfaceName(void);
 
+    /**
+     * This method enables or disables the property cache.
+     *
+     * With the cache enabled, a property read is served from memory if the value was fetched or received in a
+     * `PropertiesChanged` signal within @p aMaxAge. Disabling the cache drops all the cached values.
+     *
+     * @param[in]   aEnabled    Whether to enable the property cache.
+     * @param[in]   aMaxAge     The maximum age of a cached value to be served.
+     *
+     */
+    void SetPropertyCacheEnabled(bool aEnabled, Milliseconds aMaxAge);
+
+    /**
+     * This method returns the time elapsed since a cached property value was updated.
+     *
+     * @param[in]   aPropertyName   The property name.
+     * @param[out]  aAge            The age of the cached value.
+     *
+     * @retval ERROR_NONE           Successfully got the age of the cached value.
+     * @retval OT_ERROR_NOT_FOUND   The property value is not cached.
+     *
+     */
+    ClientError GetPropertyCacheAge(const std::string &aPropertyName, Milliseconds &aAge) const;
+
+    /**
+     * This method drops all the cached property values.
+     *
+     */
+    void InvalidatePropertyCache(void);
+
 private:
+    using ReplyHandler = std::function<void(DBusMessage *aReply)>;
+
+    UniqueDBusMessage  NewMethodCall(const std::string &aInterfaceName, const std::string &aMethodName);
+    ClientError        SendAsync(DBusMessage &aMessage, const ReplyHandler &aHandler);
+    static ClientError CheckReply(DBusMessage *aReply);
+    static void        sHandleAsyncReply(DBusPendingCall *aPending, void *aReplyHandler);
+    static void        sFreeReplyHandler(void *aReplyHandler);
+
+    struct CachedProperty
+    {
+        UniqueDBusMessage mMessage;
+        Timepoint         mUpdateTime;
+    };
+
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
 
     template <typename ArgType> ClientError CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs);
 
+    template <typename ArgType, typename ReplyType>
+    ClientError CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs, ReplyType &aReply);
+
     template <typename ArgType>
     ClientError CallDBusMethodAsync(const std::string &           aMethodName,
                                     const ArgType &               aArgs,
                                     DBusPendingCallNotifyFunction aFunction);
 
+    template <typename TableType> ClientError ExportTable(const std::string &aMethodName, TableType &aTable);
+
     template <typename ValType> ClientError SetProperty(const std::string &aPropertyName, const ValType &aValue);
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
 
+    ClientError CallGetProperty(const std::string &aPropertyName, UniqueDBusMessage &aReply);
+    ClientError FindCachedProperty(const std::string &aPropertyName, DBusMessageIter &aIter);
+    void        CacheProperty(const std::string &aPropertyName, DBusMessage *aMessage);
+
+    ClientError CallGetProperties(const std::vector<std::string> &aPropertyNames,
+                                  UniqueDBusMessage &             aReply,
+                                  DBusMessageIter &               aIter);
+
+    ClientError ExtractProperties(DBusMessageIter &aIter)
+    {
+        OTBR_UNUSED_VARIABLE(aIter);
+        return ClientError::ERROR_NONE;
+    }
+
+    template <typename ValType, typename... ValTypes>
+    ClientError ExtractProperties(DBusMessageIter &aIter, ValType &aValue, ValTypes &... aValues)
+    {
+        ClientError error = ClientError::ERROR_NONE;
+
+        VerifyOrExit(DBusMessageExtractFromVariant(&aIter, aValue) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+        dbus_message_iter_next(&aIter);
+        error = ExtractProperties(aIter, aValues...);
+
+    exit:
+        return error;
+    }
+
     ClientError              SubscribeDeviceRoleSignal(void);
+    ClientError              SubscribeSignal(const std::string &aSignalName);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
 
+    void HandlePropertyChanged(DBusMessage *aMessage, const std::string &aPropertyName, DBusMessageIter &aValueIter);
+    void HandleChildTableChanged(DBusMessage *aMessage);
+    void HandleScanResult(DBusMessage *aMessage);
+
     template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
     static void sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus);
 
     void        AttachPendingCallHandler(DBusPendingCall *aPending);
+    void        AttachOnQuietestChannelPendingCallHandler(DBusPendingCall *aPending);
     void        FactoryResetPendingCallHandler(DBusPendingCall *aPending);
     void        JoinerStartPendingCallHandler(DBusPendingCall *aPending);
     static void sScanPendingCallHandler(DBusPendingCall *aPending, void *aThreadApiDBus);
@@ -687,15 +1145,24 @@ private:
     static void EmptyFree(void *) {}
 
     std::string mInterfaceName;
+    std::string mServiceName;
+    std::string mObjectPath;
 
     DBusConnection *mConnection;
 
-    ScanHandler     mScanHandler;
-    OtResultHandler mAttachHandler;
-    OtResultHandler mFactoryResetHandler;
-    OtResultHandler mJoinerHandler;
+    ScanHandler             mScanHandler;
+    OtResultHandler         mAttachHandler;
+    ChannelSelectionHandler mChannelSelectionHandler;
+    OtResultHandler         mFactoryResetHandler;
+    OtResultHandler         mJoinerHandler;
+
+    std::vector<DeviceRoleHandler>        mDeviceRoleHandlers;
+    std::vector<ChildTableChangedHandler> mChildTableChangedHandlers;
+    std::vector<ScanResultHandler>        mScanResultHandlers;
 
-    std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+    bool                                            mPropertyCacheEnabled;
+    Milliseconds                                    mPropertyCacheMaxAge;
+    std::unordered_map<std::string, CachedProperty> mPropertyCache;
 };
 
 } // namespace DBus
@@ -38,6 +38,7 @@
 #define DBUS_PROPERTY_SET_METHOD "Set"
 #define DBUS_PROPERTY_GET_ALL_METHOD "GetAll"
 #define DBUS_PROPERTIES_CHANGED_SIGNAL "PropertiesChanged"
+#define DBUS_NAME_OWNER_CHANGED_SIGNAL "NameOwnerChanged"
 #define DBUS_INTROSPECT_METHOD "Introspect"
 
 #define OTBR_DBUS_SERVER_PREFIX "io.openthread.BorderRouter."
@@ -46,6 +47,7 @@
 
 #define OTBR_DBUS_SCAN_METHOD "Scan"
 #define OTBR_DBUS_ATTACH_METHOD "Attach"
+#define OTBR_DBUS_ATTACH_ON_QUIETEST_CHANNEL_METHOD "AttachOnQuietestChannel"
 #define OTBR_DBUS_DETACH_METHOD "Detach"
 #define OTBR_DBUS_FACTORY_RESET_METHOD "FactoryReset"
 #define OTBR_DBUS_RESET_METHOD "Reset"
@@ -54,8 +56,22 @@
 #define OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD "PermitUnsecureJoin"
 #define OTBR_DBUS_JOINER_START_METHOD "JoinerStart"
 #define OTBR_DBUS_JOINER_STOP_METHOD "JoinerStop"
+#define OTBR_DBUS_ADD_JOINERS_METHOD "AddJoiners"
 #define OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD "AddExternalRoute"
 #define OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD "RemoveExternalRoute"
+#define OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD "UpdateNetworkData"
+#define OTBR_DBUS_GET_PROPERTIES_METHOD "GetProperties"
+#define OTBR_DBUS_GET_CHILD_TABLE_PAGE_METHOD "GetChildTablePage"
+#define OTBR_DBUS_GET_NEIGHBOR_TABLE_PAGE_METHOD "GetNeighborTablePage"
+#define OTBR_DBUS_GET_METRICS_METHOD "GetMetrics"
+#define OTBR_DBUS_DUMP_TRACE_BUFFER_METHOD "DumpTraceBuffer"
+#define OTBR_DBUS_EXPORT_CHILD_TABLE_METHOD "ExportChildTable"
+#define OTBR_DBUS_EXPORT_NEIGHBOR_TABLE_METHOD "ExportNeighborTable"
+#define OTBR_DBUS_SUBSCRIBE_SIGNAL_METHOD "SubscribeSignal"
+#define OTBR_DBUS_UNSUBSCRIBE_SIGNAL_METHOD "UnsubscribeSignal"
+
+#define OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL "ChildTableChanged"
+#define OTBR_DBUS_SCAN_RESULT_SIGNAL "ScanResult"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LEGACY_ULA_PREFIX "LegacyULAPrefix"
@@ -87,6 +103,9 @@
 #define OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES "ExternalRoutes"
 #define OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS "ActiveDatasetTlvs"
 #define OTBR_DBUS_PROPERTY_RADIO_REGION "RadioRegion"
+#define OTBR_DBUS_PROPERTY_MAINLOOP_STATS "MainloopStats"
+#define OTBR_DBUS_PROPERTY_BACKBONE_ROUTER_COUNTERS "BackboneRouterCounters"
+#define OTBR_DBUS_PROPERTY_RADIO_STATS "RadioStats"
 
 #define OTBR_ROLE_NAME_DISABLED "disabled"
 #define OTBR_ROLE_NAME_DETACHED "detached"
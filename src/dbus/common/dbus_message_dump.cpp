@@ -38,6 +38,8 @@
 namespace otbr {
 namespace DBus {
 
+static bool sDumpEnabled = false;
+
 static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
 {
     int type = dbus_message_iter_get_arg_type(aIter);
@@ -118,6 +120,10 @@ static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
             sout << "\"" << buf << "\", ";
             break;
         }
+        case DBUS_TYPE_UNIX_FD:
+            // Reading a Unix fd duplicates it, so only its presence is dumped.
+            sout << "<fd>, ";
+            break;
         case DBUS_TYPE_ARRAY:
         {
             DBusMessageIter subIter;
@@ -172,6 +178,7 @@ void DumpDBusMessage(DBusMessage &aMessage)
     DBusMessageIter    iter;
     std::ostringstream sout;
 
+    VerifyOrExit(otbrLogGetLevel() >= OTBR_LOG_DEBUG);
     VerifyOrExit(dbus_message_iter_init(&aMessage, &iter), otbrLogDebug("Failed to iterate dbus message during dump"));
     sout << "{ ";
     DumpDBusMessage(sout, &iter);
@@ -181,5 +188,15 @@ exit:
     return;
 }
 
+void SetDBusMessageDumpEnabled(bool aEnabled)
+{
+    sDumpEnabled = aEnabled;
+}
+
+bool IsDBusMessageDumpEnabled(void)
+{
+    return sDumpEnabled;
+}
+
 } // namespace DBus
 } // namespace otbr
@@ -46,6 +46,38 @@ namespace DBus {
  */
 void DumpDBusMessage(DBusMessage &aMessage);
 
+/**
+ * This function enables or disables the dumps of DBus messages, which are disabled by default.
+ *
+ * Enabled dumps are written at the debug log level.
+ *
+ * @param[in] aEnabled  Whether to dump DBus messages.
+ */
+void SetDBusMessageDumpEnabled(bool aEnabled);
+
+/**
+ * This function indicates whether DBus messages are dumped.
+ *
+ * @returns Whether DBus messages are dumped.
+ */
+bool IsDBusMessageDumpEnabled(void);
+
+/**
+ * This macro dumps a DBus message to the log if the dumps are enabled.
+ *
+ * The dumps are expected to be disabled, so the message is not touched otherwise.
+ *
+ * @param[in] aMessage  The DBus message to dump.
+ */
+#define OTBR_DBUS_DUMP_MESSAGE(aMessage)                                     \
+    do                                                                       \
+    {                                                                        \
+        if (__builtin_expect(otbr::DBus::IsDBusMessageDumpEnabled(), false)) \
+        {                                                                    \
+            otbr::DBus::DumpDBusMessage(aMessage);                           \
+        }                                                                    \
+    } while (false)
+
 } // namespace DBus
 } // namespace otbr
 
@@ -71,39 +71,16 @@ exit:
     return error;
 }
 
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue)
+otbrError DBusMessageExtract(DBusMessageIter *aIter, UnixFd &aValue)
 {
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint16_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint32_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint64_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int16_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
+    otbrError error = OTBR_ERROR_NONE;
 
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int32_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
+    VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_UNIX_FD, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_get_basic(aIter, &aValue.mFd);
+    dbus_message_iter_next(aIter);
 
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int64_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
+exit:
+    return error;
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, bool aValue)
@@ -142,39 +119,14 @@ exit:
     return error;
 }
 
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint8_t> &aValue)
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const UnixFd &aValue)
 {
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint16_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint32_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint64_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
+    otbrError error = OTBR_ERROR_NONE;
 
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int16_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
+    VerifyOrExit(dbus_message_iter_append_basic(aIter, DBUS_TYPE_UNIX_FD, &aValue.mFd), error = OTBR_ERROR_DBUS);
 
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int32_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int64_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
+exit:
+    return error;
 }
 
 bool IsDBusMessageEmpty(DBusMessage &aMessage)
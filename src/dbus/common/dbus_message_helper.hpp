@@ -37,6 +37,7 @@
 #include <array>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <dbus/dbus.h>
@@ -73,6 +74,16 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderDat
 otbrError DBusMessageExtract(DBusMessageIter *aIter, LeaderData &aLeaderData);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelQuality &aQuality);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelQuality &aQuality);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelEnergy &aEnergy);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelEnergy &aEnergy);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopLatency &aLatency);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopLatency &aLatency);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopStats &aStats);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const BackboneRouterCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, BackboneRouterCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, RadioStats &aStats);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -124,12 +135,42 @@ template <> struct DBusTypeTrait<std::vector<ExternalRoute>>
     static constexpr const char *TYPE_AS_STRING = "a((ayy)qybb)";
 };
 
+template <> struct DBusTypeTrait<OnMeshPrefix>
+{
+    // struct of {{array of bytes, byte}, byte, struct of seven bools}
+    static constexpr const char *TYPE_AS_STRING = "((ayy)y(bbbbbbb))";
+};
+
 template <> struct DBusTypeTrait<LeaderData>
 {
     // struct of { uint32, byte, byte, byte, byte }
     static constexpr const char *TYPE_AS_STRING = "(uyyyy)";
 };
 
+template <> struct DBusTypeTrait<MainloopLatency>
+{
+    // struct of { string, uint64, uint64, uint64, array of uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(stttat)";
+};
+
+template <> struct DBusTypeTrait<MainloopStats>
+{
+    // struct of { uint64, uint64, array of struct of { string, uint64, uint64, uint64, array of uint64 } }
+    static constexpr const char *TYPE_AS_STRING = "(ttta(stttat))";
+};
+
+template <> struct DBusTypeTrait<BackboneRouterCounters>
+{
+    // struct of { uint64 x 13 }
+    static constexpr const char *TYPE_AS_STRING = "(ttttttttttttt)";
+};
+
+template <> struct DBusTypeTrait<RadioStats>
+{
+    // struct of { uint64 x 9, struct of { string, uint64, uint64, uint64, array of uint64 } }
+    static constexpr const char *TYPE_AS_STRING = "(ttttttttt(stttat))";
+};
+
 template <> struct DBusTypeTrait<std::vector<ChannelQuality>>
 {
     // array of struct of { uint8, uint16 }
@@ -170,6 +211,18 @@ template <> struct DBusTypeTrait<ChannelQuality>
     static constexpr const char *TYPE_AS_STRING = "(yq)";
 };
 
+template <> struct DBusTypeTrait<ChannelEnergy>
+{
+    // struct of { uint8, int8 }
+    static constexpr const char *TYPE_AS_STRING = "(yy)";
+};
+
+template <> struct DBusTypeTrait<std::vector<ChannelEnergy>>
+{
+    // array of struct of { uint8, int8 }
+    static constexpr const char *TYPE_AS_STRING = "a(yy)";
+};
+
 template <> struct DBusTypeTrait<std::vector<ChildInfo>>
 {
     // array of struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
@@ -231,27 +284,77 @@ template <> struct DBusTypeTrait<std::string>
     static constexpr const char *TYPE_AS_STRING = DBUS_TYPE_STRING_AS_STRING;
 };
 
+/**
+ * This structure represents a Unix file descriptor passed in a d-bus message.
+ *
+ * libdbus duplicates the descriptor when it is appended and hands out a new descriptor when it is read, so the
+ * sender keeps ownership of its descriptor and the receiver must close the extracted one.
+ *
+ */
+struct UnixFd
+{
+    int mFd; ///< The file descriptor.
+};
+
+template <> struct DBusTypeTrait<UnixFd>
+{
+    static constexpr int         TYPE           = DBUS_TYPE_UNIX_FD;
+    static constexpr const char *TYPE_AS_STRING = DBUS_TYPE_UNIX_FD_AS_STRING;
+};
+
+/**
+ * This trait indicates whether arrays of a type are appended and read as a whole block with
+ * `dbus_message_iter_append_fixed_array()` and `dbus_message_iter_get_fixed_array()`.
+ *
+ * This holds for the integer types whose memory layout matches the d-bus wire format. `bool` is excluded since
+ * `dbus_bool_t` is four bytes wide.
+ *
+ */
+template <typename T> struct DBusFixedTypeTrait : std::false_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<int8_t> : std::true_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<uint8_t> : std::true_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<int16_t> : std::true_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<uint16_t> : std::true_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<int32_t> : std::true_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<uint32_t> : std::true_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<int64_t> : std::true_type
+{
+};
+
+template <> struct DBusFixedTypeTrait<uint64_t> : std::true_type
+{
+};
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, bool aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, int8_t aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::string &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const char *aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint8_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint16_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint32_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint64_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int16_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int32_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int64_t> &aValue);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const UnixFd &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, bool &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, int8_t &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::string &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint16_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint32_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint64_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int16_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int32_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int64_t> &aValue);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, UnixFd &aValue);
 
 template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, T &aValue)
 {
@@ -266,28 +369,38 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue)
+template <typename T>
+otbrError DBusMessageExtractArray(DBusMessageIter *aIter, std::vector<T> &aValue, std::false_type aIsFixedType)
 {
     otbrError       error = OTBR_ERROR_NONE;
     DBusMessageIter subIter;
+    size_t          count = 0;
+
+    OTBR_UNUSED_VARIABLE(aIsFixedType);
 
     VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_ARRAY, error = OTBR_ERROR_DBUS);
     dbus_message_iter_recurse(aIter, &subIter);
 
-    aValue.clear();
+    // Decode in place so that both the vector and its elements (e.g. nested strings and vectors) keep their storage
+    // when the same container is decoded into repeatedly.
     while (dbus_message_iter_get_arg_type(&subIter) != DBUS_TYPE_INVALID)
     {
-        T val;
-        SuccessOrExit(error = DBusMessageExtract(&subIter, val));
-        aValue.push_back(val);
+        if (count == aValue.size())
+        {
+            aValue.emplace_back();
+        }
+        SuccessOrExit(error = DBusMessageExtract(&subIter, aValue[count]));
+        count++;
     }
+    aValue.resize(count);
     dbus_message_iter_next(aIter);
 
 exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIter, std::vector<T> &aValue)
+template <typename T>
+otbrError DBusMessageExtractArray(DBusMessageIter *aIter, std::vector<T> &aValue, std::true_type aIsFixedType)
 {
     DBusMessageIter subIter;
     otbrError       error = OTBR_ERROR_NONE;
@@ -295,9 +408,12 @@ template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIt
     int             n;
     int             subtype;
 
+    OTBR_UNUSED_VARIABLE(aIsFixedType);
+
     VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_ARRAY, error = OTBR_ERROR_DBUS);
     dbus_message_iter_recurse(aIter, &subIter);
 
+    aValue.clear();
     subtype = dbus_message_iter_get_arg_type(&subIter);
     if (subtype != DBUS_TYPE_INVALID)
     {
@@ -306,7 +422,7 @@ template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIt
 
         if (val != nullptr)
         {
-            aValue = std::vector<T>(val, val + n);
+            aValue.assign(val, val + n);
         }
     }
     dbus_message_iter_next(aIter);
@@ -315,6 +431,11 @@ exit:
     return error;
 }
 
+template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue)
+{
+    return DBusMessageExtractArray(aIter, aValue, DBusFixedTypeTrait<T>());
+}
+
 template <typename T, size_t SIZE> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::array<T, SIZE> &aValue)
 {
     DBusMessageIter subIter;
@@ -353,12 +474,18 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue)
+template <typename ContainerType>
+otbrError DBusMessageEncodeArray(DBusMessageIter *aIter, const ContainerType &aValue, std::false_type aIsFixedType)
 {
+    using ValueType = typename ContainerType::value_type;
+
     otbrError       error = OTBR_ERROR_NONE;
     DBusMessageIter subIter;
 
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING, &subIter),
+    OTBR_UNUSED_VARIABLE(aIsFixedType);
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<ValueType>::TYPE_AS_STRING,
+                                                  &subIter),
                  error = OTBR_ERROR_DBUS);
 
     for (const auto &v : aValue)
@@ -371,19 +498,25 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const std::vector<T> &aValue)
+template <typename ContainerType>
+otbrError DBusMessageEncodeArray(DBusMessageIter *aIter, const ContainerType &aValue, std::true_type aIsFixedType)
 {
+    using ValueType = typename ContainerType::value_type;
+
     DBusMessageIter subIter;
     otbrError       error = OTBR_ERROR_NONE;
 
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING, &subIter),
+    OTBR_UNUSED_VARIABLE(aIsFixedType);
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<ValueType>::TYPE_AS_STRING,
+                                                  &subIter),
                  error = OTBR_ERROR_DBUS);
 
     if (!aValue.empty())
     {
-        const T *buf = &aValue.front();
+        const ValueType *buf = aValue.data();
 
-        VerifyOrExit(dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<T>::TYPE, &buf,
+        VerifyOrExit(dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<ValueType>::TYPE, &buf,
                                                           static_cast<int>(aValue.size())),
                      error = OTBR_ERROR_DBUS);
     }
@@ -392,26 +525,15 @@ exit:
     return error;
 }
 
+template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue)
+{
+    return DBusMessageEncodeArray(aIter, aValue, DBusFixedTypeTrait<T>());
+}
+
 template <typename T, size_t SIZE>
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::array<T, SIZE> &aValue)
 {
-    DBusMessageIter subIter;
-    otbrError       error = OTBR_ERROR_NONE;
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING, &subIter),
-                 error = OTBR_ERROR_DBUS);
-
-    if (!aValue.empty())
-    {
-        const T *buf = &aValue.front();
-
-        VerifyOrExit(dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<T>::TYPE, &buf,
-                                                          static_cast<int>(aValue.size())),
-                     error = OTBR_ERROR_DBUS);
-    }
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &subIter), error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeArray(aIter, aValue, DBusFixedTypeTrait<T>());
 }
 
 template <size_t I, typename... FieldTypes> struct ElementType
@@ -0,0 +1,356 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dbus/common/table_blob.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace DBus {
+
+namespace {
+
+constexpr uint8_t kTableBlobMagic[]     = {'O', 'T', 'B', 'T'};
+constexpr size_t  kChildRecordSize      = 29;
+constexpr size_t  kNeighborRecordSize   = 30;
+constexpr int     kRequiredSeals        = F_SEAL_SHRINK | F_SEAL_WRITE;
+constexpr uint8_t kFlagRxOnWhenIdle     = 1 << 0;
+constexpr uint8_t kFlagFullThreadDevice = 1 << 1;
+constexpr uint8_t kFlagFullNetworkData  = 1 << 2;
+constexpr uint8_t kFlagIsStateRestoring = 1 << 3;
+constexpr uint8_t kFlagIsChild          = 1 << 3;
+
+class BlobWriter
+{
+public:
+    explicit BlobWriter(std::vector<uint8_t> &aBlob)
+        : mBlob(aBlob)
+    {
+    }
+
+    template <typename T> void Write(T aValue)
+    {
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            mBlob.push_back(static_cast<uint8_t>(static_cast<uint64_t>(aValue) >> (8 * i)));
+        }
+    }
+
+    void WriteHeader(TableBlobKind aKind, size_t aRecordSize, size_t aCount)
+    {
+        mBlob.clear();
+        mBlob.reserve(kTableBlobHeaderSize + aRecordSize * aCount);
+        mBlob.insert(mBlob.end(), kTableBlobMagic, kTableBlobMagic + sizeof(kTableBlobMagic));
+        Write<uint8_t>(kTableBlobVersion);
+        Write<uint8_t>(aKind);
+        Write(static_cast<uint16_t>(aRecordSize));
+        Write(static_cast<uint32_t>(aCount));
+    }
+
+private:
+    std::vector<uint8_t> &mBlob;
+};
+
+class BlobReader
+{
+public:
+    explicit BlobReader(const uint8_t *aRecord)
+        : mCursor(aRecord)
+    {
+    }
+
+    template <typename T> T Read(void)
+    {
+        uint64_t value = 0;
+
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            value |= static_cast<uint64_t>(*mCursor++) << (8 * i);
+        }
+
+        return static_cast<T>(value);
+    }
+
+private:
+    const uint8_t *mCursor;
+};
+
+uint16_t ReadUint16(const uint8_t *aBuffer)
+{
+    return static_cast<uint16_t>(aBuffer[0] | (aBuffer[1] << 8));
+}
+
+uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return static_cast<uint32_t>(ReadUint16(aBuffer)) | (static_cast<uint32_t>(ReadUint16(aBuffer + 2)) << 16);
+}
+
+otbrError ParseHeader(const uint8_t * aBlob,
+                      size_t          aLength,
+                      TableBlobKind   aKind,
+                      size_t          aMinRecordSize,
+                      size_t &        aRecordSize,
+                      size_t &        aCount,
+                      const uint8_t *&aRecords)
+{
+    otbrError error = OTBR_ERROR_PARSE;
+
+    VerifyOrExit(aBlob != nullptr && aLength >= kTableBlobHeaderSize);
+    VerifyOrExit(memcmp(aBlob, kTableBlobMagic, sizeof(kTableBlobMagic)) == 0);
+    VerifyOrExit(aBlob[4] == kTableBlobVersion && aBlob[5] == aKind);
+
+    aRecordSize = ReadUint16(aBlob + 6);
+    aCount      = ReadUint32(aBlob + 8);
+    aRecords    = aBlob + kTableBlobHeaderSize;
+
+    VerifyOrExit(aRecordSize >= aMinRecordSize);
+    VerifyOrExit(aCount == (aLength - kTableBlobHeaderSize) / aRecordSize);
+    VerifyOrExit((aLength - kTableBlobHeaderSize) % aRecordSize == 0);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+template <typename TableType> otbrError DecodeMemfd(int aFd, TableType &aTable)
+{
+    otbrError   error  = OTBR_ERROR_ERRNO;
+    void *      blob   = MAP_FAILED;
+    size_t      length = 0;
+    int         seals;
+    struct stat st;
+
+    seals = fcntl(aFd, F_GET_SEALS);
+    VerifyOrExit(seals != -1);
+    VerifyOrExit((seals & kRequiredSeals) == kRequiredSeals, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(fstat(aFd, &st) == 0);
+    VerifyOrExit(st.st_size >= static_cast<off_t>(kTableBlobHeaderSize), error = OTBR_ERROR_PARSE);
+
+    length = static_cast<size_t>(st.st_size);
+    blob   = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, aFd, 0);
+    VerifyOrExit(blob != MAP_FAILED);
+
+    error = DecodeTableBlob(static_cast<const uint8_t *>(blob), length, aTable);
+
+exit:
+    if (blob != MAP_FAILED)
+    {
+        munmap(blob, length);
+    }
+
+    return error;
+}
+
+} // namespace
+
+void EncodeTableBlob(const std::vector<ChildInfo> &aChildTable, std::vector<uint8_t> &aBlob)
+{
+    BlobWriter writer(aBlob);
+
+    writer.WriteHeader(kTableBlobChildTable, kChildRecordSize, aChildTable.size());
+
+    for (const ChildInfo &child : aChildTable)
+    {
+        uint8_t flags = (child.mRxOnWhenIdle ? kFlagRxOnWhenIdle : 0) |
+                        (child.mFullThreadDevice ? kFlagFullThreadDevice : 0) |
+                        (child.mFullNetworkData ? kFlagFullNetworkData : 0) |
+                        (child.mIsStateRestoring ? kFlagIsStateRestoring : 0);
+
+        writer.Write(child.mExtAddress);
+        writer.Write(child.mTimeout);
+        writer.Write(child.mAge);
+        writer.Write(child.mRloc16);
+        writer.Write(child.mChildId);
+        writer.Write(child.mNetworkDataVersion);
+        writer.Write(child.mLinkQualityIn);
+        writer.Write(static_cast<uint8_t>(child.mAverageRssi));
+        writer.Write(static_cast<uint8_t>(child.mLastRssi));
+        writer.Write(child.mFrameErrorRate);
+        writer.Write(child.mMessageErrorRate);
+        writer.Write(flags);
+    }
+}
+
+void EncodeTableBlob(const std::vector<NeighborInfo> &aNeighborTable, std::vector<uint8_t> &aBlob)
+{
+    BlobWriter writer(aBlob);
+
+    writer.WriteHeader(kTableBlobNeighborTable, kNeighborRecordSize, aNeighborTable.size());
+
+    for (const NeighborInfo &neighbor : aNeighborTable)
+    {
+        uint8_t flags = (neighbor.mRxOnWhenIdle ? kFlagRxOnWhenIdle : 0) |
+                        (neighbor.mFullThreadDevice ? kFlagFullThreadDevice : 0) |
+                        (neighbor.mFullNetworkData ? kFlagFullNetworkData : 0) |
+                        (neighbor.mIsChild ? kFlagIsChild : 0);
+
+        writer.Write(neighbor.mExtAddress);
+        writer.Write(neighbor.mAge);
+        writer.Write(neighbor.mRloc16);
+        writer.Write(neighbor.mLinkFrameCounter);
+        writer.Write(neighbor.mMleFrameCounter);
+        writer.Write(neighbor.mLinkQualityIn);
+        writer.Write(static_cast<uint8_t>(neighbor.mAverageRssi));
+        writer.Write(static_cast<uint8_t>(neighbor.mLastRssi));
+        writer.Write(neighbor.mFrameErrorRate);
+        writer.Write(neighbor.mMessageErrorRate);
+        writer.Write(flags);
+    }
+}
+
+otbrError DecodeTableBlob(const uint8_t *aBlob, size_t aLength, std::vector<ChildInfo> &aChildTable)
+{
+    otbrError      error;
+    size_t         recordSize;
+    size_t         count;
+    const uint8_t *records;
+
+    SuccessOrExit(error = ParseHeader(aBlob, aLength, kTableBlobChildTable, kChildRecordSize, recordSize, count,
+                                      records));
+
+    aChildTable.resize(count);
+
+    for (ChildInfo &child : aChildTable)
+    {
+        BlobReader reader(records);
+        uint8_t    flags;
+
+        child.mExtAddress         = reader.Read<uint64_t>();
+        child.mTimeout            = reader.Read<uint32_t>();
+        child.mAge                = reader.Read<uint32_t>();
+        child.mRloc16             = reader.Read<uint16_t>();
+        child.mChildId            = reader.Read<uint16_t>();
+        child.mNetworkDataVersion = reader.Read<uint8_t>();
+        child.mLinkQualityIn      = reader.Read<uint8_t>();
+        child.mAverageRssi        = static_cast<int8_t>(reader.Read<uint8_t>());
+        child.mLastRssi           = static_cast<int8_t>(reader.Read<uint8_t>());
+        child.mFrameErrorRate     = reader.Read<uint16_t>();
+        child.mMessageErrorRate   = reader.Read<uint16_t>();
+        flags                     = reader.Read<uint8_t>();
+        child.mRxOnWhenIdle       = (flags & kFlagRxOnWhenIdle) != 0;
+        child.mFullThreadDevice   = (flags & kFlagFullThreadDevice) != 0;
+        child.mFullNetworkData    = (flags & kFlagFullNetworkData) != 0;
+        child.mIsStateRestoring   = (flags & kFlagIsStateRestoring) != 0;
+
+        records += recordSize;
+    }
+
+exit:
+    return error;
+}
+
+otbrError DecodeTableBlob(const uint8_t *aBlob, size_t aLength, std::vector<NeighborInfo> &aNeighborTable)
+{
+    otbrError      error;
+    size_t         recordSize;
+    size_t         count;
+    const uint8_t *records;
+
+    SuccessOrExit(error = ParseHeader(aBlob, aLength, kTableBlobNeighborTable, kNeighborRecordSize, recordSize, count,
+                                      records));
+
+    aNeighborTable.resize(count);
+
+    for (NeighborInfo &neighbor : aNeighborTable)
+    {
+        BlobReader reader(records);
+        uint8_t    flags;
+
+        neighbor.mExtAddress       = reader.Read<uint64_t>();
+        neighbor.mAge              = reader.Read<uint32_t>();
+        neighbor.mRloc16           = reader.Read<uint16_t>();
+        neighbor.mLinkFrameCounter = reader.Read<uint32_t>();
+        neighbor.mMleFrameCounter  = reader.Read<uint32_t>();
+        neighbor.mLinkQualityIn    = reader.Read<uint8_t>();
+        neighbor.mAverageRssi      = static_cast<int8_t>(reader.Read<uint8_t>());
+        neighbor.mLastRssi         = static_cast<int8_t>(reader.Read<uint8_t>());
+        neighbor.mFrameErrorRate   = reader.Read<uint16_t>();
+        neighbor.mMessageErrorRate = reader.Read<uint16_t>();
+        flags                      = reader.Read<uint8_t>();
+        neighbor.mRxOnWhenIdle     = (flags & kFlagRxOnWhenIdle) != 0;
+        neighbor.mFullThreadDevice = (flags & kFlagFullThreadDevice) != 0;
+        neighbor.mFullNetworkData  = (flags & kFlagFullNetworkData) != 0;
+        neighbor.mIsChild          = (flags & kFlagIsChild) != 0;
+
+        records += recordSize;
+    }
+
+exit:
+    return error;
+}
+
+otbrError CreateSealedMemfd(const char *aName, const std::vector<uint8_t> &aData, int &aFd)
+{
+    otbrError error  = OTBR_ERROR_ERRNO;
+    int       fd     = memfd_create(aName, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    size_t    offset = 0;
+
+    VerifyOrExit(fd != -1);
+
+    while (offset < aData.size())
+    {
+        ssize_t rval = write(fd, aData.data() + offset, aData.size() - offset);
+
+        VerifyOrExit(rval != -1 || errno == EINTR);
+        offset += (rval == -1) ? 0 : static_cast<size_t>(rval);
+    }
+
+    VerifyOrExit(fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == 0);
+
+    aFd   = fd;
+    fd    = -1;
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+otbrError DecodeTableMemfd(int aFd, std::vector<ChildInfo> &aChildTable)
+{
+    return DecodeMemfd(aFd, aChildTable);
+}
+
+otbrError DecodeTableMemfd(int aFd, std::vector<NeighborInfo> &aNeighborTable)
+{
+    return DecodeMemfd(aFd, aNeighborTable);
+}
+
+} // namespace DBus
+} // namespace otbr
@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes the compact binary encoding of the table exports handed out through sealed memfds.
+ */
+
+#ifndef OTBR_DBUS_COMMON_TABLE_BLOB_HPP_
+#define OTBR_DBUS_COMMON_TABLE_BLOB_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "common/types.hpp"
+#include "dbus/common/types.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * A table blob starts with a 12-byte header followed by fixed-size records, all in little-endian byte order:
+ *
+ *     magic "OTBT" (4) | version (1) | kind (1) | record size (2) | record count (4)
+ *
+ * Records only ever grow by appending fields, so a decoder accepts records longer than the ones it knows and skips
+ * the trailing bytes.
+ *
+ */
+constexpr uint8_t kTableBlobVersion    = 1;
+constexpr size_t  kTableBlobHeaderSize = 12;
+
+/**
+ * This enumeration represents the kind of table held by a table blob.
+ *
+ */
+enum TableBlobKind : uint8_t
+{
+    kTableBlobChildTable    = 1, ///< Records are `ChildInfo` entries.
+    kTableBlobNeighborTable = 2, ///< Records are `NeighborInfo` entries.
+};
+
+/**
+ * This function encodes the child table into a table blob.
+ *
+ * @param[in]   aChildTable   The child table.
+ * @param[out]  aBlob         The table blob.
+ *
+ */
+void EncodeTableBlob(const std::vector<ChildInfo> &aChildTable, std::vector<uint8_t> &aBlob);
+
+/**
+ * This function encodes the neighbor table into a table blob.
+ *
+ * @param[in]   aNeighborTable  The neighbor table.
+ * @param[out]  aBlob           The table blob.
+ *
+ */
+void EncodeTableBlob(const std::vector<NeighborInfo> &aNeighborTable, std::vector<uint8_t> &aBlob);
+
+/**
+ * This function decodes the child table from a table blob.
+ *
+ * @param[in]   aBlob         A pointer to the table blob.
+ * @param[in]   aLength       The length of the table blob.
+ * @param[out]  aChildTable   The child table.
+ *
+ * @retval OTBR_ERROR_NONE    Successfully decoded the child table.
+ * @retval OTBR_ERROR_PARSE   The blob is malformed or does not hold a child table.
+ *
+ */
+otbrError DecodeTableBlob(const uint8_t *aBlob, size_t aLength, std::vector<ChildInfo> &aChildTable);
+
+/**
+ * This function decodes the neighbor table from a table blob.
+ *
+ * @param[in]   aBlob           A pointer to the table blob.
+ * @param[in]   aLength         The length of the table blob.
+ * @param[out]  aNeighborTable  The neighbor table.
+ *
+ * @retval OTBR_ERROR_NONE    Successfully decoded the neighbor table.
+ * @retval OTBR_ERROR_PARSE   The blob is malformed or does not hold a neighbor table.
+ *
+ */
+otbrError DecodeTableBlob(const uint8_t *aBlob, size_t aLength, std::vector<NeighborInfo> &aNeighborTable);
+
+/**
+ * This function creates a memfd holding the given data and seals it against any further modification.
+ *
+ * @param[in]   aName   The name of the memfd, only used for debugging.
+ * @param[in]   aData   The data to be held.
+ * @param[out]  aFd     The sealed memfd, to be closed by the caller.
+ *
+ * @retval OTBR_ERROR_NONE    Successfully created the memfd.
+ * @retval OTBR_ERROR_ERRNO   Failed to create, fill or seal the memfd.
+ *
+ */
+otbrError CreateSealedMemfd(const char *aName, const std::vector<uint8_t> &aData, int &aFd);
+
+/**
+ * This function decodes the child table from a sealed memfd.
+ *
+ * The memfd is mapped rather than read, and it is only accepted if it can no longer be written or shrunk, so the
+ * sender cannot change the blob while it is decoded.
+ *
+ * @param[in]   aFd           The memfd, which stays owned by the caller.
+ * @param[out]  aChildTable   The child table.
+ *
+ * @retval OTBR_ERROR_NONE    Successfully decoded the child table.
+ * @retval OTBR_ERROR_ERRNO   Failed to map the memfd.
+ * @retval OTBR_ERROR_PARSE   The memfd is not sealed or does not hold a child table.
+ *
+ */
+otbrError DecodeTableMemfd(int aFd, std::vector<ChildInfo> &aChildTable);
+
+/**
+ * This function decodes the neighbor table from a sealed memfd.
+ *
+ * @param[in]   aFd             The memfd, which stays owned by the caller.
+ * @param[out]  aNeighborTable  The neighbor table.
+ *
+ * @retval OTBR_ERROR_NONE    Successfully decoded the neighbor table.
+ * @retval OTBR_ERROR_ERRNO   Failed to map the memfd.
+ * @retval OTBR_ERROR_PARSE   The memfd is not sealed or does not hold a neighbor table.
+ *
+ */
+otbrError DecodeTableMemfd(int aFd, std::vector<NeighborInfo> &aNeighborTable);
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_COMMON_TABLE_BLOB_HPP_
@@ -444,6 +444,12 @@ struct ChannelQuality
     uint16_t mOccupancy;
 };
 
+struct ChannelEnergy
+{
+    uint8_t mChannel; ///< The channel.
+    int8_t  mMaxRssi; ///< The max RSSI in dBm measured on the channel.
+};
+
 struct ChildInfo
 {
     uint64_t mExtAddress;         ///< IEEE 802.15.4 Extended Address
@@ -490,6 +496,54 @@ struct LeaderData
     uint8_t  mLeaderRouterId;    ///< Leader Router ID
 };
 
+struct MainloopLatency
+{
+    std::string           mName;    ///< The name of the measured mainloop step
+    uint64_t              mCount;   ///< The number of samples
+    uint64_t              mTotalUs; ///< The sum of all samples in microseconds
+    uint64_t              mMaxUs;   ///< The longest sample in microseconds
+    std::vector<uint64_t> mBuckets; ///< Bucket i counts the samples in [2^(i-1), 2^i) microseconds
+};
+
+struct MainloopStats
+{
+    uint64_t                     mIterations;   ///< The number of mainloop iterations
+    uint64_t                     mTimerWakeups; ///< The number of iterations woken up by a timeout
+    uint64_t                     mDurationMs;   ///< The time covered by the statistics in milliseconds
+    std::vector<MainloopLatency> mLatencies;    ///< The latencies of the mainloop steps
+};
+
+struct BackboneRouterCounters
+{
+    uint64_t mPrimaryTransitions;  ///< The number of times the Backbone Router became Primary
+    uint64_t mDomainPrefixChanges; ///< The number of Domain Prefix events
+    uint64_t mMulticastNsReceived; ///< The number of multicast NS received on the backbone link
+    uint64_t mMulticastNsDropped;  ///< The number of multicast NS dropped by the kernel
+    uint64_t mUnicastNsReceived;   ///< The number of unicast NS received from NFQUEUE
+    uint64_t mNsMatched;           ///< The number of NS targeting a proxied DUA
+    uint64_t mNaSent;              ///< The number of NA sent
+    uint64_t mNfqAccepted;         ///< The number of unicast NS given an accept verdict
+    uint64_t mNfqDropped;          ///< The number of unicast NS given a drop verdict
+    uint64_t mDuaAdded;            ///< The number of DUAs added to ND Proxy
+    uint64_t mDuaRenewed;          ///< The number of DUAs renewed
+    uint64_t mDuaRemoved;          ///< The number of DUAs removed from ND Proxy
+    uint64_t mSocketErrors;        ///< The number of failed socket or NFQUEUE operations
+};
+
+struct RadioStats
+{
+    uint64_t        mTxFrames;                ///< The number of frames handed to the RCP for transmission
+    uint64_t        mTxBytes;                 ///< The number of PSDU bytes handed to the RCP for transmission
+    uint64_t        mTxNoAck;                 ///< The number of transmissions not acknowledged by the peer
+    uint64_t        mTxChannelAccessFailures; ///< The number of transmissions failed for a busy channel
+    uint64_t        mTxErrors;                ///< The number of transmissions failed for other reasons
+    uint64_t        mRxFrames;                ///< The number of frames received from the RCP
+    uint64_t        mRxBytes;                 ///< The number of PSDU bytes received from the RCP
+    uint64_t        mRxErrors;                ///< The number of receive errors reported by the RCP
+    uint64_t        mResets;                  ///< The number of resets of the OpenThread instance and the RCP
+    MainloopLatency mTxLatency;               ///< The latencies from a transmission request to its completion
+};
+
 } // namespace DBus
 } // namespace otbr
 
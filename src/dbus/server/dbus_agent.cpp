@@ -30,7 +30,12 @@
 
 #include "dbus/server/dbus_agent.hpp"
 
+#include <algorithm>
+#include <vector>
+
+#include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "dbus/common/constants.hpp"
 
 namespace otbr {
@@ -63,7 +68,10 @@ otbrError DBusAgent::Init(void)
                      requestReply == DBUS_REQUEST_NAME_REPLY_ALREADY_OWNER,
                  error = OTBR_ERROR_DBUS);
     VerifyOrExit(
-        dbus_connection_set_watch_functions(mConnection.get(), AddDBusWatch, RemoveDBusWatch, nullptr, this, nullptr));
+        dbus_connection_set_watch_functions(mConnection.get(), AddDBusWatch, RemoveDBusWatch, ToggleDBusWatch, this,
+                                            nullptr));
+    VerifyOrExit(dbus_connection_set_timeout_functions(mConnection.get(), AddDBusTimeout, RemoveDBusTimeout,
+                                                       ToggleDBusTimeout, this, nullptr));
     mThreadObject = std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, mNcp));
     error         = mThreadObject->Init();
 exit:
@@ -75,98 +83,279 @@ exit:
     return error;
 }
 
+#if OTBR_ENABLE_BACKBONE_ROUTER
+void DBusAgent::SetBackboneRouterCountersGetter(DBusThreadObject::BackboneRouterCountersGetter aGetter)
+{
+    VerifyOrExit(mThreadObject != nullptr);
+    mThreadObject->SetBackboneRouterCountersGetter(std::move(aGetter));
+
+exit:
+    return;
+}
+#endif
+
 dbus_bool_t DBusAgent::AddDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.insert(aWatch);
+    static_cast<DBusAgent *>(aContext)->AddDBusWatch(*aWatch);
     return TRUE;
 }
 
+void DBusAgent::AddDBusWatch(DBusWatch &aWatch)
+{
+    int fd = dbus_watch_get_unix_fd(&aWatch);
+
+    VerifyOrExit(fd >= 0);
+
+    if (mWatches[fd].empty())
+    {
+        MainloopManager::GetInstance().RegisterFd(fd, 0, [this, fd](uint8_t aEvents) { HandleWatchFd(fd, aEvents); });
+    }
+
+    mWatches[fd].insert(&aWatch);
+    UpdateWatchFd(fd);
+
+exit:
+    return;
+}
+
 void DBusAgent::RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.erase(aWatch);
+    static_cast<DBusAgent *>(aContext)->RemoveDBusWatch(*aWatch);
 }
 
-void DBusAgent::Update(MainloopContext &aMainloop)
+void DBusAgent::RemoveDBusWatch(DBusWatch &aWatch)
 {
-    unsigned int flags;
-    int          fd;
+    auto it = mWatches.begin();
+    int  fd;
 
-    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    // Look up by the watch itself, an invalidated watch no longer returns its file descriptor.
+    while (it != mWatches.end() && it->second.count(&aWatch) == 0)
     {
-        aMainloop.mTimeout = {0, 0};
+        ++it;
     }
 
-    for (const auto &watch : mWatches)
+    VerifyOrExit(it != mWatches.end());
+    fd = it->first;
+    it->second.erase(&aWatch);
+
+    if (it->second.empty())
+    {
+        mWatches.erase(it);
+        MainloopManager::GetInstance().UnregisterFd(fd);
+    }
+    else
     {
+        UpdateWatchFd(fd);
+    }
+
+exit:
+    return;
+}
+
+void DBusAgent::ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext)
+{
+    static_cast<DBusAgent *>(aContext)->UpdateWatchFd(dbus_watch_get_unix_fd(aWatch));
+}
+
+void DBusAgent::UpdateWatchFd(int aFd)
+{
+    auto    it     = mWatches.find(aFd);
+    uint8_t events = 0;
+
+    VerifyOrExit(it != mWatches.end());
+
+    // libdbus may create separate watches for reading and writing the same socket.
+    for (DBusWatch *watch : it->second)
+    {
+        unsigned int flags;
+
         if (!dbus_watch_get_enabled(watch))
         {
             continue;
         }
 
         flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
-
-        if (fd < 0)
-        {
-            continue;
-        }
 
         if (flags & DBUS_WATCH_READABLE)
         {
-            FD_SET(fd, &aMainloop.mReadFdSet);
+            events |= MainloopManager::kEventReadable;
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE))
+        if (flags & DBUS_WATCH_WRITABLE)
         {
-            FD_SET(fd, &aMainloop.mWriteFdSet);
+            events |= MainloopManager::kEventWritable;
         }
 
-        FD_SET(fd, &aMainloop.mErrorFdSet);
-
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+        events |= MainloopManager::kEventError;
     }
+
+    MainloopManager::GetInstance().UpdateFd(aFd, events);
+
+exit:
+    return;
 }
 
-void DBusAgent::Process(const MainloopContext &aMainloop)
+void DBusAgent::HandleWatchFd(int aFd, uint8_t aEvents)
 {
-    unsigned int flags;
-    int          fd;
+    auto                     it = mWatches.find(aFd);
+    std::vector<DBusWatch *> watches;
 
-    for (const auto &watch : mWatches)
+    VerifyOrExit(it != mWatches.end());
+
+    // Handling a watch may add or remove watches.
+    watches.assign(it->second.begin(), it->second.end());
+
+    for (DBusWatch *watch : watches)
     {
-        if (!dbus_watch_get_enabled(watch))
-        {
-            continue;
-        }
+        unsigned int flags;
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+        it = mWatches.find(aFd);
+        VerifyOrExit(it != mWatches.end());
 
-        if (fd < 0)
+        if (it->second.count(watch) == 0 || !dbus_watch_get_enabled(watch))
         {
             continue;
         }
 
-        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(fd, &aMainloop.mReadFdSet))
+        flags = dbus_watch_get_flags(watch);
+
+        if (!(aEvents & MainloopManager::kEventReadable))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        if (!(aEvents & MainloopManager::kEventWritable))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
         }
 
-        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        if (aEvents & MainloopManager::kEventError)
         {
             flags |= DBUS_WATCH_ERROR;
         }
 
-        dbus_watch_handle(watch, flags);
+        if (flags != 0)
+        {
+            dbus_watch_handle(watch, flags);
+        }
     }
 
-    while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
-        ;
+exit:
+    return;
+}
+
+dbus_bool_t DBusAgent::AddDBusTimeout(DBusTimeout *aTimeout, void *aContext)
+{
+    static_cast<DBusAgent *>(aContext)->UpdateDBusTimeout(*aTimeout);
+    return TRUE;
+}
+
+void DBusAgent::RemoveDBusTimeout(DBusTimeout *aTimeout, void *aContext)
+{
+    static_cast<DBusAgent *>(aContext)->mTimeouts.erase(aTimeout);
+}
+
+void DBusAgent::ToggleDBusTimeout(DBusTimeout *aTimeout, void *aContext)
+{
+    static_cast<DBusAgent *>(aContext)->UpdateDBusTimeout(*aTimeout);
+}
+
+void DBusAgent::UpdateDBusTimeout(DBusTimeout &aTimeout)
+{
+    if (dbus_timeout_get_enabled(&aTimeout))
+    {
+        // libdbus expects the interval to restart whenever a timeout is added or enabled.
+        mTimeouts[&aTimeout] = Clock::now() + Milliseconds(dbus_timeout_get_interval(&aTimeout));
+    }
+    else
+    {
+        mTimeouts.erase(&aTimeout);
+    }
+}
+
+void DBusAgent::HandleDBusTimeouts(void)
+{
+    Timepoint                  now = Clock::now();
+    std::vector<DBusTimeout *> expired;
+
+    for (const auto &timeout : mTimeouts)
+    {
+        if (timeout.second <= now)
+        {
+            expired.push_back(timeout.first);
+        }
+    }
+
+    // Handling a timeout may add or remove timeouts.
+    for (DBusTimeout *timeout : expired)
+    {
+        auto it = mTimeouts.find(timeout);
+
+        if (it == mTimeouts.end())
+        {
+            continue;
+        }
+
+        // Timeouts are periodic until removed or disabled.
+        it->second = now + Milliseconds(dbus_timeout_get_interval(timeout));
+        dbus_timeout_handle(timeout);
+    }
+}
+
+void DBusAgent::DispatchMessages(void)
+{
+    uint32_t dispatched = 0;
+
+    // The remaining messages are dispatched in the next iterations, see `Update()`.
+    while (dispatched < kMaxDispatchedMessages &&
+           dbus_connection_dispatch(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        ++dispatched;
+    }
+}
+
+void DBusAgent::Update(MainloopContext &aMainloop)
+{
+    Timepoint    now = Clock::now();
+    Microseconds timeout;
+
+    if (mThreadObject != nullptr)
+    {
+        mThreadObject->Update(aMainloop);
+    }
+
+    timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+
+    for (const auto &dbusTimeout : mTimeouts)
+    {
+        if (dbusTimeout.second <= now)
+        {
+            timeout = Microseconds::zero();
+        }
+        else
+        {
+            timeout = std::min(timeout, std::chrono::duration_cast<Microseconds>(dbusTimeout.second - now));
+        }
+    }
+
+    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        timeout = Microseconds::zero();
+    }
+
+    aMainloop.mTimeout = ToTimeval(timeout);
+}
+
+void DBusAgent::Process(const MainloopContext &aMainloop)
+{
+    HandleDBusTimeouts();
+    DispatchMessages();
+
+    // Property changes made during this iteration are signaled and expired async method calls are timed out.
+    if (mThreadObject != nullptr)
+    {
+        mThreadObject->Process(aMainloop);
+    }
 }
 
 } // namespace DBus
@@ -35,11 +35,13 @@
 #define OTBR_DBUS_AGENT_HPP_
 
 #include <functional>
+#include <map>
 #include <set>
 #include <string>
 #include <sys/select.h>
 
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
 #include "dbus/server/dbus_object.hpp"
@@ -70,6 +72,16 @@ public:
      */
     otbrError Init(void);
 
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    /**
+     * This method sets the getter of the Backbone Router counters.
+     *
+     * @param[in]  aGetter  The getter of the Backbone Router counters.
+     *
+     */
+    void SetBackboneRouterCountersGetter(DBusThreadObject::BackboneRouterCountersGetter aGetter);
+#endif
+
     /**
      * This method updates the mainloop context.
      *
@@ -88,10 +100,25 @@ public:
 
 private:
     static dbus_bool_t AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    void               AddDBusWatch(DBusWatch &aWatch);
     static void        RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    void               RemoveDBusWatch(DBusWatch &aWatch);
+    static void        ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    void               UpdateWatchFd(int aFd);
+    void               HandleWatchFd(int aFd, uint8_t aEvents);
+    static dbus_bool_t AddDBusTimeout(DBusTimeout *aTimeout, void *aContext);
+    static void        RemoveDBusTimeout(DBusTimeout *aTimeout, void *aContext);
+    static void        ToggleDBusTimeout(DBusTimeout *aTimeout, void *aContext);
+    void               UpdateDBusTimeout(DBusTimeout &aTimeout);
+    void               HandleDBusTimeouts(void);
+    void               DispatchMessages(void);
 
     static const struct timeval kPollTimeout;
 
+    // The maximum number of incoming messages dispatched in one mainloop iteration, so that a flood of d-bus messages
+    // can't starve the other mainloop processors.
+    static constexpr uint32_t kMaxDispatchedMessages = 32;
+
     std::string                       mInterfaceName;
     std::unique_ptr<DBusThreadObject> mThreadObject;
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
@@ -99,10 +126,16 @@ private:
     otbr::Ncp::ControllerOpenThread *mNcp;
 
     /**
-     * This map is used to track DBusWatch-es.
+     * This map is used to track DBusWatch-es by their file descriptors.
+     *
+     */
+    std::map<int, std::set<DBusWatch *>> mWatches;
+
+    /**
+     * This map is used to track the deadlines of enabled DBusTimeout-s.
      *
      */
-    std::set<DBusWatch *> mWatches;
+    std::map<DBusTimeout *, Timepoint> mTimeouts;
 };
 
 } // namespace DBus
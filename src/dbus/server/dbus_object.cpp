@@ -28,6 +28,8 @@
 
 #define OTBR_LOG_TAG "DBUS"
 
+#include <algorithm>
+
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
@@ -35,17 +37,42 @@
 #include <dbus/dbus.h>
 
 #include "common/logging.hpp"
+#include "common/trace.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/server/dbus_object.hpp"
 
 using std::placeholders::_1;
 
+#ifndef OTBR_DBUS_SIGNAL_RATE_LIMIT
+#define OTBR_DBUS_SIGNAL_RATE_LIMIT 10
+#endif
+
+#ifndef OTBR_DBUS_SIGNAL_BURST
+#define OTBR_DBUS_SIGNAL_BURST 32
+#endif
+
+#ifndef OTBR_DBUS_MAX_SIGNAL_SUBSCRIBERS
+#define OTBR_DBUS_MAX_SIGNAL_SUBSCRIBERS 16
+#endif
+
 namespace otbr {
 namespace DBus {
 
+// Number of subscribable signals per second sent to one subscriber.
+static const double kSignalRateLimit = OTBR_DBUS_SIGNAL_RATE_LIMIT;
+// Number of subscribable signals sent back to back to one subscriber.
+static const double kSignalBurst = OTBR_DBUS_SIGNAL_BURST;
+// Maximum number of subscribers of one signal.
+static const size_t kMaxSignalSubscribers = OTBR_DBUS_MAX_SIGNAL_SUBSCRIBERS;
+
+static const char kNameOwnerChangedMatchRule[] = "type='signal',sender='" DBUS_SERVICE_DBUS
+                                                 "',interface='" DBUS_INTERFACE_DBUS
+                                                 "',member='" DBUS_NAME_OWNER_CHANGED_SIGNAL "'";
+
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
     : mConnection(aConnection)
     , mObjectPath(aObjectPath)
+    , mWatchingNameOwners(false)
 {
 }
 
@@ -81,6 +108,128 @@ void DBusObject::RegisterMethod(const std::string &      aInterfaceName,
     mMethodHandlers.emplace(fullPath, aHandler);
 }
 
+void DBusObject::RegisterAsyncMethod(const std::string &           aInterfaceName,
+                                     const std::string &           aMethodName,
+                                     const AsyncMethodHandlerType &aHandler,
+                                     size_t                        aMaxPending,
+                                     Milliseconds                  aTimeout,
+                                     const TimeoutHandlerType &    aTimeoutHandler)
+{
+    std::string fullPath = aInterfaceName + "." + aMethodName;
+
+    RegisterMethod(aInterfaceName, aMethodName,
+                   [this, fullPath, aHandler, aMaxPending, aTimeout, aTimeoutHandler](DBusRequest &aRequest) {
+                       HandleAsyncMethod(fullPath, aHandler, aMaxPending, aTimeout, aTimeoutHandler, aRequest);
+                   });
+}
+
+void DBusObject::HandleAsyncMethod(const std::string &           aMethodName,
+                                   const AsyncMethodHandlerType &aHandler,
+                                   size_t                        aMaxPending,
+                                   Milliseconds                  aTimeout,
+                                   const TimeoutHandlerType &    aTimeoutHandler,
+                                   DBusRequest &                 aRequest)
+{
+    std::vector<PendingRequest> &pendingRequests = mPendingRequests[aMethodName];
+    DBusAsyncRequest             request(std::move(aRequest));
+
+    ExpirePendingRequests();
+
+    if (pendingRequests.size() >= aMaxPending)
+    {
+        otbrLogWarning("Rejected %s: %zu calls outstanding", aMethodName.c_str(), pendingRequests.size());
+        request.ReplyOtResult(OT_ERROR_BUSY);
+        ExitNow();
+    }
+
+    pendingRequests.push_back({request, Clock::now() + aTimeout, aTimeoutHandler});
+    aHandler(request);
+
+exit:
+    return;
+}
+
+void DBusObject::ExpirePendingRequests(void)
+{
+    Timepoint                       now = Clock::now();
+    std::vector<TimeoutHandlerType> timeoutHandlers;
+
+    for (auto &methodRequests : mPendingRequests)
+    {
+        std::vector<PendingRequest> &pendingRequests = methodRequests.second;
+
+        for (auto iter = pendingRequests.begin(); iter != pendingRequests.end();)
+        {
+            if (!iter->mRequest.IsReplied() && iter->mDeadline <= now)
+            {
+                otbrLogWarning("Timed out %s", methodRequests.first.c_str());
+                iter->mRequest.ReplyOtResult(OT_ERROR_RESPONSE_TIMEOUT);
+
+                if (iter->mTimeoutHandler != nullptr)
+                {
+                    timeoutHandlers.push_back(iter->mTimeoutHandler);
+                }
+            }
+
+            if (iter->mRequest.IsReplied())
+            {
+                iter = pendingRequests.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    // Called after the iteration, since dropping an operation may reply to the other calls served by it.
+    for (const TimeoutHandlerType &timeoutHandler : timeoutHandlers)
+    {
+        timeoutHandler();
+    }
+}
+
+void DBusObject::Update(MainloopContext &aMainloop)
+{
+    Timepoint    now     = Clock::now();
+    Microseconds timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+
+    if (HasPendingPropertyChanges())
+    {
+        timeout = Microseconds::zero();
+    }
+
+    for (const auto &methodRequests : mPendingRequests)
+    {
+        for (const PendingRequest &pendingRequest : methodRequests.second)
+        {
+            if (pendingRequest.mRequest.IsReplied())
+            {
+                continue;
+            }
+
+            if (pendingRequest.mDeadline <= now)
+            {
+                timeout = Microseconds::zero();
+            }
+            else
+            {
+                timeout = std::min(timeout, std::chrono::duration_cast<Microseconds>(pendingRequest.mDeadline - now));
+            }
+        }
+    }
+
+    aMainloop.mTimeout = ToTimeval(timeout);
+}
+
+void DBusObject::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    ExpirePendingRequests();
+    FlushPropertyChangedSignals();
+}
+
 void DBusObject::RegisterGetPropertyHandler(const std::string &        aInterfaceName,
                                             const std::string &        aPropertyName,
                                             const PropertyHandlerType &aHandler)
@@ -116,11 +265,10 @@ DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMe
     if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
     {
         otbrLogInfo("Handling method %s", memberName.c_str());
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            DumpDBusMessage(*aMessage);
-        }
+        OTBR_DBUS_DUMP_MESSAGE(*aMessage);
+        otbrProbe(dbus__method__start, memberName.c_str());
         (iter->second)(request);
+        otbrProbe(dbus__method__end, memberName.c_str());
         handled = DBUS_HANDLER_RESULT_HANDLED;
     }
 
@@ -158,11 +306,8 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
 exit:
     if (error == OT_ERROR_NONE)
     {
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLogDebug("GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
-            DumpDBusMessage(*reply);
-        }
+        otbrLogDebug("GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
+        OTBR_DBUS_DUMP_MESSAGE(*reply);
 
         dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
     }
@@ -184,32 +329,84 @@ void DBusObject::GetAllPropertiesMethodHandler(DBusRequest &aRequest)
 
     VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
-    VerifyOrExit(mGetPropertyHandlers.find(interfaceName) != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-    dbus_message_iter_init_append(reply.get(), &iter);
-
-    for (auto &p : mGetPropertyHandlers.at(interfaceName))
     {
+        auto propertyIter = mGetPropertyHandlers.find(interfaceName);
+
+        VerifyOrExit(propertyIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
+        dbus_message_iter_init_append(reply.get(), &iter);
+
+        // All the properties go to a single dictionary.
         VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
                                                       "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
                                                       &subIter),
                      error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+
+        for (auto &p : propertyIter->second)
+        {
+            VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                         error = OT_ERROR_FAILED);
+            VerifyOrExit(DBusMessageEncode(&dictEntryIter, p.first) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+
+            SuccessOrExit(error = p.second(dictEntryIter));
+
+            VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
+        }
+
+        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OT_ERROR_FAILED);
+    }
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusObject::GetPropertiesMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest)
+{
+    UniqueDBusMessage        reply{dbus_message_new_method_return(aRequest.GetMessage())};
+    DBusMessageIter          iter, subIter;
+    std::vector<std::string> propertyNames;
+    auto                     args  = std::tie(propertyNames);
+    otError                  error = OT_ERROR_NONE;
+    const char *             name  = "";
+
+    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+    {
+        auto propertyIter = mGetPropertyHandlers.find(aInterfaceName);
+
+        VerifyOrExit(propertyIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
+        dbus_message_iter_init_append(reply.get(), &iter);
+        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, DBUS_TYPE_VARIANT_AS_STRING, &subIter),
                      error = OT_ERROR_FAILED);
-        VerifyOrExit(DBusMessageEncode(&dictEntryIter, p.first) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
 
-        SuccessOrExit(error = p.second(dictEntryIter));
+        // Each get handler appends a variant, so the values are encoded straight into the reply.
+        for (const std::string &propertyName : propertyNames)
+        {
+            auto handlerIter = propertyIter->second.find(propertyName);
+
+            name = propertyName.c_str();
+            VerifyOrExit(handlerIter != propertyIter->second.end(), error = OT_ERROR_NOT_FOUND);
+            SuccessOrExit(error = handlerIter->second(subIter));
+        }
 
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter));
+        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OT_ERROR_FAILED);
     }
 
 exit:
     if (error == OT_ERROR_NONE)
     {
+        otbrLogDebug("GetProperties %s: %zu properties", aInterfaceName.c_str(), propertyNames.size());
         dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
     }
     else
     {
+        otbrLogWarning("GetProperties %s.%s error:%s", aInterfaceName.c_str(), name, ConvertToDBusErrorName(error));
         aRequest.ReplyOtResult(error);
     }
 }
@@ -245,8 +442,330 @@ exit:
     return;
 }
 
+void DBusObject::FlushPropertyChangedSignals(void)
+{
+    std::map<std::string, PropertyEncoderMap> pendingChanges;
+
+    pendingChanges.swap(mPendingPropertyChanges);
+
+    for (const auto &interfaceChanges : pendingChanges)
+    {
+        otbrError error = SendPropertiesChangedSignal(interfaceChanges.first, interfaceChanges.second);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to signal property changes of %s: %s", interfaceChanges.first.c_str(),
+                           otbrErrorString(error));
+        }
+    }
+}
+
+otbrError DBusObject::SendPropertiesChangedSignal(const std::string &       aInterfaceName,
+                                                  const PropertyEncoderMap &aProperties)
+{
+    UniqueDBusMessage signalMsg{
+        dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL)};
+    DBusMessageIter iter, subIter, dictEntryIter;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const auto &property : aProperties)
+    {
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, property.first));
+        SuccessOrExit(error = property.second(dictEntryIter));
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+
+        otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), property.first.c_str());
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    OTBR_DBUS_DUMP_MESSAGE(*signalMsg);
+
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
+void DBusObject::RegisterSubscribableSignal(const std::string &            aInterfaceName,
+                                            const std::string &            aSignalName,
+                                            const SubscriptionHandlerType &aHandler)
+{
+    std::string fullPath = aInterfaceName + "." + aSignalName;
+
+    assert(mSubscribableSignals.find(fullPath) == mSubscribableSignals.end());
+    mSubscribableSignals[fullPath].mHandler = aHandler;
+
+    if (mMethodHandlers.find(aInterfaceName + "." OTBR_DBUS_SUBSCRIBE_SIGNAL_METHOD) == mMethodHandlers.end())
+    {
+        RegisterMethod(aInterfaceName, OTBR_DBUS_SUBSCRIBE_SIGNAL_METHOD,
+                       [this, aInterfaceName](DBusRequest &aRequest) {
+                           SubscribeSignalMethodHandler(aInterfaceName, aRequest);
+                       });
+        RegisterMethod(aInterfaceName, OTBR_DBUS_UNSUBSCRIBE_SIGNAL_METHOD,
+                       [this, aInterfaceName](DBusRequest &aRequest) {
+                           UnsubscribeSignalMethodHandler(aInterfaceName, aRequest);
+                       });
+    }
+
+    // Subscribers leaving the bus are told by the bus daemon, without error the match is added without blocking.
+    if (!mWatchingNameOwners)
+    {
+        dbus_bus_add_match(mConnection, kNameOwnerChangedMatchRule, nullptr);
+        mWatchingNameOwners = dbus_connection_add_filter(mConnection, sNameOwnerChangedFilter, this, nullptr);
+
+        if (!mWatchingNameOwners)
+        {
+            otbrLogWarning("Failed to watch the subscribers of %s", fullPath.c_str());
+        }
+    }
+}
+
+bool DBusObject::HasSignalSubscribers(const std::string &aInterfaceName, const std::string &aSignalName) const
+{
+    auto signalMap = mSubscribableSignals.find(aInterfaceName + "." + aSignalName);
+
+    return signalMap != mSubscribableSignals.end() && !signalMap->second.mSubscribers.empty();
+}
+
+bool DBusObject::AdmitSignal(const std::string &aSubscriber,
+                             const std::string &aInterfaceName,
+                             const std::string &aSignalName)
+{
+    SignalSubscriber *subscriber =
+        const_cast<SignalSubscriber *>(FindSignalSubscriber(aSubscriber, aInterfaceName, aSignalName));
+
+    return subscriber != nullptr && AdmitSignal(*subscriber);
+}
+
+Milliseconds DBusObject::GetSignalDelay(const std::string &aSubscriber,
+                                        const std::string &aInterfaceName,
+                                        const std::string &aSignalName) const
+{
+    const SignalSubscriber *subscriber = FindSignalSubscriber(aSubscriber, aInterfaceName, aSignalName);
+    Milliseconds            delay      = Milliseconds::zero();
+    SignalSubscriber        state;
+
+    VerifyOrExit(subscriber != nullptr);
+
+    state = *subscriber;
+    RefillSignalTokens(state, Clock::now());
+
+    VerifyOrExit(state.mTokens < 1);
+    // Rounded up, so that the subscriber is not woken up right before its next token.
+    delay = Milliseconds(static_cast<Milliseconds::rep>((1 - state.mTokens) * 1000 / kSignalRateLimit) + 1);
+
+exit:
+    return delay;
+}
+
+const DBusObject::SignalSubscriber *DBusObject::FindSignalSubscriber(const std::string &aSubscriber,
+                                                                     const std::string &aInterfaceName,
+                                                                     const std::string &aSignalName) const
+{
+    const SignalSubscriber *subscriber = nullptr;
+    auto                    signalMap  = mSubscribableSignals.find(aInterfaceName + "." + aSignalName);
+
+    VerifyOrExit(signalMap != mSubscribableSignals.end());
+
+    {
+        auto iter = signalMap->second.mSubscribers.find(aSubscriber);
+
+        VerifyOrExit(iter != signalMap->second.mSubscribers.end());
+        subscriber = &iter->second;
+    }
+
+exit:
+    return subscriber;
+}
+
+bool DBusObject::AdmitSignal(SignalSubscriber &aSubscriber)
+{
+    bool admitted = false;
+
+    RefillSignalTokens(aSubscriber, Clock::now());
+
+    VerifyOrExit(aSubscriber.mTokens >= 1);
+    aSubscriber.mTokens -= 1;
+    admitted = true;
+
+exit:
+    return admitted;
+}
+
+void DBusObject::RefillSignalTokens(SignalSubscriber &aSubscriber, Timepoint aNow)
+{
+    double elapsed = std::chrono::duration<double>(aNow - aSubscriber.mRefillTime).count();
+
+    aSubscriber.mTokens     = std::min(kSignalBurst, aSubscriber.mTokens + elapsed * kSignalRateLimit);
+    aSubscriber.mRefillTime = aNow;
+}
+
+void DBusObject::ReportDroppedSignals(const std::string &aSubscriber,
+                                      const std::string &aSignalName,
+                                      SignalSubscriber & aState)
+{
+    VerifyOrExit(aState.mDropped != 0);
+
+    otbrLogWarning("Dropped %u %s signals over the rate limit of %s", aState.mDropped, aSignalName.c_str(),
+                   aSubscriber.c_str());
+    aState.mDropped = 0;
+
+exit:
+    return;
+}
+
+otbrError DBusObject::SendSignal(DBusMessage &aSignal, const std::string &aDestination)
+{
+    UniqueDBusMessage signalMsg{dbus_message_copy(&aSignal)};
+    otbrError         error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_message_set_destination(signalMsg.get(), aDestination.c_str()), error = OTBR_ERROR_DBUS);
+
+    OTBR_DBUS_DUMP_MESSAGE(*signalMsg);
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to send signal %s to %s", dbus_message_get_member(&aSignal), aDestination.c_str());
+    }
+
+    return error;
+}
+
+void DBusObject::SubscribeSignalMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest)
+{
+    std::string signalName;
+    auto        args   = std::tie(signalName);
+    const char *sender = dbus_message_get_sender(aRequest.GetMessage());
+    otError     error  = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    // Only connections through the bus daemon have a unique name to send signals to and to be told leaving.
+    VerifyOrExit(sender != nullptr, error = OT_ERROR_INVALID_STATE);
+
+    {
+        auto signalMap = mSubscribableSignals.find(aInterfaceName + "." + signalName);
+
+        VerifyOrExit(signalMap != mSubscribableSignals.end(), error = OT_ERROR_NOT_FOUND);
+
+        auto &subscribers = signalMap->second.mSubscribers;
+
+        VerifyOrExit(subscribers.find(sender) == subscribers.end());
+        VerifyOrExit(subscribers.size() < kMaxSignalSubscribers, error = OT_ERROR_NO_BUFS);
+
+        subscribers.emplace(sender, SignalSubscriber{kSignalBurst, Clock::now(), 0});
+        otbrLogInfo("%s subscribed to %s", sender, signalMap->first.c_str());
+
+        if (signalMap->second.mHandler)
+        {
+            signalMap->second.mHandler(sender, true);
+        }
+    }
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusObject::UnsubscribeSignalMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest)
+{
+    std::string signalName;
+    auto        args   = std::tie(signalName);
+    const char *sender = dbus_message_get_sender(aRequest.GetMessage());
+    otError     error  = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(sender != nullptr, error = OT_ERROR_INVALID_STATE);
+
+    {
+        auto signalMap = mSubscribableSignals.find(aInterfaceName + "." + signalName);
+
+        VerifyOrExit(signalMap != mSubscribableSignals.end(), error = OT_ERROR_NOT_FOUND);
+        VerifyOrExit(signalMap->second.mSubscribers.erase(sender) != 0);
+        otbrLogInfo("%s unsubscribed from %s", sender, signalMap->first.c_str());
+
+        if (signalMap->second.mHandler)
+        {
+            signalMap->second.mHandler(sender, false);
+        }
+    }
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusObject::RemoveSignalSubscriber(const std::string &aSubscriber)
+{
+    for (auto &signalMap : mSubscribableSignals)
+    {
+        if (signalMap.second.mSubscribers.erase(aSubscriber) == 0)
+        {
+            continue;
+        }
+
+        otbrLogInfo("%s left, unsubscribed from %s", aSubscriber.c_str(), signalMap.first.c_str());
+
+        if (signalMap.second.mHandler)
+        {
+            signalMap.second.mHandler(aSubscriber, false);
+        }
+    }
+}
+
+DBusHandlerResult DBusObject::sNameOwnerChangedFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData)
+{
+    OTBR_UNUSED_VARIABLE(aConnection);
+
+    static_cast<DBusObject *>(aData)->HandleNameOwnerChanged(*aMessage);
+
+    // Other filters and objects may be watching the same signal.
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+void DBusObject::HandleNameOwnerChanged(DBusMessage &aMessage)
+{
+    std::string name;
+    std::string oldOwner;
+    std::string newOwner;
+    auto        args = std::tie(name, oldOwner, newOwner);
+
+    VerifyOrExit(dbus_message_is_signal(&aMessage, DBUS_INTERFACE_DBUS, DBUS_NAME_OWNER_CHANGED_SIGNAL));
+    VerifyOrExit(DBusMessageToTuple(aMessage, args) == OTBR_ERROR_NONE);
+
+    // Subscribers are unique names, which lose their owner once and for all when their connection is closed.
+    VerifyOrExit(newOwner.empty() && name == oldOwner);
+    RemoveSignalSubscriber(name);
+
+exit:
+    return;
+}
+
 DBusObject::~DBusObject(void)
 {
+    if (mWatchingNameOwners)
+    {
+        dbus_connection_remove_filter(mConnection, sNameOwnerChangedFilter, this);
+        dbus_bus_remove_match(mConnection, kNameOwnerChangedMatchRule, nullptr);
+    }
 }
 
 } // namespace DBus
@@ -39,13 +39,17 @@
 #endif
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <dbus/dbus.h>
 
 #include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
@@ -65,8 +69,14 @@ class DBusObject
 public:
     using MethodHandlerType = std::function<void(DBusRequest &)>;
 
+    using AsyncMethodHandlerType = std::function<void(DBusAsyncRequest &)>;
+
+    using TimeoutHandlerType = std::function<void(void)>;
+
     using PropertyHandlerType = std::function<otError(DBusMessageIter &)>;
 
+    using SubscriptionHandlerType = std::function<void(const std::string &aSubscriber, bool aSubscribed)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -99,6 +109,28 @@ public:
                         const std::string &      aMethodName,
                         const MethodHandlerType &aHandler);
 
+    /**
+     * This method registers the handler of a method which is replied after the handler returns.
+     *
+     * At most @p aMaxPending calls of the method may be outstanding, further calls are replied with
+     * OT_ERROR_BUSY. A call still outstanding after @p aTimeout is replied with OT_ERROR_RESPONSE_TIMEOUT, then
+     * @p aTimeoutHandler is called to drop the operation of the call, and the later reply of the handler is dropped.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aMethodName       The method name.
+     * @param[in]   aHandler          The method handler.
+     * @param[in]   aMaxPending       The maximum number of outstanding calls of the method.
+     * @param[in]   aTimeout          The time allowed for replying to a call.
+     * @param[in]   aTimeoutHandler   The handler called when a call times out, may be nullptr.
+     *
+     */
+    void RegisterAsyncMethod(const std::string &           aInterfaceName,
+                             const std::string &           aMethodName,
+                             const AsyncMethodHandlerType &aHandler,
+                             size_t                        aMaxPending,
+                             Milliseconds                  aTimeout,
+                             const TimeoutHandlerType &    aTimeoutHandler = nullptr);
+
     /**
      * This method registers the get handler for a property.
      *
@@ -144,8 +176,9 @@ public:
         otbrError error = OTBR_ERROR_NONE;
 
         VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        VerifyOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
+        SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
 
+        OTBR_DBUS_DUMP_MESSAGE(*signalMsg);
         VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
 
     exit:
@@ -153,67 +186,218 @@ public:
     }
 
     /**
-     * This method sends a property changed signal.
+     * This method registers a signal which is only sent to the connections subscribed to it.
+     *
+     * The interface gets the `SubscribeSignal` and `UnsubscribeSignal` methods, which take the name of the signal.
+     * Subscribers are removed when they leave the bus, and each of them has a rate limit of its own, so that a
+     * high-rate signal costs nothing to the other connections on the bus.
      *
      * @param[in]   aInterfaceName    The interface name.
-     * @param[in]   aPropertyName     The property name.
-     * @param[in]   aValue            New value of the property.
+     * @param[in]   aSignalName       The signal name.
+     * @param[in]   aHandler          The handler called when a connection subscribes or unsubscribes, may be empty.
+     *
+     */
+    void RegisterSubscribableSignal(const std::string &            aInterfaceName,
+                                    const std::string &            aSignalName,
+                                    const SubscriptionHandlerType &aHandler);
+
+    /**
+     * This method indicates whether a subscribable signal has subscribers.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aSignalName       The signal name.
+     *
+     * @returns Whether the signal has subscribers.
+     *
+     */
+    bool HasSignalSubscribers(const std::string &aInterfaceName, const std::string &aSignalName) const;
+
+    /**
+     * This method takes one signal from the rate limit of a subscriber.
+     *
+     * @param[in]   aSubscriber       The unique bus name of the subscriber.
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aSignalName       The signal name.
+     *
+     * @retval TRUE   The signal may be sent to the subscriber.
+     * @retval FALSE  The subscriber is over its rate limit or not subscribed to the signal.
+     *
+     */
+    bool AdmitSignal(const std::string &aSubscriber, const std::string &aInterfaceName, const std::string &aSignalName);
+
+    /**
+     * This method returns how long a subscriber over its rate limit waits before receiving the signal again.
+     *
+     * @param[in]   aSubscriber       The unique bus name of the subscriber.
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aSignalName       The signal name.
+     *
+     * @returns The delay before `AdmitSignal()` succeeds again.
+     *
+     */
+    Milliseconds GetSignalDelay(const std::string &aSubscriber,
+                                const std::string &aInterfaceName,
+                                const std::string &aSignalName) const;
+
+    /**
+     * This method sends a signal to a single connection.
+     *
+     * @param[in]   aDestination      The unique bus name of the connection.
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aSignalName       The signal name.
+     * @param[in]   aArgs             The tuple to be encoded into the signal.
      *
      * @retval OTBR_ERROR_NONE  Signal successfully sent.
      * @retval OTBR_ERROR_DBUS  Failed to send the signal.
      *
      */
-    template <typename ValueType>
-    otbrError SignalPropertyChanged(const std::string &aInterfaceName,
-                                    const std::string &aPropertyName,
-                                    const ValueType &  aValue)
+    template <typename... FieldTypes>
+    otbrError SignalTo(const std::string &              aDestination,
+                       const std::string &              aInterfaceName,
+                       const std::string &              aSignalName,
+                       const std::tuple<FieldTypes...> &aArgs)
     {
         UniqueDBusMessage signalMsg{
-            dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL)};
-        DBusMessageIter iter, subIter, dictEntryIter;
-        otbrError       error = OTBR_ERROR_NONE;
+            dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str())};
+        otbrError error = OTBR_ERROR_NONE;
 
         VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        dbus_message_iter_init_append(signalMsg.get(), &iter);
-
-        // interface_name
-        VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
+        error = SendSignal(*signalMsg, aDestination);
 
-        // changed_properties
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OTBR_ERROR_DBUS);
-
-        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, aPropertyName));
-        SuccessOrExit(error = DBusMessageEncodeToVariant(&dictEntryIter, aValue));
+    exit:
+        return error;
+    }
 
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+    /**
+     * This method sends a subscribable signal to each of its subscribers within their rate limits.
+     *
+     * The signal is dropped for the subscribers over their rate limits. Failing to send the signal to one subscriber
+     * doesn't keep it from the others.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aSignalName       The signal name.
+     * @param[in]   aArgs             The tuple to be encoded into the signal.
+     *
+     * @retval OTBR_ERROR_NONE  Signal successfully sent to the subscribers within their rate limits.
+     * @retval OTBR_ERROR_DBUS  Failed to encode the signal, or to send it to some of the subscribers.
+     *
+     */
+    template <typename... FieldTypes>
+    otbrError SignalSubscribers(const std::string &              aInterfaceName,
+                                const std::string &              aSignalName,
+                                const std::tuple<FieldTypes...> &aArgs)
+    {
+        UniqueDBusMessage signalMsg{nullptr};
+        otbrError         error     = OTBR_ERROR_NONE;
+        auto              signalMap = mSubscribableSignals.find(aInterfaceName + "." + aSignalName);
 
-        // invalidated_properties
-        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+        VerifyOrExit(signalMap != mSubscribableSignals.end());
 
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        for (auto &subscriber : signalMap->second.mSubscribers)
         {
-            otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), aPropertyName.c_str());
-            DumpDBusMessage(*signalMsg);
+            if (!AdmitSignal(subscriber.second))
+            {
+                subscriber.second.mDropped++;
+                continue;
+            }
+
+            // The signal is only encoded once, each subscriber gets its own copy with its own destination.
+            if (signalMsg == nullptr)
+            {
+                signalMsg = UniqueDBusMessage(
+                    dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str()));
+                VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+                SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
+            }
+
+            ReportDroppedSignals(subscriber.first, signalMap->first, subscriber.second);
+
+            // `SendSignal()` logs the failure.
+            if (SendSignal(*signalMsg, subscriber.first) != OTBR_ERROR_NONE)
+            {
+                error = OTBR_ERROR_DBUS;
+            }
         }
 
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
-
     exit:
         return error;
     }
 
+    /**
+     * This method queues a property changed signal.
+     *
+     * Changes are coalesced until the next call to `FlushPropertyChangedSignals()`, which sends a single
+     * `PropertiesChanged` signal per interface carrying the latest value of every changed property.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyName     The property name.
+     * @param[in]   aValue            New value of the property.
+     *
+     * @retval OTBR_ERROR_NONE  Signal successfully queued.
+     *
+     */
+    template <typename ValueType>
+    otbrError SignalPropertyChanged(const std::string &aInterfaceName,
+                                    const std::string &aPropertyName,
+                                    const ValueType &  aValue)
+    {
+        mPendingPropertyChanges[aInterfaceName][aPropertyName] = [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue);
+        };
+
+        return OTBR_ERROR_NONE;
+    }
+
+    /**
+     * This method indicates whether there are queued property changed signals.
+     *
+     * @returns Whether there are queued property changed signals.
+     *
+     */
+    bool HasPendingPropertyChanges(void) const { return !mPendingPropertyChanges.empty(); }
+
+    /**
+     * This method sends the queued property changed signals, one `PropertiesChanged` signal per interface.
+     *
+     */
+    void FlushPropertyChangedSignals(void);
+
+    /**
+     * This method updates the mainloop context for the queued signals and the outstanding async method calls.
+     *
+     * @param[inout]  aMainloop   A reference to the mainloop to be updated.
+     *
+     */
+    void Update(MainloopContext &aMainloop);
+
+    /**
+     * This method sends the queued signals and times out the expired async method calls.
+     *
+     * @param[in]     aMainloop   A reference to the mainloop context.
+     *
+     */
+    void Process(const MainloopContext &aMainloop);
+
     /**
      * The destructor of a d-bus object.
      *
      */
     virtual ~DBusObject(void);
 
+protected:
+    /**
+     * This method handles a request to get several properties of an interface with a single call.
+     *
+     * The request carries an array of property names and the reply an array of variants with the values of the
+     * properties in the same order.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aRequest          The request.
+     *
+     */
+    void GetPropertiesMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest);
+
 private:
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
 
@@ -224,11 +408,65 @@ private:
     static DBusHandlerResult sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage);
 
+    struct SignalSubscriber
+    {
+        double    mTokens;     ///< The signals the subscriber may receive back to back.
+        Timepoint mRefillTime; ///< The time the tokens were last refilled.
+        uint32_t  mDropped;    ///< The signals dropped since the last one sent to the subscriber.
+    };
+
+    struct SubscribableSignal
+    {
+        SubscriptionHandlerType                 mHandler;
+        std::map<std::string, SignalSubscriber> mSubscribers; ///< The subscribers keyed by their unique bus names.
+    };
+
+    void      SubscribeSignalMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest);
+    void      UnsubscribeSignalMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest);
+    otbrError SendSignal(DBusMessage &aSignal, const std::string &aDestination);
+    void      RemoveSignalSubscriber(const std::string &aSubscriber);
+    void      HandleNameOwnerChanged(DBusMessage &aMessage);
+
+    const SignalSubscriber *FindSignalSubscriber(const std::string &aSubscriber,
+                                                 const std::string &aInterfaceName,
+                                                 const std::string &aSignalName) const;
+
+    static DBusHandlerResult sNameOwnerChangedFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
+    static bool              AdmitSignal(SignalSubscriber &aSubscriber);
+    static void              RefillSignalTokens(SignalSubscriber &aSubscriber, Timepoint aNow);
+    static void              ReportDroppedSignals(const std::string &aSubscriber,
+                                                  const std::string &aSignalName,
+                                                  SignalSubscriber & aState);
+
+    using PropertyEncoderType = std::function<otbrError(DBusMessageIter &)>;
+    using PropertyEncoderMap  = std::map<std::string, PropertyEncoderType>;
+
+    otbrError SendPropertiesChangedSignal(const std::string &aInterfaceName, const PropertyEncoderMap &aProperties);
+
+    struct PendingRequest
+    {
+        DBusAsyncRequest   mRequest;
+        Timepoint          mDeadline;
+        TimeoutHandlerType mTimeoutHandler;
+    };
+
+    void HandleAsyncMethod(const std::string &           aMethodName,
+                           const AsyncMethodHandlerType &aHandler,
+                           size_t                        aMaxPending,
+                           Milliseconds                  aTimeout,
+                           const TimeoutHandlerType &    aTimeoutHandler,
+                           DBusRequest &                 aRequest);
+    void ExpirePendingRequests(void);
+
     std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
     std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
     std::unordered_map<std::string, PropertyHandlerType>                                  mSetPropertyHandlers;
     DBusConnection *                                                                      mConnection;
     std::string                                                                           mObjectPath;
+    std::map<std::string, PropertyEncoderMap>                                             mPendingPropertyChanges;
+    std::unordered_map<std::string, std::vector<PendingRequest>>                          mPendingRequests;
+    std::unordered_map<std::string, SubscribableSignal>                                   mSubscribableSignals;
+    bool                                                                                  mWatchingNameOwners;
 };
 
 } // namespace DBus
@@ -35,6 +35,10 @@
 #define OTBR_LOG_TAG "DBUS"
 #endif
 
+#include <memory>
+#include <tuple>
+#include <utility>
+
 #include "common/logging.hpp"
 
 #include "dbus/common/dbus_message_dump.hpp"
@@ -68,30 +72,42 @@ public:
     }
 
     /**
-     * The copy constructor of dbus request.
+     * The move constructor of dbus request.
      *
-     * @param[in]   aOther    The object to be copied from.
+     * @param[in]   aOther    The object to be moved from.
      *
      */
-    DBusRequest(const DBusRequest &aOther)
-        : mConnection(nullptr)
-        , mMessage(nullptr)
+    DBusRequest(DBusRequest &&aOther)
+        : mConnection(aOther.mConnection)
+        , mMessage(aOther.mMessage)
     {
-        CopyFrom(aOther);
+        aOther.mConnection = nullptr;
+        aOther.mMessage    = nullptr;
     }
 
     /**
-     * The assignment operator of dbus request.
+     * The move assignment operator of dbus request.
      *
-     * @param[in]   aOther    The object to be copied from.
+     * @param[in]   aOther    The object to be moved from.
      *
      */
-    DBusRequest &operator=(const DBusRequest &aOther)
+    DBusRequest &operator=(DBusRequest &&aOther)
     {
-        CopyFrom(aOther);
+        if (this != &aOther)
+        {
+            Release();
+            mConnection        = aOther.mConnection;
+            mMessage           = aOther.mMessage;
+            aOther.mConnection = nullptr;
+            aOther.mMessage    = nullptr;
+        }
+
         return *this;
     }
 
+    DBusRequest(const DBusRequest &) = delete;
+    DBusRequest &operator=(const DBusRequest &) = delete;
+
     /**
      * This method returns the message sent to call the d-bus method.
      *
@@ -121,11 +137,34 @@ public:
         VerifyOrExit(reply != nullptr);
         VerifyOrExit(otbr::DBus::TupleToDBusMessage(*reply, aReply) == OTBR_ERROR_NONE);
 
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLogDebug("Replied to %s.%s :", dbus_message_get_interface(mMessage), dbus_message_get_member(mMessage));
-            DumpDBusMessage(*reply);
-        }
+        otbrLogDebug("Replied to %s.%s :", dbus_message_get_interface(mMessage), dbus_message_get_member(mMessage));
+        OTBR_DBUS_DUMP_MESSAGE(*reply);
+        dbus_connection_send(mConnection, reply.get(), nullptr);
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method replies to the d-bus method call with a copy of a prebuilt method return message.
+     *
+     * The prebuilt message is never sent itself, so it can be shared by all calls to the same method.
+     *
+     * @param[in] aPrebuiltReply  The prebuilt method return message.
+     *
+     */
+    void ReplyPrebuilt(DBusMessage &aPrebuiltReply)
+    {
+        UniqueDBusMessage reply{dbus_message_copy(&aPrebuiltReply)};
+        const char *      sender = dbus_message_get_sender(mMessage);
+
+        VerifyOrExit(reply != nullptr);
+        VerifyOrExit(dbus_message_set_reply_serial(reply.get(), dbus_message_get_serial(mMessage)));
+        VerifyOrExit(sender == nullptr || dbus_message_set_destination(reply.get(), sender));
+        dbus_message_set_no_reply(reply.get(), TRUE);
+
+        otbrLogDebug("Replied to %s.%s :", dbus_message_get_interface(mMessage), dbus_message_get_member(mMessage));
+        OTBR_DBUS_DUMP_MESSAGE(*reply);
         dbus_connection_send(mConnection, reply.get(), nullptr);
 
     exit:
@@ -173,37 +212,110 @@ public:
      * The destructor of DBusRequest
      *
      */
-    ~DBusRequest(void)
+    ~DBusRequest(void) { Release(); }
+
+private:
+    void Release(void)
     {
         if (mConnection)
         {
             dbus_connection_unref(mConnection);
+            mConnection = nullptr;
         }
         if (mMessage)
         {
             dbus_message_unref(mMessage);
+            mMessage = nullptr;
         }
     }
 
+    DBusConnection *mConnection;
+    DBusMessage *   mMessage;
+};
+
+/**
+ * This class represents a d-bus method call which is replied after its handler returns.
+ *
+ * Copies of an async request refer to the same method call and only the first reply is sent, so the handler may
+ * keep copies in callbacks while the call is replied elsewhere, e.g. on timeout.
+ *
+ */
+class DBusAsyncRequest
+{
+public:
+    /**
+     * The constructor of dbus async request.
+     *
+     * @param[in]   aRequest    The method call to be replied asynchronously.
+     *
+     */
+    explicit DBusAsyncRequest(DBusRequest &&aRequest)
+        : mState(std::make_shared<State>(std::move(aRequest)))
+    {
+    }
+
+    /**
+     * This method returns the message sent to call the d-bus method.
+     *
+     * @returns   The dbus message.
+     *
+     */
+    DBusMessage *GetMessage(void) { return mState->mRequest.GetMessage(); }
+
+    /**
+     * This method indicates whether the method call has been replied.
+     *
+     * @returns   Whether the method call has been replied.
+     *
+     */
+    bool IsReplied(void) const { return mState->mReplied; }
+
+    /**
+     * This method replies to the d-bus method call unless it has already been replied.
+     *
+     * @param[in] aReply  The tuple to be sent.
+     *
+     */
+    template <typename... Args> void Reply(const std::tuple<Args...> &aReply)
+    {
+        VerifyOrExit(!mState->mReplied);
+        mState->mReplied = true;
+        mState->mRequest.Reply(aReply);
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method replies an otError to the d-bus method call unless it has already been replied.
+     *
+     * @param[in] aError  The error to be sent.
+     *
+     */
+    void ReplyOtResult(otError aError)
+    {
+        VerifyOrExit(!mState->mReplied);
+        mState->mReplied = true;
+        mState->mRequest.ReplyOtResult(aError);
+
+    exit:
+        return;
+    }
+
 private:
-    void CopyFrom(const DBusRequest &aOther)
+    struct State
     {
-        if (mMessage)
-        {
-            dbus_message_unref(mMessage);
-        }
-        if (mConnection)
+        explicit State(DBusRequest &&aRequest)
+            : mRequest(std::move(aRequest))
+            , mReplied(false)
         {
-            dbus_connection_unref(mConnection);
         }
-        mConnection = aOther.mConnection;
-        mMessage    = aOther.mMessage;
-        dbus_message_ref(mMessage);
-        dbus_connection_ref(mConnection);
-    }
 
-    DBusConnection *mConnection;
-    DBusMessage *   mMessage;
+        DBusRequest mRequest;
+        bool        mReplied;
+    };
+
+    std::shared_ptr<State> mState;
 };
 
 } // namespace DBus
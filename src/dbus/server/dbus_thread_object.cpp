@@ -28,6 +28,9 @@
 
 #include <assert.h>
 #include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
 
 #include <openthread/border_router.h>
 #include <openthread/channel_monitor.h>
@@ -40,7 +43,12 @@
 #include <openthread/platform/radio.h>
 
 #include "common/byteswap.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/metrics_registry.hpp"
+#include "common/tlv.hpp"
+#include "common/trace.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/table_blob.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
 
@@ -51,6 +59,64 @@
 using std::placeholders::_1;
 using std::placeholders::_2;
 
+template <typename EntryType>
+static std::vector<EntryType> GetTablePage(const std::vector<EntryType> &aTable, uint16_t aOffset, uint16_t aCount)
+{
+    auto begin = aTable.begin() + std::min<size_t>(aOffset, aTable.size());
+    auto end   = begin + std::min<size_t>(aCount, aTable.end() - begin);
+
+    return std::vector<EntryType>(begin, end);
+}
+
+// Link metrics such as the age and RSSI change all the time, so only the fields describing the child itself are
+// compared.
+static bool IsChildEntryChanged(const otbr::DBus::ChildInfo &aOld, const otbr::DBus::ChildInfo &aNew)
+{
+    return aOld.mTimeout != aNew.mTimeout || aOld.mRloc16 != aNew.mRloc16 || aOld.mChildId != aNew.mChildId ||
+           aOld.mNetworkDataVersion != aNew.mNetworkDataVersion || aOld.mRxOnWhenIdle != aNew.mRxOnWhenIdle ||
+           aOld.mFullThreadDevice != aNew.mFullThreadDevice || aOld.mFullNetworkData != aNew.mFullNetworkData ||
+           aOld.mIsStateRestoring != aNew.mIsStateRestoring;
+}
+
+// The size of the prefix bytes is guaranteed by parsing.
+static otIp6Prefix ConvertToOtIp6Prefix(const otbr::DBus::Ip6Prefix &aPrefix)
+{
+    otIp6Prefix prefix = {};
+
+    std::copy(aPrefix.mPrefix.begin(), aPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
+    prefix.mLength = aPrefix.mLength;
+
+    return prefix;
+}
+
+static otBorderRouterConfig ConvertToOtBorderRouterConfig(const otbr::DBus::OnMeshPrefix &aPrefix)
+{
+    otBorderRouterConfig config = {};
+
+    config.mPrefix       = ConvertToOtIp6Prefix(aPrefix.mPrefix);
+    config.mPreference   = aPrefix.mPreference;
+    config.mPreferred    = aPrefix.mPreferred;
+    config.mSlaac        = aPrefix.mSlaac;
+    config.mDhcp         = aPrefix.mDhcp;
+    config.mConfigure    = aPrefix.mConfigure;
+    config.mDefaultRoute = aPrefix.mDefaultRoute;
+    config.mOnMesh       = aPrefix.mOnMesh;
+    config.mStable       = aPrefix.mStable;
+
+    return config;
+}
+
+static otExternalRouteConfig ConvertToOtExternalRouteConfig(const otbr::DBus::ExternalRoute &aRoute)
+{
+    otExternalRouteConfig config = {};
+
+    config.mPrefix     = ConvertToOtIp6Prefix(aRoute.mPrefix);
+    config.mPreference = aRoute.mPreference;
+    config.mStable     = aRoute.mStable;
+
+    return config;
+}
+
 static std::string GetDeviceRoleName(otDeviceRole aRole)
 {
     std::string roleName;
@@ -88,6 +154,45 @@ static uint64_t ConvertOpenThreadUint64(const uint8_t *aValue)
     return val;
 }
 
+static otbr::DBus::ActiveScanResult ConvertToActiveScanResult(const otActiveScanResult &aResult)
+{
+    otbr::DBus::ActiveScanResult result;
+
+    result.mExtAddress    = ConvertOpenThreadUint64(aResult.mExtAddress.m8);
+    result.mExtendedPanId = ConvertOpenThreadUint64(aResult.mExtendedPanId.m8);
+    result.mNetworkName   = aResult.mNetworkName.m8;
+    result.mSteeringData =
+        std::vector<uint8_t>(aResult.mSteeringData.m8, aResult.mSteeringData.m8 + aResult.mSteeringData.mLength);
+    result.mPanId         = aResult.mPanId;
+    result.mJoinerUdpPort = aResult.mJoinerUdpPort;
+    result.mChannel       = aResult.mChannel;
+    result.mRssi          = aResult.mRssi;
+    result.mLqi           = aResult.mLqi;
+    result.mVersion       = aResult.mVersion;
+    result.mIsNative      = aResult.mIsNative;
+    result.mIsJoinable    = aResult.mIsJoinable;
+
+    return result;
+}
+
+static otbr::DBus::MainloopLatency ConvertToMainloopLatency(const std::string &           aName,
+                                                            const otbr::LatencyHistogram &aHistogram)
+{
+    otbr::DBus::MainloopLatency latency;
+
+    latency.mName    = aName;
+    latency.mCount   = aHistogram.GetCount();
+    latency.mTotalUs = static_cast<uint64_t>(aHistogram.GetTotal().count());
+    latency.mMaxUs   = static_cast<uint64_t>(aHistogram.GetMax().count());
+
+    for (size_t i = 0; i < otbr::LatencyHistogram::kNumBuckets; ++i)
+    {
+        latency.mBuckets.push_back(aHistogram.GetBucketCount(i));
+    }
+
+    return latency;
+}
+
 namespace otbr {
 namespace DBus {
 
@@ -96,31 +201,59 @@ DBusThreadObject::DBusThreadObject(DBusConnection *                 aConnection,
                                    otbr::Ncp::ControllerOpenThread *aNcp)
     : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mNcp(aNcp)
+    , mIntrospectReply(nullptr)
+    , mChildTableRetryScheduled(false)
+{
+}
+
+DBusThreadObject::~DBusThreadObject(void)
 {
+    // The retry task refers to this object, and is run by the task runner of the NCP controller outliving it.
+    mChildTableRetryTask.Cancel();
 }
 
 otbrError DBusThreadObject::Init(void)
 {
+    // ThreadHelper serves a single attach or joiner operation at a time, concurrent scans share one radio scan.
+    constexpr size_t       kMaxPendingCalls    = 1;
+    constexpr size_t       kMaxPendingScans    = 8;
+    constexpr Milliseconds kScanTimeout        = Milliseconds(30 * 1000);
+    constexpr Milliseconds kAttachTimeout      = Milliseconds(120 * 1000);
+    constexpr Milliseconds kJoinerStartTimeout = Milliseconds(120 * 1000);
+
     otbrError error        = DBusObject::Init();
     auto      threadHelper = mNcp->GetThreadHelper();
 
     threadHelper->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
+    threadHelper->AddScanResultHandler(std::bind(&DBusThreadObject::SignalScanResult, this, _1));
     mNcp->RegisterResetHandler(std::bind(&DBusThreadObject::NcpResetHandler, this));
-
-    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
-                   std::bind(&DBusThreadObject::ScanHandler, this, _1));
-    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_METHOD,
-                   std::bind(&DBusThreadObject::AttachHandler, this, _1));
+    mNcp->AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); },
+                                        OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED |
+                                            OT_CHANGED_THREAD_ROLE,
+                                        "dbus-thread-object");
+
+    // A scan which has not finished in time is stuck, it is dropped so that the next call scans again.
+    RegisterAsyncMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
+                        std::bind(&DBusThreadObject::ScanHandler, this, _1), kMaxPendingScans, kScanTimeout,
+                        [threadHelper]() { threadHelper->CancelScan(); });
+    RegisterAsyncMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_METHOD,
+                        std::bind(&DBusThreadObject::AttachHandler, this, _1), kMaxPendingCalls, kAttachTimeout);
+    RegisterAsyncMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_ON_QUIETEST_CHANNEL_METHOD,
+                        std::bind(&DBusThreadObject::AttachOnQuietestChannelHandler, this, _1), kMaxPendingCalls,
+                        kAttachTimeout);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_DETACH_METHOD,
                    std::bind(&DBusThreadObject::DetachHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_FACTORY_RESET_METHOD,
                    std::bind(&DBusThreadObject::FactoryResetHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_RESET_METHOD,
                    std::bind(&DBusThreadObject::ResetHandler, this, _1));
-    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_START_METHOD,
-                   std::bind(&DBusThreadObject::JoinerStartHandler, this, _1));
+    RegisterAsyncMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_START_METHOD,
+                        std::bind(&DBusThreadObject::JoinerStartHandler, this, _1), kMaxPendingCalls,
+                        kJoinerStartTimeout);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_STOP_METHOD,
                    std::bind(&DBusThreadObject::JoinerStopHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ADD_JOINERS_METHOD,
+                   std::bind(&DBusThreadObject::AddJoinersHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD,
                    std::bind(&DBusThreadObject::PermitUnsecureJoinHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD,
@@ -131,10 +264,30 @@ otbrError DBusThreadObject::Init(void)
                    std::bind(&DBusThreadObject::AddExternalRouteHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD,
                    std::bind(&DBusThreadObject::RemoveExternalRouteHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD,
+                   std::bind(&DBusThreadObject::UpdateNetworkDataHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD,
+                   std::bind(&DBusThreadObject::GetPropertiesHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_CHILD_TABLE_PAGE_METHOD,
+                   std::bind(&DBusThreadObject::GetChildTablePageHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_NEIGHBOR_TABLE_PAGE_METHOD,
+                   std::bind(&DBusThreadObject::GetNeighborTablePageHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_METRICS_METHOD,
+                   std::bind(&DBusThreadObject::GetMetricsHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_DUMP_TRACE_BUFFER_METHOD,
+                   std::bind(&DBusThreadObject::DumpTraceBufferHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_EXPORT_CHILD_TABLE_METHOD,
+                   std::bind(&DBusThreadObject::ExportChildTableHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_EXPORT_NEIGHBOR_TABLE_METHOD,
+                   std::bind(&DBusThreadObject::ExportNeighborTableHandler, this, _1));
 
     RegisterMethod(DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD,
                    std::bind(&DBusThreadObject::IntrospectHandler, this, _1));
 
+    RegisterSubscribableSignal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL, nullptr);
+    RegisterSubscribableSignal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL,
+                               std::bind(&DBusThreadObject::HandleChildTableSubscription, this, _1, _2));
+
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX,
                                std::bind(&DBusThreadObject::SetMeshLocalPrefixHandler, this, _1));
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LEGACY_ULA_PREFIX,
@@ -203,6 +356,14 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetActiveDatasetTlvsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_REGION,
                                std::bind(&DBusThreadObject::GetRadioRegionHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MAINLOOP_STATS,
+                               std::bind(&DBusThreadObject::GetMainloopStatsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_STATS,
+                               std::bind(&DBusThreadObject::GetRadioStatsHandler, this, _1));
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_BACKBONE_ROUTER_COUNTERS,
+                               std::bind(&DBusThreadObject::GetBackboneRouterCountersHandler, this, _1));
+#endif
 
     return error;
 }
@@ -215,17 +376,138 @@ void DBusThreadObject::DeviceRoleHandler(otDeviceRole aDeviceRole)
 void DBusThreadObject::NcpResetHandler(void)
 {
     mNcp->GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
+    mNcp->GetThreadHelper()->AddScanResultHandler(std::bind(&DBusThreadObject::SignalScanResult, this, _1));
     SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                           GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
 }
 
-void DBusThreadObject::ScanHandler(DBusRequest &aRequest)
+void DBusThreadObject::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    if (aFlags & (OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED | OT_CHANGED_THREAD_ROLE))
+    {
+        SignalChildTableChanged();
+    }
+}
+
+void DBusThreadObject::HandleChildTableSubscription(const std::string &aSubscriber, bool aSubscribed)
+{
+    // The deltas sent to a subscriber start from the child table at the time it subscribed.
+    if (aSubscribed)
+    {
+        mChildTableSnapshots[aSubscriber] = GetSortedChildTable();
+    }
+    else
+    {
+        mChildTableSnapshots.erase(aSubscriber);
+    }
+}
+
+void DBusThreadObject::SignalChildTableChanged(void)
+{
+    std::vector<ChildInfo> childTable;
+    Milliseconds           retryDelay = Milliseconds::max();
+
+    VerifyOrExit(!mChildTableSnapshots.empty());
+    childTable = GetSortedChildTable();
+
+    for (auto &snapshot : mChildTableSnapshots)
+    {
+        std::vector<ChildInfo> added;
+        std::vector<uint64_t>  removed;
+        std::vector<ChildInfo> updated;
+        auto                   oldIter = snapshot.second.begin();
+        auto                   newIter = childTable.begin();
+        otbrError              error;
+
+        while (oldIter != snapshot.second.end() || newIter != childTable.end())
+        {
+            if (newIter == childTable.end() ||
+                (oldIter != snapshot.second.end() && oldIter->mExtAddress < newIter->mExtAddress))
+            {
+                removed.push_back(oldIter->mExtAddress);
+                ++oldIter;
+            }
+            else if (oldIter == snapshot.second.end() || newIter->mExtAddress < oldIter->mExtAddress)
+            {
+                added.push_back(*newIter);
+                ++newIter;
+            }
+            else
+            {
+                if (IsChildEntryChanged(*oldIter, *newIter))
+                {
+                    updated.push_back(*newIter);
+                }
+                ++oldIter;
+                ++newIter;
+            }
+        }
+
+        if (added.empty() && removed.empty() && updated.empty())
+        {
+            continue;
+        }
+
+        // A subscriber over its rate limit keeps its snapshot, and gets the changes folded into a later delta.
+        if (!AdmitSignal(snapshot.first, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL))
+        {
+            retryDelay = std::min(retryDelay, GetSignalDelay(snapshot.first, OTBR_DBUS_THREAD_INTERFACE,
+                                                             OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL));
+            continue;
+        }
+
+        error = SignalTo(snapshot.first, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL,
+                         std::tie(added, removed, updated));
+
+        // The snapshot only moves forward once the delta is sent, so that a failed signal is folded into the next one.
+        if (error == OTBR_ERROR_NONE)
+        {
+            snapshot.second = childTable;
+        }
+        else
+        {
+            otbrLogWarning("Failed to send the child table changed signal to %s: %s", snapshot.first.c_str(),
+                           otbrErrorString(error));
+        }
+    }
+
+    if (retryDelay != Milliseconds::max() && !mChildTableRetryScheduled)
+    {
+        mChildTableRetryScheduled = true;
+        mChildTableRetryTask      = mNcp->PostTimerTask(retryDelay, [this]() {
+            mChildTableRetryScheduled = false;
+            SignalChildTableChanged();
+        });
+    }
+
+exit:
+    return;
+}
+
+void DBusThreadObject::SignalScanResult(const otActiveScanResult &aResult)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(HasSignalSubscribers(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL));
+
+    // The results dropped for subscribers over their rate limits are still in the reply of the Scan method.
+    error = SignalSubscribers(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL,
+                              std::make_tuple(ConvertToActiveScanResult(aResult)));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to send the scan result signal: %s", otbrErrorString(error));
+    }
+}
+
+void DBusThreadObject::ScanHandler(DBusAsyncRequest &aRequest)
 {
     auto threadHelper = mNcp->GetThreadHelper();
     threadHelper->Scan(std::bind(&DBusThreadObject::ReplyScanResult, this, aRequest, _1, _2));
 }
 
-void DBusThreadObject::ReplyScanResult(DBusRequest &                          aRequest,
+void DBusThreadObject::ReplyScanResult(DBusAsyncRequest &                     aRequest,
                                        otError                                aError,
                                        const std::vector<otActiveScanResult> &aResult)
 {
@@ -239,30 +521,14 @@ void DBusThreadObject::ReplyScanResult(DBusRequest &                          aR
     {
         for (const auto &r : aResult)
         {
-            ActiveScanResult result;
-
-            result.mExtAddress    = ConvertOpenThreadUint64(r.mExtAddress.m8);
-            result.mExtendedPanId = ConvertOpenThreadUint64(r.mExtendedPanId.m8);
-            result.mNetworkName   = r.mNetworkName.m8;
-            result.mSteeringData =
-                std::vector<uint8_t>(r.mSteeringData.m8, r.mSteeringData.m8 + r.mSteeringData.mLength);
-            result.mPanId         = r.mPanId;
-            result.mJoinerUdpPort = r.mJoinerUdpPort;
-            result.mChannel       = r.mChannel;
-            result.mRssi          = r.mRssi;
-            result.mLqi           = r.mLqi;
-            result.mVersion       = r.mVersion;
-            result.mIsNative      = r.mIsNative;
-            result.mIsJoinable    = r.mIsJoinable;
-
-            results.emplace_back(result);
+            results.emplace_back(ConvertToActiveScanResult(r));
         }
 
         aRequest.Reply(std::tie(results));
     }
 }
 
-void DBusThreadObject::AttachHandler(DBusRequest &aRequest)
+void DBusThreadObject::AttachHandler(DBusAsyncRequest &aRequest)
 {
     auto                 threadHelper = mNcp->GetThreadHelper();
     std::string          name;
@@ -289,6 +555,48 @@ void DBusThreadObject::AttachHandler(DBusRequest &aRequest)
     }
 }
 
+void DBusThreadObject::AttachOnQuietestChannelHandler(DBusAsyncRequest &aRequest)
+{
+    auto                 threadHelper = mNcp->GetThreadHelper();
+    std::string          name;
+    uint16_t             panid;
+    uint64_t             extPanId;
+    std::vector<uint8_t> masterKey;
+    std::vector<uint8_t> pskc;
+    uint32_t             channelMask;
+
+    auto args = std::tie(masterKey, panid, name, extPanId, pskc, channelMask);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE,
+                 aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    threadHelper->AttachOnQuietestChannel(
+        name, panid, extPanId, masterKey, pskc, channelMask,
+        [aRequest](otError aError, const agent::ThreadHelper::ChannelSelection &aSelection) mutable {
+            uint8_t                     channel = aSelection.mChannel;
+            std::vector<ChannelEnergy>  energies;
+            std::vector<ChannelQuality> occupancies;
+
+            VerifyOrExit(aError == OT_ERROR_NONE, aRequest.ReplyOtResult(aError));
+
+            for (const otEnergyScanResult &energy : aSelection.mEnergies)
+            {
+                energies.push_back(ChannelEnergy{energy.mChannel, energy.mMaxRssi});
+            }
+            for (const auto &occupancy : aSelection.mOccupancies)
+            {
+                occupancies.push_back(ChannelQuality{occupancy.first, occupancy.second});
+            }
+            aRequest.Reply(std::tie(channel, energies, occupancies));
+
+        exit:
+            return;
+        });
+
+exit:
+    return;
+}
+
 void DBusThreadObject::DetachHandler(DBusRequest &aRequest)
 {
     aRequest.ReplyOtResult(mNcp->GetThreadHelper()->Detach());
@@ -312,7 +620,7 @@ void DBusThreadObject::ResetHandler(DBusRequest &aRequest)
     aRequest.ReplyOtResult(OT_ERROR_NONE);
 }
 
-void DBusThreadObject::JoinerStartHandler(DBusRequest &aRequest)
+void DBusThreadObject::JoinerStartHandler(DBusAsyncRequest &aRequest)
 {
     auto        threadHelper = mNcp->GetThreadHelper();
     std::string pskd, provisionUrl, vendorName, vendorModel, vendorSwVersion, vendorData;
@@ -337,6 +645,30 @@ void DBusThreadObject::JoinerStopHandler(DBusRequest &aRequest)
     aRequest.ReplyOtResult(OT_ERROR_NONE);
 }
 
+void DBusThreadObject::AddJoinersHandler(DBusRequest &aRequest)
+{
+    auto                     threadHelper = mNcp->GetThreadHelper();
+    std::vector<std::string> joinerIds;
+    std::vector<std::string> pskds;
+    uint32_t                 timeout;
+    auto                     args  = std::tie(joinerIds, pskds, timeout);
+    otError                  error = OT_ERROR_NONE;
+    SteeringData             steeringData;
+    std::vector<uint8_t>     bloomFilter;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = threadHelper->AddJoiners(joinerIds, pskds, timeout, steeringData));
+
+    bloomFilter.assign(steeringData.GetBloomFilter(), steeringData.GetBloomFilter() + steeringData.GetLength());
+    aRequest.Reply(std::tie(bloomFilter));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
 void DBusThreadObject::PermitUnsecureJoinHandler(DBusRequest &aRequest)
 {
 #ifdef OTBR_ENABLE_UNSECURE_JOIN
@@ -368,18 +700,7 @@ void DBusThreadObject::AddOnMeshPrefixHandler(DBusRequest &aRequest)
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.mPrefix.end(),
-              &config.mPrefix.mPrefix.mFields.m8[0]);
-    config.mPrefix.mLength = onMeshPrefix.mPrefix.mLength;
-    config.mPreference     = onMeshPrefix.mPreference;
-    config.mSlaac          = onMeshPrefix.mSlaac;
-    config.mDhcp           = onMeshPrefix.mDhcp;
-    config.mConfigure      = onMeshPrefix.mConfigure;
-    config.mDefaultRoute   = onMeshPrefix.mDefaultRoute;
-    config.mOnMesh         = onMeshPrefix.mOnMesh;
-    config.mStable         = onMeshPrefix.mStable;
-
+    config = ConvertToOtBorderRouterConfig(onMeshPrefix);
     SuccessOrExit(error = otBorderRouterAddOnMeshPrefix(threadHelper->GetInstance(), &config));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
 
@@ -396,10 +717,8 @@ void DBusThreadObject::RemoveOnMeshPrefixHandler(DBusRequest &aRequest)
     otIp6Prefix prefix;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = onMeshPrefix.mLength;
 
+    prefix = ConvertToOtIp6Prefix(onMeshPrefix);
     SuccessOrExit(error = otBorderRouterRemoveOnMeshPrefix(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
 
@@ -414,16 +733,10 @@ void DBusThreadObject::AddExternalRouteHandler(DBusRequest &aRequest)
     auto                  args  = std::tie(route);
     otError               error = OT_ERROR_NONE;
     otExternalRouteConfig otRoute;
-    otIp6Prefix &         prefix = otRoute.mPrefix;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
-    // size is guaranteed by parsing
-    std::copy(route.mPrefix.mPrefix.begin(), route.mPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength      = route.mPrefix.mLength;
-    otRoute.mPreference = route.mPreference;
-    otRoute.mStable     = route.mStable;
-
+    otRoute = ConvertToOtExternalRouteConfig(route);
     SuccessOrExit(error = otBorderRouterAddRoute(threadHelper->GetInstance(), &otRoute));
     if (route.mStable)
     {
@@ -444,10 +757,7 @@ void DBusThreadObject::RemoveExternalRouteHandler(DBusRequest &aRequest)
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
-    // size is guaranteed by parsing
-    std::copy(routePrefix.mPrefix.begin(), routePrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = routePrefix.mLength;
-
+    prefix = ConvertToOtIp6Prefix(routePrefix);
     SuccessOrExit(error = otBorderRouterRemoveRoute(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
 
@@ -455,13 +765,197 @@ exit:
     aRequest.ReplyOtResult(error);
 }
 
+void DBusThreadObject::UpdateNetworkDataHandler(DBusRequest &aRequest)
+{
+    otInstance *               instance = mNcp->GetThreadHelper()->GetInstance();
+    std::vector<OnMeshPrefix>  addedPrefixes;
+    std::vector<Ip6Prefix>     removedPrefixes;
+    std::vector<ExternalRoute> addedRoutes;
+    std::vector<Ip6Prefix>     removedRoutes;
+    auto                       args    = std::tie(addedPrefixes, removedPrefixes, addedRoutes, removedRoutes);
+    otError                    error   = OT_ERROR_NONE;
+    bool                       changed = false;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    // Removals go first so that a prefix or route can be replaced within one batch.
+    for (const Ip6Prefix &removedPrefix : removedPrefixes)
+    {
+        otIp6Prefix prefix = ConvertToOtIp6Prefix(removedPrefix);
+
+        SuccessOrExit(error = otBorderRouterRemoveOnMeshPrefix(instance, &prefix));
+        changed = true;
+    }
+
+    for (const Ip6Prefix &removedPrefix : removedRoutes)
+    {
+        otIp6Prefix prefix = ConvertToOtIp6Prefix(removedPrefix);
+
+        SuccessOrExit(error = otBorderRouterRemoveRoute(instance, &prefix));
+        changed = true;
+    }
+
+    for (const OnMeshPrefix &addedPrefix : addedPrefixes)
+    {
+        otBorderRouterConfig config = ConvertToOtBorderRouterConfig(addedPrefix);
+
+        SuccessOrExit(error = otBorderRouterAddOnMeshPrefix(instance, &config));
+        changed = true;
+    }
+
+    for (const ExternalRoute &addedRoute : addedRoutes)
+    {
+        otExternalRouteConfig config = ConvertToOtExternalRouteConfig(addedRoute);
+
+        SuccessOrExit(error = otBorderRouterAddRoute(instance, &config));
+        changed = true;
+    }
+
+exit:
+    // The changes applied before a failure stay in the local network data, so they are registered as well to keep
+    // the leader in sync with it.
+    if (changed)
+    {
+        otError registerError = otBorderRouterRegister(instance);
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = registerError;
+        }
+    }
+
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusThreadObject::GetPropertiesHandler(DBusRequest &aRequest)
+{
+    GetPropertiesMethodHandler(OTBR_DBUS_THREAD_INTERFACE, aRequest);
+}
+
+void DBusThreadObject::GetChildTablePageHandler(DBusRequest &aRequest)
+{
+    uint16_t               offset;
+    uint16_t               count;
+    auto                   args  = std::tie(offset, count);
+    otError                error = OT_ERROR_NONE;
+    std::vector<ChildInfo> childTable;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    childTable = GetChildTable();
+    aRequest.Reply(std::make_tuple(GetTablePage(childTable, offset, count), static_cast<uint16_t>(childTable.size())));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusThreadObject::GetNeighborTablePageHandler(DBusRequest &aRequest)
+{
+    uint16_t                  offset;
+    uint16_t                  count;
+    auto                      args  = std::tie(offset, count);
+    otError                   error = OT_ERROR_NONE;
+    std::vector<NeighborInfo> neighborTable;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    neighborTable = GetNeighborTable();
+    aRequest.Reply(std::make_tuple(GetTablePage(neighborTable, offset, count),
+                                   static_cast<uint16_t>(neighborTable.size())));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusThreadObject::GetMetricsHandler(DBusRequest &aRequest)
+{
+    std::string metrics;
+
+    MetricsRegistry::Get().Render(metrics);
+    aRequest.Reply(std::make_tuple(metrics));
+}
+
+void DBusThreadObject::DumpTraceBufferHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TRACE
+    aRequest.Reply(std::make_tuple(TraceBuffer::Dump()));
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
+void DBusThreadObject::ExportChildTableHandler(DBusRequest &aRequest)
+{
+    std::vector<uint8_t> blob;
+
+    EncodeTableBlob(GetChildTable(), blob);
+    ReplyTableBlob(aRequest, "otbr-child-table", blob);
+}
+
+void DBusThreadObject::ExportNeighborTableHandler(DBusRequest &aRequest)
+{
+    std::vector<uint8_t> blob;
+
+    EncodeTableBlob(GetNeighborTable(), blob);
+    ReplyTableBlob(aRequest, "otbr-neighbor-table", blob);
+}
+
+void DBusThreadObject::ReplyTableBlob(DBusRequest &aRequest, const char *aName, const std::vector<uint8_t> &aBlob)
+{
+    otError error = OT_ERROR_NONE;
+    UnixFd  table{-1};
+
+    // The bus daemon refuses messages carrying fds on connections that did not negotiate fd passing, so such
+    // callers get a meaningful error and can fall back to the paged getters.
+    VerifyOrExit(dbus_connection_can_send_type(aRequest.GetConnection(), DBUS_TYPE_UNIX_FD),
+                 error = OT_ERROR_NOT_CAPABLE);
+    VerifyOrExit(CreateSealedMemfd(aName, aBlob, table.mFd) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+
+    // libdbus sends a duplicate of the descriptor, so ours is closed right after queuing the reply.
+    aRequest.Reply(std::make_tuple(table));
+
+exit:
+    if (table.mFd != -1)
+    {
+        close(table.mFd);
+    }
+
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
 void DBusThreadObject::IntrospectHandler(DBusRequest &aRequest)
 {
-    std::string xmlString(
+    // The introspection data never changes, so the reply is built once and copied for each call.
+    if (mIntrospectReply == nullptr)
+    {
+        std::string xmlString(
 #include "dbus/server/introspect.hpp"
-    );
+        );
+        UniqueDBusMessage reply{dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN)};
+
+        VerifyOrExit(reply != nullptr);
+        VerifyOrExit(TupleToDBusMessage(*reply, std::tie(xmlString)) == OTBR_ERROR_NONE);
+        mIntrospectReply = std::move(reply);
+    }
 
-    aRequest.Reply(std::tie(xmlString));
+exit:
+    if (mIntrospectReply != nullptr)
+    {
+        aRequest.ReplyPrebuilt(*mIntrospectReply);
+    }
+    else
+    {
+        aRequest.ReplyOtResult(OT_ERROR_NO_BUFS);
+    }
 }
 
 otError DBusThreadObject::SetMeshLocalPrefixHandler(DBusMessageIter &aIter)
@@ -757,16 +1251,11 @@ exit:
 
 otError DBusThreadObject::GetNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mNcp->GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    otError error       = OT_ERROR_NONE;
+    auto    networkData = mNcp->GetNetworkData();
 
-    SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/false, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData->mFull) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -774,16 +1263,11 @@ exit:
 
 otError DBusThreadObject::GetStableNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mNcp->GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    otError error       = OT_ERROR_NONE;
+    auto    networkData = mNcp->GetNetworkData();
 
-    SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/true, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData->mStable) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -847,21 +1331,27 @@ exit:
 #endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 }
 
-otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
+std::vector<ChildInfo> DBusThreadObject::GetChildTable(void)
 {
-    auto                   threadHelper = mNcp->GetThreadHelper();
-    otError                error        = OT_ERROR_NONE;
-    uint16_t               childIndex   = 0;
+    otInstance *           instance    = mNcp->GetThreadHelper()->GetInstance();
+    uint16_t               maxChildren = otThreadGetMaxAllowedChildren(instance);
     otChildInfo            childInfo;
     std::vector<ChildInfo> childTable;
 
-    while (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE)
+    // The child table may have unused slots, so every index up to the maximum number of children is visited.
+    for (uint16_t childIndex = 0; childIndex < maxChildren; childIndex++)
     {
         ChildInfo info;
 
+        if (otThreadGetChildInfoByIndex(instance, childIndex, &childInfo) != OT_ERROR_NONE)
+        {
+            continue;
+        }
+
         info.mExtAddress         = ConvertOpenThreadUint64(childInfo.mExtAddress.m8);
         info.mTimeout            = childInfo.mTimeout;
         info.mAge                = childInfo.mAge;
+        info.mRloc16             = childInfo.mRloc16;
         info.mChildId            = childInfo.mChildId;
         info.mNetworkDataVersion = childInfo.mNetworkDataVersion;
         info.mLinkQualityIn      = childInfo.mLinkQualityIn;
@@ -874,19 +1364,25 @@ otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
         info.mFullNetworkData    = childInfo.mFullNetworkData;
         info.mIsStateRestoring   = childInfo.mIsStateRestoring;
         childTable.push_back(info);
-        childIndex++;
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, childTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    return childTable;
+}
 
-exit:
-    return error;
+std::vector<ChildInfo> DBusThreadObject::GetSortedChildTable(void)
+{
+    std::vector<ChildInfo> childTable = GetChildTable();
+
+    std::sort(childTable.begin(), childTable.end(), [](const ChildInfo &aLhs, const ChildInfo &aRhs) {
+        return aLhs.mExtAddress < aRhs.mExtAddress;
+    });
+
+    return childTable;
 }
 
-otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
+std::vector<NeighborInfo> DBusThreadObject::GetNeighborTable(void)
 {
     auto                      threadHelper = mNcp->GetThreadHelper();
-    otError                   error        = OT_ERROR_NONE;
     otNeighborInfoIterator    iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
     otNeighborInfo            neighborInfo;
     std::vector<NeighborInfo> neighborTable;
@@ -912,7 +1408,25 @@ otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
         neighborTable.push_back(info);
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, neighborTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    return neighborTable;
+}
+
+otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, GetChildTable()) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, GetNeighborTable()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -958,13 +1472,11 @@ exit:
 
 otError DBusThreadObject::GetExternalRoutesHandler(DBusMessageIter &aIter)
 {
-    auto                       threadHelper = mNcp->GetThreadHelper();
-    otError                    error        = OT_ERROR_NONE;
-    otNetworkDataIterator      iter         = OT_NETWORK_DATA_ITERATOR_INIT;
-    otExternalRouteConfig      config;
+    otError                    error       = OT_ERROR_NONE;
+    auto                       networkData = mNcp->GetNetworkData();
     std::vector<ExternalRoute> externalRouteTable;
 
-    while (otNetDataGetNextRoute(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE)
+    for (const otExternalRouteConfig &config : networkData->mExternalRoutes)
     {
         ExternalRoute route;
 
@@ -994,6 +1506,7 @@ otError DBusThreadObject::SetActiveDatasetTlvsHandler(DBusMessageIter &aIter)
 
     VerifyOrExit(DBusMessageExtractFromVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
     VerifyOrExit(data.size() <= sizeof(datasetTlvs.mTlvs));
+    VerifyOrExit(TlvView(data.data(), static_cast<uint16_t>(data.size())).IsValid(), error = OT_ERROR_INVALID_ARGS);
     std::copy(std::begin(data), std::end(data), std::begin(datasetTlvs.mTlvs));
     datasetTlvs.mLength = data.size();
     error               = otDatasetSetActiveTlvs(threadHelper->GetInstance(), &datasetTlvs);
@@ -1053,5 +1566,83 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetMainloopStatsHandler(DBusMessageIter &aIter)
+{
+    MainloopManager::Stats mainloopStats = MainloopManager::GetInstance().GetStats();
+    MainloopStats          stats;
+    otError                error = OT_ERROR_NONE;
+
+    stats.mIterations   = mainloopStats.mIterations;
+    stats.mTimerWakeups = mainloopStats.mTimerWakeups;
+    stats.mDurationMs   = static_cast<uint64_t>(mainloopStats.mDuration.count());
+
+    for (const MainloopManager::Latency &latency : mainloopStats.mLatencies)
+    {
+        stats.mLatencies.push_back(ConvertToMainloopLatency(latency.mName, latency.mHistogram));
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, stats) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetRadioStatsHandler(DBusMessageIter &aIter)
+{
+    const otbr::Ncp::ControllerOpenThread::RadioStats &radioStats = otbr::Ncp::ControllerOpenThread::GetRadioStats();
+    RadioStats                                         stats;
+    otError                                            error = OT_ERROR_NONE;
+
+    stats.mTxFrames                = radioStats.mTxFrames;
+    stats.mTxBytes                 = radioStats.mTxBytes;
+    stats.mTxNoAck                 = radioStats.mTxNoAck;
+    stats.mTxChannelAccessFailures = radioStats.mTxChannelAccessFailures;
+    stats.mTxErrors                = radioStats.mTxErrors;
+    stats.mRxFrames                = radioStats.mRxFrames;
+    stats.mRxBytes                 = radioStats.mRxBytes;
+    stats.mRxErrors                = radioStats.mRxErrors;
+    stats.mResets                  = radioStats.mResets;
+    stats.mTxLatency               = ConvertToMainloopLatency("tx", radioStats.mTxLatency);
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, stats) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+otError DBusThreadObject::GetBackboneRouterCountersHandler(DBusMessageIter &aIter)
+{
+    BackboneRouter::BackboneAgent::Counters agentCounters;
+    BackboneRouterCounters                  counters = {};
+    otError                                 error    = OT_ERROR_NONE;
+
+    VerifyOrExit(mBackboneRouterCountersGetter != nullptr, error = OT_ERROR_NOT_IMPLEMENTED);
+
+    agentCounters = mBackboneRouterCountersGetter();
+
+    counters.mPrimaryTransitions  = agentCounters.mPrimaryTransitions;
+    counters.mDomainPrefixChanges = agentCounters.mDomainPrefixChanges;
+#if OTBR_ENABLE_DUA_ROUTING
+    counters.mMulticastNsReceived = agentCounters.mNdProxy.mMulticastNsReceived;
+    counters.mMulticastNsDropped  = agentCounters.mNdProxy.mMulticastNsDropped;
+    counters.mUnicastNsReceived   = agentCounters.mNdProxy.mUnicastNsReceived;
+    counters.mNsMatched           = agentCounters.mNdProxy.mNsMatched;
+    counters.mNaSent              = agentCounters.mNdProxy.mNaSent;
+    counters.mNfqAccepted         = agentCounters.mNdProxy.mNfqAccepted;
+    counters.mNfqDropped          = agentCounters.mNdProxy.mNfqDropped;
+    counters.mDuaAdded            = agentCounters.mNdProxy.mDuaAdded;
+    counters.mDuaRenewed          = agentCounters.mNdProxy.mDuaRenewed;
+    counters.mDuaRemoved          = agentCounters.mNdProxy.mDuaRemoved;
+    counters.mSocketErrors        = agentCounters.mNdProxy.mSocketErrors;
+#endif
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+#endif
+
 } // namespace DBus
 } // namespace otbr
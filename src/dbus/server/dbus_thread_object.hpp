@@ -34,13 +34,20 @@
 #ifndef OTBR_DBUS_THREAD_OBJECT_HPP_
 #define OTBR_DBUS_THREAD_OBJECT_HPP_
 
+#include <functional>
+#include <map>
 #include <string>
+#include <vector>
 
 #include <openthread/link.h>
 
 #include "agent/ncp_openthread.hpp"
 #include "dbus/server/dbus_object.hpp"
 
+#if OTBR_ENABLE_BACKBONE_ROUTER
+#include "backbone_router/backbone_agent.hpp"
+#endif
+
 namespace otbr {
 namespace DBus {
 
@@ -72,6 +79,12 @@ public:
                      const std::string &              aInterfaceName,
                      otbr::Ncp::ControllerOpenThread *aNcp);
 
+    /**
+     * The destructor of dbus thread object.
+     *
+     */
+    ~DBusThreadObject(void) override;
+
     /**
      * This method initializes the dbus thread object.
      *
@@ -80,23 +93,52 @@ public:
      */
     otbrError Init(void) override;
 
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    using BackboneRouterCountersGetter = std::function<BackboneRouter::BackboneAgent::Counters(void)>;
+
+    /**
+     * This method sets the getter of the Backbone Router counters.
+     *
+     * @param[in]  aGetter  The getter of the Backbone Router counters.
+     *
+     */
+    void SetBackboneRouterCountersGetter(BackboneRouterCountersGetter aGetter)
+    {
+        mBackboneRouterCountersGetter = std::move(aGetter);
+    }
+#endif
+
 private:
     void DeviceRoleHandler(otDeviceRole aDeviceRole);
     void NcpResetHandler(void);
-
-    void ScanHandler(DBusRequest &aRequest);
-    void AttachHandler(DBusRequest &aRequest);
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+    void SignalChildTableChanged(void);
+    void SignalScanResult(const otActiveScanResult &aResult);
+    void HandleChildTableSubscription(const std::string &aSubscriber, bool aSubscribed);
+
+    void ScanHandler(DBusAsyncRequest &aRequest);
+    void AttachHandler(DBusAsyncRequest &aRequest);
+    void AttachOnQuietestChannelHandler(DBusAsyncRequest &aRequest);
     void DetachHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
     void FactoryResetHandler(DBusRequest &aRequest);
     void ResetHandler(DBusRequest &aRequest);
-    void JoinerStartHandler(DBusRequest &aRequest);
+    void JoinerStartHandler(DBusAsyncRequest &aRequest);
     void JoinerStopHandler(DBusRequest &aRequest);
+    void AddJoinersHandler(DBusRequest &aRequest);
     void PermitUnsecureJoinHandler(DBusRequest &aRequest);
     void AddOnMeshPrefixHandler(DBusRequest &aRequest);
     void RemoveOnMeshPrefixHandler(DBusRequest &aRequest);
     void AddExternalRouteHandler(DBusRequest &aRequest);
     void RemoveExternalRouteHandler(DBusRequest &aRequest);
+    void UpdateNetworkDataHandler(DBusRequest &aRequest);
+    void GetPropertiesHandler(DBusRequest &aRequest);
+    void GetChildTablePageHandler(DBusRequest &aRequest);
+    void GetNeighborTablePageHandler(DBusRequest &aRequest);
+    void GetMetricsHandler(DBusRequest &aRequest);
+    void DumpTraceBufferHandler(DBusRequest &aRequest);
+    void ExportChildTableHandler(DBusRequest &aRequest);
+    void ExportNeighborTableHandler(DBusRequest &aRequest);
 
     void IntrospectHandler(DBusRequest &aRequest);
 
@@ -134,10 +176,27 @@ private:
     otError GetExternalRoutesHandler(DBusMessageIter &aIter);
     otError GetActiveDatasetTlvsHandler(DBusMessageIter &aIter);
     otError GetRadioRegionHandler(DBusMessageIter &aIter);
-
-    void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
-
-    otbr::Ncp::ControllerOpenThread *mNcp;
+    otError GetMainloopStatsHandler(DBusMessageIter &aIter);
+    otError GetRadioStatsHandler(DBusMessageIter &aIter);
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    otError GetBackboneRouterCountersHandler(DBusMessageIter &aIter);
+#endif
+
+    void ReplyScanResult(DBusAsyncRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
+    void ReplyTableBlob(DBusRequest &aRequest, const char *aName, const std::vector<uint8_t> &aBlob);
+
+    std::vector<ChildInfo>    GetChildTable(void);
+    std::vector<ChildInfo>    GetSortedChildTable(void);
+    std::vector<NeighborInfo> GetNeighborTable(void);
+
+    otbr::Ncp::ControllerOpenThread *             mNcp;
+    UniqueDBusMessage                             mIntrospectReply;
+    std::map<std::string, std::vector<ChildInfo>> mChildTableSnapshots; ///< The child table last sent, by subscriber.
+    TaskRunner::TaskHandle                        mChildTableRetryTask;
+    bool                                          mChildTableRetryScheduled;
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    BackboneRouterCountersGetter mBackboneRouterCountersGetter;
+#endif
 };
 
 } // namespace DBus
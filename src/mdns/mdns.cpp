@@ -33,7 +33,12 @@
 
 #include "mdns/mdns.hpp"
 
+#include <algorithm>
+
+#include <assert.h>
+
 #include "common/code_utils.hpp"
+#include "common/trace.hpp"
 
 namespace otbr {
 
@@ -56,6 +61,222 @@ bool Publisher::IsServiceTypeEqual(const char *aFirstType, const char *aSecondTy
     return firstLength == secondLength && memcmp(aFirstType, aSecondType, firstLength) == 0;
 }
 
+std::string Publisher::MakeServiceKey(const char *aName, const char *aType)
+{
+    size_t      typeLength = strlen(aType);
+    std::string key;
+
+    if (typeLength > 0 && aType[typeLength - 1] == '.')
+    {
+        --typeLength;
+    }
+
+    // Neither the name nor the type may contain a NUL character, so it separates them unambiguously.
+    key.assign(aType, typeLength);
+    key.push_back('\0');
+    key.append(aName);
+
+    return key;
+}
+
+Publisher::AddressList Publisher::MakeAddressSet(const AddressList &aAddresses)
+{
+    AddressList addresses = aAddresses;
+
+    std::sort(addresses.begin(), addresses.end());
+    addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+
+    return addresses;
+}
+
+void Publisher::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    uint32_t &count = mServiceSubscriptionCounts[MakeServiceKey(aInstanceName.c_str(), aType.c_str())];
+
+    if (count++ == 0)
+    {
+        StartServiceSubscription(aType, aInstanceName);
+    }
+}
+
+void Publisher::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    auto it = mServiceSubscriptionCounts.find(MakeServiceKey(aInstanceName.c_str(), aType.c_str()));
+
+    assert(it != mServiceSubscriptionCounts.end());
+    VerifyOrExit(it != mServiceSubscriptionCounts.end());
+
+    if (--it->second == 0)
+    {
+        mServiceSubscriptionCounts.erase(it);
+        StopServiceSubscription(aType, aInstanceName);
+    }
+
+exit:
+    return;
+}
+
+void Publisher::SubscribeHost(const std::string &aHostName)
+{
+    uint32_t &count = mHostSubscriptionCounts[aHostName];
+
+    if (count++ == 0)
+    {
+        StartHostSubscription(aHostName);
+    }
+}
+
+void Publisher::UnsubscribeHost(const std::string &aHostName)
+{
+    auto it = mHostSubscriptionCounts.find(aHostName);
+
+    assert(it != mHostSubscriptionCounts.end());
+    VerifyOrExit(it != mHostSubscriptionCounts.end());
+
+    if (--it->second == 0)
+    {
+        mHostSubscriptionCounts.erase(it);
+        StopHostSubscription(aHostName);
+    }
+
+exit:
+    return;
+}
+
+uint32_t Publisher::GetServiceSubscriptionCount(const std::string &aType, const std::string &aInstanceName) const
+{
+    auto it = mServiceSubscriptionCounts.find(MakeServiceKey(aInstanceName.c_str(), aType.c_str()));
+
+    return it != mServiceSubscriptionCounts.end() ? it->second : 0;
+}
+
+uint32_t Publisher::GetHostSubscriptionCount(const std::string &aHostName) const
+{
+    auto it = mHostSubscriptionCounts.find(aHostName);
+
+    return it != mHostSubscriptionCounts.end() ? it->second : 0;
+}
+
+otbrError Publisher::PublishService(const char *   aHostName,
+                                    uint16_t       aPort,
+                                    const char *   aName,
+                                    const char *   aType,
+                                    const TxtList &aTxtList)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   txt[kMaxTxtDataSize];
+    uint16_t  txtLength = sizeof(txt);
+
+    SuccessOrExit(error = EncodeTxtData(aTxtList, txt, txtLength));
+    error = PublishService(aHostName, aPort, aName, aType, TxtData(txt, txtLength));
+
+exit:
+    return error;
+}
+
+Publisher::Stats Publisher::GetStats(void) const
+{
+    Stats stats = mStats;
+
+    stats.mServicesInFlight = static_cast<uint32_t>(mServicePublicationTimes.size());
+    stats.mHostsInFlight    = static_cast<uint32_t>(mHostPublicationTimes.size());
+
+    return stats;
+}
+
+void Publisher::ResetStats(void)
+{
+    mStats = Stats();
+}
+
+bool Publisher::StartServicePublication(const char *aName, const char *aType)
+{
+    bool started = mServicePublicationTimes.emplace(MakeServiceKey(aName, aType), Clock::now()).second;
+
+    otbrTrace(TraceEvent::kMdnsPublishService, static_cast<uint32_t>(mServicePublicationTimes.size()));
+    otbrProbe(mdns__publish__service, aName, aType);
+
+    return started;
+}
+
+void Publisher::CancelServicePublication(const char *aName, const char *aType)
+{
+    mServicePublicationTimes.erase(MakeServiceKey(aName, aType));
+}
+
+void Publisher::FinishServicePublication(const char *aName, const char *aType, otbrError aError)
+{
+    FinishPublication(mStats.mServiceLatency, mServicePublicationTimes, MakeServiceKey(aName, aType), aError);
+    otbrProbe(mdns__service__callback, aName, aType, static_cast<int>(aError));
+
+    if (mServiceHandler != nullptr)
+    {
+        mServiceHandler(aName, aType, aError, mServiceHandlerContext);
+    }
+}
+
+bool Publisher::StartHostPublication(const char *aName)
+{
+    bool started = mHostPublicationTimes.emplace(aName, Clock::now()).second;
+
+    otbrTrace(TraceEvent::kMdnsPublishHost, static_cast<uint32_t>(mHostPublicationTimes.size()));
+    otbrProbe(mdns__publish__host, aName);
+
+    return started;
+}
+
+void Publisher::CancelHostPublication(const char *aName)
+{
+    mHostPublicationTimes.erase(aName);
+}
+
+void Publisher::FinishHostPublication(const char *aName, otbrError aError)
+{
+    FinishPublication(mStats.mHostLatency, mHostPublicationTimes, aName, aError);
+    otbrProbe(mdns__host__callback, aName, static_cast<int>(aError));
+
+    if (mHostHandler != nullptr)
+    {
+        mHostHandler(aName, aError, mHostHandlerContext);
+    }
+}
+
+void Publisher::CancelAllPublications(void)
+{
+    mServicePublicationTimes.clear();
+    mHostPublicationTimes.clear();
+}
+
+void Publisher::FinishPublication(LatencyHistogram &                          aHistogram,
+                                  std::unordered_map<std::string, Timepoint> &aStartTimes,
+                                  const std::string &                         aKey,
+                                  otbrError                                   aError)
+{
+    auto         it      = aStartTimes.find(aKey);
+    Microseconds latency = Microseconds::zero();
+
+    // Results of publications which are not in flight, e.g. later conflicts, count as failures too.
+    if (it != aStartTimes.end())
+    {
+        latency = std::chrono::duration_cast<Microseconds>(Clock::now() - it->second);
+        aHistogram.Record(latency);
+        aStartTimes.erase(it);
+    }
+
+    otbrTrace(TraceEvent::kMdnsPublishResult, &aStartTimes == &mHostPublicationTimes ? 1 : 0,
+              static_cast<uint32_t>(aError), static_cast<uint32_t>(latency.count()));
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        ++mStats.mFailures;
+    }
+
+    if (aError == OTBR_ERROR_DUPLICATED)
+    {
+        ++mStats.mConflicts;
+    }
+}
+
 otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, uint8_t *aTxtData, uint16_t &aTxtLength)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -69,7 +290,7 @@ otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, uint8_t *aTxtData, u
         const size_t   valueLength = txtEntry.mValue.size();
         const size_t   entryLength = nameLength + 1 + valueLength;
 
-        VerifyOrExit(nameLength > 0 && nameLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(nameLength > 0 && entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
         VerifyOrExit(cur + entryLength + 1 <= aTxtData + aTxtLength, error = OTBR_ERROR_INVALID_ARGS);
 
         cur[0] = static_cast<uint8_t>(entryLength);
@@ -81,8 +302,11 @@ otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, uint8_t *aTxtData, u
         cur[0] = '=';
         ++cur;
 
-        memcpy(cur, value, valueLength);
-        cur += valueLength;
+        if (valueLength > 0)
+        {
+            memcpy(cur, value, valueLength);
+            cur += valueLength;
+        }
     }
 
     aTxtLength = cur - aTxtData;
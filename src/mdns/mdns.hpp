@@ -34,13 +34,18 @@
 #ifndef OTBR_AGENT_MDNS_HPP_
 #define OTBR_AGENT_MDNS_HPP_
 
+#include <algorithm>
 #include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sys/select.h>
 
+#include "common/code_utils.hpp"
+#include "common/latency_histogram.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
@@ -91,6 +96,45 @@ public:
 
     typedef std::vector<TxtEntry> TxtList;
 
+    /**
+     * This type represents the IPv6 addresses of a host.
+     *
+     */
+    typedef std::vector<Ip6Address> AddressList;
+
+    /**
+     * This structure references TXT data in the DNS wire format (RFC 6763, section 6).
+     *
+     * The data is not owned by this structure and must stay valid while it is referenced. Publishing encoded TXT
+     * data avoids building a `TxtList` when the TXT record is already available in wire format, e.g. from an SRP
+     * update.
+     *
+     */
+    struct TxtData
+    {
+        const uint8_t *mData;   ///< The TXT data, a sequence of length-prefixed strings.
+        uint16_t       mLength; ///< The length of the TXT data in bytes.
+
+        TxtData(const uint8_t *aData, uint16_t aLength)
+            : mData(aData)
+            , mLength(aLength)
+        {
+        }
+
+        /**
+         * This method indicates whether the TXT data equals to a copy of TXT data.
+         *
+         * @param[in]  aTxtData  The copy of TXT data to compare with.
+         *
+         * @returns  Whether both have the same bytes.
+         *
+         */
+        bool Equals(const std::vector<uint8_t> &aTxtData) const
+        {
+            return aTxtData.size() == mLength && std::equal(aTxtData.begin(), aTxtData.end(), mData);
+        }
+    };
+
     /**
      * This structure represents information of a discovered service instance.
      *
@@ -153,6 +197,20 @@ public:
     using DiscoveredHostCallback =
         std::function<void(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)>;
 
+    /**
+     * This function is called to notify that a subscribed service or service instance does not exist.
+     *
+     * For a service subscription, @p aInstanceName is empty.
+     *
+     */
+    using ServiceNotFoundCallback = std::function<void(const std::string &aType, const std::string &aInstanceName)>;
+
+    /**
+     * This function is called to notify that a subscribed host does not exist.
+     *
+     */
+    using HostNotFoundCallback = std::function<void(const std::string &aHostName)>;
+
     /**
      * MDNS state values.
      *
@@ -255,15 +313,41 @@ public:
      * @param[in]   aPort               The port number of this service.
      * @param[in]   aTxtList            A list of TXT name/value pairs.
      *
-     * @retval  OTBR_ERROR_NONE     Successfully published or updated the service.
-     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the service.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The TXT list cannot be encoded.
+     * @retval  OTBR_ERROR_ERRNO         Failed to publish or update the service.
+     *
+     */
+    otbrError PublishService(const char *   aHostName,
+                             uint16_t       aPort,
+                             const char *   aName,
+                             const char *   aType,
+                             const TxtList &aTxtList);
+
+    /**
+     * This method publishes or updates a service with TXT data in the DNS wire format.
+     *
+     * The TXT data is only referenced during the call, so the caller may release it on return.
+     *
+     * @param[in]   aHostName           The name of the host which this service resides on. If NULL is provided,
+     *                                  this service resides on local host and it is the implementation to provide
+     *                                  specific host name. Otherwise, the caller MUST publish the host with method
+     *                                  PublishHost.
+     * @param[in]   aName               The name of this service.
+     * @param[in]   aType               The type of this service.
+     * @param[in]   aPort               The port number of this service.
+     * @param[in]   aTxtData            The encoded TXT data.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the service.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The TXT data is malformed.
+     * @retval  OTBR_ERROR_ERRNO         Failed to publish or update the service.
      *
      */
     virtual otbrError PublishService(const char *   aHostName,
                                      uint16_t       aPort,
                                      const char *   aName,
                                      const char *   aType,
-                                     const TxtList &aTxtList) = 0;
+                                     const TxtData &aTxtData) = 0;
 
     /**
      * This method un-publishes a service.
@@ -280,19 +364,19 @@ public:
     /**
      * This method publishes or updates a host.
      *
-     * Publishing a host is advertising an A/AAAA RR for the host name. This method should be called
-     * before a service with non-null host name is published.
+     * Publishing a host is advertising the AAAA RRs of all its addresses as one record set for the host name. This
+     * method should be called before a service with non-null host name is published. Updating a host with the
+     * same set of addresses, in any order, changes nothing on the network.
      *
-     * @param[in]  aName           The name of the host.
-     * @param[in]  aAddress        The address of the host.
-     * @param[in]  aAddressLength  The length of @p aAddress.
+     * @param[in]  aName       The name of the host.
+     * @param[in]  aAddresses  The addresses of the host, must not be empty.
      *
      * @retval  OTBR_ERROR_NONE          Successfully published or updated the host.
      * @retval  OTBR_ERROR_INVALID_ARGS  The arguments are not valid.
      * @retval  OTBR_ERROR_ERRNO         Failed to publish or update the host.
      *
      */
-    virtual otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) = 0;
+    virtual otbrError PublishHost(const char *aName, const AddressList &aAddresses) = 0;
 
     /**
      * This method un-publishes a host.
@@ -305,70 +389,118 @@ public:
      */
     virtual otbrError UnpublishHost(const char *aName) = 0;
 
+    /**
+     * This method starts a batch of publications for a host.
+     *
+     * Until `CommitBatch()` is called, the implementation may collect the publications of the host @p aHostName
+     * and of the services residing on it, so that all of them are probed and announced together. The results are
+     * still reported per host and per service by the publish handlers. Batches cannot be nested.
+     *
+     * The default implementation does not batch, every publication is processed immediately.
+     *
+     * @param[in]  aHostName  The name of the host.
+     *
+     */
+    virtual void BeginBatch(const char *aHostName) { OTBR_UNUSED_VARIABLE(aHostName); }
+
+    /**
+     * This method publishes the host and services collected since `BeginBatch()`.
+     *
+     * @retval  OTBR_ERROR_NONE  Successfully published or updated the host and services.
+     * @retval  ...              Failed to publish the host or the services, see `PublishHost()` and
+     *                           `PublishService()`.
+     *
+     */
+    virtual otbrError CommitBatch(void) { return OTBR_ERROR_NONE; }
+
     /**
      * This method subscribes a given service or service instance.
      *
      * If @p aInstanceName is not empty, this method subscribes the service instance. Otherwise, this method subscribes
-     * the service. mDNS implementations should use the `DiscoveredServiceInstanceCallback` function to notify
-     * discovered service instances.
+     * the service. Discovered service instances are notified with the `DiscoveredServiceInstanceCallback` function.
      *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
-     * instance.
+     * Subscriptions are reference counted: only the first subscription of a service or service instance starts a
+     * browse or resolve, the following ones share it.
      *
      * @param[in]  aType          The service type.
      * @param[in]  aInstanceName  The service instance to subscribe, or empty to subscribe the service.
      *
      */
-    virtual void SubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void SubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method unsubscribes a given service or service instance.
      *
      * If @p aInstanceName is not empty, this method unsubscribes the service instance. Otherwise, this method
-     * unsubscribes the service.
-     *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a service or service instance.
+     * unsubscribes the service. The browse or resolve is stopped when the last subscription is removed.
      *
      * @param[in]  aType          The service type.
      * @param[in]  aInstanceName  The service instance to unsubscribe, or empty to unsubscribe the service.
      *
      */
-    virtual void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method subscribes a given host.
      *
-     * mDNS implementations should use the `DiscoveredHostCallback` function to notify discovered hosts.
-     *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same host.
+     * Discovered hosts are notified with the `DiscoveredHostCallback` function. Subscriptions are reference counted:
+     * only the first subscription of a host starts a resolve, the following ones share it.
      *
      * @param[in]  aHostName    The host name (without domain).
      *
      */
-    virtual void SubscribeHost(const std::string &aHostName) = 0;
+    void SubscribeHost(const std::string &aHostName);
 
     /**
      * This method unsubscribes a given host.
      *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a host.
+     * The resolve is stopped when the last subscription of the host is removed.
+     *
+     * @param[in]  aHostName    The host name (without domain).
+     *
+     */
+    void UnsubscribeHost(const std::string &aHostName);
+
+    /**
+     * This method returns the number of subscriptions of a given service or service instance.
+     *
+     * @param[in]  aType          The service type.
+     * @param[in]  aInstanceName  The service instance, or empty for the service.
+     *
+     * @returns  The number of subscriptions.
+     *
+     */
+    uint32_t GetServiceSubscriptionCount(const std::string &aType, const std::string &aInstanceName) const;
+
+    /**
+     * This method returns the number of subscriptions of a given host.
      *
      * @param[in]  aHostName    The host name (without domain).
      *
+     * @returns  The number of subscriptions.
+     *
      */
-    virtual void UnsubscribeHost(const std::string &aHostName) = 0;
+    uint32_t GetHostSubscriptionCount(const std::string &aHostName) const;
 
     /**
      * This method sets the callbacks for subscriptions.
      *
-     * @param[in] aInstanceCallback     The callback function to receive discovered service instances.
-     * @param[in] aHostCallback         The callback function to receive discovered hosts.
+     * @param[in] aInstanceCallback         The callback function to receive discovered service instances.
+     * @param[in] aHostCallback             The callback function to receive discovered hosts.
+     * @param[in] aServiceNotFoundCallback  The callback function to receive services or service instances which
+     *                                      do not exist.
+     * @param[in] aHostNotFoundCallback     The callback function to receive hosts which do not exist.
      *
      */
     void SetSubscriptionCallbacks(DiscoveredServiceInstanceCallback aInstanceCallback,
-                                  DiscoveredHostCallback            aHostCallback)
+                                  DiscoveredHostCallback            aHostCallback,
+                                  ServiceNotFoundCallback           aServiceNotFoundCallback = nullptr,
+                                  HostNotFoundCallback              aHostNotFoundCallback    = nullptr)
     {
         mDiscoveredServiceInstanceCallback = std::move(aInstanceCallback);
         mDiscoveredHostCallback            = std::move(aHostCallback);
+        mServiceNotFoundCallback           = std::move(aServiceNotFoundCallback);
+        mHostNotFoundCallback              = std::move(aHostNotFoundCallback);
     }
 
     virtual ~Publisher(void) = default;
@@ -409,6 +541,30 @@ public:
      */
     static bool IsServiceTypeEqual(const char *aFirstType, const char *aSecondType);
 
+    /**
+     * This function makes the key to index a service by its instance name and type.
+     *
+     * Two services have the same key if and only if their names are equal and their types are equal as
+     * decided by `IsServiceTypeEqual()`.
+     *
+     * @param[in]  aName  The service instance name.
+     * @param[in]  aType  The service type.
+     *
+     * @returns  The key of the service.
+     *
+     */
+    static std::string MakeServiceKey(const char *aName, const char *aType);
+
+    /**
+     * This function sorts the addresses and removes duplicates, so that address lists compare equal as sets.
+     *
+     * @param[in]  aAddresses  The addresses.
+     *
+     * @returns  The sorted distinct addresses.
+     *
+     */
+    static AddressList MakeAddressSet(const AddressList &aAddresses);
+
     /**
      * This function writes the TXT entry list to a TXT data buffer.
      *
@@ -426,12 +582,165 @@ public:
      */
     static otbrError EncodeTxtData(const TxtList &aTxtList, uint8_t *aTxtData, uint16_t &aTxtLength);
 
+    /**
+     * This structure represents the statistics of the publications.
+     *
+     * A publication starts with `PublishService()` or `PublishHost()` and finishes when the publish handler is
+     * called, its latency covers the probing and conflict resolution of the mDNS daemon.
+     *
+     */
+    struct Stats
+    {
+        LatencyHistogram mServiceLatency;       ///< The latencies of service publications.
+        LatencyHistogram mHostLatency;          ///< The latencies of host publications.
+        uint32_t         mServicesInFlight = 0; ///< The number of service publications not finished yet.
+        uint32_t         mHostsInFlight    = 0; ///< The number of host publications not finished yet.
+        uint64_t         mFailures         = 0; ///< The number of publications reported failed by the handlers.
+        uint64_t         mConflicts        = 0; ///< The number of publications failed for name conflicts.
+        uint64_t         mRenames          = 0; ///< The number of services renamed for name conflicts.
+    };
+
+    /**
+     * This method returns the statistics of the publications.
+     *
+     * @returns  The statistics since the publisher was created or `ResetStats()` was called.
+     *
+     */
+    Stats GetStats(void) const;
+
+    /**
+     * This method resets the statistics of the publications.
+     *
+     * The publications in flight are kept.
+     *
+     */
+    void ResetStats(void);
+
 protected:
-    enum : uint8_t
+    enum : uint16_t
     {
-        kMaxTextEntrySize = 255,
+        kMaxTextEntrySize = 255,  ///< The max size of a TXT entry.
+        kMaxTxtDataSize   = 1024, ///< The max size of the TXT data encoded from a `TxtList`.
     };
 
+    /**
+     * This method starts the browse or resolve of a service or service instance.
+     *
+     * This method is called on the first subscription of the service or service instance, so the implementation
+     * never sees duplicate subscriptions.
+     *
+     * @param[in]  aType          The service type.
+     * @param[in]  aInstanceName  The service instance to resolve, or empty to browse the service.
+     *
+     */
+    virtual void StartServiceSubscription(const std::string &aType, const std::string &aInstanceName) = 0;
+
+    /**
+     * This method stops the browse or resolve of a service or service instance.
+     *
+     * This method is called when the last subscription of the service or service instance is removed.
+     *
+     * @param[in]  aType          The service type.
+     * @param[in]  aInstanceName  The service instance, or empty for the service.
+     *
+     */
+    virtual void StopServiceSubscription(const std::string &aType, const std::string &aInstanceName) = 0;
+
+    /**
+     * This method starts the resolve of a host.
+     *
+     * This method is called on the first subscription of the host.
+     *
+     * @param[in]  aHostName    The host name (without domain).
+     *
+     */
+    virtual void StartHostSubscription(const std::string &aHostName) = 0;
+
+    /**
+     * This method stops the resolve of a host.
+     *
+     * This method is called when the last subscription of the host is removed.
+     *
+     * @param[in]  aHostName    The host name (without domain).
+     *
+     */
+    virtual void StopHostSubscription(const std::string &aHostName) = 0;
+
+    /**
+     * This method records the start of a service publication.
+     *
+     * A service being published again before the publication finishes keeps its start time.
+     *
+     * @param[in]  aName  The name of the service.
+     * @param[in]  aType  The type of the service.
+     *
+     * @retval  true   This call started the publication, which the caller must cancel if it fails to publish.
+     * @retval  false  The publication was already in flight, a failure of the caller does not end it.
+     *
+     */
+    bool StartServicePublication(const char *aName, const char *aType);
+
+    /**
+     * This method drops a service publication which will never be reported by the publish handler.
+     *
+     * @param[in]  aName  The name of the service.
+     * @param[in]  aType  The type of the service.
+     *
+     */
+    void CancelServicePublication(const char *aName, const char *aType);
+
+    /**
+     * This method records the result of a service publication and calls the publish handler.
+     *
+     * @param[in]  aName   The name of the service.
+     * @param[in]  aType   The type of the service.
+     * @param[in]  aError  The result of the publication.
+     *
+     */
+    void FinishServicePublication(const char *aName, const char *aType, otbrError aError);
+
+    /**
+     * This method records the start of a host publication.
+     *
+     * A host being published again before the publication finishes keeps its start time.
+     *
+     * @param[in]  aName  The name of the host.
+     *
+     * @retval  true   This call started the publication, which the caller must cancel if it fails to publish.
+     * @retval  false  The publication was already in flight, a failure of the caller does not end it.
+     *
+     */
+    bool StartHostPublication(const char *aName);
+
+    /**
+     * This method drops a host publication which will never be reported by the publish handler.
+     *
+     * @param[in]  aName  The name of the host.
+     *
+     */
+    void CancelHostPublication(const char *aName);
+
+    /**
+     * This method records the result of a host publication and calls the publish handler.
+     *
+     * @param[in]  aName   The name of the host.
+     * @param[in]  aError  The result of the publication.
+     *
+     */
+    void FinishHostPublication(const char *aName, otbrError aError);
+
+    /**
+     * This method drops all publications in flight, e.g. when the mDNS daemon is gone.
+     *
+     */
+    void CancelAllPublications(void);
+
+    /**
+     * This method records that the mDNS daemon renamed a service for a name conflict.
+     *
+     */
+    void RecordServiceRename(void) { ++mStats.mRenames; }
+
     PublishServiceHandler mServiceHandler        = nullptr;
     void *                mServiceHandlerContext = nullptr;
 
@@ -440,6 +749,21 @@ protected:
 
     DiscoveredServiceInstanceCallback mDiscoveredServiceInstanceCallback = nullptr;
     DiscoveredHostCallback            mDiscoveredHostCallback            = nullptr;
+    ServiceNotFoundCallback           mServiceNotFoundCallback           = nullptr;
+    HostNotFoundCallback              mHostNotFoundCallback              = nullptr;
+
+private:
+    void FinishPublication(LatencyHistogram &                          aHistogram,
+                           std::unordered_map<std::string, Timepoint> &aStartTimes,
+                           const std::string &                         aKey,
+                           otbrError                                   aError);
+
+    std::unordered_map<std::string, uint32_t> mServiceSubscriptionCounts; // By `MakeServiceKey()`.
+    std::unordered_map<std::string, uint32_t> mHostSubscriptionCounts;    // By host name.
+
+    std::unordered_map<std::string, Timepoint> mServicePublicationTimes; // By `MakeServiceKey()`.
+    std::unordered_map<std::string, Timepoint> mHostPublicationTimes;    // By host name.
+    Stats                                      mStats;
 };
 
 /**
@@ -36,6 +36,7 @@
 #include "mdns/mdns_avahi.hpp"
 
 #include <algorithm>
+#include <iterator>
 
 #include <avahi-common/alternative.h>
 #include <avahi-common/error.h>
@@ -49,6 +50,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/time.hpp"
 #include "utils/strcpy_utils.hpp"
 
@@ -59,6 +61,8 @@ AvahiTimeout::AvahiTimeout(const struct timeval *aTimeout,
     : mCallback(aCallback)
     , mContext(aContext)
     , mPoller(aPoller)
+    , mHeapIndex(0)
+    , mSerial(0)
 {
     if (aTimeout)
     {
@@ -75,6 +79,7 @@ namespace otbr {
 namespace Mdns {
 
 Poller::Poller(void)
+    : mTimerSerial(0)
 {
     mAvahiPoller.userdata         = this;
     mAvahiPoller.watch_new        = WatchNew;
@@ -100,14 +105,25 @@ AvahiWatch *Poller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCallback
 {
     assert(aEvent && aCallback && aFd >= 0);
 
-    mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, this));
+    AvahiWatch *watch   = new AvahiWatch(aFd, aEvent, aCallback, aContext, this);
+    Watches &   watches = mWatches[aFd];
 
-    return mWatches.back();
+    if (watches.empty())
+    {
+        MainloopManager::GetInstance().RegisterFd(aFd, 0,
+                                                  [this, aFd](uint8_t aEvents) { HandleWatchFd(aFd, aEvents); });
+    }
+
+    watches.push_back(watch);
+    UpdateWatchFd(aFd);
+
+    return watch;
 }
 
 void Poller::WatchUpdate(AvahiWatch *aWatch, AvahiWatchEvent aEvent)
 {
     aWatch->mEvents = aEvent;
+    static_cast<Poller *>(aWatch->mPoller)->UpdateWatchFd(aWatch->mFd);
 }
 
 AvahiWatchEvent Poller::WatchGetEvents(AvahiWatch *aWatch)
@@ -122,15 +138,111 @@ void Poller::WatchFree(AvahiWatch *aWatch)
 
 void Poller::WatchFree(AvahiWatch &aWatch)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    int  fd = aWatch.mFd;
+    auto it = mWatches.find(fd);
+
+    VerifyOrExit(it != mWatches.end());
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), &aWatch), it->second.end());
+    delete &aWatch;
+
+    if (it->second.empty())
+    {
+        mWatches.erase(it);
+        MainloopManager::GetInstance().UnregisterFd(fd);
+    }
+    else
     {
-        if (*it == &aWatch)
+        UpdateWatchFd(fd);
+    }
+
+exit:
+    return;
+}
+
+void Poller::UpdateWatchFd(int aFd)
+{
+    auto    it     = mWatches.find(aFd);
+    uint8_t events = 0;
+
+    VerifyOrExit(it != mWatches.end());
+
+    // Avahi may create separate watches for the same file descriptor, e.g. for D-Bus reads and writes.
+    for (const AvahiWatch *watch : it->second)
+    {
+        if (AVAHI_WATCH_IN & watch->mEvents)
         {
-            mWatches.erase(it);
-            delete &aWatch;
-            break;
+            events |= MainloopManager::kEventReadable;
+        }
+
+        if (AVAHI_WATCH_OUT & watch->mEvents)
+        {
+            events |= MainloopManager::kEventWritable;
+        }
+
+        if (AVAHI_WATCH_ERR & watch->mEvents)
+        {
+            events |= MainloopManager::kEventError;
+        }
+    }
+
+    MainloopManager::GetInstance().UpdateFd(aFd, events);
+
+exit:
+    return;
+}
+
+void Poller::HandleWatchFd(int aFd, uint8_t aEvents)
+{
+    auto    it = mWatches.find(aFd);
+    Watches watches;
+
+    VerifyOrExit(it != mWatches.end());
+
+    // The callbacks may create or free watches.
+    watches = it->second;
+
+    for (AvahiWatch *watch : watches)
+    {
+        it = mWatches.find(aFd);
+        VerifyOrExit(it != mWatches.end());
+
+        if (std::find(it->second.begin(), it->second.end(), watch) == it->second.end())
+        {
+            continue;
+        }
+
+        watch->mHappened = 0;
+
+        if ((AVAHI_WATCH_IN & watch->mEvents) && (aEvents & MainloopManager::kEventReadable))
+        {
+            watch->mHappened |= AVAHI_WATCH_IN;
+        }
+
+        if ((AVAHI_WATCH_OUT & watch->mEvents) && (aEvents & MainloopManager::kEventWritable))
+        {
+            watch->mHappened |= AVAHI_WATCH_OUT;
+        }
+
+        if ((AVAHI_WATCH_ERR & watch->mEvents) && (aEvents & MainloopManager::kEventError))
+        {
+            watch->mHappened |= AVAHI_WATCH_ERR;
+        }
+
+        // Like `poll()`, hang-ups are reported to every watch so that Avahi can drop the connection, instead of
+        // spinning on a file descriptor which never becomes readable again.
+        if (aEvents & MainloopManager::kEventHangup)
+        {
+            watch->mHappened |= AVAHI_WATCH_HUP;
+        }
+
+        if (watch->mHappened)
+        {
+            watch->mCallback(watch, watch->mFd, static_cast<AvahiWatchEvent>(watch->mHappened), watch->mContext);
         }
     }
+
+exit:
+    return;
 }
 
 AvahiTimeout *Poller::TimeoutNew(const AvahiPoll *     aPoller,
@@ -144,19 +256,36 @@ AvahiTimeout *Poller::TimeoutNew(const AvahiPoll *     aPoller,
 
 AvahiTimeout *Poller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
 {
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, this));
-    return mTimers.back();
+    AvahiTimeout *timer = new AvahiTimeout(aTimeout, aCallback, aContext, this);
+
+    if (timer->mTimeout != Timepoint::min())
+    {
+        HeapPush(*timer);
+    }
+
+    return timer;
 }
 
 void Poller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
 {
+    static_cast<Poller *>(aTimer->mPoller)->TimeoutUpdate(*aTimer, aTimeout);
+}
+
+void Poller::TimeoutUpdate(AvahiTimeout &aTimer, const struct timeval *aTimeout)
+{
+    if (aTimer.mTimeout != Timepoint::min())
+    {
+        HeapRemove(aTimer);
+    }
+
     if (aTimeout == nullptr)
     {
-        aTimer->mTimeout = Timepoint::min();
+        aTimer.mTimeout = Timepoint::min();
     }
     else
     {
-        aTimer->mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        aTimer.mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        HeapPush(aTimer);
     }
 }
 
@@ -167,130 +296,156 @@ void Poller::TimeoutFree(AvahiTimeout *aTimer)
 
 void Poller::TimeoutFree(AvahiTimeout &aTimer)
 {
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    if (aTimer.mTimeout != Timepoint::min())
     {
-        if (*it == &aTimer)
-        {
-            mTimers.erase(it);
-            delete &aTimer;
-            break;
-        }
+        HeapRemove(aTimer);
     }
+
+    delete &aTimer;
 }
 
-void Poller::Update(MainloopContext &aMainloop)
+void Poller::HeapPush(AvahiTimeout &aTimer)
 {
-    Timepoint now = Clock::now();
-
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
-    {
-        int             fd     = (*it)->mFd;
-        AvahiWatchEvent events = (*it)->mEvents;
-
-        if (AVAHI_WATCH_IN & events)
-        {
-            FD_SET(fd, &aMainloop.mReadFdSet);
-        }
+    aTimer.mSerial    = mTimerSerial++;
+    aTimer.mHeapIndex = mTimerHeap.size();
+    mTimerHeap.push_back(&aTimer);
+    HeapSiftUp(aTimer.mHeapIndex);
+}
 
-        if (AVAHI_WATCH_OUT & events)
-        {
-            FD_SET(fd, &aMainloop.mWriteFdSet);
-        }
+void Poller::HeapRemove(AvahiTimeout &aTimer)
+{
+    size_t        index = aTimer.mHeapIndex;
+    AvahiTimeout *last  = mTimerHeap.back();
 
-        if (AVAHI_WATCH_ERR & events)
-        {
-            FD_SET(fd, &aMainloop.mErrorFdSet);
-        }
+    assert(index < mTimerHeap.size() && mTimerHeap[index] == &aTimer);
 
-        if (AVAHI_WATCH_HUP & events)
-        {
-            // TODO what do with this event type?
-        }
+    mTimerHeap.pop_back();
+    VerifyOrExit(last != &aTimer);
 
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+    // Fill the hole with the last timer, which may belong either above or below it.
+    mTimerHeap[index] = last;
+    last->mHeapIndex  = index;
 
-        (*it)->mHappened = 0;
+    if (index > 0 && HeapLess(index, (index - 1) / 2))
+    {
+        HeapSiftUp(index);
     }
-
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    else
     {
-        Timepoint timeout = (*it)->mTimeout;
+        HeapSiftDown(index);
+    }
 
-        if (timeout == Timepoint::min())
-        {
-            continue;
-        }
+exit:
+    return;
+}
 
-        if (timeout <= now)
-        {
-            aMainloop.mTimeout = ToTimeval(Microseconds::zero());
-            break;
-        }
-        else
-        {
-            auto delay = std::chrono::duration_cast<Microseconds>(timeout - now);
+bool Poller::HeapLess(size_t aLeft, size_t aRight) const
+{
+    const AvahiTimeout &left  = *mTimerHeap[aLeft];
+    const AvahiTimeout &right = *mTimerHeap[aRight];
 
-            if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
-            {
-                aMainloop.mTimeout = ToTimeval(delay);
-            }
-        }
-    }
+    return left.mTimeout < right.mTimeout || (left.mTimeout == right.mTimeout && left.mSerial < right.mSerial);
 }
 
-void Poller::Process(const MainloopContext &aMainloop)
+void Poller::HeapSwap(size_t aLeft, size_t aRight)
 {
-    Timepoint                   now = Clock::now();
-    std::vector<AvahiTimeout *> expired;
+    std::swap(mTimerHeap[aLeft], mTimerHeap[aRight]);
+    mTimerHeap[aLeft]->mHeapIndex  = aLeft;
+    mTimerHeap[aRight]->mHeapIndex = aRight;
+}
 
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+void Poller::HeapSiftUp(size_t aIndex)
+{
+    while (aIndex > 0)
     {
-        int             fd     = (*it)->mFd;
-        AvahiWatchEvent events = (*it)->mEvents;
+        size_t parent = (aIndex - 1) / 2;
 
-        (*it)->mHappened = 0;
+        VerifyOrExit(HeapLess(aIndex, parent));
+        HeapSwap(aIndex, parent);
+        aIndex = parent;
+    }
 
-        if ((AVAHI_WATCH_IN & events) && FD_ISSET(fd, &aMainloop.mReadFdSet))
-        {
-            (*it)->mHappened |= AVAHI_WATCH_IN;
-        }
+exit:
+    return;
+}
 
-        if ((AVAHI_WATCH_OUT & events) && FD_ISSET(fd, &aMainloop.mWriteFdSet))
-        {
-            (*it)->mHappened |= AVAHI_WATCH_OUT;
-        }
+void Poller::HeapSiftDown(size_t aIndex)
+{
+    while (true)
+    {
+        size_t smallest = aIndex;
+        size_t left     = 2 * aIndex + 1;
+        size_t right    = left + 1;
 
-        if ((AVAHI_WATCH_ERR & events) && FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        if (left < mTimerHeap.size() && HeapLess(left, smallest))
         {
-            (*it)->mHappened |= AVAHI_WATCH_ERR;
+            smallest = left;
         }
 
-        // TODO hup events
-        if ((*it)->mHappened)
+        if (right < mTimerHeap.size() && HeapLess(right, smallest))
         {
-            (*it)->mCallback(*it, (*it)->mFd, static_cast<AvahiWatchEvent>((*it)->mHappened), (*it)->mContext);
+            smallest = right;
         }
+
+        VerifyOrExit(smallest != aIndex);
+        HeapSwap(aIndex, smallest);
+        aIndex = smallest;
     }
 
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+exit:
+    return;
+}
+
+void Poller::Update(MainloopContext &aMainloop)
+{
+    Timepoint now = MainloopManager::GetInstance().GetNow();
+    Timepoint timeout;
+
+    VerifyOrExit(!mTimerHeap.empty());
+
+    timeout = mTimerHeap.front()->mTimeout;
+
+    if (timeout <= now)
     {
-        if ((*it)->mTimeout == Timepoint::min())
-        {
-            continue;
-        }
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+    else
+    {
+        auto delay = std::chrono::duration_cast<Microseconds>(timeout - now);
 
-        if ((*it)->mTimeout <= now)
+        if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
         {
-            expired.push_back(*it);
+            aMainloop.mTimeout = ToTimeval(delay);
         }
     }
 
-    for (std::vector<AvahiTimeout *>::iterator it = expired.begin(); it != expired.end(); ++it)
+exit:
+    return;
+}
+
+void Poller::Process(const MainloopContext &aMainloop)
+{
+    Timepoint now    = MainloopManager::GetInstance().GetNow();
+    uint64_t  serial = mTimerSerial;
+
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    // Callbacks may re-arm or free any timer. Timers armed by callbacks are left to the next iteration, so that a
+    // callback re-arming itself with a zero timeout cannot starve the mainloop.
+    while (!mTimerHeap.empty())
     {
-        AvahiTimeout *avahiTimeout = *it;
+        AvahiTimeout *timer = mTimerHeap.front();
 
-        avahiTimeout->mCallback(avahiTimeout, avahiTimeout->mContext);
+        VerifyOrExit(timer->mTimeout <= now && timer->mSerial < serial);
+
+        // Like the pollers of avahi, a timeout is disarmed when it fires.
+        HeapRemove(*timer);
+        timer->mTimeout = Timepoint::min();
+        timer->mCallback(timer, timer->mContext);
     }
+
+exit:
+    return;
 }
 
 PublisherAvahi::PublisherAvahi(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext)
@@ -301,6 +456,18 @@ PublisherAvahi::PublisherAvahi(int aProtocol, const char *aDomain, StateHandler
     , mState(State::kIdle)
     , mStateHandler(aHandler)
     , mContext(aContext)
+    , mServicesMemory("otbr_mdns_services",
+                      "Services published by the mDNS publisher.",
+                      "otbr_mdns_services_memory_bytes",
+                      "Estimated memory of the services published by the mDNS publisher.",
+                      [this](size_t &aNumEntries, size_t &aNumBytes) {
+                          EstimateServicesMemory(aNumEntries, aNumBytes);
+                      })
+    , mHostsMemory("otbr_mdns_hosts",
+                   "Hosts published by the mDNS publisher.",
+                   "otbr_mdns_hosts_memory_bytes",
+                   "Estimated memory of the hosts published by the mDNS publisher.",
+                   [this](size_t &aNumEntries, size_t &aNumBytes) { EstimateHostsMemory(aNumEntries, aNumBytes); })
 {
 }
 
@@ -354,6 +521,18 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
 
 void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState)
 {
+    if (mResettingGroups.count(aGroup) != 0)
+    {
+        // Only the confirmation of the reset is expected, earlier state changes are of the previous records.
+        if (aState == AVAHI_ENTRY_GROUP_UNCOMMITED)
+        {
+            mResettingGroups.erase(aGroup);
+            mFreeGroups.push_back(aGroup);
+        }
+
+        ExitNow();
+    }
+
     otbrLogInfo("Avahi group change to state %d.", aState);
 
     /* Called whenever the entry group state changes */
@@ -385,29 +564,37 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
         assert(false);
         break;
     }
+
+exit:
+    return;
 }
 
-void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError) const
+void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError)
 {
-    if (mHostHandler != nullptr)
     {
-        const auto hostIt =
-            std::find_if(mHosts.begin(), mHosts.end(), [aGroup](const Host &aHost) { return aHost.mGroup == aGroup; });
+        const auto hostIt = mHostGroups.find(aGroup);
 
-        if (hostIt != mHosts.end())
+        if (hostIt != mHostGroups.end())
         {
-            mHostHandler(hostIt->mHostName.c_str(), aError, mHostHandlerContext);
+            std::string hostName = hostIt->second->mHostName;
+
+            FinishHostPublication(hostName.c_str(), aError);
         }
     }
 
-    if (mServiceHandler != nullptr)
     {
-        const auto serviceIt = std::find_if(mServices.begin(), mServices.end(),
-                                            [aGroup](const Service &aService) { return aService.mGroup == aGroup; });
+        const auto                                       range = mServiceGroups.equal_range(aGroup);
+        std::vector<std::pair<std::string, std::string>> services;
 
-        if (serviceIt != mServices.end())
+        // The entry group of a host may hold several services, which may change in the handler.
+        for (auto it = range.first; it != range.second; ++it)
         {
-            mServiceHandler(serviceIt->mName.c_str(), serviceIt->mType.c_str(), aError, mServiceHandlerContext);
+            services.emplace_back(it->second->mName, it->second->mType);
+        }
+
+        for (const auto &service : services)
+        {
+            FinishServicePublication(service.first.c_str(), service.second.c_str(), aError);
         }
     }
 }
@@ -416,8 +603,16 @@ PublisherAvahi::Hosts::iterator PublisherAvahi::FindHost(const char *aHostName)
 {
     assert(aHostName != nullptr);
 
-    return std::find_if(mHosts.begin(), mHosts.end(),
-                        [aHostName](const Host &aHost) { return aHost.mHostName == aHostName; });
+    InternedName hostName;
+    auto         it = mHostIndex.end();
+
+    // A host name which isn't interned can't be in the index.
+    if (NamePool::Get().Find(aHostName, hostName))
+    {
+        it = mHostIndex.find(hostName);
+    }
+
+    return it != mHostIndex.end() ? it->second : mHosts.end();
 }
 
 otbrError PublisherAvahi::CreateHost(AvahiClient &aClient, const char *aHostName, Hosts::iterator &aOutHostIt)
@@ -431,20 +626,29 @@ otbrError PublisherAvahi::CreateHost(AvahiClient &aClient, const char *aHostName
     SuccessOrExit(error = CreateGroup(aClient, newHost.mGroup));
 
     mHosts.push_back(newHost);
-    aOutHostIt = mHosts.end() - 1;
+    aOutHostIt = std::prev(mHosts.end());
+    mHostIndex.emplace(newHost.mHostName, aOutHostIt);
+    mHostGroups.emplace(newHost.mGroup, aOutHostIt);
 
 exit:
     return error;
 }
 
+void PublisherAvahi::EraseHost(Hosts::iterator aHostIt)
+{
+    mHostIndex.erase(aHostIt->mHostName);
+    mHostGroups.erase(aHostIt->mGroup);
+    mHosts.erase(aHostIt);
+}
+
 PublisherAvahi::Services::iterator PublisherAvahi::FindService(const char *aName, const char *aType)
 {
     assert(aName != nullptr);
     assert(aType != nullptr);
 
-    return std::find_if(mServices.begin(), mServices.end(), [aName, aType](const Service &aService) {
-        return aService.mName == aName && aService.mType == aType;
-    });
+    auto it = mServiceIndex.find(MakeServiceKey(aName, aType));
+
+    return it != mServiceIndex.end() ? it->second : mServices.end();
 }
 
 otbrError PublisherAvahi::CreateService(AvahiClient &       aClient,
@@ -462,19 +666,52 @@ otbrError PublisherAvahi::CreateService(AvahiClient &       aClient,
     newService.mType = aType;
     SuccessOrExit(error = CreateGroup(aClient, newService.mGroup));
 
-    mServices.push_back(newService);
-    aOutServiceIt = mServices.end() - 1;
+    aOutServiceIt = InsertService(std::move(newService));
 
 exit:
     return error;
 }
 
+PublisherAvahi::Services::iterator PublisherAvahi::InsertService(Service &&aService)
+{
+    Services::iterator serviceIt = mServices.insert(mServices.end(), std::move(aService));
+
+    mServiceIndex.emplace(MakeServiceKey(serviceIt->mName.c_str(), serviceIt->mType.c_str()), serviceIt);
+    mServiceGroups.emplace(serviceIt->mGroup, serviceIt);
+
+    return serviceIt;
+}
+
+void PublisherAvahi::EraseService(Services::iterator aServiceIt)
+{
+    auto range = mServiceGroups.equal_range(aServiceIt->mGroup);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == aServiceIt)
+        {
+            mServiceGroups.erase(it);
+            break;
+        }
+    }
+
+    mServiceIndex.erase(MakeServiceKey(aServiceIt->mName.c_str(), aServiceIt->mType.c_str()));
+    mServices.erase(aServiceIt);
+}
+
 otbrError PublisherAvahi::CreateGroup(AvahiClient &aClient, AvahiEntryGroup *&aOutGroup)
 {
     otbrError error = OTBR_ERROR_NONE;
 
     assert(aOutGroup == nullptr);
 
+    if (!mFreeGroups.empty())
+    {
+        aOutGroup = mFreeGroups.back();
+        mFreeGroups.pop_back();
+        ExitNow();
+    }
+
     aOutGroup = avahi_entry_group_new(&aClient, HandleGroupState, this);
     VerifyOrExit(aOutGroup != nullptr, error = OTBR_ERROR_MDNS);
 
@@ -503,6 +740,31 @@ otbrError PublisherAvahi::ResetGroup(AvahiEntryGroup *aGroup)
     return error;
 }
 
+otbrError PublisherAvahi::ReleaseGroup(AvahiEntryGroup *aGroup)
+{
+    assert(aGroup != nullptr);
+
+    otbrError error = OTBR_ERROR_NONE;
+
+    // avahi-daemon confirms the reset of an established group with the uncommitted state. Groups in other states may
+    // have state changes pending or get no confirmation, so they are freed.
+    VerifyOrExit(avahi_entry_group_get_state(aGroup) == AVAHI_ENTRY_GROUP_ESTABLISHED &&
+                     mResettingGroups.size() + mFreeGroups.size() < kMaxPooledGroups,
+                 error = FreeGroup(aGroup));
+
+    // The group is tracked before the reset, in case the confirmation is reported synchronously.
+    mResettingGroups.insert(aGroup);
+
+    if (ResetGroup(aGroup) != OTBR_ERROR_NONE)
+    {
+        mResettingGroups.erase(aGroup);
+        error = FreeGroup(aGroup);
+    }
+
+exit:
+    return error;
+}
+
 otbrError PublisherAvahi::FreeGroup(AvahiEntryGroup *aGroup)
 {
     assert(aGroup != nullptr);
@@ -523,10 +785,16 @@ void PublisherAvahi::FreeAllGroups(void)
 {
     for (Service &service : mServices)
     {
-        FreeGroup(service.mGroup);
+        // The entry groups of hosts are freed with the hosts.
+        if (!service.mInHostGroup)
+        {
+            FreeGroup(service.mGroup);
+        }
     }
 
     mServices.clear();
+    mServiceIndex.clear();
+    mServiceGroups.clear();
 
     for (Host &host : mHosts)
     {
@@ -534,6 +802,23 @@ void PublisherAvahi::FreeAllGroups(void)
     }
 
     mHosts.clear();
+    mHostIndex.clear();
+    mHostGroups.clear();
+
+    for (AvahiEntryGroup *group : mResettingGroups)
+    {
+        FreeGroup(group);
+    }
+
+    for (AvahiEntryGroup *group : mFreeGroups)
+    {
+        FreeGroup(group);
+    }
+
+    mResettingGroups.clear();
+    mFreeGroups.clear();
+
+    CancelAllPublications();
 }
 
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState)
@@ -592,60 +877,109 @@ void PublisherAvahi::Process(const MainloopContext &aMainloop)
     mPoller.Process(aMainloop);
 }
 
+otbrError PublisherAvahi::TxtDataToAvahiStringList(const TxtData &   aTxtData,
+                                                   AvahiStringList * aBuffer,
+                                                   size_t            aBufferSize,
+                                                   AvahiStringList *&aHead)
+{
+    otbrError        error = OTBR_ERROR_NONE;
+    AvahiStringList *last  = nullptr;
+    AvahiStringList *curr  = aBuffer;
+    size_t           used  = 0;
+    const uint8_t *  cur   = aTxtData.mData;
+    const uint8_t *  end   = aTxtData.mData + aTxtData.mLength;
+
+    while (cur < end)
+    {
+        size_t entryLength = *cur++;
+        // avahi doesn't need '\0' at the end of the entry
+        size_t needed = sizeof(AvahiStringList) - sizeof(AvahiStringList::text) + entryLength;
+
+        VerifyOrExit(entryLength <= static_cast<size_t>(end - cur), error = OTBR_ERROR_INVALID_ARGS);
+
+        // An empty string is what an empty TXT record consists of, avahi adds it back for an empty list.
+        if (entryLength == 0)
+        {
+            continue;
+        }
+
+        VerifyOrExit(used + needed <= aBufferSize, errno = EMSGSIZE, error = OTBR_ERROR_ERRNO);
+        curr->next = last;
+        last       = curr;
+        memcpy(curr->text, cur, entryLength);
+        curr->size = entryLength;
+        cur += entryLength;
+        {
+            const uint8_t *next = curr->text + curr->size;
+            curr                = OTBR_ALIGNED(next, AvahiStringList *);
+        }
+        used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(aBuffer));
+    }
+
+    aHead = last;
+
+exit:
+    return error;
+}
+
 otbrError PublisherAvahi::PublishService(const char *   aHostName,
                                          uint16_t       aPort,
                                          const char *   aName,
                                          const char *   aType,
-                                         const TxtList &aTxtList)
+                                         const TxtData &aTxtData)
 {
     otbrError          error        = OTBR_ERROR_NONE;
     int                avahiError   = 0;
     Services::iterator serviceIt    = mServices.end();
     const char *       safeHostName = (aHostName != nullptr) ? aHostName : "";
     const char *       logHostName  = (aHostName != nullptr) ? aHostName : "localhost";
+    bool               started      = false;
     std::string        fullHostName;
     // aligned with AvahiStringList
     AvahiStringList  buffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
-    AvahiStringList *last = nullptr;
-    AvahiStringList *curr = buffer;
-    size_t           used = 0;
+    AvahiStringList *txtHead = nullptr;
 
     VerifyOrExit(mState == State::kReady, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
     VerifyOrExit(mClient != nullptr, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
     VerifyOrExit(aName != nullptr, error = OTBR_ERROR_INVALID_ARGS);
     VerifyOrExit(aType != nullptr, error = OTBR_ERROR_INVALID_ARGS);
 
+    started = StartServicePublication(aName, aType);
+
+    if (IsBatching(aHostName))
+    {
+        BatchService service;
+
+        service.mName      = aName;
+        service.mType      = aType;
+        service.mPort      = aPort;
+        service.mTxtOffset = mBatch.mTxtArena.size();
+        service.mTxtLength = aTxtData.mLength;
+        mBatch.mTxtArena.insert(mBatch.mTxtArena.end(), aTxtData.mData, aTxtData.mData + aTxtData.mLength);
+
+        mBatch.mServices.push_back(std::move(service));
+        ExitNow();
+    }
+
     if (aHostName != nullptr)
     {
         fullHostName = MakeFullName(aHostName);
         aHostName    = fullHostName.c_str();
     }
 
-    for (const auto &txtEntry : aTxtList)
-    {
-        const char *   name        = txtEntry.mName.c_str();
-        size_t         nameLength  = txtEntry.mName.length();
-        const uint8_t *value       = txtEntry.mValue.data();
-        size_t         valueLength = txtEntry.mValue.size();
-        // +1 for the size of "=", avahi doesn't need '\0' at the end of the entry
-        size_t needed = sizeof(AvahiStringList) - sizeof(AvahiStringList::text) + nameLength + valueLength + 1;
-
-        VerifyOrExit(used + needed <= sizeof(buffer), errno = EMSGSIZE, error = OTBR_ERROR_ERRNO);
-        curr->next = last;
-        last       = curr;
-        memcpy(curr->text, name, nameLength);
-        curr->text[nameLength] = '=';
-        memcpy(curr->text + nameLength + 1, value, valueLength);
-        curr->size = nameLength + valueLength + 1;
-        {
-            const uint8_t *next = curr->text + curr->size;
-            curr                = OTBR_ALIGNED(next, AvahiStringList *);
-        }
-        used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(buffer));
-    }
+    SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, buffer, sizeof(buffer), txtHead));
 
     serviceIt = FindService(aName, aType);
 
+    if (serviceIt != mServices.end() && serviceIt->mInHostGroup &&
+        (serviceIt->mHostName != safeHostName || serviceIt->mPort != aPort))
+    {
+        // The service moves out of the entry group of its host.
+        error     = RemoveFromHostGroup(serviceIt);
+        serviceIt = mServices.end();
+        SuccessOrExit(error);
+    }
+
     if (serviceIt == mServices.end())
     {
         SuccessOrExit(error = CreateService(*mClient, aName, aType, serviceIt));
@@ -656,13 +990,28 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
     }
     else
     {
-        otbrLogInfo("Update service %s.%s for host %s", aName, aType, logHostName);
-        avahiError = avahi_entry_group_update_service_txt_strlst(serviceIt->mGroup, AVAHI_IF_UNSPEC, mProtocol,
-                                                                 AvahiPublishFlags{}, aName, aType, mDomain, last);
-        if (avahiError == 0 && mServiceHandler != nullptr)
+        if (aTxtData.Equals(serviceIt->mTxtData))
+        {
+            // Updating unchanged TXT data would announce the record again and flush the caches for nothing.
+            otbrLogInfo("Service %s.%s for host %s is unchanged", aName, aType, logHostName);
+        }
+        else
+        {
+            otbrLogInfo("Update service %s.%s for host %s", aName, aType, logHostName);
+            avahiError = avahi_entry_group_update_service_txt_strlst(serviceIt->mGroup, AVAHI_IF_UNSPEC, mProtocol,
+                                                                     AvahiPublishFlags{}, aName, aType, mDomain,
+                                                                     txtHead);
+        }
+
+        if (avahiError == 0)
+        {
+            serviceIt->mTxtData.assign(aTxtData.mData, aTxtData.mData + aTxtData.mLength);
+        }
+
+        if (avahiError == 0)
         {
             // The handler should be called even if the request can be processed synchronously
-            mServiceHandler(aName, aType, OTBR_ERROR_NONE, mServiceHandlerContext);
+            FinishServicePublication(aName, aType, OTBR_ERROR_NONE);
         }
         ExitNow();
     }
@@ -670,7 +1019,7 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
     otbrLogInfo("Create service %s.%s for host %s", aName, aType, logHostName);
     avahiError =
         avahi_entry_group_add_service_strlst(serviceIt->mGroup, AVAHI_IF_UNSPEC, mProtocol, AvahiPublishFlags{}, aName,
-                                             aType, mDomain, aHostName, aPort, last);
+                                             aType, mDomain, aHostName, aPort, txtHead);
     SuccessOrExit(avahiError);
 
     otbrLogInfo("Commit service %s.%s", aName, aType);
@@ -679,6 +1028,7 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
 
     serviceIt->mHostName = safeHostName;
     serviceIt->mPort     = aPort;
+    serviceIt->mTxtData.assign(aTxtData.mData, aTxtData.mData + aTxtData.mLength);
 
 exit:
 
@@ -692,10 +1042,18 @@ exit:
         otbrLogErr("Failed to publish service: %s!", otbrErrorString(error));
     }
 
-    if (error != OTBR_ERROR_NONE && serviceIt != mServices.end())
+    if (error != OTBR_ERROR_NONE && serviceIt != mServices.end() && !serviceIt->mInHostGroup)
+    {
+        ReleaseGroup(serviceIt->mGroup);
+        EraseService(serviceIt);
+
+        // A publication in flight is gone with the service.
+        started = true;
+    }
+
+    if (error != OTBR_ERROR_NONE && started)
     {
-        FreeGroup(serviceIt->mGroup);
-        mServices.erase(serviceIt);
+        CancelServicePublication(aName, aType);
     }
 
     return error;
@@ -709,30 +1067,57 @@ otbrError PublisherAvahi::UnpublishService(const char *aName, const char *aType)
     VerifyOrExit(aName != nullptr, error = OTBR_ERROR_INVALID_ARGS);
     VerifyOrExit(aType != nullptr, error = OTBR_ERROR_INVALID_ARGS);
 
+    CancelServicePublication(aName, aType);
+
     serviceIt = FindService(aName, aType);
     VerifyOrExit(serviceIt != mServices.end());
 
     otbrLogInfo("Unpublish service %s.%s", aName, aType);
-    error = FreeGroup(serviceIt->mGroup);
-    mServices.erase(serviceIt);
+
+    if (!serviceIt->mInHostGroup)
+    {
+        error = ReleaseGroup(serviceIt->mGroup);
+        EraseService(serviceIt);
+    }
+    else if (IsBatching(serviceIt->mHostName.c_str()))
+    {
+        // The entry group of the host is rebuilt when the batch is committed.
+        EraseService(serviceIt);
+        mBatch.mRebuild = true;
+    }
+    else
+    {
+        error = RemoveFromHostGroup(serviceIt);
+    }
 
 exit:
     return error;
 }
 
-otbrError PublisherAvahi::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
+otbrError PublisherAvahi::PublishHost(const char *aName, const AddressList &aAddresses)
 {
     otbrError       error      = OTBR_ERROR_NONE;
     int             avahiError = 0;
     Hosts::iterator hostIt     = mHosts.end();
+    bool            started    = false;
     std::string     fullHostName;
-    AvahiAddress    address;
+    AddressList     addresses;
 
     VerifyOrExit(mState == State::kReady, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
     VerifyOrExit(mClient != nullptr, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
     VerifyOrExit(aName != nullptr, error = OTBR_ERROR_INVALID_ARGS);
-    VerifyOrExit(aAddress != nullptr, error = OTBR_ERROR_INVALID_ARGS);
-    VerifyOrExit(aAddressLength == sizeof(address.data.ipv6.address), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(!aAddresses.empty(), error = OTBR_ERROR_INVALID_ARGS);
+
+    addresses = MakeAddressSet(aAddresses);
+
+    started = StartHostPublication(aName);
+
+    if (IsBatching(aName))
+    {
+        mBatch.mHasAddresses = true;
+        mBatch.mAddresses    = std::move(addresses);
+        ExitNow();
+    }
 
     fullHostName = MakeFullName(aName);
     hostIt       = FindHost(aName);
@@ -741,34 +1126,33 @@ otbrError PublisherAvahi::PublishHost(const char *aName, const uint8_t *aAddress
     {
         SuccessOrExit(error = CreateHost(*mClient, aName, hostIt));
     }
-    else if (memcmp(hostIt->mAddress.data.ipv6.address, aAddress, aAddressLength))
+    else if (hostIt->mAddresses == addresses)
     {
-        SuccessOrExit(error = ResetGroup(hostIt->mGroup));
+        // The handler should be called even if the request can be processed synchronously
+        FinishHostPublication(aName, OTBR_ERROR_NONE);
+        ExitNow();
+    }
+    else if (mServiceGroups.count(hostIt->mGroup) != 0)
+    {
+        // The services in the entry group of the host have to be added again.
+        hostIt->mAddresses = std::move(addresses);
+        ExitNow(error = RebuildHostGroup(*hostIt));
     }
     else
     {
-        if (mHostHandler != nullptr)
-        {
-            // The handler should be called even if the request can be processed synchronously
-            mHostHandler(aName, OTBR_ERROR_NONE, mHostHandlerContext);
-        }
-        ExitNow();
+        // Records cannot be removed from a committed entry group, so the whole record set is published again.
+        SuccessOrExit(error = ResetGroup(hostIt->mGroup));
     }
 
-    address.proto = AVAHI_PROTO_INET6;
-    memcpy(&address.data.ipv6.address[0], aAddress, aAddressLength);
+    hostIt->mAddresses = std::move(addresses);
 
     otbrLogInfo("Create host %s", aName);
-    avahiError = avahi_entry_group_add_address(hostIt->mGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_INET6,
-                                               AVAHI_PUBLISH_NO_REVERSE, fullHostName.c_str(), &address);
-    SuccessOrExit(avahiError);
+    SuccessOrExit(error = AddAddressesToGroup(hostIt->mGroup, *hostIt, fullHostName.c_str()));
 
     otbrLogInfo("Commit host %s", aName);
     avahiError = avahi_entry_group_commit(hostIt->mGroup);
     SuccessOrExit(avahiError);
 
-    hostIt->mAddress = address;
-
 exit:
 
     if (avahiError)
@@ -783,8 +1167,15 @@ exit:
 
     if (error != OTBR_ERROR_NONE && hostIt != mHosts.end())
     {
-        FreeGroup(hostIt->mGroup);
-        mHosts.erase(hostIt);
+        DropHost(hostIt);
+
+        // A publication in flight is gone with the host.
+        started = true;
+    }
+
+    if (error != OTBR_ERROR_NONE && started)
+    {
+        CancelHostPublication(aName);
     }
 
     return error;
@@ -797,17 +1188,336 @@ otbrError PublisherAvahi::UnpublishHost(const char *aName)
 
     VerifyOrExit(aName != nullptr, error = OTBR_ERROR_INVALID_ARGS);
 
+    CancelHostPublication(aName);
+
+    if (IsBatching(aName))
+    {
+        mBatch.mHasAddresses = false;
+    }
+
     hostIt = FindHost(aName);
     VerifyOrExit(hostIt != mHosts.end());
 
     otbrLogInfo("Delete host %s", aName);
-    error = FreeGroup(hostIt->mGroup);
-    mHosts.erase(hostIt);
+    error = DropHost(hostIt);
 
 exit:
     return error;
 }
 
+void PublisherAvahi::BeginBatch(const char *aHostName)
+{
+    assert(aHostName != nullptr);
+    assert(!mBatch.mActive);
+
+    mBatch           = Batch();
+    mBatch.mActive   = true;
+    mBatch.mHostName = aHostName;
+}
+
+otbrError PublisherAvahi::CommitBatch(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    Batch     batch = std::move(mBatch);
+
+    assert(batch.mActive);
+    mBatch = Batch();
+
+    if (batch.mHasAddresses)
+    {
+        ExitNow(error = CommitHostGroup(batch));
+    }
+
+    // Without the host, the services are published on their own.
+    for (const BatchService &service : batch.mServices)
+    {
+        SuccessOrExit(error = PublishService(batch.mHostName.c_str(), service.mPort, service.mName.c_str(),
+                                             service.mType.c_str(), batch.GetTxtData(service)));
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        CancelHostPublication(batch.mHostName.c_str());
+
+        for (const BatchService &service : batch.mServices)
+        {
+            CancelServicePublication(service.mName.c_str(), service.mType.c_str());
+        }
+    }
+
+    return error;
+}
+
+bool PublisherAvahi::IsBatching(const char *aHostName) const
+{
+    return mBatch.mActive && aHostName != nullptr && mBatch.mHostName == aHostName;
+}
+
+otbrError PublisherAvahi::CommitHostGroup(Batch &aBatch)
+{
+    otbrError       error  = OTBR_ERROR_NONE;
+    Hosts::iterator hostIt = mHosts.end();
+
+    VerifyOrExit(mState == State::kReady, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(mClient != nullptr, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
+
+    hostIt = FindHost(aBatch.mHostName.c_str());
+
+    if (hostIt != mHosts.end() && IsTxtUpdate(*hostIt, aBatch))
+    {
+        ExitNow(error = UpdateHostGroupTxt(*hostIt, aBatch));
+    }
+
+    if (hostIt == mHosts.end())
+    {
+        SuccessOrExit(error = CreateHost(*mClient, aBatch.mHostName.c_str(), hostIt));
+    }
+
+    hostIt->mAddresses = aBatch.mAddresses;
+
+    for (BatchService &service : aBatch.mServices)
+    {
+        TxtData            txtData   = aBatch.GetTxtData(service);
+        Services::iterator serviceIt = FindService(service.mName.c_str(), service.mType.c_str());
+
+        if (serviceIt != mServices.end())
+        {
+            if (!serviceIt->mInHostGroup)
+            {
+                ReleaseGroup(serviceIt->mGroup);
+                EraseService(serviceIt);
+            }
+            else if (serviceIt->mGroup == hostIt->mGroup)
+            {
+                EraseService(serviceIt);
+            }
+            else
+            {
+                // The service moves from the entry group of another host.
+                SuccessOrExit(error = RemoveFromHostGroup(serviceIt));
+            }
+        }
+
+        service.mHostName    = aBatch.mHostName;
+        service.mGroup       = hostIt->mGroup;
+        service.mInHostGroup = true;
+        service.mTxtData.assign(txtData.mData, txtData.mData + txtData.mLength);
+        InsertService(std::move(service));
+    }
+
+    error = RebuildHostGroup(*hostIt);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to publish host %s with its services: %s!", aBatch.mHostName.c_str(),
+                   otbrErrorString(error));
+
+        if (hostIt != mHosts.end())
+        {
+            DropHost(hostIt);
+        }
+    }
+
+    return error;
+}
+
+bool PublisherAvahi::IsTxtUpdate(const Host &aHost, const Batch &aBatch) const
+{
+    bool isTxtUpdate = false;
+
+    VerifyOrExit(!aBatch.mRebuild);
+    VerifyOrExit(aHost.mAddresses == aBatch.mAddresses);
+
+    for (const BatchService &service : aBatch.mServices)
+    {
+        auto it = mServiceIndex.find(MakeServiceKey(service.mName.c_str(), service.mType.c_str()));
+
+        VerifyOrExit(it != mServiceIndex.end() && it->second->mGroup == aHost.mGroup);
+        VerifyOrExit(it->second->mInHostGroup && it->second->mPort == service.mPort);
+    }
+
+    isTxtUpdate = true;
+
+exit:
+    return isTxtUpdate;
+}
+
+otbrError PublisherAvahi::UpdateHostGroupTxt(const Host &aHost, Batch &aBatch)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = 0;
+
+    for (const BatchService &service : aBatch.mServices)
+    {
+        TxtData            txtData   = aBatch.GetTxtData(service);
+        Services::iterator serviceIt = FindService(service.mName.c_str(), service.mType.c_str());
+        AvahiStringList    buffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+        AvahiStringList *  txtHead = nullptr;
+
+        if (txtData.Equals(serviceIt->mTxtData))
+        {
+            continue;
+        }
+
+        SuccessOrExit(error = TxtDataToAvahiStringList(txtData, buffer, sizeof(buffer), txtHead));
+
+        otbrLogInfo("Update service %s.%s for host %s", service.mName.c_str(), service.mType.c_str(),
+                    aHost.mHostName.c_str());
+        avahiError = avahi_entry_group_update_service_txt_strlst(aHost.mGroup, AVAHI_IF_UNSPEC, mProtocol,
+                                                                 AvahiPublishFlags{}, service.mName.c_str(),
+                                                                 service.mType.c_str(), mDomain, txtHead);
+        SuccessOrExit(avahiError);
+
+        serviceIt->mTxtData.assign(txtData.mData, txtData.mData + txtData.mLength);
+    }
+
+    // The handlers should be called even if the request can be processed synchronously
+    FinishHostPublication(aBatch.mHostName.c_str(), OTBR_ERROR_NONE);
+
+    for (const BatchService &service : aBatch.mServices)
+    {
+        FinishServicePublication(service.mName.c_str(), service.mType.c_str(), OTBR_ERROR_NONE);
+    }
+
+exit:
+    if (avahiError)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to update services for avahi error: %s!", avahi_strerror(avahiError));
+    }
+
+    return error;
+}
+
+otbrError PublisherAvahi::RebuildHostGroup(const Host &aHost)
+{
+    otbrError   error        = OTBR_ERROR_NONE;
+    int         avahiError   = 0;
+    std::string fullHostName = MakeFullName(aHost.mHostName.c_str());
+    auto        members      = mServiceGroups.equal_range(aHost.mGroup);
+
+    SuccessOrExit(error = ResetGroup(aHost.mGroup));
+
+    otbrLogInfo("Create host %s", aHost.mHostName.c_str());
+    SuccessOrExit(error = AddAddressesToGroup(aHost.mGroup, aHost, fullHostName.c_str()));
+
+    for (auto it = members.first; it != members.second; ++it)
+    {
+        SuccessOrExit(error = AddServiceToGroup(aHost.mGroup, *it->second, fullHostName.c_str()));
+    }
+
+    otbrLogInfo("Commit host %s with %zu services", aHost.mHostName.c_str(),
+                static_cast<size_t>(std::distance(members.first, members.second)));
+    avahiError = avahi_entry_group_commit(aHost.mGroup);
+    SuccessOrExit(avahiError);
+
+exit:
+    if (avahiError)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to publish host for avahi error: %s!", avahi_strerror(avahiError));
+    }
+
+    return error;
+}
+
+otbrError PublisherAvahi::RemoveFromHostGroup(Services::iterator aServiceIt)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    auto      hostIt = mHostGroups.find(aServiceIt->mGroup);
+
+    assert(aServiceIt->mInHostGroup && hostIt != mHostGroups.end());
+
+    EraseService(aServiceIt);
+    error = RebuildHostGroup(*hostIt->second);
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        DropHost(hostIt->second);
+    }
+
+    return error;
+}
+
+otbrError PublisherAvahi::DropHost(Hosts::iterator aHostIt)
+{
+    otbrError                       error;
+    auto                            range = mServiceGroups.equal_range(aHostIt->mGroup);
+    std::vector<Services::iterator> members;
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        members.push_back(it->second);
+    }
+
+    // The services in the entry group of the host are gone with the group.
+    for (Services::iterator serviceIt : members)
+    {
+        CancelServicePublication(serviceIt->mName.c_str(), serviceIt->mType.c_str());
+        EraseService(serviceIt);
+    }
+
+    CancelHostPublication(aHostIt->mHostName.c_str());
+    error = ReleaseGroup(aHostIt->mGroup);
+    EraseHost(aHostIt);
+
+    return error;
+}
+
+otbrError PublisherAvahi::AddServiceToGroup(AvahiEntryGroup *aGroup, const Service &aService, const char *aHostName)
+{
+    otbrError        error      = OTBR_ERROR_NONE;
+    int              avahiError = 0;
+    AvahiStringList  buffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    SuccessOrExit(error = TxtDataToAvahiStringList(aService.GetTxtData(), buffer, sizeof(buffer), txtHead));
+
+    otbrLogInfo("Create service %s.%s for host %s", aService.mName.c_str(), aService.mType.c_str(), aHostName);
+    avahiError = avahi_entry_group_add_service_strlst(aGroup, AVAHI_IF_UNSPEC, mProtocol, AvahiPublishFlags{},
+                                                      aService.mName.c_str(), aService.mType.c_str(), mDomain,
+                                                      aHostName, aService.mPort, txtHead);
+
+    if (avahiError)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to add service %s.%s for avahi error: %s!", aService.mName.c_str(),
+                   aService.mType.c_str(), avahi_strerror(avahiError));
+    }
+
+exit:
+    return error;
+}
+
+otbrError PublisherAvahi::AddAddressesToGroup(AvahiEntryGroup *aGroup, const Host &aHost, const char *aFullHostName)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = 0;
+
+    for (const Ip6Address &address : aHost.mAddresses)
+    {
+        AvahiAddress avahiAddress;
+
+        avahiAddress.proto = AVAHI_PROTO_INET6;
+        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(avahiAddress.data.ipv6.address));
+
+        avahiError = avahi_entry_group_add_address(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_INET6,
+                                                   AVAHI_PUBLISH_NO_REVERSE, aFullHostName, &avahiAddress);
+
+        if (avahiError)
+        {
+            error = OTBR_ERROR_MDNS;
+            otbrLogErr("Failed to add address %s of host %s for avahi error: %s!", address.ToString().c_str(),
+                       aHost.mHostName.c_str(), avahi_strerror(avahiError));
+            break;
+        }
+    }
+
+    return error;
+}
+
 std::string PublisherAvahi::MakeFullName(const char *aName)
 {
     assert(aName != nullptr);
@@ -820,7 +1530,42 @@ std::string PublisherAvahi::MakeFullName(const char *aName)
     return fullHostName;
 }
 
-void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherAvahi::EstimateServicesMemory(size_t &aNumEntries, size_t &aNumBytes) const
+{
+    aNumEntries = mServices.size();
+    aNumBytes   = MemoryUsage::GetListSize(mServices) + MemoryUsage::GetHashTableSize(mServiceIndex) +
+                MemoryUsage::GetHashTableSize(mServiceGroups);
+
+    for (const Service &service : mServices)
+    {
+        aNumBytes += MemoryUsage::GetHeapSize(service.mName) + MemoryUsage::GetHeapSize(service.mType) +
+                     MemoryUsage::GetHeapSize(service.mHostName) + MemoryUsage::GetHeapSize(service.mTxtData);
+    }
+
+    for (const auto &entry : mServiceIndex)
+    {
+        aNumBytes += MemoryUsage::GetHeapSize(entry.first);
+    }
+}
+
+void PublisherAvahi::EstimateHostsMemory(size_t &aNumEntries, size_t &aNumBytes) const
+{
+    aNumEntries = mHosts.size();
+    aNumBytes   = MemoryUsage::GetListSize(mHosts) + MemoryUsage::GetHashTableSize(mHostIndex) +
+                MemoryUsage::GetHashTableSize(mHostGroups);
+
+    for (const Host &host : mHosts)
+    {
+        aNumBytes += MemoryUsage::GetHeapSize(host.mHostName) + MemoryUsage::GetHeapSize(host.mAddresses);
+    }
+
+    for (const auto &entry : mHostIndex)
+    {
+        aNumBytes += MemoryUsage::GetHeapSize(entry.first);
+    }
+}
+
+void PublisherAvahi::StartServiceSubscription(const std::string &aType, const std::string &aInstanceName)
 {
     OTBR_UNUSED_VARIABLE(aType);
     OTBR_UNUSED_VARIABLE(aInstanceName);
@@ -828,7 +1573,7 @@ void PublisherAvahi::SubscribeService(const std::string &aType, const std::strin
     VerifyOrDie(false, "SubscribeService is not implemented with avahi");
 }
 
-void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherAvahi::StopServiceSubscription(const std::string &aType, const std::string &aInstanceName)
 {
     OTBR_UNUSED_VARIABLE(aType);
     OTBR_UNUSED_VARIABLE(aInstanceName);
@@ -836,14 +1581,14 @@ void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::str
     VerifyOrDie(false, "UnsubscribeService is not implemented with avahi");
 }
 
-void PublisherAvahi::SubscribeHost(const std::string &aHostName)
+void PublisherAvahi::StartHostSubscription(const std::string &aHostName)
 {
     OTBR_UNUSED_VARIABLE(aHostName);
 
     VerifyOrDie(false, "SubscribeHost is not implemented with avahi");
 }
 
-void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
+void PublisherAvahi::StopHostSubscription(const std::string &aHostName)
 {
     OTBR_UNUSED_VARIABLE(aHostName);
 
@@ -34,15 +34,25 @@
 #ifndef OTBR_AGENT_MDNS_AVAHI_HPP_
 #define OTBR_AGENT_MDNS_AVAHI_HPP_
 
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include <stdint.h>
+
 #include <avahi-client/client.h>
 #include <avahi-client/publish.h>
 #include <avahi-common/domain.h>
 #include <avahi-common/watch.h>
 
 #include "mdns.hpp"
+#include "common/interned_name.hpp"
 #include "common/mainloop.hpp"
+#include "common/memory_usage.hpp"
 #include "common/time.hpp"
 
 /**
@@ -80,6 +90,7 @@ struct AvahiWatch
     AvahiWatch(int aFd, AvahiWatchEvent aEvents, AvahiWatchCallback aCallback, void *aContext, void *aPoller)
         : mFd(aFd)
         , mEvents(aEvents)
+        , mHappened(0)
         , mCallback(aCallback)
         , mContext(aContext)
         , mPoller(aPoller)
@@ -93,10 +104,12 @@ struct AvahiWatch
  */
 struct AvahiTimeout
 {
-    otbr::Timepoint      mTimeout;  ///< Absolute time when this timer timeout.
-    AvahiTimeoutCallback mCallback; ///< The function to be called when timeout.
-    void *               mContext;  ///< The pointer to application-specific context.
-    void *               mPoller;   ///< The poller created this timer.
+    otbr::Timepoint      mTimeout;   ///< Absolute time when this timer timeout, `Timepoint::min()` if disarmed.
+    AvahiTimeoutCallback mCallback;  ///< The function to be called when timeout.
+    void *               mContext;   ///< The pointer to application-specific context.
+    void *               mPoller;    ///< The poller created this timer.
+    size_t               mHeapIndex; ///< The index of this timer in the timer heap of the poller, if armed.
+    uint64_t             mSerial;    ///< The order in which this timer is armed, to break ties of deadlines.
 
     /**
      * The constructor to initialize an AvahiTimeout.
@@ -153,7 +166,7 @@ public:
 
 private:
     typedef std::vector<AvahiWatch *>   Watches;
-    typedef std::vector<AvahiTimeout *> Timers;
+    typedef std::vector<AvahiTimeout *> TimerHeap;
 
     static AvahiWatch *    WatchNew(const struct AvahiPoll *aPoller,
                                     int                     aFd,
@@ -165,18 +178,28 @@ private:
     static AvahiWatchEvent WatchGetEvents(AvahiWatch *aWatch);
     static void            WatchFree(AvahiWatch *aWatch);
     void                   WatchFree(AvahiWatch &aWatch);
+    void                   UpdateWatchFd(int aFd);
+    void                   HandleWatchFd(int aFd, uint8_t aEvents);
     static AvahiTimeout *  TimeoutNew(const AvahiPoll *     aPoller,
                                       const struct timeval *aTimeout,
                                       AvahiTimeoutCallback  aCallback,
                                       void *                aContext);
     AvahiTimeout *         TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext);
     static void            TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout);
+    void                   TimeoutUpdate(AvahiTimeout &aTimer, const struct timeval *aTimeout);
     static void            TimeoutFree(AvahiTimeout *aTimer);
     void                   TimeoutFree(AvahiTimeout &aTimer);
-
-    Watches   mWatches;
-    Timers    mTimers;
-    AvahiPoll mAvahiPoller;
+    void                   HeapPush(AvahiTimeout &aTimer);
+    void                   HeapRemove(AvahiTimeout &aTimer);
+    bool                   HeapLess(size_t aLeft, size_t aRight) const;
+    void                   HeapSwap(size_t aLeft, size_t aRight);
+    void                   HeapSiftUp(size_t aIndex);
+    void                   HeapSiftDown(size_t aIndex);
+
+    std::map<int, Watches> mWatches;   // The watches by file descriptor.
+    TimerHeap              mTimerHeap; // The armed timers, as a binary min-heap ordered by deadline and serial.
+    uint64_t               mTimerSerial;
+    AvahiPoll              mAvahiPoller;
 };
 
 /**
@@ -209,17 +232,19 @@ public:
      * @param[in]   aName               The name of this service.
      * @param[in]   aType               The type of this service.
      * @param[in]   aPort               The port number of this service.
-     * @param[in]   aTxtList            A list of TXT name/value pairs.
+     * @param[in]   aTxtData            The encoded TXT data.
      *
-     * @retval  OTBR_ERROR_NONE     Successfully published or updated the service.
-     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the service.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The TXT data is malformed.
+     * @retval  OTBR_ERROR_ERRNO         Failed to publish or update the service.
      *
      */
     otbrError PublishService(const char *   aHostName,
                              uint16_t       aPort,
                              const char *   aName,
                              const char *   aType,
-                             const TxtList &aTxtList) override;
+                             const TxtData &aTxtData) override;
+    using Publisher::PublishService;
 
     /**
      * This method un-publishes a service.
@@ -236,18 +261,18 @@ public:
     /**
      * This method publishes or updates a host.
      *
-     * Publishing a host is advertising an AAAA RR for the host name. This method should be called
-     * before a service with non-null host name is published.
+     * Publishing a host is advertising the AAAA RRs of all addresses for the host name. This method should be
+     * called before a service with non-null host name is published. Changing the addresses publishes the record set
+     * again, because records cannot be removed from a committed Avahi entry group.
      *
-     * @param[in]  aName           The name of the host.
-     * @param[in]  aAddress        The address of the host.
-     * @param[in]  aAddressLength  The length of @p aAddress.
+     * @param[in]  aName       The name of the host.
+     * @param[in]  aAddresses  The addresses of the host.
      *
      * @retval  OTBR_ERROR_NONE     Successfully published or updated the host.
      * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the host.
      *
      */
-    otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) override;
+    otbrError PublishHost(const char *aName, const AddressList &aAddresses) override;
 
     /**
      * This method un-publishes a host.
@@ -263,54 +288,26 @@ public:
     otbrError UnpublishHost(const char *aName) override;
 
     /**
-     * This method subscribes a given service or service instance. If @p aInstanceName is not empty, this method
-     * subscribes the service instance. Otherwise, this method subscribes the service.
-     *
-     * mDNS implementations should use the `DiscoveredServiceInstanceCallback` function to notify discovered service
-     * instances.
-     *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
-     * instance.
-     *
-     * @param[in]  aType          The service type.
-     * @param[in]  aInstanceName  The service instance to subscribe, or empty to subscribe the service.
-     *
-     */
-    void SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-
-    /**
-     * This method unsubscribes a given service or service instance. If @p aInstanceName is not empty, this method
-     * unsubscribes the service instance. Otherwise, this method unsubscribes the service.
+     * This method starts a batch of publications for a host.
      *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a service or service instance.
+     * The host and the services residing on it which are published until `CommitBatch()` are added to a single
+     * entry group, so that they are probed and announced together.
      *
-     * @param[in]  aType          The service type.
-     * @param[in]  aInstanceName  The service instance to unsubscribe, or empty to unsubscribe the service.
+     * @param[in]  aHostName  The name of the host.
      *
      */
-    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void BeginBatch(const char *aHostName) override;
 
     /**
-     * This method subscribes a given host.
-     *
-     * mDNS implementations should use the `DiscoveredHostCallback` function to notify discovered hosts.
+     * This method publishes the host and services collected since `BeginBatch()`.
      *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same host.
-     *
-     * @param[in]  aHostName    The host name (without domain).
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the host and services.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The arguments are not valid.
+     * @retval  OTBR_ERROR_ERRNO         Failed to publish or update the host and services.
+     * @retval  OTBR_ERROR_MDNS          Failed to publish or update the host and services.
      *
      */
-    void SubscribeHost(const std::string &aHostName) override;
-
-    /**
-     * This method unsubscribes a given host.
-     *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a host.
-     *
-     * @param[in]  aHostName    The host name (without domain).
-     *
-     */
-    void UnsubscribeHost(const std::string &aHostName) override;
+    otbrError CommitBatch(void) override;
 
     /**
      * This method starts the MDNS service.
@@ -352,6 +349,12 @@ public:
      */
     void Process(const MainloopContext &aMainloop) override;
 
+protected:
+    void StartServiceSubscription(const std::string &aType, const std::string &aInstanceName) override;
+    void StopServiceSubscription(const std::string &aType, const std::string &aInstanceName) override;
+    void StartHostSubscription(const std::string &aHostName) override;
+    void StopHostSubscription(const std::string &aHostName) override;
+
 private:
     enum
     {
@@ -360,50 +363,101 @@ private:
         kMaxSizeOfHost        = AVAHI_LABEL_MAX,
         kMaxSizeOfDomain      = AVAHI_LABEL_MAX,
         kMaxSizeOfServiceType = AVAHI_LABEL_MAX,
+        kMaxPooledGroups      = 32, // The max number of released entry groups kept for reuse.
     };
 
     struct Service
     {
-        std::string      mName;
-        std::string      mType;
-        std::string      mHostName;
-        uint16_t         mPort  = 0;
-        AvahiEntryGroup *mGroup = nullptr;
+        TxtData GetTxtData(void) const { return TxtData(mTxtData.data(), static_cast<uint16_t>(mTxtData.size())); }
+
+        InternedName         mName;
+        InternedName         mType;
+        InternedName         mHostName;
+        uint16_t             mPort  = 0;
+        AvahiEntryGroup *    mGroup = nullptr;
+        std::vector<uint8_t> mTxtData;             // The published TXT data, to skip updates which change nothing.
+        bool                 mInHostGroup = false; // Whether `mGroup` is the entry group of the host.
     };
 
-    typedef std::vector<Service> Services;
+    typedef std::list<Service> Services;
 
     struct Host
     {
-        std::string      mHostName;
-        AvahiAddress     mAddress = {};
-        AvahiEntryGroup *mGroup   = nullptr;
+        InternedName     mHostName;
+        AddressList      mAddresses; // Sorted by `MakeAddressSet()`.
+        AvahiEntryGroup *mGroup = nullptr;
     };
 
-    typedef std::vector<Host> Hosts;
+    typedef std::list<Host> Hosts;
+
+    // A service collected in a batch, its TXT data is stored in the TXT arena of the batch.
+    struct BatchService : public Service
+    {
+        size_t   mTxtOffset = 0;
+        uint16_t mTxtLength = 0;
+    };
+
+    // The publications of a host collected between `BeginBatch()` and `CommitBatch()`.
+    struct Batch
+    {
+        TxtData GetTxtData(const BatchService &aService) const
+        {
+            return TxtData(mTxtArena.data() + aService.mTxtOffset, aService.mTxtLength);
+        }
+
+        bool                      mActive = false;
+        InternedName              mHostName;
+        bool                      mHasAddresses = false;
+        AddressList               mAddresses; // Sorted by `MakeAddressSet()`.
+        std::vector<BatchService> mServices;
+        std::vector<uint8_t>      mTxtArena;        // The TXT data of all services in the batch.
+        bool                      mRebuild = false; // Whether services have been removed from the host group.
+    };
 
     static void HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext);
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
 
     Hosts::iterator FindHost(const char *aHostName);
     otbrError       CreateHost(AvahiClient &aClient, const char *aHostName, Hosts::iterator &aOutHostIt);
+    void            EraseHost(Hosts::iterator aHostIt);
 
     Services::iterator FindService(const char *aName, const char *aType);
     otbrError          CreateService(AvahiClient &       aClient,
                                      const char *        aName,
                                      const char *        aType,
                                      Services::iterator &aOutServiceIt);
+    Services::iterator InsertService(Service &&aService);
+    void               EraseService(Services::iterator aServiceIt);
+
+    bool      IsBatching(const char *aHostName) const;
+    otbrError CommitHostGroup(Batch &aBatch);
+    bool      IsTxtUpdate(const Host &aHost, const Batch &aBatch) const;
+    otbrError UpdateHostGroupTxt(const Host &aHost, Batch &aBatch);
+    otbrError RebuildHostGroup(const Host &aHost);
+    otbrError RemoveFromHostGroup(Services::iterator aServiceIt);
+    otbrError DropHost(Hosts::iterator aHostIt);
+    otbrError AddServiceToGroup(AvahiEntryGroup *aGroup, const Service &aService, const char *aHostName);
+    otbrError AddAddressesToGroup(AvahiEntryGroup *aGroup, const Host &aHost, const char *aFullHostName);
+
+    static otbrError TxtDataToAvahiStringList(const TxtData &   aTxtData,
+                                              AvahiStringList * aBuffer,
+                                              size_t            aBufferSize,
+                                              AvahiStringList *&aHead);
 
     otbrError        CreateGroup(AvahiClient &aClient, AvahiEntryGroup *&aOutGroup);
     static otbrError ResetGroup(AvahiEntryGroup *aGroup);
+    otbrError        ReleaseGroup(AvahiEntryGroup *aGroup);
     static otbrError FreeGroup(AvahiEntryGroup *aGroup);
     void             FreeAllGroups(void);
     static void      HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void             HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
-    void             CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError) const;
+    void             CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError);
 
     std::string MakeFullName(const char *aName);
 
+    void EstimateServicesMemory(size_t &aNumEntries, size_t &aNumBytes) const;
+    void EstimateHostsMemory(size_t &aNumEntries, size_t &aNumBytes) const;
+
     AvahiClient *mClient;
     Hosts        mHosts;
     Services     mServices;
@@ -413,6 +467,21 @@ private:
     State        mState;
     StateHandler mStateHandler;
     void *       mContext;
+
+    std::unordered_map<InternedName, Hosts::iterator, InternedNameHash>  mHostIndex;     // By host name.
+    std::unordered_map<const AvahiEntryGroup *, Hosts::iterator>         mHostGroups;    // By entry group.
+    std::unordered_map<std::string, Services::iterator>                  mServiceIndex;  // By `MakeServiceKey()`.
+    std::unordered_multimap<const AvahiEntryGroup *, Services::iterator> mServiceGroups; // By entry group.
+
+    // Released entry groups kept for reuse, each is a D-Bus object in avahi-daemon. A reset group is only reused
+    // once avahi-daemon confirms the reset, so that no state change of its previous records reaches the next owner.
+    std::unordered_set<AvahiEntryGroup *> mResettingGroups;
+    std::vector<AvahiEntryGroup *>        mFreeGroups;
+
+    Batch mBatch;
+
+    MemoryReporter mServicesMemory;
+    MemoryReporter mHostsMemory;
 };
 
 } // namespace Mdns
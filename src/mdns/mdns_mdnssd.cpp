@@ -36,6 +36,7 @@
 #include "mdns/mdns_mdnssd.hpp"
 
 #include <algorithm>
+#include <iterator>
 
 #include <arpa/inet.h>
 #include <assert.h>
@@ -48,6 +49,7 @@
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/time.hpp"
 #include "utils/strcpy_utils.hpp"
 
@@ -55,6 +57,12 @@ namespace otbr {
 
 namespace Mdns {
 
+static void DestroyServiceRef(DNSServiceRef aServiceRef)
+{
+    MainloopManager::GetInstance().RemoveFd(DNSServiceRefSockFD(aServiceRef));
+    DNSServiceRefDeallocate(aServiceRef);
+}
+
 static otbrError DNSErrorToOtbrError(DNSServiceErrorType aError)
 {
     otbrError error;
@@ -210,6 +218,7 @@ static const char *DNSErrorToString(DNSServiceErrorType aError)
 
 PublisherMDnsSd::PublisherMDnsSd(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext)
     : mHostsRef(nullptr)
+    , mSubscriptionsRef(nullptr)
     , mDomain(aDomain)
     , mState(State::kIdle)
     , mStateHandler(aHandler)
@@ -221,11 +230,28 @@ PublisherMDnsSd::PublisherMDnsSd(int aProtocol, const char *aDomain, StateHandle
 PublisherMDnsSd::~PublisherMDnsSd(void)
 {
     Stop();
+
+    for (Subscription &subscription : mSubscribedServices)
+    {
+        subscription.Release();
+    }
+
+    for (Subscription &subscription : mSubscribedHosts)
+    {
+        subscription.Release();
+    }
+
+    if (mSubscriptionsRef != nullptr)
+    {
+        DestroyServiceRef(mSubscriptionsRef);
+        mSubscriptionsRef = nullptr;
+    }
 }
 
 otbrError PublisherMDnsSd::Start(void)
 {
     mState = State::kReady;
+    RestartSubscriptions();
     mStateHandler(mContext, State::kReady);
     return OTBR_ERROR_NONE;
 }
@@ -242,18 +268,24 @@ void PublisherMDnsSd::Stop(void)
     for (Service &service : mServices)
     {
         otbrLogInfo("Remove service %s.%s", service.mName, service.mType);
-        DNSServiceRefDeallocate(service.mService);
+        DestroyServiceRef(service.mService);
     }
     mServices.clear();
+    mServiceIndex.clear();
+    mServiceRefIndex.clear();
 
     otbrLogInfo("Remove all hosts");
     if (mHostsRef != nullptr)
     {
-        DNSServiceRefDeallocate(mHostsRef);
+        DestroyServiceRef(mHostsRef);
         mHostsRef = nullptr;
     }
 
     mHosts.clear();
+    mHostIndex.clear();
+    mHostRecordIndex.clear();
+
+    CancelAllPublications();
 
 exit:
     return;
@@ -285,9 +317,20 @@ void PublisherMDnsSd::Update(MainloopContext &aMainloop)
         aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
     }
 
+    if (mSubscriptionsRef != nullptr)
+    {
+        int fd = DNSServiceRefSockFD(mSubscriptionsRef);
+
+        assert(fd != -1);
+
+        FD_SET(fd, &aMainloop.mReadFdSet);
+
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+    }
+
     for (Subscription &subscription : mSubscribedServices)
     {
-        if (subscription.mServiceRef != nullptr)
+        if (subscription.mServiceRef != nullptr && !subscription.mShared)
         {
             int fd = DNSServiceRefSockFD(subscription.mServiceRef);
             assert(fd != -1);
@@ -299,7 +342,7 @@ void PublisherMDnsSd::Update(MainloopContext &aMainloop)
 
     for (Subscription &subscription : mSubscribedHosts)
     {
-        if (subscription.mServiceRef != nullptr)
+        if (subscription.mServiceRef != nullptr && !subscription.mShared)
         {
             int fd = DNSServiceRefSockFD(subscription.mServiceRef);
             assert(fd != -1);
@@ -334,9 +377,19 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
         }
     }
 
+    if (mSubscriptionsRef != nullptr)
+    {
+        int fd = DNSServiceRefSockFD(mSubscriptionsRef);
+
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            readyServices.push_back(mSubscriptionsRef);
+        }
+    }
+
     for (Subscription &subscription : mSubscribedServices)
     {
-        if (subscription.mServiceRef != nullptr)
+        if (subscription.mServiceRef != nullptr && !subscription.mShared)
         {
             int fd = DNSServiceRefSockFD(subscription.mServiceRef);
             assert(fd != -1);
@@ -350,7 +403,7 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
 
     for (Subscription &service : mSubscribedHosts)
     {
-        if (service.mServiceRef != nullptr)
+        if (service.mServiceRef != nullptr && !service.mShared)
         {
             int fd = DNSServiceRefSockFD(service.mServiceRef);
             assert(fd != -1);
@@ -369,6 +422,15 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
         if (error != kDNSServiceErr_NoError)
         {
             otbrLogWarning("DNSServiceProcessResult failed: %s", DNSErrorToString(error));
+
+            if (serviceRef == mSubscriptionsRef)
+            {
+                ResetSubscriptionsRef();
+            }
+            else
+            {
+                DropSubscriptionRef(serviceRef);
+            }
         }
     }
 }
@@ -410,6 +472,7 @@ void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService
     if (originalInstanceName != aName)
     {
         otbrLogInfo("Service %s.%s renamed to %s.%s", originalInstanceName.c_str(), aType, aName, aType);
+        RecordServiceRename();
     }
 
     if (aError == kDNSServiceErr_NoError)
@@ -431,11 +494,8 @@ void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService
         DiscardService(originalInstanceName.c_str(), aType, aServiceRef);
     }
 
-    if (mServiceHandler != nullptr)
-    {
-        // TODO: pass the renewed service instance name back to SRP server handler.
-        mServiceHandler(originalInstanceName.c_str(), aType, error, mServiceHandlerContext);
-    }
+    // TODO: pass the renewed service instance name back to SRP server handler.
+    FinishServicePublication(originalInstanceName.c_str(), aType, error);
 
 exit:
     return;
@@ -452,8 +512,8 @@ void PublisherMDnsSd::DiscardService(const char *aName, const char *aType, DNSSe
 
         otbrLogInfo("Remove service ref %p", service->mService);
 
-        DNSServiceRefDeallocate(service->mService);
-        mServices.erase(service);
+        DestroyServiceRef(service->mService);
+        EraseService(service);
     }
 }
 
@@ -470,7 +530,9 @@ void PublisherMDnsSd::RecordService(const char *aName, const char *aType, DNSSer
         strcpy(newService.mName, aName);
         strcpy(newService.mType, aType);
         newService.mService = aServiceRef;
-        mServices.push_back(newService);
+        service             = mServices.insert(mServices.end(), newService);
+        mServiceIndex.emplace(MakeServiceKey(aName, aType), service);
+        mServiceRefIndex.emplace(aServiceRef, service);
     }
     else
     {
@@ -482,14 +544,14 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
                                           uint16_t       aPort,
                                           const char *   aName,
                                           const char *   aType,
-                                          const TxtList &aTxtList)
+                                          const TxtData &aTxtData)
 {
-    otbrError       ret   = OTBR_ERROR_NONE;
-    int             error = 0;
-    uint8_t         txt[kMaxSizeOfTxtRecord];
-    uint16_t        txtLength  = sizeof(txt);
-    ServiceIterator service    = FindPublishedService(aName, aType);
-    DNSServiceRef   serviceRef = nullptr;
+    otbrError       ret        = OTBR_ERROR_NONE;
+    int             error      = 0;
+    ServiceIterator service      = FindPublishedService(aName, aType);
+    DNSServiceRef   serviceRef   = nullptr;
+    const char *    safeHostName = (aHostName != nullptr) ? aHostName : "";
+    bool            started      = false;
     char            fullHostName[kMaxSizeOfDomain];
 
     if (aHostName != nullptr)
@@ -501,26 +563,49 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
         SuccessOrExit(error = MakeFullName(fullHostName, sizeof(fullHostName), aHostName));
     }
 
-    SuccessOrExit(ret = EncodeTxtData(aTxtList, txt, txtLength));
+    started = StartServicePublication(aName, aType);
 
-    if (service != mServices.end())
+    if (service != mServices.end() && (service->mHostName != safeHostName || service->mPort != aPort))
     {
-        otbrLogInfo("Update service %s.%s", aName, aType);
+        // Only the TXT record of a registered service can be updated, a new SRV record needs a new registration.
+        otbrLogInfo("Re-register service %s.%s", aName, aType);
+        DiscardService(aName, aType);
+        service = mServices.end();
 
-        // Setting TTL to 0 to use default value.
-        SuccessOrExit(error = DNSServiceUpdateRecord(service->mService, nullptr, 0, txtLength, txt, /* ttl */ 0));
+        // The registration of a publication in flight is gone, so the publication is up to this attempt now.
+        started = true;
+    }
 
-        if (mServiceHandler != nullptr)
+    if (service != mServices.end())
+    {
+        if (aTxtData.Equals(service->mTxtData))
+        {
+            // Updating unchanged TXT data would announce the record again and flush the caches for nothing.
+            otbrLogInfo("Service %s.%s is unchanged", aName, aType);
+        }
+        else
         {
-            mServiceHandler(aName, aType, DNSErrorToOtbrError(error), mServiceHandlerContext);
+            otbrLogInfo("Update service %s.%s", aName, aType);
+
+            // Setting TTL to 0 to use default value.
+            SuccessOrExit(error = DNSServiceUpdateRecord(service->mService, nullptr, 0, aTxtData.mLength,
+                                                         aTxtData.mData, /* ttl */ 0));
+            service->mTxtData.assign(aTxtData.mData, aTxtData.mData + aTxtData.mLength);
         }
+
+        FinishServicePublication(aName, aType, OTBR_ERROR_NONE);
     }
     else
     {
         SuccessOrExit(error = DNSServiceRegister(&serviceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, aName, aType,
                                                  mDomain, (aHostName != nullptr) ? fullHostName : nullptr, htons(aPort),
-                                                 txtLength, txt, HandleServiceRegisterResult, this));
+                                                 aTxtData.mLength, aTxtData.mData, HandleServiceRegisterResult, this));
         RecordService(aName, aType, serviceRef);
+
+        service            = FindPublishedService(aName, aType);
+        service->mHostName = safeHostName;
+        service->mPort     = aPort;
+        service->mTxtData.assign(aTxtData.mData, aTxtData.mData + aTxtData.mLength);
     }
 
 exit:
@@ -529,11 +614,18 @@ exit:
         ret = OTBR_ERROR_MDNS;
         otbrLogErr("Failed to publish service for mdnssd error: %s!", DNSErrorToString(error));
     }
+
+    if (ret != OTBR_ERROR_NONE && started)
+    {
+        CancelServicePublication(aName, aType);
+    }
+
     return ret;
 }
 
 otbrError PublisherMDnsSd::UnpublishService(const char *aName, const char *aType)
 {
+    CancelServicePublication(aName, aType);
     DiscardService(aName, aType);
     return OTBR_ERROR_NONE;
 }
@@ -546,23 +638,20 @@ otbrError PublisherMDnsSd::DiscardHost(const char *aName, bool aSendGoodbye)
 
     VerifyOrExit(mHostsRef != nullptr && host != mHosts.end());
 
-    otbrLogInfo("Remove host: %s (record ref: %p)", host->mName, host->mRecord);
+    otbrLogInfo("Remove host: %s (%zu records)", host->mName, host->mRecords.size());
 
-    if (aSendGoodbye)
+    for (const HostRecord &record : host->mRecords)
     {
-        // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
-        // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
-        // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
-        // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
-        // sending a goodbye message.
-        // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
-        error = DNSServiceUpdateRecord(mHostsRef, host->mRecord, kDNSServiceFlagsUnique, host->mAddress.size(),
-                                       &host->mAddress.front(), /* ttl */ 1);
-        // Do not SuccessOrExit so that we always erase the host entry.
+        int recordError = RemoveHostRecord(record, aSendGoodbye);
 
-        DNSServiceRemoveRecord(mHostsRef, host->mRecord, /* flags */ 0);
+        // Do not SuccessOrExit so that we always erase the host entry.
+        if (error == kDNSServiceErr_NoError)
+        {
+            error = recordError;
+        }
     }
-    mHosts.erase(host);
+
+    EraseHost(host);
 
 exit:
     if (error != kDNSServiceErr_NoError)
@@ -573,92 +662,177 @@ exit:
     return ret;
 }
 
-void PublisherMDnsSd::RecordHost(const char *   aName,
-                                 const uint8_t *aAddress,
-                                 uint8_t        aAddressLength,
-                                 DNSRecordRef   aRecordRef)
+int PublisherMDnsSd::RemoveHostRecord(const HostRecord &aRecord, bool aSendGoodbye)
 {
-    HostIterator host = FindPublishedHost(aName);
+    int error = kDNSServiceErr_NoError;
 
-    if (host == mHosts.end())
+    if (aSendGoodbye)
     {
-        Host newHost;
+        // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
+        // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
+        // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
+        // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
+        // sending a goodbye message.
+        // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
+        error = DNSServiceUpdateRecord(mHostsRef, aRecord.mRecord, kDNSServiceFlagsUnique, sizeof(aRecord.mAddress.m8),
+                                       aRecord.mAddress.m8, /* ttl */ 1);
+    }
+
+    // The record is released even if its registration failed.
+    DNSServiceRemoveRecord(mHostsRef, aRecord.mRecord, /* flags */ 0);
+    mHostRecordIndex.erase(aRecord.mRecord);
+
+    return error;
+}
 
-        otbrLogInfo("Add new host %s", aName);
+int PublisherMDnsSd::UpdateHostRecords(HostIterator aHost, const char *aFullName, const AddressList &aAddresses)
+{
+    int                     error        = kDNSServiceErr_NoError;
+    AddressList             newAddresses = MakeAddressSet(aAddresses);
+    std::vector<HostRecord> staleRecords;
+
+    // Keep the records of unchanged addresses, the others become stale.
+    for (auto it = aHost->mRecords.begin(); it != aHost->mRecords.end();)
+    {
+        auto address = std::lower_bound(newAddresses.begin(), newAddresses.end(), it->mAddress);
 
-        strcpy(newHost.mName, aName);
-        std::copy(aAddress, aAddress + aAddressLength, newHost.mAddress.begin());
-        newHost.mRecord = aRecordRef;
-        mHosts.push_back(newHost);
+        if (address != newAddresses.end() && *address == it->mAddress)
+        {
+            newAddresses.erase(address);
+            ++it;
+        }
+        else
+        {
+            staleRecords.push_back(*it);
+            it = aHost->mRecords.erase(it);
+        }
     }
-    else
+
+    for (const Ip6Address &address : newAddresses)
+    {
+        HostRecord record;
+        char       addressString[Ip6Address::kStringSize];
+
+        record.mAddress = address;
+
+        if (!staleRecords.empty())
+        {
+            // A stale record is updated in place rather than removed, so that the daemon doesn't probe again.
+            record = staleRecords.back();
+            staleRecords.pop_back();
+            record.mAddress = address;
+            aHost->mRecords.push_back(record);
+
+            otbrLogInfo("Update address %s of host %s", address.ToString(addressString), aHost->mName);
+            SuccessOrExit(error = DNSServiceUpdateRecord(mHostsRef, record.mRecord, kDNSServiceFlagsUnique,
+                                                         sizeof(address.m8), address.m8, /* ttl */ 0));
+        }
+        else
+        {
+            otbrLogInfo("Add address %s of host %s", address.ToString(addressString), aHost->mName);
+            SuccessOrExit(error = DNSServiceRegisterRecord(mHostsRef, &record.mRecord, kDNSServiceFlagsUnique,
+                                                           kDNSServiceInterfaceIndexAny, aFullName,
+                                                           kDNSServiceType_AAAA, kDNSServiceClass_IN,
+                                                           sizeof(address.m8), address.m8, /* ttl */ 0,
+                                                           HandleRegisterHostResult, this));
+            record.mPending = true;
+            ++aHost->mPendingRecords;
+            aHost->mRecords.push_back(record);
+            mHostRecordIndex.emplace(record.mRecord, aHost);
+        }
+    }
+
+exit:
+    // Stale records are kept on failure so that discarding the host releases them.
+    for (const HostRecord &record : staleRecords)
     {
-        otbrLogInfo("Update existing host %s", host->mName);
+        if (error == kDNSServiceErr_NoError)
+        {
+            char addressString[Ip6Address::kStringSize];
 
-        // The address of the host may be updated.
-        std::copy(aAddress, aAddress + aAddressLength, host->mAddress.begin());
-        assert(host->mRecord == aRecordRef);
+            otbrLogInfo("Remove address %s of host %s", record.mAddress.ToString(addressString), aHost->mName);
+            aHost->mPendingRecords -= record.mPending;
+            RemoveHostRecord(record, /* aSendGoodbye */ true);
+        }
+        else
+        {
+            aHost->mRecords.push_back(record);
+        }
     }
+
+    return error;
 }
 
-otbrError PublisherMDnsSd::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
+otbrError PublisherMDnsSd::PublishHost(const char *aName, const AddressList &aAddresses)
 {
-    otbrError    ret   = OTBR_ERROR_NONE;
-    int          error = 0;
+    otbrError    ret     = OTBR_ERROR_NONE;
+    int          error   = 0;
+    bool         started = false;
     char         fullName[kMaxSizeOfDomain];
-    HostIterator host = FindPublishedHost(aName);
+    HostIterator host;
 
     // Supports only IPv6 for now, may support IPv4 in the future.
-    VerifyOrExit(aAddressLength == OTBR_IP6_ADDRESS_SIZE, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(!aAddresses.empty(), ret = OTBR_ERROR_INVALID_ARGS);
 
     SuccessOrExit(ret = MakeFullName(fullName, sizeof(fullName), aName));
 
+    started = StartHostPublication(aName);
+
     if (mHostsRef == nullptr)
     {
         SuccessOrExit(error = DNSServiceCreateConnection(&mHostsRef));
     }
 
-    if (host != mHosts.end())
-    {
-        otbrLogInfo("Update existing host %s", aName);
-        SuccessOrExit(error = DNSServiceUpdateRecord(mHostsRef, host->mRecord, kDNSServiceFlagsUnique, aAddressLength,
-                                                     aAddress, /* ttl */ 0));
+    host = FindPublishedHost(aName);
 
-        RecordHost(aName, aAddress, aAddressLength, host->mRecord);
-        if (mHostHandler != nullptr)
-        {
-            mHostHandler(aName, DNSErrorToOtbrError(error), mHostHandlerContext);
-        }
+    if (host == mHosts.end())
+    {
+        otbrLogInfo("Publish new host %s", aName);
+        host = mHosts.emplace(mHosts.end());
+        strcpy(host->mName, aName);
+        mHostIndex.emplace(aName, host);
     }
     else
     {
-        DNSRecordRef record;
+        otbrLogInfo("Update existing host %s", aName);
+    }
 
-        otbrLogInfo("Publish new host %s", aName);
-        SuccessOrExit(error = DNSServiceRegisterRecord(mHostsRef, &record, kDNSServiceFlagsUnique,
-                                                       kDNSServiceInterfaceIndexAny, fullName, kDNSServiceType_AAAA,
-                                                       kDNSServiceClass_IN, aAddressLength, aAddress, /* ttl */ 0,
-                                                       HandleRegisterHostResult, this));
-        RecordHost(aName, aAddress, aAddressLength, record);
+    SuccessOrExit(error = UpdateHostRecords(host, fullName, aAddresses));
+
+    if (host->mPendingRecords == 0)
+    {
+        // No new record is registered, the handler should be called even if the request is processed synchronously.
+        FinishHostPublication(aName, OTBR_ERROR_NONE);
     }
 
 exit:
     if (error != kDNSServiceErr_NoError)
     {
+        DiscardHost(aName, /* aSendGoodbye */ false);
+
         if (mHostsRef != nullptr)
         {
-            DNSServiceRefDeallocate(mHostsRef);
+            DestroyServiceRef(mHostsRef);
             mHostsRef = nullptr;
         }
 
-        ret = OTBR_ERROR_MDNS;
+        // The records of a publication in flight are gone with the host.
+        started = true;
+        ret     = OTBR_ERROR_MDNS;
         otbrLogErr("Failed to publish/update host %s for mdnssd error: %s!", aName, DNSErrorToString(error));
     }
+
+    if (ret != OTBR_ERROR_NONE && started)
+    {
+        CancelHostPublication(aName);
+    }
+
     return ret;
 }
 
 otbrError PublisherMDnsSd::UnpublishHost(const char *aName)
 {
+    CancelHostPublication(aName);
     return DiscardHost(aName);
 }
 
@@ -688,21 +862,30 @@ void PublisherMDnsSd::HandleRegisterHostResult(DNSServiceRef       aHostsConnect
 
     otbrLogInfo("Received reply for host %s", hostName.c_str());
 
-    if (aErrorCode == kDNSServiceErr_NoError)
-    {
-        otbrLogInfo("Successfully registered host %s", hostName.c_str());
-    }
-    else
+    if (aErrorCode != kDNSServiceErr_NoError)
     {
         otbrLogWarning("failed to register host %s for mdnssd error: %s", hostName.c_str(),
                        DNSErrorToString(aErrorCode));
 
         DiscardHost(hostName.c_str(), /* aSendGoodbye */ false);
+        FinishHostPublication(hostName.c_str(), DNSErrorToOtbrError(aErrorCode));
+        ExitNow();
+    }
+
+    for (HostRecord &record : host->mRecords)
+    {
+        if (record.mRecord == aHostRecord && record.mPending)
+        {
+            record.mPending = false;
+            --host->mPendingRecords;
+        }
     }
 
-    if (mHostHandler != nullptr)
+    // The records of all addresses are published as one record set.
+    if (host->mPendingRecords == 0)
     {
-        mHostHandler(hostName.c_str(), DNSErrorToOtbrError(aErrorCode), mHostHandlerContext);
+        otbrLogInfo("Successfully registered host %s", hostName.c_str());
+        FinishHostPublication(hostName.c_str(), OTBR_ERROR_NONE);
     }
 
 exit:
@@ -730,32 +913,56 @@ exit:
 
 PublisherMDnsSd::ServiceIterator PublisherMDnsSd::FindPublishedService(const char *aName, const char *aType)
 {
-    return std::find_if(mServices.begin(), mServices.end(), [&aName, aType](const Service &service) {
-        return strcmp(aName, service.mName) == 0 && IsServiceTypeEqual(aType, service.mType);
-    });
+    auto it = mServiceIndex.find(MakeServiceKey(aName, aType));
+
+    return it != mServiceIndex.end() ? it->second : mServices.end();
 }
 
 PublisherMDnsSd::ServiceIterator PublisherMDnsSd::FindPublishedService(const DNSServiceRef &aServiceRef)
 {
-    return std::find_if(mServices.begin(), mServices.end(),
-                        [&aServiceRef](const Service &service) { return service.mService == aServiceRef; });
+    auto it = mServiceRefIndex.find(aServiceRef);
+
+    return it != mServiceRefIndex.end() ? it->second : mServices.end();
 }
 
 PublisherMDnsSd::HostIterator PublisherMDnsSd::FindPublishedHost(const DNSRecordRef &aRecordRef)
 {
-    return std::find_if(mHosts.begin(), mHosts.end(),
-                        [&aRecordRef](const Host &host) { return host.mRecord == aRecordRef; });
+    auto it = mHostRecordIndex.find(aRecordRef);
+
+    return it != mHostRecordIndex.end() ? it->second : mHosts.end();
 }
 
 PublisherMDnsSd::HostIterator PublisherMDnsSd::FindPublishedHost(const char *aHostName)
 {
-    return std::find_if(mHosts.begin(), mHosts.end(),
-                        [&aHostName](const Host &host) { return strcmp(host.mName, aHostName) == 0; });
+    auto it = mHostIndex.find(aHostName);
+
+    return it != mHostIndex.end() ? it->second : mHosts.end();
+}
+
+void PublisherMDnsSd::EraseService(ServiceIterator aService)
+{
+    mServiceIndex.erase(MakeServiceKey(aService->mName, aService->mType));
+    mServiceRefIndex.erase(aService->mService);
+    mServices.erase(aService);
 }
 
-void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherMDnsSd::EraseHost(HostIterator aHost)
+{
+    mHostIndex.erase(aHost->mName);
+
+    for (const HostRecord &record : aHost->mRecords)
+    {
+        mHostRecordIndex.erase(record.mRecord);
+    }
+
+    mHosts.erase(aHost);
+}
+
+void PublisherMDnsSd::StartServiceSubscription(const std::string &aType, const std::string &aInstanceName)
 {
     mSubscribedServices.emplace_back(*this, aType, aInstanceName);
+    mServiceSubscriptionIndex[MakeServiceKey(aInstanceName.c_str(), aType.c_str())] =
+        std::prev(mSubscribedServices.end());
 
     otbrLogInfo("subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
                 mSubscribedServices.size());
@@ -771,23 +978,83 @@ void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::stri
     }
 }
 
-void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherMDnsSd::StopServiceSubscription(const std::string &aType, const std::string &aInstanceName)
 {
-    ServiceSubscriptionList::iterator it =
-        std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
-                     [&aType, &aInstanceName](const ServiceSubscription &aService) {
-                         return aService.mType == aType && aService.mInstanceName == aInstanceName;
-                     });
+    auto index = mServiceSubscriptionIndex.find(MakeServiceKey(aInstanceName.c_str(), aType.c_str()));
 
-    assert(it != mSubscribedServices.end());
+    assert(index != mServiceSubscriptionIndex.end());
 
-    it->Release();
-    mSubscribedServices.erase(it);
+    index->second->Release();
+    mSubscribedServices.erase(index->second);
+    mServiceSubscriptionIndex.erase(index);
 
     otbrLogInfo("unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
                 mSubscribedServices.size());
 }
 
+void PublisherMDnsSd::OnServiceInstanceResolved(ServiceSubscription &aService)
+{
+    HostSubscription *host = FindHostSubscription(aService.mInstanceInfo.mHostName);
+
+    // The addresses are only looked up for hosts which are subscribed, e.g. by a host query of the discovery
+    // proxy, so that resolving SRV and TXT records doesn't double the mDNS queries. Thread clients query the
+    // addresses of the host on demand.
+    if (host == nullptr)
+    {
+        aService.mAddressHost = InternedName();
+        ReportAddresses(aService, nullptr);
+    }
+    else
+    {
+        aService.mAddressHost = host->mHostName;
+
+        // Otherwise, the instance is reported along with the first result of the host subscription.
+        if (host->mResolved)
+        {
+            ReportAddresses(aService, host);
+        }
+    }
+}
+
+void PublisherMDnsSd::ReportAddresses(ServiceSubscription &aService, const HostSubscription *aHost)
+{
+    if (aHost != nullptr)
+    {
+        aService.mInstanceInfo.mAddresses = aHost->mHostInfo.mAddresses;
+        aService.mInstanceInfo.mTtl       = aHost->mHostInfo.mTtl;
+    }
+    else
+    {
+        aService.mInstanceInfo.mAddresses.clear();
+        aService.mInstanceInfo.mTtl = kDefaultTtl;
+    }
+
+    OnServiceResolved(aService);
+}
+
+PublisherMDnsSd::HostSubscription *PublisherMDnsSd::FindHostSubscription(const std::string &aFullHostName)
+{
+    HostSubscription *host  = nullptr;
+    DnsNameParts      parts = ParseFullDnsName(aFullHostName);
+    std::string       hostNameString;
+    InternedName      hostName;
+
+    VerifyOrExit(parts.IsHost());
+    parts.mHostName.CopyTo(hostNameString);
+    // A host name which isn't interned can't be subscribed.
+    VerifyOrExit(NamePool::Get().Find(hostNameString, hostName));
+
+    {
+        auto index = mHostSubscriptionIndex.find(hostName);
+
+        VerifyOrExit(index != mHostSubscriptionIndex.end());
+        host = &*index->second;
+    }
+
+exit:
+    return host;
+}
+
 void PublisherMDnsSd::OnServiceResolved(PublisherMDnsSd::ServiceSubscription &aService)
 {
     otbrLogInfo("Service %s is resolved successfully: %s host %s addresses %zu", aService.mType.c_str(),
@@ -803,6 +1070,11 @@ void PublisherMDnsSd::OnServiceResolved(PublisherMDnsSd::ServiceSubscription &aS
 void PublisherMDnsSd::OnServiceResolveFailed(const ServiceSubscription &aService, DNSServiceErrorType aErrorCode)
 {
     otbrLogWarning("Service %s resolving failed: code=%d", aService.mType.c_str(), aErrorCode);
+
+    if (IsNameNotFound(aErrorCode) && mServiceNotFoundCallback != nullptr)
+    {
+        mServiceNotFoundCallback(aService.mType, aService.mInstanceName);
+    }
 }
 
 void PublisherMDnsSd::OnHostResolved(PublisherMDnsSd::HostSubscription &aHost)
@@ -810,37 +1082,109 @@ void PublisherMDnsSd::OnHostResolved(PublisherMDnsSd::HostSubscription &aHost)
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHost.mHostName.c_str(),
                 aHost.mHostInfo.mHostName.c_str(), aHost.mHostInfo.mAddresses.size(), aHost.mHostInfo.mTtl);
 
+    aHost.mResolved = true;
+
     if (mDiscoveredHostCallback != nullptr)
     {
         mDiscoveredHostCallback(aHost.mHostName, aHost.mHostInfo);
     }
+
+    ReportHostAddresses(aHost);
 }
 
 void PublisherMDnsSd::OnHostResolveFailed(const PublisherMDnsSd::HostSubscription &aHost,
                                           DNSServiceErrorType                      aErrorCode)
 {
     otbrLogWarning("Host %s resolving failed: code=%d", aHost.mHostName.c_str(), aErrorCode);
+
+    if (IsNameNotFound(aErrorCode) && mHostNotFoundCallback != nullptr)
+    {
+        mHostNotFoundCallback(aHost.mHostName);
+    }
+
+    // The service instances waiting for the addresses are reported without addresses.
+    if (!aHost.mResolved)
+    {
+        ReportHostAddresses(aHost);
+    }
+}
+
+void PublisherMDnsSd::ReportHostAddresses(const HostSubscription &aHost)
+{
+    std::vector<std::string> keys;
+    InternedName             hostName = aHost.mHostName;
+
+    for (const ServiceSubscription &service : mSubscribedServices)
+    {
+        if (service.mAddressHost == hostName)
+        {
+            keys.push_back(MakeServiceKey(service.mInstanceName.c_str(), service.mType.c_str()));
+        }
+    }
+
+    // The callbacks may unsubscribe services or the host, so the subscriptions are looked up again.
+    for (const std::string &key : keys)
+    {
+        auto index = mServiceSubscriptionIndex.find(key);
+        auto host  = mHostSubscriptionIndex.find(hostName);
+
+        if (index == mServiceSubscriptionIndex.end() || index->second->mAddressHost != hostName)
+        {
+            continue;
+        }
+
+        if (host != mHostSubscriptionIndex.end() && host->second->mResolved)
+        {
+            ReportAddresses(*index->second, &*host->second);
+        }
+        else
+        {
+            index->second->mAddressHost = InternedName();
+            ReportAddresses(*index->second, nullptr);
+        }
+    }
 }
 
-void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
+bool PublisherMDnsSd::IsNameNotFound(DNSServiceErrorType aErrorCode)
+{
+    // A timeout only means that no answer came in time, e.g. from a busy or lossy link, not that the name is absent.
+    return aErrorCode == kDNSServiceErr_NoSuchName || aErrorCode == kDNSServiceErr_NoSuchRecord;
+}
+
+void PublisherMDnsSd::StartHostSubscription(const std::string &aHostName)
 {
     mSubscribedHosts.emplace_back(*this, aHostName);
+    mHostSubscriptionIndex[mSubscribedHosts.back().mHostName] = std::prev(mSubscribedHosts.end());
 
     otbrLogInfo("subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
 
     mSubscribedHosts.back().Resolve();
 }
 
-void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
+void PublisherMDnsSd::StopHostSubscription(const std::string &aHostName)
 {
-    HostSubscriptionList ::iterator it =
-        std::find_if(mSubscribedHosts.begin(), mSubscribedHosts.end(),
-                     [&aHostName](const HostSubscription &aHost) { return aHost.mHostName == aHostName; });
+    InternedName hostName;
+    auto         index = mHostSubscriptionIndex.end();
+
+    if (NamePool::Get().Find(aHostName, hostName))
+    {
+        index = mHostSubscriptionIndex.find(hostName);
+    }
+
+    assert(index != mHostSubscriptionIndex.end());
 
-    assert(it != mSubscribedHosts.end());
+    // The resolved service instances keep the addresses reported last.
+    for (ServiceSubscription &service : mSubscribedServices)
+    {
+        if (service.mAddressHost == hostName)
+        {
+            service.mAddressHost = InternedName();
+        }
+    }
 
-    it->Release();
-    mSubscribedHosts.erase(it);
+    index->second->Release();
+    mSubscribedHosts.erase(index->second);
+    mHostSubscriptionIndex.erase(index);
 
     otbrLogInfo("unsubscribe host %s (remaining %d)", aHostName.c_str(), mSubscribedHosts.size());
 }
@@ -864,18 +1208,169 @@ void PublisherMDnsSd::Subscription::DeallocateServiceRef(void)
 {
     if (mServiceRef != nullptr)
     {
-        DNSServiceRefDeallocate(mServiceRef);
+        if (mShared)
+        {
+            // A subordinate ref has no socket of its own, so it is not known to the mainloop.
+            DNSServiceRefDeallocate(mServiceRef);
+        }
+        else
+        {
+            DestroyServiceRef(mServiceRef);
+        }
+
         mServiceRef = nullptr;
+        mShared     = false;
     }
 }
 
-void PublisherMDnsSd::ServiceSubscription::Browse(void)
+DNSServiceFlags PublisherMDnsSd::Subscription::PrepareServiceRef(void)
 {
+    DNSServiceFlags flags = 0;
+
     assert(mServiceRef == nullptr);
 
+    mServiceRef = mMDnsSd->GetSubscriptionsRef();
+    VerifyOrExit(mServiceRef != nullptr);
+
+    mShared = true;
+    flags   = kDNSServiceFlagsShareConnection;
+
+exit:
+    return flags;
+}
+
+void PublisherMDnsSd::Subscription::CheckServiceRef(DNSServiceErrorType aError, const char *aOperation)
+{
+    VerifyOrExit(aError != kDNSServiceErr_NoError);
+
+    otbrLogWarning("%s failed: %s", aOperation, DNSErrorToString(aError));
+
+    // On failure, the ref is either cleared or still points to the shared connection, neither is owned by us.
+    mServiceRef = nullptr;
+    mShared     = false;
+
+exit:
+    return;
+}
+
+DNSServiceRef PublisherMDnsSd::GetSubscriptionsRef(void)
+{
+#if OTBR_ENABLE_MDNS_SHARED_CONNECTION
+    if (mSubscriptionsRef == nullptr)
+    {
+        DNSServiceErrorType error = DNSServiceCreateConnection(&mSubscriptionsRef);
+
+        if (error != kDNSServiceErr_NoError)
+        {
+            otbrLogWarning("Failed to create the shared connection: %s", DNSErrorToString(error));
+            mSubscriptionsRef = nullptr;
+        }
+    }
+#endif
+
+    return mSubscriptionsRef;
+}
+
+void PublisherMDnsSd::ResetSubscriptionsRef(void)
+{
+    otbrLogWarning("Drop the shared connection of subscriptions");
+
+    // Deallocating the shared connection implicitly deallocates all its subordinate refs.
+    for (Subscription &subscription : mSubscribedServices)
+    {
+        if (subscription.mShared)
+        {
+            subscription.mServiceRef = nullptr;
+            subscription.mShared     = false;
+            subscription.mLost       = true;
+        }
+    }
+
+    for (Subscription &subscription : mSubscribedHosts)
+    {
+        if (subscription.mShared)
+        {
+            subscription.mServiceRef = nullptr;
+            subscription.mShared     = false;
+            subscription.mLost       = true;
+        }
+    }
+
+    DestroyServiceRef(mSubscriptionsRef);
+    mSubscriptionsRef = nullptr;
+}
+
+void PublisherMDnsSd::DropSubscriptionRef(DNSServiceRef aServiceRef)
+{
+    for (Subscription &subscription : mSubscribedServices)
+    {
+        if (subscription.mServiceRef == aServiceRef)
+        {
+            subscription.DeallocateServiceRef();
+            subscription.mLost = true;
+            ExitNow();
+        }
+    }
+
+    for (Subscription &subscription : mSubscribedHosts)
+    {
+        if (subscription.mServiceRef == aServiceRef)
+        {
+            subscription.DeallocateServiceRef();
+            subscription.mLost = true;
+            ExitNow();
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::RestartSubscriptions(void)
+{
+    // The subscriptions dropped with their connections to mDNSResponder, e.g. when it restarted, are started again.
+    for (ServiceSubscription &service : mSubscribedServices)
+    {
+        if (!service.mLost || service.mServiceRef != nullptr)
+        {
+            continue;
+        }
+
+        otbrLogInfo("Restart subscription of service %s.%s", service.mInstanceName.c_str(), service.mType.c_str());
+        service.mLost = false;
+
+        if (service.mInstanceName.empty())
+        {
+            service.Browse();
+        }
+        else
+        {
+            service.Resolve(kDNSServiceInterfaceIndexAny, service.mInstanceName.c_str(), service.mType.c_str(),
+                            "local.");
+        }
+    }
+
+    for (HostSubscription &host : mSubscribedHosts)
+    {
+        if (!host.mLost || host.mServiceRef != nullptr)
+        {
+            continue;
+        }
+
+        otbrLogInfo("Restart subscription of host %s", host.mHostName.c_str());
+        host.mLost = false;
+        host.Resolve();
+    }
+}
+
+void PublisherMDnsSd::ServiceSubscription::Browse(void)
+{
+    DNSServiceFlags flags = PrepareServiceRef() | kDNSServiceFlagsTimeout;
+
     otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
-    DNSServiceBrowse(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, kDNSServiceInterfaceIndexAny, mType.c_str(),
-                     /* domain */ nullptr, HandleBrowseResult, this);
+    CheckServiceRef(DNSServiceBrowse(&mServiceRef, flags, kDNSServiceInterfaceIndexAny, mType.c_str(),
+                                     /* domain */ nullptr, HandleBrowseResult, this),
+                    "DNSServiceBrowse");
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef       aServiceRef,
@@ -926,11 +1421,12 @@ void PublisherMDnsSd::ServiceSubscription::Resolve(uint32_t    aInterfaceIndex,
                                                    const char *aType,
                                                    const char *aDomain)
 {
-    assert(mServiceRef == nullptr);
+    DNSServiceFlags flags = PrepareServiceRef();
 
     otbrLogInfo("DNSServiceResolve %s %s %s inf %d", aInstanceName, aType, aDomain, aInterfaceIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ 0, aInterfaceIndex, aInstanceName, aType, aDomain, HandleResolveResult,
-                      this);
+    CheckServiceRef(DNSServiceResolve(&mServiceRef, flags, aInterfaceIndex, aInstanceName, aType, aDomain,
+                                      HandleResolveResult, this),
+                    "DNSServiceResolve");
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleResolveResult(DNSServiceRef        aServiceRef,
@@ -960,17 +1456,18 @@ void PublisherMDnsSd::ServiceSubscription::HandleResolveResult(DNSServiceRef
 {
     OTBR_UNUSED_VARIABLE(aServiceRef);
 
-    std::string instanceName, type, domain;
-    otbrError   error = OTBR_ERROR_NONE;
+    DnsNameParts parts;
+    otbrError    error = OTBR_ERROR_NONE;
 
     otbrLogInfo("DNSServiceResolve reply: %s host %s:%d, TXT=%dB inf %u, flags=%u", aFullName, aHostTarget, aPort,
                 aTxtLen, aInterfaceIndex, aFlags);
 
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
 
-    SuccessOrExit(error = SplitFullServiceInstanceName(aFullName, instanceName, type, domain));
+    parts = ParseFullDnsName(aFullName);
+    VerifyOrExit(parts.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
 
-    mInstanceInfo.mName     = instanceName;
+    parts.mInstanceName.CopyTo(mInstanceInfo.mName);
     mInstanceInfo.mHostName = aHostTarget;
     mInstanceInfo.mPort     = ntohs(aPort);
     mInstanceInfo.mTxtData.assign(aTxtRecord, aTxtRecord + aTxtLen);
@@ -979,7 +1476,7 @@ void PublisherMDnsSd::ServiceSubscription::HandleResolveResult(DNSServiceRef
     mInstanceInfo.mWeight   = 0;
 
     DeallocateServiceRef();
-    GetAddrInfo(aInterfaceIndex);
+    mMDnsSd->OnServiceInstanceResolved(*this);
 
 exit:
     if (aErrorCode != kDNSServiceErr_NoError || error != OTBR_ERROR_NONE)
@@ -993,86 +1490,17 @@ exit:
     }
 }
 
-void PublisherMDnsSd::ServiceSubscription::GetAddrInfo(uint32_t aInterfaceIndex)
-{
-    assert(mServiceRef == nullptr);
-
-    otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
-
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, mInstanceInfo.mHostName.c_str(),
-                          HandleGetAddrInfoResult, this);
-}
-
-void PublisherMDnsSd::ServiceSubscription::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
-                                                                   DNSServiceFlags        aFlags,
-                                                                   uint32_t               aInterfaceIndex,
-                                                                   DNSServiceErrorType    aErrorCode,
-                                                                   const char *           aHostName,
-                                                                   const struct sockaddr *aAddress,
-                                                                   uint32_t               aTtl,
-                                                                   void *                 aContext)
-{
-    static_cast<ServiceSubscription *>(aContext)->HandleGetAddrInfoResult(aServiceRef, aFlags, aInterfaceIndex,
-                                                                          aErrorCode, aHostName, aAddress, aTtl);
-}
-
-void PublisherMDnsSd::ServiceSubscription::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
-                                                                   DNSServiceFlags        aFlags,
-                                                                   uint32_t               aInterfaceIndex,
-                                                                   DNSServiceErrorType    aErrorCode,
-                                                                   const char *           aHostName,
-                                                                   const struct sockaddr *aAddress,
-                                                                   uint32_t               aTtl)
-{
-    OTBR_UNUSED_VARIABLE(aServiceRef);
-    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
-
-    Ip6Address address;
-
-    otbrLogDebug("DNSServiceGetAddrInfo reply: %d, flags=%u, host=%s, sa_family=%d", aErrorCode, aFlags, aHostName,
-                 aAddress->sa_family);
-
-    VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
-    VerifyOrExit((aFlags & kDNSServiceFlagsAdd) && aAddress->sa_family == AF_INET6);
-
-    address.CopyFrom(*reinterpret_cast<const struct sockaddr_in6 *>(aAddress));
-    VerifyOrExit(!address.IsUnspecified() && !address.IsLinkLocal() && !address.IsMulticast() && !address.IsLoopback(),
-                 otbrLogDebug("DNSServiceGetAddrInfo ignores address %s", address.ToString().c_str()));
-
-    mInstanceInfo.mAddresses.push_back(address);
-    mInstanceInfo.mTtl = aTtl;
-
-    otbrLogDebug("DNSServiceGetAddrInfo reply: address=%s, ttl=%u", address.ToString().c_str(), aTtl);
-
-    mMDnsSd->OnServiceResolved(*this);
-
-exit:
-    if (aErrorCode != kDNSServiceErr_NoError)
-    {
-        otbrLogWarning("DNSServiceGetAddrInfo failed: %d", aErrorCode);
-
-        mMDnsSd->OnServiceResolveFailed(*this, aErrorCode);
-    }
-    else if (mInstanceInfo.mAddresses.empty() && (aFlags & kDNSServiceFlagsMoreComing) == 0)
-    {
-        otbrLogDebug("DNSServiceGetAddrInfo reply: no IPv6 address found");
-        mInstanceInfo.mTtl = aTtl;
-        mMDnsSd->OnServiceResolved(*this);
-    }
-}
-
 void PublisherMDnsSd::HostSubscription::Resolve(void)
 {
-    std::string fullHostName = mHostName + ".local.";
-
-    assert(mServiceRef == nullptr);
+    std::string     fullHostName = mHostName.GetString() + ".local.";
+    DNSServiceFlags flags        = PrepareServiceRef();
 
     otbrLogDebug("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
-                          HandleResolveResult, this);
+    CheckServiceRef(DNSServiceGetAddrInfo(&mServiceRef, flags, kDNSServiceInterfaceIndexAny,
+                                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
+                                          HandleResolveResult, this),
+                    "DNSServiceGetAddrInfo");
 }
 
 void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
@@ -1100,6 +1528,7 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
     OTBR_UNUSED_VARIABLE(aInterfaceIndex);
 
     Ip6Address address;
+    char       addressString[Ip6Address::kStringSize];
 
     otbrLogDebug("DNSServiceGetAddrInfo reply: %d, flags=%u, host=%s, sa_family=%d", aErrorCode, aFlags, aHostName,
                  aAddress->sa_family);
@@ -1109,13 +1538,13 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
 
     address.CopyFrom(*reinterpret_cast<const struct sockaddr_in6 *>(aAddress));
     VerifyOrExit(!address.IsLinkLocal(),
-                 otbrLogDebug("DNSServiceGetAddrInfo ignore link-local address %s", address.ToString().c_str()));
+                 otbrLogDebug("DNSServiceGetAddrInfo ignore link-local address %s", address.ToString(addressString)));
 
     mHostInfo.mHostName = aHostName;
     mHostInfo.mAddresses.push_back(address);
     mHostInfo.mTtl = aTtl;
 
-    otbrLogDebug("DNSServiceGetAddrInfo reply: address=%s, ttl=%u", address.ToString().c_str(), aTtl);
+    otbrLogDebug("DNSServiceGetAddrInfo reply: address=%s, ttl=%u", address.ToString(addressString), aTtl);
 
     mMDnsSd->OnHostResolved(*this);
 
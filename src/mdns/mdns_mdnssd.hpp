@@ -34,8 +34,10 @@
 #ifndef OTBR_AGENT_MDNS_MDNSSD_HPP_
 #define OTBR_AGENT_MDNS_MDNSSD_HPP_
 
-#include <array>
+#include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -43,6 +45,7 @@
 #include <dns_sd.h>
 
 #include "common/code_utils.hpp"
+#include "common/interned_name.hpp"
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 
@@ -53,6 +56,10 @@ namespace Mdns {
 /**
  * This class implements MDNS service with mDNSResponder.
  *
+ * When `OTBR_ENABLE_MDNS_SHARED_CONNECTION` is set, all browse, resolve and getaddrinfo operations of the
+ * subscriptions share a single connection to the mDNSResponder daemon (`kDNSServiceFlagsShareConnection`), so only
+ * one file descriptor is polled no matter how many services and hosts are subscribed.
+ *
  */
 class PublisherMDnsSd : public Publisher
 {
@@ -80,17 +87,19 @@ public:
      * @param[in]   aName               The name of this service.
      * @param[in]   aType               The type of this service.
      * @param[in]   aPort               The port number of this service.
-     * @param[in]   aTxtList            A list of TXT name/value pairs.
+     * @param[in]   aTxtData            The encoded TXT data.
      *
-     * @retval  OTBR_ERROR_NONE     Successfully published or updated the service.
-     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the service.
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the service.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The TXT data is malformed.
+     * @retval  OTBR_ERROR_ERRNO         Failed to publish or update the service.
      *
      */
     otbrError PublishService(const char *   aHostName,
                              uint16_t       aPort,
                              const char *   aName,
                              const char *   aType,
-                             const TxtList &aTxtList) override;
+                             const TxtData &aTxtData) override;
+    using Publisher::PublishService;
 
     /**
      * This method un-publishes a service.
@@ -107,18 +116,18 @@ public:
     /**
      * This method publishes or updates a host.
      *
-     * Publishing a host is advertising an AAAA RR for the host name. This method should be called
-     * before a service with non-null host name is published.
+     * Publishing a host is advertising the AAAA RRs of all addresses for the host name. This method should be
+     * called before a service with non-null host name is published. Only the AAAA RRs of changed addresses are
+     * updated, added or removed.
      *
-     * @param[in]  aName           The name of the host.
-     * @param[in]  aAddress        The address of the host.
-     * @param[in]  aAddressLength  The length of @p aAddress.
+     * @param[in]  aName       The name of the host.
+     * @param[in]  aAddresses  The addresses of the host.
      *
      * @retval  OTBR_ERROR_NONE     Successfully published or updated the host.
      * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the host.
      *
      */
-    otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) override;
+    otbrError PublishHost(const char *aName, const AddressList &aAddresses) override;
 
     /**
      * This method un-publishes a host.
@@ -133,56 +142,6 @@ public:
      */
     otbrError UnpublishHost(const char *aName) override;
 
-    /**
-     * This method subscribes a given service or service instance. If @p aInstanceName is not empty, this method
-     * subscribes the service instance. Otherwise, this method subscribes the service.
-     *
-     * mDNS implementations should use the `DiscoveredServiceInstanceCallback` function to notify discovered service
-     * instances.
-     *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
-     * instance.
-     *
-     * @param[in]  aType          The service type.
-     * @param[in]  aInstanceName  The service instance to subscribe, or empty to subscribe the service.
-     *
-     */
-    void SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-
-    /**
-     * This method unsubscribes a given service or service instance. If @p aInstanceName is not empty, this method
-     * unsubscribes the service instance. Otherwise, this method unsubscribes the service.
-     *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a service or service instance.
-     *
-     * @param[in]  aType          The service type.
-     * @param[in]  aInstanceName  The service instance to unsubscribe, or empty to unsubscribe the service.
-     *
-     */
-    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-
-    /**
-     * This method subscribes a given host.
-     *
-     * mDNS implementations should use the `DiscoveredHostCallback` function to notify discovered hosts.
-     *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same host.
-     *
-     * @param[in]  aHostName    The host name (without domain).
-     *
-     */
-    void SubscribeHost(const std::string &aHostName) override;
-
-    /**
-     * This method unsubscribes a given host.
-     *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a host.
-     *
-     * @param[in]  aHostName    The host name (without domain).
-     *
-     */
-    void UnsubscribeHost(const std::string &aHostName) override;
-
     /**
      * This method starts the MDNS service.
      *
@@ -223,10 +182,18 @@ public:
      */
     void Process(const MainloopContext &aMainloop) override;
 
+protected:
+    void StartServiceSubscription(const std::string &aType, const std::string &aInstanceName) override;
+    void StopServiceSubscription(const std::string &aType, const std::string &aInstanceName) override;
+    void StartHostSubscription(const std::string &aHostName) override;
+    void StopHostSubscription(const std::string &aHostName) override;
+
 private:
+    // The TTL of service instances resolved without addresses, RFC 6762 recommends it for SRV records.
+    static constexpr uint32_t kDefaultTtl = 120;
+
     enum
     {
-        kMaxSizeOfTxtRecord   = 256,
         kMaxSizeOfServiceName = kDNSServiceMaxServiceName,
         kMaxSizeOfHost        = 128,
         kMaxSizeOfDomain      = kDNSServiceMaxDomainName,
@@ -235,36 +202,52 @@ private:
 
     struct Service
     {
-        char          mName[kMaxSizeOfServiceName];
-        char          mType[kMaxSizeOfServiceType];
-        DNSServiceRef mService;
+        char                 mName[kMaxSizeOfServiceName];
+        char                 mType[kMaxSizeOfServiceType];
+        DNSServiceRef        mService;
+        std::string          mHostName; // Empty for the local host.
+        uint16_t             mPort = 0;
+        std::vector<uint8_t> mTxtData; // The published TXT data, to skip updates which change nothing.
+    };
+
+    struct HostRecord
+    {
+        Ip6Address   mAddress;
+        DNSRecordRef mRecord  = nullptr;
+        bool         mPending = false; // Whether the registration of the record is waiting for the result.
     };
 
     struct Host
     {
-        char                                       mName[kMaxSizeOfServiceName];
-        std::array<uint8_t, OTBR_IP6_ADDRESS_SIZE> mAddress;
-        DNSRecordRef                               mRecord;
+        char                    mName[kMaxSizeOfServiceName];
+        std::vector<HostRecord> mRecords;            // One AAAA record per address.
+        uint32_t                mPendingRecords = 0; // The number of records waiting for the result.
     };
 
     struct Subscription
     {
         PublisherMDnsSd *mMDnsSd;
         DNSServiceRef    mServiceRef;
+        bool             mShared; // Whether `mServiceRef` is a subordinate of the shared connection.
+        bool             mLost;   // Whether `mServiceRef` was dropped with its connection to mDNSResponder.
 
         explicit Subscription(PublisherMDnsSd &aMDnsSd)
             : mMDnsSd(&aMDnsSd)
             , mServiceRef(nullptr)
+            , mShared(false)
+            , mLost(false)
         {
         }
 
-        void Release(void);
-        void DeallocateServiceRef(void);
+        void            Release(void);
+        void            DeallocateServiceRef(void);
+        DNSServiceFlags PrepareServiceRef(void);
+        void            CheckServiceRef(DNSServiceErrorType aError, const char *aOperation);
     };
 
     struct ServiceSubscription : public Subscription
     {
-        explicit ServiceSubscription(PublisherMDnsSd &aMDnsSd, std::string aType, std::string aInstanceName)
+        explicit ServiceSubscription(PublisherMDnsSd &aMDnsSd, InternedName aType, InternedName aInstanceName)
             : Subscription(aMDnsSd)
             , mType(std::move(aType))
             , mInstanceName(std::move(aInstanceName))
@@ -273,7 +256,6 @@ private:
 
         void Browse(void);
         void Resolve(uint32_t aInterfaceIndex, const char *aInstanceName, const char *aType, const char *aDomain);
-        void GetAddrInfo(uint32_t aInterfaceIndex);
 
         static void HandleBrowseResult(DNSServiceRef       aServiceRef,
                                        DNSServiceFlags     aFlags,
@@ -309,30 +291,16 @@ private:
                                         uint16_t             aPort, // In network byte order.
                                         uint16_t             aTxtLen,
                                         const unsigned char *aTxtRecord);
-        static void HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
-                                            DNSServiceFlags        aFlags,
-                                            uint32_t               aInterfaceIndex,
-                                            DNSServiceErrorType    aErrorCode,
-                                            const char *           aHostName,
-                                            const struct sockaddr *aAddress,
-                                            uint32_t               aTtl,
-                                            void *                 aContext);
-        void        HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
-                                            DNSServiceFlags        aFlags,
-                                            uint32_t               aInterfaceIndex,
-                                            DNSServiceErrorType    aErrorCode,
-                                            const char *           aHostName,
-                                            const struct sockaddr *aAddress,
-                                            uint32_t               aTtl);
-
-        std::string            mType;
-        std::string            mInstanceName;
+
+        InternedName           mType;
+        InternedName           mInstanceName;
         DiscoveredInstanceInfo mInstanceInfo;
+        InternedName           mAddressHost; // The host subscription providing the addresses, empty if none.
     };
 
     struct HostSubscription : public Subscription
     {
-        explicit HostSubscription(PublisherMDnsSd &aMDnsSd, std::string aHostName)
+        explicit HostSubscription(PublisherMDnsSd &aMDnsSd, InternedName aHostName)
             : Subscription(aMDnsSd)
             , mHostName(std::move(aHostName))
         {
@@ -355,22 +323,24 @@ private:
                                         const struct sockaddr *aAddress,
                                         uint32_t               aTtl);
 
-        std::string        mHostName;
+        InternedName       mHostName;
         DiscoveredHostInfo mHostInfo;
+        bool               mResolved = false; // Whether the first result has been reported.
     };
 
-    typedef std::vector<Service>             Services;
-    typedef std::vector<Host>                Hosts;
-    typedef std::vector<Service>::iterator   ServiceIterator;
-    typedef std::vector<Host>::iterator      HostIterator;
-    typedef std::vector<ServiceSubscription> ServiceSubscriptionList;
-    typedef std::vector<HostSubscription>    HostSubscriptionList;
+    typedef std::list<Service>             Services;
+    typedef std::list<Host>                Hosts;
+    typedef Services::iterator             ServiceIterator;
+    typedef Hosts::iterator                HostIterator;
+    typedef std::list<ServiceSubscription> ServiceSubscriptionList;
+    typedef std::list<HostSubscription>    HostSubscriptionList;
 
     void DiscardService(const char *aName, const char *aType, DNSServiceRef aServiceRef = nullptr);
     void RecordService(const char *aName, const char *aType, DNSServiceRef aServiceRef);
 
     otbrError DiscardHost(const char *aName, bool aSendGoodbye = true);
-    void      RecordHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength, DNSRecordRef aRecordRef);
+    int       RemoveHostRecord(const HostRecord &aRecord, bool aSendGoodbye);
+    int       UpdateHostRecords(HostIterator aHost, const char *aFullName, const AddressList &aAddresses);
 
     static void HandleServiceRegisterResult(DNSServiceRef         aService,
                                             const DNSServiceFlags aFlags,
@@ -401,22 +371,46 @@ private:
     ServiceIterator FindPublishedService(const DNSServiceRef &aServiceRef);
     HostIterator    FindPublishedHost(const DNSRecordRef &aRecordRef);
     HostIterator    FindPublishedHost(const char *aHostName);
+    void            EraseService(ServiceIterator aService);
+    void            EraseHost(HostIterator aHost);
 
+    void        OnServiceInstanceResolved(ServiceSubscription &aService);
     void        OnServiceResolved(ServiceSubscription &aService);
-    static void OnServiceResolveFailed(const ServiceSubscription &aService, DNSServiceErrorType aErrorCode);
+    void        OnServiceResolveFailed(const ServiceSubscription &aService, DNSServiceErrorType aErrorCode);
     void        OnHostResolved(HostSubscription &aHost);
     void        OnHostResolveFailed(const HostSubscription &aHost, DNSServiceErrorType aErrorCode);
 
+    static bool IsNameNotFound(DNSServiceErrorType aErrorCode);
+
+    HostSubscription *FindHostSubscription(const std::string &aFullHostName);
+    void              ReportAddresses(ServiceSubscription &aService, const HostSubscription *aHost);
+    void              ReportHostAddresses(const HostSubscription &aHost);
+
+    DNSServiceRef GetSubscriptionsRef(void);
+    void          ResetSubscriptionsRef(void);
+    void          DropSubscriptionRef(DNSServiceRef aServiceRef);
+    void          RestartSubscriptions(void);
+
     Services      mServices;
     Hosts         mHosts;
     DNSServiceRef mHostsRef;
+    DNSServiceRef mSubscriptionsRef; // The connection shared by all subscriptions, see `GetSubscriptionsRef()`.
     const char *  mDomain;
     State         mState;
     StateHandler  mStateHandler;
     void *        mContext;
 
+    std::unordered_map<std::string, ServiceIterator>   mServiceIndex;    // By `MakeServiceKey()`.
+    std::unordered_map<DNSServiceRef, ServiceIterator> mServiceRefIndex; // By service ref.
+    std::unordered_map<std::string, HostIterator>      mHostIndex;       // By host name.
+    std::unordered_map<DNSRecordRef, HostIterator>     mHostRecordIndex; // By AAAA record ref.
+
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
+
+    // By service key, and by host name.
+    std::unordered_map<std::string, ServiceSubscriptionList::iterator>                 mServiceSubscriptionIndex;
+    std::unordered_map<InternedName, HostSubscriptionList::iterator, InternedNameHash> mHostSubscriptionIndex;
 };
 
 /**
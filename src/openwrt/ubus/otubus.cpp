@@ -34,43 +34,49 @@
 
 #include "openwrt/ubus/otubus.hpp"
 
-#include <mutex>
-
 #include <arpa/inet.h>
-#include <sys/eventfd.h>
+
+#include <string>
+#include <vector>
 
 #include <openthread/commissioner.h>
 #include <openthread/thread.h>
 #include <openthread/thread_ftd.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "common/hex_codec.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/metrics_registry.hpp"
 
 namespace otbr {
 namespace ubus {
 
 static UbusServer *sUbusServerInstance = nullptr;
-static int         sUbusEfd            = -1;
 static void *      sJsonUri            = nullptr;
 static int         sBufNum;
-static std::mutex *sNcpThreadMutex;
 
-const static int PANID_LENGTH     = 10;
-const static int XPANID_LENGTH    = 64;
-const static int MASTERKEY_LENGTH = 64;
+const static int XPANID_LENGTH = 64;
 
 UbusServer::UbusServer(Ncp::ControllerOpenThread *aController)
-    : mIfFinishScan(false)
+    : mIsScanning(false)
+    , mIsConnected(false)
     , mContext(nullptr)
     , mSockPath(nullptr)
+    , mScanList(nullptr)
+    , mIsCollectingNetworkdata(false)
     , mController(aController)
     , mSecond(0)
 {
     memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
+    memset(&mNetworkdataCollectBuf, 0, sizeof(mNetworkdataCollectBuf));
     memset(&mBuf, 0, sizeof(mBuf));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
 
     blob_buf_init(&mBuf, 0);
+    blob_buf_init(&mScanBuf, 0);
     blob_buf_init(&mNetworkdataBuf, 0);
+    blob_buf_init(&mNetworkdataCollectBuf, 0);
 }
 
 UbusServer &UbusServer::GetInstance(void)
@@ -96,6 +102,21 @@ enum
     ADD_JOINER_MAX,
 };
 
+enum
+{
+    JOINERS,
+    JOINERS_TIMEOUT,
+    ADD_JOINERS_MAX,
+};
+
+enum
+{
+    JOINER_PSKD,
+    JOINER_EUI64,
+    JOINER_DISCERNER,
+    JOINER_MAX,
+};
+
 enum
 {
     MASTERKEY,
@@ -156,6 +177,17 @@ static const struct blobmsg_policy addJoinerPolicy[ADD_JOINER_MAX] = {
     [EUI64] = {.name = "eui64", .type = BLOBMSG_TYPE_STRING},
 };
 
+static const struct blobmsg_policy addJoinersPolicy[ADD_JOINERS_MAX] = {
+    [JOINERS]         = {.name = "joiners", .type = BLOBMSG_TYPE_ARRAY},
+    [JOINERS_TIMEOUT] = {.name = "timeout", .type = BLOBMSG_TYPE_INT32},
+};
+
+static const struct blobmsg_policy joinerPolicy[JOINER_MAX] = {
+    [JOINER_PSKD]      = {.name = "pskd", .type = BLOBMSG_TYPE_STRING},
+    [JOINER_EUI64]     = {.name = "eui64", .type = BLOBMSG_TYPE_STRING},
+    [JOINER_DISCERNER] = {.name = "discerner", .type = BLOBMSG_TYPE_STRING},
+};
+
 static const struct blobmsg_policy mgmtsetPolicy[MGMTSET_MAX] = {
     [MASTERKEY]   = {.name = "masterkey", .type = BLOBMSG_TYPE_STRING},
     [NETWORKNAME] = {.name = "networkname", .type = BLOBMSG_TYPE_STRING},
@@ -189,6 +221,8 @@ static const struct ubus_method otbrMethods[] = {
     {"mode", &UbusServer::UbusModeHandler, 0, 0, nullptr, 0},
     {"setmode", &UbusServer::UbusSetModeHandler, 0, 0, setModePolicy, ARRAY_SIZE(setModePolicy)},
     {"partitionid", &UbusServer::UbusPartitionIdHandler, 0, 0, nullptr, 0},
+    {"status", &UbusServer::UbusStatusHandler, 0, 0, nullptr, 0},
+    {"metrics", &UbusServer::UbusMetricsHandler, 0, 0, nullptr, 0},
     {"leave", &UbusServer::UbusLeaveHandler, 0, 0, nullptr, 0},
     {"leaderdata", &UbusServer::UbusLeaderdataHandler, 0, 0, nullptr, 0},
     {"networkdata", &UbusServer::UbusNetworkdataHandler, 0, 0, nullptr, 0},
@@ -204,6 +238,7 @@ static const struct ubus_method otbrMethods[] = {
     {"macfilterstate", &UbusServer::UbusMacfilterStateHandler, 0, 0, nullptr, 0},
     {"macfilteraddr", &UbusServer::UbusMacfilterAddrHandler, 0, 0, nullptr, 0},
     {"joineradd", &UbusServer::UbusJoinerAddHandler, 0, 0, addJoinerPolicy, ARRAY_SIZE(addJoinerPolicy)},
+    {"joineraddbatch", &UbusServer::UbusJoinerAddBatchHandler, 0, 0, addJoinersPolicy, ARRAY_SIZE(addJoinersPolicy)},
     {"mgmtset", &UbusServer::UbusMgmtsetHandler, 0, 0, mgmtsetPolicy, ARRAY_SIZE(mgmtsetPolicy)},
 };
 
@@ -221,18 +256,13 @@ static struct ubus_object otbr = {
     n_methods : ARRAY_SIZE(otbrMethods),
 };
 
-void UbusServer::ProcessScan(void)
+otError UbusServer::ProcessScan(void)
 {
-    otError  error        = OT_ERROR_NONE;
     uint32_t scanChannels = 0;
     uint16_t scanDuration = 0;
 
-    sNcpThreadMutex->lock();
-    SuccessOrExit(error = otLinkActiveScan(mController->GetInstance(), scanChannels, scanDuration,
-                                           &UbusServer::HandleActiveScanResult, this));
-exit:
-    sNcpThreadMutex->unlock();
-    return;
+    return otLinkActiveScan(mController->GetInstance(), scanChannels, scanDuration, &UbusServer::HandleActiveScanResult,
+                            this);
 }
 
 void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
@@ -240,14 +270,63 @@ void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aCont
     static_cast<UbusServer *>(aContext)->HandleActiveScanResultDetail(aResult);
 }
 
-void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
+// The helpers below encode values straight into the blob buffer, without temporary strings.
+
+static void AddHexString(struct blob_buf *aBuf, const char *aName, const uint8_t *aBytes, uint8_t aLength)
+{
+    char *output = static_cast<char *>(blobmsg_alloc_string_buffer(aBuf, aName, 2 * aLength + 1));
+
+    VerifyOrExit(output != nullptr);
+    HexCodec::Encode(aBytes, aLength, output, /* aLowerCase */ true);
+    output[2 * aLength] = '\0';
+    blobmsg_add_string_buffer(aBuf);
+
+exit:
+    return;
+}
+
+static void AddHex16String(struct blob_buf *aBuf, const char *aName, uint16_t aValue)
 {
-    char byte2char[5] = "";
-    for (int i = 0; i < aLength; i++)
+    const uint8_t bytes[] = {static_cast<uint8_t>(aValue >> 8), static_cast<uint8_t>(aValue & 0xff)};
+    char *        output  = static_cast<char *>(blobmsg_alloc_string_buffer(aBuf, aName, sizeof("0x0000")));
+
+    VerifyOrExit(output != nullptr);
+    output[0] = '0';
+    output[1] = 'x';
+    HexCodec::Encode(bytes, sizeof(bytes), output + 2, /* aLowerCase */ true);
+    output[2 + 2 * sizeof(bytes)] = '\0';
+    blobmsg_add_string_buffer(aBuf);
+
+exit:
+    return;
+}
+
+static void AddModeString(struct blob_buf *aBuf,
+                          const char *     aName,
+                          bool             aRxOnWhenIdle,
+                          bool             aFullThreadDevice,
+                          bool             aFullNetworkData)
+{
+    char  mode[sizeof("rdn")];
+    char *end = mode;
+
+    if (aRxOnWhenIdle)
     {
-        sprintf(byte2char, "%02x", aBytes[i]);
-        strcat(aOutput, byte2char);
+        *end++ = 'r';
     }
+
+    if (aFullThreadDevice)
+    {
+        *end++ = 'd';
+    }
+
+    if (aFullNetworkData)
+    {
+        *end++ = 'n';
+    }
+
+    *end = '\0';
+    blobmsg_add_string(aBuf, aName, mode);
 }
 
 void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest)
@@ -260,35 +339,32 @@ void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
 {
     void *jsonList = nullptr;
 
-    char panidstring[PANID_LENGTH];
-    char xpanidstring[XPANID_LENGTH] = "";
-
     if (aResult == nullptr)
     {
-        blobmsg_close_array(&mBuf, sJsonUri);
-        mIfFinishScan = true;
+        blobmsg_close_array(&mScanBuf, mScanList);
+        blobmsg_add_u16(&mScanBuf, "Error", OT_ERROR_NONE);
+        ubus_send_reply(mContext, &mScanRequest, mScanBuf.head);
+        ubus_complete_deferred_request(mContext, &mScanRequest, UBUS_STATUS_OK);
+        mIsScanning = false;
         goto exit;
     }
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
+    jsonList = blobmsg_open_table(&mScanBuf, nullptr);
 
-    blobmsg_add_u32(&mBuf, "IsJoinable", aResult->mIsJoinable);
+    blobmsg_add_u32(&mScanBuf, "IsJoinable", aResult->mIsJoinable);
 
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
+    blobmsg_add_string(&mScanBuf, "NetworkName", aResult->mNetworkName.m8);
 
-    OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
+    AddHexString(&mScanBuf, "ExtendedPanId", aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE);
+    AddHex16String(&mScanBuf, "PanId", aResult->mPanId);
 
-    sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
+    blobmsg_add_u32(&mScanBuf, "Channel", aResult->mChannel);
 
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
+    blobmsg_add_u32(&mScanBuf, "Rssi", aResult->mRssi);
 
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
+    blobmsg_add_u32(&mScanBuf, "Lqi", aResult->mLqi);
 
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
-
-    blobmsg_close_table(&mBuf, jsonList);
+    blobmsg_close_table(&mScanBuf, jsonList);
 
 exit:
     return;
@@ -313,31 +389,25 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    otError error = OT_ERROR_NONE;
 
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
+    VerifyOrExit(!mIsScanning, error = OT_ERROR_BUSY);
 
-    mIfFinishScan = 0;
-    sUbusServerInstance->ProcessScan();
+    blob_buf_init(&mScanBuf, 0);
+    mScanList = blobmsg_open_array(&mScanBuf, "scan_list");
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
+    SuccessOrExit(error = ProcessScan());
 
-    while (!mIfFinishScan)
-    {
-        sleep(1);
-    }
+    // The reply is sent when the scan is done, see `HandleActiveScanResultDetail()`.
+    ubus_defer_request(aContext, aRequest, &mScanRequest);
+    mIsScanning = true;
 
 exit:
-    AppendResult(error, aContext, aRequest);
+    if (error != OT_ERROR_NONE)
+    {
+        blob_buf_init(&mBuf, 0);
+        AppendResult(error, aContext, aRequest);
+    }
     return 0;
 }
 
@@ -539,6 +609,24 @@ int UbusServer::UbusPartitionIdHandler(struct ubus_context *     aContext,
     return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "partitionid");
 }
 
+int UbusServer::UbusStatusHandler(struct ubus_context *     aContext,
+                                  struct ubus_object *      aObj,
+                                  struct ubus_request_data *aRequest,
+                                  const char *              aMethod,
+                                  struct blob_attr *        aMsg)
+{
+    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "status");
+}
+
+int UbusServer::UbusMetricsHandler(struct ubus_context *     aContext,
+                                   struct ubus_object *      aObj,
+                                   struct ubus_request_data *aRequest,
+                                   const char *              aMethod,
+                                   struct blob_attr *        aMsg)
+{
+    return GetInstance().UbusMetricsHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+}
+
 int UbusServer::UbusLeaveHandler(struct ubus_context *     aContext,
                                  struct ubus_object *      aObj,
                                  struct ubus_request_data *aRequest,
@@ -602,6 +690,18 @@ int UbusServer::UbusJoinerAddHandler(struct ubus_context *     aContext,
     return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "joineradd");
 }
 
+int UbusServer::UbusJoinerAddBatchHandler(struct ubus_context *     aContext,
+                                          struct ubus_object *      aObj,
+                                          struct ubus_request_data *aRequest,
+                                          const char *              aMethod,
+                                          struct blob_attr *        aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+
+    return GetInstance().UbusJoinerAddBatch(aContext, aRequest, aMsg);
+}
+
 int UbusServer::UbusMacfilterAddrHandler(struct ubus_context *     aContext,
                                          struct ubus_object *      aObj,
                                          struct ubus_request_data *aRequest,
@@ -666,25 +766,34 @@ int UbusServer::UbusLeaveHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    otError error = OT_ERROR_NONE;
 
-    sNcpThreadMutex->lock();
     otInstanceFactoryReset(mController->GetInstance());
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
+    blob_buf_init(&mBuf, 0);
+
+    AppendResult(error, aContext, aRequest);
+    return 0;
+}
+
+int UbusServer::UbusMetricsHandlerDetail(struct ubus_context *     aContext,
+                                         struct ubus_object *      aObj,
+                                         struct ubus_request_data *aRequest,
+                                         const char *              aMethod,
+                                         struct blob_attr *        aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
+
+    otError     error = OT_ERROR_NONE;
+    std::string metrics;
+
+    MetricsRegistry::Get().Render(metrics);
 
     blob_buf_init(&mBuf, 0);
+    blobmsg_add_string(&mBuf, "metrics", metrics.c_str());
 
-exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -705,19 +814,16 @@ int UbusServer::UbusThreadHandler(struct ubus_context *     aContext,
 
     if (!strcmp(aAction, "start"))
     {
-        sNcpThreadMutex->lock();
         SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), true));
         SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), true));
     }
     else if (!strcmp(aAction, "stop"))
     {
-        sNcpThreadMutex->lock();
         SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), false));
         SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), false));
     }
 
 exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -734,28 +840,24 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
 
     otError      error = OT_ERROR_NONE;
     otRouterInfo parentInfo;
-    char         extAddress[XPANID_LENGTH] = "";
-    char         transfer[XPANID_LENGTH]   = "";
-    void *       jsonList                  = nullptr;
-    void *       jsonArray                 = nullptr;
+    char         transfer[XPANID_LENGTH] = "";
+    void *       jsonList                = nullptr;
+    void *       jsonArray               = nullptr;
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
     SuccessOrExit(error = otThreadGetParentInfo(mController->GetInstance(), &parentInfo));
 
     jsonArray = blobmsg_open_array(&mBuf, "parent_list");
     jsonList  = blobmsg_open_table(&mBuf, "parent");
     blobmsg_add_string(&mBuf, "Role", "R");
 
-    sprintf(transfer, "0x%04x", parentInfo.mRloc16);
-    blobmsg_add_string(&mBuf, "Rloc16", transfer);
+    AddHex16String(&mBuf, "Rloc16", parentInfo.mRloc16);
 
     sprintf(transfer, "%3d", parentInfo.mAge);
     blobmsg_add_string(&mBuf, "Age", transfer);
 
-    OutputBytes(parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8), extAddress);
-    blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+    AddHexString(&mBuf, "ExtAddress", parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8));
 
     blobmsg_add_u16(&mBuf, "LinkQualityIn", parentInfo.mLinkQualityIn);
 
@@ -763,7 +865,6 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
     blobmsg_close_array(&mBuf, jsonArray);
 
 exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return error;
 }
@@ -780,25 +881,21 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context *     aContext,
 
     otError                error = OT_ERROR_NONE;
     otNeighborInfo         neighborInfo;
-    otNeighborInfoIterator iterator                  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-    char                   transfer[XPANID_LENGTH]   = "";
-    void *                 jsonList                  = nullptr;
-    char                   mode[5]                   = "";
-    char                   extAddress[XPANID_LENGTH] = "";
+    otNeighborInfoIterator iterator                = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    char                   transfer[XPANID_LENGTH] = "";
+    void *                 jsonList                = nullptr;
 
     blob_buf_init(&mBuf, 0);
 
     sJsonUri = blobmsg_open_array(&mBuf, "neighbor_list");
 
-    sNcpThreadMutex->lock();
     while (otThreadGetNextNeighborInfo(mController->GetInstance(), &iterator, &neighborInfo) == OT_ERROR_NONE)
     {
         jsonList = blobmsg_open_table(&mBuf, nullptr);
 
         blobmsg_add_string(&mBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
 
-        sprintf(transfer, "0x%04x", neighborInfo.mRloc16);
-        blobmsg_add_string(&mBuf, "Rloc16", transfer);
+        AddHex16String(&mBuf, "Rloc16", neighborInfo.mRloc16);
 
         sprintf(transfer, "%3d", neighborInfo.mAge);
         blobmsg_add_string(&mBuf, "Age", transfer);
@@ -809,37 +906,17 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context *     aContext,
         sprintf(transfer, "%9d", neighborInfo.mLastRssi);
         blobmsg_add_string(&mBuf, "LastRssi", transfer);
 
-        if (neighborInfo.mRxOnWhenIdle)
-        {
-            strcat(mode, "r");
-        }
-
-        if (neighborInfo.mFullThreadDevice)
-        {
-            strcat(mode, "d");
-        }
-
-        if (neighborInfo.mFullNetworkData)
-        {
-            strcat(mode, "n");
-        }
-        blobmsg_add_string(&mBuf, "Mode", mode);
-
-        OutputBytes(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8), extAddress);
-        blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+        AddModeString(&mBuf, "Mode", neighborInfo.mRxOnWhenIdle, neighborInfo.mFullThreadDevice,
+                      neighborInfo.mFullNetworkData);
+        AddHexString(&mBuf, "ExtAddress", neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8));
 
         blobmsg_add_u16(&mBuf, "LinkQualityIn", neighborInfo.mLinkQualityIn);
 
         blobmsg_close_table(&mBuf, jsonList);
-
-        memset(mode, 0, sizeof(mode));
-        memset(extAddress, 0, sizeof(extAddress));
     }
 
     blobmsg_close_array(&mBuf, sJsonUri);
 
-    sNcpThreadMutex->unlock();
-
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -934,8 +1011,6 @@ int UbusServer::UbusCommissioner(struct ubus_context *     aContext,
 
     otError error = OT_ERROR_NONE;
 
-    sNcpThreadMutex->lock();
-
     if (!strcmp(aAction, "start"))
     {
         if (otCommissionerGetState(mController->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
@@ -1000,12 +1075,57 @@ int UbusServer::UbusCommissioner(struct ubus_context *     aContext,
     }
 
 exit:
-    sNcpThreadMutex->unlock();
     blob_buf_init(&mBuf, 0);
     AppendResult(error, aContext, aRequest);
     return 0;
 }
 
+int UbusServer::UbusJoinerAddBatch(struct ubus_context *     aContext,
+                                   struct ubus_request_data *aRequest,
+                                   struct blob_attr *        aMsg)
+{
+    otError                  error = OT_ERROR_NONE;
+    struct blob_attr *       tb[ADD_JOINERS_MAX];
+    struct blob_attr *       cur;
+    unsigned int             rem;
+    std::vector<std::string> joinerIds;
+    std::vector<std::string> pskds;
+    uint32_t                 timeout = kDefaultJoinerTimeout;
+    SteeringData             steeringData;
+
+    blob_buf_init(&mBuf, 0);
+
+    blobmsg_parse(addJoinersPolicy, ADD_JOINERS_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+    VerifyOrExit(tb[JOINERS] != nullptr, error = OT_ERROR_INVALID_ARGS);
+    if (tb[JOINERS_TIMEOUT] != nullptr)
+    {
+        timeout = blobmsg_get_u32(tb[JOINERS_TIMEOUT]);
+    }
+
+    blobmsg_for_each_attr(cur, tb[JOINERS], rem)
+    {
+        struct blob_attr *joiner[JOINER_MAX];
+
+        VerifyOrExit(blobmsg_type(cur) == BLOBMSG_TYPE_TABLE, error = OT_ERROR_INVALID_ARGS);
+        blobmsg_parse(joinerPolicy, JOINER_MAX, joiner, blobmsg_data(cur), blobmsg_data_len(cur));
+        VerifyOrExit(joiner[JOINER_PSKD] != nullptr, error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit((joiner[JOINER_EUI64] == nullptr) != (joiner[JOINER_DISCERNER] == nullptr),
+                     error = OT_ERROR_INVALID_ARGS);
+
+        joinerIds.push_back(blobmsg_get_string(joiner[JOINER_EUI64] != nullptr ? joiner[JOINER_EUI64]
+                                                                                : joiner[JOINER_DISCERNER]));
+        pskds.push_back(blobmsg_get_string(joiner[JOINER_PSKD]));
+    }
+
+    SuccessOrExit(error = mController->GetThreadHelper()->AddJoiners(joinerIds, pskds, timeout, steeringData));
+
+    AddHexString(&mBuf, "SteeringData", steeringData.GetBloomFilter(), steeringData.GetLength());
+
+exit:
+    AppendResult(error, aContext, aRequest);
+    return 0;
+}
+
 void UbusServer::HandleStateChanged(otCommissionerState aState, void *aContext)
 {
     static_cast<UbusServer *>(aContext)->HandleStateChanged(aState);
@@ -1077,7 +1197,6 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
     if (!strcmp(aAction, "networkname"))
         blobmsg_add_string(&mBuf, "NetworkName", otThreadGetNetworkName(mController->GetInstance()));
     else if (!strcmp(aAction, "state"))
@@ -1089,63 +1208,47 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
     else if (!strcmp(aAction, "channel"))
         blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(mController->GetInstance()));
     else if (!strcmp(aAction, "panid"))
-    {
-        char panIdString[PANID_LENGTH];
-        sprintf(panIdString, "0x%04x", otLinkGetPanId(mController->GetInstance()));
-        blobmsg_add_string(&mBuf, "PanId", panIdString);
-    }
+        AddHex16String(&mBuf, "PanId", otLinkGetPanId(mController->GetInstance()));
     else if (!strcmp(aAction, "rloc16"))
-    {
-        char rloc[PANID_LENGTH];
-        sprintf(rloc, "0x%04x", otThreadGetRloc16(mController->GetInstance()));
-        blobmsg_add_string(&mBuf, "rloc16", rloc);
-    }
+        AddHex16String(&mBuf, "rloc16", otThreadGetRloc16(mController->GetInstance()));
     else if (!strcmp(aAction, "masterkey"))
     {
-        char           outputKey[MASTERKEY_LENGTH] = "";
         const uint8_t *key = reinterpret_cast<const uint8_t *>(otThreadGetMasterKey(mController->GetInstance()));
-        OutputBytes(key, OT_MASTER_KEY_SIZE, outputKey);
-        blobmsg_add_string(&mBuf, "Masterkey", outputKey);
+        AddHexString(&mBuf, "Masterkey", key, OT_MASTER_KEY_SIZE);
     }
     else if (!strcmp(aAction, "pskc"))
     {
-        char          outputPskc[MASTERKEY_LENGTH] = "";
-        const otPskc *pskc                         = otThreadGetPskc(mController->GetInstance());
-        OutputBytes(pskc->m8, OT_MASTER_KEY_SIZE, outputPskc);
-        blobmsg_add_string(&mBuf, "pskc", outputPskc);
+        const otPskc *pskc = otThreadGetPskc(mController->GetInstance());
+        AddHexString(&mBuf, "pskc", pskc->m8, OT_MASTER_KEY_SIZE);
     }
     else if (!strcmp(aAction, "extpanid"))
     {
-        char           outputExtPanId[XPANID_LENGTH] = "";
         const uint8_t *extPanId =
             reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mController->GetInstance()));
-        OutputBytes(extPanId, OT_EXT_PAN_ID_SIZE, outputExtPanId);
-        blobmsg_add_string(&mBuf, "ExtPanId", outputExtPanId);
+        AddHexString(&mBuf, "ExtPanId", extPanId, OT_EXT_PAN_ID_SIZE);
     }
     else if (!strcmp(aAction, "mode"))
     {
-        otLinkModeConfig linkMode;
-        char             mode[5] = "";
-
-        memset(&linkMode, 0, sizeof(otLinkModeConfig));
-
-        linkMode = otThreadGetLinkMode(mController->GetInstance());
-
-        if (linkMode.mRxOnWhenIdle)
-        {
-            strcat(mode, "r");
-        }
-
-        if (linkMode.mDeviceType)
-        {
-            strcat(mode, "d");
-        }
+        otLinkModeConfig linkMode = otThreadGetLinkMode(mController->GetInstance());
+        AddModeString(&mBuf, "Mode", linkMode.mRxOnWhenIdle, linkMode.mDeviceType, linkMode.mNetworkData);
+    }
+    else if (!strcmp(aAction, "status"))
+    {
+        // Answers the periodic status polls with a single round trip. Credentials are left out on purpose.
+        otInstance *     instance = mController->GetInstance();
+        otLinkModeConfig linkMode = otThreadGetLinkMode(instance);
+        const uint8_t *  extPanId = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(instance));
+        char             state[10];
 
-        if (linkMode.mNetworkData)
-        {
-            strcat(mode, "n");
-        }
-        blobmsg_add_string(&mBuf, "Mode", mode);
+        GetState(instance, state);
+        blobmsg_add_string(&mBuf, "State", state);
+        blobmsg_add_string(&mBuf, "NetworkName", otThreadGetNetworkName(instance));
+        blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(instance));
+        AddHex16String(&mBuf, "PanId", otLinkGetPanId(instance));
+        AddHexString(&mBuf, "ExtPanId", extPanId, OT_EXT_PAN_ID_SIZE);
+        AddHex16String(&mBuf, "rloc16", otThreadGetRloc16(instance));
+        blobmsg_add_u32(&mBuf, "Partitionid", otThreadGetPartitionId(instance));
+        AddModeString(&mBuf, "Mode", linkMode.mRxOnWhenIdle, linkMode.mDeviceType, linkMode.mNetworkData);
     }
     else if (!strcmp(aAction, "partitionid"))
     {
@@ -1169,44 +1272,33 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
     }
     else if (!strcmp(aAction, "networkdata"))
     {
-        ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
-        if (time(nullptr) - mSecond > 10)
+        // Reply from the last collection for a while, otherwise wait for the collection shared by all callers.
+        if (!mIsCollectingNetworkdata && time(nullptr) - mSecond <= kNetworkdataCacheTime)
         {
-            struct otIp6Address address;
-            uint8_t             tlvTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
-            uint8_t             count             = 0;
-            char                multicastAddr[10] = "ff03::2";
-
-            blob_buf_init(&mNetworkdataBuf, 0);
-
-            SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
-
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+            ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
+            goto exit;
+        }
 
-            sBufNum = 0;
-            otThreadSendDiagnosticGet(mController->GetInstance(), &address, tlvTypes, count,
-                                      &UbusServer::HandleDiagnosticGetResponse, this);
-            mSecond = time(nullptr);
+        if (mIsCollectingNetworkdata || (error = StartNetworkdataCollection()) == OT_ERROR_NONE)
+        {
+            mNetworkdataRequests.emplace_back();
+            ubus_defer_request(aContext, aRequest, &mNetworkdataRequests.back());
+            goto exit;
         }
-        goto exit;
     }
     else if (!strcmp(aAction, "joinernum"))
     {
         void *       jsonTable = nullptr;
         void *       jsonArray = nullptr;
         otJoinerInfo joinerInfo;
-        uint16_t     iterator        = 0;
-        int          joinerNum       = 0;
-        char         eui64[EXTPANID] = "";
+        uint16_t     iterator  = 0;
+        int          joinerNum = 0;
 
         blob_buf_init(&mBuf, 0);
 
         jsonArray = blobmsg_open_array(&mBuf, "joinerList");
         while (otCommissionerGetNextJoinerInfo(mController->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
         {
-            memset(eui64, 0, sizeof(eui64));
-
             jsonTable = blobmsg_open_table(&mBuf, nullptr);
 
             blobmsg_add_string(&mBuf, "pskd", joinerInfo.mPskd.m8);
@@ -1218,8 +1310,7 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
                 break;
             case OT_JOINER_INFO_TYPE_EUI64:
                 blobmsg_add_u16(&mBuf, "isAny", 0);
-                OutputBytes(joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8), eui64);
-                blobmsg_add_string(&mBuf, "eui64", eui64);
+                AddHexString(&mBuf, "eui64", joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8));
                 break;
             case OT_JOINER_INFO_TYPE_DISCERNER:
                 blobmsg_add_u16(&mBuf, "isAny", 0);
@@ -1270,9 +1361,7 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
 
         while (otLinkFilterGetNextAddress(mController->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
         {
-            char extAddress[XPANID_LENGTH] = "";
-            OutputBytes(entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8), extAddress);
-            blobmsg_add_string(&mBuf, "addr", extAddress);
+            AddHexString(&mBuf, "addr", entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8));
         }
 
         blobmsg_close_array(&mBuf, sJsonUri);
@@ -1284,10 +1373,107 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
 
     AppendResult(error, aContext, aRequest);
 exit:
-    sNcpThreadMutex->unlock();
     return 0;
 }
 
+otError UbusServer::StartNetworkdataCollection(void)
+{
+    static const uint8_t kTlvTypes[] = {
+        OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS,
+        OT_NETWORK_DIAGNOSTIC_TLV_ROUTE,
+        OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE,
+    };
+
+    otError             error;
+    struct otIp6Address address;
+
+    SuccessOrExit(error = otIp6AddressFromString("ff03::2", &address));
+
+    blob_buf_init(&mNetworkdataCollectBuf, 0);
+    mNetworkdataResponders.clear();
+    sBufNum = 0;
+
+    SuccessOrExit(error = otThreadSendDiagnosticGet(mController->GetInstance(), &address, kTlvTypes, sizeof(kTlvTypes),
+                                                    &UbusServer::HandleDiagnosticGetResponse, this));
+
+    mIsCollectingNetworkdata = true;
+    mNetworkdataTimeout      = mController->PostTimerTask(Milliseconds(kNetworkdataCollectTimeout),
+                                                     [this]() { FinishNetworkdataCollection(); });
+
+exit:
+    return error;
+}
+
+bool UbusServer::HasAllNetworkdata(void) const
+{
+    otInstance * instance = mController->GetInstance();
+    bool         hasAll   = false;
+    otDeviceRole role     = otThreadGetDeviceRole(instance);
+    uint16_t     rloc16   = otThreadGetRloc16(instance);
+    uint8_t      maxRouterId;
+    uint16_t     maxChildren;
+    otRouterInfo routerInfo;
+    otChildInfo  childInfo;
+
+    // The responders are only known from the router table of a router.
+    VerifyOrExit(role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER);
+
+    maxRouterId = otThreadGetMaxRouterId(instance);
+
+    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    {
+        if (otThreadGetRouterInfo(instance, i, &routerInfo) != OT_ERROR_NONE || !routerInfo.mAllocated ||
+            routerInfo.mRloc16 == rloc16)
+        {
+            continue;
+        }
+
+        VerifyOrExit(mNetworkdataResponders.count(routerInfo.mRloc16) != 0);
+    }
+
+    // Full Thread Device children are subscribed to the multicast address of all routers.
+    maxChildren = otThreadGetMaxAllowedChildren(instance);
+
+    for (uint16_t i = 0; i < maxChildren; ++i)
+    {
+        if (otThreadGetChildInfoByIndex(instance, i, &childInfo) != OT_ERROR_NONE || !childInfo.mFullThreadDevice)
+        {
+            continue;
+        }
+
+        VerifyOrExit(mNetworkdataResponders.count(childInfo.mRloc16) != 0);
+    }
+
+    hasAll = true;
+
+exit:
+    return hasAll;
+}
+
+void UbusServer::FinishNetworkdataCollection(void)
+{
+    VerifyOrExit(mIsCollectingNetworkdata);
+
+    mIsCollectingNetworkdata = false;
+    mNetworkdataTimeout.Cancel();
+    std::swap(mNetworkdataBuf, mNetworkdataCollectBuf);
+    mSecond = time(nullptr);
+
+    for (struct ubus_request_data &request : mNetworkdataRequests)
+    {
+        if (mContext != nullptr)
+        {
+            ubus_send_reply(mContext, &request, mNetworkdataBuf.head);
+            ubus_complete_deferred_request(mContext, &request, UBUS_STATUS_OK);
+        }
+    }
+
+    mNetworkdataRequests.clear();
+
+exit:
+    return;
+}
+
 void UbusServer::HandleDiagnosticGetResponse(otError              aError,
                                              otMessage *          aMessage,
                                              const otMessageInfo *aMessageInfo,
@@ -1314,33 +1500,38 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
     uint16_t              sockRloc16 = 0;
     void *                jsonArray  = nullptr;
     void *                jsonItem   = nullptr;
-    char                  xrloc[10];
     otNetworkDiagTlv      diagTlv;
     otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
 
     SuccessOrExit(aError);
+    // Late responses to a finished collection are dropped.
+    VerifyOrExit(mIsCollectingNetworkdata);
 
     char networkdata[20];
     sprintf(networkdata, "networkdata%d", sBufNum);
-    sJsonUri = blobmsg_open_table(&mNetworkdataBuf, networkdata);
+    sJsonUri = blobmsg_open_table(&mNetworkdataCollectBuf, networkdata);
     sBufNum++;
 
     if (IsRoutingLocator(&aMessageInfo->mSockAddr))
     {
         sockRloc16 = ntohs(aMessageInfo->mPeerAddr.mFields.m16[7]);
-        sprintf(xrloc, "0x%04x", sockRloc16);
-        blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
+        AddHex16String(&mNetworkdataCollectBuf, "rloc", sockRloc16);
     }
 
     while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv) == OT_ERROR_NONE)
     {
         switch (diagTlv.mType)
         {
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+            // Only requested to know which nodes have answered.
+            mNetworkdataResponders.insert(diagTlv.mData.mAddr16);
+            break;
+
         case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
         {
             const otNetworkDiagRoute &route = diagTlv.mData.mRoute;
 
-            jsonArray = blobmsg_open_array(&mNetworkdataBuf, "routedata");
+            jsonArray = blobmsg_open_array(&mNetworkdataCollectBuf, "routedata");
 
             for (uint16_t i = 0; i < route.mRouteCount; ++i)
             {
@@ -1349,21 +1540,20 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
                 out = route.mRouteData[i].mLinkQualityOut;
                 if (in != 0 && out != 0)
                 {
-                    jsonItem = blobmsg_open_table(&mNetworkdataBuf, "router");
+                    jsonItem = blobmsg_open_table(&mNetworkdataCollectBuf, "router");
                     rloc16   = route.mRouteData[i].mRouterId << 10;
-                    blobmsg_add_u32(&mNetworkdataBuf, "routerid", route.mRouteData[i].mRouterId);
-                    sprintf(xrloc, "0x%04x", rloc16);
-                    blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
-                    blobmsg_close_table(&mNetworkdataBuf, jsonItem);
+                    blobmsg_add_u32(&mNetworkdataCollectBuf, "routerid", route.mRouteData[i].mRouterId);
+                    AddHex16String(&mNetworkdataCollectBuf, "rloc", rloc16);
+                    blobmsg_close_table(&mNetworkdataCollectBuf, jsonItem);
                 }
             }
-            blobmsg_close_array(&mNetworkdataBuf, jsonArray);
+            blobmsg_close_array(&mNetworkdataCollectBuf, jsonArray);
             break;
         }
 
         case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
         {
-            jsonArray = blobmsg_open_array(&mNetworkdataBuf, "childdata");
+            jsonArray = blobmsg_open_array(&mNetworkdataCollectBuf, "childdata");
             for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
             {
                 enum
@@ -1376,17 +1566,16 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
 
                 uint8_t mode = 0;
 
-                jsonItem = blobmsg_open_table(&mNetworkdataBuf, "child");
-                sprintf(xrloc, "0x%04x", (sockRloc16 | entry.mChildId));
-                blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
+                jsonItem = blobmsg_open_table(&mNetworkdataCollectBuf, "child");
+                AddHex16String(&mNetworkdataCollectBuf, "rloc", sockRloc16 | entry.mChildId);
 
                 mode = (entry.mMode.mRxOnWhenIdle ? kModeRxOnWhenIdle : 0) |
                        (entry.mMode.mDeviceType ? kModeFullThreadDevice : 0) |
                        (entry.mMode.mNetworkData ? kModeFullNetworkData : 0);
-                blobmsg_add_u16(&mNetworkdataBuf, "mode", mode);
-                blobmsg_close_table(&mNetworkdataBuf, jsonItem);
+                blobmsg_add_u16(&mNetworkdataCollectBuf, "mode", mode);
+                blobmsg_close_table(&mNetworkdataCollectBuf, jsonItem);
             }
-            blobmsg_close_array(&mNetworkdataBuf, jsonArray);
+            blobmsg_close_array(&mNetworkdataCollectBuf, jsonArray);
             break;
         }
 
@@ -1396,7 +1585,12 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
         }
     }
 
-    blobmsg_close_table(&mNetworkdataBuf, sJsonUri);
+    blobmsg_close_table(&mNetworkdataCollectBuf, sJsonUri);
+
+    if (HasAllNetworkdata())
+    {
+        FinishNetworkdataCollection();
+    }
 
 exit:
     if (aError != OT_ERROR_NONE)
@@ -1420,7 +1614,6 @@ int UbusServer::UbusSetInformation(struct ubus_context *     aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
     if (!strcmp(aAction, "networkname"))
     {
         struct blob_attr *tb[SET_NETWORK_MAX];
@@ -1594,7 +1787,6 @@ int UbusServer::UbusSetInformation(struct ubus_context *     aContext,
     }
 
 exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -1630,50 +1822,40 @@ void UbusServer::GetState(otInstance *aInstance, char *aState)
 
 void UbusServer::UbusAddFd()
 {
-    // ubus library function
-    ubus_add_uloop(mContext);
-
 #ifdef FD_CLOEXEC
     fcntl(mContext->sock.fd, F_SETFD, fcntl(mContext->sock.fd, F_GETFD) | FD_CLOEXEC);
 #endif
-}
 
-void UbusServer::UbusReconnTimer(struct uloop_timeout *aTimeout)
-{
-    GetInstance().UbusReconnTimerDetail(aTimeout);
+    mIsConnected = true;
 }
 
-void UbusServer::UbusReconnTimerDetail(struct uloop_timeout *aTimeout)
+void UbusServer::UbusReconnect(void)
 {
-    OT_UNUSED_VARIABLE(aTimeout);
-
-    static struct uloop_timeout retry = {
-        list : {},
-        pending : false,
-        cb : UbusReconnTimer,
-        time : {},
-    };
-    int time = 2;
-
     if (ubus_reconnect(mContext, mSockPath) != 0)
     {
-        uloop_timeout_set(&retry, time * 1000);
-        return;
+        mController->PostTimerTask(Milliseconds(kReconnectInterval), [this]() { UbusReconnect(); });
+        ExitNow();
     }
 
     UbusAddFd();
+
+exit:
+    return;
 }
 
 void UbusServer::UbusConnectionLost(struct ubus_context *aContext)
 {
-    OT_UNUSED_VARIABLE(aContext);
+    UbusServer &server = GetInstance();
+
+    // The socket stays readable at end of file until it is reconnected.
+    server.mIsConnected = false;
+    MainloopManager::GetInstance().RemoveFd(aContext->sock.fd);
 
-    UbusReconnTimer(nullptr);
+    server.UbusReconnect();
 }
 
 int UbusServer::DisplayUbusInit(const char *aPath)
 {
-    uloop_init();
     signal(SIGPIPE, SIG_IGN);
 
     mSockPath = aPath;
@@ -1717,15 +1899,36 @@ void UbusServer::InstallUbusObject(void)
     if (-1 == DisplayUbusInit(path))
     {
         otbrLogErr("Ubus connect failed");
-        return;
     }
+}
+
+void UbusServer::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(mIsConnected);
+
+    FD_SET(mContext->sock.fd, &aMainloop.mReadFdSet);
+
+    if (aMainloop.mMaxFd < mContext->sock.fd)
+    {
+        aMainloop.mMaxFd = mContext->sock.fd;
+    }
+
+exit:
+    return;
+}
 
-    otbrLogInfo("Uloop run");
-    uloop_run();
+void UbusServer::Process(const MainloopContext &aMainloop)
+{
+    VerifyOrExit(mIsConnected);
 
-    DisplayUbusDone();
+    if (FD_ISSET(mContext->sock.fd, &aMainloop.mReadFdSet))
+    {
+        // Handlers run right here on the mainloop, so they may use the OpenThread instance without locking.
+        ubus_handle_event(mContext);
+    }
 
-    uloop_done();
+exit:
+    return;
 }
 
 otError UbusServer::ParseLong(char *aString, long &aLong)
@@ -1788,59 +1991,3 @@ exit:
 
 } // namespace ubus
 } // namespace otbr
-
-void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController, std::mutex *aNcpThreadMutex)
-{
-    otbr::ubus::sNcpThreadMutex = aNcpThreadMutex;
-    otbr::ubus::sUbusEfd        = eventfd(0, 0);
-
-    otbr::ubus::UbusServer::Initialize(aController);
-
-    if (otbr::ubus::sUbusEfd == -1)
-    {
-        perror("Failed to create eventfd for ubus");
-        exit(EXIT_FAILURE);
-    }
-}
-
-void UbusServerRun(void)
-{
-    otbr::ubus::UbusServer::GetInstance().InstallUbusObject();
-}
-
-void UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd)
-{
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    FD_SET(otbr::ubus::sUbusEfd, &aReadFdSet);
-
-    if (aMaxFd < otbr::ubus::sUbusEfd)
-    {
-        aMaxFd = otbr::ubus::sUbusEfd;
-    }
-
-exit:
-    return;
-}
-
-void UbusProcess(const fd_set &aReadFdSet)
-{
-    ssize_t  retval;
-    uint64_t num;
-
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    if (FD_ISSET(otbr::ubus::sUbusEfd, &aReadFdSet))
-    {
-        retval = read(otbr::ubus::sUbusEfd, &num, sizeof(uint64_t));
-        if (retval != sizeof(uint64_t))
-        {
-            perror("read ubus eventfd failed\n");
-            exit(EXIT_FAILURE);
-        }
-        goto exit;
-    }
-
-exit:
-    return;
-}
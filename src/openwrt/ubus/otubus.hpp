@@ -38,6 +38,10 @@
 
 #include <stdarg.h>
 #include <time.h>
+#include <sys/select.h>
+
+#include <set>
+#include <vector>
 
 #include <openthread/ip6.h>
 #include <openthread/link.h>
@@ -45,6 +49,8 @@
 #include <openthread/udp.h>
 
 #include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 
 extern "C" {
 #include <libubox/blobmsg_json.h>
@@ -69,7 +75,7 @@ namespace ubus {
  *
  */
 
-class UbusServer
+class UbusServer : public MainloopProcessor
 {
 public:
     /**
@@ -93,6 +99,24 @@ public:
      */
     void InstallUbusObject(void);
 
+    /**
+     * This method adds the ubus socket to the read fd set of the mainloop.
+     *
+     * @param[inout]  aMainloop  A reference to the mainloop to be updated.
+     *
+     */
+    void Update(MainloopContext &aMainloop) override;
+
+    /**
+     * This method handles the ubus requests received by the ubus socket.
+     *
+     * All ubus method handlers are called by this method on the mainloop thread.
+     *
+     * @param[in]  aMainloop  A reference to the mainloop context.
+     *
+     */
+    void Process(const MainloopContext &aMainloop) override;
+
     /**
      * This method handle ubus scan function request.
      *
@@ -435,6 +459,48 @@ public:
                                       const char *              aMethod,
                                       struct blob_attr *        aMsg);
 
+    /**
+     * This method handle ubus get status function request.
+     *
+     * The reply bundles state, network name, channel, PAN IDs, RLOC16, partition id and mode, so that status
+     * polling takes one round trip instead of one per value.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    static int UbusStatusHandler(struct ubus_context *     aContext,
+                                 struct ubus_object *      aObj,
+                                 struct ubus_request_data *aRequest,
+                                 const char *              aMethod,
+                                 struct blob_attr *        aMsg);
+
+    /**
+     * This method handle ubus get metrics function request.
+     *
+     * The reply holds the agent metrics in the Prometheus text exposition format, the same as the `/metrics`
+     * resource of the Rest server.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    static int UbusMetricsHandler(struct ubus_context *     aContext,
+                                  struct ubus_object *      aObj,
+                                  struct ubus_request_data *aRequest,
+                                  const char *              aMethod,
+                                  struct blob_attr *        aMsg);
+
     /**
      * This method handle ubus get leaderdata function request.
      *
@@ -687,6 +753,24 @@ public:
                                     const char *              aMethod,
                                     struct blob_attr *        aMsg);
 
+    /**
+     * This method handle ubus add joiners in batch function request.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    static int UbusJoinerAddBatchHandler(struct ubus_context *     aContext,
+                                         struct ubus_object *      aObj,
+                                         struct ubus_request_data *aRequest,
+                                         const char *              aMethod,
+                                         struct blob_attr *        aMsg);
+
     /**
      * This method handle ubus remove joiner function request.
      *
@@ -766,16 +850,30 @@ public:
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
 private:
-    bool                       mIfFinishScan;
+    bool                       mIsScanning;
+    bool                       mIsConnected;
     struct ubus_context *      mContext;
     const char *               mSockPath;
     struct blob_buf            mBuf;
-    struct blob_buf            mNetworkdataBuf;
+    struct blob_buf            mScanBuf; ///< Collects the scan results, other requests may use `mBuf` meanwhile.
+    void *                     mScanList;
+    struct ubus_request_data   mScanRequest;
+    struct blob_buf            mNetworkdataBuf;        ///< The network data of the last collection.
+    struct blob_buf            mNetworkdataCollectBuf; ///< The network data of the collection in progress.
+    bool                       mIsCollectingNetworkdata;
+    std::set<uint16_t>         mNetworkdataResponders; ///< The RLOC16s which answered the collection in progress.
+    TaskRunner::TaskHandle     mNetworkdataTimeout;
     Ncp::ControllerOpenThread *mController;
-    time_t                     mSecond;
+    time_t                     mSecond; ///< The time of the last network data collection.
+
+    std::vector<struct ubus_request_data> mNetworkdataRequests; ///< The requests waiting for the collection.
+
     enum
     {
-        kDefaultJoinerTimeout = 120,
+        kDefaultJoinerTimeout      = 120,
+        kReconnectInterval         = 2000, ///< The interval in milliseconds to retry connecting to ubus.
+        kNetworkdataCollectTimeout = 2000, ///< The max time in milliseconds to wait for diagnostic responses.
+        kNetworkdataCacheTime      = 10,   ///< The time in seconds the last network data is replied from.
     };
 
     /**
@@ -788,8 +886,32 @@ private:
     /**
      * This method start scan.
      *
+     * @returns  The error of starting the active scan.
+     *
      */
-    void ProcessScan(void);
+    otError ProcessScan(void);
+
+    /**
+     * This method starts collecting the network data from all routers.
+     *
+     * @returns  The error of sending the diagnostic request.
+     *
+     */
+    otError StartNetworkdataCollection(void);
+
+    /**
+     * This method indicates whether all routers and Full Thread Device children have answered the collection.
+     *
+     * @returns  Whether all expected nodes have answered.
+     *
+     */
+    bool HasAllNetworkdata(void) const;
+
+    /**
+     * This method finishes the collection in progress, and replies to all requests waiting for it.
+     *
+     */
+    void FinishNetworkdataCollection(void);
 
     /**
      * This method detailly start scan.
@@ -898,6 +1020,24 @@ private:
                                const char *              aMethod,
                                struct blob_attr *        aMsg);
 
+    /**
+     * This method handle get metrics request.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    int UbusMetricsHandlerDetail(struct ubus_context *     aContext,
+                                 struct ubus_object *      aObj,
+                                 struct ubus_request_data *aRequest,
+                                 const char *              aMethod,
+                                 struct blob_attr *        aMsg);
+
     /**
      * This method handle thread related request.
      *
@@ -978,6 +1118,20 @@ private:
                          struct blob_attr *        aMsg,
                          const char *              aAction);
 
+    /**
+     * This method handle the request to add joiners in batch.
+     *
+     * All the joiners are added before the steering data is computed once and replied.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    int UbusJoinerAddBatch(struct ubus_context *aContext, struct ubus_request_data *aRequest, struct blob_attr *aMsg);
+
     /**
      * This method handle conmmissione state change (callback function).
      *
@@ -1037,20 +1191,10 @@ private:
     void UbusAddFd(void);
 
     /**
-     * This method set ubus reconnect time.
-     *
-     * @param[in]   aTimeout    A pointer to the timeout.
-     *
-     */
-    static void UbusReconnTimer(struct uloop_timeout *aTimeout);
-
-    /**
-     * This method detailly handle ubus reconnect time.
-     *
-     * @param[in]   aTimeout    A pointer to the timeout.
+     * This method reconnects to ubus, and retries later on failure.
      *
      */
-    void UbusReconnTimerDetail(struct uloop_timeout *aTimeout);
+    void UbusReconnect(void);
 
     /**
      * This method handle ubus connection lost.
@@ -1099,16 +1243,6 @@ private:
      */
     int Hex2Bin(const char *aHex, uint8_t *aBin, uint16_t aBinLength);
 
-    /**
-     * This method output bytes into char*.
-     *
-     * @param[in]   aBytes  A pointer to the bytes need to be convert.
-     * @param[in]   aLength The length of the bytes.
-     * @param[out]  aOutput A pointer to the char* string.
-     *
-     */
-    void OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput);
-
     /**
      * This method append result in message passed to ubus.
      *
@@ -0,0 +1,108 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/client_rate_limiter.hpp"
+
+#include <algorithm>
+
+namespace otbr {
+namespace rest {
+
+ClientRateLimiter::ClientRateLimiter(double aRate, double aBurst, size_t aMaxClients)
+    : mRate(aRate)
+    , mBurst(aBurst)
+    , mMaxClients(aMaxClients)
+{
+}
+
+double ClientRateLimiter::GetTokens(const Bucket &aBucket, Timepoint aNow) const
+{
+    double elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(aNow - aBucket.mTime).count();
+
+    return std::min(mBurst, aBucket.mTokens + elapsed * mRate);
+}
+
+void ClientRateLimiter::Evict(Timepoint aNow)
+{
+    auto oldest = mBuckets.end();
+
+    // The bucket of a client which has been idle long enough to refill is the same as a new one.
+    for (auto it = mBuckets.begin(); it != mBuckets.end();)
+    {
+        if (GetTokens(it->second, aNow) >= mBurst)
+        {
+            it = mBuckets.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (mBuckets.size() >= mMaxClients)
+    {
+        for (auto it = mBuckets.begin(); it != mBuckets.end(); ++it)
+        {
+            if (oldest == mBuckets.end() || it->second.mTime < oldest->second.mTime)
+            {
+                oldest = it;
+            }
+        }
+
+        if (oldest != mBuckets.end())
+        {
+            mBuckets.erase(oldest);
+        }
+    }
+}
+
+bool ClientRateLimiter::Admit(uint32_t aClientAddress, Timepoint aNow)
+{
+    bool    admitted = false;
+    Bucket *bucket;
+
+    if (mBuckets.size() >= mMaxClients && mBuckets.count(aClientAddress) == 0)
+    {
+        Evict(aNow);
+    }
+
+    bucket          = &mBuckets.emplace(aClientAddress, Bucket{mBurst, aNow}).first->second;
+    bucket->mTokens = GetTokens(*bucket, aNow);
+    bucket->mTime   = aNow;
+
+    if (bucket->mTokens >= 1)
+    {
+        bucket->mTokens -= 1;
+        admitted = true;
+    }
+
+    return admitted;
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,106 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the per client rate limit of the REST server.
+ */
+
+#ifndef OTBR_REST_CLIENT_RATE_LIMITER_HPP_
+#define OTBR_REST_CLIENT_RATE_LIMITER_HPP_
+
+#include <unordered_map>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class limits the request rate of each client with a token bucket, keyed by the IPv4 address of the client.
+ *
+ * The number of buckets is bounded. Buckets which have refilled are evicted first, as they are the same as new ones,
+ * then the bucket idle for the longest time.
+ *
+ */
+class ClientRateLimiter
+{
+public:
+    /**
+     * This constructor initializes a rate limiter without any clients.
+     *
+     * @param[in]  aRate        The number of requests refilled per second.
+     * @param[in]  aBurst       The max number of requests in a burst.
+     * @param[in]  aMaxClients  The max number of clients tracked.
+     *
+     */
+    ClientRateLimiter(double aRate, double aBurst, size_t aMaxClients);
+
+    /**
+     * This method takes a token of a client if it has one.
+     *
+     * @param[in]  aClientAddress  The IPv4 address of the client.
+     * @param[in]  aNow            The current time.
+     *
+     * @retval  true   The request of the client is admitted.
+     * @retval  false  The client exceeds its rate limit.
+     *
+     */
+    bool Admit(uint32_t aClientAddress, Timepoint aNow);
+
+    /**
+     * This method returns the number of clients tracked.
+     *
+     * @returns  The number of buckets.
+     *
+     */
+    size_t GetClientCount(void) const { return mBuckets.size(); }
+
+private:
+    struct Bucket
+    {
+        double    mTokens;
+        Timepoint mTime;
+    };
+
+    double GetTokens(const Bucket &aBucket, Timepoint aNow) const;
+    void   Evict(Timepoint aNow);
+
+    const double                         mRate;
+    const double                         mBurst;
+    const size_t                         mMaxClients;
+    std::unordered_map<uint32_t, Bucket> mBuckets;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_CLIENT_RATE_LIMITER_HPP_
@@ -26,14 +26,25 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_TAG "REST"
+
 #include "rest/connection.hpp"
 
+#include <algorithm>
 #include <cerrno>
 
 #include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
 
 #include <sys/socket.h>
-#include <sys/time.h>
+#include <sys/uio.h>
+
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/memory_usage.hpp"
+#include "common/time.hpp"
+#include "common/trace.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -46,21 +57,55 @@ namespace rest {
 // The timeout (in microseconds) since a connection is in wait callback state
 static const uint32_t kCallbackTimeout = 10000000;
 
-// The time interval (in microseconds) for checking again if there is a connection need callback.
-static const uint32_t kCallbackCheckInterval = 500000;
-
 // The timeout (in microseconds) since a connection is in wait write state
 static const uint32_t kWriteTimeout = 10000000;
 
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
+// The timeout (in microseconds) since a kept-alive connection is waiting for its next request
+static const uint32_t kIdleTimeout = 5000000;
+
+// Maximum number of requests served by a single connection before it is closed
+static const uint32_t kMaxRequestsPerConnection = 100;
+
+// The max number of bytes read from the socket at a time
+static const size_t kReadBufferSize = 2048;
+
+#if OTBR_REST_GZIP
+#ifndef OTBR_REST_GZIP_THRESHOLD
+#define OTBR_REST_GZIP_THRESHOLD 1024
+#endif
+
+// The max number of bytes of the compressed body in a chunk
+static const size_t kGzipChunkSize = 4096;
+#endif
+
+// All connections measure their timeouts against the time of the mainloop iteration, so that they expire together.
+static steady_clock::time_point GetNow(void)
+{
+    return MainloopManager::GetInstance().GetNow();
+}
+
+Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd, uint32_t aClientAddress)
     : mTimeStamp(aStartTime)
     , mFd(aFd)
+    , mClientAddress(aClientAddress)
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
     , mResource(aResource)
+    , mWriteBody(nullptr)
+    , mWriteOffset(0)
+    , mRequestCount(0)
+    , mKeepAlive(false)
+#if OTBR_ENABLE_IO_URING
+    , mReadOp(nullptr)
+    , mWriteOp(nullptr)
+    , mReadResult(0)
+    , mWriteResult(0)
+    , mHasReadResult(false)
+    , mHasWriteResult(false)
+#endif
 {
 }
 
@@ -69,34 +114,78 @@ Connection::~Connection(void)
     Disconnect();
 }
 
-void Connection::Init(void)
+void Connection::Reset(steady_clock::time_point aStartTime, int aFd, uint32_t aClientAddress)
+{
+    assert(mState == ConnectionState::kComplete && mFd == -1);
+
+    mTimeStamp     = aStartTime;
+    mFd            = aFd;
+    mClientAddress = aClientAddress;
+    mState         = ConnectionState::kInit;
+    mRequest.Reset();
+    mResponse.Reset();
+    mWriteHeader.clear();
+    mWriteBody   = nullptr;
+    mWriteOffset = 0;
+#if OTBR_REST_GZIP
+    mGzipChunk.clear();
+#endif
+    mEventStream.Clear();
+    mPendingInput.clear();
+    mRequestCount = 0;
+    mKeepAlive    = false;
+    mWakeHandler  = nullptr;
+#if OTBR_ENABLE_IO_URING
+    mIoHandler = nullptr;
+#endif
+}
+
+void Connection::Init(std::function<void(void)> aWakeHandler, std::function<void(uint8_t aEvents)> aIoHandler)
 {
     mParser.Init();
+    mWakeHandler = std::move(aWakeHandler);
+#if OTBR_ENABLE_IO_URING
+    mIoHandler = std::move(aIoHandler);
+#else
+    OTBR_UNUSED_VARIABLE(aIoHandler);
+#endif
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+uint8_t Connection::GetFdEvents(void) const
 {
-    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
+    uint8_t events = 0;
+
+#if OTBR_ENABLE_IO_URING
+    // Requests and responses are read and written through io_uring, only event streams wait for socket readiness.
+    if (IoUring::Get().IsAvailable() && mState != ConnectionState::kEventStream)
     {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        return events;
     }
-}
+#endif
 
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
-{
-    if (mState == ConnectionState::kWriteWait)
+    // The read side of an event stream is only kept to detect that the client closes the connection.
+    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit ||
+        mState == ConnectionState::kIdleWait || (mState == ConnectionState::kEventStream && mKeepAlive))
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        events |= MainloopManager::kEventReadable;
     }
+
+    if (mState == ConnectionState::kWriteWait ||
+        (mState == ConnectionState::kEventStream && mEventStream.HasPending()))
+    {
+        events |= MainloopManager::kEventWritable;
+    }
+
+    return events;
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+Timepoint Connection::GetDeadline(void) const
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    uint32_t  timeoutLen = kReadTimeout;
+    Timepoint deadline;
+
+    // The comments sent to an idle event stream are paced by the stream.
+    VerifyOrExit(mState != ConnectionState::kEventStream, deadline = mEventStream.GetDeadline());
 
     switch (mState)
     {
@@ -104,11 +193,15 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
         timeoutLen = kReadTimeout;
         break;
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+        // A response completed before its connection started waiting is written right away.
+        timeoutLen = mResponse.IsCompletionReady() ? 0 : kCallbackTimeout;
         break;
     case ConnectionState::kWriteWait:
         timeoutLen = kWriteTimeout;
         break;
+    case ConnectionState::kIdleWait:
+        timeoutLen = kIdleTimeout;
+        break;
     case ConnectionState::kComplete:
         timeoutLen = 0;
         break;
@@ -116,90 +209,116 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
         break;
     }
 
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
-    }
+    deadline = timeoutLen == 0 ? GetNow() : mTimeStamp + microseconds(timeoutLen);
 
-    if (timercmp(&timeout, &aTimeout, <))
-    {
-        aTimeout = timeout;
-    }
-}
-
-void Connection::Update(MainloopContext &aMainloop)
-{
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
+exit:
+    return deadline;
 }
 
 void Connection::Disconnect(void)
 {
     mState = ConnectionState::kComplete;
+    mResponse.SetCompletionHandler(nullptr);
+#if OTBR_REST_GZIP
+    // A closed connection may be kept for reuse, never hold the memory of the encoder meanwhile.
+    mGzip.Stop();
+#endif
 
     if (mFd != -1)
     {
+#if OTBR_ENABLE_IO_URING
+        CancelIo();
+#endif
+        MainloopManager::GetInstance().UnregisterFd(mFd);
         close(mFd);
         mFd = -1;
     }
 }
 
-void Connection::Process(const MainloopContext &aMainloop)
+void Connection::Process(uint8_t aEvents)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    // Errors and hang-ups are found out by reading or writing the socket.
+    bool readable = (aEvents & (MainloopManager::kEventReadable | MainloopManager::kEventError |
+                                MainloopManager::kEventHangup)) != 0;
+    bool writable = (aEvents & (MainloopManager::kEventWritable | MainloopManager::kEventError |
+                                MainloopManager::kEventHangup)) != 0;
 
     switch (mState)
     {
     // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
+    case ConnectionState::kIdleWait:
+        ProcessWaitRead(readable);
         break;
     case ConnectionState::kCallbackWait:
         //  Wait for Callback process.
         ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        ProcessWaitWrite(writable);
+        break;
+    case ConnectionState::kEventStream:
+        ProcessEventStream(readable, writable);
         break;
     default:
         assert(false);
     }
-
-    if (error != OTBR_ERROR_NONE)
-    {
-        Disconnect();
-    }
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(bool aReadable)
 {
     otbrError error    = OTBR_ERROR_NONE;
     int32_t   received = 0, err;
-    char      buf[2048];
-    auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    char      buf[kReadBufferSize];
+    auto      duration = duration_cast<microseconds>(GetNow() - mTimeStamp).count();
+
+    if (mState == ConnectionState::kIdleWait)
+    {
+        // Silently close a kept-alive connection which has been idle for too long.
+        if (duration >= kIdleTimeout)
+        {
+            Disconnect();
+            ExitNow();
+        }
 
-    // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
+        VerifyOrExit(aReadable);
+    }
+    else
+    {
+        // Reach a read timeout, will send response about this timeout later.
+        VerifyOrExit(duration < kReadTimeout, error = OTBR_ERROR_REST);
 
-    // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+        // It will succeed either fd is readable or it is in kInit state.
+        VerifyOrExit(aReadable || mState == ConnectionState::kInit);
+    }
 
     do
     {
-        mState   = ConnectionState::kReadWait;
-        received = read(mFd, buf, sizeof(buf));
+        received = Receive(buf, sizeof(buf));
         err      = errno;
+
+        if (mState == ConnectionState::kIdleWait)
+        {
+            // The client closed a kept-alive connection between two requests.
+            if (received == 0)
+            {
+                Disconnect();
+                ExitNow();
+            }
+
+            VerifyOrExit(received > 0);
+
+            // The read timeout of the next request starts with its first data.
+            mTimeStamp = steady_clock::now();
+        }
+
+        mState = ConnectionState::kReadWait;
+
         if (received > 0)
         {
-            mParser.Process(buf, received);
+            // The request has been rejected if it fails to parse.
+            VerifyOrExit(Parse(buf, received) == OTBR_ERROR_NONE);
         }
     } while ((received > 0 && !mRequest.IsComplete()) || err == EINTR);
 
@@ -232,20 +351,58 @@ exit:
     }
 }
 
+otbrError Connection::Parse(const char *aBuf, size_t aLength)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    size_t    parsed = mParser.Process(aBuf, aLength);
+
+    if (mRequest.IsComplete())
+    {
+        mPendingInput.append(aBuf + parsed, aLength - parsed);
+    }
+    else if (mParser.GetError() == HPE_CB_url || mParser.GetError() == HPE_CB_body)
+    {
+        // The request exceeds the limits of the request buffer, reject it and close the connection.
+        error      = OTBR_ERROR_REST;
+        mKeepAlive = false;
+        mResource->ErrorHandler(mResponse, mParser.GetError() == HPE_CB_url ? HttpStatusCode::kStatusUriTooLong
+                                                                            : HttpStatusCode::kStatusPayloadTooLarge);
+        Write();
+    }
+
+    return error;
+}
+
 void Connection::Handle(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    // Try to close server read side here, because we have started to handle the request and no longler read from
-    // socket.
-    VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    ++mRequestCount;
+    mKeepAlive = mParser.ShouldKeepAlive() && mRequestCount < kMaxRequestsPerConnection;
+    otbrTrace(TraceEvent::kRestRequest, static_cast<uint32_t>(mFd), mRequestCount);
+    otbrProbe(rest__request__start, mFd, mRequest.GetUrl().c_str());
 
-    mResource->Handle(mRequest, mResponse);
+    if (!mKeepAlive)
+    {
+        // Try to close server read side here, because we have started to handle the last request and no longer read
+        // from socket.
+        VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    }
+
+    if (mResource->AdmitRequest(mClientAddress))
+    {
+        mResource->Handle(mRequest, mResponse);
+    }
+    else
+    {
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusTooManyRequests);
+    }
 
     if (mResponse.NeedCallback())
     {
         mState     = ConnectionState::kCallbackWait;
         mTimeStamp = steady_clock::now();
+        mResponse.SetCompletionHandler(mWakeHandler);
     }
     else
     {
@@ -264,11 +421,9 @@ exit:
 
 void Connection::ProcessWaitCallback(void)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
-
-    mResource->HandleCallback(mRequest, mResponse);
+    auto duration = duration_cast<microseconds>(GetNow() - mTimeStamp).count();
 
-    if (mResponse.IsComplete())
+    if (mResponse.ApplyCompletion())
     {
         Write();
     }
@@ -282,13 +437,13 @@ void Connection::ProcessWaitCallback(void)
     }
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::ProcessWaitWrite(bool aWritable)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto duration = duration_cast<microseconds>(GetNow() - mTimeStamp).count();
 
-    if (duration <= kWriteTimeout)
+    if (duration < kWriteTimeout)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
+        if (aWritable)
         {
             Write();
         }
@@ -301,61 +456,408 @@ void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
 
 void Connection::Write(void)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorCode;
-    int32_t     sendLength;
-    int32_t     err;
+    otbrError    error     = OTBR_ERROR_NONE;
+    bool         nextChunk = false;
+    int          iovCount;
+    struct iovec iov[2];
+    ssize_t      sendLength;
 
     if (mState != ConnectionState::kWriteWait)
     {
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        mState     = ConnectionState::kWriteWait;
+        mTimeStamp = steady_clock::now();
+        mWriteBody = &mResponse.GetBody();
+        mResponse.SetKeepAlive(mKeepAlive);
+        otbrTrace(TraceEvent::kRestResponse, static_cast<uint32_t>(mFd), static_cast<uint32_t>(mWriteBody->size()));
+        otbrProbe(rest__request__end, mFd, mWriteBody->size());
+
+#if OTBR_REST_GZIP
+        // Large bodies are compressed on the fly for the clients accepting it, one chunk at a time.
+        // Chunked transfer encoding is only understood by HTTP/1.1 clients.
+        if (!mResponse.IsEventStream() && mWriteBody->size() >= OTBR_REST_GZIP_THRESHOLD &&
+            mParser.SupportsChunkedEncoding() && mRequest.AcceptsEncoding("gzip") &&
+            mGzip.Start(mWriteBody->data(), mWriteBody->size()) == OTBR_ERROR_NONE)
+        {
+            mResponse.SetGzip();
+            mWriteBody = &mGzipChunk;
+            NextGzipChunk();
+        }
+#endif
+
+        mResponse.SerializeHeader(mWriteHeader);
+        mWriteOffset = 0;
+    }
+
+    do
+    {
+        const std::string &body = *mWriteBody;
+
+        iovCount  = 0;
+        nextChunk = false;
+
+        // Send the rest of the header and the body in place, the body is never copied.
+        if (mWriteOffset < mWriteHeader.size())
+        {
+            iov[iovCount].iov_base = &mWriteHeader[mWriteOffset];
+            iov[iovCount].iov_len  = mWriteHeader.size() - mWriteOffset;
+            ++iovCount;
+        }
+
+        if (mWriteOffset < mWriteHeader.size() + body.size())
+        {
+            size_t bodyOffset = mWriteOffset > mWriteHeader.size() ? mWriteOffset - mWriteHeader.size() : 0;
+
+            iov[iovCount].iov_base = const_cast<char *>(body.data()) + bodyOffset;
+            iov[iovCount].iov_len  = body.size() - bodyOffset;
+            ++iovCount;
+        }
+
+        sendLength = Send(iov, iovCount);
+
+        if (sendLength >= 0)
+        {
+            mWriteOffset += static_cast<size_t>(sendLength);
+
+            // Write successfully
+            if (mWriteOffset == mWriteHeader.size() + body.size())
+            {
+                if (mResponse.IsEventStream())
+                {
+                    StartEventStream();
+                }
+#if OTBR_REST_GZIP
+                else if (mWriteBody == &mGzipChunk && NextGzipChunk())
+                {
+                    // Continue with the next chunk, the header has been sent.
+                    mWriteHeader.clear();
+                    mWriteOffset = 0;
+                    nextChunk    = true;
+                }
+#endif
+                else if (mKeepAlive)
+                {
+                    StartNextRequest();
+                }
+                else
+                {
+                    // Normal Exit
+                    Disconnect();
+                }
+            }
+#if OTBR_ENABLE_IO_URING
+            else if (IoUring::Get().IsAvailable())
+            {
+                // Queue the rest right away, the socket is not watched for writability.
+                Write();
+            }
+#endif
+        }
+        else if (errno == EINTR)
+        {
+            // Try again
+            Write();
+        }
+        else
+        {
+            // There is an error when we write, if this, we directly disconnect this connection.
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_REST);
+        }
+    } while (nextChunk);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Disconnect();
+    }
+}
+
+void Connection::SendEvent(const std::string &aEvent)
+{
+    otbrError error;
+
+    VerifyOrExit(mState == ConnectionState::kEventStream);
+
+    error = mEventStream.Send(mFd, aEvent, GetNow());
+
+    if (error == OTBR_ERROR_BUSY)
+    {
+        otbrLogWarning("Event stream client is too slow, disconnecting");
     }
 
-    // Check we do have something to write.
-    VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
+    if (error != OTBR_ERROR_NONE)
+    {
+        Disconnect();
+    }
 
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
-    err        = errno;
+exit:
+    return;
+}
+
+void Connection::StartEventStream(void)
+{
+    mState = ConnectionState::kEventStream;
+    mEventStream.Start(GetNow());
+}
+
+void Connection::ProcessEventStream(bool aReadable, bool aWritable)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      buf[128];
 
-    // Write successfully
-    if (sendLength == static_cast<int32_t>(mWriteContent.size()))
+    if (mKeepAlive && aReadable)
+    {
+        ssize_t received = read(mFd, buf, sizeof(buf));
+
+        // Clients don't send anything on an event stream, except closing it.
+        if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+        {
+            Disconnect();
+            ExitNow();
+        }
+    }
+
+    if (aWritable)
+    {
+        SuccessOrExit(error = mEventStream.Flush(mFd, GetNow()));
+    }
+
+    error = mEventStream.Process(mFd, GetNow());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
     {
-        // Normal Exit
         Disconnect();
     }
-    else if (sendLength > 0)
+}
+
+#if OTBR_REST_GZIP
+bool Connection::NextGzipChunk(void)
+{
+    bool    hasChunk = !mGzip.IsFinished();
+    uint8_t data[kGzipChunkSize];
+    char    chunkSize[sizeof("ffffffffffffffff\r\n")];
+    size_t  length;
+
+    VerifyOrExit(hasChunk);
+
+    length = mGzip.Encode(data, sizeof(data));
+    mGzipChunk.clear();
+
+    if (length > 0)
+    {
+        snprintf(chunkSize, sizeof(chunkSize), "%" PRIx64 "\r\n", static_cast<uint64_t>(length));
+        mGzipChunk += chunkSize;
+        mGzipChunk.append(reinterpret_cast<const char *>(data), length);
+        mGzipChunk += "\r\n";
+    }
+
+    if (mGzip.IsFinished())
+    {
+        // The last chunk, which has a size of zero.
+        mGzipChunk += "0\r\n\r\n";
+        mGzip.Stop();
+    }
+
+exit:
+    return hasChunk;
+}
+#endif
+
+void Connection::StartNextRequest(void)
+{
+    std::string input;
+
+    mRequest.Reset();
+    mResponse.Reset();
+    mWriteHeader.clear();
+    mWriteOffset = 0;
+    mKeepAlive   = false;
+    mParser.Resume();
+
+    mState     = ConnectionState::kIdleWait;
+    mTimeStamp = steady_clock::now();
+
+    VerifyOrExit(!mPendingInput.empty());
+
+    // Serve the pipelined requests already received.
+    input.swap(mPendingInput);
+    mState = ConnectionState::kReadWait;
+    SuccessOrExit(Parse(input.data(), input.size()));
+
+    if (mRequest.IsComplete())
+    {
+        Handle();
+    }
+
+exit:
+#if OTBR_ENABLE_IO_URING
+    // Wait for the rest of the request or the next one, the socket is not watched for readability.
+    if (mState == ConnectionState::kIdleWait || mState == ConnectionState::kReadWait)
+    {
+        PostRead();
+    }
+#endif
+    return;
+}
+
+ssize_t Connection::Receive(char *aBuf, size_t aLength)
+{
+    ssize_t received;
+
+#if OTBR_ENABLE_IO_URING
+    if (mHasReadResult)
+    {
+        received = mReadResult;
+
+        if (mReadResult > 0)
+        {
+            received = static_cast<ssize_t>(std::min(aLength, mReadData.size()));
+            memcpy(aBuf, mReadData.data(), static_cast<size_t>(received));
+            mReadData.erase(0, static_cast<size_t>(received));
+        }
+        else if (mReadResult < 0)
+        {
+            errno    = -mReadResult;
+            received = -1;
+        }
+
+        mHasReadResult = !mReadData.empty();
+    }
+    else if (PostRead())
     {
-        // Partly write
-        mWriteContent = mWriteContent.substr(sendLength);
+        // The data is handed over once the kernel completes the read.
+        errno    = EAGAIN;
+        received = -1;
     }
     else
+#endif
     {
-        if (errno == EINTR)
+        received = read(mFd, aBuf, aLength);
+    }
+
+    return received;
+}
+
+ssize_t Connection::Send(const struct iovec *aIov, int aIovCount)
+{
+    ssize_t sent;
+
+#if OTBR_ENABLE_IO_URING
+    if (mHasWriteResult)
+    {
+        // The result of the write queued by a previous call, which was given the same data.
+        mHasWriteResult = false;
+        sent            = mWriteResult;
+
+        if (mWriteResult < 0)
         {
-            // Try again
-            Write();
+            errno = -mWriteResult;
+            sent  = -1;
+        }
+    }
+    else if (mWriteOp != nullptr ||
+             (mWriteOp = IoUring::Get().Writev(mFd, aIov, aIovCount, [this](int aResult, const uint8_t *) {
+                  mWriteOp = nullptr;
+
+                  // Retried writes have written nothing.
+                  mWriteResult    = (aResult == -EAGAIN || aResult == -EINTR) ? 0 : aResult;
+                  mHasWriteResult = true;
+                  HandleIoCompleted(MainloopManager::kEventWritable);
+              })) != nullptr)
+    {
+        errno = EAGAIN;
+        sent  = -1;
+    }
+    else
+#endif
+    {
+        sent = writev(mFd, aIov, aIovCount);
+    }
+
+    return sent;
+}
+
+#if OTBR_ENABLE_IO_URING
+bool Connection::PostRead(void)
+{
+    VerifyOrExit(mReadOp == nullptr && !mHasReadResult);
+
+    mReadOp = IoUring::Get().Read(mFd, kReadBufferSize, [this](int aResult, const uint8_t *aData) {
+        mReadOp = nullptr;
+
+        if (aResult == -EAGAIN || aResult == -EINTR)
+        {
+            // Nothing has been read, try again.
+            PostRead();
         }
         else
         {
-            // There is an error when we write, if this, we directly disconnect this connection.
-            VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+            mReadResult    = aResult;
+            mHasReadResult = true;
+
+            if (aResult > 0)
+            {
+                mReadData.assign(reinterpret_cast<const char *>(aData), static_cast<size_t>(aResult));
+            }
+
+            HandleIoCompleted(MainloopManager::kEventReadable);
         }
-    }
+    });
 
 exit:
-    if (error != OTBR_ERROR_NONE)
+    return mReadOp != nullptr;
+}
+
+void Connection::CancelIo(void)
+{
+    if (mWriteOp != nullptr)
     {
-        Disconnect();
+        // The buffers of the response are reused once the connection is closed, the kernel must not write them anymore.
+        OTBR_UNUSED_VARIABLE(shutdown(mFd, SHUT_RDWR));
+    }
+
+    IoUring::Get().Cancel(mReadOp);
+    IoUring::Get().Cancel(mWriteOp);
+    mReadOp  = nullptr;
+    mWriteOp = nullptr;
+    mReadData.clear();
+    mHasReadResult  = false;
+    mHasWriteResult = false;
+}
+
+void Connection::HandleIoCompleted(uint8_t aEvents)
+{
+    // Call a copy as the connection may be released by the handler.
+    std::function<void(uint8_t)> handler = mIoHandler;
+
+    if (handler != nullptr)
+    {
+        handler(aEvents);
     }
 }
+#endif
 
 bool Connection::IsComplete() const
 {
     return mState == ConnectionState::kComplete;
 }
 
+size_t Connection::GetMemorySize(void) const
+{
+    size_t size = sizeof(*this) + MemoryUsage::GetHeapSize(mWriteHeader) + mEventStream.GetMemorySize() +
+                  MemoryUsage::GetHeapSize(mPendingInput);
+
+#if OTBR_ENABLE_IO_URING
+    size += MemoryUsage::GetHeapSize(mReadData);
+#endif
+
+#if OTBR_REST_GZIP
+    size += MemoryUsage::GetHeapSize(mGzipChunk);
+#endif
+
+    return size;
+}
+
 } // namespace rest
 } // namespace otbr
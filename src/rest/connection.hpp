@@ -34,13 +34,29 @@
 #ifndef OTBR_REST_CONNECTION_HPP_
 #define OTBR_REST_CONNECTION_HPP_
 
+#include <functional>
+
 #include <string.h>
 #include <unistd.h>
 
-#include "common/mainloop.hpp"
+#include <sys/uio.h>
+
+#if OTBR_ENABLE_IO_URING
+#include "common/io_uring.hpp"
+#endif
+#include "common/time.hpp"
+#include "rest/event_stream.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
 
+#ifndef OTBR_REST_GZIP
+#define OTBR_REST_GZIP 0
+#endif
+
+#if OTBR_REST_GZIP
+#include "utils/gzip_encoder.hpp"
+#endif
+
 using std::chrono::steady_clock;
 
 namespace otbr {
@@ -50,48 +66,73 @@ namespace rest {
  * This class implements a Connection class of each socket connection.
  *
  */
-class Connection : public MainloopProcessor
+class Connection
 {
 public:
     /**
      * The constructor is to initialize a socket connection instance.
      *
-     * @param[in]   aStartTime  The reference start time of a conneciton which is set when created for the first time
-     * and maybe reset when transfer to wait callback or wait write state.
-     * @param[in]   aResource   A pointer to the resource handler.
-     * @param[in]   aFd         The file descriptor for the conneciton.
+     * @param[in]   aStartTime      The reference start time of a conneciton which is set when created for the first
+     *                              time and maybe reset when transfer to wait callback or wait write state.
+     * @param[in]   aResource       A pointer to the resource handler.
+     * @param[in]   aFd             The file descriptor for the conneciton.
+     * @param[in]   aClientAddress  The IPv4 address of the client, in network byte order.
      *
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd, uint32_t aClientAddress);
 
     /**
      * The desctructor destroys the connection instance.
      *
      */
-    ~Connection(void) override;
+    ~Connection(void);
+
+    /**
+     * This method resets a closed connection for a new socket, so that the connection is reused.
+     *
+     * The buffers of the connection are emptied but keep their capacity. `Init()` must be called afterwards.
+     *
+     * @param[in]   aStartTime      The reference start time of the new socket.
+     * @param[in]   aFd             The file descriptor of the new socket.
+     * @param[in]   aClientAddress  The IPv4 address of the client, in network byte order.
+     *
+     */
+    void Reset(steady_clock::time_point aStartTime, int aFd, uint32_t aClientAddress);
 
     /**
      * This method initializes the connection.
      *
+     * @param[in]  aWakeHandler  The handler called when a deferred response of the connection is completed, after
+     *                           which the connection should be processed again.
+     * @param[in]  aIoHandler    The handler called when a read or write of the connection queued to io_uring is
+     *                           completed, which should process the connection with the given events.
      *
      */
-    void Init(void);
+    void Init(std::function<void(void)> aWakeHandler, std::function<void(uint8_t aEvents)> aIoHandler);
 
     /**
-     * This method updates the mainloop context.
+     * This method processes the connection, either for events of its socket or for its deadline.
      *
-     * @param[inout]  aMainloop  A reference to the mainloop to be updated.
+     * @param[in]  aEvents  The events of the socket, in `MainloopManager` events, or 0 when woken up by the deadline.
      *
      */
-    void Update(MainloopContext &aMainloop) override;
+    void Process(uint8_t aEvents);
 
     /**
-     * This method processes mainloop events.
+     * This method returns the events of the socket the connection waits for in its current state.
      *
-     * @param[in]  aMainloop  A reference to the mainloop context.
+     * @returns  The events to wait for, in `MainloopManager` events.
      *
      */
-    void Process(const MainloopContext &aMainloop) override;
+    uint8_t GetFdEvents(void) const;
+
+    /**
+     * This method returns the time when the connection must be processed again even without any socket event.
+     *
+     * @returns  The deadline of the current state of the connection.
+     *
+     */
+    Timepoint GetDeadline(void) const;
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -102,16 +143,51 @@ public:
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method sends a server-sent event if this connection is an event stream.
+     *
+     * @param[in]  aEvent  The formatted event.
+     *
+     */
+    void SendEvent(const std::string &aEvent);
+
+    /**
+     * This method returns the IPv4 address of the client.
+     *
+     * @returns  The IPv4 address of the client, in network byte order.
+     *
+     */
+    uint32_t GetClientAddress(void) const { return mClientAddress; }
+
+    /**
+     * This method estimates the memory used by this connection.
+     *
+     * @returns  The estimated number of bytes of the connection and its buffers, response bodies excluded.
+     *
+     */
+    size_t GetMemorySize(void) const;
+
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
-    void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
-    void Write(void);
-    void Handle(void);
-    void Disconnect(void);
+    void      ProcessWaitRead(bool aReadable);
+    void      ProcessWaitCallback(void);
+    void      ProcessWaitWrite(bool aWritable);
+    void      Write(void);
+    void      Handle(void);
+    otbrError Parse(const char *aBuf, size_t aLength);
+    void      StartNextRequest(void);
+    void      StartEventStream(void);
+    void      ProcessEventStream(bool aReadable, bool aWritable);
+    void      Disconnect(void);
+    ssize_t   Receive(char *aBuf, size_t aLength);
+    ssize_t   Send(const struct iovec *aIov, int aIovCount);
+#if OTBR_REST_GZIP
+    bool NextGzipChunk(void);
+#endif
+#if OTBR_ENABLE_IO_URING
+    bool PostRead(void);
+    void CancelIo(void);
+    void HandleIoCompleted(uint8_t aEvents);
+#endif
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
@@ -119,6 +195,9 @@ private:
     // File descriptor for this connection
     int mFd;
 
+    // IPv4 address of the client, in network byte order
+    uint32_t mClientAddress;
+
     // Enum indicates the state of this connection
     ConnectionState mState;
 
@@ -134,8 +213,49 @@ private:
     // Resource handler instance
     Resource *mResource;
 
-    // Write buffer in case write multiple times
-    std::string mWriteContent;
+    // Serialized status line and headers of the response being written
+    std::string mWriteHeader;
+
+    // The data written after the header, either the body of the response or the current chunk of the gzip body
+    const std::string *mWriteBody;
+
+    // Number of bytes of the header and body written so far
+    size_t mWriteOffset;
+
+#if OTBR_REST_GZIP
+    // The encoder of a compressed body, and the chunk of the compressed body being written
+    GzipEncoder mGzip;
+    std::string mGzipChunk;
+#endif
+
+    // Events pending to be sent to an event stream
+    EventStream mEventStream;
+
+    // Data received after the current request, i.e. pipelined requests
+    std::string mPendingInput;
+
+    // Number of requests handled on this connection
+    uint32_t mRequestCount;
+
+    // Whether the connection is kept open after the current response
+    bool mKeepAlive;
+
+    // Handler waking up the connection when a deferred response is completed
+    std::function<void(void)> mWakeHandler;
+
+#if OTBR_ENABLE_IO_URING
+    // Handler processing the connection when a queued read or write is completed
+    std::function<void(uint8_t)> mIoHandler;
+
+    // The reads and writes in flight, and the results of the completed ones not consumed yet
+    IoUring::Operation *mReadOp;
+    IoUring::Operation *mWriteOp;
+    std::string         mReadData;
+    int                 mReadResult;
+    int                 mWriteResult;
+    bool                mHasReadResult;
+    bool                mHasWriteResult;
+#endif
 };
 
 } // namespace rest
@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/diag_record.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+// Each TLV is stored as its type, the length of its data (2 bytes, in host order) and the used part of the data.
+static constexpr size_t kHeaderLength = 3;
+
+template <typename T> static size_t GetLengthTo(const otNetworkDiagTlv &aTlv, const T *aEnd)
+{
+    return static_cast<size_t>(reinterpret_cast<const uint8_t *>(aEnd) -
+                               reinterpret_cast<const uint8_t *>(&aTlv.mData));
+}
+
+size_t DiagRecord::GetDataLength(const otNetworkDiagTlv &aTlv)
+{
+    size_t length;
+
+    switch (aTlv.mType)
+    {
+    case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+        length = sizeof(aTlv.mData.mExtAddress);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+        length = sizeof(aTlv.mData.mAddr16);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+        length = sizeof(aTlv.mData.mMode);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+        length = sizeof(aTlv.mData.mTimeout);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+        length = sizeof(aTlv.mData.mConnectivity);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+        length = GetLengthTo(aTlv, &aTlv.mData.mRoute.mRouteData[aTlv.mData.mRoute.mRouteCount]);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+        length = sizeof(aTlv.mData.mLeaderData);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+        length = GetLengthTo(aTlv, &aTlv.mData.mNetworkData.m8[aTlv.mData.mNetworkData.mCount]);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+        length = GetLengthTo(aTlv, &aTlv.mData.mIp6AddrList.mList[aTlv.mData.mIp6AddrList.mCount]);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+        length = sizeof(aTlv.mData.mMacCounters);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+        length = sizeof(aTlv.mData.mBatteryLevel);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+        length = sizeof(aTlv.mData.mSupplyVoltage);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+        length = GetLengthTo(aTlv, &aTlv.mData.mChildTable.mTable[aTlv.mData.mChildTable.mCount]);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+        length = GetLengthTo(aTlv, &aTlv.mData.mChannelPages.m8[aTlv.mData.mChannelPages.mCount]);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+        length = sizeof(aTlv.mData.mMaxChildTimeout);
+        break;
+    default:
+        length = sizeof(aTlv.mData);
+        break;
+    }
+
+    return length;
+}
+
+void DiagRecord::Append(const otNetworkDiagTlv &aTlv)
+{
+    uint16_t       length = static_cast<uint16_t>(GetDataLength(aTlv));
+    const uint8_t *data   = reinterpret_cast<const uint8_t *>(&aTlv.mData);
+    size_t         offset = mData.size();
+
+    mData.resize(offset + kHeaderLength + length);
+    mData[offset] = static_cast<uint8_t>(aTlv.mType);
+    memcpy(&mData[offset + 1], &length, sizeof(length));
+    memcpy(&mData[offset + kHeaderLength], data, length);
+}
+
+bool DiagRecord::GetNext(size_t &aOffset, otNetworkDiagTlv &aTlv) const
+{
+    bool     found = false;
+    uint16_t length;
+
+    VerifyOrExit(aOffset + kHeaderLength <= mData.size());
+
+    memcpy(&length, &mData[aOffset + 1], sizeof(length));
+    aTlv.mType = static_cast<otNetworkDiagTlvType>(mData[aOffset]);
+    memcpy(&aTlv.mData, &mData[aOffset + kHeaderLength], length);
+    aOffset += kHeaderLength + length;
+    found = true;
+
+exit:
+    return found;
+}
+
+} // namespace rest
+} // namespace otbr
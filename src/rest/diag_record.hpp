@@ -0,0 +1,104 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the compact storage of the network diagnostics of a node.
+ */
+
+#ifndef OTBR_REST_DIAG_RECORD_HPP_
+#define OTBR_REST_DIAG_RECORD_HPP_
+
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "openthread/netdiag.h"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class stores the network diagnostic TLVs of a node in a compact binary form.
+ *
+ * An `otNetworkDiagTlv` is as large as its largest variant, e.g. a full child table, so only the used part of the
+ * data of each TLV is stored.
+ *
+ */
+class DiagRecord
+{
+public:
+    /**
+     * This method appends a TLV to the record.
+     *
+     * @param[in]  aTlv  The TLV to be appended.
+     *
+     */
+    void Append(const otNetworkDiagTlv &aTlv);
+
+    /**
+     * This method gets the next TLV of the record.
+     *
+     * Only the used part of the data of @p aTlv is written, e.g. the first `mCount` entries of a table.
+     *
+     * @param[inout]  aOffset  The offset of the next TLV, starts with 0.
+     * @param[out]    aTlv     The TLV.
+     *
+     * @retval  true   The next TLV is written to @p aTlv.
+     * @retval  false  There are no more TLVs.
+     *
+     */
+    bool GetNext(size_t &aOffset, otNetworkDiagTlv &aTlv) const;
+
+    /**
+     * This method returns the size of the record.
+     *
+     * @returns  The size of the record in bytes.
+     *
+     */
+    size_t GetSize(void) const { return mData.size(); }
+
+    /**
+     * This method returns the number of bytes allocated for the record.
+     *
+     * @returns  The capacity of the record in bytes.
+     *
+     */
+    size_t GetCapacity(void) const { return mData.capacity(); }
+
+private:
+    static size_t GetDataLength(const otNetworkDiagTlv &aTlv);
+
+    std::vector<uint8_t> mData;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAG_RECORD_HPP_
@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/event_stream.hpp"
+
+#include <cerrno>
+
+#include <sys/socket.h>
+
+#include "common/code_utils.hpp"
+#include "common/memory_usage.hpp"
+
+namespace otbr {
+namespace rest {
+
+constexpr Microseconds EventStream::kPingInterval;
+constexpr size_t       EventStream::kMaxBacklog;
+
+// The comment sent to an idle stream, which is ignored by clients.
+static const char kPing[] = ":\n\n";
+
+EventStream::EventStream(void)
+    : mOffset(0)
+{
+}
+
+void EventStream::Start(Timepoint aNow)
+{
+    Clear();
+    mPingTime = aNow;
+}
+
+void EventStream::Clear(void)
+{
+    mOutput.clear();
+    mOffset = 0;
+}
+
+otbrError EventStream::Send(int aFd, const std::string &aEvent, Timepoint aNow)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(GetBacklog() + aEvent.size() <= kMaxBacklog, error = OTBR_ERROR_BUSY);
+
+    mOutput += aEvent;
+    error = Flush(aFd, aNow);
+
+exit:
+    return error;
+}
+
+otbrError EventStream::Flush(int aFd, Timepoint aNow)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    ssize_t   sent;
+
+    while (HasPending())
+    {
+        // The client may have closed the connection at any time, never raise SIGPIPE.
+        sent = send(aFd, mOutput.data() + mOffset, mOutput.size() - mOffset, MSG_NOSIGNAL);
+
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            ExitNow();
+        }
+
+        mOffset += static_cast<size_t>(sent);
+    }
+
+    Clear();
+    mPingTime = aNow;
+
+exit:
+    return error;
+}
+
+otbrError EventStream::Process(int aFd, Timepoint aNow)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aNow >= GetDeadline());
+
+    mPingTime = aNow;
+
+    // A stream with pending events isn't idle, the events tell whether the client is still there.
+    VerifyOrExit(!HasPending());
+    error = Send(aFd, kPing, aNow);
+
+exit:
+    return error;
+}
+
+size_t EventStream::GetMemorySize(void) const
+{
+    return MemoryUsage::GetHeapSize(mOutput);
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,170 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the pending output of a server-sent event stream.
+ */
+
+#ifndef OTBR_REST_EVENT_STREAM_HPP_
+#define OTBR_REST_EVENT_STREAM_HPP_
+
+#include <string>
+
+#include <stddef.h>
+
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class buffers the events of a server-sent event stream which the socket of the client isn't ready for, and
+ * paces the comments sent to an idle stream.
+ *
+ */
+class EventStream
+{
+public:
+    /**
+     * The interval of comments sent to an idle event stream, to detect closed connections.
+     *
+     */
+    static constexpr Microseconds kPingInterval = Microseconds(15000000);
+
+    /**
+     * The max number of bytes of events pending to be sent, more than which the client is too slow.
+     *
+     */
+    static constexpr size_t kMaxBacklog = 65536;
+
+    /**
+     * This constructor initializes an empty event stream.
+     *
+     */
+    EventStream(void);
+
+    /**
+     * This method starts the event stream, dropping the events pending from a previous stream.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     */
+    void Start(Timepoint aNow);
+
+    /**
+     * This method drops the pending events.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method queues an event and sends as much of the pending events as the socket accepts.
+     *
+     * @param[in]  aFd     The socket of the client.
+     * @param[in]  aEvent  The formatted event.
+     * @param[in]  aNow    The current time.
+     *
+     * @retval  OTBR_ERROR_NONE   The event is sent or pending.
+     * @retval  OTBR_ERROR_BUSY   The event would exceed `kMaxBacklog`, it is dropped.
+     * @retval  OTBR_ERROR_ERRNO  Failed to send, the cause is in `errno`.
+     *
+     */
+    otbrError Send(int aFd, const std::string &aEvent, Timepoint aNow);
+
+    /**
+     * This method sends as much of the pending events as the socket accepts.
+     *
+     * @param[in]  aFd   The socket of the client.
+     * @param[in]  aNow  The current time.
+     *
+     * @retval  OTBR_ERROR_NONE   The events are sent or still pending.
+     * @retval  OTBR_ERROR_ERRNO  Failed to send, the cause is in `errno`.
+     *
+     */
+    otbrError Flush(int aFd, Timepoint aNow);
+
+    /**
+     * This method sends a comment if the stream has been idle for `kPingInterval`.
+     *
+     * The next deadline is moved forward even if events are still pending, so that a stalled client doesn't keep the
+     * stream waking up. It is only woken up again when its socket is writable or at the next deadline.
+     *
+     * @param[in]  aFd   The socket of the client.
+     * @param[in]  aNow  The current time.
+     *
+     * @retval  OTBR_ERROR_NONE   No comment is due, or it is sent or pending.
+     * @retval  OTBR_ERROR_ERRNO  Failed to send, the cause is in `errno`.
+     *
+     */
+    otbrError Process(int aFd, Timepoint aNow);
+
+    /**
+     * This method indicates whether any events are pending to be sent.
+     *
+     * @retval  true   Some events wait for the socket to be writable.
+     * @retval  false  All events have been sent.
+     *
+     */
+    bool HasPending(void) const { return mOffset < mOutput.size(); }
+
+    /**
+     * This method returns the number of bytes of events pending to be sent.
+     *
+     * @returns  The size of the backlog in bytes.
+     *
+     */
+    size_t GetBacklog(void) const { return mOutput.size() - mOffset; }
+
+    /**
+     * This method returns the time when the stream must be processed again.
+     *
+     * @returns  The time of the next comment.
+     *
+     */
+    Timepoint GetDeadline(void) const { return mPingTime + kPingInterval; }
+
+    /**
+     * This method returns the memory allocated for the pending events.
+     *
+     * @returns  The size of the memory in bytes.
+     *
+     */
+    size_t GetMemorySize(void) const;
+
+private:
+    std::string mOutput;
+    size_t      mOffset;
+    Timepoint   mPingTime;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_EVENT_STREAM_HPP_
@@ -31,450 +31,515 @@
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
 
-extern "C" {
-#include <cJSON.h>
-}
+#ifndef OTBR_REST_JSON_COMPACT
+#define OTBR_REST_JSON_COMPACT 0
+#endif
 
 namespace otbr {
 namespace rest {
 namespace Json {
 
-static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
-{
-    char hex[2 * aLength + 1];
-
-    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
-    hex[2 * aLength] = '\0';
-
-    return cJSON_CreateString(hex);
-}
+// The format is set per thread, so that serializers may run on worker threads, see OTBR_REST_WORKER_SERIALIZE.
+static thread_local JsonWriter::Format sFormat = JsonWriter::kFormatJson;
 
-std::string String2JsonString(const std::string &aString)
+// All serializers of a thread share this writer, so that the output buffer is allocated only once. A serializer
+// never calls another public serializer.
+static JsonWriter &GetWriter(void)
 {
-    std::string ret;
-    cJSON *     json    = nullptr;
-    char *      jsonOut = nullptr;
+    static thread_local JsonWriter sWriter(OTBR_REST_JSON_COMPACT);
 
-    VerifyOrExit(aString.size() > 0);
+    sWriter.Reset();
+    sWriter.SetFormat(sFormat);
 
-    json    = cJSON_CreateString(aString.c_str());
-    jsonOut = cJSON_Print(json);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
-
-    cJSON_Delete(json);
-
-exit:
-    return ret;
+    return sWriter;
 }
 
-std::string Json2String(const cJSON *aJson)
+void SetFormat(JsonWriter::Format aFormat)
 {
-    std::string ret;
-    char *      jsonOut = nullptr;
-
-    VerifyOrExit(aJson != nullptr);
-
-    jsonOut = cJSON_Print(aJson);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
-
-exit:
-    return ret;
+    sFormat = aFormat;
 }
 
-static cJSON *CString2Json(const char *aString)
+JsonWriter::Format GetFormat(void)
 {
-    return cJSON_CreateString(aString);
+    return sFormat;
 }
 
-static cJSON *Mode2Json(const otLinkModeConfig &aMode)
+static void Mode2Json(JsonWriter &aWriter, const otLinkModeConfig &aMode)
 {
-    cJSON *mode = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(mode, "RxOnWhenIdle", cJSON_CreateNumber(aMode.mRxOnWhenIdle));
-    cJSON_AddItemToObject(mode, "DeviceType", cJSON_CreateNumber(aMode.mDeviceType));
-    cJSON_AddItemToObject(mode, "NetworkData", cJSON_CreateNumber(aMode.mNetworkData));
-
-    return mode;
+    aWriter.BeginObject();
+    aWriter.Key("RxOnWhenIdle").Uint(aMode.mRxOnWhenIdle);
+    aWriter.Key("DeviceType").Uint(aMode.mDeviceType);
+    aWriter.Key("NetworkData").Uint(aMode.mNetworkData);
+    aWriter.EndObject();
 }
 
-static cJSON *IpAddr2Json(const otIp6Address &aAddress)
+static void IpAddr2Json(JsonWriter &aWriter, const otIp6Address &aAddress)
 {
     Ip6Address addr(aAddress.mFields.m8);
+    char       addrString[Ip6Address::kStringSize];
 
-    return cJSON_CreateString(addr.ToString().c_str());
+    aWriter.String(addr.ToString(addrString));
 }
 
-static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
+static void ChildTableEntry2Json(JsonWriter &aWriter, const otNetworkDiagChildEntry &aChildEntry)
 {
-    cJSON *childEntry = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(childEntry, "ChildId", cJSON_CreateNumber(aChildEntry.mChildId));
-    cJSON_AddItemToObject(childEntry, "Timeout", cJSON_CreateNumber(aChildEntry.mTimeout));
-
-    cJSON *mode = Mode2Json(aChildEntry.mMode);
-    cJSON_AddItemToObject(childEntry, "Mode", mode);
-
-    return childEntry;
+    aWriter.BeginObject();
+    aWriter.Key("ChildId").Uint(aChildEntry.mChildId);
+    aWriter.Key("Timeout").Uint(aChildEntry.mTimeout);
+    aWriter.Key("Mode");
+    Mode2Json(aWriter, aChildEntry.mMode);
+    aWriter.EndObject();
 }
 
-static cJSON *MacCounters2Json(const otNetworkDiagMacCounters &aMacCounters)
+static void MacCounters2Json(JsonWriter &aWriter, const otNetworkDiagMacCounters &aMacCounters)
 {
-    cJSON *macCounters = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(macCounters, "IfInUnknownProtos", cJSON_CreateNumber(aMacCounters.mIfInUnknownProtos));
-    cJSON_AddItemToObject(macCounters, "IfInErrors", cJSON_CreateNumber(aMacCounters.mIfInErrors));
-    cJSON_AddItemToObject(macCounters, "IfOutErrors", cJSON_CreateNumber(aMacCounters.mIfOutErrors));
-    cJSON_AddItemToObject(macCounters, "IfInUcastPkts", cJSON_CreateNumber(aMacCounters.mIfInUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfInBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInDiscards", cJSON_CreateNumber(aMacCounters.mIfInDiscards));
-    cJSON_AddItemToObject(macCounters, "IfOutUcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutDiscards", cJSON_CreateNumber(aMacCounters.mIfOutDiscards));
-
-    return macCounters;
+    aWriter.BeginObject();
+    aWriter.Key("IfInUnknownProtos").Uint(aMacCounters.mIfInUnknownProtos);
+    aWriter.Key("IfInErrors").Uint(aMacCounters.mIfInErrors);
+    aWriter.Key("IfOutErrors").Uint(aMacCounters.mIfOutErrors);
+    aWriter.Key("IfInUcastPkts").Uint(aMacCounters.mIfInUcastPkts);
+    aWriter.Key("IfInBroadcastPkts").Uint(aMacCounters.mIfInBroadcastPkts);
+    aWriter.Key("IfInDiscards").Uint(aMacCounters.mIfInDiscards);
+    aWriter.Key("IfOutUcastPkts").Uint(aMacCounters.mIfOutUcastPkts);
+    aWriter.Key("IfOutBroadcastPkts").Uint(aMacCounters.mIfOutBroadcastPkts);
+    aWriter.Key("IfOutDiscards").Uint(aMacCounters.mIfOutDiscards);
+    aWriter.EndObject();
 }
 
-static cJSON *Connectivity2Json(const otNetworkDiagConnectivity &aConnectivity)
+static void Connectivity2Json(JsonWriter &aWriter, const otNetworkDiagConnectivity &aConnectivity)
 {
-    cJSON *connectivity = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(connectivity, "ParentPriority", cJSON_CreateNumber(aConnectivity.mParentPriority));
-    cJSON_AddItemToObject(connectivity, "LinkQuality3", cJSON_CreateNumber(aConnectivity.mLinkQuality3));
-    cJSON_AddItemToObject(connectivity, "LinkQuality2", cJSON_CreateNumber(aConnectivity.mLinkQuality2));
-    cJSON_AddItemToObject(connectivity, "LinkQuality1", cJSON_CreateNumber(aConnectivity.mLinkQuality1));
-    cJSON_AddItemToObject(connectivity, "LeaderCost", cJSON_CreateNumber(aConnectivity.mLeaderCost));
-    cJSON_AddItemToObject(connectivity, "IdSequence", cJSON_CreateNumber(aConnectivity.mIdSequence));
-    cJSON_AddItemToObject(connectivity, "ActiveRouters", cJSON_CreateNumber(aConnectivity.mActiveRouters));
-    cJSON_AddItemToObject(connectivity, "SedBufferSize", cJSON_CreateNumber(aConnectivity.mSedBufferSize));
-    cJSON_AddItemToObject(connectivity, "SedDatagramCount", cJSON_CreateNumber(aConnectivity.mSedDatagramCount));
-
-    return connectivity;
+    aWriter.BeginObject();
+    aWriter.Key("ParentPriority").Int(aConnectivity.mParentPriority);
+    aWriter.Key("LinkQuality3").Uint(aConnectivity.mLinkQuality3);
+    aWriter.Key("LinkQuality2").Uint(aConnectivity.mLinkQuality2);
+    aWriter.Key("LinkQuality1").Uint(aConnectivity.mLinkQuality1);
+    aWriter.Key("LeaderCost").Uint(aConnectivity.mLeaderCost);
+    aWriter.Key("IdSequence").Uint(aConnectivity.mIdSequence);
+    aWriter.Key("ActiveRouters").Uint(aConnectivity.mActiveRouters);
+    aWriter.Key("SedBufferSize").Uint(aConnectivity.mSedBufferSize);
+    aWriter.Key("SedDatagramCount").Uint(aConnectivity.mSedDatagramCount);
+    aWriter.EndObject();
 }
 
-static cJSON *RouteData2Json(const otNetworkDiagRouteData &aRouteData)
+static void RouteData2Json(JsonWriter &aWriter, const otNetworkDiagRouteData &aRouteData)
 {
-    cJSON *routeData = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(routeData, "RouteId", cJSON_CreateNumber(aRouteData.mRouterId));
-    cJSON_AddItemToObject(routeData, "LinkQualityOut", cJSON_CreateNumber(aRouteData.mLinkQualityOut));
-    cJSON_AddItemToObject(routeData, "LinkQualityIn", cJSON_CreateNumber(aRouteData.mLinkQualityIn));
-    cJSON_AddItemToObject(routeData, "RouteCost", cJSON_CreateNumber(aRouteData.mRouteCost));
-
-    return routeData;
+    aWriter.BeginObject();
+    aWriter.Key("RouteId").Uint(aRouteData.mRouterId);
+    aWriter.Key("LinkQualityOut").Uint(aRouteData.mLinkQualityOut);
+    aWriter.Key("LinkQualityIn").Uint(aRouteData.mLinkQualityIn);
+    aWriter.Key("RouteCost").Uint(aRouteData.mRouteCost);
+    aWriter.EndObject();
 }
 
-static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
+static void Route2Json(JsonWriter &aWriter, const otNetworkDiagRoute &aRoute)
 {
-    cJSON *route = cJSON_CreateObject();
+    aWriter.BeginObject();
+    aWriter.Key("IdSequence").Uint(aRoute.mIdSequence);
+    aWriter.Key("RouteData").BeginArray();
 
-    cJSON_AddItemToObject(route, "IdSequence", cJSON_CreateNumber(aRoute.mIdSequence));
-
-    cJSON *RouteData = cJSON_CreateArray();
     for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
     {
-        cJSON *RouteDatavalue = RouteData2Json(aRoute.mRouteData[i]);
-        cJSON_AddItemToArray(RouteData, RouteDatavalue);
+        RouteData2Json(aWriter, aRoute.mRouteData[i]);
     }
 
-    cJSON_AddItemToObject(route, "RouteData", RouteData);
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
 
-    return route;
+static void LeaderData2Json(JsonWriter &aWriter, const otLeaderData &aLeaderData)
+{
+    aWriter.BeginObject();
+    aWriter.Key("PartitionId").Uint(aLeaderData.mPartitionId);
+    aWriter.Key("Weighting").Uint(aLeaderData.mWeighting);
+    aWriter.Key("DataVersion").Uint(aLeaderData.mDataVersion);
+    aWriter.Key("StableDataVersion").Uint(aLeaderData.mStableDataVersion);
+    aWriter.Key("LeaderRouterId").Uint(aLeaderData.mLeaderRouterId);
+    aWriter.EndObject();
 }
 
-static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
+static void DiagTlv2Json(JsonWriter &aWriter, const otNetworkDiagTlv &aDiagTlv)
 {
-    cJSON *leaderData = cJSON_CreateObject();
+    switch (aDiagTlv.mType)
+    {
+    case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+        aWriter.Key("ExtAddress").Hex(aDiagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+        aWriter.Key("Rloc16").Uint(aDiagTlv.mData.mAddr16);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+        aWriter.Key("Mode");
+        Mode2Json(aWriter, aDiagTlv.mData.mMode);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+        aWriter.Key("Timeout").Uint(aDiagTlv.mData.mTimeout);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+        aWriter.Key("Connectivity");
+        Connectivity2Json(aWriter, aDiagTlv.mData.mConnectivity);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+        aWriter.Key("Route");
+        Route2Json(aWriter, aDiagTlv.mData.mRoute);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+        aWriter.Key("LeaderData");
+        LeaderData2Json(aWriter, aDiagTlv.mData.mLeaderData);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+        aWriter.Key("NetworkData").Hex(aDiagTlv.mData.mNetworkData.m8, aDiagTlv.mData.mNetworkData.mCount);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+        aWriter.Key("IP6AddressList").BeginArray();
+
+        for (uint16_t i = 0; i < aDiagTlv.mData.mIp6AddrList.mCount; ++i)
+        {
+            IpAddr2Json(aWriter, aDiagTlv.mData.mIp6AddrList.mList[i]);
+        }
 
-    cJSON_AddItemToObject(leaderData, "PartitionId", cJSON_CreateNumber(aLeaderData.mPartitionId));
-    cJSON_AddItemToObject(leaderData, "Weighting", cJSON_CreateNumber(aLeaderData.mWeighting));
-    cJSON_AddItemToObject(leaderData, "DataVersion", cJSON_CreateNumber(aLeaderData.mDataVersion));
-    cJSON_AddItemToObject(leaderData, "StableDataVersion", cJSON_CreateNumber(aLeaderData.mStableDataVersion));
-    cJSON_AddItemToObject(leaderData, "LeaderRouterId", cJSON_CreateNumber(aLeaderData.mLeaderRouterId));
+        aWriter.EndArray();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+        aWriter.Key("MACCounters");
+        MacCounters2Json(aWriter, aDiagTlv.mData.mMacCounters);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+        aWriter.Key("BatteryLevel").Uint(aDiagTlv.mData.mBatteryLevel);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+        aWriter.Key("SupplyVoltage").Uint(aDiagTlv.mData.mSupplyVoltage);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+        aWriter.Key("ChildTable").BeginArray();
+
+        for (uint16_t i = 0; i < aDiagTlv.mData.mChildTable.mCount; ++i)
+        {
+            ChildTableEntry2Json(aWriter, aDiagTlv.mData.mChildTable.mTable[i]);
+        }
 
-    return leaderData;
+        aWriter.EndArray();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+        aWriter.Key("ChannelPages").Hex(aDiagTlv.mData.mChannelPages.m8, aDiagTlv.mData.mChannelPages.mCount);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+        aWriter.Key("MaxChildTimeout").Uint(aDiagTlv.mData.mMaxChildTimeout);
+        break;
+    default:
+        break;
+    }
 }
 
-std::string IpAddr2JsonString(const otIp6Address &aAddress)
+static void LatencyHistogram2Json(JsonWriter &aWriter, const LatencyHistogram &aHistogram)
 {
-    std::string ret;
-    cJSON *     ipAddr = IpAddr2Json(aAddress);
+    aWriter.BeginObject();
+    aWriter.Key("Count").Uint(aHistogram.GetCount());
+    aWriter.Key("TotalUs").Int(aHistogram.GetTotal().count());
+    aWriter.Key("MaxUs").Int(aHistogram.GetMax().count());
+    aWriter.Key("Buckets").BeginArray();
 
-    ret = Json2String(ipAddr);
-    cJSON_Delete(ipAddr);
+    for (size_t i = 0; i < LatencyHistogram::kNumBuckets; ++i)
+    {
+        aWriter.Uint(aHistogram.GetBucketCount(i));
+    }
 
-    return ret;
+    aWriter.EndArray();
+    aWriter.EndObject();
 }
 
-std::string Node2JsonString(const NodeInfo &aNode)
+std::string String2JsonString(const std::string &aString)
 {
-    cJSON *     node = cJSON_CreateObject();
     std::string ret;
 
-    cJSON_AddItemToObject(node, "State", cJSON_CreateNumber(aNode.mRole));
-    cJSON_AddItemToObject(node, "NumOfRouter", cJSON_CreateNumber(aNode.mNumOfRouter));
-    cJSON_AddItemToObject(node, "RlocAddress", IpAddr2Json(aNode.mRlocAddress));
-    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE));
-    cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aNode.mNetworkName.c_str()));
-    cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
-    cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(aNode.mLeaderData));
-    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE));
+    VerifyOrExit(aString.size() > 0);
 
-    ret = Json2String(node);
-    cJSON_Delete(node);
+    ret = GetWriter().String(aString).GetString();
 
+exit:
     return ret;
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+std::string IpAddr2JsonString(const otIp6Address &aAddress)
 {
-    cJSON *     diagInfo          = cJSON_CreateArray();
-    cJSON *     diagInfoOfOneNode = nullptr;
-    cJSON *     addrList          = nullptr;
-    cJSON *     tableList         = nullptr;
-    std::string ret;
-    uint64_t    timeout;
-
-    for (auto diagItem : aDiagSet)
-    {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
-        {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
-
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
-
-                addrList = cJSON_CreateArray();
+    JsonWriter &writer = GetWriter();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
+    IpAddr2Json(writer, aAddress);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
-
-                tableList = cJSON_CreateArray();
-
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
+    return writer.GetString();
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
+std::string Node2JsonString(const NodeInfo &aNode)
+{
+    JsonWriter &writer = GetWriter();
+
+    writer.BeginObject();
+    writer.Key("State").Uint(aNode.mRole);
+    writer.Key("NumOfRouter").Uint(aNode.mNumOfRouter);
+    writer.Key("RlocAddress");
+    IpAddr2Json(writer, aNode.mRlocAddress);
+    writer.Key("ExtAddress").Hex(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    writer.Key("NetworkName").String(aNode.mNetworkName);
+    writer.Key("Rloc16").Uint(aNode.mRloc16);
+    writer.Key("LeaderData");
+    LeaderData2Json(writer, aNode.mLeaderData);
+    writer.Key("ExtPanId").Hex(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    writer.EndObject();
+
+    return writer.GetString();
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+std::string Diag2JsonString(const std::vector<DiagRecord> &aDiagSet)
+{
+    JsonWriter &     writer = GetWriter();
+    otNetworkDiagTlv diagTlv;
 
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+    writer.BeginArray();
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+    for (const DiagRecord &diagItem : aDiagSet)
+    {
+        size_t offset = 0;
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+        writer.BeginObject();
 
-                break;
-            default:
-                break;
-            }
+        while (diagItem.GetNext(offset, diagTlv))
+        {
+            DiagTlv2Json(writer, diagTlv);
         }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
-    }
 
-    ret = Json2String(diagInfo);
+        writer.EndObject();
+    }
 
-    cJSON_Delete(diagInfo);
+    writer.EndArray();
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
 {
-    cJSON *     hex = Bytes2HexJson(aBytes, aLength);
-    std::string ret = Json2String(hex);
-
-    cJSON_Delete(hex);
-
-    return ret;
+    return GetWriter().Hex(aBytes, aLength).GetString();
 }
 
 std::string Number2JsonString(const uint32_t &aNumber)
 {
-    cJSON *     number = cJSON_CreateNumber(aNumber);
-    std::string ret    = Json2String(number);
-
-    cJSON_Delete(number);
-
-    return ret;
+    return GetWriter().Uint(aNumber).GetString();
 }
 
 std::string Mode2JsonString(const otLinkModeConfig &aMode)
 {
-    cJSON *     mode = Mode2Json(aMode);
-    std::string ret  = Json2String(mode);
+    JsonWriter &writer = GetWriter();
 
-    cJSON_Delete(mode);
+    Mode2Json(writer, aMode);
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string Connectivity2JsonString(const otNetworkDiagConnectivity &aConnectivity)
 {
-    cJSON *     connectivity = Connectivity2Json(aConnectivity);
-    std::string ret          = Json2String(connectivity);
+    JsonWriter &writer = GetWriter();
 
-    cJSON_Delete(connectivity);
+    Connectivity2Json(writer, aConnectivity);
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData)
 {
-    cJSON *     routeData = RouteData2Json(aRouteData);
-    std::string ret       = Json2String(routeData);
+    JsonWriter &writer = GetWriter();
 
-    cJSON_Delete(routeData);
+    RouteData2Json(writer, aRouteData);
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string Route2JsonString(const otNetworkDiagRoute &aRoute)
 {
-    cJSON *     route = Route2Json(aRoute);
-    std::string ret   = Json2String(route);
+    JsonWriter &writer = GetWriter();
 
-    cJSON_Delete(route);
+    Route2Json(writer, aRoute);
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
 {
-    cJSON *     leaderData = LeaderData2Json(aLeaderData);
-    std::string ret        = Json2String(leaderData);
+    JsonWriter &writer = GetWriter();
 
-    cJSON_Delete(leaderData);
+    LeaderData2Json(writer, aLeaderData);
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
 {
-    cJSON *     macCounters = MacCounters2Json(aMacCounters);
-    std::string ret         = Json2String(macCounters);
+    JsonWriter &writer = GetWriter();
 
-    cJSON_Delete(macCounters);
+    MacCounters2Json(writer, aMacCounters);
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry)
 {
-    cJSON *     childEntry = ChildTableEntry2Json(aChildEntry);
-    std::string ret        = Json2String(childEntry);
+    JsonWriter &writer = GetWriter();
 
-    cJSON_Delete(childEntry);
+    ChildTableEntry2Json(writer, aChildEntry);
 
-    return ret;
+    return writer.GetString();
 }
 
 std::string CString2JsonString(const char *aCString)
 {
-    cJSON *     cString = CString2Json(aCString);
-    std::string ret     = Json2String(cString);
+    return GetWriter().String(aCString).GetString();
+}
 
-    cJSON_Delete(cString);
+std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage)
+{
+    JsonWriter &writer = GetWriter();
 
-    return ret;
+    writer.BeginObject();
+    writer.Key("ErrorCode").Int(static_cast<int16_t>(aErrorCode));
+    writer.Key("ErrorMessage").String(aErrorMessage);
+    writer.EndObject();
+
+    return writer.GetString();
 }
 
-std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage)
+std::string MainloopStats2JsonString(const MainloopManager::Stats &aStats)
 {
-    std::string ret;
-    cJSON *     error = cJSON_CreateObject();
+    JsonWriter &writer = GetWriter();
 
-    cJSON_AddItemToObject(error, "ErrorCode", cJSON_CreateNumber(static_cast<int16_t>(aErrorCode)));
-    cJSON_AddItemToObject(error, "ErrorMessage", cJSON_CreateString(aErrorMessage.c_str()));
+    writer.BeginObject();
+    writer.Key("Iterations").Uint(aStats.mIterations);
+    writer.Key("TimerWakeups").Uint(aStats.mTimerWakeups);
+    writer.Key("DurationMs").Int(aStats.mDuration.count());
 
-    ret = Json2String(error);
+    if (aStats.mDuration.count() > 0)
+    {
+        writer.Key("TimerWakeupsPerSecond").Double(aStats.mTimerWakeups * 1000.0 / aStats.mDuration.count());
+    }
 
-    cJSON_Delete(error);
+    writer.Key("Latencies").BeginObject();
 
-    return ret;
+    for (const MainloopManager::Latency &latency : aStats.mLatencies)
+    {
+        writer.Key(latency.mName.c_str());
+        LatencyHistogram2Json(writer, latency.mHistogram);
+    }
+
+    writer.EndObject();
+    writer.EndObject();
+
+    return writer.GetString();
+}
+
+std::string Batch2JsonString(const std::vector<std::pair<std::string, std::string>> &aResponses)
+{
+    JsonWriter &writer = GetWriter();
+
+    writer.BeginObject();
+
+    for (const std::pair<std::string, std::string> &response : aResponses)
+    {
+        writer.Key(response.first.c_str()).Raw(response.second);
+    }
+
+    writer.EndObject();
+
+    return writer.GetString();
+}
+
+struct ThreadMacCounterKey
+{
+    const char *mKey;
+    uint32_t otMacCounters::*mCounter;
+};
+
+struct ThreadIp6CounterKey
+{
+    const char *mKey;
+    uint32_t otIpCounters::*mCounter;
+};
+
+static const ThreadMacCounterKey kThreadMacCounterKeys[] = {
+    {"TxTotal", &otMacCounters::mTxTotal},
+    {"TxUnicast", &otMacCounters::mTxUnicast},
+    {"TxBroadcast", &otMacCounters::mTxBroadcast},
+    {"TxAckRequested", &otMacCounters::mTxAckRequested},
+    {"TxAcked", &otMacCounters::mTxAcked},
+    {"TxNoAckRequested", &otMacCounters::mTxNoAckRequested},
+    {"TxData", &otMacCounters::mTxData},
+    {"TxDataPoll", &otMacCounters::mTxDataPoll},
+    {"TxBeacon", &otMacCounters::mTxBeacon},
+    {"TxBeaconRequest", &otMacCounters::mTxBeaconRequest},
+    {"TxOther", &otMacCounters::mTxOther},
+    {"TxRetry", &otMacCounters::mTxRetry},
+    {"TxErrCca", &otMacCounters::mTxErrCca},
+    {"TxErrAbort", &otMacCounters::mTxErrAbort},
+    {"TxErrBusyChannel", &otMacCounters::mTxErrBusyChannel},
+    {"RxTotal", &otMacCounters::mRxTotal},
+    {"RxUnicast", &otMacCounters::mRxUnicast},
+    {"RxBroadcast", &otMacCounters::mRxBroadcast},
+    {"RxData", &otMacCounters::mRxData},
+    {"RxDataPoll", &otMacCounters::mRxDataPoll},
+    {"RxBeacon", &otMacCounters::mRxBeacon},
+    {"RxBeaconRequest", &otMacCounters::mRxBeaconRequest},
+    {"RxOther", &otMacCounters::mRxOther},
+    {"RxAddressFiltered", &otMacCounters::mRxAddressFiltered},
+    {"RxDestAddrFiltered", &otMacCounters::mRxDestAddrFiltered},
+    {"RxDuplicated", &otMacCounters::mRxDuplicated},
+    {"RxErrNoFrame", &otMacCounters::mRxErrNoFrame},
+    {"RxErrUnknownNeighbor", &otMacCounters::mRxErrUnknownNeighbor},
+    {"RxErrInvalidSrcAddr", &otMacCounters::mRxErrInvalidSrcAddr},
+    {"RxErrSec", &otMacCounters::mRxErrSec},
+    {"RxErrFcs", &otMacCounters::mRxErrFcs},
+    {"RxErrOther", &otMacCounters::mRxErrOther},
+};
+
+static const ThreadIp6CounterKey kThreadIp6CounterKeys[] = {
+    {"TxSuccess", &otIpCounters::mTxSuccess},
+    {"TxFailure", &otIpCounters::mTxFailure},
+    {"RxSuccess", &otIpCounters::mRxSuccess},
+    {"RxFailure", &otIpCounters::mRxFailure},
+};
+
+std::string CounterHistory2JsonString(const std::vector<Ncp::CounterHistory::Interval> &aIntervals,
+                                      Milliseconds                                       aInterval,
+                                      Timepoint                                          aNow)
+{
+    JsonWriter &writer = GetWriter();
+
+    writer.BeginObject();
+    writer.Key("IntervalMs").Int(aInterval.count());
+    writer.Key("Intervals").BeginArray();
+
+    for (const Ncp::CounterHistory::Interval &interval : aIntervals)
+    {
+        writer.BeginObject();
+        writer.Key("AgeMs").Int(std::chrono::duration_cast<Milliseconds>(aNow - interval.mEnd).count());
+        writer.Key("DurationMs").Int(interval.mDuration.count());
+        writer.Key("CcaFailureRate").Uint(interval.mCcaFailureRate);
+
+        writer.Key("MacCounters").BeginObject();
+        for (const ThreadMacCounterKey &key : kThreadMacCounterKeys)
+        {
+            writer.Key(key.mKey).Uint(interval.mMacCounters.*key.mCounter);
+        }
+        writer.EndObject();
+
+        writer.Key("Ip6Counters").BeginObject();
+        for (const ThreadIp6CounterKey &key : kThreadIp6CounterKeys)
+        {
+            writer.Key(key.mKey).Uint(interval.mIpCounters.*key.mCounter);
+        }
+        writer.EndObject();
+
+        writer.EndObject();
+    }
+
+    writer.EndArray();
+    writer.EndObject();
+
+    return writer.GetString();
 }
 
 } // namespace Json
@@ -34,11 +34,18 @@
 #ifndef OTBR_REST_JSON_HPP_
 #define OTBR_REST_JSON_HPP_
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "agent/counter_history.hpp"
+#include "common/mainloop_manager.hpp"
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
+#include "utils/json_writer.hpp"
 
 namespace otbr {
 namespace rest {
@@ -50,6 +57,24 @@ namespace rest {
  */
 namespace Json {
 
+/**
+ * This method sets the output format of all following serializations.
+ *
+ * The structures are the same in every format, only their encoding differs. The format is JSON by default.
+ *
+ * @param[in]   aFormat  The output format.
+ *
+ */
+void SetFormat(JsonWriter::Format aFormat);
+
+/**
+ * This method returns the output format of serializations.
+ *
+ * @returns     The output format.
+ *
+ */
+JsonWriter::Format GetFormat(void);
+
 /**
  * This method formats an integer to a Json number and serialize it to a string.
  *
@@ -108,7 +133,7 @@ std::string Node2JsonString(const NodeInfo &aNode);
  * @returns     A string serlialized by a Json array.
  *
  */
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
+std::string Diag2JsonString(const std::vector<DiagRecord> &aDiagSet);
 
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
@@ -201,6 +226,40 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
  */
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage);
 
+/**
+ * This method formats the mainloop statistics to a Json object and serialize it to a string.
+ *
+ * @param[in]   aStats  The mainloop statistics.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string MainloopStats2JsonString(const MainloopManager::Stats &aStats);
+
+/**
+ * This method formats the responses of a batch request to a Json object, keyed by the resource paths.
+ *
+ * @param[in]   aResponses  The resource paths and their serialized Json response bodies.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string Batch2JsonString(const std::vector<std::pair<std::string, std::string>> &aResponses);
+
+/**
+ * This method formats the intervals of the counter history to a Json object.
+ *
+ * @param[in]   aIntervals  The intervals from the oldest to the newest.
+ * @param[in]   aInterval   The sampling interval of the counter history.
+ * @param[in]   aNow        The current time, the end of each interval is serialized as its age.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string CounterHistory2JsonString(const std::vector<Ncp::CounterHistory::Interval> &aIntervals,
+                                      Milliseconds                                       aInterval,
+                                      Timepoint                                          aNow);
+
 }; // namespace Json
 
 } // namespace rest
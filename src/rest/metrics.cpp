@@ -0,0 +1,346 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the serializers of the Prometheus metrics of the Rest server.
+ */
+
+#include "rest/metrics.hpp"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+namespace otbr {
+namespace rest {
+namespace Metrics {
+
+struct LinkCounterMetric
+{
+    const char *mName;
+    const char *mHelp;
+    uint32_t otMacCounters::*mCounter;
+};
+
+struct Ip6CounterMetric
+{
+    const char *mName;
+    const char *mHelp;
+    uint32_t otIpCounters::*mCounter;
+};
+
+static const LinkCounterMetric kLinkCounterMetrics[] = {
+    {"otbr_link_tx_frames_total", "MAC frames transmitted.", &otMacCounters::mTxTotal},
+    {"otbr_link_tx_unicast_frames_total", "Unicast MAC frames transmitted.", &otMacCounters::mTxUnicast},
+    {"otbr_link_tx_broadcast_frames_total", "Broadcast MAC frames transmitted.", &otMacCounters::mTxBroadcast},
+    {"otbr_link_tx_ack_requested_frames_total", "MAC frames transmitted with ack request.",
+     &otMacCounters::mTxAckRequested},
+    {"otbr_link_tx_acked_frames_total", "MAC frames transmitted and acked.", &otMacCounters::mTxAcked},
+    {"otbr_link_tx_no_ack_requested_frames_total", "MAC frames transmitted without ack request.",
+     &otMacCounters::mTxNoAckRequested},
+    {"otbr_link_tx_data_frames_total", "MAC data frames transmitted.", &otMacCounters::mTxData},
+    {"otbr_link_tx_data_poll_frames_total", "MAC data poll frames transmitted.", &otMacCounters::mTxDataPoll},
+    {"otbr_link_tx_beacon_frames_total", "MAC beacon frames transmitted.", &otMacCounters::mTxBeacon},
+    {"otbr_link_tx_beacon_request_frames_total", "MAC beacon request frames transmitted.",
+     &otMacCounters::mTxBeaconRequest},
+    {"otbr_link_tx_other_frames_total", "Other MAC frames transmitted.", &otMacCounters::mTxOther},
+    {"otbr_link_tx_retries_total", "MAC retransmission attempts.", &otMacCounters::mTxRetry},
+    {"otbr_link_tx_cca_errors_total", "MAC transmissions failed by CCA.", &otMacCounters::mTxErrCca},
+    {"otbr_link_tx_abort_errors_total", "MAC transmissions aborted.", &otMacCounters::mTxErrAbort},
+    {"otbr_link_tx_busy_channel_errors_total", "MAC transmissions failed by a busy channel.",
+     &otMacCounters::mTxErrBusyChannel},
+    {"otbr_link_rx_frames_total", "MAC frames received.", &otMacCounters::mRxTotal},
+    {"otbr_link_rx_unicast_frames_total", "Unicast MAC frames received.", &otMacCounters::mRxUnicast},
+    {"otbr_link_rx_broadcast_frames_total", "Broadcast MAC frames received.", &otMacCounters::mRxBroadcast},
+    {"otbr_link_rx_data_frames_total", "MAC data frames received.", &otMacCounters::mRxData},
+    {"otbr_link_rx_data_poll_frames_total", "MAC data poll frames received.", &otMacCounters::mRxDataPoll},
+    {"otbr_link_rx_beacon_frames_total", "MAC beacon frames received.", &otMacCounters::mRxBeacon},
+    {"otbr_link_rx_beacon_request_frames_total", "MAC beacon request frames received.",
+     &otMacCounters::mRxBeaconRequest},
+    {"otbr_link_rx_other_frames_total", "Other MAC frames received.", &otMacCounters::mRxOther},
+    {"otbr_link_rx_address_filtered_frames_total", "MAC frames dropped by the address filter.",
+     &otMacCounters::mRxAddressFiltered},
+    {"otbr_link_rx_dest_addr_filtered_frames_total", "MAC frames dropped by the destination address check.",
+     &otMacCounters::mRxDestAddrFiltered},
+    {"otbr_link_rx_duplicated_frames_total", "Duplicated MAC frames received.", &otMacCounters::mRxDuplicated},
+    {"otbr_link_rx_no_frame_errors_total", "MAC frames dropped for missing or malformed content.",
+     &otMacCounters::mRxErrNoFrame},
+    {"otbr_link_rx_unknown_neighbor_errors_total", "MAC frames dropped from unknown neighbors.",
+     &otMacCounters::mRxErrUnknownNeighbor},
+    {"otbr_link_rx_invalid_src_addr_errors_total", "MAC frames dropped for an invalid source address.",
+     &otMacCounters::mRxErrInvalidSrcAddr},
+    {"otbr_link_rx_security_errors_total", "MAC frames dropped by the security check.", &otMacCounters::mRxErrSec},
+    {"otbr_link_rx_fcs_errors_total", "MAC frames dropped for a bad FCS.", &otMacCounters::mRxErrFcs},
+    {"otbr_link_rx_other_errors_total", "MAC frames dropped for other errors.", &otMacCounters::mRxErrOther},
+};
+
+static const Ip6CounterMetric kIp6CounterMetrics[] = {
+    {"otbr_ip6_tx_success_packets_total", "IPv6 packets transmitted.", &otIpCounters::mTxSuccess},
+    {"otbr_ip6_tx_failure_packets_total", "IPv6 packets failed to transmit.", &otIpCounters::mTxFailure},
+    {"otbr_ip6_rx_success_packets_total", "IPv6 packets received.", &otIpCounters::mRxSuccess},
+    {"otbr_ip6_rx_failure_packets_total", "IPv6 packets failed to receive.", &otIpCounters::mRxFailure},
+};
+
+#if OTBR_ENABLE_DUA_ROUTING
+struct NdProxyCounterMetric
+{
+    const char *mName;
+    const char *mHelp;
+    uint64_t BackboneRouter::NdProxyManager::Counters::*mCounter;
+};
+
+static const NdProxyCounterMetric kNdProxyCounterMetrics[] = {
+    {"otbr_nd_proxy_multicast_ns_received_total", "Multicast NS received on the backbone link.",
+     &BackboneRouter::NdProxyManager::Counters::mMulticastNsReceived},
+    {"otbr_nd_proxy_multicast_ns_dropped_total", "Multicast NS dropped by the kernel as the socket queue was full.",
+     &BackboneRouter::NdProxyManager::Counters::mMulticastNsDropped},
+    {"otbr_nd_proxy_unicast_ns_received_total", "Unicast NS received from NFQUEUE.",
+     &BackboneRouter::NdProxyManager::Counters::mUnicastNsReceived},
+    {"otbr_nd_proxy_ns_matched_total", "NS targeting a proxied DUA.",
+     &BackboneRouter::NdProxyManager::Counters::mNsMatched},
+    {"otbr_nd_proxy_na_sent_total", "NA sent for proxied DUAs.", &BackboneRouter::NdProxyManager::Counters::mNaSent},
+    {"otbr_nd_proxy_nfqueue_accepted_total", "Unicast NS given an accept verdict.",
+     &BackboneRouter::NdProxyManager::Counters::mNfqAccepted},
+    {"otbr_nd_proxy_nfqueue_dropped_total", "Unicast NS given a drop verdict.",
+     &BackboneRouter::NdProxyManager::Counters::mNfqDropped},
+    {"otbr_nd_proxy_dua_added_total", "DUAs added to ND Proxy.", &BackboneRouter::NdProxyManager::Counters::mDuaAdded},
+    {"otbr_nd_proxy_dua_renewed_total", "DUAs renewed.", &BackboneRouter::NdProxyManager::Counters::mDuaRenewed},
+    {"otbr_nd_proxy_dua_removed_total", "DUAs removed from ND Proxy.",
+     &BackboneRouter::NdProxyManager::Counters::mDuaRemoved},
+    {"otbr_nd_proxy_socket_errors_total", "Failed socket or NFQUEUE operations.",
+     &BackboneRouter::NdProxyManager::Counters::mSocketErrors},
+};
+#endif
+
+static void AppendHeader(std::string &aOutput, const char *aName, const char *aType, const char *aHelp)
+{
+    aOutput += "# HELP ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aHelp;
+    aOutput += "\n# TYPE ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aType;
+    aOutput += '\n';
+}
+
+static void AppendNumber(std::string &aOutput, uint64_t aValue)
+{
+    char number[sizeof("18446744073709551615")];
+
+    snprintf(number, sizeof(number), "%" PRIu64, aValue);
+    aOutput += number;
+}
+
+static void AppendSeconds(std::string &aOutput, Microseconds aDuration)
+{
+    char number[32];
+
+    snprintf(number, sizeof(number), "%.9g", aDuration.count() / 1e6);
+    aOutput += number;
+}
+
+static void AppendMetric(std::string &aOutput, const char *aName, const char *aType, const char *aHelp, uint64_t aValue)
+{
+    AppendHeader(aOutput, aName, aType, aHelp);
+    aOutput += aName;
+    aOutput += ' ';
+    AppendNumber(aOutput, aValue);
+    aOutput += '\n';
+}
+
+static void AppendSecondsMetric(std::string &aOutput,
+                                const char * aName,
+                                const char * aType,
+                                const char * aHelp,
+                                Microseconds aValue)
+{
+    AppendHeader(aOutput, aName, aType, aHelp);
+    aOutput += aName;
+    aOutput += ' ';
+    AppendSeconds(aOutput, aValue);
+    aOutput += '\n';
+}
+
+// Appends a sample of a latency histogram with a label, e.g. `name_bucket{label="value"`
+static void AppendLatencySample(std::string &      aOutput,
+                                const char *       aName,
+                                const char *       aSuffix,
+                                const char *       aLabel,
+                                const std::string &aLabelValue)
+{
+    aOutput += aName;
+    aOutput += aSuffix;
+    aOutput += '{';
+    aOutput += aLabel;
+    aOutput += "=\"";
+    aOutput += aLabelValue;
+    aOutput += '"';
+}
+
+static void AppendLatencyHistogram(std::string &           aOutput,
+                                   const char *            aName,
+                                   const char *            aLabel,
+                                   const std::string &     aLabelValue,
+                                   const LatencyHistogram &aHistogram)
+{
+    uint64_t count = 0;
+
+    // The buckets are cumulative, the last bucket has no upper bound.
+    for (size_t i = 0; i + 1 < LatencyHistogram::kNumBuckets; ++i)
+    {
+        count += aHistogram.GetBucketCount(i);
+        AppendLatencySample(aOutput, aName, "_bucket", aLabel, aLabelValue);
+        aOutput += ",le=\"";
+        AppendSeconds(aOutput, LatencyHistogram::GetBucketUpperBound(i));
+        aOutput += "\"} ";
+        AppendNumber(aOutput, count);
+        aOutput += '\n';
+    }
+
+    AppendLatencySample(aOutput, aName, "_bucket", aLabel, aLabelValue);
+    aOutput += ",le=\"+Inf\"} ";
+    AppendNumber(aOutput, aHistogram.GetCount());
+    aOutput += '\n';
+
+    AppendLatencySample(aOutput, aName, "_sum", aLabel, aLabelValue);
+    aOutput += "} ";
+    AppendSeconds(aOutput, aHistogram.GetTotal());
+    aOutput += '\n';
+
+    AppendLatencySample(aOutput, aName, "_count", aLabel, aLabelValue);
+    aOutput += "} ";
+    AppendNumber(aOutput, aHistogram.GetCount());
+    aOutput += '\n';
+}
+
+void AppendLinkCounters(std::string &aOutput, const otMacCounters &aCounters)
+{
+    for (const LinkCounterMetric &metric : kLinkCounterMetrics)
+    {
+        AppendMetric(aOutput, metric.mName, "counter", metric.mHelp, aCounters.*metric.mCounter);
+    }
+}
+
+void AppendIp6Counters(std::string &aOutput, const otIpCounters &aCounters)
+{
+    for (const Ip6CounterMetric &metric : kIp6CounterMetrics)
+    {
+        AppendMetric(aOutput, metric.mName, "counter", metric.mHelp, aCounters.*metric.mCounter);
+    }
+}
+
+void AppendMainloopStats(std::string &aOutput, const MainloopManager::Stats &aStats)
+{
+    AppendMetric(aOutput, "otbr_mainloop_iterations_total", "counter", "Mainloop iterations.", aStats.mIterations);
+    AppendMetric(aOutput, "otbr_mainloop_timer_wakeups_total", "counter", "Mainloop iterations woken up by a timeout.",
+                 aStats.mTimerWakeups);
+    AppendHeader(aOutput, "otbr_mainloop_latency_seconds", "histogram",
+                 "Latencies of polling, fd handlers and each mainloop processor.");
+
+    for (const MainloopManager::Latency &latency : aStats.mLatencies)
+    {
+        AppendLatencyHistogram(aOutput, "otbr_mainloop_latency_seconds", "step", latency.mName, latency.mHistogram);
+    }
+}
+
+void AppendRadioStats(std::string &aOutput, const Ncp::ControllerOpenThread::RadioStats &aStats)
+{
+    AppendMetric(aOutput, "otbr_radio_tx_frames_total", "counter", "Frames handed to the RCP for transmission.",
+                 aStats.mTxFrames);
+    AppendMetric(aOutput, "otbr_radio_tx_bytes_total", "counter", "PSDU bytes handed to the RCP for transmission.",
+                 aStats.mTxBytes);
+    AppendMetric(aOutput, "otbr_radio_tx_no_ack_total", "counter", "Transmissions not acknowledged by the peer.",
+                 aStats.mTxNoAck);
+    AppendMetric(aOutput, "otbr_radio_tx_channel_access_failures_total", "counter",
+                 "Transmissions failed for a busy channel.", aStats.mTxChannelAccessFailures);
+    AppendMetric(aOutput, "otbr_radio_tx_errors_total", "counter", "Transmissions failed for other reasons.",
+                 aStats.mTxErrors);
+    AppendMetric(aOutput, "otbr_radio_rx_frames_total", "counter", "Frames received from the RCP.", aStats.mRxFrames);
+    AppendMetric(aOutput, "otbr_radio_rx_bytes_total", "counter", "PSDU bytes received from the RCP.",
+                 aStats.mRxBytes);
+    AppendMetric(aOutput, "otbr_radio_rx_errors_total", "counter", "Receive errors reported by the RCP.",
+                 aStats.mRxErrors);
+    AppendMetric(aOutput, "otbr_radio_resets_total", "counter", "Resets of the OpenThread instance and the RCP.",
+                 aStats.mResets);
+    AppendHeader(aOutput, "otbr_radio_tx_latency_seconds", "histogram",
+                 "Latencies from a transmission request to its completion by the RCP.");
+    AppendLatencyHistogram(aOutput, "otbr_radio_tx_latency_seconds", "radio", "rcp", aStats.mTxLatency);
+}
+
+void AppendMdnsStats(std::string &aOutput, const Mdns::Publisher::Stats &aStats)
+{
+    AppendHeader(aOutput, "otbr_mdns_publish_latency_seconds", "histogram",
+                 "Latencies from publishing a service or host to the result of the mDNS daemon.");
+    AppendLatencyHistogram(aOutput, "otbr_mdns_publish_latency_seconds", "kind", "service", aStats.mServiceLatency);
+    AppendLatencyHistogram(aOutput, "otbr_mdns_publish_latency_seconds", "kind", "host", aStats.mHostLatency);
+    AppendMetric(aOutput, "otbr_mdns_services_in_flight", "gauge", "Service publications waiting for the result.",
+                 aStats.mServicesInFlight);
+    AppendMetric(aOutput, "otbr_mdns_hosts_in_flight", "gauge", "Host publications waiting for the result.",
+                 aStats.mHostsInFlight);
+    AppendMetric(aOutput, "otbr_mdns_publish_failures_total", "counter", "Publications failed.", aStats.mFailures);
+    AppendMetric(aOutput, "otbr_mdns_name_conflicts_total", "counter", "Publications failed for name conflicts.",
+                 aStats.mConflicts);
+    AppendMetric(aOutput, "otbr_mdns_service_renames_total", "counter",
+                 "Services renamed by the mDNS daemon for name conflicts.", aStats.mRenames);
+}
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+void AppendSrpReadvertiseStats(std::string &aOutput, const SrpReadvertiseStats &aStats)
+{
+    AppendMetric(aOutput, "otbr_srp_readvertise_recoveries_total", "counter",
+                 "Re-advertisements of all SRP hosts after the mDNS publisher restarted.", aStats.mRecoveries);
+    AppendMetric(aOutput, "otbr_srp_readvertise_hosts_pending", "gauge", "SRP hosts waiting to be re-advertised.",
+                 aStats.mHostsPending);
+    AppendMetric(aOutput, "otbr_srp_readvertise_hosts_total", "counter", "SRP hosts re-advertised.",
+                 aStats.mHostsReadvertised);
+    AppendSecondsMetric(aOutput, "otbr_srp_readvertise_last_duration_seconds", "gauge",
+                        "Duration of the last re-advertisement of all SRP hosts.", aStats.mLastRecoveryTime);
+}
+#endif
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+void AppendBackboneRouterCounters(std::string &aOutput, const BackboneRouter::BackboneAgent::Counters &aCounters)
+{
+    AppendMetric(aOutput, "otbr_bbr_primary_transitions_total", "counter", "Transitions to Primary Backbone Router.",
+                 aCounters.mPrimaryTransitions);
+    AppendMetric(aOutput, "otbr_bbr_domain_prefix_changes_total", "counter", "Domain Prefix events.",
+                 aCounters.mDomainPrefixChanges);
+#if OTBR_ENABLE_DUA_ROUTING
+    for (const NdProxyCounterMetric &metric : kNdProxyCounterMetrics)
+    {
+        AppendMetric(aOutput, metric.mName, "counter", metric.mHelp, aCounters.mNdProxy.*metric.mCounter);
+    }
+#endif
+}
+#endif
+
+} // namespace Metrics
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the serializers of the Prometheus metrics of the Rest server.
+ */
+
+#ifndef OTBR_REST_METRICS_HPP_
+#define OTBR_REST_METRICS_HPP_
+
+#include <string>
+
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/srp_readvertise_stats.hpp"
+#include "mdns/mdns.hpp"
+#include "rest/types.hpp"
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+#include "backbone_router/backbone_agent.hpp"
+#endif
+
+/**
+ * The content type of the Prometheus text exposition format.
+ *
+ */
+#define OT_REST_METRICS_CONTENT_TYPE "text/plain; version=0.0.4; charset=utf-8"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * The functions within this namespace append metrics in the Prometheus text exposition format to an output buffer.
+ *
+ */
+namespace Metrics {
+
+/**
+ * This method appends the MAC counters of the Thread interface.
+ *
+ * @param[inout]  aOutput    The output buffer.
+ * @param[in]     aCounters  The MAC counters.
+ *
+ */
+void AppendLinkCounters(std::string &aOutput, const otMacCounters &aCounters);
+
+/**
+ * This method appends the IPv6 counters of the Thread interface.
+ *
+ * @param[inout]  aOutput    The output buffer.
+ * @param[in]     aCounters  The IPv6 counters.
+ *
+ */
+void AppendIp6Counters(std::string &aOutput, const otIpCounters &aCounters);
+
+/**
+ * This method appends the mainloop statistics, with the latencies as histograms.
+ *
+ * @param[inout]  aOutput  The output buffer.
+ * @param[in]     aStats   The mainloop statistics.
+ *
+ */
+void AppendMainloopStats(std::string &aOutput, const MainloopManager::Stats &aStats);
+
+/**
+ * This method appends the statistics of the radio link to the RCP, with the transmit latency as a histogram.
+ *
+ * @param[inout]  aOutput  The output buffer.
+ * @param[in]     aStats   The radio link statistics.
+ *
+ */
+void AppendRadioStats(std::string &aOutput, const Ncp::ControllerOpenThread::RadioStats &aStats);
+
+/**
+ * This method appends the publication statistics of the mDNS publisher, with the latencies as histograms.
+ *
+ * @param[inout]  aOutput  The output buffer.
+ * @param[in]     aStats   The publication statistics.
+ *
+ */
+void AppendMdnsStats(std::string &aOutput, const Mdns::Publisher::Stats &aStats);
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+/**
+ * This method appends the statistics of re-advertising the SRP hosts after the mDNS publisher restarts.
+ *
+ * @param[inout]  aOutput  The output buffer.
+ * @param[in]     aStats   The re-advertising statistics.
+ *
+ */
+void AppendSrpReadvertiseStats(std::string &aOutput, const SrpReadvertiseStats &aStats);
+#endif
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+/**
+ * This method appends the event counters of the Backbone Router and its ND Proxy.
+ *
+ * @param[inout]  aOutput    The output buffer.
+ * @param[in]     aCounters  The Backbone Router counters.
+ *
+ */
+void AppendBackboneRouterCounters(std::string &aOutput, const BackboneRouter::BackboneAgent::Counters &aCounters);
+#endif
+
+} // namespace Metrics
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_METRICS_HPP_
@@ -37,24 +37,46 @@ namespace rest {
 static int OnUrl(http_parser *parser, const char *at, size_t len)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      rval    = 0;
 
-    if (len > 0)
+    if (len > 0 && request->SetUrl(at, len) != OTBR_ERROR_NONE)
     {
-        request->SetUrl(at, len);
+        // Abort parsing, `Parser::GetError()` tells which part is too long.
+        rval = -1;
     }
 
-    return 0;
+    return rval;
 }
 
 static int OnBody(http_parser *parser, const char *at, size_t len)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      rval    = 0;
 
-    if (len > 0)
+    if (len > 0 && request->SetBody(at, len) != OTBR_ERROR_NONE)
     {
-        request->SetBody(at, len);
+        // Abort parsing, `Parser::GetError()` tells which part is too long.
+        rval = -1;
     }
 
+    return rval;
+}
+
+static int OnHeaderField(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->SetHeaderField(at, len);
+
+    return 0;
+}
+
+static int OnHeaderValue(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->SetHeaderValue(at, len);
+
     return 0;
 }
 
@@ -64,6 +86,9 @@ static int OnMessageComplete(http_parser *parser)
 
     request->SetReadComplete();
 
+    // Leave pipelined requests in the buffer until this request has been responded.
+    http_parser_pause(parser, 1);
+
     return 0;
 }
 
@@ -97,17 +122,37 @@ void Parser::Init(void)
     mSettings.on_message_begin    = OnMessageBegin;
     mSettings.on_url              = OnUrl;
     mSettings.on_status           = OnHandlerData;
-    mSettings.on_header_field     = OnHandlerData;
-    mSettings.on_header_value     = OnHandlerData;
+    mSettings.on_header_field     = OnHeaderField;
+    mSettings.on_header_value     = OnHeaderValue;
     mSettings.on_body             = OnBody;
     mSettings.on_headers_complete = OnHeaderComplete;
     mSettings.on_message_complete = OnMessageComplete;
     http_parser_init(&mParser, HTTP_REQUEST);
 }
 
-void Parser::Process(const char *aBuf, size_t aLength)
+size_t Parser::Process(const char *aBuf, size_t aLength)
+{
+    return http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+}
+
+void Parser::Resume(void)
+{
+    http_parser_pause(&mParser, 0);
+}
+
+enum http_errno Parser::GetError(void) const
+{
+    return HTTP_PARSER_ERRNO(&mParser);
+}
+
+bool Parser::ShouldKeepAlive(void) const
+{
+    return http_should_keep_alive(&mParser) != 0;
+}
+
+bool Parser::SupportsChunkedEncoding(void) const
 {
-    http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+    return mParser.http_major > 1 || (mParser.http_major == 1 && mParser.http_minor >= 1);
 }
 
 } // namespace rest
@@ -71,11 +71,48 @@ public:
     /**
      * This method performs a parse process.
      *
+     * The parser pauses after a complete request, the data following it is not parsed until `Resume()` is called.
+     *
      * @param[in]    aBuf      A pointer pointing to read buffer.
      * @param[in]    aLength   An integer indicates how much data is to be processed by parser.
      *
+     * @returns  The number of bytes parsed.
+     *
+     */
+    size_t Process(const char *aBuf, size_t aLength);
+
+    /**
+     * This method resumes the parser paused after a complete request, to parse the next request.
+     *
+     */
+    void Resume(void);
+
+    /**
+     * This method returns the error of the last parse process.
+     *
+     * @returns  The error of the parser, `HPE_PAUSED` after a complete request. `HPE_CB_url` or `HPE_CB_body`
+     *           indicates that the url or the body exceeds the limits of `Request`.
+     *
+     */
+    enum http_errno GetError(void) const;
+
+    /**
+     * This method indicates whether the client wants the connection to be kept open after the parsed request.
+     *
+     * @retval  true   The connection should be kept open.
+     * @retval  false  The connection should be closed.
+     *
+     */
+    bool ShouldKeepAlive(void) const;
+
+    /**
+     * This method indicates whether the client of the parsed request understands chunked transfer encoding.
+     *
+     * @retval  true   The request is of HTTP/1.1 or later.
+     * @retval  false  The request is of HTTP/1.0.
+     *
      */
-    void Process(const char *aBuf, size_t aLength);
+    bool SupportsChunkedEncoding(void) const;
 
 private:
     http_parser          mParser;
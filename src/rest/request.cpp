@@ -28,22 +28,98 @@
 
 #include "rest/request.hpp"
 
+#include <algorithm>
+
+#include <string.h>
+#include <strings.h>
+
 namespace otbr {
 namespace rest {
 
 Request::Request(void)
-    : mComplete(false)
+    : mMethod(static_cast<int32_t>(HttpMethod::kGet))
+    , mContentLength(0)
+    , mInHeaderValue(false)
+    , mComplete(false)
 {
+    // The buffers are cleared but kept for every request of the connection.
+    mUrl.reserve(kMaxUrlLength);
+    mPath.reserve(kMaxUrlLength);
+    mHeaderField.reserve(kMaxHeaderFieldLength);
 }
 
-void Request::SetUrl(const char *aString, size_t aLength)
+otbrError Request::SetUrl(const char *aString, size_t aLength)
 {
-    mUrl += std::string(aString, aLength);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mUrl.size() + aLength <= kMaxUrlLength, error = OTBR_ERROR_INVALID_ARGS);
+    mUrl.append(aString, aLength);
+
+exit:
+    return error;
 }
 
-void Request::SetBody(const char *aString, size_t aLength)
+otbrError Request::SetBody(const char *aString, size_t aLength)
 {
-    mBody += std::string(aString, aLength);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mBody.size() + aLength <= kMaxBodyLength, error = OTBR_ERROR_INVALID_ARGS);
+    mBody.append(aString, aLength);
+
+exit:
+    return error;
+}
+
+void Request::SetHeaderField(const char *aString, size_t aLength)
+{
+    // A header name following a header value starts the next header.
+    if (mInHeaderValue)
+    {
+        mHeaderField.clear();
+        mInHeaderValue = false;
+    }
+
+    // No header used by the server has a longer name.
+    if (mHeaderField.size() + aLength <= kMaxHeaderFieldLength)
+    {
+        mHeaderField.append(aString, aLength);
+    }
+}
+
+// Appends a piece of a header value, a too long value is truncated.
+static void AppendHeaderValue(std::string &aValue, const char *aString, size_t aLength)
+{
+    if (aValue.size() < Request::kMaxHeaderValueLength)
+    {
+        aValue.append(aString, std::min<size_t>(aLength, Request::kMaxHeaderValueLength - aValue.size()));
+    }
+}
+
+void Request::SetHeaderValue(const char *aString, size_t aLength)
+{
+    std::string *value = nullptr;
+
+    if (strcasecmp(mHeaderField.c_str(), "Accept") == 0)
+    {
+        value = &mAccept;
+    }
+    else if (strcasecmp(mHeaderField.c_str(), "Accept-Encoding") == 0)
+    {
+        value = &mAcceptEncoding;
+    }
+
+    if (value != nullptr)
+    {
+        // A repeated header is combined with the previous ones into one list.
+        if (!mInHeaderValue && !value->empty())
+        {
+            AppendHeaderValue(*value, ", ", 2);
+        }
+
+        AppendHeaderValue(*value, aString, aLength);
+    }
+
+    mInHeaderValue = true;
 }
 
 void Request::SetContentLength(size_t aContentLength)
@@ -61,34 +137,110 @@ HttpMethod Request::GetMethod() const
     return static_cast<HttpMethod>(mMethod);
 }
 
-std::string Request::GetBody() const
+otbrError Request::GetQueryParameter(const char *aName, std::string &aValue) const
 {
-    return mBody;
-}
+    otbrError error      = OTBR_ERROR_NOT_FOUND;
+    size_t    nameLen    = strlen(aName);
+    size_t    paramBegin = mUrl.find('?');
 
-std::string Request::GetUrl(void) const
-{
-    std::string url = mUrl;
+    // `paramBegin` points to the '?' or '&' before each parameter.
+    while (paramBegin != std::string::npos)
+    {
+        size_t paramEnd = mUrl.find('&', ++paramBegin);
 
-    size_t urlEnd = url.find("?");
+        if (paramEnd == std::string::npos)
+        {
+            paramEnd = mUrl.size();
+        }
 
-    if (urlEnd != std::string::npos)
-    {
-        url = url.substr(0, urlEnd);
+        if (mUrl.compare(paramBegin, nameLen, aName) == 0 && paramBegin + nameLen < paramEnd &&
+            mUrl[paramBegin + nameLen] == '=')
+        {
+            aValue.assign(mUrl, paramBegin + nameLen + 1, paramEnd - paramBegin - nameLen - 1);
+            ExitNow(error = OTBR_ERROR_NONE);
+        }
+
+        paramBegin = paramEnd < mUrl.size() ? paramEnd : std::string::npos;
     }
-    while (!url.empty() && url[url.size() - 1] == '/')
+
+exit:
+    return error;
+}
+
+// Checks whether a comma separated header value lists a token, ignoring the parameters of the list items.
+static bool ListContains(const std::string &aList, const char *aToken)
+{
+    bool   contains  = false;
+    size_t length    = strlen(aToken);
+    size_t itemBegin = 0;
+
+    while (itemBegin < aList.size())
     {
-        url.pop_back();
-    }
+        size_t itemEnd = aList.find(',', itemBegin);
+        size_t tokenEnd;
 
-    VerifyOrExit(url.size() > 0, url = "/");
+        if (itemEnd == std::string::npos)
+        {
+            itemEnd = aList.size();
+        }
+
+        while (itemBegin < itemEnd && (aList[itemBegin] == ' ' || aList[itemBegin] == '\t'))
+        {
+            ++itemBegin;
+        }
+
+        tokenEnd = itemBegin;
+
+        while (tokenEnd < itemEnd && aList[tokenEnd] != ';' && aList[tokenEnd] != ' ' && aList[tokenEnd] != '\t')
+        {
+            ++tokenEnd;
+        }
+
+        if (tokenEnd - itemBegin == length && strncasecmp(aList.c_str() + itemBegin, aToken, length) == 0)
+        {
+            ExitNow(contains = true);
+        }
+
+        itemBegin = itemEnd + 1;
+    }
 
 exit:
-    return url;
+    return contains;
+}
+
+bool Request::Accepts(const char *aMediaType) const
+{
+    return ListContains(mAccept, aMediaType);
+}
+
+bool Request::AcceptsEncoding(const char *aEncoding) const
+{
+    return ListContains(mAcceptEncoding, aEncoding);
 }
 
 void Request::SetReadComplete(void)
 {
+    size_t pathEnd = mUrl.find('?');
+
+    if (pathEnd == std::string::npos)
+    {
+        pathEnd = mUrl.size();
+    }
+
+    while (pathEnd > 0 && mUrl[pathEnd - 1] == '/')
+    {
+        --pathEnd;
+    }
+
+    if (pathEnd > 0)
+    {
+        mPath.assign(mUrl, 0, pathEnd);
+    }
+    else
+    {
+        mPath.assign(1, '/');
+    }
+
     mComplete = true;
 }
 
@@ -97,6 +249,20 @@ void Request::ResetReadComplete(void)
     mComplete = false;
 }
 
+void Request::Reset(void)
+{
+    mMethod        = static_cast<int32_t>(HttpMethod::kGet);
+    mContentLength = 0;
+    mUrl.clear();
+    mPath.clear();
+    mBody.clear();
+    mHeaderField.clear();
+    mAccept.clear();
+    mAcceptEncoding.clear();
+    mInHeaderValue = false;
+    mComplete      = false;
+}
+
 bool Request::IsComplete(void) const
 {
     return mComplete;
@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "common/code_utils.hpp"
+#include "common/types.hpp"
 #include "rest/types.hpp"
 
 namespace otbr {
@@ -56,23 +57,57 @@ public:
      */
     Request(void);
 
+    enum
+    {
+        kMaxUrlLength         = 512,  ///< The max length of the url of a request.
+        kMaxBodyLength        = 4096, ///< The max length of the body of a request.
+        kMaxHeaderFieldLength = 32,   ///< The max length of the name of a header kept while parsing.
+        kMaxHeaderValueLength = 256,  ///< The max length of a header value kept, the rest is ignored.
+    };
+
     /**
-     * This method sets the Url field of a request.
+     * This method appends a piece of the url of a request.
      *
      * @param[in]  aString    A pointer points to url string.
      * @param[in]  aLength    Length of the url string
      *
+     * @retval OTBR_ERROR_NONE          Successfully appended the url.
+     * @retval OTBR_ERROR_INVALID_ARGS  The url would be longer than `kMaxUrlLength`.
+     *
      */
-    void SetUrl(const char *aString, size_t aLength);
+    otbrError SetUrl(const char *aString, size_t aLength);
 
     /**
-     * This method sets the body field of a request.
+     * This method appends a piece of the body of a request.
      *
      * @param[in]  aString    A pointer points to body string.
      * @param[in]  aLength    Length of the body string
      *
+     * @retval OTBR_ERROR_NONE          Successfully appended the body.
+     * @retval OTBR_ERROR_INVALID_ARGS  The body would be longer than `kMaxBodyLength`.
+     *
      */
-    void SetBody(const char *aString, size_t aLength);
+    otbrError SetBody(const char *aString, size_t aLength);
+
+    /**
+     * This method appends a piece of the name of a header of a request.
+     *
+     * Only the headers used by the server are kept, the others are dropped while parsing.
+     *
+     * @param[in]  aString    A pointer points to the header name.
+     * @param[in]  aLength    Length of the header name.
+     *
+     */
+    void SetHeaderField(const char *aString, size_t aLength);
+
+    /**
+     * This method appends a piece of the value of the header whose name was set last.
+     *
+     * @param[in]  aString    A pointer points to the header value.
+     * @param[in]  aLength    Length of the header value.
+     *
+     */
+    void SetHeaderValue(const char *aString, size_t aLength);
 
     /**
      * This method sets the content-length field of a request.
@@ -102,6 +137,12 @@ public:
      */
     void ResetReadComplete(void);
 
+    /**
+     * This method clears the request so that the next request of a connection could be parsed into it.
+     *
+     */
+    void Reset(void);
+
     /**
      * This method returns the HTTP method of this request.
      *
@@ -110,18 +151,58 @@ public:
     HttpMethod GetMethod() const;
 
     /**
-     * This method returns the HTTP method of this request.
+     * This method returns the body of this request.
      *
-     * @returns A HttpMethod enum representing HTTP method of this request.
+     * @returns A reference to the body of this request.
      */
-    std::string GetBody() const;
+    const std::string &GetBody() const { return mBody; }
 
     /**
      * This method returns the url for this request.
      *
-     * @returns A string contains the url of this request.
+     * The url is normalized when the request is complete: the query is stripped, as are trailing slashes.
+     *
+     * @returns A reference to the normalized url of this request.
+     */
+    const std::string &GetUrl(void) const { return mPath; }
+
+    /**
+     * This method returns the value of a query parameter of this request.
+     *
+     * The value is not percent-decoded.
+     *
+     * @param[in]   aName   A pointer to the null-terminated name of the query parameter.
+     * @param[out]  aValue  A reference to the string to receive the value of the query parameter.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully found the query parameter.
+     * @retval OTBR_ERROR_NOT_FOUND  The url has no such query parameter.
+     *
+     */
+    otbrError GetQueryParameter(const char *aName, std::string &aValue) const;
+
+    /**
+     * This method checks whether the `Accept` header of this request lists a media type.
+     *
+     * Parameters of the listed media types, including the quality value, are ignored.
+     *
+     * @param[in]  aMediaType  A pointer to the null-terminated media type, e.g. "application/cbor".
+     *
+     * @returns  Whether the media type is listed, case-insensitively.
+     *
+     */
+    bool Accepts(const char *aMediaType) const;
+
+    /**
+     * This method checks whether the `Accept-Encoding` header of this request lists a content coding.
+     *
+     * Parameters of the listed codings, including the quality value, are ignored.
+     *
+     * @param[in]  aEncoding  A pointer to the null-terminated content coding, e.g. "gzip".
+     *
+     * @returns  Whether the content coding is listed, case-insensitively.
+     *
      */
-    std::string GetUrl(void) const;
+    bool AcceptsEncoding(const char *aEncoding) const;
 
     /**
      * This method indicates whether this request is parsed completely.
@@ -134,7 +215,12 @@ private:
     int32_t     mMethod;
     size_t      mContentLength;
     std::string mUrl;
+    std::string mPath;
     std::string mBody;
+    std::string mHeaderField;
+    std::string mAccept;
+    std::string mAcceptEncoding;
+    bool        mInHeaderValue;
     bool        mComplete;
 };
 
@@ -30,13 +30,28 @@
 
 #include "rest/resource.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#include <assert.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+
 #include "string.h"
 
+#include "rest/metrics.hpp"
+
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
 #define OT_REST_RESOURCE_PATH_DIAGNOETIC "/diagnostics"
 #define OT_REST_RESOURCE_PATH_NODE "/node"
+#define OT_REST_RESOURCE_PATH_NODE_COUNTERS "/node/counters"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC16 "/node/rloc16"
 #define OT_REST_RESOURCE_PATH_NODE_EXTADDRESS "/node/ext-address"
@@ -45,19 +60,30 @@
 #define OT_REST_RESOURCE_PATH_NODE_LEADERDATA "/node/leader-data"
 #define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
+#define OT_REST_RESOURCE_PATH_MAINLOOP_STATS "/mainloop-stats"
+#define OT_REST_RESOURCE_PATH_EVENTS "/events"
+#define OT_REST_RESOURCE_PATH_BATCH "/batch"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
 
 #define OT_REST_HTTP_STATUS_200 "200 OK"
+#define OT_REST_HTTP_STATUS_400 "400 Bad Request"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
 #define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
+#define OT_REST_HTTP_STATUS_413 "413 Payload Too Large"
+#define OT_REST_HTTP_STATUS_414 "414 URI Too Long"
+#define OT_REST_HTTP_STATUS_429 "429 Too Many Requests"
 #define OT_REST_HTTP_STATUS_500 "500 Internal Server Error"
 
+#define OT_REST_MEDIA_TYPE_CBOR "application/cbor"
+
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
+using std::chrono::seconds;
 using std::chrono::steady_clock;
 
 using std::placeholders::_1;
@@ -75,18 +101,203 @@ static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16,
 // Timeout (in Microseconds) for deleting outdated diagnostics
 static const uint32_t kDiagResetTimeout = 3000000;
 
-// Timeout (in Microseconds) for collecting diagnostics
+#ifndef OTBR_REST_DIAG_REFRESH_INTERVAL
+#define OTBR_REST_DIAG_REFRESH_INTERVAL 0
+#endif
+
+// Default timeout (in Microseconds) for collecting diagnostics
 static const uint32_t kDiagCollectTimeout = 2000000;
 
-static std::string GetHttpStatus(HttpStatusCode aErrorCode)
+static_assert(OTBR_REST_DIAG_REFRESH_INTERVAL == 0 || OTBR_REST_DIAG_REFRESH_INTERVAL * 1000 > kDiagCollectTimeout,
+              "OTBR_REST_DIAG_REFRESH_INTERVAL must be longer than the time for collecting diagnostics");
+
+// Max timeout (in Microseconds) for collecting diagnostics, below the callback timeout of connections
+static const uint32_t kDiagMaxCollectTimeout = 8000000;
+
+// The query parameter of the timeout (in Milliseconds) for collecting diagnostics
+static const char *kDiagCollectTimeoutParam = "timeout";
+
+// The query parameter of the comma separated resource paths of a batch request
+static const char *kBatchResourcesParam = "resources";
+
+// The max number of resources of a batch request
+static const size_t kBatchMaxResources = 16;
+
+// The query parameter of the period (in Minutes) of the counter history to return
+static const char *kCounterHistoryMinutesParam = "minutes";
+
+#ifndef OTBR_REST_CLIENT_RATE_LIMIT
+#define OTBR_REST_CLIENT_RATE_LIMIT 20
+#endif
+
+#ifndef OTBR_REST_CLIENT_BURST
+#define OTBR_REST_CLIENT_BURST 40
+#endif
+
+#ifndef OTBR_REST_MAX_DIAG_REQUESTS
+#define OTBR_REST_MAX_DIAG_REQUESTS 4
+#endif
+
+// The requests per second allowed from one client, and the number of requests a client may send back to back
+static const double kClientRateLimit = OTBR_REST_CLIENT_RATE_LIMIT;
+static const double kClientBurst     = OTBR_REST_CLIENT_BURST;
+
+// The number of clients whose token buckets are kept, the buckets of the most idle clients are dropped beyond it
+static const size_t kMaxClientBuckets = 256;
+
+// The max number of `/diagnostics` requests waiting for the network at a time, each of them sends a query
+static const size_t kMaxDiagRequests = OTBR_REST_MAX_DIAG_REQUESTS;
+
+// Max age (in Microseconds) of cached responses depending on the router table, which isn't tracked by otChangedFlags
+static const uint32_t kRouterTableCacheMaxAge = 1000000;
+
+struct CachePolicy
+{
+    const char *   mPath;   // The cached resource
+    otChangedFlags mFlags;  // The Thread state changes invalidating the cached response
+    uint32_t       mMaxAge; // The max age (in Microseconds) of the cached response, zero for no limit
+};
+
+static const CachePolicy kCachePolicies[] = {
+    {OT_REST_RESOURCE_PATH_NODE,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_LL_ADDR | OT_CHANGED_THREAD_ML_ADDR | OT_CHANGED_THREAD_RLOC_ADDED |
+         OT_CHANGED_THREAD_RLOC_REMOVED | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA |
+         OT_CHANGED_THREAD_NETWORK_NAME | OT_CHANGED_THREAD_EXT_PANID,
+     kRouterTableCacheMaxAge},
+    {OT_REST_RESOURCE_PATH_NODE_STATE, OT_CHANGED_THREAD_ROLE, 0},
+    {OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, OT_CHANGED_THREAD_LL_ADDR, 0},
+    {OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, OT_CHANGED_THREAD_NETWORK_NAME, 0},
+    {OT_REST_RESOURCE_PATH_NODE_RLOC16,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED, 0},
+    {OT_REST_RESOURCE_PATH_NODE_LEADERDATA,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA, 0},
+    {OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID,
+     kRouterTableCacheMaxAge},
+    {OT_REST_RESOURCE_PATH_NODE_EXTPANID, OT_CHANGED_THREAD_EXT_PANID, 0},
+    {OT_REST_RESOURCE_PATH_NODE_RLOC,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_ML_ADDR | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED,
+     0},
+};
+
+// The state changes published on the event stream, see `PublishEvents()`.
+static constexpr otChangedFlags kEventChangedFlags = OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID |
+                                                     OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_CHILD_ADDED |
+                                                     OT_CHANGED_THREAD_CHILD_REMOVED;
+
+static otbrError GetDiagCollectTimeout(const Request &aRequest, uint32_t &aTimeout)
+{
+    otbrError     error = OTBR_ERROR_NONE;
+    std::string   value;
+    char *        end;
+    unsigned long timeout;
+
+    aTimeout = kDiagCollectTimeout;
+    VerifyOrExit(aRequest.GetQueryParameter(kDiagCollectTimeoutParam, value) == OTBR_ERROR_NONE);
+
+    timeout = strtoul(value.c_str(), &end, 10);
+    VerifyOrExit(!value.empty() && *end == '\0' && timeout <= kDiagMaxCollectTimeout / 1000,
+                 error = OTBR_ERROR_INVALID_ARGS);
+    aTimeout = static_cast<uint32_t>(timeout * 1000);
+
+exit:
+    return error;
+}
+
+static otbrError GetCounterHistoryPeriod(const Request &aRequest, Milliseconds &aPeriod)
+{
+    otbrError     error = OTBR_ERROR_NONE;
+    std::string   value;
+    char *        end;
+    unsigned long minutes;
+
+    // The whole history by default.
+    aPeriod = Milliseconds::zero();
+    VerifyOrExit(aRequest.GetQueryParameter(kCounterHistoryMinutesParam, value) == OTBR_ERROR_NONE);
+
+    minutes = strtoul(value.c_str(), &end, 10);
+    VerifyOrExit(!value.empty() && *end == '\0' && minutes > 0 && minutes <= UINT32_MAX / 60000,
+                 error = OTBR_ERROR_INVALID_ARGS);
+    aPeriod = Milliseconds(minutes * 60000);
+
+exit:
+    return error;
+}
+
+static uint64_t GetDiagKey(const otExtAddress &aExtAddress)
+{
+    uint64_t key = 0;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        key = (key << 8) | byte;
+    }
+
+    return key;
+}
+
+// Formats a server-sent event, every line of the JSON data goes to a "data" field.
+static std::string FormatEvent(const char *aName, const std::string &aData)
+{
+    std::string event     = "event: ";
+    size_t      lineBegin = 0;
+
+    event += aName;
+    event += '\n';
+
+    while (lineBegin < aData.size())
+    {
+        size_t lineEnd = aData.find('\n', lineBegin);
+
+        if (lineEnd == std::string::npos)
+        {
+            lineEnd = aData.size();
+        }
+
+        event += "data: ";
+        event.append(aData, lineBegin, lineEnd - lineBegin);
+        event += '\n';
+        lineBegin = lineEnd + 1;
+    }
+
+    event += '\n';
+
+    return event;
+}
+
+// Responses are serialized in CBOR for the clients asking for it, and in JSON otherwise.
+static JsonWriter::Format GetResponseFormat(const Request &aRequest)
+{
+    return aRequest.Accepts(OT_REST_MEDIA_TYPE_CBOR) ? JsonWriter::kFormatCbor : JsonWriter::kFormatJson;
+}
+
+static const CachePolicy *FindCachePolicy(const std::string &aUrl)
 {
-    std::string httpStatus;
+    const CachePolicy *policy = nullptr;
+
+    for (const CachePolicy &cachePolicy : kCachePolicies)
+    {
+        if (aUrl == cachePolicy.mPath)
+        {
+            policy = &cachePolicy;
+            break;
+        }
+    }
+
+    return policy;
+}
+
+static const char *GetHttpStatus(HttpStatusCode aErrorCode)
+{
+    const char *httpStatus = "";
 
     switch (aErrorCode)
     {
     case HttpStatusCode::kStatusOk:
         httpStatus = OT_REST_HTTP_STATUS_200;
         break;
+    case HttpStatusCode::kStatusBadRequest:
+        httpStatus = OT_REST_HTTP_STATUS_400;
+        break;
     case HttpStatusCode::kStatusResourceNotFound:
         httpStatus = OT_REST_HTTP_STATUS_404;
         break;
@@ -96,6 +307,15 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusRequestTimeout:
         httpStatus = OT_REST_HTTP_STATUS_408;
         break;
+    case HttpStatusCode::kStatusPayloadTooLarge:
+        httpStatus = OT_REST_HTTP_STATUS_413;
+        break;
+    case HttpStatusCode::kStatusUriTooLong:
+        httpStatus = OT_REST_HTTP_STATUS_414;
+        break;
+    case HttpStatusCode::kStatusTooManyRequests:
+        httpStatus = OT_REST_HTTP_STATUS_429;
+        break;
     case HttpStatusCode::kStatusInternalServerError:
         httpStatus = OT_REST_HTTP_STATUS_500;
         break;
@@ -104,40 +324,120 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     return httpStatus;
 }
 
+const Resource::Route Resource::kRoutes[] = {
+    {OT_REST_RESOURCE_PATH_BATCH, &Resource::Batch, false},
+    {OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::Diagnostic, false},
+    {OT_REST_RESOURCE_PATH_EVENTS, &Resource::Events, false},
+    {OT_REST_RESOURCE_PATH_MAINLOOP_STATS, &Resource::MainloopStats, true},
+    {OT_REST_RESOURCE_PATH_METRICS, &Resource::Metrics, false},
+    {OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo, true},
+    {OT_REST_RESOURCE_PATH_NODE_COUNTERS, &Resource::NodeCounters, true},
+    {OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr, true},
+    {OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId, true},
+    {OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData, true},
+    {OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName, true},
+    {OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute, true},
+    {OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc, true},
+    {OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16, true},
+    {OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State, true},
+};
+
+const Resource::Route *Resource::FindRoute(const std::string &aPath)
+{
+    const Route *route = std::lower_bound(std::begin(kRoutes), std::end(kRoutes), aPath,
+                                          [](const Route &aRoute, const std::string &aValue) {
+                                              return aValue.compare(aRoute.mPath) > 0;
+                                          });
+
+    return (route != std::end(kRoutes) && aPath == route->mPath) ? route : nullptr;
+}
+
 Resource::Resource(ControllerOpenThread *aNcp)
     : mNcp(aNcp)
+    , mMetricsSizeHint(0)
+    , mHasDiagSnapshot(false)
+    , mLastDiagRequestId(0)
+    , mClientRateLimiter(kClientRateLimit, kClientBurst, kMaxClientBuckets)
+    , mRateLimitedCount(MetricsRegistry::Get().AddCounter("otbr_rest_rate_limited_requests_total",
+                                                          "Requests rejected for the per-client rate limit."))
+    , mBusyCount(MetricsRegistry::Get().AddCounter(
+          "otbr_rest_busy_requests_total", "Requests rejected for the concurrency budget of expensive resources."))
+    , mDiagMemory("otbr_rest_diagnostics",
+                  "Nodes whose diagnostics are stored by the Rest server.",
+                  "otbr_rest_diagnostics_memory_bytes",
+                  "Estimated memory of the diagnostics stored by the Rest server.",
+                  [this](size_t &aNumEntries, size_t &aNumBytes) { EstimateDiagMemory(aNumEntries, aNumBytes); })
 {
     mInstance = mNcp->GetThreadHelper()->GetInstance();
 
-    // Resource Handler
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::Diagnostic);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
-
-    // Resource callback handler
-    mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::HandleDiagnosticCallback);
+    assert(std::is_sorted(std::begin(kRoutes), std::end(kRoutes), [](const Route &aLeft, const Route &aRight) {
+        return strcmp(aLeft.mPath, aRight.mPath) < 0;
+    }));
 }
 
 void Resource::Init(void)
 {
+    otChangedFlags flags = kEventChangedFlags;
+
+    for (const CachePolicy &policy : kCachePolicies)
+    {
+        flags |= policy.mFlags;
+    }
+
+    mNcp->AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); }, flags,
+                                        "rest");
+
+    if (OTBR_REST_DIAG_REFRESH_INTERVAL > 0)
+    {
+        RefreshDiagnostics();
+    }
 }
 
 void Resource::Handle(Request &aRequest, Response &aResponse) const
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceMap.find(url);
+    JsonWriter::Format format = GetResponseFormat(aRequest);
 
-    if (it != mResourceMap.end())
+    Json::SetFormat(format);
+    aResponse.SetFormat(format);
+    Dispatch(aRequest, aResponse);
+    Json::SetFormat(JsonWriter::kFormatJson);
+}
+
+bool Resource::AdmitRequest(uint32_t aClientAddress)
+{
+    bool admitted = true;
+
+    VerifyOrExit(kClientRateLimit > 0 && aClientAddress != INADDR_ANY);
+
+    if (!mClientRateLimiter.Admit(aClientAddress, steady_clock::now()))
     {
-        ResourceHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        mRateLimitedCount.Increment();
+        admitted = false;
+    }
+
+exit:
+    return admitted;
+}
+
+void Resource::Dispatch(Request &aRequest, Response &aResponse) const
+{
+    const std::string &url   = aRequest.GetUrl();
+    const Route *      route = FindRoute(url);
+
+    if (route != nullptr)
+    {
+        ResourceHandler resourceHandler = route->mHandler;
+        bool            isGet           = (aRequest.GetMethod() == HttpMethod::kGet);
+
+        if (!isGet || !GetCachedResponse(url, aResponse))
+        {
+            (this->*resourceHandler)(aRequest, aResponse);
+
+            if (isGet)
+            {
+                CacheResponse(url, aResponse);
+            }
+        }
     }
     else
     {
@@ -145,41 +445,93 @@ void Resource::Handle(Request &aRequest, Response &aResponse) const
     }
 }
 
-void Resource::HandleCallback(Request &aRequest, Response &aResponse)
+bool Resource::GetCachedResponse(const std::string &aUrl, Response &aResponse) const
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceCallbackMap.find(url);
+    bool               found  = false;
+    const CachePolicy *policy = FindCachePolicy(aUrl);
+    auto &             cache  = mResponseCache[Json::GetFormat()];
+    auto               it     = cache.find(aUrl);
+    std::string        errorCode;
 
-    if (it != mResourceCallbackMap.end())
+    VerifyOrExit(policy != nullptr && it != cache.end());
+
+    if (policy->mMaxAge != 0 &&
+        duration_cast<microseconds>(steady_clock::now() - it->second.mTime).count() > policy->mMaxAge)
     {
-        ResourceCallbackHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        cache.erase(it);
+        ExitNow();
     }
+
+    aResponse.SetBody(it->second.mBody);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    found = true;
+
+exit:
+    return found;
 }
 
-void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
+void Resource::CacheResponse(const std::string &aUrl, const Response &aResponse) const
 {
-    OT_UNUSED_VARIABLE(aRequest);
-    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    VerifyOrExit(FindCachePolicy(aUrl) != nullptr);
+    VerifyOrExit(aResponse.GetResponseCode() == GetHttpStatus(HttpStatusCode::kStatusOk));
 
-    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
-    if (duration >= kDiagCollectTimeout)
-    {
-        DeleteOutDatedDiagnostic();
+    mResponseCache[Json::GetFormat()][aUrl] = {aResponse.GetBody(), steady_clock::now()};
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+exit:
+    return;
+}
+
+void Resource::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    for (const CachePolicy &policy : kCachePolicies)
+    {
+        if (policy.mFlags & aFlags)
         {
-            diagContentSet.push_back(it->second.mDiagContent);
+            for (auto &cache : mResponseCache)
+            {
+                cache.erase(policy.mPath);
+            }
         }
+    }
 
-        body      = Json::Diag2JsonString(diagContentSet);
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-        aResponse.SetBody(body);
-        aResponse.SetComplete();
+    if (mEventHandler)
+    {
+        PublishEvents(aFlags);
+    }
+}
+
+void Resource::PublishEvents(otChangedFlags aFlags) const
+{
+    // The snapshot is refreshed before the state changed listeners are called.
+    std::shared_ptr<const Ncp::ThreadStateSnapshot> snapshot = mNcp->GetStateSnapshot();
+
+    VerifyOrExit(snapshot != nullptr);
+
+    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        mEventHandler(FormatEvent("role", Json::Number2JsonString(snapshot->mRole)));
+    }
+
+    if (aFlags & OT_CHANGED_THREAD_PARTITION_ID)
+    {
+        mEventHandler(FormatEvent("partition", Json::Number2JsonString(snapshot->mPartitionId)));
+    }
+
+    if ((aFlags & OT_CHANGED_THREAD_NETDATA) && snapshot->mHasLeaderData)
+    {
+        mEventHandler(FormatEvent("network-data", Json::LeaderData2JsonString(snapshot->mLeaderData)));
     }
+
+    if (aFlags & (OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED))
+    {
+        uint32_t numChildren = static_cast<uint32_t>(snapshot->mChildTable.size());
+
+        mEventHandler(FormatEvent("child-table", Json::Number2JsonString(numChildren)));
+    }
+
+exit:
+    return;
 }
 
 void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
@@ -189,6 +541,7 @@ void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) cons
 
     aResponse.SetResponsCode(errorMessage);
     aResponse.SetBody(body);
+    aResponse.SetFormat(Json::GetFormat());
     aResponse.SetComplete();
 }
 
@@ -489,6 +842,211 @@ void Resource::Rloc(const Request &aRequest, Response &aResponse) const
     }
 }
 
+void Resource::GetDataMainloopStats(Response &aResponse) const
+{
+    MainloopManager::Stats                stats     = MainloopManager::GetInstance().GetStats();
+    std::vector<MainloopManager::Latency> listeners = mNcp->GetStateChangedLatencies();
+    std::string                           body;
+    std::string                           errorCode;
+
+    stats.mLatencies.insert(stats.mLatencies.end(), listeners.begin(), listeners.end());
+    body = Json::MainloopStats2JsonString(stats);
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::GetDataNodeCounters(const Request &aRequest, Response &aResponse) const
+{
+    Milliseconds period;
+    std::string  body;
+    std::string  errorCode;
+
+    VerifyOrExit(GetCounterHistoryPeriod(aRequest, period) == OTBR_ERROR_NONE,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+
+    body = Json::CounterHistory2JsonString(mNcp->GetCounterHistory().GetIntervals(period),
+                                           ControllerOpenThread::GetCounterHistoryInterval(), Clock::now());
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+
+exit:
+    return;
+}
+
+void Resource::GetDataMetrics(Response &aResponse) const
+{
+    std::string body;
+    std::string errorCode;
+
+    // Scrapes are periodic, so reserve about the size of the previous scrape to render without reallocations.
+    body.reserve(mMetricsSizeHint);
+    Metrics::AppendLinkCounters(body, *otLinkGetCounters(mInstance));
+    Metrics::AppendIp6Counters(body, *otThreadGetIp6Counters(mInstance));
+    Metrics::AppendMainloopStats(body, MainloopManager::GetInstance().GetStats());
+    Metrics::AppendRadioStats(body, ControllerOpenThread::GetRadioStats());
+
+    if (mMdnsStatsGetter)
+    {
+        Metrics::AppendMdnsStats(body, mMdnsStatsGetter());
+    }
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    if (mSrpReadvertiseStatsGetter)
+    {
+        Metrics::AppendSrpReadvertiseStats(body, mSrpReadvertiseStatsGetter());
+    }
+#endif
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    if (mBackboneRouterCountersGetter)
+    {
+        Metrics::AppendBackboneRouterCounters(body, mBackboneRouterCountersGetter());
+    }
+#endif
+
+    MetricsRegistry::Get().Render(body);
+
+    mMetricsSizeHint = body.size();
+    aResponse.SetBody(std::move(body));
+    aResponse.SetContentType(OT_REST_METRICS_CONTENT_TYPE);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::Events(const Request &aRequest, Response &aResponse) const
+{
+    std::string statusCode;
+
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        statusCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(statusCode);
+        aResponse.SetEventStream();
+        aResponse.SetComplete();
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::Batch(const Request &aRequest, Response &aResponse) const
+{
+    otbrError                                        error     = OTBR_ERROR_NONE;
+    HttpStatusCode                                   errorCode = HttpStatusCode::kStatusBadRequest;
+    std::string                                      resources;
+    std::string                                      body;
+    std::string                                      statusCode;
+    std::vector<std::pair<std::string, std::string>> responses;
+    Request                                          request;
+    Response                                         response;
+    const Route *                                    route;
+    size_t                                           pathBegin = 0;
+
+    if (aRequest.GetMethod() != HttpMethod::kGet)
+    {
+        errorCode = HttpStatusCode::kStatusMethodNotAllowed;
+        ExitNow(error = OTBR_ERROR_INVALID_ARGS);
+    }
+
+    SuccessOrExit(error = aRequest.GetQueryParameter(kBatchResourcesParam, resources));
+    VerifyOrExit(!resources.empty(), error = OTBR_ERROR_INVALID_ARGS);
+
+    while (pathBegin <= resources.size())
+    {
+        size_t pathEnd = resources.find(',', pathBegin);
+
+        if (pathEnd == std::string::npos)
+        {
+            pathEnd = resources.size();
+        }
+
+        VerifyOrExit(responses.size() < kBatchMaxResources, error = OTBR_ERROR_INVALID_ARGS);
+
+        request.Reset();
+        response.Reset();
+        request.SetMethod(static_cast<int32_t>(HttpMethod::kGet));
+        SuccessOrExit(error = request.SetUrl(resources.data() + pathBegin, pathEnd - pathBegin));
+        request.SetReadComplete();
+
+        // The responses are keyed by the paths of the resources, which must be present and unique.
+        VerifyOrExit(!request.GetUrl().empty(), error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(std::none_of(responses.begin(), responses.end(),
+                                  [&request](const std::pair<std::string, std::string> &aResponse) {
+                                      return aResponse.first == request.GetUrl();
+                                  }),
+                     error = OTBR_ERROR_INVALID_ARGS);
+
+        route = FindRoute(request.GetUrl());
+
+        // Rejects the resources which may defer their response before dispatching them, so that they start no
+        // outstanding work on behalf of the batch.
+        if (route != nullptr && !route->mBatchable)
+        {
+            ErrorHandler(response, HttpStatusCode::kStatusBadRequest);
+        }
+        else
+        {
+            Dispatch(request, response);
+            assert(!response.NeedCallback());
+        }
+
+        responses.emplace_back(request.GetUrl(), response.GetBody());
+        pathBegin = pathEnd + 1;
+    }
+
+    body       = Json::Batch2JsonString(responses);
+    statusCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetBody(body);
+    aResponse.SetResponsCode(statusCode);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, errorCode);
+    }
+}
+
+void Resource::MainloopStats(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataMainloopStats(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::NodeCounters(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataNodeCounters(aRequest, aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::Metrics(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataMetrics(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
 void Resource::DeleteOutDatedDiagnostic(void)
 {
     auto eraseIt = mDiagSet.begin();
@@ -508,19 +1066,112 @@ void Resource::DeleteOutDatedDiagnostic(void)
     }
 }
 
-void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
+bool Resource::HasAllDiagnostics(steady_clock::time_point aStartTime) const
+{
+    bool                         hasAll = false;
+    otDeviceRole                 role   = otThreadGetDeviceRole(mInstance);
+    uint8_t                      maxRouterId;
+    otRouterInfo                 routerInfo;
+    otNetworkDiagTlv             diagTlv;
+    std::unordered_set<uint16_t> responders;
+    std::vector<uint16_t>        children;
+
+    auto hasDiagnostic = [this, aStartTime](const otExtAddress &aExtAddress) {
+        auto it = mDiagSet.find(GetDiagKey(aExtAddress));
+
+        return it != mDiagSet.end() && it->second.mStartTime >= aStartTime;
+    };
+
+    // The responders are only known from the router table of a router.
+    VerifyOrExit(role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER);
+    VerifyOrExit(hasDiagnostic(*otLinkGetExtendedAddress(mInstance)));
+
+    maxRouterId = otThreadGetMaxRouterId(mInstance);
+
+    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    {
+        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE || !routerInfo.mAllocated)
+        {
+            continue;
+        }
+
+        VerifyOrExit(hasDiagnostic(routerInfo.mExtAddress));
+    }
+
+    // Full Thread Device children of every router are subscribed to the multicast address of all routers too. They
+    // are learned from the child tables of the routers, this one included, which have all replied by now.
+    for (const auto &diag : mDiagSet)
+    {
+        size_t   offset = 0;
+        uint16_t rloc16 = 0;
+
+        if (diag.second.mStartTime < aStartTime)
+        {
+            continue;
+        }
+
+        while (diag.second.mDiagContent.GetNext(offset, diagTlv))
+        {
+            if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+            {
+                rloc16 = diagTlv.mData.mAddr16;
+                responders.insert(rloc16);
+            }
+            else if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE)
+            {
+                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
+                {
+                    const otNetworkDiagChildEntry &child = diagTlv.mData.mChildTable.mTable[i];
+
+                    if (child.mMode.mDeviceType)
+                    {
+                        // The child ID is relative to the RLOC16 of the parent, which precedes the child table.
+                        children.push_back(static_cast<uint16_t>(rloc16 | child.mChildId));
+                    }
+                }
+            }
+        }
+    }
+
+    for (uint16_t child : children)
+    {
+        VerifyOrExit(responders.count(child) != 0);
+    }
+
+    hasAll = true;
+
+exit:
+    return hasAll;
+}
+
+void Resource::UpdateDiag(uint64_t aKey, DiagRecord &&aDiag)
 {
-    DiagInfo value;
+    DiagInfo &value = mDiagSet[aKey];
 
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+    value.mStartTime   = steady_clock::now();
+    value.mDiagContent = std::move(aDiag);
 }
 
-void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+void Resource::EstimateDiagMemory(size_t &aNumEntries, size_t &aNumBytes) const
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
+    aNumEntries = mDiagSet.size();
+    aNumBytes   = MemoryUsage::GetHashTableSize(mDiagSet);
+
+    for (const auto &diag : mDiagSet)
+    {
+        aNumBytes += diag.second.mDiagContent.GetCapacity();
+    }
+
+    // The serialized diagnostics are kept as well.
+    for (const std::string &snapshot : mDiagSnapshot)
+    {
+        aNumBytes += MemoryUsage::GetHeapSize(snapshot);
+    }
+}
+
+otbrError Resource::SendDiagnosticGet(void) const
+{
+    otbrError           error         = OTBR_ERROR_NONE;
     struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
     struct otIp6Address multicastAddress;
 
@@ -536,15 +1187,182 @@ void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
                  error = OTBR_ERROR_REST);
 
 exit:
+    return error;
+}
 
-    if (error == OTBR_ERROR_NONE)
+void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+{
+    otbrError      error     = OTBR_ERROR_NONE;
+    HttpStatusCode errorCode = HttpStatusCode::kStatusInternalServerError;
+    uint32_t       timeout;
+    std::string    statusCode;
+
+    // The request is validated even if it's served from the snapshot, so that it fails the same way either way.
+    if (GetDiagCollectTimeout(aRequest, timeout) != OTBR_ERROR_NONE)
     {
-        aResponse.SetStartTime(steady_clock::now());
-        aResponse.SetCallback();
+        errorCode = HttpStatusCode::kStatusBadRequest;
+        ExitNow(error = OTBR_ERROR_INVALID_ARGS);
     }
-    else
+
+    if (mHasDiagSnapshot)
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+        // Serve every client from the snapshot of the background collector, without any radio traffic.
+        aResponse.SetBody(mDiagSnapshot[Json::GetFormat()]);
+        aResponse.SetAge(duration_cast<seconds>(steady_clock::now() - mDiagSnapshotTime).count());
+        statusCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(statusCode);
+        ExitNow();
+    }
+
+    if (mDiagRequests.size() >= kMaxDiagRequests)
+    {
+        mBusyCount.Increment();
+        errorCode = HttpStatusCode::kStatusTooManyRequests;
+        ExitNow(error = OTBR_ERROR_BUSY);
+    }
+
+    SuccessOrExit(error = SendDiagnosticGet());
+
+    {
+        uint32_t id = ++mLastDiagRequestId;
+
+        mDiagRequests.push_back({id, aResponse.Defer(), steady_clock::now(), Json::GetFormat(), false});
+        mNcp->PostTimerTask(Milliseconds(timeout / 1000), [this, id]() { ExpireDiagRequest(id); });
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, errorCode);
+    }
+}
+
+void Resource::ExpireDiagRequest(uint32_t aId) const
+{
+    for (DiagRequest &request : mDiagRequests)
+    {
+        if (request.mId == aId)
+        {
+            request.mIsExpired = true;
+        }
+    }
+
+    ServeDiagRequests();
+}
+
+void Resource::ServeDiagRequests(void) const
+{
+    std::shared_ptr<std::vector<DiagRecord>> diagContentSet;
+
+    for (auto it = mDiagRequests.begin(); it != mDiagRequests.end();)
+    {
+        if (it->mIsExpired || HasAllDiagnostics(it->mStartTime))
+        {
+            Response::Completion completion = it->mCompletion;
+
+            if (diagContentSet == nullptr)
+            {
+                diagContentSet = std::make_shared<std::vector<DiagRecord>>();
+
+                for (const auto &diag : mDiagSet)
+                {
+                    auto age = duration_cast<microseconds>(steady_clock::now() - diag.second.mStartTime).count();
+
+                    if (age < kDiagResetTimeout)
+                    {
+                        diagContentSet->push_back(diag.second.mDiagContent);
+                    }
+                }
+            }
+
+            SerializeDiagnostics(diagContentSet, it->mFormat, [completion](std::string aBody) mutable {
+                completion.Complete(GetHttpStatus(HttpStatusCode::kStatusOk), std::move(aBody));
+            });
+            it = mDiagRequests.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void Resource::RefreshDiagnostics(void)
+{
+    otbrError error = SendDiagnosticGet();
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to refresh diagnostics: %s", otbrErrorString(error));
+    }
+
+    mDiagRefreshStartTime = steady_clock::now();
+
+    mNcp->PostTimerTask(Milliseconds(kDiagCollectTimeout / 1000), [this]() { TakeDiagSnapshot(); });
+    mNcp->PostTimerTask(Milliseconds(OTBR_REST_DIAG_REFRESH_INTERVAL), [this]() { RefreshDiagnostics(); });
+}
+
+void Resource::TakeDiagSnapshot(void)
+{
+    auto diagContentSet = std::make_shared<std::vector<DiagRecord>>();
+
+    DeleteOutDatedDiagnostic();
+
+    // Nodes which did not reply to the last refresh have left the network.
+    for (const auto &diag : mDiagSet)
+    {
+        if (diag.second.mStartTime >= mDiagRefreshStartTime)
+        {
+            diagContentSet->push_back(diag.second.mDiagContent);
+        }
+    }
+
+    // The snapshot is taken outside of any request, so it is serialized for clients of every format. The handlers
+    // are called in order, so the snapshot is complete when the one of the last format is called.
+    for (uint8_t format = 0; format < JsonWriter::kNumFormats; ++format)
+    {
+        SerializeDiagnostics(diagContentSet, static_cast<JsonWriter::Format>(format),
+                             [this, format](std::string aBody) {
+                                 mDiagSnapshot[format] = std::move(aBody);
+
+                                 if (format + 1 == JsonWriter::kNumFormats)
+                                 {
+                                     mDiagSnapshotTime = steady_clock::now();
+                                     mHasDiagSnapshot  = true;
+                                 }
+                             });
+    }
+}
+
+void Resource::SerializeDiagnostics(std::shared_ptr<const std::vector<DiagRecord>> aDiagContentSet,
+                                    JsonWriter::Format                             aFormat,
+                                    std::function<void(std::string)>               aHandler) const
+{
+    bool isPosted = false;
+
+#if OTBR_REST_WORKER_SERIALIZE
+    // The diagnostics of a large network take long to serialize, which would delay the radio on the mainloop. The
+    // jobs share a serial key so that the handlers are called in the order of the calls.
+    isPosted = (mNcp->GetWorkerPool().Post<std::string>(
+                    [aDiagContentSet, aFormat]() {
+                        Json::SetFormat(aFormat);
+                        return Json::Diag2JsonString(*aDiagContentSet);
+                    },
+                    aHandler, this) == OTBR_ERROR_NONE);
+
+    if (!isPosted)
+    {
+        otbrLogWarning("Workers are busy, serialize the diagnostics on the mainloop");
+    }
+#endif
+
+    if (!isPosted)
+    {
+        JsonWriter::Format format = Json::GetFormat();
+
+        Json::SetFormat(aFormat);
+        aHandler(Json::Diag2JsonString(*aDiagContentSet));
+        Json::SetFormat(format);
     }
 }
 
@@ -558,32 +1376,36 @@ void Resource::DiagnosticResponseHandler(otError              aError,
 
 void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
-    std::vector<otNetworkDiagTlv> diagSet;
-    otNetworkDiagTlv              diagTlv;
-    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
-    otError                       error;
-    char                          rloc[7];
-    std::string                   keyRloc = "0xffee";
+    DiagRecord            diagSet;
+    otNetworkDiagTlv      diagTlv;
+    otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
+    otError               error;
+    bool                  hasKey = false;
+    uint64_t              key    = 0;
 
-    SuccessOrExit(aError);
+    SuccessOrExit(error = aError);
 
     OTBR_UNUSED_VARIABLE(aMessageInfo);
 
-    while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
+    while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv) == OT_ERROR_NONE)
     {
-        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS)
         {
-            sprintf(rloc, "0x%04x", diagTlv.mData.mAddr16);
-            keyRloc = Json::CString2JsonString(rloc);
+            key    = GetDiagKey(diagTlv.mData.mExtAddress);
+            hasKey = true;
         }
-        diagSet.push_back(diagTlv);
+        diagSet.Append(diagTlv);
     }
-    UpdateDiag(keyRloc, diagSet);
+
+    // The extended address is always requested, see `kAllTlvTypes`.
+    VerifyOrExit(hasKey, error = OT_ERROR_PARSE);
+    UpdateDiag(key, std::move(diagSet));
+    ServeDiagRequests();
 
 exit:
-    if (aError != OT_ERROR_NONE)
+    if (error != OT_ERROR_NONE)
     {
-        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(aError));
+        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(error));
     }
 }
 
@@ -34,16 +34,26 @@
 #ifndef OTBR_REST_RESOURCE_HPP_
 #define OTBR_REST_RESOURCE_HPP_
 
+#include <functional>
 #include <unordered_map>
 
 #include <openthread/border_router.h>
 
 #include "agent/ncp_openthread.hpp"
 #include "agent/thread_helper.hpp"
+#include "common/memory_usage.hpp"
+#include "common/metrics_registry.hpp"
+#include "common/srp_readvertise_stats.hpp"
+#include "mdns/mdns.hpp"
+#include "rest/client_rate_limiter.hpp"
 #include "rest/json.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
 
+#if OTBR_ENABLE_BACKBONE_ROUTER
+#include "backbone_router/backbone_agent.hpp"
+#endif
+
 using otbr::Ncp::ControllerOpenThread;
 using std::chrono::steady_clock;
 
@@ -76,6 +86,8 @@ public:
      * This method is the main entry of resource handler, which find corresponding handler according to request url
      * find the resource and set the content of response.
      *
+     * The response is serialized in CBOR if the request accepts "application/cbor", and in JSON otherwise.
+     *
      * @param[in]      aRequest  A request instance referred by the Resource handler.
      * @param[inout]   aResponse  A response instance will be set by the Resource handler.
      *
@@ -83,13 +95,32 @@ public:
     void Handle(Request &aRequest, Response &aResponse) const;
 
     /**
-     * This method distributes a callback handler for each connection needs a callback.
+     * This method checks a request from a client against the per client rate limit.
      *
-     * @param[in]      aRequest  A request instance referred by the Resource handler.
-     * @param[inout]   aResponse  A response instance will be set by the Resource handler.
+     * @param[in]  aClientAddress  The IPv4 address of the client, in network byte order. `INADDR_ANY` stands for a
+     *                             local client over the Unix domain socket, which is not rate limited.
+     *
+     * @retval  true   The request should be handled.
+     * @retval  false  The client exceeds its rate limit, the request should be rejected with 429.
      *
      */
-    void HandleCallback(Request &aRequest, Response &aResponse);
+    bool AdmitRequest(uint32_t aClientAddress);
+
+    /**
+     * This method returns the number of requests rejected for the per client rate limit.
+     *
+     * @returns  The number of rate limited requests.
+     *
+     */
+    uint64_t GetRateLimitedCount(void) const { return mRateLimitedCount.Get(); }
+
+    /**
+     * This method returns the number of requests rejected for the concurrency budget of expensive resources.
+     *
+     * @returns  The number of requests rejected as busy.
+     *
+     */
+    uint64_t GetBusyCount(void) const { return mBusyCount.Get(); }
 
     /**
      * This method provides a quick handler, which could directly set response code of a response and set error code and
@@ -101,9 +132,85 @@ public:
      */
     void ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const;
 
+    /**
+     * This function is called with every server-sent event to be pushed to the subscribers of `/events`.
+     *
+     * @param[in]  aEvent  The formatted event, including the terminating empty line.
+     *
+     */
+    using EventHandler = std::function<void(const std::string &aEvent)>;
+
+    /**
+     * This method sets the handler of the server-sent events driven by Thread state changes.
+     *
+     * The events are "role", "partition", "network-data" and "child-table", their data are the JSON values of the
+     * `/node/state`, the partition id, `/node/leader-data` and the number of children.
+     *
+     * @param[in]  aHandler  The event handler.
+     *
+     */
+    void SetEventHandler(EventHandler aHandler) { mEventHandler = std::move(aHandler); }
+
+    /**
+     * This function returns the publication statistics of the mDNS publisher.
+     *
+     * @returns  The publication statistics.
+     *
+     */
+    using MdnsStatsGetter = std::function<Mdns::Publisher::Stats(void)>;
+
+    /**
+     * This method sets the getter of the mDNS publication statistics exposed by `/metrics`.
+     *
+     * @param[in]  aGetter  The getter of the publication statistics.
+     *
+     */
+    void SetMdnsStatsGetter(MdnsStatsGetter aGetter) { mMdnsStatsGetter = std::move(aGetter); }
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This function returns the statistics of re-advertising the SRP hosts.
+     *
+     * @returns  The re-advertising statistics.
+     *
+     */
+    using SrpReadvertiseStatsGetter = std::function<SrpReadvertiseStats(void)>;
+
+    /**
+     * This method sets the getter of the SRP re-advertising statistics exposed by `/metrics`.
+     *
+     * @param[in]  aGetter  The getter of the re-advertising statistics.
+     *
+     */
+    void SetSrpReadvertiseStatsGetter(SrpReadvertiseStatsGetter aGetter)
+    {
+        mSrpReadvertiseStatsGetter = std::move(aGetter);
+    }
+#endif
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    /**
+     * This function returns the event counters of the Backbone Router.
+     *
+     * @returns  The Backbone Router counters.
+     *
+     */
+    using BackboneRouterCountersGetter = std::function<BackboneRouter::BackboneAgent::Counters(void)>;
+
+    /**
+     * This method sets the getter of the Backbone Router counters exposed by `/metrics`.
+     *
+     * @param[in]  aGetter  The getter of the Backbone Router counters.
+     *
+     */
+    void SetBackboneRouterCountersGetter(BackboneRouterCountersGetter aGetter)
+    {
+        mBackboneRouterCountersGetter = std::move(aGetter);
+    }
+#endif
+
 private:
     typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
-    typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
     void NodeInfo(const Request &aRequest, Response &aResponse) const;
     void ExtendedAddr(const Request &aRequest, Response &aResponse) const;
     void State(const Request &aRequest, Response &aResponse) const;
@@ -114,7 +221,23 @@ private:
     void ExtendedPanId(const Request &aRequest, Response &aResponse) const;
     void Rloc(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
-    void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+    void MainloopStats(const Request &aRequest, Response &aResponse) const;
+    void Events(const Request &aRequest, Response &aResponse) const;
+    void Batch(const Request &aRequest, Response &aResponse) const;
+    void Metrics(const Request &aRequest, Response &aResponse) const;
+    void NodeCounters(const Request &aRequest, Response &aResponse) const;
+
+    struct Route
+    {
+        const char *    mPath;      // The path of the resource
+        ResourceHandler mHandler;   // The handler of the resource
+        bool            mBatchable; // Whether the resource is served right away, so that it could be batched
+    };
+
+    // The routes sorted by path, looked up with a binary search so that dispatching allocates nothing
+    static const Route kRoutes[];
+
+    static const Route *FindRoute(const std::string &aPath);
 
     void GetNodeInfo(Response &aResponse) const;
     void GetDataExtendedAddr(Response &aResponse) const;
@@ -125,9 +248,28 @@ private:
     void GetDataRloc16(Response &aResponse) const;
     void GetDataExtendedPanId(Response &aResponse) const;
     void GetDataRloc(Response &aResponse) const;
+    void GetDataMainloopStats(Response &aResponse) const;
+    void GetDataMetrics(Response &aResponse) const;
+    void GetDataNodeCounters(const Request &aRequest, Response &aResponse) const;
+
+    void Dispatch(Request &aRequest, Response &aResponse) const;
+    bool GetCachedResponse(const std::string &aUrl, Response &aResponse) const;
+    void CacheResponse(const std::string &aUrl, const Response &aResponse) const;
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+    void PublishEvents(otChangedFlags aFlags) const;
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+    void      DeleteOutDatedDiagnostic(void);
+    bool      HasAllDiagnostics(steady_clock::time_point aStartTime) const;
+    otbrError SendDiagnosticGet(void) const;
+    void      RefreshDiagnostics(void);
+    void      TakeDiagSnapshot(void);
+    void      ExpireDiagRequest(uint32_t aId) const;
+    void      ServeDiagRequests(void) const;
+    void      SerializeDiagnostics(std::shared_ptr<const std::vector<DiagRecord>> aDiagContentSet,
+                                   JsonWriter::Format                             aFormat,
+                                   std::function<void(std::string)>               aHandler) const;
+    void      UpdateDiag(uint64_t aKey, DiagRecord &&aDiag);
+    void      EstimateDiagMemory(size_t &aNumEntries, size_t &aNumBytes) const;
 
     static void DiagnosticResponseHandler(otError              aError,
                                           otMessage *          aMessage,
@@ -138,10 +280,54 @@ private:
     otInstance *          mInstance;
     ControllerOpenThread *mNcp;
 
-    std::unordered_map<std::string, ResourceHandler>         mResourceMap;
-    std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
+    // Diagnostics of each node, keyed by the extended address of the node
+    std::unordered_map<uint64_t, DiagInfo> mDiagSet;
+
+    EventHandler    mEventHandler;
+    MdnsStatsGetter mMdnsStatsGetter;
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    SrpReadvertiseStatsGetter mSrpReadvertiseStatsGetter;
+#endif
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    BackboneRouterCountersGetter mBackboneRouterCountersGetter;
+#endif
+
+    // The size of the last `/metrics` response
+    mutable size_t mMetricsSizeHint;
+
+    // Diagnostics collected in the background, see OTBR_REST_DIAG_REFRESH_INTERVAL
+    bool                     mHasDiagSnapshot;
+    std::string              mDiagSnapshot[JsonWriter::kNumFormats];
+    steady_clock::time_point mDiagSnapshotTime;
+    steady_clock::time_point mDiagRefreshStartTime;
+
+    struct DiagRequest
+    {
+        uint32_t                 mId;
+        Response::Completion     mCompletion;
+        steady_clock::time_point mStartTime;
+        JsonWriter::Format       mFormat;
+        bool                     mIsExpired;
+    };
+
+    // Requests of `/diagnostics` waiting for the diagnostics of all nodes, or for their collect timeout
+    mutable std::vector<DiagRequest> mDiagRequests;
+    mutable uint32_t                 mLastDiagRequestId;
+
+    ClientRateLimiter         mClientRateLimiter;
+    MetricsRegistry::Counter &mRateLimitedCount;
+    MetricsRegistry::Counter &mBusyCount;
+
+    struct CachedResponse
+    {
+        std::string              mBody;
+        steady_clock::time_point mTime;
+    };
+
+    // Serialized bodies of GET responses for each format, invalidated by Thread state changes
+    mutable std::unordered_map<std::string, CachedResponse> mResponseCache[JsonWriter::kNumFormats];
 
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
+    MemoryReporter mDiagMemory;
 };
 
 } // namespace rest
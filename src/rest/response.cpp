@@ -28,9 +28,15 @@
 
 #include "rest/response.hpp"
 
+#include <utility>
+
 #include <stdio.h>
 
+#include "common/code_utils.hpp"
+
 #define OT_REST_RESPONSE_CONTENT_TYPE_JSON "application/json"
+#define OT_REST_RESPONSE_CONTENT_TYPE_CBOR "application/cbor"
+#define OT_REST_RESPONSE_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
     "Access-Control-Allow-Headers, Origin,Accept, X-Requested-With, Content-Type, Access-Control-Request-Method, " \
@@ -40,25 +46,21 @@
 namespace otbr {
 namespace rest {
 
+// The headers shared by all responses, following the content type
+static const char kStaticHeaders[] =
+    "\r\nAccess-Control-Allow-Origin: " OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN
+    "\r\nAccess-Control-Allow-Methods: " OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD
+    "\r\nAccess-Control-Allow-Headers: " OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS;
+
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mKeepAlive(false)
+    , mAge(-1)
+    , mEventStream(false)
+    , mGzip(false)
+    , mContentType(OT_REST_RESPONSE_CONTENT_TYPE_JSON)
 {
-    // HTTP protocol
-    mProtocol = "HTTP/1.1 ";
-
-    // Pre-defined headers
-    mHeaderField.push_back("Content-Type");
-    mHeaderValue.push_back(OT_REST_RESPONSE_CONTENT_TYPE_JSON);
-
-    mHeaderField.push_back("Access-Control-Allow-Origin");
-    mHeaderValue.push_back(OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN);
-
-    mHeaderField.push_back("Access-Control-Allow-Methods");
-    mHeaderValue.push_back(OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD);
-
-    mHeaderField.push_back("Access-Control-Allow-Headers");
-    mHeaderValue.push_back(OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS);
 }
 
 void Response::SetComplete()
@@ -76,6 +78,57 @@ steady_clock::time_point Response::GetStartTime() const
     return mStartTime;
 }
 
+void Response::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
+}
+
+void Response::SetAge(int64_t aAge)
+{
+    mAge = aAge;
+}
+
+void Response::SetFormat(JsonWriter::Format aFormat)
+{
+    mContentType =
+        aFormat == JsonWriter::kFormatCbor ? OT_REST_RESPONSE_CONTENT_TYPE_CBOR : OT_REST_RESPONSE_CONTENT_TYPE_JSON;
+}
+
+void Response::SetContentType(const char *aContentType)
+{
+    mContentType = aContentType;
+}
+
+void Response::SetGzip(void)
+{
+    mGzip = true;
+}
+
+void Response::SetEventStream(void)
+{
+    mEventStream = true;
+}
+
+bool Response::IsEventStream(void) const
+{
+    return mEventStream;
+}
+
+void Response::Reset(void)
+{
+    mAge         = -1;
+    mEventStream = false;
+    mGzip        = false;
+    mContentType = OT_REST_RESPONSE_CONTENT_TYPE_JSON;
+    mCallback    = false;
+    mComplete    = false;
+    mKeepAlive   = false;
+    mCode.clear();
+    mBody.clear();
+    SetCompletionHandler(nullptr);
+    mCompletion.mState.reset();
+}
+
 bool Response::IsComplete()
 {
     return mComplete == true;
@@ -86,9 +139,9 @@ void Response::SetResponsCode(std::string &aCode)
     mCode = aCode;
 }
 
-void Response::SetCallback(void)
+const std::string &Response::GetResponseCode(void) const
 {
-    mCallback = true;
+    return mCode;
 }
 
 void Response::SetBody(std::string &aBody)
@@ -96,30 +149,116 @@ void Response::SetBody(std::string &aBody)
     mBody = aBody;
 }
 
-std::string Response::GetBody(void) const
+void Response::SetBody(std::string &&aBody)
+{
+    mBody = std::move(aBody);
+}
+
+const std::string &Response::GetBody(void) const
 {
     return mBody;
 }
 
-bool Response::NeedCallback(void)
+Response::Completion Response::Defer(void)
+{
+    mCallback                        = true;
+    mCompletion.mState               = std::make_shared<Completion::State>();
+    mCompletion.mState->mIsCompleted = false;
+
+    return mCompletion;
+}
+
+bool Response::NeedCallback(void) const
 {
     return mCallback;
 }
 
-std::string Response::Serialize(void) const
+bool Response::IsCompletionReady(void) const
+{
+    return mCompletion.mState != nullptr && mCompletion.mState->mIsCompleted;
+}
+
+void Response::SetCompletionHandler(std::function<void(void)> aHandler)
+{
+    VerifyOrExit(mCompletion.mState != nullptr);
+    mCompletion.mState->mHandler = std::move(aHandler);
+
+exit:
+    return;
+}
+
+bool Response::ApplyCompletion(void)
+{
+    bool applied = false;
+
+    VerifyOrExit(IsCompletionReady());
+
+    mCode     = std::move(mCompletion.mState->mCode);
+    mBody     = std::move(mCompletion.mState->mBody);
+    mComplete = true;
+    SetCompletionHandler(nullptr);
+    mCompletion.mState.reset();
+    applied = true;
+
+exit:
+    return applied;
+}
+
+void Response::Completion::Complete(std::string aCode, std::string aBody)
+{
+    VerifyOrExit(!mState->mIsCompleted);
+
+    mState->mIsCompleted = true;
+    mState->mCode        = std::move(aCode);
+    mState->mBody        = std::move(aBody);
+
+    if (mState->mHandler != nullptr)
+    {
+        mState->mHandler();
+    }
+
+exit:
+    return;
+}
+
+void Response::SerializeHeader(std::string &aHeader) const
 {
-    size_t      index;
-    std::string spacer = "\r\n";
-    std::string ret(mProtocol + " " + mCode);
+    aHeader.clear();
+    aHeader += "HTTP/1.1 ";
+    aHeader += mCode;
 
-    for (index = 0; index < mHeaderField.size(); index++)
+    if (mEventStream)
     {
-        ret += (spacer + mHeaderField[index] + ": " + mHeaderValue[index]);
+        // The events are streamed until the connection is closed.
+        aHeader += "\r\nContent-Type: " OT_REST_RESPONSE_CONTENT_TYPE_EVENT_STREAM;
+        aHeader += kStaticHeaders;
+        aHeader += "\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n\r\n";
+        ExitNow();
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
-    ret += (spacer + spacer + mBody);
 
-    return ret;
+    aHeader += "\r\nContent-Type: ";
+    aHeader += mContentType;
+    aHeader += kStaticHeaders;
+    aHeader += mKeepAlive ? "\r\nConnection: keep-alive" : "\r\nConnection: close";
+
+    if (mAge >= 0)
+    {
+        aHeader += "\r\nAge: ";
+        aHeader += std::to_string(mAge);
+    }
+
+    if (mGzip)
+    {
+        aHeader += "\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nTransfer-Encoding: chunked\r\n\r\n";
+        ExitNow();
+    }
+
+    aHeader += "\r\nContent-Length: ";
+    aHeader += std::to_string(mBody.size());
+    aHeader += "\r\n\r\n";
+
+exit:
+    return;
 }
 
 } // namespace rest
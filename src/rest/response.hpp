@@ -35,10 +35,13 @@
 #define OTBR_REST_RESPONSE_HPP_
 
 #include <chrono>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "rest/types.hpp"
+#include "utils/json_writer.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -71,12 +74,20 @@ public:
      */
     void SetBody(std::string &aBody);
 
+    /**
+     * This method set the response body without copying it.
+     *
+     * @param[in] aBody A string to be moved into the response body.
+     *
+     */
+    void SetBody(std::string &&aBody);
+
     /**
      * This method return a string contains the body field of this response.
      *
      * @returns A string containing the body field.
      */
-    std::string GetBody(void) const;
+    const std::string &GetBody(void) const;
 
     /**
      * This method set the response code.
@@ -87,18 +98,89 @@ public:
     void SetResponsCode(std::string &aCode);
 
     /**
-     * This method labels the response as need callback.
+     * This class represents the completion of a response which is finished after its handler returns.
+     *
+     * Copies of a completion refer to the same response and only the first completion takes effect. The state is
+     * shared with the response, so a handler may complete it even after the connection of the response is closed.
+     *
+     */
+    class Completion
+    {
+    public:
+        /**
+         * This method completes the response unless it has been completed already.
+         *
+         * The connection of the response is woken up right away to write the response, so this method must be
+         * called on the mainloop.
+         *
+         * @param[in] aCode  The status code of the response, e.g. "200 OK".
+         * @param[in] aBody  The body of the response.
+         */
+        void Complete(std::string aCode, std::string aBody);
+
+        /**
+         * This method indicates whether the response has been completed.
+         *
+         * @returns  Whether the response has been completed.
+         */
+        bool IsCompleted(void) const { return mState->mIsCompleted; }
+
+    private:
+        friend class Response;
+
+        struct State
+        {
+            bool                      mIsCompleted;
+            std::string               mCode;
+            std::string               mBody;
+            std::function<void(void)> mHandler;
+        };
+
+        std::shared_ptr<State> mState;
+    };
+
+    /**
+     * This method defers the response, its handler completes the response later with the returned completion.
+     *
+     * @returns  The completion of the response.
+     */
+    Completion Defer(void);
+
+    /**
+     * This method checks whether this response is deferred, i.e. waits for its completion.
+     *
+     * @returns  A bool value indicates whether this response is deferred.
+     */
+    bool NeedCallback(void) const;
+
+    /**
+     * This method checks whether a deferred response has been completed but not applied yet.
+     *
+     * @returns  Whether the completion of the response is ready to be applied.
+     */
+    bool IsCompletionReady(void) const;
+
+    /**
+     * This method sets the handler called when a deferred response is completed.
      *
+     * @param[in]  aHandler  The handler, or nullptr to remove the handler.
+     */
+    void SetCompletionHandler(std::function<void(void)> aHandler);
+
+    /**
+     * This method applies the completion of a deferred response, after which the response is complete.
      *
+     * @retval  true   The completion has been applied.
+     * @retval  false  The response is not deferred or not completed yet.
      */
-    void SetCallback(void);
+    bool ApplyCompletion(void);
 
     /**
-     * This method checks whether this response need to be processed by callback handler later.
+     * This method returns the status code of the response.
      *
-     * @returns  A bool value indicates whether this response need to be processed by callback handler later.
+     * @returns  A string contains the status code, e.g. "200 OK".
      */
-    bool NeedCallback(void);
+    const std::string &GetResponseCode(void) const;
 
     /**
      * This method labels the response as complete which means all fields has been successfully set.
@@ -129,21 +211,85 @@ public:
     steady_clock::time_point GetStartTime() const;
 
     /**
-     * This method serialize a response to a string that could be sent by socket later.
+     * This method sets whether the connection is kept open after this response.
+     *
+     * @param[in] aKeepAlive  Whether the connection is kept open.
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
+    /**
+     * This method sets the age of the response, for responses served from a cache.
+     *
+     * @param[in] aAge  The age of the response in seconds.
+     */
+    void SetAge(int64_t aAge);
+
+    /**
+     * This method sets the format of the body, which decides the content type of the response.
+     *
+     * @param[in] aFormat  The format of the body, JSON by default.
+     */
+    void SetFormat(JsonWriter::Format aFormat);
+
+    /**
+     * This method sets the content type of a body which is neither JSON nor CBOR.
+     *
+     * @param[in] aContentType  A pointer to the content type, which must be a string literal.
+     */
+    void SetContentType(const char *aContentType);
+
+    /**
+     * This method labels the body of the response as sent with gzip compression.
+     *
+     * The header of such a response has no content length, the compressed body is sent in chunks instead.
+     *
+     */
+    void SetGzip(void);
+
+    /**
+     * This method labels the response as the start of a server-sent event stream.
+     *
+     * The header of such a response has no content length, the connection is kept open and the events are sent
+     * after the header as they happen.
+     *
+     */
+    void SetEventStream(void);
+
+    /**
+     * This method checks whether this response starts a server-sent event stream.
+     *
+     * @returns  A bool value indicates whether this response starts a server-sent event stream.
+     */
+    bool IsEventStream(void) const;
+
+    /**
+     * This method resets the response so that it could be used for the next request of a connection.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method serializes the status line and headers of the response.
+     *
+     * The body is not copied, it should be sent right after the header, e.g. with `writev()`.
      *
-     * @returns  A string contains status line, headers and body of a response.
+     * @param[out] aHeader  A reference to the string to receive the status line and headers. The string is
+     *                      cleared first, so that its buffer could be reused for every response.
      */
-    std::string Serialize(void) const;
+    void SerializeHeader(std::string &aHeader) const;
 
 private:
-    bool                     mCallback;
-    std::vector<std::string> mHeaderField;
-    std::vector<std::string> mHeaderValue;
-    std::string              mCode;
-    std::string              mProtocol;
-    std::string              mBody;
-    bool                     mComplete;
-    steady_clock::time_point mStartTime;
+    bool                          mCallback;
+    std::string                   mCode;
+    std::string                   mBody;
+    bool                          mComplete;
+    bool                          mKeepAlive;
+    int64_t                       mAge;
+    bool                          mEventStream;
+    bool                          mGzip;
+    const char *                  mContentType;
+    steady_clock::time_point      mStartTime;
+    Completion                    mCompletion;
 };
 
 } // namespace rest
@@ -32,8 +32,15 @@
 
 #include <cerrno>
 
-#include <fcntl.h>
+#include <assert.h>
+#include <inttypes.h>
 
+#include <netinet/tcp.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
 #include "utils/socket_utils.hpp"
 
 using std::chrono::duration_cast;
@@ -43,14 +50,65 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
+#ifndef OTBR_REST_LISTEN_BACKLOG
+#define OTBR_REST_LISTEN_BACKLOG 128
+#endif
+
+#ifndef OTBR_REST_MAX_CONNECTIONS
+#define OTBR_REST_MAX_CONNECTIONS 500
+#endif
+
+#ifndef OTBR_REST_MAX_CLIENT_CONNECTIONS
+#define OTBR_REST_MAX_CLIENT_CONNECTIONS 32
+#endif
+
+#ifndef OTBR_REST_CONNECTION_POOL_SIZE
+#define OTBR_REST_CONNECTION_POOL_SIZE 32
+#endif
+
+#ifndef OTBR_REST_UNIX_SOCKET_MODE
+#define OTBR_REST_UNIX_SOCKET_MODE 0660
+#endif
+
+#if !OTBR_ENABLE_EPOLL && OTBR_REST_MAX_CONNECTIONS >= FD_SETSIZE
+#error "OTBR_REST_MAX_CONNECTIONS must be smaller than FD_SETSIZE without OTBR_EPOLL"
+#endif
+
+// Maximum number of pending connections in the accept queue of the kernel.
+static const int kListenBacklog = OTBR_REST_LISTEN_BACKLOG;
 // Maximum number of connection a server support at the same time.
-static const uint32_t kMaxServeNum = 500;
+static const uint32_t kMaxServeNum = OTBR_REST_MAX_CONNECTIONS;
+// Maximum number of connections from one client at the same time, so that one client could not starve the others.
+static const uint32_t kMaxClientServeNum = OTBR_REST_MAX_CLIENT_CONNECTIONS;
+// Maximum number of closed connections kept for reuse, so that a busy server doesn't allocate one per socket.
+static const size_t kConnectionPoolSize = OTBR_REST_CONNECTION_POOL_SIZE;
+// The response sent right before closing a connection over the limit of its client.
+static const char kTooManyConnectionsResponse[] =
+    "HTTP/1.1 429 Too Many Requests\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
 // Port number used by Rest server.
 static const uint32_t kPortNumber = 8081;
+// The client address of all the connections over the Unix domain socket, `INADDR_ANY` is never a TCP peer. The local
+// clients are exempt from the per client limits, the file mode of the socket controls who they are.
+static const uint32_t kLocalClientAddress = INADDR_ANY;
 
 RestWebServer::RestWebServer(ControllerOpenThread *aNcp)
     : mResource(Resource(aNcp))
     , mListenFd(-1)
+    , mUnixListenFd(-1)
+    , mConnections(MetricsRegistry::Get().AddGauge("otbr_rest_connections", "Open connections of the Rest server."))
+    , mAcceptedCount(MetricsRegistry::Get().AddCounter("otbr_rest_accepted_connections_total",
+                                                       "Connections accepted by the Rest server."))
+    , mAcceptQueueFullCount(MetricsRegistry::Get().AddCounter(
+          "otbr_rest_accept_queue_full_total", "Times the accept queue of the Rest server was found full."))
+    , mRejectedCount(MetricsRegistry::Get().AddCounter("otbr_rest_rejected_connections_total",
+                                                       "Connections rejected for the per-client connection limit."))
+    , mConnectionsMemory("otbr_rest_connection_objects",
+                         "Open and pooled connections of the Rest server.",
+                         "otbr_rest_connections_memory_bytes",
+                         "Estimated memory of the open and pooled connections of the Rest server.",
+                         [this](size_t &aNumEntries, size_t &aNumBytes) {
+                             EstimateConnectionsMemory(aNumEntries, aNumBytes);
+                         })
 {
 }
 
@@ -58,8 +116,16 @@ RestWebServer::~RestWebServer(void)
 {
     if (mListenFd != -1)
     {
+        MainloopManager::GetInstance().UnregisterFd(mListenFd);
         close(mListenFd);
     }
+
+    if (mUnixListenFd != -1)
+    {
+        MainloopManager::GetInstance().UnregisterFd(mUnixListenFd);
+        close(mUnixListenFd);
+        unlink(mUnixSocketPath.c_str());
+    }
 }
 
 RestWebServer *RestWebServer::GetRestWebServer(ControllerOpenThread *aNcp)
@@ -72,68 +138,189 @@ RestWebServer *RestWebServer::GetRestWebServer(ControllerOpenThread *aNcp)
 void RestWebServer::Init(void)
 {
     mResource.Init();
+    mConnectionPool.reserve(kConnectionPoolSize);
+    mResource.SetEventHandler([this](const std::string &aEvent) {
+        for (auto it = mConnectionSet.begin(); it != mConnectionSet.end();)
+        {
+            auto current = it++;
+
+            current->second.mConnection->SendEvent(aEvent);
+
+            // A client disconnected by the event is released right away, so that its fd is free for new clients.
+            if (current->second.mConnection->IsComplete())
+            {
+                ReleaseConnection(current);
+            }
+            else
+            {
+                UpdateConnection(current);
+            }
+        }
+    });
     InitializeListenFd();
+#ifdef OTBR_REST_UNIX_SOCKET
+    InitializeUnixListenFd(OTBR_REST_UNIX_SOCKET);
+#endif
 }
 
 void RestWebServer::Update(MainloopContext &aMainloop)
 {
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
+    auto now      = MainloopManager::GetInstance().GetNow();
+    auto deadline = mTimers.GetNextDeadline();
+    auto delay    = duration_cast<microseconds>(deadline - now);
+
+    // Only the earliest deadline matters, idle connections cost nothing here.
+    VerifyOrExit(!mTimers.IsEmpty());
 
-    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
+    if (deadline < now)
     {
-        Connection *connection = it->second.get();
-        connection->Update(aMainloop);
+        delay = microseconds::zero();
     }
 
+    if (delay <= FromTimeval<microseconds>(aMainloop.mTimeout))
+    {
+        aMainloop.mTimeout.tv_sec  = delay.count() / 1000000;
+        aMainloop.mTimeout.tv_usec = delay.count() % 1000000;
+    }
+
+exit:
     return;
 }
 
 void RestWebServer::Process(const MainloopContext &aMainloop)
 {
-    Connection *connection;
+    TimerWheel::Task task;
 
-    UpdateConnections(aMainloop.mReadFdSet);
+    OTBR_UNUSED_VARIABLE(aMainloop);
 
-    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
+    // Connections with socket events have been processed by their fd handlers, only expired ones are left.
+    while (mTimers.PopExpired(MainloopManager::GetInstance().GetNow(), task))
     {
-        connection = it->second.get();
-        connection->Process(aMainloop);
+        task();
     }
 }
 
-void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
+void RestWebServer::ProcessConnection(int32_t aFd, uint8_t aEvents)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    auto it = mConnectionSet.find(aFd);
 
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
+    VerifyOrExit(it != mConnectionSet.end());
+
+    if (!it->second.mConnection->IsComplete())
     {
-        Connection *connection = eraseIt->second.get();
+        it->second.mConnection->Process(aEvents);
+    }
 
-        if (connection->IsComplete())
-        {
-            eraseIt = mConnectionSet.erase(eraseIt);
-        }
-        else
+    if (it->second.mConnection->IsComplete())
+    {
+        ReleaseConnection(it);
+    }
+    else
+    {
+        UpdateConnection(it);
+    }
+
+exit:
+    return;
+}
+
+void RestWebServer::UpdateConnection(ConnectionMap::iterator aIt)
+{
+    int32_t          fd         = aIt->first;
+    ConnectionEntry &entry      = aIt->second;
+    Connection &     connection = *entry.mConnection;
+
+    // A connection completed here, e.g. by a late response, is released by its timer which expires right away, as the
+    // connections may be iterated meanwhile.
+    MainloopManager::GetInstance().UpdateFd(fd, connection.GetFdEvents());
+
+    if (!mTimers.Reschedule(entry.mTimer, connection.GetDeadline()))
+    {
+        entry.mTimer = mTimers.Add(connection.GetDeadline(), [this, fd]() { ProcessConnection(fd, 0); });
+    }
+}
+
+void RestWebServer::ReleaseConnection(ConnectionMap::iterator aIt)
+{
+    auto client = mClientConnections.find(aIt->second.mConnection->GetClientAddress());
+
+    if (client != mClientConnections.end() && --client->second == 0)
+    {
+        mClientConnections.erase(client);
+    }
+
+    mTimers.Cancel(aIt->second.mTimer);
+
+    if (mConnectionPool.size() < kConnectionPoolSize)
+    {
+        mConnectionPool.push_back(std::move(aIt->second.mConnection));
+    }
+
+    mConnectionSet.erase(aIt);
+    mConnections.Set(static_cast<int64_t>(mConnectionSet.size()));
+
+    // Only accept new connections when there is room for them
+    UpdateListenFds(mConnectionSet.size() < kMaxServeNum ? MainloopManager::kEventReadable : 0);
+}
+
+void RestWebServer::UpdateListenFds(uint8_t aEvents)
+{
+    // The connection limit is shared by the TCP and the local clients.
+    MainloopManager::GetInstance().UpdateFd(mListenFd, aEvents);
+
+    if (mUnixListenFd != -1)
+    {
+        MainloopManager::GetInstance().UpdateFd(mUnixListenFd, aEvents);
+    }
+}
+
+void RestWebServer::HandleListenFd(int32_t aListenFd)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    if (aListenFd == mListenFd && IsAcceptQueueFull())
+    {
+        mAcceptQueueFullCount.Increment();
+        otbrLogWarning("Accept queue is full, new connections may be dropped (%" PRIu64 " times)",
+                       mAcceptQueueFullCount.Get());
+    }
+
+    // Drain the accept queue so that a burst of clients is served in one mainloop iteration.
+    while (mConnectionSet.size() < kMaxServeNum)
+    {
+        error = Accept(aListenFd);
+
+        if (error != OTBR_ERROR_NONE)
         {
-            eraseIt++;
+            break;
         }
     }
 
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
+    if (error == OTBR_ERROR_REST)
     {
-        error = Accept(mListenFd);
+        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
     }
 
-    if (error != OTBR_ERROR_NONE)
+    if (mConnectionSet.size() >= kMaxServeNum)
     {
-        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
+        UpdateListenFds(0);
     }
 }
 
+bool RestWebServer::IsAcceptQueueFull(void) const
+{
+    bool            full = false;
+    struct tcp_info info;
+    socklen_t       length = sizeof(info);
+
+    // For a listening socket, `tcpi_unacked` is the length of the accept queue and `tcpi_sacked` its capacity.
+    VerifyOrExit(getsockopt(mListenFd, IPPROTO_TCP, TCP_INFO, &info, &length) == 0);
+    full = info.tcpi_unacked >= info.tcpi_sacked;
+
+exit:
+    return full;
+}
+
 void RestWebServer::InitializeListenFd(void)
 {
     otbrError   error = OTBR_ERROR_NONE;
@@ -155,9 +342,12 @@ void RestWebServer::InitializeListenFd(void)
     ret = bind(mListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), sizeof(sockaddr));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
 
-    ret = listen(mListenFd, 5);
+    ret = listen(mListenFd, kListenBacklog);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
+    MainloopManager::GetInstance().RegisterFd(mListenFd, MainloopManager::kEventReadable,
+                                              [this](uint8_t) { HandleListenFd(mListenFd); });
+
 exit:
 
     if (error != OTBR_ERROR_NONE)
@@ -168,67 +358,175 @@ exit:
     VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
+void RestWebServer::InitializeUnixListenFd(const char *aPath)
 {
-    std::string errorMessage;
     otbrError   error = OTBR_ERROR_NONE;
-    int32_t     err;
-    int32_t     fd;
-    sockaddr_in tmp;
-    socklen_t   addrlen = sizeof(tmp);
+    std::string errorMessage;
+    int32_t     ret;
+    int32_t     err = errno;
+    sockaddr_un address;
 
-    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
-    err = errno;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    VerifyOrExit(strlen(aPath) < sizeof(address.sun_path), err = ENAMETOOLONG, error = OTBR_ERROR_REST,
+                 errorMessage = "path");
+    strcpy(address.sun_path, aPath);
+
+    mUnixListenFd = SocketWithCloseExec(AF_UNIX, SOCK_STREAM, 0, kSocketNonBlock);
+    VerifyOrExit(mUnixListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
 
-    VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
+    // The socket left by a previous run would fail the bind.
+    ret = unlink(aPath);
+    VerifyOrExit(ret == 0 || errno == ENOENT, err = errno, error = OTBR_ERROR_REST, errorMessage = "unlink");
 
-    VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
+    ret = bind(mUnixListenFd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address));
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
+    mUnixSocketPath = aPath;
+
+    // Only the clients with write permission on the socket file may connect, which is settled before listening.
+    ret = chmod(aPath, OTBR_REST_UNIX_SOCKET_MODE);
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "chmod");
+
+    ret = listen(mUnixListenFd, kListenBacklog);
+    VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
-    CreateNewConnection(fd);
+    MainloopManager::GetInstance().RegisterFd(mUnixListenFd, MainloopManager::kEventReadable,
+                                              [this](uint8_t) { HandleListenFd(mUnixListenFd); });
 
 exit:
+
     if (error != OTBR_ERROR_NONE)
     {
-        if (fd != -1)
-        {
-            close(fd);
-            fd = -1;
-        }
+        otbrLogErr("InitializeUnixListenFd error %s %s : %s", errorMessage.c_str(), aPath, strerror(err));
+    }
+
+    VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
+}
+
+otbrError RestWebServer::Accept(int aListenFd)
+{
+    std::string      errorMessage;
+    otbrError        error = OTBR_ERROR_NONE;
+    int32_t          err;
+    int32_t          fd;
+    sockaddr_storage tmp;
+    socklen_t        addrlen = sizeof(tmp);
+    uint32_t         clientAddress;
+
+    fd  = accept4(aListenFd, reinterpret_cast<struct sockaddr *>(&tmp), &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    err = errno;
+
+    // `OTBR_ERROR_ERRNO` with `EAGAIN` tells that the accept queue is drained.
+    VerifyOrExit(fd >= 0 || (err != EAGAIN && err != EWOULDBLOCK), errno = err, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_REST, errorMessage = "accept");
+
+    // The local clients are only limited by the total number of connections.
+    clientAddress =
+        tmp.ss_family == AF_INET ? reinterpret_cast<sockaddr_in &>(tmp).sin_addr.s_addr : kLocalClientAddress;
+
+    if (IsClientOverLimit(clientAddress))
+    {
+        // Best effort, the client is told to back off without spending a connection slot on it.
+        OTBR_UNUSED_VARIABLE(send(fd, kTooManyConnectionsResponse, sizeof(kTooManyConnectionsResponse) - 1,
+                                  MSG_NOSIGNAL | MSG_DONTWAIT));
+        close(fd);
+        mRejectedCount.Increment();
+        ExitNow();
+    }
+
+    CreateNewConnection(fd, clientAddress);
+    mAcceptedCount.Increment();
+
+exit:
+    if (error == OTBR_ERROR_REST)
+    {
         otbrLogErr("Rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
     }
 
     return error;
 }
 
-void RestWebServer::CreateNewConnection(int &aFd)
+bool RestWebServer::IsClientOverLimit(uint32_t aClientAddress) const
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    auto client = mClientConnections.find(aClientAddress);
 
-    if (it.second == true)
+    return client != mClientConnections.end() && client->second >= kMaxClientServeNum;
+}
+
+void RestWebServer::EstimateConnectionsMemory(size_t &aNumEntries, size_t &aNumBytes) const
+{
+    aNumEntries = mConnectionSet.size() + mConnectionPool.size();
+    aNumBytes   = MemoryUsage::GetHashTableSize(mConnectionSet) + MemoryUsage::GetHeapSize(mConnectionPool);
+
+    for (const auto &entry : mConnectionSet)
     {
-        Connection *connection = it.first->second.get();
-        connection->Init();
+        aNumBytes += entry.second.mConnection->GetMemorySize();
     }
-    else
+
+    for (const auto &connection : mConnectionPool)
     {
-        // failure on inserting new connection
-        close(aFd);
-        aFd = -1;
+        aNumBytes += connection->GetMemorySize();
     }
 }
 
-bool RestWebServer::SetFdNonblocking(int32_t fd)
+void RestWebServer::CreateNewConnection(int &aFd, uint32_t aClientAddress)
 {
-    int32_t oldMode;
-    bool    ret = true;
+    int32_t                     fd    = aFd;
+    auto                        stale = mConnectionSet.find(fd);
+    std::unique_ptr<Connection> connection;
 
-    oldMode = fcntl(fd, F_GETFL);
+    // A connection completed without an event on its socket is only released by its timer, while the kernel may
+    // already have handed out its fd again.
+    if (stale != mConnectionSet.end())
+    {
+        assert(stale->second.mConnection->IsComplete());
+        ReleaseConnection(stale);
+    }
 
-    VerifyOrExit(fcntl(fd, F_SETFL, oldMode | O_NONBLOCK) >= 0, ret = false);
+    if (mConnectionPool.empty())
+    {
+        connection.reset(new Connection(steady_clock::now(), &mResource, fd, aClientAddress));
+    }
+    else
+    {
+        connection = std::move(mConnectionPool.back());
+        mConnectionPool.pop_back();
+        connection->Reset(steady_clock::now(), fd, aClientAddress);
+    }
 
-exit:
-    return ret;
+    auto it = mConnectionSet.emplace(fd, ConnectionEntry{std::move(connection), TimerWheel::kInvalidTimerId});
+
+    if (it.second == true)
+    {
+        it.first->second.mConnection->Init(
+            [this, fd]() {
+                auto woken = mConnectionSet.find(fd);
+
+                if (woken != mConnectionSet.end())
+                {
+                    UpdateConnection(woken);
+                }
+            },
+            [this, fd](uint8_t aEvents) { ProcessConnection(fd, aEvents); });
+
+        if (aClientAddress != kLocalClientAddress)
+        {
+            ++mClientConnections[aClientAddress];
+        }
+
+        mConnections.Set(static_cast<int64_t>(mConnectionSet.size()));
+
+        MainloopManager::GetInstance().RegisterFd(fd, 0,
+                                                  [this, fd](uint8_t aEvents) { ProcessConnection(fd, aEvents); });
+
+        // A new connection reads its request right away.
+        ProcessConnection(fd, 0);
+    }
+    else
+    {
+        // The connection failed to be inserted has been destroyed, which closed the fd.
+        aFd = -1;
+    }
 }
 
 } // namespace rest
@@ -34,11 +34,18 @@
 #ifndef OTBR_REST_REST_WEB_SERVER_HPP_
 #define OTBR_REST_REST_WEB_SERVER_HPP_
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <netinet/in.h>
 #include <netinet/ip.h>
 #include <sys/socket.h>
 
 #include "common/mainloop.hpp"
+#include "common/memory_usage.hpp"
+#include "common/metrics_registry.hpp"
+#include "common/timer_wheel.hpp"
 #include "rest/connection.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
@@ -92,13 +99,82 @@ public:
      */
     void Process(const MainloopContext &aMainloop) override;
 
+    /**
+     * This method returns the number of connections accepted since the server started.
+     *
+     * @returns  The number of accepted connections.
+     *
+     */
+    uint64_t GetAcceptedCount(void) const { return mAcceptedCount.Get(); }
+
+    /**
+     * This method returns how many times the accept queue of the listening socket was found full.
+     *
+     * The kernel drops new connections while the accept queue is full, so a growing counter tells that the listen
+     * backlog (`OTBR_REST_LISTEN_BACKLOG`) or the connection limit (`OTBR_REST_MAX_CONNECTIONS`) is too small.
+     *
+     * @returns  The number of times the accept queue was full.
+     *
+     */
+    uint64_t GetAcceptQueueFullCount(void) const { return mAcceptQueueFullCount.Get(); }
+
+    /**
+     * This method sets the getter of the mDNS publication statistics exposed by `/metrics`.
+     *
+     * @param[in]  aGetter  The getter of the publication statistics.
+     *
+     */
+    void SetMdnsStatsGetter(Resource::MdnsStatsGetter aGetter) { mResource.SetMdnsStatsGetter(std::move(aGetter)); }
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method sets the getter of the SRP re-advertising statistics exposed by `/metrics`.
+     *
+     * @param[in]  aGetter  The getter of the re-advertising statistics.
+     *
+     */
+    void SetSrpReadvertiseStatsGetter(Resource::SrpReadvertiseStatsGetter aGetter)
+    {
+        mResource.SetSrpReadvertiseStatsGetter(std::move(aGetter));
+    }
+#endif
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    /**
+     * This method sets the getter of the Backbone Router counters exposed by `/metrics`.
+     *
+     * @param[in]  aGetter  The getter of the Backbone Router counters.
+     *
+     */
+    void SetBackboneRouterCountersGetter(Resource::BackboneRouterCountersGetter aGetter)
+    {
+        mResource.SetBackboneRouterCountersGetter(std::move(aGetter));
+    }
+#endif
+
 private:
+    struct ConnectionEntry
+    {
+        std::unique_ptr<Connection> mConnection;
+        // The timer processing the connection at its deadline
+        TimerWheel::TimerId mTimer;
+    };
+
+    using ConnectionMap = std::unordered_map<int32_t, ConnectionEntry>;
+
     RestWebServer(ControllerOpenThread *aNcp);
-    void      UpdateConnections(const fd_set &aReadFdSet);
-    void      CreateNewConnection(int32_t &aFd);
+    void      ProcessConnection(int32_t aFd, uint8_t aEvents);
+    void      UpdateConnection(ConnectionMap::iterator aIt);
+    void      ReleaseConnection(ConnectionMap::iterator aIt);
+    void      HandleListenFd(int32_t aListenFd);
+    void      UpdateListenFds(uint8_t aEvents);
+    void      CreateNewConnection(int32_t &aFd, uint32_t aClientAddress);
     otbrError Accept(int32_t aListenFd);
     void      InitializeListenFd(void);
-    bool      SetFdNonblocking(int32_t fd);
+    void      InitializeUnixListenFd(const char *aPath);
+    bool      IsAcceptQueueFull(void) const;
+    bool      IsClientOverLimit(uint32_t aClientAddress) const;
+    void      EstimateConnectionsMemory(size_t &aNumEntries, size_t &aNumBytes) const;
 
     // Resource handler
     Resource mResource;
@@ -106,8 +182,28 @@ private:
     sockaddr_in mAddress;
     // File descriptor for listening
     int32_t mListenFd;
+    // File descriptor for listening on the Unix domain socket of local clients, -1 if disabled
+    int32_t mUnixListenFd;
+    // Path of the Unix domain socket, removed when the server is destroyed
+    std::string mUnixSocketPath;
     // Connection List
-    std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    ConnectionMap mConnectionSet;
+    // Deadlines of the connections, so that only the expired ones are processed
+    TimerWheel mTimers;
+    // Closed connections kept for reuse
+    std::vector<std::unique_ptr<Connection>> mConnectionPool;
+    // Number of open connections
+    MetricsRegistry::Gauge &mConnections;
+    // Number of accepted connections
+    MetricsRegistry::Counter &mAcceptedCount;
+    // Number of times the accept queue was found full
+    MetricsRegistry::Counter &mAcceptQueueFullCount;
+    // Number of connections rejected for the limit of their client
+    MetricsRegistry::Counter &mRejectedCount;
+    // Number of connections of each client, keyed by the IPv4 address of the client
+    std::unordered_map<uint32_t, uint32_t> mClientConnections;
+    // Memory of the open and pooled connections
+    MemoryReporter mConnectionsMemory;
 };
 
 } // namespace rest
@@ -40,6 +40,8 @@
 
 #include "openthread/netdiag.h"
 
+#include "rest/diag_record.hpp"
+
 using std::chrono::steady_clock;
 
 namespace otbr {
@@ -59,9 +61,13 @@ enum class HttpMethod : std::uint8_t
 enum class HttpStatusCode : std::uint16_t
 {
     kStatusOk                  = 200,
+    kStatusBadRequest          = 400,
     kStatusResourceNotFound    = 404,
     kStatusMethodNotAllowed    = 405,
     kStatusRequestTimeout      = 408,
+    kStatusPayloadTooLarge     = 413,
+    kStatusUriTooLong          = 414,
+    kStatusTooManyRequests     = 429,
     kStatusInternalServerError = 500,
 };
 
@@ -82,6 +88,8 @@ enum class ConnectionState : std::uint8_t
     kWriteTimeout  = 5, ///< Reach write timeout
     kInternalError = 6, ///< Occur internal call error
     kComplete      = 7, ///< No longer need to be processed
+    kIdleWait      = 8, ///< Wait for the next request of a kept-alive connection
+    kEventStream   = 9, ///< Stream server-sent events to the client
 
 };
 struct NodeInfo
@@ -98,8 +106,8 @@ struct NodeInfo
 
 struct DiagInfo
 {
-    steady_clock::time_point      mStartTime;
-    std::vector<otNetworkDiagTlv> mDiagContent;
+    steady_clock::time_point mStartTime;
+    DiagRecord               mDiagContent;
 };
 
 } // namespace rest
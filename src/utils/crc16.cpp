@@ -35,30 +35,111 @@
 
 namespace otbr {
 
+namespace {
+
+template <size_t... kIndexes> struct IndexSequence
+{
+};
+
+template <size_t kSize, size_t... kIndexes>
+struct MakeIndexSequence : MakeIndexSequence<kSize - 1, kSize - 1, kIndexes...>
+{
+};
+
+template <size_t... kIndexes> struct MakeIndexSequence<0, kIndexes...>
+{
+    typedef IndexSequence<kIndexes...> Type;
+};
+
+constexpr uint16_t ShiftBit(uint16_t aPolynomial, uint16_t aCrc)
+{
+    return (aCrc & 0x8000) ? static_cast<uint16_t>(static_cast<uint16_t>(aCrc << 1) ^ aPolynomial)
+                           : static_cast<uint16_t>(aCrc << 1);
+}
+
+constexpr uint16_t ShiftBits(uint16_t aPolynomial, uint16_t aCrc, uint8_t aNumBits)
+{
+    return aNumBits == 0 ? aCrc : ShiftBits(aPolynomial, ShiftBit(aPolynomial, aCrc), aNumBits - 1);
+}
+
+constexpr uint16_t ByteEntry(uint16_t aPolynomial, uint8_t aByte)
+{
+    return ShiftBits(aPolynomial, static_cast<uint16_t>(aByte << 8), 8);
+}
+
+// Appends a zero byte to the message whose CRC16 is `aCrc`.
+constexpr uint16_t AppendZero(uint16_t aPolynomial, uint16_t aCrc)
+{
+    return static_cast<uint16_t>(static_cast<uint16_t>(aCrc << 8) ^ ByteEntry(aPolynomial, aCrc >> 8));
+}
+
+constexpr uint16_t SliceEntry(uint16_t aPolynomial, uint8_t aByte, uint8_t aNumZeros)
+{
+    return aNumZeros == 0 ? ByteEntry(aPolynomial, aByte)
+                          : AppendZero(aPolynomial, SliceEntry(aPolynomial, aByte, aNumZeros - 1));
+}
+
+template <size_t... kBytes> constexpr Crc16::Table MakeTable(uint16_t aPolynomial, IndexSequence<kBytes...>)
+{
+    return Crc16::Table{{
+        {SliceEntry(aPolynomial, kBytes, 0)...},
+        {SliceEntry(aPolynomial, kBytes, 1)...},
+        {SliceEntry(aPolynomial, kBytes, 2)...},
+        {SliceEntry(aPolynomial, kBytes, 3)...},
+        {SliceEntry(aPolynomial, kBytes, 4)...},
+        {SliceEntry(aPolynomial, kBytes, 5)...},
+        {SliceEntry(aPolynomial, kBytes, 6)...},
+        {SliceEntry(aPolynomial, kBytes, 7)...},
+    }};
+}
+
+static_assert(Crc16::kNumSlices == 8, "MakeTable() doesn't match kNumSlices");
+
+// The tables are generated at compile time.
+constexpr Crc16::Table kCcittTable = MakeTable(Crc16::kCcitt, MakeIndexSequence<Crc16::kTableSize>::Type());
+constexpr Crc16::Table kAnsiTable  = MakeTable(Crc16::kAnsi, MakeIndexSequence<Crc16::kTableSize>::Type());
+
+static_assert(kCcittTable.mEntries[0][0x01] == Crc16::kCcitt && kAnsiTable.mEntries[0][0x01] == Crc16::kAnsi,
+              "Invalid CRC16 lookup tables");
+
+} // namespace
+
 Crc16::Crc16(Polynomial aPolynomial)
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
+    mTable = &GetTable(aPolynomial);
     Init();
 }
 
+const Crc16::Table &Crc16::GetTable(Polynomial aPolynomial)
+{
+    return (aPolynomial == kCcitt) ? kCcittTable : kAnsiTable;
+}
+
 void Crc16::Update(uint8_t aByte)
 {
-    uint8_t i;
+    mCrc = static_cast<uint16_t>(mCrc << 8) ^ mTable->mEntries[0][static_cast<uint8_t>(mCrc >> 8) ^ aByte];
+}
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+void Crc16::Update(const uint8_t *aData, size_t aLength)
+{
+    const uint16_t(*entries)[kTableSize] = mTable->mEntries;
+    uint16_t crc                         = mCrc;
+
+    // The CRC16 is linear: the CRC of eight bytes is the XOR of the CRCs of each byte followed by as many zero bytes
+    // as there are bytes after it. The current CRC is XORed into the first two bytes.
+    for (; aLength >= kNumSlices; aData += kNumSlices, aLength -= kNumSlices)
+    {
+        crc ^= static_cast<uint16_t>((aData[0] << 8) | aData[1]);
+        crc = entries[7][crc >> 8] ^ entries[6][crc & 0xff] ^ entries[5][aData[2]] ^ entries[4][aData[3]] ^
+              entries[3][aData[4]] ^ entries[2][aData[5]] ^ entries[1][aData[6]] ^ entries[0][aData[7]];
+    }
 
-    do
+    for (; aLength > 0; aData++, aLength--)
     {
-        if (mCrc & 0x8000)
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
-        }
-        else
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
-        }
-    } while (--i);
+        crc = static_cast<uint16_t>(crc << 8) ^ entries[0][static_cast<uint8_t>(crc >> 8) ^ *aData];
+    }
+
+    mCrc = crc;
 }
 
 } // namespace otbr
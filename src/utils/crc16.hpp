@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -75,6 +76,17 @@ public:
      */
     void Update(uint8_t aByte);
 
+    /**
+     * This method feeds a sequence of bytes into the CRC16 computation.
+     *
+     * The bytes are processed eight at a time with slicing lookup tables, rather than bit by bit.
+     *
+     * @param[in]  aData    A pointer to the bytes.
+     * @param[in]  aLength  The number of bytes.
+     *
+     */
+    void Update(const uint8_t *aData, size_t aLength);
+
     /**
      * This method gets the current CRC16 value.
      *
@@ -83,9 +95,28 @@ public:
      */
     uint16_t Get(void) const { return mCrc; }
 
+    enum
+    {
+        kNumSlices = 8,   ///< The number of bytes processed at a time by `Update()`.
+        kTableSize = 256, ///< The number of entries of a lookup table, one per byte value.
+    };
+
+    /**
+     * This type represents the lookup tables of a polynomial.
+     *
+     * `mEntries[n][b]` is the CRC16 of byte `b` followed by `n` zero bytes.
+     *
+     */
+    struct Table
+    {
+        uint16_t mEntries[kNumSlices][kTableSize];
+    };
+
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    static const Table &GetTable(Polynomial aPolynomial);
+
+    uint16_t     mCrc;
+    const Table *mTable;
 };
 
 } // namespace otbr
@@ -0,0 +1,112 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the streaming gzip encoder.
+ */
+
+#include "utils/gzip_encoder.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+// 15 bits of window with 16 added to write a gzip header and trailer instead of a zlib one
+static constexpr int kGzipWindowBits = 15 + 16;
+static constexpr int kGzipMemLevel   = 8;
+
+GzipEncoder::GzipEncoder(void)
+    : mStarted(false)
+    , mFinished(false)
+{
+    memset(&mStream, 0, sizeof(mStream));
+}
+
+GzipEncoder::~GzipEncoder(void)
+{
+    Stop();
+}
+
+otbrError GzipEncoder::Start(const void *aInput, size_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    Stop();
+
+    // zlib never writes to the input.
+    mStream.next_in  = static_cast<Bytef *>(const_cast<void *>(aInput));
+    mStream.avail_in = static_cast<uInt>(aLength);
+
+    if (deflateInit2(&mStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, kGzipWindowBits, kGzipMemLevel,
+                     Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        errno = ENOMEM;
+        ExitNow(error = OTBR_ERROR_ERRNO);
+    }
+
+    mStarted  = true;
+    mFinished = false;
+
+exit:
+    return error;
+}
+
+size_t GzipEncoder::Encode(uint8_t *aOutput, size_t aSize)
+{
+    VerifyOrExit(mStarted && !mFinished, aSize = 0);
+
+    mStream.next_out  = aOutput;
+    mStream.avail_out = static_cast<uInt>(aSize);
+
+    // All the input is available, so the stream is finished right away and deflate() fills the whole buffer
+    // until it reaches the end of the stream.
+    if (deflate(&mStream, Z_FINISH) == Z_STREAM_END)
+    {
+        mFinished = true;
+    }
+
+    aSize -= mStream.avail_out;
+
+exit:
+    return aSize;
+}
+
+void GzipEncoder::Stop(void)
+{
+    if (mStarted)
+    {
+        deflateEnd(&mStream);
+        mStarted = false;
+    }
+}
+
+} // namespace otbr
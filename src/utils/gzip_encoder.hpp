@@ -0,0 +1,117 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definition of a streaming gzip encoder.
+ */
+
+#ifndef OTBR_UTILS_GZIP_ENCODER_HPP_
+#define OTBR_UTILS_GZIP_ENCODER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zlib.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a streaming gzip encoder.
+ *
+ * The input is compressed piece by piece into a caller provided buffer, so that the compressed data never has to be
+ * held in a second full-size buffer.
+ *
+ */
+class GzipEncoder
+{
+public:
+    /**
+     * This constructor initializes the gzip encoder.
+     *
+     */
+    GzipEncoder(void);
+
+    /**
+     * This destructor releases the resources of the gzip encoder.
+     *
+     */
+    ~GzipEncoder(void);
+
+    /**
+     * This method starts encoding an input.
+     *
+     * An encoding in progress is stopped first.
+     *
+     * @param[in]  aInput   A pointer to the input, which must stay valid until the encoding finishes or is stopped.
+     * @param[in]  aLength  The length of the input.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully started encoding.
+     * @retval OTBR_ERROR_ERRNO  Failed to allocate the compression state, `errno` is set to ENOMEM.
+     *
+     */
+    otbrError Start(const void *aInput, size_t aLength);
+
+    /**
+     * This method writes the next piece of the gzip stream.
+     *
+     * @param[out]  aOutput  A pointer to the buffer to receive the gzip stream.
+     * @param[in]   aSize    The size of the buffer.
+     *
+     * @returns  The number of bytes written, which is less than @p aSize only for the last piece of the stream.
+     *
+     */
+    size_t Encode(uint8_t *aOutput, size_t aSize);
+
+    /**
+     * This method indicates whether the whole gzip stream has been written.
+     *
+     * @returns  Whether the whole gzip stream has been written.
+     *
+     */
+    bool IsFinished(void) const { return mFinished; }
+
+    /**
+     * This method stops encoding and releases the compression state.
+     *
+     */
+    void Stop(void);
+
+private:
+    z_stream mStream;
+    bool     mStarted;
+    bool     mFinished;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_GZIP_ENCODER_HPP_
@@ -33,60 +33,49 @@
 
 #include "utils/hex.hpp"
 
-#include <string>
-
-#include <stdio.h>
 #include <string.h>
 
+#include "common/hex_codec.hpp"
+
 namespace otbr {
 
 namespace Utils {
 
 int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 {
-    size_t      hexLength = strlen(aHex);
-    const char *hexEnd    = aHex + hexLength;
-    uint8_t *   cur       = aBytes;
-    uint8_t     numChars  = hexLength & 1;
-    uint8_t     byte      = 0;
+    size_t   hexLength = strlen(aHex);
+    uint8_t *cur       = aBytes;
 
     if ((hexLength + 1) / 2 > aBytesLength)
     {
         return -1;
     }
 
-    while (aHex < hexEnd)
+    // An odd leading digit makes a byte on its own.
+    if (hexLength & 1)
     {
-        if ('A' <= *aHex && *aHex <= 'F')
-        {
-            byte |= 10 + (*aHex - 'A');
-        }
-        else if ('a' <= *aHex && *aHex <= 'f')
-        {
-            byte |= 10 + (*aHex - 'a');
-        }
-        else if ('0' <= *aHex && *aHex <= '9')
-        {
-            byte |= *aHex - '0';
-        }
-        else
+        int value = HexCodec::DecodeDigit(*aHex++);
+
+        if (value < 0)
         {
             return -1;
         }
 
-        aHex++;
-        numChars++;
+        *cur++ = static_cast<uint8_t>(value);
+        --hexLength;
+    }
 
-        if (numChars >= 2)
-        {
-            numChars = 0;
-            *cur++   = byte;
-            byte     = 0;
-        }
-        else
+    for (size_t i = 0; i < hexLength; i += 2)
+    {
+        int high = HexCodec::DecodeDigit(aHex[i]);
+        int low  = HexCodec::DecodeDigit(aHex[i + 1]);
+
+        if (high < 0 || low < 0)
         {
-            byte <<= 4;
+            return -1;
         }
+
+        *cur++ = static_cast<uint8_t>((high << 4) | low);
     }
 
     return static_cast<int>(cur - aBytes);
@@ -94,37 +83,23 @@ int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
 {
-    char byteHex[3];
+    HexCodec::Encode(aBytes, aBytesLength, aHex);
+    aHex[2 * aBytesLength] = '\0';
 
-    std::string hexString;
-    uint8_t     cur[aBytesLength];
-
-    memcpy(cur, aBytes, aBytesLength);
-
-    for (int i = 0; i < aBytesLength; i++)
-    {
-        sprintf(byteHex, "%02X", cur[i]);
-        hexString += byteHex;
-    }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+    return 2 * static_cast<size_t>(aBytesLength);
 }
 
 size_t Long2Hex(const uint64_t aLong, char *aHex)
 {
-    std::string hexString;
-    char        byteHex[3];
-    uint64_t    longValue = aLong;
+    uint8_t bytes[sizeof(uint64_t)];
 
+    // The least significant byte comes first.
     for (uint8_t i = 0; i < sizeof(uint64_t); i++)
     {
-        uint8_t byte = longValue & 0xff;
-        sprintf(byteHex, "%02X", byte);
-        hexString += byteHex;
-        longValue = longValue >> 8;
+        bytes[i] = static_cast<uint8_t>(aLong >> (8 * i));
     }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+
+    return Bytes2Hex(bytes, sizeof(bytes), aHex);
 }
 
 } // namespace Utils
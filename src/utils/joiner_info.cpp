@@ -0,0 +1,196 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the parsing and comparison of commissioner joiners.
+ */
+
+#include "utils/joiner_info.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "utils/hex.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+// The min length of a joiner PSKd.
+static constexpr size_t kMinJoinerPskdLength = 6;
+
+otError ParseJoinerInfo(const std::string &aJoinerId, const std::string &aPskd, otJoinerInfo &aJoinerInfo)
+{
+    otError     error = OT_ERROR_NONE;
+    std::size_t slash = aJoinerId.find('/');
+
+    memset(&aJoinerInfo, 0, sizeof(aJoinerInfo));
+
+    // The PSKd is made of uppercase alphanumeric characters except I, O, Q and Z.
+    VerifyOrExit(aPskd.size() >= kMinJoinerPskdLength && aPskd.size() <= OT_JOINER_MAX_PSKD_LENGTH,
+                 error = OT_ERROR_INVALID_ARGS);
+    for (char c : aPskd)
+    {
+        VerifyOrExit((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z' && strchr("IOQZ", c) == nullptr),
+                     error = OT_ERROR_INVALID_ARGS);
+    }
+    memcpy(aJoinerInfo.mPskd.m8, aPskd.c_str(), aPskd.size() + 1);
+
+    if (aJoinerId == "*")
+    {
+        aJoinerInfo.mType = OT_JOINER_INFO_TYPE_ANY;
+    }
+    else if (slash == std::string::npos)
+    {
+        aJoinerInfo.mType = OT_JOINER_INFO_TYPE_EUI64;
+        VerifyOrExit(aJoinerId.size() == 2 * sizeof(aJoinerInfo.mSharedId.mEui64.m8) &&
+                         Hex2Bytes(aJoinerId.c_str(), aJoinerInfo.mSharedId.mEui64.m8,
+                                          sizeof(aJoinerInfo.mSharedId.mEui64.m8)) > 0,
+                     error = OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        std::string        value  = aJoinerId.substr(0, slash);
+        std::string        length = aJoinerId.substr(slash + 1);
+        char *             end    = nullptr;
+        unsigned long long discerner;
+        unsigned long      discernerLength;
+
+        aJoinerInfo.mType = OT_JOINER_INFO_TYPE_DISCERNER;
+
+        VerifyOrExit(!value.empty() && value[0] != '-', error = OT_ERROR_INVALID_ARGS);
+        discerner = strtoull(value.c_str(), &end, 0);
+        VerifyOrExit(*end == '\0', error = OT_ERROR_INVALID_ARGS);
+
+        VerifyOrExit(!length.empty() && length[0] != '-', error = OT_ERROR_INVALID_ARGS);
+        discernerLength = strtoul(length.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0' && discernerLength > 0 && discernerLength <= OT_JOINER_MAX_DISCERNER_LENGTH,
+                     error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(discernerLength == 64 || (discerner >> discernerLength) == 0, error = OT_ERROR_INVALID_ARGS);
+
+        aJoinerInfo.mSharedId.mDiscerner.mValue  = discerner;
+        aJoinerInfo.mSharedId.mDiscerner.mLength = static_cast<uint8_t>(discernerLength);
+    }
+
+exit:
+    return error;
+}
+
+bool IsSameJoiner(const otJoinerInfo &aLhs, const otJoinerInfo &aRhs)
+{
+    bool isSame = (aLhs.mType == aRhs.mType);
+
+    VerifyOrExit(isSame);
+
+    switch (aLhs.mType)
+    {
+    case OT_JOINER_INFO_TYPE_EUI64:
+        isSame = (memcmp(aLhs.mSharedId.mEui64.m8, aRhs.mSharedId.mEui64.m8, sizeof(aLhs.mSharedId.mEui64.m8)) == 0);
+        break;
+    case OT_JOINER_INFO_TYPE_DISCERNER:
+        isSame = (aLhs.mSharedId.mDiscerner.mValue == aRhs.mSharedId.mDiscerner.mValue &&
+                  aLhs.mSharedId.mDiscerner.mLength == aRhs.mSharedId.mDiscerner.mLength);
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return isSame;
+}
+
+bool ContainsJoiner(const std::vector<otJoinerInfo> &aJoiners, const otJoinerInfo &aJoiner)
+{
+    bool contains = false;
+
+    for (const otJoinerInfo &joiner : aJoiners)
+    {
+        if (IsSameJoiner(joiner, aJoiner))
+        {
+            contains = true;
+            break;
+        }
+    }
+
+    return contains;
+}
+
+void ComputeSteeringData(const std::vector<otJoinerInfo> &aJoiners, SteeringData &aSteeringData)
+{
+    std::vector<uint8_t> joinerIds;
+    bool                 hasAnyJoiner = false;
+
+    // The joiner ids of all the joiners are collected so that the bloom filter is computed once.
+    for (const otJoinerInfo &joiner : aJoiners)
+    {
+        uint8_t joinerId[SteeringData::kSizeJoinerId];
+
+        if (joiner.mType == OT_JOINER_INFO_TYPE_ANY)
+        {
+            hasAnyJoiner = true;
+            break;
+        }
+
+        if (joiner.mType == OT_JOINER_INFO_TYPE_EUI64)
+        {
+            SteeringData::ComputeJoinerId(joiner.mSharedId.mEui64.m8, joinerId);
+        }
+        else
+        {
+            uint64_t value = joiner.mSharedId.mDiscerner.mValue;
+
+            // The joiner id of a discerner is its value in big-endian.
+            for (size_t i = sizeof(joinerId); i > 0; i--)
+            {
+                joinerId[i - 1] = static_cast<uint8_t>(value);
+                value >>= 8;
+            }
+        }
+
+        joinerIds.insert(joinerIds.end(), joinerId, joinerId + sizeof(joinerId));
+    }
+
+    if (hasAnyJoiner)
+    {
+        aSteeringData.Init(1);
+        aSteeringData.Set();
+    }
+    else
+    {
+        size_t numJoinerIds = joinerIds.size() / SteeringData::kSizeJoinerId;
+
+        aSteeringData.Init(SteeringData::ComputeLength(numJoinerIds));
+        aSteeringData.ComputeBloomFilter(joinerIds.data(), numJoinerIds);
+    }
+}
+
+} // namespace Utils
+
+} // namespace otbr
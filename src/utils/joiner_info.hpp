@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file provides the parsing and comparison of commissioner joiners.
+ */
+
+#ifndef OTBR_UTILS_JOINER_INFO_HPP_
+#define OTBR_UTILS_JOINER_INFO_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include <openthread/commissioner.h>
+
+#include "utils/steering_data.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This function parses a joiner.
+ *
+ * A joiner id is either `*` for any joiner, an EUI64 in hex, or a discerner as `value/length`.
+ *
+ * @param[in]   aJoinerId     The joiner id.
+ * @param[in]   aPskd         The pre-shared key of the joiner.
+ * @param[out]  aJoinerInfo   The parsed joiner.
+ *
+ * @retval OT_ERROR_NONE          Successfully parsed the joiner.
+ * @retval OT_ERROR_INVALID_ARGS  The joiner id or the PSKd is not valid.
+ *
+ */
+otError ParseJoinerInfo(const std::string &aJoinerId, const std::string &aPskd, otJoinerInfo &aJoinerInfo);
+
+/**
+ * This function tells whether two joiners are the same joiner entry of the commissioner.
+ *
+ * Only the type and the id of the joiners are compared, not their PSKd or expiration.
+ *
+ * @param[in]   aLhs  The first joiner.
+ * @param[in]   aRhs  The second joiner.
+ *
+ * @returns Whether the joiners are the same.
+ *
+ */
+bool IsSameJoiner(const otJoinerInfo &aLhs, const otJoinerInfo &aRhs);
+
+/**
+ * This function tells whether a list of joiners contains a joiner.
+ *
+ * @param[in]   aJoiners  The list of joiners.
+ * @param[in]   aJoiner   The joiner to look for.
+ *
+ * @returns Whether @p aJoiner is in @p aJoiners.
+ *
+ */
+bool ContainsJoiner(const std::vector<otJoinerInfo> &aJoiners, const otJoinerInfo &aJoiner);
+
+/**
+ * This function computes the steering data of a list of joiners.
+ *
+ * The bloom filter is computed once over the ids of all the joiners, and all its bits are set if any joiner is
+ * allowed.
+ *
+ * @param[in]   aJoiners        The list of joiners.
+ * @param[out]  aSteeringData   The steering data of the joiners.
+ *
+ */
+void ComputeSteeringData(const std::vector<otJoinerInfo> &aJoiners, SteeringData &aSteeringData);
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_JOINER_INFO_HPP_
@@ -0,0 +1,467 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the streaming JSON writer.
+ */
+
+#include "utils/json_writer.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/hex_codec.hpp"
+
+#include <cmath>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace otbr {
+
+// CBOR major types and simple values, see RFC 8949
+enum : uint8_t
+{
+    kCborUnsigned   = 0,
+    kCborNegative   = 1,
+    kCborByteString = 2,
+    kCborTextString = 3,
+    kCborArray      = 4,
+    kCborMap        = 5,
+};
+
+static constexpr uint8_t kCborFalse            = 0xf4;
+static constexpr uint8_t kCborTrue             = 0xf5;
+static constexpr uint8_t kCborNull             = 0xf6;
+static constexpr uint8_t kCborFloat            = 0xfa;
+static constexpr uint8_t kCborDouble           = 0xfb;
+static constexpr uint8_t kCborBreak            = 0xff;
+static constexpr uint8_t kCborIndefiniteLength = 31;
+
+JsonWriter::JsonWriter(bool aCompact)
+    : mCompact(aCompact)
+    , mAfterKey(false)
+    , mFormat(kFormatJson)
+{
+}
+
+void JsonWriter::Reset(void)
+{
+    mBuffer.clear();
+    mScopes.clear();
+    mAfterKey = false;
+}
+
+JsonWriter &JsonWriter::BeginScope(bool aIsArray)
+{
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        mBuffer += static_cast<char>(((aIsArray ? kCborArray : kCborMap) << 5) | kCborIndefiniteLength);
+    }
+    else
+    {
+        mBuffer += aIsArray ? '[' : '{';
+    }
+
+    mScopes.push_back({aIsArray, false});
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::EndScope(void)
+{
+    bool isArray = mScopes.back().mIsArray;
+
+    mScopes.pop_back();
+
+    if (mFormat == kFormatCbor)
+    {
+        mBuffer += static_cast<char>(kCborBreak);
+        ExitNow();
+    }
+
+    if (!mCompact && !isArray)
+    {
+        mBuffer += '\n';
+        AppendIndent(mScopes.size());
+    }
+
+    mBuffer += isArray ? ']' : '}';
+
+exit:
+    return *this;
+}
+
+JsonWriter &JsonWriter::Key(const char *aKey)
+{
+    Scope &scope = mScopes.back();
+
+    if (mFormat == kFormatCbor)
+    {
+        size_t length = strlen(aKey);
+
+        AppendCborHead(kCborTextString, length);
+        mBuffer.append(aKey, length);
+        mAfterKey = true;
+        ExitNow();
+    }
+
+    if (scope.mHasItems)
+    {
+        mBuffer += ',';
+    }
+
+    scope.mHasItems = true;
+
+    if (!mCompact)
+    {
+        mBuffer += '\n';
+        AppendIndent(mScopes.size());
+    }
+
+    AppendQuoted(aKey);
+    mBuffer += mCompact ? ":" : ":\t";
+    mAfterKey = true;
+
+exit:
+    return *this;
+}
+
+void JsonWriter::BeginValue(void)
+{
+    if (mAfterKey || mFormat == kFormatCbor)
+    {
+        // CBOR has no separators.
+        mAfterKey = false;
+    }
+    else if (!mScopes.empty())
+    {
+        Scope &scope = mScopes.back();
+
+        if (scope.mHasItems)
+        {
+            mBuffer += mCompact ? "," : ", ";
+        }
+
+        scope.mHasItems = true;
+    }
+}
+
+void JsonWriter::AppendCborHead(uint8_t aMajorType, uint64_t aArgument)
+{
+    uint8_t initialByte = static_cast<uint8_t>(aMajorType << 5);
+    uint8_t length;
+
+    // The argument follows the initial byte in big endian, in the shortest of 0, 1, 2, 4 or 8 bytes.
+    if (aArgument < 24)
+    {
+        mBuffer += static_cast<char>(initialByte | aArgument);
+        ExitNow();
+    }
+    else if (aArgument <= UINT8_MAX)
+    {
+        initialByte |= 24;
+        length = 1;
+    }
+    else if (aArgument <= UINT16_MAX)
+    {
+        initialByte |= 25;
+        length = 2;
+    }
+    else if (aArgument <= UINT32_MAX)
+    {
+        initialByte |= 26;
+        length = 4;
+    }
+    else
+    {
+        initialByte |= 27;
+        length = 8;
+    }
+
+    mBuffer += static_cast<char>(initialByte);
+
+    while (length-- > 0)
+    {
+        mBuffer += static_cast<char>((aArgument >> (length * 8)) & 0xff);
+    }
+
+exit:
+    return;
+}
+
+void JsonWriter::AppendIndent(size_t aDepth)
+{
+    mBuffer.append(aDepth, '\t');
+}
+
+void JsonWriter::AppendQuoted(const char *aString)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    mBuffer += '"';
+
+    for (const char *cur = aString; *cur != '\0'; ++cur)
+    {
+        unsigned char c = static_cast<unsigned char>(*cur);
+
+        switch (c)
+        {
+        case '"':
+            mBuffer += "\\\"";
+            break;
+        case '\\':
+            mBuffer += "\\\\";
+            break;
+        case '\b':
+            mBuffer += "\\b";
+            break;
+        case '\f':
+            mBuffer += "\\f";
+            break;
+        case '\n':
+            mBuffer += "\\n";
+            break;
+        case '\r':
+            mBuffer += "\\r";
+            break;
+        case '\t':
+            mBuffer += "\\t";
+            break;
+        default:
+            if (c < 0x20)
+            {
+                mBuffer += "\\u00";
+                mBuffer += kHexDigits[c >> 4];
+                mBuffer += kHexDigits[c & 0xf];
+            }
+            else
+            {
+                mBuffer += static_cast<char>(c);
+            }
+            break;
+        }
+    }
+
+    mBuffer += '"';
+}
+
+JsonWriter &JsonWriter::String(const char *aString)
+{
+    // A missing string is written as null.
+    VerifyOrExit(aString != nullptr, Null());
+
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        size_t length = strlen(aString);
+
+        AppendCborHead(kCborTextString, length);
+        mBuffer.append(aString, length);
+    }
+    else
+    {
+        AppendQuoted(aString);
+    }
+
+exit:
+    return *this;
+}
+
+JsonWriter &JsonWriter::Hex(const uint8_t *aBytes, size_t aLength)
+{
+    size_t offset;
+
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        AppendCborHead(kCborByteString, aLength);
+        mBuffer.append(reinterpret_cast<const char *>(aBytes), aLength);
+        ExitNow();
+    }
+
+    mBuffer += '"';
+    offset = mBuffer.size();
+    mBuffer.resize(offset + 2 * aLength);
+    HexCodec::Encode(aBytes, aLength, &mBuffer[offset]);
+    mBuffer += '"';
+
+exit:
+    return *this;
+}
+
+JsonWriter &JsonWriter::Uint(uint64_t aValue)
+{
+    char number[sizeof("18446744073709551615")];
+
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        AppendCborHead(kCborUnsigned, aValue);
+        ExitNow();
+    }
+
+    snprintf(number, sizeof(number), "%" PRIu64, aValue);
+    mBuffer += number;
+
+exit:
+    return *this;
+}
+
+JsonWriter &JsonWriter::Int(int64_t aValue)
+{
+    char number[sizeof("-9223372036854775808")];
+
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        // A negative integer n is encoded as the argument -1 - n.
+        if (aValue < 0)
+        {
+            AppendCborHead(kCborNegative, static_cast<uint64_t>(-(aValue + 1)));
+        }
+        else
+        {
+            AppendCborHead(kCborUnsigned, static_cast<uint64_t>(aValue));
+        }
+
+        ExitNow();
+    }
+
+    snprintf(number, sizeof(number), "%" PRId64, aValue);
+    mBuffer += number;
+
+exit:
+    return *this;
+}
+
+JsonWriter &JsonWriter::Double(double aValue)
+{
+    char number[32];
+
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        float    single = static_cast<float>(aValue);
+        uint64_t bits;
+        int      shift;
+
+        // Prefer single precision as long as it represents the same value.
+        if (static_cast<double>(single) == aValue)
+        {
+            uint32_t singleBits;
+
+            memcpy(&singleBits, &single, sizeof(singleBits));
+            bits  = singleBits;
+            shift = 24;
+            mBuffer += static_cast<char>(kCborFloat);
+        }
+        else
+        {
+            memcpy(&bits, &aValue, sizeof(bits));
+            shift = 56;
+            mBuffer += static_cast<char>(kCborDouble);
+        }
+
+        for (; shift >= 0; shift -= 8)
+        {
+            mBuffer += static_cast<char>((bits >> shift) & 0xff);
+        }
+
+        ExitNow();
+    }
+
+    if (!std::isfinite(aValue))
+    {
+        mBuffer += "null";
+        ExitNow();
+    }
+
+    // Prefer the shorter representation as long as it reads back to the same value.
+    snprintf(number, sizeof(number), "%1.15g", aValue);
+
+    if (strtod(number, nullptr) != aValue)
+    {
+        snprintf(number, sizeof(number), "%1.17g", aValue);
+    }
+
+    mBuffer += number;
+
+exit:
+    return *this;
+}
+
+JsonWriter &JsonWriter::Bool(bool aValue)
+{
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        mBuffer += static_cast<char>(aValue ? kCborTrue : kCborFalse);
+    }
+    else
+    {
+        mBuffer += aValue ? "true" : "false";
+    }
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::Null(void)
+{
+    BeginValue();
+
+    if (mFormat == kFormatCbor)
+    {
+        mBuffer += static_cast<char>(kCborNull);
+    }
+    else
+    {
+        mBuffer += "null";
+    }
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::Raw(const std::string &aJson)
+{
+    BeginValue();
+    mBuffer += aJson;
+
+    return *this;
+}
+
+} // namespace otbr
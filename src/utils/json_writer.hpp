@@ -0,0 +1,286 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definition of a streaming JSON writer.
+ */
+
+#ifndef OTBR_UTILS_JSON_WRITER_HPP_
+#define OTBR_UTILS_JSON_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class implements a streaming JSON writer.
+ *
+ * Values are appended to an output buffer as they are written, no document tree is built. The output buffer is
+ * reused by `Reset()`, so a long-lived writer does not allocate once its buffer has grown to the size of the
+ * largest document.
+ *
+ * The writer pretty-prints with tabs by default, in the same layout as `cJSON_Print()`. In compact mode, no
+ * whitespace is written at all.
+ *
+ * The same document may be written in CBOR (RFC 8949) instead, see `SetFormat()`. Objects and arrays are then
+ * encoded with indefinite lengths so that they can still be streamed, and byte arrays are written as byte strings
+ * rather than hex digits.
+ *
+ * The writer does not validate the document: the caller is responsible for writing a key before every value of an
+ * object and for closing every object and array.
+ *
+ */
+class JsonWriter
+{
+public:
+    /**
+     * The output formats.
+     *
+     */
+    enum Format : uint8_t
+    {
+        kFormatJson = 0, ///< JSON text.
+        kFormatCbor = 1, ///< CBOR encoded binary.
+    };
+
+    static constexpr uint8_t kNumFormats = 2; ///< The number of output formats.
+
+    /**
+     * This constructor initializes the JSON writer.
+     *
+     * @param[in]  aCompact  Whether to write compact JSON.
+     *
+     */
+    explicit JsonWriter(bool aCompact = false);
+
+    /**
+     * This method clears the output for a new document, keeping the allocated buffer.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method sets whether to write compact JSON.
+     *
+     * @param[in]  aCompact  Whether to write compact JSON.
+     *
+     */
+    void SetCompact(bool aCompact) { mCompact = aCompact; }
+
+    /**
+     * This method sets the output format.
+     *
+     * The format should only be changed right after `Reset()`.
+     *
+     * @param[in]  aFormat  The output format.
+     *
+     */
+    void SetFormat(Format aFormat) { mFormat = aFormat; }
+
+    /**
+     * This method returns the output format.
+     *
+     * @returns  The output format.
+     *
+     */
+    Format GetFormat(void) const { return mFormat; }
+
+    /**
+     * This method returns the document written so far.
+     *
+     * A CBOR document is binary, it may contain null characters.
+     *
+     * @returns  A reference to the output buffer, valid until the next write or `Reset()`.
+     *
+     */
+    const std::string &GetString(void) const { return mBuffer; }
+
+    /**
+     * This method begins an object.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &BeginObject(void) { return BeginScope(/* aIsArray */ false); }
+
+    /**
+     * This method ends the innermost object.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &EndObject(void) { return EndScope(); }
+
+    /**
+     * This method begins an array.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &BeginArray(void) { return BeginScope(/* aIsArray */ true); }
+
+    /**
+     * This method ends the innermost array.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &EndArray(void) { return EndScope(); }
+
+    /**
+     * This method writes the key of the next member of the innermost object.
+     *
+     * @param[in]  aKey  A pointer to the null-terminated key.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Key(const char *aKey);
+
+    /**
+     * This method writes a string value.
+     *
+     * @param[in]  aString  A pointer to the null-terminated string, null is written if it is nullptr.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &String(const char *aString);
+
+    /**
+     * This method writes a string value.
+     *
+     * @param[in]  aString  The string.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &String(const std::string &aString) { return String(aString.c_str()); }
+
+    /**
+     * This method writes a byte array as a string value of hex digits, or as a byte string in CBOR.
+     *
+     * @param[in]  aBytes   A pointer to the bytes.
+     * @param[in]  aLength  The number of bytes.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Hex(const uint8_t *aBytes, size_t aLength);
+
+    /**
+     * This method writes an unsigned integer value.
+     *
+     * @param[in]  aValue  The value.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Uint(uint64_t aValue);
+
+    /**
+     * This method writes a signed integer value.
+     *
+     * @param[in]  aValue  The value.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Int(int64_t aValue);
+
+    /**
+     * This method writes a floating point value.
+     *
+     * Infinities and NaN are not representable in JSON and are written as `null`. In CBOR, they are written as is.
+     *
+     * @param[in]  aValue  The value.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Double(double aValue);
+
+    /**
+     * This method writes a boolean value.
+     *
+     * @param[in]  aValue  The value.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Bool(bool aValue);
+
+    /**
+     * This method writes a null value.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Null(void);
+
+    /**
+     * This method writes a serialized value as is.
+     *
+     * @param[in]  aJson  The serialized value, which must be a valid value in the output format.
+     *
+     * @returns  A reference to this writer.
+     *
+     */
+    JsonWriter &Raw(const std::string &aJson);
+
+private:
+    struct Scope
+    {
+        bool mIsArray;
+        bool mHasItems;
+    };
+
+    JsonWriter &BeginScope(bool aIsArray);
+    JsonWriter &EndScope(void);
+    void        BeginValue(void);
+    void        AppendIndent(size_t aDepth);
+    void        AppendQuoted(const char *aString);
+    void        AppendCborHead(uint8_t aMajorType, uint64_t aArgument);
+
+    std::string        mBuffer;
+    std::vector<Scope> mScopes;
+    bool               mCompact;
+    bool               mAfterKey;
+    Format             mFormat;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_JSON_WRITER_HPP_
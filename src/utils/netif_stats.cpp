@@ -0,0 +1,382 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements sampling the traffic statistics of network interfaces over rtnetlink.
+ */
+
+#include "utils/netif_stats.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <errno.h>
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+
+namespace {
+
+struct MetricNames
+{
+    const char *mRxBytes;
+    const char *mRxBytesHelp;
+    const char *mTxBytes;
+    const char *mTxBytesHelp;
+    const char *mRxPackets;
+    const char *mRxPacketsHelp;
+    const char *mTxPackets;
+    const char *mTxPacketsHelp;
+    const char *mDrops;
+    const char *mDropsHelp;
+};
+
+// Indexed by `NetifStatsSampler::Role`.
+const MetricNames kMetricNames[] = {
+    {
+        "otbr_thread_netif_rx_bytes_per_second",
+        "Bytes received per second on the Thread network interface.",
+        "otbr_thread_netif_tx_bytes_per_second",
+        "Bytes transmitted per second on the Thread network interface.",
+        "otbr_thread_netif_rx_packets_per_second",
+        "Packets received per second on the Thread network interface.",
+        "otbr_thread_netif_tx_packets_per_second",
+        "Packets transmitted per second on the Thread network interface.",
+        "otbr_thread_netif_drops_per_second",
+        "Packets dropped per second on the Thread network interface.",
+    },
+    {
+        "otbr_backbone_netif_rx_bytes_per_second",
+        "Bytes received per second on the Backbone network interface.",
+        "otbr_backbone_netif_tx_bytes_per_second",
+        "Bytes transmitted per second on the Backbone network interface.",
+        "otbr_backbone_netif_rx_packets_per_second",
+        "Packets received per second on the Backbone network interface.",
+        "otbr_backbone_netif_tx_packets_per_second",
+        "Packets transmitted per second on the Backbone network interface.",
+        "otbr_backbone_netif_drops_per_second",
+        "Packets dropped per second on the Backbone network interface.",
+    },
+};
+
+uint64_t ComputeRate(uint64_t aPrevious, uint64_t aCurrent, Milliseconds aElapsed)
+{
+    return aCurrent >= aPrevious ? (aCurrent - aPrevious) * 1000 / static_cast<uint64_t>(aElapsed.count()) : 0;
+}
+
+} // namespace
+
+NetifStatsSampler::NetifStatsSampler(MetricsRegistry &aRegistry)
+    : mRegistry(aRegistry)
+    , mFd(-1)
+    , mSequence(0)
+{
+}
+
+NetifStatsSampler::~NetifStatsSampler(void)
+{
+    Close();
+}
+
+void NetifStatsSampler::AddInterface(Role aRole, const char *aIfName)
+{
+    const MetricNames &names = kMetricNames[static_cast<size_t>(aRole)];
+    Interface          netif;
+
+    assert(std::none_of(mInterfaces.begin(), mInterfaces.end(),
+                        [aRole](const Interface &aInterface) { return aInterface.mRole == aRole; }));
+
+    netif.mRole      = aRole;
+    netif.mName      = aIfName;
+    netif.mRxBytes   = &mRegistry.AddGauge(names.mRxBytes, names.mRxBytesHelp);
+    netif.mTxBytes   = &mRegistry.AddGauge(names.mTxBytes, names.mTxBytesHelp);
+    netif.mRxPackets = &mRegistry.AddGauge(names.mRxPackets, names.mRxPacketsHelp);
+    netif.mTxPackets = &mRegistry.AddGauge(names.mTxPackets, names.mTxPacketsHelp);
+    netif.mDrops     = &mRegistry.AddGauge(names.mDrops, names.mDropsHelp);
+
+    mInterfaces.push_back(std::move(netif));
+}
+
+otbrError NetifStatsSampler::Sample(Timepoint aNow)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    for (Interface &netif : mInterfaces)
+    {
+        otbrError sampleError = SampleInterface(netif, aNow);
+
+        // Do not exit on the first error so that the other interfaces are still sampled.
+        if (error == OTBR_ERROR_NONE)
+        {
+            error = sampleError;
+        }
+    }
+
+    return error;
+}
+
+NetifStatsSampler::Rates NetifStatsSampler::GetRates(Role aRole) const
+{
+    Rates rates;
+
+    for (const Interface &netif : mInterfaces)
+    {
+        if (netif.mRole == aRole)
+        {
+            rates = netif.mRates;
+        }
+    }
+
+    return rates;
+}
+
+otbrError NetifStatsSampler::SampleInterface(Interface &aInterface, Timepoint aNow)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    Counters  counters;
+
+    if (aInterface.mIndex == 0)
+    {
+        aInterface.mIndex = if_nametoindex(aInterface.mName.c_str());
+        VerifyOrExit(aInterface.mIndex != 0);
+    }
+
+    error = Request(aInterface.mIndex, counters);
+
+    if (error == OTBR_ERROR_ERRNO && errno == ENODEV)
+    {
+        // The interface is gone, its counters start over once it is recreated.
+        aInterface.mIndex   = 0;
+        aInterface.mSampled = false;
+        ExitNow(error = OTBR_ERROR_NONE);
+    }
+
+    SuccessOrExit(error);
+
+    if (aInterface.mSampled)
+    {
+        aInterface.mRates = ComputeRates(aInterface.mCounters, counters,
+                                         std::chrono::duration_cast<Milliseconds>(aNow - aInterface.mSampleTime));
+
+        aInterface.mRxBytes->Set(static_cast<int64_t>(aInterface.mRates.mRxBytes));
+        aInterface.mTxBytes->Set(static_cast<int64_t>(aInterface.mRates.mTxBytes));
+        aInterface.mRxPackets->Set(static_cast<int64_t>(aInterface.mRates.mRxPackets));
+        aInterface.mTxPackets->Set(static_cast<int64_t>(aInterface.mRates.mTxPackets));
+        aInterface.mDrops->Set(static_cast<int64_t>(aInterface.mRates.mDrops));
+    }
+
+    aInterface.mCounters   = counters;
+    aInterface.mSampleTime = aNow;
+    aInterface.mSampled    = true;
+
+exit:
+    return error;
+}
+
+otbrError NetifStatsSampler::Open(void)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    struct sockaddr_nl addr;
+
+    VerifyOrExit(mFd < 0);
+
+    mFd = SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE, kSocketBlock);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    VerifyOrExit(bind(mFd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Close();
+    }
+
+    return error;
+}
+
+void NetifStatsSampler::Close(void)
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+otbrError NetifStatsSampler::Request(uint32_t aIfIndex, Counters &aCounters)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    struct sockaddr_nl kernel;
+    struct
+    {
+        struct nlmsghdr     mHeader;
+        struct if_stats_msg mStats;
+    } request;
+
+    SuccessOrExit(error = Open());
+
+    memset(&kernel, 0, sizeof(kernel));
+    kernel.nl_family = AF_NETLINK;
+
+    memset(&request, 0, sizeof(request));
+    request.mHeader.nlmsg_len   = NLMSG_LENGTH(sizeof(request.mStats));
+    request.mHeader.nlmsg_type  = RTM_GETSTATS;
+    request.mHeader.nlmsg_flags = NLM_F_REQUEST;
+    request.mHeader.nlmsg_seq   = ++mSequence;
+    request.mStats.family       = AF_UNSPEC;
+    request.mStats.ifindex      = aIfIndex;
+    request.mStats.filter_mask  = IFLA_STATS_FILTER_BIT(IFLA_STATS_LINK_64);
+
+    VerifyOrExit(sendto(mFd, &request, request.mHeader.nlmsg_len, 0, reinterpret_cast<struct sockaddr *>(&kernel),
+                        sizeof(kernel)) == static_cast<ssize_t>(request.mHeader.nlmsg_len),
+                 error = OTBR_ERROR_ERRNO);
+
+    // Wait for the reply to this request, which carries either the statistics or an error.
+    error = OTBR_ERROR_NOT_FOUND;
+
+    do
+    {
+        union
+        {
+            struct nlmsghdr mHeader;
+            uint8_t         mBuffer[kMaxReplySize];
+        } reply;
+        ssize_t len = recv(mFd, &reply, sizeof(reply), 0);
+
+        if (len < 0)
+        {
+            VerifyOrExit(errno == EINTR, error = OTBR_ERROR_ERRNO);
+            continue;
+        }
+
+        error = ParseStatsReply(&reply, static_cast<size_t>(len), mSequence, aCounters);
+    } while (error == OTBR_ERROR_NOT_FOUND);
+
+exit:
+    return error;
+}
+
+otbrError NetifStatsSampler::ParseStatsReply(const void *aReply,
+                                             size_t      aLength,
+                                             uint32_t    aSequence,
+                                             Counters &  aCounters)
+{
+    otbrError              error  = OTBR_ERROR_NOT_FOUND;
+    const struct nlmsghdr *header = static_cast<const struct nlmsghdr *>(aReply);
+    int                    length = static_cast<int>(aLength);
+
+    for (; NLMSG_OK(header, length); header = NLMSG_NEXT(header, length))
+    {
+        const struct rtattr *attr;
+        int                  attrLength;
+
+        if (header->nlmsg_seq != aSequence)
+        {
+            continue;
+        }
+
+        if (header->nlmsg_type == NLMSG_ERROR)
+        {
+            int result;
+
+            VerifyOrExit(header->nlmsg_len >= NLMSG_LENGTH(sizeof(struct nlmsgerr)), errno = EBADMSG,
+                         error = OTBR_ERROR_ERRNO);
+            result = -static_cast<const struct nlmsgerr *>(NLMSG_DATA(header))->error;
+            VerifyOrExit(result == 0, errno = result, error = OTBR_ERROR_ERRNO);
+            continue;
+        }
+
+        if (header->nlmsg_type != RTM_NEWSTATS || header->nlmsg_len < NLMSG_SPACE(sizeof(struct if_stats_msg)))
+        {
+            continue;
+        }
+
+        attr       = reinterpret_cast<const struct rtattr *>(static_cast<const uint8_t *>(NLMSG_DATA(header)) +
+                                                       NLMSG_ALIGN(sizeof(struct if_stats_msg)));
+        attrLength = static_cast<int>(header->nlmsg_len - NLMSG_SPACE(sizeof(struct if_stats_msg)));
+
+        for (; RTA_OK(attr, attrLength); attr = RTA_NEXT(attr, attrLength))
+        {
+            struct rtnl_link_stats64 stats;
+            size_t                   payload = RTA_PAYLOAD(attr);
+
+            // Older kernels have fewer fields, only the leading ones up to the dropped packets are needed.
+            if (attr->rta_type != IFLA_STATS_LINK_64 ||
+                payload < offsetof(struct rtnl_link_stats64, tx_dropped) + sizeof(stats.tx_dropped))
+            {
+                continue;
+            }
+
+            memset(&stats, 0, sizeof(stats));
+            memcpy(&stats, RTA_DATA(attr), std::min(payload, sizeof(stats)));
+
+            aCounters.mRxBytes   = stats.rx_bytes;
+            aCounters.mTxBytes   = stats.tx_bytes;
+            aCounters.mRxPackets = stats.rx_packets;
+            aCounters.mTxPackets = stats.tx_packets;
+            aCounters.mDrops     = stats.rx_dropped + stats.tx_dropped;
+            ExitNow(error = OTBR_ERROR_NONE);
+        }
+    }
+
+exit:
+    return error;
+}
+
+NetifStatsSampler::Rates NetifStatsSampler::ComputeRates(const Counters &aPrevious,
+                                                         const Counters &aCurrent,
+                                                         Milliseconds    aElapsed)
+{
+    Rates rates;
+
+    VerifyOrExit(aElapsed.count() > 0);
+
+    rates.mRxBytes   = ComputeRate(aPrevious.mRxBytes, aCurrent.mRxBytes, aElapsed);
+    rates.mTxBytes   = ComputeRate(aPrevious.mTxBytes, aCurrent.mTxBytes, aElapsed);
+    rates.mRxPackets = ComputeRate(aPrevious.mRxPackets, aCurrent.mRxPackets, aElapsed);
+    rates.mTxPackets = ComputeRate(aPrevious.mTxPackets, aCurrent.mTxPackets, aElapsed);
+    rates.mDrops     = ComputeRate(aPrevious.mDrops, aCurrent.mDrops, aElapsed);
+
+exit:
+    return rates;
+}
+
+} // namespace otbr
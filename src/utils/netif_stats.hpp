@@ -0,0 +1,210 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for sampling the traffic statistics of network interfaces over rtnetlink.
+ */
+
+#ifndef OTBR_UTILS_NETIF_STATS_HPP_
+#define OTBR_UTILS_NETIF_STATS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "common/metrics_registry.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class samples the traffic statistics of network interfaces and reports their rates as metrics.
+ *
+ * The 64-bit statistics of each interface are requested with `RTM_GETSTATS`, which returns only the statistics
+ * rather than the whole link information, so a sample costs one small round trip to the kernel per interface.
+ *
+ */
+class NetifStatsSampler
+{
+public:
+    /**
+     * This enumeration represents the role of a sampled interface, which selects the names of its metrics.
+     *
+     */
+    enum class Role : uint8_t
+    {
+        kThread,   ///< The Thread network interface.
+        kBackbone, ///< The Backbone network interface.
+    };
+
+    /**
+     * This structure represents the cumulative statistics of an interface.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mRxBytes   = 0; ///< The number of bytes received.
+        uint64_t mTxBytes   = 0; ///< The number of bytes transmitted.
+        uint64_t mRxPackets = 0; ///< The number of packets received.
+        uint64_t mTxPackets = 0; ///< The number of packets transmitted.
+        uint64_t mDrops     = 0; ///< The number of packets dropped in both directions.
+    };
+
+    /**
+     * This structure represents the per-second rates of the statistics of an interface.
+     *
+     */
+    struct Rates
+    {
+        uint64_t mRxBytes   = 0; ///< The bytes received per second.
+        uint64_t mTxBytes   = 0; ///< The bytes transmitted per second.
+        uint64_t mRxPackets = 0; ///< The packets received per second.
+        uint64_t mTxPackets = 0; ///< The packets transmitted per second.
+        uint64_t mDrops     = 0; ///< The packets dropped per second.
+    };
+
+    /**
+     * This constructor initializes the sampler.
+     *
+     * @param[in]  aRegistry  The registry of the metrics.
+     *
+     */
+    explicit NetifStatsSampler(MetricsRegistry &aRegistry = MetricsRegistry::Get());
+
+    /**
+     * This destructor closes the rtnetlink socket, the metrics keep their last values.
+     *
+     */
+    ~NetifStatsSampler(void);
+
+    NetifStatsSampler(const NetifStatsSampler &) = delete;
+    NetifStatsSampler &operator=(const NetifStatsSampler &) = delete;
+
+    /**
+     * This method adds an interface to sample and registers its metrics.
+     *
+     * Each role may be added once. The interface doesn't have to exist yet, it is looked up by name until it does.
+     *
+     * @param[in]  aRole    The role of the interface.
+     * @param[in]  aIfName  The name of the interface.
+     *
+     */
+    void AddInterface(Role aRole, const char *aIfName);
+
+    /**
+     * This method samples the statistics of all interfaces and updates their metrics.
+     *
+     * The rates are averaged over the time since the previous sample, so the first sample of an interface only
+     * records its counters.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully sampled all the interfaces which exist.
+     * @retval OTBR_ERROR_ERRNO  Failed to sample an interface, error code in `errno`.
+     *
+     */
+    otbrError Sample(Timepoint aNow);
+
+    /**
+     * This method returns the latest rates of an interface.
+     *
+     * @param[in]  aRole  The role of the interface.
+     *
+     * @returns  The latest rates, all zero if the interface is not sampled.
+     *
+     */
+    Rates GetRates(Role aRole) const;
+
+    /**
+     * This function parses the reply of a `RTM_GETSTATS` request.
+     *
+     * @param[in]   aReply      The reply received from the kernel.
+     * @param[in]   aLength     The length of the reply in bytes.
+     * @param[in]   aSequence   The sequence number of the request.
+     * @param[out]  aCounters   The statistics of the interface.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully parsed the statistics.
+     * @retval OTBR_ERROR_NOT_FOUND  The reply has no statistics for the request.
+     * @retval OTBR_ERROR_ERRNO      The kernel reported an error, error code in `errno`.
+     *
+     */
+    static otbrError ParseStatsReply(const void *aReply, size_t aLength, uint32_t aSequence, Counters &aCounters);
+
+    /**
+     * This function computes the per-second rates between two samples.
+     *
+     * A counter which goes backwards, e.g. after the interface is recreated, has a rate of zero.
+     *
+     * @param[in]  aPrevious  The statistics of the previous sample.
+     * @param[in]  aCurrent   The statistics of the current sample.
+     * @param[in]  aElapsed   The time between both samples.
+     *
+     * @returns  The rates, all zero if no time has elapsed.
+     *
+     */
+    static Rates ComputeRates(const Counters &aPrevious, const Counters &aCurrent, Milliseconds aElapsed);
+
+private:
+    enum
+    {
+        kMaxReplySize = 1024, ///< Max size of a rtnetlink reply in bytes.
+    };
+
+    struct Interface
+    {
+        Role                    mRole;
+        std::string             mName;
+        uint32_t                mIndex   = 0; // 0 until the interface is found.
+        bool                    mSampled = false;
+        Counters                mCounters;
+        Timepoint               mSampleTime;
+        Rates                   mRates;
+        MetricsRegistry::Gauge *mRxBytes;
+        MetricsRegistry::Gauge *mTxBytes;
+        MetricsRegistry::Gauge *mRxPackets;
+        MetricsRegistry::Gauge *mTxPackets;
+        MetricsRegistry::Gauge *mDrops;
+    };
+
+    otbrError Open(void);
+    void      Close(void);
+    otbrError SampleInterface(Interface &aInterface, Timepoint aNow);
+    otbrError Request(uint32_t aIfIndex, Counters &aCounters);
+
+    MetricsRegistry &      mRegistry;
+    std::vector<Interface> mInterfaces;
+    int                    mFd;
+    uint32_t               mSequence;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_NETIF_STATS_HPP_
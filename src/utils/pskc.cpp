@@ -33,12 +33,120 @@
 
 #include "utils/pskc.hpp"
 
+#include <list>
+#include <mutex>
+#include <string>
+
+#include <mbedtls/sha256.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
+namespace {
+
+enum
+{
+    kPrfKeyLength         = 16, ///< The key length of AES-CMAC-PRF-128.
+    kPskcCacheSize        = 4,  ///< The max number of cached PSKc values.
+    kPassphraseHashLength = 32, ///< The length of the SHA-256 hash of a passphrase.
+};
+
+// The passphrase is only kept as a hash, and the entries are wiped when they are evicted.
+struct CachedPskc
+{
+    ~CachedPskc(void)
+    {
+        memset(mPassphraseHash, 0, sizeof(mPassphraseHash));
+        memset(mPskc, 0, sizeof(mPskc));
+    }
+
+    uint8_t     mExtPanId[OT_EXTENDED_PAN_ID_LENGTH];
+    std::string mNetworkName;
+    uint8_t     mPassphraseHash[kPassphraseHashLength];
+    uint8_t     mPskc[OT_PSKC_LENGTH];
+};
+
+// The cache is shared by all `Pskc` instances, the most recently used entry first.
+std::mutex            sPskcCacheMutex;
+std::list<CachedPskc> sPskcCache;
+
+void HashPassphrase(const char *aPassphrase, uint8_t *aHash)
+{
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init(&sha256);
+    mbedtls_sha256_starts(&sha256, 0);
+    mbedtls_sha256_update(&sha256, reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase));
+    mbedtls_sha256_finish(&sha256, aHash);
+    mbedtls_sha256_free(&sha256);
+}
+
+std::list<CachedPskc>::iterator FindCachedEntry(const uint8_t *aExtPanId,
+                                                const char *   aNetworkName,
+                                                const uint8_t *aPassphraseHash)
+{
+    auto cached = sPskcCache.begin();
+
+    for (; cached != sPskcCache.end(); ++cached)
+    {
+        if (memcmp(cached->mExtPanId, aExtPanId, sizeof(cached->mExtPanId)) == 0 &&
+            cached->mNetworkName == aNetworkName &&
+            memcmp(cached->mPassphraseHash, aPassphraseHash, sizeof(cached->mPassphraseHash)) == 0)
+        {
+            break;
+        }
+    }
+
+    return cached;
+}
+
+bool FindCachedPskc(const uint8_t *aExtPanId, const char *aNetworkName, const uint8_t *aPassphraseHash, uint8_t *aPskc)
+{
+    std::lock_guard<std::mutex> lock(sPskcCacheMutex);
+    auto                        cached = FindCachedEntry(aExtPanId, aNetworkName, aPassphraseHash);
+    bool                        found  = (cached != sPskcCache.end());
+
+    if (found)
+    {
+        sPskcCache.splice(sPskcCache.begin(), sPskcCache, cached);
+        memcpy(aPskc, sPskcCache.front().mPskc, OT_PSKC_LENGTH);
+    }
+
+    return found;
+}
+
+void CachePskc(const uint8_t *aExtPanId, const char *aNetworkName, const uint8_t *aPassphraseHash, const uint8_t *aPskc)
+{
+    std::lock_guard<std::mutex> lock(sPskcCacheMutex);
+    auto                        cached = FindCachedEntry(aExtPanId, aNetworkName, aPassphraseHash);
+
+    // Another thread may have derived the same PSKc meanwhile.
+    if (cached != sPskcCache.end())
+    {
+        sPskcCache.splice(sPskcCache.begin(), sPskcCache, cached);
+        ExitNow();
+    }
+
+    if (sPskcCache.size() >= kPskcCacheSize)
+    {
+        sPskcCache.pop_back();
+    }
+
+    sPskcCache.emplace_front();
+    memcpy(sPskcCache.front().mExtPanId, aExtPanId, sizeof(sPskcCache.front().mExtPanId));
+    sPskcCache.front().mNetworkName = aNetworkName;
+    memcpy(sPskcCache.front().mPassphraseHash, aPassphraseHash, sizeof(sPskcCache.front().mPassphraseHash));
+    memcpy(sPskcCache.front().mPskc, aPskc, sizeof(sPskcCache.front().mPskc));
+
+exit:
+    return;
+}
+
+} // namespace
+
 void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
 {
     const char *saltPrefix = "Thread";
@@ -66,18 +174,41 @@ exit:
     return;
 }
 
-const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+int Pskc::DerivePskc(const char *aPassphrase)
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    const mbedtls_cipher_info_t *cipherInfo = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB);
+    mbedtls_cipher_context_t     cipher;
+    const uint8_t                zeroKey[kPrfKeyLength] = {0};
+    uint8_t                      prfKey[kPrfKeyLength];
+    uint32_t                     blockCounter = 0;
+    uint16_t                     useLen       = 0;
+    uint16_t                     prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
+    uint8_t                      prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t                      prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint8_t                      keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint16_t                     keyLen = OT_PSKC_LENGTH;
+    uint8_t *                    pskc   = mPskc;
+    int                          ret;
+    size_t                       passphraseLength = strlen(aPassphrase);
 
-    SetSalt(aExtPanId, aNetworkName);
+    mbedtls_cipher_init(&cipher);
+
+    // AES-CMAC-PRF-128 (RFC 4615) uses the passphrase as the key if it is 128 bits long, and derives the key by
+    // AES-CMAC with a zero key otherwise. Deriving the key and setting up the key schedule once for all iterations
+    // saves up to half of the AES operations.
+    if (passphraseLength == kPrfKeyLength)
+    {
+        memcpy(prfKey, aPassphrase, kPrfKeyLength);
+    }
+    else
+    {
+        SuccessOrExit(ret = mbedtls_cipher_cmac(cipherInfo, zeroKey, kPrfKeyLength * 8,
+                                                reinterpret_cast<const uint8_t *>(aPassphrase), passphraseLength,
+                                                prfKey));
+    }
+
+    SuccessOrExit(ret = mbedtls_cipher_setup(&cipher, cipherInfo));
+    SuccessOrExit(ret = mbedtls_cipher_cmac_starts(&cipher, prfKey, kPrfKeyLength * 8));
 
     while (keyLen)
     {
@@ -89,17 +220,16 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
         prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
+        SuccessOrExit(ret = mbedtls_cipher_cmac_update(&cipher, prfInput, mSaltLen + 4));
+        SuccessOrExit(ret = mbedtls_cipher_cmac_finish(&cipher, prfOutput));
         memcpy(keyBlock, prfOutput, prfBlockLen);
 
         for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
         {
-            memcpy(prfInput, prfOutput, prfBlockLen);
-
             // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+            SuccessOrExit(ret = mbedtls_cipher_cmac_reset(&cipher));
+            SuccessOrExit(ret = mbedtls_cipher_cmac_update(&cipher, prfOutput, prfBlockLen));
+            SuccessOrExit(ret = mbedtls_cipher_cmac_finish(&cipher, prfOutput));
 
             // xor
             for (uint32_t j = 0; j < prfBlockLen; j++)
@@ -108,11 +238,43 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
             }
         }
 
+        SuccessOrExit(ret = mbedtls_cipher_cmac_reset(&cipher));
+
         useLen = (keyLen < prfBlockLen) ? keyLen : prfBlockLen;
         memcpy(pskc, keyBlock, useLen);
         pskc += useLen;
         keyLen -= useLen;
     }
+
+exit:
+    mbedtls_cipher_free(&cipher);
+    memset(prfKey, 0, sizeof(prfKey));
+    return ret;
+}
+
+const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+{
+    int     ret;
+    uint8_t passphraseHash[kPassphraseHashLength];
+
+    HashPassphrase(aPassphrase, passphraseHash);
+    VerifyOrExit(!FindCachedPskc(aExtPanId, aNetworkName, passphraseHash, mPskc));
+
+    SetSalt(aExtPanId, aNetworkName);
+
+    // The key derivation runs without holding the cache lock, so that instances on different threads derive
+    // concurrently.
+    if ((ret = DerivePskc(aPassphrase)) != 0)
+    {
+        otbrLogErr("Failed to compute PSKc: %d", ret);
+        memset(mPskc, 0, sizeof(mPskc));
+        ExitNow();
+    }
+
+    CachePskc(aExtPanId, aNetworkName, passphraseHash, mPskc);
+
+exit:
+    memset(passphraseHash, 0, sizeof(passphraseHash));
     return mPskc;
 }
 
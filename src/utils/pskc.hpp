@@ -62,6 +62,9 @@ public:
     /**
      * This method computes the PSKc.
      *
+     * The most recently computed PSKc values are cached, so computing the PSKc of the same network again returns
+     * without running the key derivation.
+     *
      * @param[in]  aExtPanId      a pointer to extended PAN ID.
      * @param[in]  aNetworkName   a pointer to network name.
      * @param[in]  aPassphrase    a pointer to passphrase.
@@ -73,6 +76,7 @@ public:
 
 private:
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
+    int  DerivePskc(const char *aPassphrase);
 
     char     mSalt[OT_PBKDF2_SALT_MAX_LENGTH];
     uint16_t mSaltLen;
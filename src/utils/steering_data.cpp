@@ -61,20 +61,47 @@ void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
 }
 
 void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
+{
+    ComputeBloomFilter(aJoinerId, 1);
+}
+
+void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aNumJoinerIds)
 {
     Crc16          ccitt(Crc16::kCcitt);
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
+    for (size_t i = 0; i < aNumJoinerIds; i++)
+    {
+        const uint8_t *joinerId = aJoinerIds + i * kSizeJoinerId;
+
+        ccitt.Init();
+        ansi.Init();
+        ccitt.Update(joinerId, kSizeJoinerId);
+        ansi.Update(joinerId, kSizeJoinerId);
+
+        SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
+        SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
+    }
+}
+
+uint8_t SteeringData::ComputeLength(size_t aNumJoinerIds)
+{
+    // With the two hash functions of the filter, 19 bits per joiner give a false positive probability of 1%.
+    const size_t kBitsPerJoiner = 19;
+    size_t       length;
+
+    if (aNumJoinerIds > kMaxSizeOfBloomFilter * 8 / kBitsPerJoiner)
+    {
+        length = kMaxSizeOfBloomFilter;
+    }
+    else
     {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
+        length = (aNumJoinerIds * kBitsPerJoiner + 7) / 8;
+        length = (length > 0) ? length : 1;
     }
 
-    SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
-    SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
+    return static_cast<uint8_t>(length);
 }
 
 } // namespace otbr
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -83,13 +84,37 @@ public:
     void SetBit(uint8_t aBit) { mBloomFilter[mLength - 1 - (aBit / 8)] |= 1 << (aBit % 8); }
 
     /**
-     * This method computes the Bloom Filter.
+     * This method adds a joiner to the Bloom Filter.
      *
      * @param[in]  aJoinerId  Extended address
      *
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method adds a list of joiners to the Bloom Filter.
+     *
+     * Joiners can still be added one by one afterwards, the filter only needs to be recomputed when joiners are
+     * removed.
+     *
+     * @param[in]  aJoinerIds     A pointer to an array of joiner IDs, each of `kSizeJoinerId` bytes.
+     * @param[in]  aNumJoinerIds  The number of joiner IDs in @p aJoinerIds.
+     *
+     */
+    void ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aNumJoinerIds);
+
+    /**
+     * This method computes the length of the bloom filter best suited for a number of joiners.
+     *
+     * The length keeps the false positive probability of the filter near 1%, up to the max length of the filter.
+     *
+     * @param[in]  aNumJoinerIds  The number of joiners.
+     *
+     * @returns The length of the bloom filter in bytes.
+     *
+     */
+    static uint8_t ComputeLength(size_t aNumJoinerIds);
+
     /**
      * This method computes joiner id from EUI64.
      *
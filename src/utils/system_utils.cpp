@@ -35,11 +35,22 @@
 
 #include "system_utils.hpp"
 
+#include <errno.h>
+#include <spawn.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
+#include <string>
+
+#include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/types.hpp"
+
+extern char **environ;
 
 namespace otbr {
 namespace SystemUtils {
@@ -73,5 +84,74 @@ int ExecuteCommand(const char *aFormat, ...)
     return exitCode;
 }
 
+static std::string JoinArguments(const char *const aArgv[])
+{
+    std::string command;
+
+    for (size_t i = 0; aArgv[i] != nullptr; i++)
+    {
+        if (i > 0)
+        {
+            command += ' ';
+        }
+
+        command += aArgv[i];
+    }
+
+    return command;
+}
+
+static otbrError Spawn(const char *const aArgv[], pid_t &aPid)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       rval;
+
+    // `posix_spawnp()` takes non-const arguments for historical reasons, but never modifies them.
+    rval = posix_spawnp(&aPid, aArgv[0], nullptr, nullptr, const_cast<char *const *>(aArgv), environ);
+    VerifyOrExit(rval == 0, errno = rval, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+static int WaitExitCode(pid_t aPid)
+{
+    int status;
+    int rval;
+
+    while ((rval = waitpid(aPid, &status, 0)) == -1 && errno == EINTR)
+    {
+    }
+
+    return (rval == aPid && WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+}
+
+static void LogExitCode(int aExitCode, const std::string &aCommand)
+{
+    if (aExitCode == 0)
+    {
+        otbrLogInfo("$?=%-3d: %s", aExitCode, aCommand.c_str());
+    }
+    else
+    {
+        otbrLogWarning("$?=%-3d: %s", aExitCode, aCommand.c_str());
+    }
+}
+
+int ExecuteCommand(const char *const aArgv[])
+{
+    std::string command = JoinArguments(aArgv);
+    pid_t       pid;
+    int         exitCode = -1;
+
+    VerifyOrExit(Spawn(aArgv, pid) == OTBR_ERROR_NONE,
+                 otbrLogWarning("Failed to spawn %s: %s", command.c_str(), strerror(errno)));
+    exitCode = WaitExitCode(pid);
+    LogExitCode(exitCode, command);
+
+exit:
+    return exitCode;
+}
+
 } // namespace SystemUtils
 } // namespace otbr
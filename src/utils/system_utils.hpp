@@ -56,6 +56,19 @@ int ExecuteCommand(const char *aFormat, ...);
 }
 #endif
 
+/**
+ * This function executes a program without a shell and waits for it to exit.
+ *
+ * The program is started with `posix_spawnp()`, which neither copies the address space of the agent like `fork()`
+ * nor runs `/bin/sh` like `system()`. The arguments are passed to the program as they are and need no quoting.
+ *
+ * @param[in] aArgv  A nullptr-terminated argument vector, `aArgv[0]` is the program which is searched in `PATH`.
+ *
+ * @returns The exit code of the program, or -1 if it fails to start or is terminated by a signal.
+ *
+ */
+int ExecuteCommand(const char *const aArgv[]);
+
 } // namespace SystemUtils
 } // namespace otbr
 
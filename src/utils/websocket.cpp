@@ -0,0 +1,289 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the WebSocket (RFC 6455) handshake and framing used by the web service.
+ */
+
+#include "utils/websocket.hpp"
+
+#include <string.h>
+
+#include <mbedtls/base64.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+namespace {
+
+const char kWebSocketGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+constexpr size_t  kSha1Length       = 20;
+constexpr size_t  kSha1BlockLength  = 64;
+constexpr uint8_t kFinBit           = 0x80;
+constexpr uint8_t kReservedBits     = 0x70;
+constexpr uint8_t kOpcodeMask       = 0x0f;
+constexpr uint8_t kMaskBit          = 0x80;
+constexpr uint8_t kPayloadLenMask   = 0x7f;
+constexpr uint8_t kPayloadLen16     = 126;
+constexpr uint8_t kPayloadLen64     = 127;
+constexpr size_t  kMaxControlLength = 125;
+
+uint32_t RotateLeft(uint32_t aValue, unsigned aBits)
+{
+    return (aValue << aBits) | (aValue >> (32 - aBits));
+}
+
+void Sha1ProcessBlock(const uint8_t *aBlock, uint32_t aState[5])
+{
+    uint32_t w[80];
+    uint32_t a = aState[0];
+    uint32_t b = aState[1];
+    uint32_t c = aState[2];
+    uint32_t d = aState[3];
+    uint32_t e = aState[4];
+
+    for (int i = 0; i < 16; i++)
+    {
+        w[i] = (static_cast<uint32_t>(aBlock[4 * i]) << 24) | (static_cast<uint32_t>(aBlock[4 * i + 1]) << 16) |
+               (static_cast<uint32_t>(aBlock[4 * i + 2]) << 8) | aBlock[4 * i + 3];
+    }
+
+    for (int i = 16; i < 80; i++)
+    {
+        w[i] = RotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+
+    for (int i = 0; i < 80; i++)
+    {
+        uint32_t f;
+        uint32_t k;
+        uint32_t temp;
+
+        if (i < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5a827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ed9eba1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8f1bbcdc;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xca62c1d6;
+        }
+
+        temp = RotateLeft(a, 5) + f + e + k + w[i];
+        e    = d;
+        d    = c;
+        c    = RotateLeft(b, 30);
+        b    = a;
+        a    = temp;
+    }
+
+    aState[0] += a;
+    aState[1] += b;
+    aState[2] += c;
+    aState[3] += d;
+    aState[4] += e;
+}
+
+/**
+ * This function computes the SHA-1 digest the handshake is defined with.
+ *
+ * SHA-1 is not enabled in the mbedtls configuration shared with OpenThread, and the handshake is its only user.
+ *
+ */
+void Sha1(const std::string &aInput, uint8_t aDigest[kSha1Length])
+{
+    uint32_t    state[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+    uint64_t    bitCount = static_cast<uint64_t>(aInput.size()) * 8;
+    std::string message  = aInput;
+
+    message.push_back(static_cast<char>(0x80));
+
+    while (message.size() % kSha1BlockLength != kSha1BlockLength - sizeof(bitCount))
+    {
+        message.push_back(0);
+    }
+
+    for (int i = 7; i >= 0; i--)
+    {
+        message.push_back(static_cast<char>(bitCount >> (8 * i)));
+    }
+
+    for (size_t offset = 0; offset < message.size(); offset += kSha1BlockLength)
+    {
+        Sha1ProcessBlock(reinterpret_cast<const uint8_t *>(message.data()) + offset, state);
+    }
+
+    for (int i = 0; i < 5; i++)
+    {
+        aDigest[4 * i]     = static_cast<uint8_t>(state[i] >> 24);
+        aDigest[4 * i + 1] = static_cast<uint8_t>(state[i] >> 16);
+        aDigest[4 * i + 2] = static_cast<uint8_t>(state[i] >> 8);
+        aDigest[4 * i + 3] = static_cast<uint8_t>(state[i]);
+    }
+}
+
+} // namespace
+
+std::string ComputeWebSocketAccept(const std::string &aKey)
+{
+    uint8_t       digest[kSha1Length];
+    unsigned char accept[(kSha1Length + 2) / 3 * 4 + 1];
+    size_t        length = 0;
+
+    Sha1(aKey + kWebSocketGuid, digest);
+    mbedtls_base64_encode(accept, sizeof(accept), &length, digest, sizeof(digest));
+
+    return std::string(reinterpret_cast<const char *>(accept), length);
+}
+
+void AppendWebSocketFrame(WebSocketOpcode aOpcode, const std::string &aPayload, std::string &aFrame)
+{
+    uint64_t length = aPayload.size();
+
+    aFrame.push_back(static_cast<char>(kFinBit | aOpcode));
+
+    if (length < kPayloadLen16)
+    {
+        aFrame.push_back(static_cast<char>(length));
+    }
+    else if (length <= UINT16_MAX)
+    {
+        aFrame.push_back(static_cast<char>(kPayloadLen16));
+        aFrame.push_back(static_cast<char>(length >> 8));
+        aFrame.push_back(static_cast<char>(length));
+    }
+    else
+    {
+        aFrame.push_back(static_cast<char>(kPayloadLen64));
+
+        for (int i = 7; i >= 0; i--)
+        {
+            aFrame.push_back(static_cast<char>(length >> (8 * i)));
+        }
+    }
+
+    aFrame.append(aPayload);
+}
+
+size_t GetWebSocketHeaderLength(const uint8_t *aHeader)
+{
+    size_t  length     = kWebSocketMinHeaderLength;
+    uint8_t payloadLen = aHeader[1] & kPayloadLenMask;
+
+    if (payloadLen == kPayloadLen16)
+    {
+        length += sizeof(uint16_t);
+    }
+    else if (payloadLen == kPayloadLen64)
+    {
+        length += sizeof(uint64_t);
+    }
+
+    if (aHeader[1] & kMaskBit)
+    {
+        length += sizeof(WebSocketFrameHeader::mMaskKey);
+    }
+
+    return length;
+}
+
+bool ParseWebSocketHeader(const uint8_t *aHeader, WebSocketFrameHeader &aFrame)
+{
+    const uint8_t *cursor     = aHeader + kWebSocketMinHeaderLength;
+    uint8_t        payloadLen = aHeader[1] & kPayloadLenMask;
+    bool           valid      = false;
+
+    aFrame.mFin           = (aHeader[0] & kFinBit) != 0;
+    aFrame.mOpcode        = aHeader[0] & kOpcodeMask;
+    aFrame.mMasked        = (aHeader[1] & kMaskBit) != 0;
+    aFrame.mPayloadLength = payloadLen;
+
+    if (payloadLen == kPayloadLen16 || payloadLen == kPayloadLen64)
+    {
+        size_t size = (payloadLen == kPayloadLen16) ? sizeof(uint16_t) : sizeof(uint64_t);
+
+        aFrame.mPayloadLength = 0;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            aFrame.mPayloadLength = (aFrame.mPayloadLength << 8) | *cursor++;
+        }
+    }
+
+    if (aFrame.mMasked)
+    {
+        memcpy(aFrame.mMaskKey, cursor, sizeof(aFrame.mMaskKey));
+    }
+
+    VerifyOrExit((aHeader[0] & kReservedBits) == 0);
+
+    // The most significant bit of a 64-bit length must be zero.
+    VerifyOrExit((aFrame.mPayloadLength >> 63) == 0);
+
+    // Control frames must not be fragmented and are limited to 125 bytes.
+    if (aFrame.mOpcode & 0x8)
+    {
+        VerifyOrExit(aFrame.mFin && aFrame.mPayloadLength <= kMaxControlLength);
+    }
+
+    valid = true;
+
+exit:
+    return valid;
+}
+
+void UnmaskWebSocketPayload(const WebSocketFrameHeader &aFrame, std::string &aPayload)
+{
+    if (aFrame.mMasked)
+    {
+        for (size_t i = 0; i < aPayload.size(); i++)
+        {
+            aPayload[i] = static_cast<char>(aPayload[i] ^ aFrame.mMaskKey[i % sizeof(aFrame.mMaskKey)]);
+        }
+    }
+}
+
+} // namespace Utils
+
+} // namespace otbr
@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file provides the WebSocket (RFC 6455) handshake and framing used by the web service.
+ */
+
+#ifndef OTBR_UTILS_WEBSOCKET_HPP_
+#define OTBR_UTILS_WEBSOCKET_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * WebSocket frame opcodes.
+ *
+ */
+enum WebSocketOpcode : uint8_t
+{
+    kWebSocketContinuation = 0x0,
+    kWebSocketText         = 0x1,
+    kWebSocketBinary       = 0x2,
+    kWebSocketClose        = 0x8,
+    kWebSocketPing         = 0x9,
+    kWebSocketPong         = 0xa,
+};
+
+/**
+ * This structure represents the header of a WebSocket frame.
+ *
+ */
+struct WebSocketFrameHeader
+{
+    bool     mFin;           ///< Whether this is the final fragment of a message.
+    uint8_t  mOpcode;        ///< The opcode, see `WebSocketOpcode`.
+    bool     mMasked;        ///< Whether the payload is masked, which is required for frames sent by clients.
+    uint8_t  mMaskKey[4];    ///< The masking key, only valid if `mMasked`.
+    uint64_t mPayloadLength; ///< The length of the payload.
+};
+
+enum
+{
+    kWebSocketMinHeaderLength = 2,  ///< The length of the fixed part of a frame header.
+    kWebSocketMaxHeaderLength = 14, ///< The length of the longest frame header.
+};
+
+/**
+ * This function computes the `Sec-WebSocket-Accept` value answering a `Sec-WebSocket-Key`.
+ *
+ * @param[in]  aKey  The value of the `Sec-WebSocket-Key` header sent by the client.
+ *
+ * @returns The value of the `Sec-WebSocket-Accept` header.
+ *
+ */
+std::string ComputeWebSocketAccept(const std::string &aKey);
+
+/**
+ * This function appends an unfragmented and unmasked frame, as sent by servers.
+ *
+ * @param[in]     aOpcode   The opcode of the frame.
+ * @param[in]     aPayload  The payload of the frame.
+ * @param[inout]  aFrame    The string the frame is appended to.
+ *
+ */
+void AppendWebSocketFrame(WebSocketOpcode aOpcode, const std::string &aPayload, std::string &aFrame);
+
+/**
+ * This function returns the length of a frame header from its first two bytes.
+ *
+ * @param[in]  aHeader  A pointer to the first `kWebSocketMinHeaderLength` bytes of the header.
+ *
+ * @returns The length of the whole header, including the extended payload length and the masking key.
+ *
+ */
+size_t GetWebSocketHeaderLength(const uint8_t *aHeader);
+
+/**
+ * This function parses a frame header.
+ *
+ * @param[in]   aHeader   A pointer to the whole header, of the length returned by `GetWebSocketHeaderLength()`.
+ * @param[out]  aFrame    The parsed header.
+ *
+ * @retval true   Successfully parsed the header.
+ * @retval false  The header is malformed, e.g. reserved bits are set or a control frame is fragmented.
+ *
+ */
+bool ParseWebSocketHeader(const uint8_t *aHeader, WebSocketFrameHeader &aFrame);
+
+/**
+ * This function unmasks the payload of a masked frame in place.
+ *
+ * @param[in]     aFrame    The header of the frame.
+ * @param[inout]  aPayload  The payload of the frame.
+ *
+ */
+void UnmaskWebSocketPayload(const WebSocketFrameHeader &aFrame, std::string &aPayload);
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_WEBSOCKET_HPP_
@@ -69,17 +69,39 @@ static void PrintVersion(void)
     printf("%s\n", OTBR_PACKAGE_VERSION);
 }
 
+static bool ParseUnsigned(const char *aArg, unsigned long aMin, unsigned long aMax, unsigned long &aValue)
+{
+    bool          ok = false;
+    char *        end;
+    unsigned long value;
+
+    // `strtoul()` silently negates a number with a leading minus sign.
+    VerifyOrExit(aArg[0] >= '0' && aArg[0] <= '9');
+
+    errno = 0;
+    value = strtoul(aArg, &end, 10);
+
+    VerifyOrExit(*end == '\0' && errno == 0 && value >= aMin && value <= aMax);
+    aValue = value;
+    ok     = true;
+
+exit:
+    return ok;
+}
+
 int main(int argc, char **argv)
 {
-    const char * interfaceName  = nullptr;
-    const char * httpListenAddr = nullptr;
-    const char * httpPort       = nullptr;
-    otbrLogLevel logLevel       = OTBR_LOG_INFO;
-    int          ret            = 0;
-    int          opt;
-    uint16_t     port = OT_HTTP_PORT;
-
-    while ((opt = getopt(argc, argv, "d:I:p:va:")) != -1)
+    const char *               interfaceName  = nullptr;
+    const char *               httpListenAddr = nullptr;
+    const char *               httpPort       = nullptr;
+    otbrLogLevel               logLevel       = OTBR_LOG_INFO;
+    int                        ret            = 0;
+    int                        opt;
+    uint16_t                   port = OT_HTTP_PORT;
+    unsigned long              value;
+    otbr::Web::WebServerConfig config;
+
+    while ((opt = getopt(argc, argv, "d:I:p:va:t:T:b:")) != -1)
     {
         switch (opt)
         {
@@ -99,13 +121,33 @@ int main(int argc, char **argv)
             port = atoi(httpPort);
             break;
 
+        case 't':
+            VerifyOrExit(ParseUnsigned(optarg, 1, UINT16_MAX, value), ret = -1;
+                         fprintf(stderr, "Invalid number of threads: %s\n", optarg));
+            config.mThreadPoolSize = static_cast<uint16_t>(value);
+            break;
+
+        case 'T':
+            VerifyOrExit(ParseUnsigned(optarg, 1, UINT16_MAX, value), ret = -1;
+                         fprintf(stderr, "Invalid content timeout: %s\n", optarg));
+            config.mContentTimeout = static_cast<uint16_t>(value);
+            break;
+
+        case 'b':
+            VerifyOrExit(ParseUnsigned(optarg, 0, SIZE_MAX, value), ret = -1;
+                         fprintf(stderr, "Invalid max request body size: %s\n", optarg));
+            config.mMaxRequestBodySize = value;
+            break;
+
         case 'v':
             PrintVersion();
             ExitNow();
             break;
 
         default:
-            fprintf(stderr, "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-v]\n",
+            fprintf(stderr,
+                    "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-t threads] "
+                    "[-T contentTimeoutSeconds] [-b maxRequestBodyBytes] [-v]\n",
                     argv[0]);
             ExitNow(ret = -1);
             break;
@@ -139,7 +181,7 @@ int main(int argc, char **argv)
     signal(SIGINT, HandleSignal);
 
     sServer.reset(new otbr::Web::WebServer());
-    sServer->StartWebServer(interfaceName, httpListenAddr, port);
+    sServer->StartWebServer(interfaceName, httpListenAddr, port, config);
 
     otbrLogDeinit();
 
@@ -130,30 +130,37 @@
             $scope.menu[index].show = true;
             if (index == 1) {
                 $scope.isLoading = true;
-                $http.get('/available_network').then(function(response) {
+                // The scan runs in the background, poll until it or a later scan is done.
+                $http.post('/available_network').then(function(response) {
+                    var scanId = response.data.id;
+                    var poll = $interval(function() {
+                        $http.get('/available_network').then(function(response) {
+                            if (response.data.id < scanId || response.data.state != 'done') {
+                                return;
+                            }
+                            $interval.cancel(poll);
+                            $scope.isLoading = false;
+                            if (response.data.error == 0) {
+                                $scope.networksInfo = response.data.result;
+                            } else {
+                                $scope.showScanAlert(event);
+                            }
+                        }, function() {
+                            // Stop polling if the web service is gone.
+                            $interval.cancel(poll);
+                            $scope.isLoading = false;
+                            $scope.showScanAlert(event);
+                        });
+                    }, 500);
+                }, function() {
                     $scope.isLoading = false;
-                    if (response.data.error == 0) {
-                        $scope.networksInfo = response.data.result;
-                    } else {
-                        $scope.showScanAlert(event);
-                    }
+                    $scope.showScanAlert(event);
                 });
             }
             if (index == 3) {
-                $http.get('/get_properties').then(function(response) {
-                    console.log(response);
-                    if (response.data.error == 0) {
-                        var statusJson = response.data.result;
-                        $scope.status = [];
-                        for (var i = 0; i < Object.keys(statusJson).length; i++) {
-                            $scope.status.push({
-                                name: Object.keys(statusJson)[i],
-                                value: statusJson[Object.keys(statusJson)[i]],
-                                icon: 'res/img/icon-info.png',
-                            });
-                        }
-                    }
-                });
+                $scope.subscribeStatus();
+            } else {
+                $scope.unsubscribeStatus();
             }
             if (index == 6) {
                 $scope.dataInit();
@@ -161,6 +168,75 @@
             }
         };
 
+        var statusSocket = null;
+        var statusValues = {};
+
+        $scope.showStatus = function() {
+            $scope.status = [];
+            for (var i = 0; i < Object.keys(statusValues).length; i++) {
+                $scope.status.push({
+                    name: Object.keys(statusValues)[i],
+                    value: statusValues[Object.keys(statusValues)[i]],
+                    icon: 'res/img/icon-info.png',
+                });
+            }
+        };
+
+        $scope.getStatus = function() {
+            $http.get('/get_properties').then(function(response) {
+                if (response.data.error == 0) {
+                    statusValues = response.data.result;
+                    $scope.showStatus();
+                }
+            });
+        };
+
+        // The server pushes the whole status once, then only the properties which changed. Browsers without
+        // WebSocket support get a single snapshot.
+        $scope.subscribeStatus = function() {
+            if (statusSocket != null) {
+                return;
+            }
+            if (!window.WebSocket) {
+                $scope.getStatus();
+                return;
+            }
+            var scheme = window.location.protocol == 'https:' ? 'wss://' : 'ws://';
+            statusSocket = new WebSocket(scheme + window.location.host + '/ws/status');
+            statusSocket.onmessage = function(event) {
+                var message = JSON.parse(event.data);
+                $scope.$apply(function() {
+                    if (message.error != 0) {
+                        return;
+                    }
+                    if (message.type == 'status') {
+                        statusValues = message.result;
+                    } else if (message.type == 'delta') {
+                        angular.extend(statusValues, message.changed);
+                        for (var i = 0; i < message.removed.length; i++) {
+                            delete statusValues[message.removed[i]];
+                        }
+                    }
+                    $scope.showStatus();
+                });
+            };
+            statusSocket.onerror = function() {
+                $scope.$apply($scope.getStatus);
+            };
+            statusSocket.onclose = function() {
+                statusSocket = null;
+            };
+        };
+
+        $scope.unsubscribeStatus = function() {
+            if (statusSocket != null) {
+                statusSocket.onclose = null;
+                statusSocket.onerror = null;
+                statusSocket.close();
+                statusSocket = null;
+            }
+        };
+
         $scope.showJoinDialog = function(ev, index, item) {
             sharedProperties.setIndex(index);
             sharedProperties.setNetworkInfo(item);
@@ -34,6 +34,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -45,6 +46,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "utils/strcpy_utils.hpp"
 
 // Temporary solution before posix platform header files are cleaned up.
@@ -87,7 +89,10 @@ bool OpenThreadClient::Connect(void)
     struct sockaddr_un sockname;
     int                ret;
 
-    mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    // The connection is kept across commands and only established again after a failure.
+    VerifyOrExit(mSocket == -1, ret = 0);
+
+    mSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
     VerifyOrExit(mSocket != -1, perror("socket"); ret = EXIT_FAILURE);
 
     memset(&sockname, 0, sizeof(struct sockaddr_un));
@@ -107,92 +112,269 @@ bool OpenThreadClient::Connect(void)
     }
 
 exit:
+    if (ret != 0)
+    {
+        Disconnect();
+    }
+
     return ret == 0;
 }
 
-char *OpenThreadClient::Execute(const char *aFormat, ...)
+bool OpenThreadClient::FormatCommand(std::string &aCommand, const char *aFormat, va_list aArgs)
 {
     va_list args;
-    int     ret;
-    char *  rval = nullptr;
-    ssize_t count;
-    size_t  rxLength = 0;
+    int     length;
 
-    va_start(args, aFormat);
-    ret = vsnprintf(&mBuffer[1], sizeof(mBuffer) - 1, aFormat, args);
+    va_copy(args, aArgs);
+    length = vsnprintf(nullptr, 0, aFormat, args);
     va_end(args);
 
-    if (ret < 0)
+    VerifyOrExit(length >= 0, otbrLogErr("Failed to generate command: %s", strerror(errno)));
+
+    // The command is surrounded by new lines, so that any partial input left in the daemon is discarded.
+    aCommand.resize(static_cast<size_t>(length) + sizeof("\n\n"));
+    aCommand[0] = '\n';
+    vsnprintf(&aCommand[1], static_cast<size_t>(length) + 1, aFormat, aArgs);
+    aCommand[length + 1] = '\n';
+    aCommand.resize(static_cast<size_t>(length) + 2);
+
+exit:
+    return length >= 0;
+}
+
+bool OpenThreadClient::SendAll(const std::string &aData)
+{
+    size_t sent = 0;
+
+    while (sent < aData.size())
     {
-        otbrLogErr("Failed to generate command: %s", strerror(errno));
+        // A closed connection fails with `EPIPE` rather than raising `SIGPIPE`.
+        ssize_t count = send(mSocket, &aData[sent], aData.size() - sent, MSG_NOSIGNAL);
+
+        if (count == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        VerifyOrExit(count > 0);
+        sent += static_cast<size_t>(count);
     }
 
-    mBuffer[0] = '\n';
-    ret++;
+exit:
+    return sent == aData.size();
+}
+
+bool OpenThreadClient::Send(const std::string &aData)
+{
+    bool sent = Connect() && SendAll(aData);
 
-    if (ret == sizeof(mBuffer))
+    // The daemon may have restarted since the last command, so connect again once.
+    if (!sent)
     {
-        otbrLogErr("Command exceeds maximum limit: %d", kBufferSize);
+        Disconnect();
+        sent = Connect() && SendAll(aData);
     }
 
-    mBuffer[ret] = '\n';
-    ret++;
+    if (!sent)
+    {
+        otbrLogErr("Failed to send command: %s", strerror(errno));
+        Disconnect();
+    }
 
-    count = write(mSocket, mBuffer, ret);
+    return sent;
+}
+
+static const char *SkipPrompts(const char *aLine)
+{
+    static const char kCliPrompt[] = "> ";
 
-    if (count < ret)
+    while (strncmp(aLine, kCliPrompt, sizeof(kCliPrompt) - 1) == 0)
     {
-        mBuffer[ret] = '\0';
-        otbrLogErr("Failed to send command: %s", mBuffer);
+        aLine += sizeof(kCliPrompt) - 1;
     }
 
-    for (int i = 0; i < mTimeout; ++i)
+    return aLine;
+}
+
+bool OpenThreadClient::ParseOutput(size_t &aLineStart, size_t aLength, bool &aSucceeded, size_t &aOutputLength)
+{
+    bool completed = false;
+
+    // Only complete lines are parsed, a partial line is parsed again once the rest has arrived.
+    while (!completed)
     {
-        fd_set  readFdSet;
-        timeval timeout = {0, 1000};
-        char *  done;
+        char *      lineEnd;
+        const char *line;
+        size_t      lineLength;
+
+        VerifyOrExit(aLineStart < aLength);
+        lineEnd = static_cast<char *>(memchr(&mBuffer[aLineStart], '\n', aLength - aLineStart));
+        VerifyOrExit(lineEnd != nullptr);
+        line       = SkipPrompts(&mBuffer[aLineStart]);
+        lineLength = static_cast<size_t>(lineEnd - line);
+
+        if (lineLength > 0 && line[lineLength - 1] == '\r')
+        {
+            --lineLength;
+        }
+
+        if (lineLength == sizeof("Done") - 1 && strncmp(line, "Done", lineLength) == 0)
+        {
+            // Drop the line break before "Done" as well.
+            aOutputLength = aLineStart;
+
+            if (aOutputLength > 0 && mBuffer[aOutputLength - 1] == '\n')
+            {
+                --aOutputLength;
+            }
+
+            if (aOutputLength > 0 && mBuffer[aOutputLength - 1] == '\r')
+            {
+                --aOutputLength;
+            }
+
+            mBuffer[aOutputLength] = '\0';
+            aSucceeded             = true;
+            completed              = true;
+        }
+        else if (strncmp(line, "Error ", sizeof("Error ") - 1) == 0)
+        {
+            *lineEnd = '\0';
+            otbrLogWarning("Command failed: %s", line);
+            aOutputLength = 0;
+            aSucceeded    = false;
+            completed     = true;
+        }
 
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+        aLineStart = static_cast<size_t>(lineEnd - &mBuffer[0]) + 1;
+    }
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
+exit:
+    return completed;
+}
+
+bool OpenThreadClient::ReadResponse(size_t &aRxLength, bool &aSucceeded, size_t &aOutputLength, size_t &aNext)
+{
+    Timepoint deadline  = Clock::now() + Milliseconds(mTimeout);
+    size_t    lineStart = 0;
+    bool      completed = false;
+
+    // The bytes received with a previous response may already complete this one.
+    while (!ParseOutput(lineStart, aRxLength, aSucceeded, aOutputLength))
+    {
+        Milliseconds remaining = std::chrono::duration_cast<Milliseconds>(deadline - Clock::now());
+        pollfd       pollFd    = {mSocket, POLLIN, 0};
+        ssize_t      count;
+        int          ret;
+
+        VerifyOrExit(remaining.count() > 0, otbrLogWarning("Timed out waiting for the command to complete"));
+
+        ret = poll(&pollFd, 1, static_cast<int>(remaining.count()));
         VerifyOrExit(ret != -1 || errno == EINTR);
+
         if (ret <= 0)
         {
             continue;
         }
 
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
+        if (mBuffer.size() < aRxLength + kReadSize + 1)
+        {
+            VerifyOrExit(aRxLength < kMaxOutputSize,
+                         otbrLogErr("Command output exceeds maximum limit: %d", kMaxOutputSize));
+            mBuffer.resize(aRxLength + kReadSize + 1);
+        }
+
+        count = read(mSocket, &mBuffer[aRxLength], mBuffer.size() - aRxLength - 1);
         VerifyOrExit(count > 0);
-        rxLength += count;
+        aRxLength += static_cast<size_t>(count);
+        mBuffer[aRxLength] = '\0';
+    }
 
-        mBuffer[rxLength] = '\0';
-        done              = strstr(mBuffer, "Done\r\n");
+    aNext     = lineStart;
+    completed = true;
 
-        if (done != nullptr)
-        {
-            // remove trailing \r\n
-            if (done - mBuffer > 2)
-            {
-                done[-2] = '\0';
-            }
+exit:
+    if (!completed)
+    {
+        // A late response would be taken for the one of the next command, so start over with a new connection.
+        Disconnect();
+    }
 
-            rval = mBuffer;
-            break;
-        }
+    return completed;
+}
+
+char *OpenThreadClient::Execute(const char *aFormat, ...)
+{
+    va_list     args;
+    bool        formatted;
+    std::string command;
+    char *      rval      = nullptr;
+    size_t      rxLength  = 0;
+    bool        succeeded = false;
+    size_t      outputLength;
+    size_t      next;
+
+    va_start(args, aFormat);
+    formatted = FormatCommand(command, aFormat, args);
+    va_end(args);
+
+    VerifyOrExit(formatted && Send(command));
+    VerifyOrExit(ReadResponse(rxLength, succeeded, outputLength, next));
+
+    if (succeeded)
+    {
+        rval = &mBuffer[0];
+    }
+
+exit:
+    return rval;
+}
+
+bool OpenThreadClient::ExecuteBatch(const std::vector<std::string> &aCommands, std::vector<std::string> &aOutputs)
+{
+    std::string commands = "\n";
+    size_t      rxLength = 0;
+    bool        rval     = false;
+
+    aOutputs.clear();
+
+    for (const std::string &command : aCommands)
+    {
+        commands += command;
+        commands += '\n';
+    }
+
+    // All commands are sent at once and the daemon responds to them in order, each response ends with "Done" or
+    // an error.
+    VerifyOrExit(Send(commands));
+    rval = true;
+
+    for (size_t i = 0; i < aCommands.size(); i++)
+    {
+        bool   succeeded;
+        size_t outputLength;
+        size_t next;
+
+        VerifyOrExit(ReadResponse(rxLength, succeeded, outputLength, next), rval = false);
+        aOutputs.emplace_back(succeeded ? std::string(&mBuffer[0], outputLength) : std::string());
+        rval = rval && succeeded;
+
+        // Keep the bytes of the following responses.
+        rxLength -= next;
+        memmove(&mBuffer[0], &mBuffer[next], rxLength);
     }
 
 exit:
     return rval;
 }
 
-int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
+int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength, uint8_t aChannel)
 {
     char *result;
     int   rval = 0;
 
     mTimeout = 5000;
-    result   = Execute("scan");
+    result   = (aChannel == 0) ? Execute("scan") : Execute("scan %u", static_cast<unsigned>(aChannel));
     VerifyOrExit(result != nullptr);
 
     for (result = strtok(result, "\r\n"); result != nullptr && rval < aLength; result = strtok(nullptr, "\r\n"))
@@ -236,9 +418,9 @@ int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
         ++rval;
     }
 
+exit:
     mTimeout = kDefaultTimeout;
 
-exit:
     return rval;
 }
 
@@ -36,8 +36,13 @@
 
 #include "openthread-br/config.h"
 
+#include <stdarg.h>
+#include <stddef.h>
 #include <stdint.h>
 
+#include <string>
+#include <vector>
+
 namespace otbr {
 namespace Web {
 
@@ -84,6 +89,9 @@ public:
     /**
      * This method connects to OpenThread daemon.
      *
+     * The connection is kept and reused by all commands. It is established again by the next command if it fails,
+     * e.g. when the daemon restarts. This method does nothing if already connected.
+     *
      * @retval  true    Successfully connected to the daemon.
      * @retval  false   Failed to connected to the daemon.
      *
@@ -93,6 +101,9 @@ public:
     /**
      * This method executes OpenThread CLI.
      *
+     * This method returns as soon as the command prints "Done" or an error, or when the timeout expires. The output
+     * is kept in a buffer which grows as needed and is valid until the next call.
+     *
      * @param[in]   aFormat     C style format string.
      * @param[in]   ...         C style format arguments.
      *
@@ -101,16 +112,32 @@ public:
      */
     char *Execute(const char *aFormat, ...);
 
+    /**
+     * This method executes several OpenThread CLI commands in one round trip.
+     *
+     * The commands are sent back to back without waiting for each other, and their outputs are collected in order.
+     * Commands which reset or restart the daemon must not be batched.
+     *
+     * @param[in]   aCommands   The commands to execute.
+     * @param[out]  aOutputs    The outputs of the commands which completed, an empty string for a failed command.
+     *
+     * @retval  true    All commands succeeded.
+     * @retval  false   Any command failed or did not complete in time.
+     *
+     */
+    bool ExecuteBatch(const std::vector<std::string> &aCommands, std::vector<std::string> &aOutputs);
+
     /**
      * This method scans Thread network.
      *
      * @param[out]  aNetworks   A pointer to the buffer to store network information.
      * @param[in]   aLength     Number of entries in @p aNetworks.
+     * @param[in]   aChannel    The channel to scan, 0 to scan all channels.
      *
      * @returns Number of entries found. 0 if none found.
      *
      */
-    int Scan(WpanNetworkInfo *aNetworks, int aLength);
+    int Scan(WpanNetworkInfo *aNetworks, int aLength, uint8_t aChannel = 0);
 
     /**
      * This method performs factory reset.
@@ -120,17 +147,23 @@ public:
 
 private:
     void Disconnect(void);
+    bool FormatCommand(std::string &aCommand, const char *aFormat, va_list aArgs);
+    bool SendAll(const std::string &aData);
+    bool Send(const std::string &aData);
+    bool ParseOutput(size_t &aLineStart, size_t aLength, bool &aSucceeded, size_t &aOutputLength);
+    bool ReadResponse(size_t &aRxLength, bool &aSucceeded, size_t &aOutputLength, size_t &aNext);
 
     enum
     {
-        kBufferSize     = 1024, ///< Maximum command line input and output buffer.
-        kDefaultTimeout = 800,  ///< Default timeout(ms) waiting for a command finish.
+        kReadSize       = 1024,      ///< Number of bytes read from the daemon at once.
+        kMaxOutputSize  = 64 * 1024, ///< Maximum output of a command.
+        kDefaultTimeout = 800,       ///< Default timeout(ms) waiting for a command finish.
     };
 
-    const char *mNetifName;
-    char        mBuffer[kBufferSize];
-    int         mTimeout; /// Timeout in milliseconds
-    int         mSocket;
+    const char *      mNetifName;
+    std::vector<char> mBuffer;
+    int               mTimeout; /// Timeout in milliseconds
+    int               mSocket;
 };
 
 } // namespace Web
@@ -0,0 +1,472 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the WebSocket channel pushing the network status to the web frontend.
+ */
+
+#define OTBR_LOG_TAG "WEB"
+
+#include "web/web-service/status_publisher.hpp"
+
+#include <algorithm>
+#include <deque>
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/write.hpp>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "utils/websocket.hpp"
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class represents a WebSocket connection subscribed to the status.
+ *
+ * All operations on the connection run on its strand, so the polling thread only ever posts frames to it.
+ *
+ */
+class StatusPublisher::Subscriber : public std::enable_shared_from_this<StatusPublisher::Subscriber>
+{
+public:
+    Subscriber(boost::asio::io_service &aIoService, const std::shared_ptr<Socket> &aSocket)
+        : mStrand(aIoService)
+        , mSocket(aSocket)
+        , mPendingBytes(0)
+        , mClosing(false)
+        , mClosed(false)
+    {
+    }
+
+    void Start(std::string aHandshake)
+    {
+        auto self = shared_from_this();
+
+        mStrand.post([self, aHandshake]() {
+            self->Send(aHandshake);
+            self->ReadHeader();
+        });
+    }
+
+    void Post(std::string aFrame)
+    {
+        auto self = shared_from_this();
+
+        mStrand.post([self, aFrame]() { self->Send(aFrame); });
+    }
+
+private:
+    enum
+    {
+        kMaxPayloadLength = 4096,       ///< The max payload length of a frame from the browser.
+        kMaxPendingBytes  = 256 * 1024, ///< The max length of unsent frames before a slow reader is dropped.
+    };
+
+    void Send(const std::string &aData)
+    {
+        VerifyOrExit(!mClosed && !mClosing);
+
+        if (mPendingBytes + aData.size() > kMaxPendingBytes)
+        {
+            otbrLogWarning("Dropping a status subscriber which doesn't keep up");
+            Close();
+            ExitNow();
+        }
+
+        mPendingBytes += aData.size();
+        mQueue.push_back(aData);
+
+        if (mQueue.size() == 1)
+        {
+            Write();
+        }
+
+    exit:
+        return;
+    }
+
+    void Write(void)
+    {
+        auto self = shared_from_this();
+
+        boost::asio::async_write(*mSocket, boost::asio::buffer(mQueue.front()),
+                                 mStrand.wrap([self](const boost::system::error_code &aError, size_t) {
+                                     self->mPendingBytes -= self->mQueue.front().size();
+                                     self->mQueue.pop_front();
+
+                                     if (aError)
+                                     {
+                                         self->Close();
+                                     }
+                                     else if (!self->mQueue.empty())
+                                     {
+                                         self->Write();
+                                     }
+                                     else if (self->mClosing)
+                                     {
+                                         self->Close();
+                                     }
+                                 }));
+    }
+
+    void ReadHeader(void)
+    {
+        auto self = shared_from_this();
+
+        boost::asio::async_read(
+            *mSocket, boost::asio::buffer(mHeader, Utils::kWebSocketMinHeaderLength),
+            mStrand.wrap([self](const boost::system::error_code &aError, size_t) {
+                size_t length;
+
+                VerifyOrExit(!aError, self->Close());
+                length = Utils::GetWebSocketHeaderLength(self->mHeader);
+
+                boost::asio::async_read(
+                    *self->mSocket,
+                    boost::asio::buffer(self->mHeader + Utils::kWebSocketMinHeaderLength,
+                                        length - Utils::kWebSocketMinHeaderLength),
+                    self->mStrand.wrap([self](const boost::system::error_code &aError, size_t) {
+                        VerifyOrExit(!aError, self->Close());
+                        VerifyOrExit(Utils::ParseWebSocketHeader(self->mHeader, self->mFrame), self->Close());
+
+                        // Frames from the browser must be masked.
+                        VerifyOrExit(self->mFrame.mMasked, self->Close());
+                        VerifyOrExit(self->mFrame.mPayloadLength <= kMaxPayloadLength, self->Close());
+                        self->ReadPayload();
+
+                    exit:
+                        return;
+                    }));
+
+            exit:
+                return;
+            }));
+    }
+
+    void ReadPayload(void)
+    {
+        auto self = shared_from_this();
+
+        mPayload.resize(static_cast<size_t>(mFrame.mPayloadLength));
+        boost::asio::async_read(*mSocket, boost::asio::buffer(&mPayload[0], mPayload.size()),
+                                mStrand.wrap([self](const boost::system::error_code &aError, size_t) {
+                                    VerifyOrExit(!aError, self->Close());
+                                    Utils::UnmaskWebSocketPayload(self->mFrame, self->mPayload);
+                                    self->HandleFrame();
+
+                                exit:
+                                    return;
+                                }));
+    }
+
+    void HandleFrame(void)
+    {
+        std::string frame;
+
+        switch (mFrame.mOpcode)
+        {
+        case Utils::kWebSocketClose:
+            // Echo the status code, then close once the frames queued before are sent.
+            Utils::AppendWebSocketFrame(Utils::kWebSocketClose, mPayload.substr(0, 2), frame);
+            Send(frame);
+            mClosing = true;
+            ExitNow();
+
+        case Utils::kWebSocketPing:
+            Utils::AppendWebSocketFrame(Utils::kWebSocketPong, mPayload, frame);
+            Send(frame);
+            break;
+
+        default:
+            // The channel only goes one way, other frames are ignored.
+            break;
+        }
+
+        ReadHeader();
+
+    exit:
+        if (mClosing && mQueue.empty())
+        {
+            Close();
+        }
+    }
+
+    void Close(void)
+    {
+        boost::system::error_code error;
+
+        VerifyOrExit(!mClosed);
+        mClosed = true;
+        mSocket->shutdown(Socket::shutdown_both, error);
+        mSocket->close(error);
+
+    exit:
+        return;
+    }
+
+    boost::asio::io_service::strand mStrand;
+    std::shared_ptr<Socket>         mSocket;
+    std::deque<std::string>         mQueue; ///< The frames being sent, the front one is being written.
+    size_t                          mPendingBytes;
+    bool                            mClosing; ///< Whether to close the connection once the queue is sent.
+    bool                            mClosed;
+    uint8_t                         mHeader[Utils::kWebSocketMaxHeaderLength];
+    Utils::WebSocketFrameHeader     mFrame;
+    std::string                     mPayload;
+};
+
+StatusPublisher::StatusPublisher(WpanService &aWpanService)
+    : mWpanService(aWpanService)
+    , mRefreshPending(false)
+    , mRunning(false)
+{
+}
+
+StatusPublisher::~StatusPublisher(void)
+{
+    Stop();
+}
+
+void StatusPublisher::Start(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    VerifyOrExit(!mRunning);
+    mRunning = true;
+    mThread  = std::thread(&StatusPublisher::Run, this);
+
+exit:
+    return;
+}
+
+void StatusPublisher::Stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mRunning = false;
+    }
+
+    mCondition.notify_all();
+
+    if (mThread.joinable())
+    {
+        mThread.join();
+    }
+}
+
+void StatusPublisher::Subscribe(boost::asio::io_service &      aIoService,
+                                const std::shared_ptr<Socket> &aSocket,
+                                const std::string &            aKey)
+{
+    auto        subscriber = std::make_shared<Subscriber>(aIoService, aSocket);
+    std::string handshake  = "HTTP/1.1 101 Switching Protocols\r\n"
+                            "Upgrade: websocket\r\n"
+                            "Connection: Upgrade\r\n"
+                            "Sec-WebSocket-Accept: " +
+                            Utils::ComputeWebSocketAccept(aKey) + "\r\n\r\n";
+
+    subscriber->Start(handshake);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mSubscriptions.push_back({subscriber, false});
+        mRefreshPending = true;
+    }
+
+    mCondition.notify_all();
+    otbrLogInfo("Status subscriber connected");
+}
+
+void StatusPublisher::Refresh(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mRefreshPending = true;
+    }
+
+    mCondition.notify_all();
+}
+
+void StatusPublisher::Run(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (mRunning)
+    {
+        std::string status;
+
+        mSubscriptions.erase(std::remove_if(mSubscriptions.begin(), mSubscriptions.end(),
+                                            [](const Subscription &aSubscription) {
+                                                return aSubscription.mSubscriber.expired();
+                                            }),
+                             mSubscriptions.end());
+
+        if (mSubscriptions.empty())
+        {
+            // Nobody listens, so the daemon isn't queried at all until the next subscriber.
+            mCondition.wait(lock, [this]() { return !mRunning || mRefreshPending; });
+        }
+        else
+        {
+            mCondition.wait_for(lock, Milliseconds(kPublishInterval),
+                                [this]() { return !mRunning || mRefreshPending; });
+        }
+
+        if (!mRunning)
+        {
+            break;
+        }
+
+        mRefreshPending = false;
+
+        if (mSubscriptions.empty())
+        {
+            continue;
+        }
+
+        // The status is shared with the http requests through the cache of `WpanService`.
+        lock.unlock();
+        status = mWpanService.HandleStatusRequest();
+        lock.lock();
+
+        Publish(status);
+    }
+}
+
+void StatusPublisher::Publish(const std::string &aStatus)
+{
+    Json::Reader reader;
+    Json::Value  status;
+    std::string  statusFrame;
+    std::string  deltaFrame;
+    std::string  delta;
+
+    VerifyOrExit(reader.parse(aStatus, status) && status.isObject());
+
+    delta = WriteDelta(mStatus, status);
+
+    if (!delta.empty())
+    {
+        Utils::AppendWebSocketFrame(Utils::kWebSocketText, delta, deltaFrame);
+    }
+
+    for (Subscription &subscription : mSubscriptions)
+    {
+        std::shared_ptr<Subscriber> subscriber = subscription.mSubscriber.lock();
+
+        if (subscriber == nullptr)
+        {
+            continue;
+        }
+
+        if (!subscription.mSynced)
+        {
+            if (statusFrame.empty())
+            {
+                Utils::AppendWebSocketFrame(Utils::kWebSocketText, WriteStatus(status), statusFrame);
+            }
+
+            subscriber->Post(statusFrame);
+            subscription.mSynced = true;
+        }
+        else if (!deltaFrame.empty())
+        {
+            subscriber->Post(deltaFrame);
+        }
+    }
+
+    mStatus = std::move(status);
+
+exit:
+    return;
+}
+
+std::string StatusPublisher::WriteStatus(const Json::Value &aStatus)
+{
+    Json::FastWriter jsonWriter;
+    Json::Value      message;
+
+    message["type"]   = "status";
+    message["error"]  = aStatus["error"];
+    message["result"] = aStatus["result"];
+
+    return jsonWriter.write(message);
+}
+
+std::string StatusPublisher::WriteDelta(const Json::Value &aPrevious, const Json::Value &aStatus)
+{
+    Json::FastWriter   jsonWriter;
+    Json::Value        message;
+    Json::Value        changed(Json::objectValue);
+    Json::Value        removed(Json::arrayValue);
+    const Json::Value &previous = aPrevious["result"];
+    const Json::Value &current  = aStatus["result"];
+
+    // A failed query has no properties to compare, resend the whole status.
+    if (!previous.isObject() || !current.isObject() || aPrevious["error"] != aStatus["error"])
+    {
+        return WriteStatus(aStatus);
+    }
+
+    for (const std::string &name : current.getMemberNames())
+    {
+        if (!previous.isMember(name) || previous[name] != current[name])
+        {
+            changed[name] = current[name];
+        }
+    }
+
+    for (const std::string &name : previous.getMemberNames())
+    {
+        if (!current.isMember(name))
+        {
+            removed.append(name);
+        }
+    }
+
+    if (!changed.empty() || !removed.empty())
+    {
+        message["type"]    = "delta";
+        message["error"]   = aStatus["error"];
+        message["changed"] = changed;
+        message["removed"] = removed;
+    }
+
+    return message.isNull() ? std::string() : jsonWriter.write(message);
+}
+
+} // namespace Web
+} // namespace otbr
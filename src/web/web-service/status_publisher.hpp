@@ -0,0 +1,147 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the WebSocket channel pushing the network status to the web frontend.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_STATUS_PUBLISHER_
+#define OTBR_WEB_WEB_SERVICE_STATUS_PUBLISHER_
+
+#include "openthread-br/config.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <json/json.h>
+
+#include "web/web-service/wpan_service.hpp"
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class pushes the network status to WebSocket subscribers.
+ *
+ * A single thread polls the status snapshot cached by `WpanService` while there are subscribers, whatever their
+ * number. Each subscriber first receives the whole status, then only the properties which changed:
+ *
+ *     {"type": "status", "error": 0, "result": {"RCP:State": "leader", ...}}
+ *     {"type": "delta", "error": 0, "changed": {"RCP:Channel": "15"}, "removed": ["IPv6:GlobalAddress"]}
+ *
+ */
+class StatusPublisher
+{
+public:
+    typedef boost::asio::ip::tcp::socket Socket;
+
+    /**
+     * This constructor creates a status publisher.
+     *
+     * @param[in]  aWpanService  The WPAN service providing the status.
+     *
+     */
+    explicit StatusPublisher(WpanService &aWpanService);
+
+    /**
+     * This destructor stops the status publisher.
+     *
+     */
+    ~StatusPublisher(void);
+
+    /**
+     * This method starts the thread polling the status.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method stops the thread polling the status.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method completes the WebSocket handshake of a connection and subscribes it to the status.
+     *
+     * @param[in]  aIoService  The io service running the connection.
+     * @param[in]  aSocket     The connection, which has sent a valid WebSocket upgrade request.
+     * @param[in]  aKey        The value of the `Sec-WebSocket-Key` header of the upgrade request.
+     *
+     */
+    void Subscribe(boost::asio::io_service &      aIoService,
+                   const std::shared_ptr<Socket> &aSocket,
+                   const std::string &            aKey);
+
+    /**
+     * This method publishes the status right away, e.g. after a request changed the network.
+     *
+     */
+    void Refresh(void);
+
+private:
+    class Subscriber;
+
+    struct Subscription
+    {
+        std::weak_ptr<Subscriber> mSubscriber;
+        bool                      mSynced; ///< Whether the subscriber has received the whole status.
+    };
+
+    enum
+    {
+        kPublishInterval = 2000, ///< The interval(ms) of polling the status while there are subscribers.
+    };
+
+    void               Run(void);
+    void               Publish(const std::string &aStatus);
+    static std::string WriteStatus(const Json::Value &aStatus);
+    static std::string WriteDelta(const Json::Value &aPrevious, const Json::Value &aStatus);
+
+    WpanService &             mWpanService;
+    std::mutex                mMutex; ///< Protects the members below.
+    std::condition_variable   mCondition;
+    std::vector<Subscription> mSubscriptions;
+    Json::Value               mStatus; ///< The status last published.
+    bool                      mRefreshPending;
+    bool                      mRunning;
+    std::thread               mThread;
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_WEB_WEB_SERVICE_STATUS_PUBLISHER_
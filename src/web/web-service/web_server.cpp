@@ -35,6 +35,13 @@
 
 #include "web/web-service/web_server.hpp"
 
+#include <functional>
+#include <iterator>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #define BOOST_NO_CXX11_SCOPED_ENUMS
 #include <boost/filesystem.hpp>
 #undef BOOST_NO_CXX11_SCOPED_ENUMS
@@ -52,15 +59,17 @@
 #define OT_JOIN_NETWORK_PATH "^/join_network$"
 #define OT_SET_NETWORK_PATH "^/settings$"
 #define OT_COMMISSIONER_START_PATH "^/commission$"
+#define OT_STATUS_PUSH_PATH "/ws/status"
 #define OT_REQUEST_METHOD_GET "GET"
 #define OT_REQUEST_METHOD_POST "POST"
 #define OT_RESPONSE_SUCCESS_STATUS "HTTP/1.1 200 OK\r\n"
+#define OT_RESPONSE_NOT_MODIFIED_STATUS "HTTP/1.1 304 Not Modified\r\n"
 #define OT_RESPONSE_HEADER_LENGTH "Content-Length: "
-#define OT_RESPONSE_HEADER_CSS_TYPE "\r\nContent-Type: text/css"
 #define OT_RESPONSE_HEADER_TYPE "Content-Type: application/json\r\n charset=utf-8"
 #define OT_RESPONSE_PLACEHOLD "\r\n\r\n"
 #define OT_RESPONSE_FAILURE_STATUS "HTTP/1.1 400 Bad Request\r\n"
-#define OT_BUFFER_SIZE 1024
+#define OT_RESPONSE_TOO_LARGE_STATUS "HTTP/1.1 413 Payload Too Large\r\n"
+#define OT_CACHE_CONTROL_REVALIDATE "no-cache"
 
 namespace otbr {
 namespace Web {
@@ -98,8 +107,99 @@ static void EscapeHtml(std::string &content)
     output.swap(content);
 }
 
+static bool ReadFile(const boost::filesystem::path &aPath, std::string &aContent)
+{
+    std::ifstream ifs(aPath.string(), std::ifstream::in | std::ios::binary);
+
+    aContent.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+    return !ifs.bad();
+}
+
+static std::string MakeETag(const std::string &aContent)
+{
+    // 64-bit FNV-1a, the ETag only has to change with the content.
+    uint64_t hash = 14695981039346656037ULL;
+    char     etag[sizeof("\"0123456789abcdef-0123456789abcdef\"")];
+
+    for (unsigned char c : aContent)
+    {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+
+    snprintf(etag, sizeof(etag), "\"%016llx-%zx\"", static_cast<unsigned long long>(hash), aContent.size());
+
+    return etag;
+}
+
+static const char *GetContentType(const std::string &aExtension)
+{
+    static const std::map<std::string, const char *> kContentTypes = {
+        {".css", "text/css"},
+        {".html", "text/html; charset=utf-8"},
+        {".ico", "image/x-icon"},
+        {".js", "application/javascript"},
+        {".json", "application/json"},
+        {".png", "image/png"},
+        {".svg", "image/svg+xml"},
+    };
+
+    auto it = kContentTypes.find(aExtension);
+
+    return it != kContentTypes.end() ? it->second : "application/octet-stream";
+}
+
+/**
+ * This function calls @p aHandler with each trimmed element of a comma separated header value.
+ *
+ */
+template <typename Handler> static bool FindHeaderElement(const std::string &aValue, Handler aHandler)
+{
+    bool   found = false;
+    size_t start = 0;
+
+    while (!found && start < aValue.size())
+    {
+        size_t end   = std::min(aValue.find(',', start), aValue.size());
+        size_t first = aValue.find_first_not_of(" \t", start);
+        size_t last  = aValue.find_last_not_of(" \t", end - 1);
+
+        if (first < end && last != std::string::npos && last >= first)
+        {
+            found = aHandler(aValue.substr(first, last - first + 1));
+        }
+
+        start = end + 1;
+    }
+
+    return found;
+}
+
+static bool IsEncodingAccepted(const std::string &aAcceptEncoding, const std::string &aEncoding)
+{
+    return FindHeaderElement(aAcceptEncoding, [&aEncoding](const std::string &aElement) {
+        size_t      params = aElement.find(';');
+        std::string coding = aElement.substr(0, aElement.find_last_not_of(" \t", params - 1) + 1);
+        size_t      q      = aElement.find("q=", params);
+
+        return (coding == aEncoding || coding == "*") &&
+               (params == std::string::npos || q == std::string::npos || strtod(aElement.c_str() + q + 2, nullptr) > 0);
+    });
+}
+
+static bool MatchesETag(const std::string &aIfNoneMatch, const std::string &aETag)
+{
+    // If-None-Match uses the weak comparison.
+    return FindHeaderElement(aIfNoneMatch, [&aETag](const std::string &aElement) {
+        return aElement == "*" || aElement == aETag ||
+               (aElement.compare(0, 2, "W/") == 0 && aElement.compare(2, std::string::npos, aETag) == 0);
+    });
+}
+
 WebServer::WebServer(void)
     : mServer(new HttpServer())
+    , mStatusPublisher(mWpanService)
+    , mMaxRequestBodySize(0)
 {
 }
 
@@ -118,15 +218,23 @@ void WebServer::Init()
     }
 }
 
-void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort)
+void WebServer::StartWebServer(const char *           aIfName,
+                               const char *           aListenAddr,
+                               uint16_t               aPort,
+                               const WebServerConfig &aConfig)
 {
     if (aListenAddr != nullptr)
     {
         mServer->config.address = aListenAddr;
     }
-    mServer->config.port = aPort;
+    mServer->config.port             = aPort;
+    mServer->config.thread_pool_size = aConfig.mThreadPoolSize;
+    mServer->config.timeout_request  = aConfig.mRequestTimeout;
+    mServer->config.timeout_content  = aConfig.mContentTimeout;
+    mMaxRequestBodySize              = aConfig.mMaxRequestBodySize;
     mWpanService.SetInterfaceName(aIfName);
     Init();
+    LoadStaticResources();
     ResponseJoinNetwork();
     ResponseFormNetwork();
     ResponseAddOnMeshPrefix();
@@ -134,8 +242,13 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
     ResponseGetStatus();
     ResponseGetAvailableNetwork();
     ResponseCommission();
+    ResponseStatusPush();
     DefaultHttpResponse();
 
+    mLongRunningWork.reset(new boost::asio::io_service::work(mLongRunningService));
+    mLongRunningThread = std::thread([this]() { mLongRunningService.run(); });
+    mStatusPublisher.Start();
+
     try
     {
         mServer->start();
@@ -144,6 +257,11 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
         otbrLogCrit("failed to start web server: %s", e.what());
         abort();
     }
+
+    mStatusPublisher.Stop();
+    mLongRunningWork.reset();
+    mLongRunningService.stop();
+    mLongRunningThread.join();
 }
 
 void WebServer::StopWebServer(void)
@@ -157,54 +275,128 @@ void WebServer::StopWebServer(void)
     }
 }
 
-void WebServer::HandleHttpRequest(const char *aUrl, const char *aMethod, HttpRequestCallback aCallback)
+void WebServer::HandleHttpRequest(const char *        aUrl,
+                                  const char *        aMethod,
+                                  HttpRequestCallback aCallback,
+                                  bool                aLongRunning)
 {
-    mServer->resource[aUrl][aMethod] = [aCallback, this](std::shared_ptr<HttpServer::Response> response,
-                                                         std::shared_ptr<HttpServer::Request>  request) {
+    bool changesNetwork = (strcmp(aMethod, OT_REQUEST_METHOD_POST) == 0);
+
+    auto handler = [aCallback, changesNetwork, this](std::ostream &aResponse, const std::string &aRequest) {
         try
         {
             std::string httpResponse;
             if (aCallback != nullptr)
             {
-                httpResponse = aCallback(request->content.string(), this);
+                httpResponse = aCallback(aRequest, this);
             }
 
-            *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << httpResponse.length()
+            // Subscribers learn about the change without waiting for the next poll.
+            if (changesNetwork)
+            {
+                mStatusPublisher.Refresh();
+            }
+
+            aResponse << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << httpResponse.length()
                       << OT_RESPONSE_PLACEHOLD << httpResponse;
         } catch (std::exception &e)
         {
             std::string content = e.what();
             EscapeHtml(content);
-            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << strlen(e.what())
+            aResponse << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
                       << OT_RESPONSE_PLACEHOLD << content;
         }
     };
+
+    mServer->resource[aUrl][aMethod] = [handler, aLongRunning, this](std::shared_ptr<HttpServer::Response> response,
+                                                                     std::shared_ptr<HttpServer::Request>  request) {
+        if (request->content.size() > mMaxRequestBodySize)
+        {
+            std::string content = "request body is too large";
+
+            *response << OT_RESPONSE_TOO_LARGE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
+                      << OT_RESPONSE_PLACEHOLD << content;
+        }
+        else if (aLongRunning)
+        {
+            // Keep the server threads free for other requests, e.g. status queries during a commission request.
+            mLongRunningService.post([handler, request, response, this]() mutable {
+                handler(*response, request->content.string());
+
+                // The response is sent when its last reference is released, which must happen on a server thread.
+                mServer->io_service->post(
+                    std::bind([](const std::shared_ptr<HttpServer::Response> &) {}, std::move(response)));
+            });
+        }
+        else
+        {
+            handler(*response, request->content.string());
+        }
+    };
 }
 
-void DefaultResourceSend(const HttpServer &                           aServer,
-                         const std::shared_ptr<HttpServer::Response> &aResponse,
-                         const std::shared_ptr<std::ifstream> &       aIfStream)
+void WebServer::LoadStaticResources(void)
 {
-    static std::vector<char> buffer(OT_BUFFER_SIZE); // Safe when server is running on one thread
-
-    std::streamsize readLength;
+    static const char *const kEncodingExtensions[kEncodingCount] = {"", ".gz", ".br"};
 
-    if ((readLength = aIfStream->read(&buffer[0], buffer.size()).gcount()) > 0)
+    try
     {
-        aResponse->write(&buffer[0], readLength);
-        if (readLength == static_cast<std::streamsize>(buffer.size()))
+        auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
+
+        for (boost::filesystem::recursive_directory_iterator it(webRootPath), end; it != end; ++it)
         {
-            aServer.send(aResponse, [&aServer, aResponse, aIfStream](const boost::system::error_code &ec) {
-                if (!ec)
+            const boost::filesystem::path &path      = it->path();
+            std::string                    extension = path.extension().string();
+            std::string                    url       = path.string().substr(webRootPath.string().size());
+            StaticResource                 resource;
+
+            if (!boost::filesystem::is_regular_file(path) || extension == ".gz" || extension == ".br")
+            {
+                continue;
+            }
+
+            if (!ReadFile(path, resource.mContent[kEncodingIdentity]))
+            {
+                otbrLogWarning("Failed to read %s", path.c_str());
+                continue;
+            }
+
+            for (int encoding = kEncodingGzip; encoding < kEncodingCount; ++encoding)
+            {
+                boost::filesystem::path encodedPath = path.string() + kEncodingExtensions[encoding];
+                std::string &           content     = resource.mContent[encoding];
+
+                // A precompressed variant is only worth serving if it is smaller.
+                if (!boost::filesystem::is_regular_file(encodedPath) || !ReadFile(encodedPath, content) ||
+                    content.size() >= resource.mContent[kEncodingIdentity].size())
                 {
-                    DefaultResourceSend(aServer, aResponse, aIfStream);
+                    content.clear();
                 }
-                else
+            }
+
+            for (int encoding = kEncodingIdentity; encoding < kEncodingCount; ++encoding)
+            {
+                if (!resource.mContent[encoding].empty() || encoding == kEncodingIdentity)
                 {
-                    std::cerr << "Connection interrupted" << std::endl;
+                    resource.mETag[encoding] = MakeETag(resource.mContent[encoding]);
                 }
-            });
+            }
+
+            resource.mContentType  = GetContentType(extension);
+            resource.mCacheControl = OT_CACHE_CONTROL_REVALIDATE;
+
+            if (path.filename() == "index.html")
+            {
+                mStaticResources[url.substr(0, url.size() - strlen("index.html"))] = resource;
+            }
+
+            mStaticResources[url] = std::move(resource);
         }
+
+        otbrLogInfo("Loaded %zu frontend resources from %s", mStaticResources.size(), webRootPath.c_str());
+    } catch (const std::exception &e)
+    {
+        otbrLogWarning("Failed to load frontend resources: %s", e.what());
     }
 }
 
@@ -212,57 +404,86 @@ void WebServer::DefaultHttpResponse(void)
 {
     mServer->default_resource[OT_REQUEST_METHOD_GET] = [this](std::shared_ptr<HttpServer::Response> response,
                                                               std::shared_ptr<HttpServer::Request>  request) {
-        try
-        {
-            auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
-            auto path        = boost::filesystem::canonical(webRootPath / request->path);
-            // Check if path is within webRootPath
-            if (std::distance(webRootPath.begin(), webRootPath.end()) > std::distance(path.begin(), path.end()) ||
-                !std::equal(webRootPath.begin(), webRootPath.end(), path.begin()))
-            {
-                throw std::invalid_argument("path must be within root path");
-            }
-            if (boost::filesystem::is_directory(path))
-            {
-                path /= "index.html";
-            }
-            if (!(boost::filesystem::exists(path) && boost::filesystem::is_regular_file(path)))
-            {
-                throw std::invalid_argument("file does not exist");
-            }
+        static const char *const kEncodingNames[kEncodingCount] = {"identity", "gzip", "br"};
+
+        std::string url = request->path.substr(0, request->path.find('?'));
+        auto        it  = mStaticResources.find(url);
 
-            std::string cacheControl, etag;
+        if (it == mStaticResources.end())
+        {
+            std::string content = "Could not open path `" + request->path + "`: file does not exist";
+            EscapeHtml(content);
+            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
+                      << OT_RESPONSE_PLACEHOLD << content;
+        }
+        else
+        {
+            const StaticResource &resource       = it->second;
+            int                   encoding       = kEncodingIdentity;
+            auto                  acceptEncoding = request->header.find("Accept-Encoding");
+            auto                  ifNoneMatch    = request->header.find("If-None-Match");
 
-            auto ifs = std::make_shared<std::ifstream>();
-            ifs->open(path.string(), std::ifstream::in | std::ios::binary | std::ios::ate);
-            std::string extension = boost::filesystem::extension(path.string());
-            std::string style     = "";
-            if (extension == ".css")
+            // Prefer brotli, which compresses the frontend better than gzip.
+            for (int candidate = kEncodingBrotli; candidate > kEncodingIdentity; --candidate)
             {
-                style = OT_RESPONSE_HEADER_CSS_TYPE;
+                if (acceptEncoding != request->header.end() && !resource.mContent[candidate].empty() &&
+                    IsEncodingAccepted(acceptEncoding->second, kEncodingNames[candidate]))
+                {
+                    encoding = candidate;
+                    break;
+                }
             }
 
-            if (*ifs)
+            if (ifNoneMatch != request->header.end() && MatchesETag(ifNoneMatch->second, resource.mETag[encoding]))
             {
-                auto length = ifs->tellg();
-                ifs->seekg(0, std::ios::beg);
-
-                *response << OT_RESPONSE_SUCCESS_STATUS << cacheControl << etag << OT_RESPONSE_HEADER_LENGTH << length
-                          << style << OT_RESPONSE_PLACEHOLD;
-
-                DefaultResourceSend(*mServer, response, ifs);
+                *response << OT_RESPONSE_NOT_MODIFIED_STATUS << "ETag: " << resource.mETag[encoding]
+                          << "\r\nCache-Control: " << resource.mCacheControl << "\r\nVary: Accept-Encoding"
+                          << OT_RESPONSE_PLACEHOLD;
             }
             else
             {
-                throw std::invalid_argument("could not read file");
+                const std::string &content = resource.mContent[encoding];
+
+                *response << OT_RESPONSE_SUCCESS_STATUS << "ETag: " << resource.mETag[encoding]
+                          << "\r\nCache-Control: " << resource.mCacheControl << "\r\nVary: Accept-Encoding"
+                          << "\r\nContent-Type: " << resource.mContentType << "\r\n";
+                if (encoding != kEncodingIdentity)
+                {
+                    *response << "Content-Encoding: " << kEncodingNames[encoding] << "\r\n";
+                }
+                *response << OT_RESPONSE_HEADER_LENGTH << content.size() << OT_RESPONSE_PLACEHOLD;
+                response->write(content.data(), static_cast<std::streamsize>(content.size()));
             }
+        }
+    };
+}
 
-        } catch (const std::exception &e)
+void WebServer::ResponseStatusPush(void)
+{
+    mServer->on_upgrade = [this](std::shared_ptr<SimpleWeb::HTTP>      aSocket,
+                                 std::shared_ptr<HttpServer::Request> aRequest) {
+        auto upgrade = aRequest->header.find("Upgrade");
+        auto key     = aRequest->header.find("Sec-WebSocket-Key");
+        auto version = aRequest->header.find("Sec-WebSocket-Version");
+
+        if (aRequest->method == OT_REQUEST_METHOD_GET &&
+            aRequest->path.substr(0, aRequest->path.find('?')) == OT_STATUS_PUSH_PATH &&
+            upgrade != aRequest->header.end() && strcasecmp(upgrade->second.c_str(), "websocket") == 0 &&
+            key != aRequest->header.end() && version != aRequest->header.end() && version->second == "13")
         {
-            std::string content = "Could not open path `" + request->path + "`: " + e.what();
-            EscapeHtml(content);
-            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
-                      << OT_RESPONSE_PLACEHOLD << content;
+            mStatusPublisher.Subscribe(*mServer->io_service, aSocket, key->second);
+        }
+        else
+        {
+            auto response = std::make_shared<std::string>(OT_RESPONSE_FAILURE_STATUS "Connection: close\r\n"
+                                                          "Content-Length: 0\r\n\r\n");
+
+            boost::asio::async_write(*aSocket, boost::asio::buffer(*response),
+                                     [aSocket, response](const boost::system::error_code &, size_t) {
+                                         boost::system::error_code error;
+
+                                         aSocket->shutdown(SimpleWeb::HTTP::shutdown_both, error);
+                                     });
         }
     };
 }
@@ -310,6 +531,13 @@ std::string WebServer::HandleGetAvailableNetworkResponse(const std::string &aGet
     return webServer->HandleGetAvailableNetworkResponse(aGetAvailableNetworkRequest);
 }
 
+std::string WebServer::HandleStartScanRequest(const std::string &aStartScanRequest, void *aUserData)
+{
+    WebServer *webServer = static_cast<WebServer *>(aUserData);
+
+    return webServer->HandleStartScanRequest(aStartScanRequest);
+}
+
 std::string WebServer::HandleCommission(const std::string &aCommissionRequest, void *aUserData)
 {
     WebServer *webServer = static_cast<WebServer *>(aUserData);
@@ -319,12 +547,12 @@ std::string WebServer::HandleCommission(const std::string &aCommissionRequest, v
 
 void WebServer::ResponseJoinNetwork(void)
 {
-    HandleHttpRequest(OT_JOIN_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleJoinNetworkRequest);
+    HandleHttpRequest(OT_JOIN_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleJoinNetworkRequest, true);
 }
 
 void WebServer::ResponseFormNetwork(void)
 {
-    HandleHttpRequest(OT_FORM_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleFormNetworkRequest);
+    HandleHttpRequest(OT_FORM_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleFormNetworkRequest, true);
 }
 
 void WebServer::ResponseAddOnMeshPrefix(void)
@@ -345,11 +573,12 @@ void WebServer::ResponseGetStatus(void)
 void WebServer::ResponseGetAvailableNetwork(void)
 {
     HandleHttpRequest(OT_AVAILABLE_NETWORK_PATH, OT_REQUEST_METHOD_GET, HandleGetAvailableNetworkResponse);
+    HandleHttpRequest(OT_AVAILABLE_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleStartScanRequest);
 }
 
 void WebServer::ResponseCommission(void)
 {
-    HandleHttpRequest(OT_COMMISSIONER_START_PATH, OT_REQUEST_METHOD_POST, HandleCommission);
+    HandleHttpRequest(OT_COMMISSIONER_START_PATH, OT_REQUEST_METHOD_POST, HandleCommission, true);
 }
 
 std::string WebServer::HandleJoinNetworkRequest(const std::string &aJoinRequest)
@@ -384,6 +613,12 @@ std::string WebServer::HandleGetAvailableNetworkResponse(const std::string &aGet
     return mWpanService.HandleAvailableNetworkRequest();
 }
 
+std::string WebServer::HandleStartScanRequest(const std::string &aStartScanRequest)
+{
+    OTBR_UNUSED_VARIABLE(aStartScanRequest);
+    return mWpanService.HandleStartScanRequest();
+}
+
 std::string WebServer::HandleCommission(const std::string &aCommissionRequest)
 {
     return mWpanService.HandleCommission(aCommissionRequest);
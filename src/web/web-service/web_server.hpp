@@ -39,14 +39,19 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <net/if.h>
 #include <syslog.h>
 
+#include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include "web/web-service/status_publisher.hpp"
 #include "web/web-service/wpan_service.hpp"
 
 namespace SimpleWeb {
@@ -59,6 +64,30 @@ namespace Web {
 
 typedef SimpleWeb::Server<SimpleWeb::HTTP> HttpServer;
 
+/**
+ * This structure represents the configuration of the http server.
+ *
+ */
+struct WebServerConfig
+{
+    /**
+     * This constructor initializes the default configuration.
+     *
+     */
+    WebServerConfig(void)
+        : mThreadPoolSize(1)
+        , mRequestTimeout(5)
+        , mContentTimeout(30)
+        , mMaxRequestBodySize(16 * 1024)
+    {
+    }
+
+    uint16_t mThreadPoolSize;     ///< The number of threads serving http requests.
+    uint16_t mRequestTimeout;     ///< The time(s) to receive the request header.
+    uint16_t mContentTimeout;     ///< The time(s) to receive the request body and to handle and send the response.
+    size_t   mMaxRequestBodySize; ///< The max size(bytes) of a request body, larger requests are rejected.
+};
+
 /**
  * This class implements the http server.
  *
@@ -84,9 +113,10 @@ public:
      * @param[in]  aIfName     The pointer to the Thread interface name.
      * @param[in]  aListenAddr The http server listen address, can be nullptr for any address.
      * @param[in]  aPort       The port of http server.
+     * @param[in]  aConfig     The configuration of http server.
      *
      */
-    void StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort);
+    void StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort, const WebServerConfig &aConfig);
 
     /**
      * This method stops the Web Server.
@@ -95,6 +125,26 @@ public:
     void StopWebServer(void);
 
 private:
+    enum ContentEncoding : uint8_t
+    {
+        kEncodingIdentity,
+        kEncodingGzip,
+        kEncodingBrotli,
+        kEncodingCount,
+    };
+
+    /**
+     * This structure represents a frontend file held in memory, with its precompressed variants if installed.
+     *
+     */
+    struct StaticResource
+    {
+        const char *mContentType;
+        const char *mCacheControl;
+        std::string mContent[kEncodingCount]; ///< Empty if the encoding is not available.
+        std::string mETag[kEncodingCount];
+    };
+
     typedef std::string (*HttpRequestCallback)(const std::string &aRequest, void *aUserData);
     static std::string HandleJoinNetworkRequest(const std::string &aJoinRequest, void *aUserData);
     static std::string HandleFormNetworkRequest(const std::string &aFormRequest, void *aUserData);
@@ -103,6 +153,7 @@ private:
     static std::string HandleGetStatusRequest(const std::string &aGetStatusRequest, void *aUserData);
     static std::string HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest,
                                                          void *             aUserData);
+    static std::string HandleStartScanRequest(const std::string &aStartScanRequest, void *aUserData);
     static std::string HandleCommission(const std::string &aCommissionRequest, void *aUserData);
 
     std::string HandleJoinNetworkRequest(const std::string &aJoinRequest);
@@ -111,9 +162,13 @@ private:
     std::string HandleDeletePrefixRequest(const std::string &aDeletePrefixRequest);
     std::string HandleGetStatusRequest(const std::string &aGetStatusRequest);
     std::string HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest);
+    std::string HandleStartScanRequest(const std::string &aStartScanRequest);
     std::string HandleCommission(const std::string &aCommissionRequest);
 
-    void HandleHttpRequest(const char *aUrl, const char *aMethod, HttpRequestCallback aCallback);
+    void HandleHttpRequest(const char *        aUrl,
+                           const char *        aMethod,
+                           HttpRequestCallback aCallback,
+                           bool                aLongRunning = false);
     void ResponseJoinNetwork(void);
     void ResponseFormNetwork(void);
     void ResponseAddOnMeshPrefix(void);
@@ -122,11 +177,19 @@ private:
     void ResponseGetAvailableNetwork(void);
     void DefaultHttpResponse(void);
     void ResponseCommission(void);
+    void ResponseStatusPush(void);
 
     void Init(void);
-
-    HttpServer *           mServer;
-    otbr::Web::WpanService mWpanService;
+    void LoadStaticResources(void);
+
+    HttpServer *                                   mServer;
+    otbr::Web::WpanService                         mWpanService;
+    StatusPublisher                                mStatusPublisher; ///< Pushes the status to WebSocket clients.
+    std::map<std::string, StaticResource>          mStaticResources;
+    size_t                                         mMaxRequestBodySize;
+    boost::asio::io_service                        mLongRunningService; ///< Runs form, join and commission requests.
+    std::unique_ptr<boost::asio::io_service::work> mLongRunningWork;
+    std::thread                                    mLongRunningThread;
 };
 
 } // namespace Web
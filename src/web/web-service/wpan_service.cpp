@@ -35,7 +35,9 @@
 
 #include "web/web-service/wpan_service.hpp"
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 
 #include <inttypes.h>
 #include <stdio.h>
@@ -52,16 +54,18 @@ namespace Web {
 
 std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinRequest)
 {
-    Json::Value                 root;
-    Json::Reader                reader;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         index;
-    std::string                 masterKey;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    std::lock_guard<std::mutex> clientLock(mClientMutex);
+
+    Json::Value                  root;
+    Json::Reader                 reader;
+    Json::FastWriter             jsonWriter;
+    std::string                  response;
+    int                          index;
+    std::string                  masterKey;
+    std::string                  prefix;
+    bool                         defaultRoute;
+    int                          ret    = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client = mClient;
 
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
@@ -84,6 +88,7 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
     VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 exit:
+    InvalidateStatus();
 
     root.clear();
     root["result"] = WPAN_RESPONSE_SUCCESS;
@@ -100,23 +105,25 @@ exit:
 
 std::string WpanService::HandleFormNetworkRequest(const std::string &aFormRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    otbr::Psk::Pskc             psk;
-    char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
-    uint8_t                     extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
-    std::string                 masterKey;
-    std::string                 prefix;
-    uint16_t                    channel;
-    std::string                 networkName;
-    std::string                 passphrase;
-    uint16_t                    panId;
-    uint64_t                    extPanId;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    std::lock_guard<std::mutex> clientLock(mClientMutex);
+
+    Json::Value                  root;
+    Json::FastWriter             jsonWriter;
+    Json::Reader                 reader;
+    std::string                  response;
+    otbr::Psk::Pskc              psk;
+    char                         pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
+    uint8_t                      extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
+    std::string                  masterKey;
+    std::string                  prefix;
+    uint16_t                     channel;
+    std::string                  networkName;
+    std::string                  passphrase;
+    uint16_t                     panId;
+    uint64_t                     extPanId;
+    bool                         defaultRoute;
+    int                          ret    = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client = mClient;
 
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
@@ -150,6 +157,7 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 exit:
+    InvalidateStatus();
 
     root.clear();
 
@@ -166,14 +174,16 @@ exit:
 
 std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    std::lock_guard<std::mutex> clientLock(mClientMutex);
+
+    Json::Value                  root;
+    Json::FastWriter             jsonWriter;
+    Json::Reader                 reader;
+    std::string                  response;
+    std::string                  prefix;
+    bool                         defaultRoute;
+    int                          ret    = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client = mClient;
 
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
@@ -190,6 +200,7 @@ std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixReq
                  ret = kWpanStatus_SetGatewayFailed);
     VerifyOrExit(client.Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
 exit:
+    InvalidateStatus();
 
     root.clear();
 
@@ -206,13 +217,15 @@ exit:
 
 std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    std::lock_guard<std::mutex> clientLock(mClientMutex);
+
+    Json::Value                  root;
+    Json::FastWriter             jsonWriter;
+    Json::Reader                 reader;
+    std::string                  response;
+    std::string                  prefix;
+    int                          ret    = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client = mClient;
 
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
@@ -227,6 +240,7 @@ std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteReq
     VerifyOrExit(client.Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
     VerifyOrExit(client.Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
 exit:
+    InvalidateStatus();
 
     root.clear();
     root["result"] = WPAN_RESPONSE_SUCCESS;
@@ -241,14 +255,62 @@ exit:
     return response;
 }
 
-std::string WpanService::HandleStatusRequest()
+std::string WpanService::HandleStatusRequest(void)
 {
-    Json::Value                 root, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response, networkName, extPanId, propertyValue;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-    char *                      rval;
+    std::lock_guard<std::mutex> statusLock(mStatusMutex);
+    Timepoint                   now         = Clock::now();
+    bool                        invalidated = mStatusInvalidated.exchange(false);
+    std::string                 response;
+
+    // Browsers poll the status, so all of them share a snapshot which is queried at most once per TTL.
+    if (invalidated || mStatusResponse.empty() || now >= mStatusExpiry)
+    {
+        std::unique_lock<std::mutex> clientLock(mClientMutex, std::try_to_lock);
+
+        // A long-running request holds the daemon, keep serving the snapshot unless it's been invalidated.
+        if (!clientLock.owns_lock() && (invalidated || mStatusResponse.empty()))
+        {
+            clientLock.lock();
+        }
+
+        if (clientLock.owns_lock())
+        {
+            // A failure is not cached, so the next request queries the daemon again.
+            if (QueryStatus(response) == kWpanStatus_Ok)
+            {
+                mStatusResponse = response;
+                mStatusExpiry   = now + Milliseconds(kStatusCacheTtl);
+            }
+            else
+            {
+                mStatusResponse.clear();
+            }
+
+            ExitNow();
+        }
+    }
+
+    response = mStatusResponse;
+
+exit:
+    return response;
+}
+
+void WpanService::InvalidateStatus(void)
+{
+    mStatusInvalidated = true;
+}
+
+int WpanService::QueryStatus(std::string &aResponse)
+{
+    Json::Value                  root, networkInfo;
+    Json::FastWriter             jsonWriter;
+    std::string                  networkName, extPanId, propertyValue;
+    int                          ret    = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client = mClient;
+    std::vector<std::string>     commands;
+    std::vector<std::string>     outputs;
+    char *                       rval;
 
     networkInfo["WPAN service"] = "uninitialized";
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
@@ -271,35 +333,36 @@ std::string WpanService::HandleStatusRequest()
         networkInfo["WPAN service"] = "associated";
     }
 
-    VerifyOrExit((rval = client.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version"] = rval;
-
-    VerifyOrExit((rval = client.Execute("version api")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version API"] = rval;
-
-    VerifyOrExit((rval = client.Execute("rcp version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Version"] = rval;
-
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:EUI64"] = rval;
-
-    VerifyOrExit((rval = client.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Channel"] = rval;
-
-    VerifyOrExit((rval = client.Execute("txpower")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:TxPower"] = rval;
-
-    VerifyOrExit((rval = client.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:Name"] = rval;
+    {
+        static const char *const kProperties[][2] = {
+            {"version", "OpenThread:Version"},
+            {"version api", "OpenThread:Version API"},
+            {"rcp version", "RCP:Version"},
+            {"eui64", "RCP:EUI64"},
+            {"channel", "RCP:Channel"},
+            {"txpower", "RCP:TxPower"},
+            {"networkname", "Network:Name"},
+            {"extpanid", "Network:XPANID"},
+            {"panid", "Network:PANID"},
+            {"partitionid", "Network:PartitionID"},
+        };
+
+        // All properties and addresses are queried in one round trip.
+        for (const auto &property : kProperties)
+        {
+            commands.push_back(property[0]);
+        }
 
-    VerifyOrExit((rval = client.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:XPANID"] = rval;
+        commands.push_back("dataset active");
+        commands.push_back("ipaddr");
 
-    VerifyOrExit((rval = client.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PANID"] = rval;
+        VerifyOrExit(client.ExecuteBatch(commands, outputs), ret = kWpanStatus_GetPropertyFailed);
 
-    VerifyOrExit((rval = client.Execute("partitionid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PartitionID"] = rval;
+        for (size_t i = 0; i < sizeof(kProperties) / sizeof(kProperties[0]); i++)
+        {
+            networkInfo[kProperties[i][1]] = outputs[i];
+        }
+    }
 
     {
         static const char kMeshLocalPrefixLocator[]       = "Mesh Local Prefix: ";
@@ -307,9 +370,10 @@ std::string WpanService::HandleStatusRequest()
         static const char localAddressToken[]             = "fd";
         static const char linkLocalAddressToken[]         = "fe80";
         std::string       meshLocalPrefix                 = "";
+        std::string &     dataset                         = outputs[outputs.size() - 2];
+        std::string &     addresses                       = outputs[outputs.size() - 1];
 
-        VerifyOrExit((rval = client.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-        rval = strstr(rval, kMeshLocalPrefixLocator);
+        rval = strstr(&dataset[0], kMeshLocalPrefixLocator);
         if (rval != nullptr)
         {
             rval += sizeof(kMeshLocalPrefixLocator) - 1;
@@ -320,9 +384,7 @@ std::string WpanService::HandleStatusRequest()
             meshLocalPrefix.resize(meshLocalPrefix.find(":/"));
         }
 
-        VerifyOrExit((rval = client.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-
-        for (rval = strtok(rval, "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
+        for (rval = strtok(&addresses[0], "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
         {
             char *meshLocalAddressToken = nullptr;
 
@@ -380,33 +442,109 @@ exit:
         otbrLogErr("Wpan service error: %d", ret);
     }
     root["error"] = ret;
-    response      = jsonWriter.write(root);
-    return response;
+    aResponse     = jsonWriter.write(root);
+    return ret;
 }
 
-std::string WpanService::HandleAvailableNetworkRequest()
+std::string WpanService::HandleStartScanRequest(void)
 {
-    Json::Value                 root, networks, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    std::lock_guard<std::mutex> lock(mScanMutex);
+
+    // Requests during a scan join it rather than queuing more radio scans.
+    if (!mScanRunning)
+    {
+        if (mScanThread.joinable())
+        {
+            mScanThread.join();
+        }
+
+        ++mScanId;
+        mScanRunning = true;
+        mScanThread  = std::thread(&WpanService::RunScan, this);
+    }
+
+    return WriteScanResponse();
+}
+
+std::string WpanService::HandleAvailableNetworkRequest(void)
+{
+    std::lock_guard<std::mutex> lock(mScanMutex);
+
+    return WriteScanResponse();
+}
+
+std::string WpanService::WriteScanResponse(void) const
+{
+    Json::Value      root;
+    Json::FastWriter jsonWriter;
+
+    if (mScanId == 0 || mScanRunning)
+    {
+        root["error"] = kWpanStatus_Ok;
+        root["state"] = (mScanId == 0) ? "idle" : "running";
+    }
+    else
+    {
+        root          = mScanResult;
+        root["state"] = "done";
+    }
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_ScanFailed);
-    VerifyOrExit((mNetworksCount = client.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
-                 ret = kWpanStatus_NetworkNotFound);
+    root["id"] = mScanId;
 
-    for (int i = 0; i < mNetworksCount; i++)
+    return jsonWriter.write(root);
+}
+
+void WpanService::RunScan(void)
+{
+    Json::Value result = ScanNetworks();
+
+    {
+        std::lock_guard<std::mutex> lock(mScanMutex);
+
+        mScanResult  = result;
+        mScanRunning = false;
+    }
+}
+
+Json::Value WpanService::ScanNetworks(void)
+{
+    Json::Value                  root, networkInfo;
+    std::vector<WpanNetworkInfo> networks(OT_SCANNED_NET_BUFFER_SIZE);
+    int                          count = 0;
+    int                          ret   = kWpanStatus_Ok;
+
+    // The channels are scanned one at a time and the daemon connection is released in between, so that other
+    // requests wait for the scan of one channel rather than of all channels.
+    for (uint8_t channel = kScanMinChannel; channel <= kScanMaxChannel && count < static_cast<int>(networks.size());
+         ++channel)
+    {
+        std::lock_guard<std::mutex> clientLock(mClientMutex);
+
+        VerifyOrExit(mClient.Connect(), ret = kWpanStatus_ScanFailed);
+        count += mClient.Scan(&networks[count], static_cast<int>(networks.size()) - count, channel);
+    }
+
+    // The join requests refer to the networks by their indexes in the latest results.
+    {
+        std::lock_guard<std::mutex> clientLock(mClientMutex);
+
+        std::copy(networks.begin(), networks.begin() + count, mNetworks);
+        mNetworksCount = count;
+    }
+
+    VerifyOrExit(count > 0, ret = kWpanStatus_NetworkNotFound);
+
+    for (int i = 0; i < count; i++)
     {
         char extPanId[OT_EXTENDED_PANID_LENGTH * 2 + 1], panId[OT_PANID_LENGTH * 2 + 3],
             hardwareAddress[OT_HARDWARE_ADDRESS_LENGTH * 2 + 1];
-        otbr::Utils::Long2Hex(bswap_64(mNetworks[i].mExtPanId), extPanId);
-        otbr::Utils::Bytes2Hex(mNetworks[i].mHardwareAddress, OT_HARDWARE_ADDRESS_LENGTH, hardwareAddress);
-        sprintf(panId, "0x%X", mNetworks[i].mPanId);
-        networkInfo[i]["nn"] = mNetworks[i].mNetworkName;
+        otbr::Utils::Long2Hex(bswap_64(networks[i].mExtPanId), extPanId);
+        otbr::Utils::Bytes2Hex(networks[i].mHardwareAddress, OT_HARDWARE_ADDRESS_LENGTH, hardwareAddress);
+        sprintf(panId, "0x%X", networks[i].mPanId);
+        networkInfo[i]["nn"] = networks[i].mNetworkName;
         networkInfo[i]["xp"] = extPanId;
         networkInfo[i]["pi"] = panId;
-        networkInfo[i]["ch"] = mNetworks[i].mChannel;
+        networkInfo[i]["ch"] = networks[i].mChannel;
         networkInfo[i]["ha"] = hardwareAddress;
     }
 
@@ -419,15 +557,17 @@ exit:
         otbrLogErr("Error is %d", ret);
     }
     root["error"] = ret;
-    response      = jsonWriter.write(root);
-    return response;
+
+    return root;
 }
 
-int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const
+int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId)
 {
-    int                         status = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-    const char *                rval;
+    std::lock_guard<std::mutex> clientLock(mClientMutex);
+
+    int                          status = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client = mClient;
+    const char *                 rval;
 
     VerifyOrExit(client.Connect(), status = kWpanStatus_Uninitialized);
     rval = client.Execute("state");
@@ -442,13 +582,11 @@ int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aE
     }
     else
     {
-        rval = client.Execute("networkname");
-        VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
-        aNetworkName = rval;
+        std::vector<std::string> outputs;
 
-        rval = client.Execute("extpanid");
-        VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
-        aExtPanId = rval;
+        VerifyOrExit(client.ExecuteBatch({"networkname", "extpanid"}, outputs), status = kWpanStatus_Down);
+        aNetworkName = outputs[0];
+        aExtPanId    = outputs[1];
     }
 
 exit:
@@ -458,6 +596,8 @@ exit:
 
 std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
 {
+    std::unique_lock<std::mutex> clientLock(mClientMutex);
+
     Json::Value      root;
     Json::Reader     reader;
     Json::FastWriter jsonWriter;
@@ -470,11 +610,12 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
     pskd = root["pskd"].asString();
 
     {
-        otbr::Web::OpenThreadClient client(mIfName);
+        otbr::Web::OpenThreadClient &client = mClient;
 
         VerifyOrExit(client.Connect(), ret = kWpanStatus_Uninitialized);
 
-        for (int i = 0; i < 5; i++)
+        // Poll the commissioner state for up to 5 seconds, so that the request completes as soon as it's active.
+        for (int i = 0; i < kCommissionerPollCount; i++)
         {
             VerifyOrExit((rval = client.Execute("commissioner state")) != nullptr, ret = kWpanStatus_Down);
 
@@ -490,7 +631,10 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
                 ExitNow();
             }
 
-            sleep(1);
+            // Let other requests use the daemon while waiting.
+            clientLock.unlock();
+            usleep(kCommissionerPollInterval * 1000);
+            clientLock.lock();
         }
 
         client.Execute("commissioner stop");
@@ -499,6 +643,7 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
     ret = kWpanStatus_SetFailed;
 
 exit:
+    InvalidateStatus();
 
     root.clear();
     root["result"] = WPAN_RESPONSE_SUCCESS;
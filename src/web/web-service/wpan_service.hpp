@@ -42,10 +42,15 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include <json/json.h>
 #include <json/writer.h>
 
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
 #include "web/web-service/ot_client.hpp"
@@ -73,6 +78,32 @@ namespace Web {
 class WpanService
 {
 public:
+    /**
+     * This constructor creates a WPAN service.
+     *
+     */
+    WpanService(void)
+        : mNetworksCount(0)
+        , mIfName()
+        , mClient(mIfName)
+        , mStatusInvalidated(false)
+        , mScanId(0)
+        , mScanRunning(false)
+    {
+    }
+
+    /**
+     * This destructor waits for the scan in progress.
+     *
+     */
+    ~WpanService(void)
+    {
+        if (mScanThread.joinable())
+        {
+            mScanThread.join();
+        }
+    }
+
     /**
      * This method handles the http request to join network.
      *
@@ -116,14 +147,29 @@ public:
     /**
      * This method handles http request to get netowrk status.
      *
+     * The status is cached for a short time, and dropped as soon as a request changes the network. While another
+     * request holds the daemon, the cached status is returned even if it's expired.
+     *
      * @returns The string to the http response of getting status.
      *
      */
     std::string HandleStatusRequest(void);
 
+    /**
+     * This method handles http request to start scanning for available networks.
+     *
+     * The scan runs in the background. A request during a scan joins it instead of starting another one.
+     *
+     * @returns The string to the http response with the ID and the state of the scan.
+     *
+     */
+    std::string HandleStartScanRequest(void);
+
     /**
      * This method handles http request to get available networks.
      *
+     * This method returns the state of the latest scan without waiting, and the available networks once it is done.
+     *
      * @returns The string to the http response of getting available networks.
      *
      */
@@ -160,7 +206,7 @@ public:
      * @retval kWpanStatus_Down      The Thread service was down.
      *
      */
-    int GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const;
+    int GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId);
 
     /**
      * This method starts commissioner and wait for a device to join
@@ -174,6 +220,11 @@ public:
     std::string CommissionDevice(const char *aPskd, const char *aNetworkPassword);
 
 private:
+    int                QueryStatus(std::string &aResponse);
+    void               InvalidateStatus(void);
+    std::string        WriteScanResponse(void) const;
+    void               RunScan(void);
+    Json::Value        ScanNetworks(void);
     int                commitActiveDataset(otbr::Web::OpenThreadClient &aClient,
                                            const std::string &          aMasterKey,
                                            const std::string &          aNetworkName,
@@ -182,11 +233,22 @@ private:
                                            uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
 
-    WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
-    int             mNetworksCount;
-    char            mIfName[IFNAMSIZ];
-    std::string     mNetworkName;
-    std::string     mExtPanId;
+    WpanNetworkInfo   mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
+    int               mNetworksCount;
+    char              mIfName[IFNAMSIZ];
+    OpenThreadClient  mClient;      ///< The connection to the daemon shared by all requests, uses `mIfName`.
+    std::mutex        mClientMutex; ///< Protects `mClient` and `mNetworks` from concurrent requests.
+    std::string       mNetworkName;
+    std::string       mExtPanId;
+    std::mutex        mStatusMutex;    ///< Protects the status cache below, taken before `mClientMutex`.
+    std::string       mStatusResponse; ///< The cached status response, empty if not cached.
+    Timepoint         mStatusExpiry;
+    std::atomic<bool> mStatusInvalidated;
+    std::mutex        mScanMutex; ///< Protects the scan state below.
+    std::thread       mScanThread;
+    uint32_t          mScanId;
+    bool              mScanRunning;
+    Json::Value       mScanResult;
 
     enum
     {
@@ -206,6 +268,15 @@ private:
         kWpanStatus_Uninitialized,
     };
 
+    enum
+    {
+        kStatusCacheTtl           = 1000, ///< The time(ms) a status response is cached.
+        kCommissionerPollInterval = 200,  ///< The interval(ms) of polling the commissioner state.
+        kCommissionerPollCount    = 25,   ///< The number of times polling the commissioner state.
+        kScanMinChannel           = 11,   ///< The first channel scanned for networks.
+        kScanMaxChannel           = 26,   ///< The last channel scanned for networks.
+    };
+
     enum
     {
         kPropertyType_String = 0,
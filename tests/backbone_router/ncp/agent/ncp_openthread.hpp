@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes a minimal NCP controller for benchmarking the Backbone Router modules.
+ *
+ *   It replaces `src/agent/ncp_openthread.hpp` in the benchmark builds, so that the modules run
+ *   without an OpenThread instance and the benchmark can feed them synthetic events.
+ */
+
+#ifndef OTBR_AGENT_NCP_OPENTHREAD_HPP_
+#define OTBR_AGENT_NCP_OPENTHREAD_HPP_
+
+#include <openthread/instance.h>
+
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/worker_pool.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class implements the parts of the NCP controller used by the Backbone Router modules.
+ *
+ */
+class ControllerOpenThread : public MainloopProcessor
+{
+public:
+    ControllerOpenThread(void)
+        : mWorkerPool(mTaskRunner)
+    {
+    }
+
+    /**
+     * This method returns the OpenThread instance, which is always `nullptr`.
+     *
+     * The benchmark implements the OpenThread APIs called by the modules.
+     *
+     */
+    otInstance *GetInstance(void) { return nullptr; }
+
+    /**
+     * This method schedules a task to be executed on the mainloop after @p aDelay.
+     *
+     * @param[in]  aDelay  The delay in milliseconds.
+     * @param[in]  aTask   The task to be executed.
+     *
+     * @returns  The handle of the posted task.
+     *
+     */
+    TaskRunner::TaskHandle PostTimerTask(Milliseconds aDelay, InlineTask aTask)
+    {
+        return mTaskRunner.Post(std::move(aDelay), std::move(aTask));
+    }
+
+    /**
+     * This method returns the worker pool for blocking jobs.
+     *
+     * @returns  A reference to the worker pool.
+     *
+     */
+    WorkerPool &GetWorkerPool(void) { return mWorkerPool; }
+
+    void Update(MainloopContext &aMainloop) override { mTaskRunner.Update(aMainloop); }
+    void Process(const MainloopContext &aMainloop) override { mTaskRunner.Process(aMainloop); }
+
+private:
+    TaskRunner mTaskRunner;
+    WorkerPool mWorkerPool;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_NCP_OPENTHREAD_HPP_
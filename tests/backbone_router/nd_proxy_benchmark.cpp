@@ -0,0 +1,936 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a scale benchmark of the ND Proxy manager.
+ *
+ * The ND Proxy manager runs on one end of a veth pair, a backbone host runs on the other end in another network
+ * namespace. The benchmark injects ND Proxy events of synthetic DUAs, has the backbone host send Neighbor
+ * Solicitations of the DUAs at a fixed rate and reports the latencies of the Neighbor Advertisements, the drop
+ * rate and the CPU time of the ND Proxy manager.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <ifaddrs.h>
+#include <inttypes.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <linux/if_packet.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/ip6.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openthread/backbone_router_ftd.h>
+
+#include "agent/instance_params.hpp"
+#include "backbone_router/nd_proxy.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+using namespace otbr;
+
+namespace {
+
+const char kDomainPrefix[] = "fd00:7d03:7d03:7d03::";
+
+constexpr uint8_t  kDomainPrefixLength = 64;
+constexpr uint32_t kMaxNumDuas         = 0xffffff; // DUAs only differ in the last 24 bits.
+constexpr size_t   kBatchSize          = 64;       // Max number of packets sent or received with one call.
+constexpr size_t   kMaxNaSize          = 128;
+
+struct Options
+{
+    const char *mBackboneIfName = nullptr;
+    const char *mHostIfName     = nullptr;
+    const char *mHostNetns      = nullptr; // The network namespace of the backbone host, as named by `ip netns`.
+    uint32_t    mNumDuas        = 1000;
+    uint32_t    mRate           = 1000; // NS per second.
+    uint32_t    mDuration       = 5;    // Seconds of sending NS in a phase.
+    uint32_t    mTimeout        = 5;    // Seconds to wait for the NAs of a phase.
+    uint32_t    mMaxP99Latency  = 0;    // Milliseconds, zero means no limit.
+    double      mMaxDropRate    = 100;  // Percent.
+    bool        mVerbose        = false;
+};
+
+struct PhaseResult
+{
+    std::string               mName;
+    uint32_t                  mRequests = 0; // The number of NS sent, or DUAs added in the announcement phase.
+    uint32_t                  mAnswered = 0;
+    std::vector<Microseconds> mLatencies;
+    Microseconds              mWallTime{0};
+    Microseconds              mCpuTime{0}; // The CPU time of the ND Proxy manager, excluding the backbone host.
+    Microseconds              mHostCpuTime{0};
+    uint64_t                  mKernelDrops = 0;
+};
+
+/**
+ * This structure represents a Neighbor Solicitation with the Source Link-Layer Address option.
+ *
+ */
+struct NeighborSolicitation
+{
+    struct ip6_hdr             mHeader;
+    struct nd_neighbor_solicit mSolicit;
+    struct nd_opt_hdr          mSourceLinkAddrOption;
+    uint8_t                    mSourceLinkAddr[sizeof(MacAddress)];
+};
+
+// The DUAs are registered by index, the ND Proxy manager looks them up through the OpenThread API.
+std::vector<bool> sIsDuaRegistered;
+
+Ip6Address GetDua(uint32_t aIndex)
+{
+    Ip6Address dua;
+
+    VerifyOrDie(Ip6Address::FromString(kDomainPrefix, dua) == OTBR_ERROR_NONE, "Invalid Domain Prefix");
+    dua.m32[3] = htobe32(aIndex + 1);
+
+    return dua;
+}
+
+bool GetDuaIndex(const Ip6Address &aAddress, uint32_t &aIndex)
+{
+    Ip6Address prefix = GetDua(0);
+    uint32_t   value  = be32toh(aAddress.m32[3]);
+
+    aIndex = value - 1;
+
+    return memcmp(aAddress.m8, prefix.m8, 12) == 0 && value > 0 && value <= sIsDuaRegistered.size();
+}
+
+Microseconds GetCpuUsage(int aWho)
+{
+    rusage usage;
+
+    getrusage(aWho, &usage);
+
+    return FromTimeval<Microseconds>(usage.ru_utime) + FromTimeval<Microseconds>(usage.ru_stime);
+}
+
+otbrError GetMacAddress(const char *aIfName, MacAddress &aMacAddress)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    ifreq     ifr;
+    int       fd = socket(AF_INET6, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, aIfName, sizeof(ifr.ifr_name) - 1);
+    VerifyOrExit(ioctl(fd, SIOCGIFHWADDR, &ifr) == 0, error = OTBR_ERROR_ERRNO);
+    memcpy(aMacAddress.m8, ifr.ifr_hwaddr.sa_data, sizeof(aMacAddress.m8));
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+otbrError GetLinkLocalAddress(const char *aIfName, Ip6Address &aAddress)
+{
+    otbrError error = OTBR_ERROR_NOT_FOUND;
+    ifaddrs * addrs = nullptr;
+
+    VerifyOrExit(getifaddrs(&addrs) == 0, error = OTBR_ERROR_ERRNO);
+
+    for (ifaddrs *addr = addrs; addr != nullptr; addr = addr->ifa_next)
+    {
+        if (addr->ifa_addr != nullptr && addr->ifa_addr->sa_family == AF_INET6 &&
+            strcmp(addr->ifa_name, aIfName) == 0)
+        {
+            Ip6Address address(reinterpret_cast<sockaddr_in6 *>(addr->ifa_addr)->sin6_addr.s6_addr);
+
+            if (address.IsLinkLocal())
+            {
+                aAddress = address;
+                ExitNow(error = OTBR_ERROR_NONE);
+            }
+        }
+    }
+
+exit:
+    if (addrs != nullptr)
+    {
+        freeifaddrs(addrs);
+    }
+
+    return error;
+}
+
+uint16_t ComputeIcmp6Checksum(const NeighborSolicitation &aPacket)
+{
+    const uint8_t *icmp   = reinterpret_cast<const uint8_t *>(&aPacket.mSolicit);
+    const size_t   length = sizeof(aPacket) - sizeof(aPacket.mHeader);
+    uint32_t       sum    = length + IPPROTO_ICMPV6;
+
+    for (size_t i = 0; i < sizeof(aPacket.mHeader.ip6_src); i += 2)
+    {
+        sum += aPacket.mHeader.ip6_src.s6_addr[i] << 8 | aPacket.mHeader.ip6_src.s6_addr[i + 1];
+        sum += aPacket.mHeader.ip6_dst.s6_addr[i] << 8 | aPacket.mHeader.ip6_dst.s6_addr[i + 1];
+    }
+
+    for (size_t i = 0; i < length; i += 2)
+    {
+        sum += icmp[i] << 8 | icmp[i + 1];
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return static_cast<uint16_t>(~sum);
+}
+
+/**
+ * This class implements a host on the backbone link, which solicits the DUAs and receives the NAs.
+ *
+ */
+class BackboneHost
+{
+public:
+    enum class Mode
+    {
+        kAnnouncement, ///< Wait for the unsolicited NA of every DUA.
+        kMulticastNs,  ///< Send NS to the solicited-node groups of the DUAs.
+        kUnicastNs,    ///< Send NS to the DUAs.
+    };
+
+    explicit BackboneHost(const Options &aOptions)
+        : mOptions(aOptions)
+        , mIfIndex(0)
+        , mTxSock(-1)
+        , mRxSock(-1)
+        , mNextDua(0)
+        , mNumOutstanding(0)
+        , mCpuTime(0)
+    {
+    }
+
+    ~BackboneHost(void)
+    {
+        if (mTxSock >= 0)
+        {
+            close(mTxSock);
+        }
+
+        if (mRxSock >= 0)
+        {
+            close(mRxSock);
+        }
+    }
+
+    otbrError Open(const MacAddress &aRouterMacAddress);
+
+    /**
+     * This method runs a phase, it's called on the thread of the backbone host.
+     *
+     * @param[in]     aMode    The mode of the phase.
+     * @param[in]     aStart   The time the DUAs were added, for the announcement phase.
+     * @param[inout]  aResult  The result of the phase.
+     *
+     */
+    void Run(Mode aMode, Timepoint aStart, PhaseResult &aResult);
+
+    /**
+     * This method returns the CPU time of the last phase.
+     *
+     */
+    Microseconds GetCpuTime(void) const { return mCpuTime; }
+
+private:
+    otbrError OpenSockets(void);
+    void      SendSolicitations(Mode aMode, uint32_t aCount, PhaseResult &aResult);
+    void      ReceiveAdvertisements(Mode aMode, Timepoint aStart, PhaseResult &aResult);
+
+    const Options &                    mOptions;
+    unsigned int                       mIfIndex;
+    int                                mTxSock; ///< A packet socket to send NS with any source and destination.
+    int                                mRxSock; ///< A raw ICMPv6 socket to receive NA.
+    Ip6Address                         mAddress;
+    MacAddress                         mMacAddress;
+    MacAddress                         mRouterMacAddress;
+    uint32_t                           mNextDua;
+    uint32_t                           mNumOutstanding;
+    std::vector<std::deque<Timepoint>> mOutstanding; ///< The send times of the unanswered NS, by DUA.
+    std::vector<bool>                  mAnnounced;
+    Microseconds                       mCpuTime;
+};
+
+otbrError BackboneHost::Open(const MacAddress &aRouterMacAddress)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       selfNetns  = -1;
+    int       hostNetns  = -1;
+    bool      isSwitched = false;
+
+    mRouterMacAddress = aRouterMacAddress;
+
+    // The sockets stay in the network namespace they are created in.
+    if (mOptions.mHostNetns != nullptr)
+    {
+        std::string path = std::string("/var/run/netns/") + mOptions.mHostNetns;
+
+        selfNetns = open("/proc/self/ns/net", O_RDONLY | O_CLOEXEC);
+        VerifyOrExit(selfNetns >= 0, error = OTBR_ERROR_ERRNO);
+        hostNetns = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        VerifyOrExit(hostNetns >= 0, error = OTBR_ERROR_ERRNO);
+        VerifyOrExit(setns(hostNetns, CLONE_NEWNET) == 0, error = OTBR_ERROR_ERRNO);
+        isSwitched = true;
+    }
+
+    error = OpenSockets();
+
+exit:
+    if (isSwitched)
+    {
+        VerifyOrDie(setns(selfNetns, CLONE_NEWNET) == 0, "Failed to restore the network namespace");
+    }
+
+    if (selfNetns >= 0)
+    {
+        close(selfNetns);
+    }
+
+    if (hostNetns >= 0)
+    {
+        close(hostNetns);
+    }
+
+    return error;
+}
+
+otbrError BackboneHost::OpenSockets(void)
+{
+    otbrError           error  = OTBR_ERROR_NONE;
+    int                 rcvbuf = 4 * 1024 * 1024;
+    const char *        ifName = mOptions.mHostIfName;
+    struct icmp6_filter filter;
+
+    mIfIndex = if_nametoindex(ifName);
+    VerifyOrExit(mIfIndex > 0, error = OTBR_ERROR_ERRNO);
+    SuccessOrExit(error = GetMacAddress(ifName, mMacAddress));
+    SuccessOrExit(error = GetLinkLocalAddress(ifName, mAddress));
+
+    mTxSock = socket(AF_PACKET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mTxSock >= 0, error = OTBR_ERROR_ERRNO);
+
+    mRxSock = socket(AF_INET6, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, IPPROTO_ICMPV6);
+    VerifyOrExit(mRxSock >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mRxSock, SOL_SOCKET, SO_BINDTODEVICE, ifName, strlen(ifName)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    ICMP6_FILTER_SETPASS(ND_NEIGHBOR_ADVERT, &filter);
+    VerifyOrExit(setsockopt(mRxSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    // A burst of announcements must not overflow the socket, it would be counted as loss of the ND Proxy.
+    if (setsockopt(mRxSock, SOL_SOCKET, SO_RCVBUFFORCE, &rcvbuf, sizeof(rcvbuf)) != 0)
+    {
+        VerifyOrExit(setsockopt(mRxSock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) == 0,
+                     error = OTBR_ERROR_ERRNO);
+    }
+
+exit:
+    return error;
+}
+
+void BackboneHost::Run(Mode aMode, Timepoint aStart, PhaseResult &aResult)
+{
+    Microseconds cpuTime = GetCpuUsage(RUSAGE_THREAD);
+    Timepoint    start   = Clock::now();
+    Timepoint    end     = start + Seconds(aMode == Mode::kAnnouncement ? 0 : mOptions.mDuration);
+    Timepoint    timeout = end + Seconds(mOptions.mTimeout);
+    uint64_t     sent    = 0;
+
+    mNextDua        = 0;
+    mNumOutstanding = 0;
+    mOutstanding.assign(mOptions.mNumDuas, std::deque<Timepoint>());
+    mAnnounced.assign(mOptions.mNumDuas, false);
+
+    while (true)
+    {
+        Timepoint     now = Clock::now();
+        struct pollfd pfd = {mRxSock, POLLIN, 0};
+
+        if (now < end)
+        {
+            uint64_t due =
+                static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(now - start).count()) * mOptions.mRate /
+                1000000;
+
+            while (due > sent)
+            {
+                uint32_t count    = static_cast<uint32_t>(std::min<uint64_t>(due - sent, kBatchSize));
+                uint32_t requests = aResult.mRequests;
+
+                SendSolicitations(aMode, count, aResult);
+                sent += aResult.mRequests - requests;
+
+                // Try again at the next tick if the NS can't be sent as fast.
+                if (aResult.mRequests - requests < count)
+                {
+                    break;
+                }
+            }
+        }
+        else if (now >= timeout || (aMode == Mode::kAnnouncement ? aResult.mAnswered == aResult.mRequests
+                                                                 : mNumOutstanding == 0))
+        {
+            break;
+        }
+
+        if (poll(&pfd, 1, /* aTimeout */ 1) > 0)
+        {
+            ReceiveAdvertisements(aMode, aStart, aResult);
+        }
+    }
+
+    mCpuTime = GetCpuUsage(RUSAGE_THREAD) - cpuTime;
+}
+
+void BackboneHost::SendSolicitations(Mode aMode, uint32_t aCount, PhaseResult &aResult)
+{
+    NeighborSolicitation packets[kBatchSize];
+    sockaddr_ll          dsts[kBatchSize];
+    iovec                iovs[kBatchSize];
+    mmsghdr              msgs[kBatchSize];
+    uint32_t             duas[kBatchSize];
+    Timepoint            now = Clock::now();
+    int                  rval;
+
+    memset(packets, 0, sizeof(packets));
+    memset(dsts, 0, sizeof(dsts));
+    memset(msgs, 0, sizeof(msgs));
+
+    for (uint32_t i = 0; i < aCount; i++)
+    {
+        NeighborSolicitation &packet = packets[i];
+        Ip6Address            target = GetDua(mNextDua);
+        Ip6Address            dst    = target;
+
+        duas[i]  = mNextDua;
+        mNextDua = (mNextDua + 1) % mOptions.mNumDuas;
+
+        if (aMode == Mode::kMulticastNs)
+        {
+            dst = target.ToSolicitedNodeMulticastAddress();
+        }
+
+        packet.mHeader.ip6_flow = htonl(6 << 28);
+        packet.mHeader.ip6_plen = htons(sizeof(packet) - sizeof(packet.mHeader));
+        packet.mHeader.ip6_nxt  = IPPROTO_ICMPV6;
+        packet.mHeader.ip6_hlim = 255;
+        mAddress.CopyTo(packet.mHeader.ip6_src);
+        dst.CopyTo(packet.mHeader.ip6_dst);
+
+        packet.mSolicit.nd_ns_type = ND_NEIGHBOR_SOLICIT;
+        target.CopyTo(packet.mSolicit.nd_ns_target);
+        packet.mSourceLinkAddrOption.nd_opt_type = ND_OPT_SOURCE_LINKADDR;
+        packet.mSourceLinkAddrOption.nd_opt_len  = (sizeof(packet.mSourceLinkAddrOption) + sizeof(MacAddress)) / 8;
+        memcpy(packet.mSourceLinkAddr, mMacAddress.m8, sizeof(MacAddress));
+        packet.mSolicit.nd_ns_cksum = htons(ComputeIcmp6Checksum(packet));
+
+        dsts[i].sll_family   = AF_PACKET;
+        dsts[i].sll_protocol = htons(ETH_P_IPV6);
+        dsts[i].sll_ifindex  = static_cast<int>(mIfIndex);
+        dsts[i].sll_halen    = sizeof(MacAddress);
+
+        if (dst.IsMulticast())
+        {
+            // 33:33 followed by the last 32 bits of the group.
+            dsts[i].sll_addr[0] = 0x33;
+            dsts[i].sll_addr[1] = 0x33;
+            memcpy(&dsts[i].sll_addr[2], &dst.m8[12], 4);
+        }
+        else
+        {
+            memcpy(dsts[i].sll_addr, mRouterMacAddress.m8, sizeof(MacAddress));
+        }
+
+        iovs[i].iov_base            = &packet;
+        iovs[i].iov_len             = sizeof(packet);
+        msgs[i].msg_hdr.msg_name    = &dsts[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(dsts[i]);
+        msgs[i].msg_hdr.msg_iov     = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    rval = sendmmsg(mTxSock, msgs, aCount, 0);
+
+    if (rval < 0)
+    {
+        // The NS are sent again at the next tick.
+        mNextDua = duas[0];
+        ExitNow();
+    }
+
+    mNextDua = (duas[0] + static_cast<uint32_t>(rval)) % mOptions.mNumDuas;
+
+    for (int i = 0; i < rval; i++)
+    {
+        mOutstanding[duas[i]].push_back(now);
+    }
+
+    mNumOutstanding += static_cast<uint32_t>(rval);
+    aResult.mRequests += static_cast<uint32_t>(rval);
+
+exit:
+    return;
+}
+
+void BackboneHost::ReceiveAdvertisements(Mode aMode, Timepoint aStart, PhaseResult &aResult)
+{
+    uint8_t buffers[kBatchSize][kMaxNaSize];
+    iovec   iovs[kBatchSize];
+    mmsghdr msgs[kBatchSize];
+    int     rval;
+
+    memset(msgs, 0, sizeof(msgs));
+
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+        iovs[i].iov_base           = buffers[i];
+        iovs[i].iov_len            = sizeof(buffers[i]);
+        msgs[i].msg_hdr.msg_iov    = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while ((rval = recvmmsg(mRxSock, msgs, kBatchSize, MSG_DONTWAIT, nullptr)) > 0)
+    {
+        Timepoint now = Clock::now();
+
+        for (int i = 0; i < rval; i++)
+        {
+            const struct nd_neighbor_advert *na = reinterpret_cast<const nd_neighbor_advert *>(buffers[i]);
+            bool                             solicited;
+            uint32_t                         dua;
+
+            if (msgs[i].msg_len < sizeof(*na) || na->nd_na_type != ND_NEIGHBOR_ADVERT ||
+                !GetDuaIndex(Ip6Address(na->nd_na_target.s6_addr), dua))
+            {
+                continue;
+            }
+
+            solicited = (na->nd_na_flags_reserved & ND_NA_FLAG_SOLICITED) != 0;
+
+            if (aMode == Mode::kAnnouncement && !solicited && !mAnnounced[dua])
+            {
+                mAnnounced[dua] = true;
+                aResult.mLatencies.push_back(std::chrono::duration_cast<Microseconds>(now - aStart));
+                ++aResult.mAnswered;
+            }
+            else if (aMode != Mode::kAnnouncement && solicited && !mOutstanding[dua].empty())
+            {
+                aResult.mLatencies.push_back(std::chrono::duration_cast<Microseconds>(now - mOutstanding[dua].front()));
+                mOutstanding[dua].pop_front();
+                --mNumOutstanding;
+                ++aResult.mAnswered;
+            }
+        }
+    }
+}
+
+class Benchmark
+{
+public:
+    explicit Benchmark(const Options &aOptions)
+        : mOptions(aOptions)
+        , mNdProxyManager(mNcp)
+        , mHost(aOptions)
+    {
+    }
+
+    otbrError Run(std::vector<PhaseResult> &aResults);
+
+private:
+    otbrError Setup(void);
+    void      RunMainloop(const std::atomic<bool> &aDone);
+    void      RunPhase(PhaseResult &aResult, const char *aName, BackboneHost::Mode aMode);
+
+    const Options &                mOptions;
+    Ncp::ControllerOpenThread      mNcp;
+    BackboneRouter::NdProxyManager mNdProxyManager;
+    BackboneHost                   mHost;
+};
+
+void Benchmark::RunMainloop(const std::atomic<bool> &aDone)
+{
+    MainloopManager &mainloopManager = MainloopManager::GetInstance();
+
+    while (!aDone)
+    {
+        MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {0, 10000};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        mainloopManager.Update(mainloop);
+
+        if (mainloopManager.Poll(mainloop) >= 0)
+        {
+            mainloopManager.Process(mainloop);
+        }
+        else if (errno != EINTR)
+        {
+            perror("poll");
+            break;
+        }
+    }
+}
+
+otbrError Benchmark::Setup(void)
+{
+    otbrError         error = OTBR_ERROR_NONE;
+    MacAddress        routerMacAddress;
+    Ip6Prefix         domainPrefix;
+    std::atomic<bool> isRuleAdded(false);
+
+    InstanceParams::Get().SetBackboneIfName(mOptions.mBackboneIfName);
+    SuccessOrExit(error = GetMacAddress(mOptions.mBackboneIfName, routerMacAddress));
+    SuccessOrExit(error = mHost.Open(routerMacAddress));
+
+    sIsDuaRegistered.assign(mOptions.mNumDuas, false);
+    MainloopManager::GetInstance().AddMainloopProcessor(&mNcp, "ncp");
+
+    VerifyOrDie(Ip6Address::FromString(kDomainPrefix, domainPrefix.mPrefix) == OTBR_ERROR_NONE,
+                "Invalid Domain Prefix");
+    domainPrefix.mLength = kDomainPrefixLength;
+    mNdProxyManager.Init();
+    mNdProxyManager.Enable(domainPrefix);
+    VerifyOrExit(mNdProxyManager.IsEnabled(), error = OTBR_ERROR_ERRNO);
+
+    // The ip6tables rule is added by a job with the ND Proxy manager as the serial key, so this job
+    // completes after the rule is in place.
+    mNcp.GetWorkerPool().Post([]() {}, [&isRuleAdded]() { isRuleAdded = true; }, &mNdProxyManager);
+    RunMainloop(isRuleAdded);
+    VerifyOrExit(mNdProxyManager.IsEnabled(), error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+void Benchmark::RunPhase(PhaseResult &aResult, const char *aName, BackboneHost::Mode aMode)
+{
+    std::atomic<bool> isDone(false);
+    Timepoint         start       = Clock::now();
+    Microseconds      cpuTime     = GetCpuUsage(RUSAGE_SELF);
+    uint64_t          kernelDrops = mNdProxyManager.GetCounters().mMulticastNsDropped;
+    std::thread       host;
+
+    aResult.mName     = aName;
+    aResult.mRequests = (aMode == BackboneHost::Mode::kAnnouncement) ? mOptions.mNumDuas : 0;
+
+    host = std::thread([this, aMode, start, &aResult, &isDone]() {
+        mHost.Run(aMode, start, aResult);
+        isDone = true;
+    });
+
+    if (aMode == BackboneHost::Mode::kAnnouncement)
+    {
+        for (uint32_t i = 0; i < mOptions.mNumDuas; i++)
+        {
+            Ip6Address dua = GetDua(i);
+
+            sIsDuaRegistered[i] = true;
+            mNdProxyManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED,
+                                                             reinterpret_cast<const otIp6Address *>(&dua));
+        }
+    }
+
+    RunMainloop(isDone);
+    host.join();
+
+    aResult.mWallTime    = std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+    aResult.mHostCpuTime = mHost.GetCpuTime();
+    aResult.mCpuTime     = GetCpuUsage(RUSAGE_SELF) - cpuTime - aResult.mHostCpuTime;
+    aResult.mKernelDrops = mNdProxyManager.GetCounters().mMulticastNsDropped - kernelDrops;
+}
+
+otbrError Benchmark::Run(std::vector<PhaseResult> &aResults)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = Setup());
+
+    aResults.resize(3);
+
+    RunPhase(aResults[0], "announce", BackboneHost::Mode::kAnnouncement);
+    RunPhase(aResults[1], "multicast", BackboneHost::Mode::kMulticastNs);
+    RunPhase(aResults[2], "unicast", BackboneHost::Mode::kUnicastNs);
+
+    mNdProxyManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_CLEARED, nullptr);
+    sIsDuaRegistered.assign(mOptions.mNumDuas, false);
+
+exit:
+    mNdProxyManager.Disable();
+    MainloopManager::GetInstance().RemoveMainloopProcessor(&mNcp);
+
+    return error;
+}
+
+Microseconds GetPercentile(const std::vector<Microseconds> &aSorted, uint32_t aPercent)
+{
+    // The nearest-rank percentile.
+    size_t rank = (aSorted.size() * aPercent + 99) / 100;
+
+    return aSorted.empty() ? Microseconds(0) : aSorted[std::max<size_t>(rank, 1) - 1];
+}
+
+double ToMilliseconds(Microseconds aTime)
+{
+    return aTime.count() / 1000.0;
+}
+
+bool Report(const Options &aOptions, std::vector<PhaseResult> &aResults)
+{
+    bool passed = true;
+
+    printf("ND Proxy benchmark: %u DUAs, %u NS per second for %u seconds\n", aOptions.mNumDuas, aOptions.mRate,
+           aOptions.mDuration);
+    // The CPU time of the backbone host is reported to tell whether it could keep up with the rate.
+    printf("%-10s %8s %8s %8s %9s %9s %9s %9s %8s %10s %9s %6s %9s\n", "phase", "requests", "answered", "drop(%)",
+           "p50(ms)", "p90(ms)", "p99(ms)", "max(ms)", "kdrops", "wall(ms)", "cpu(ms)", "cpu(%)", "host(ms)");
+
+    for (PhaseResult &result : aResults)
+    {
+        Microseconds p99;
+        double       dropRate = 0;
+
+        std::sort(result.mLatencies.begin(), result.mLatencies.end());
+        p99 = GetPercentile(result.mLatencies, 99);
+
+        if (result.mRequests > 0)
+        {
+            dropRate = 100.0 * (result.mRequests - result.mAnswered) / result.mRequests;
+        }
+
+        printf("%-10s %8u %8u %8.3f %9.3f %9.3f %9.3f %9.3f %8" PRIu64 " %10.3f %9.3f %6.1f %9.3f\n",
+               result.mName.c_str(), result.mRequests, result.mAnswered, dropRate,
+               ToMilliseconds(GetPercentile(result.mLatencies, 50)),
+               ToMilliseconds(GetPercentile(result.mLatencies, 90)), ToMilliseconds(p99),
+               ToMilliseconds(result.mLatencies.empty() ? Microseconds(0) : result.mLatencies.back()),
+               result.mKernelDrops, ToMilliseconds(result.mWallTime), ToMilliseconds(result.mCpuTime),
+               result.mWallTime.count() > 0 ? 100.0 * result.mCpuTime.count() / result.mWallTime.count() : 0,
+               ToMilliseconds(result.mHostCpuTime));
+
+        if (result.mRequests == 0 || dropRate > aOptions.mMaxDropRate)
+        {
+            fprintf(stderr, "The drop rate of %s exceeds %.3f%%\n", result.mName.c_str(), aOptions.mMaxDropRate);
+            passed = false;
+        }
+
+        if (aOptions.mMaxP99Latency > 0 && p99 > Milliseconds(aOptions.mMaxP99Latency))
+        {
+            fprintf(stderr, "The p99 latency of %s exceeds %u ms\n", result.mName.c_str(), aOptions.mMaxP99Latency);
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "    -B, --backbone-ifname <name>  The backbone interface of the ND Proxy manager, required.\n"
+            "    -I, --host-ifname <name>      The interface of the backbone host, required.\n"
+            "    -N, --host-netns <name>       The network namespace of the backbone host, default the current one.\n"
+            "    -n, --duas <n>                Number of DUAs, default 1000.\n"
+            "    -r, --rate <n>                Number of NS sent per second, default 1000.\n"
+            "    -d, --duration <sec>          Seconds of sending NS in each phase, default 5.\n"
+            "    -t, --timeout <sec>           Seconds to wait for the NAs of a phase, default 5.\n"
+            "    -p, --max-p99 <ms>            Fail if the p99 latency of a phase exceeds this limit.\n"
+            "    -D, --max-drop <percent>      Fail if the drop rate of a phase exceeds this limit.\n"
+            "    -v, --verbose                 Print debug logs.\n"
+            "    -h, --help                    Print this help.\n",
+            aProgram);
+}
+
+bool ParseUint32(const char *aString, uint32_t &aValue)
+{
+    char *        end;
+    unsigned long value = strtoul(aString, &end, 0);
+
+    aValue = static_cast<uint32_t>(value);
+
+    return *aString != '\0' && *end == '\0' && value <= UINT32_MAX;
+}
+
+bool ParseDouble(const char *aString, double &aValue)
+{
+    char *end;
+
+    aValue = strtod(aString, &end);
+
+    return *aString != '\0' && *end == '\0' && aValue >= 0;
+}
+
+} // namespace
+
+otError otBackboneRouterGetNdProxyInfo(otInstance *                 aInstance,
+                                       const otIp6Address *         aDua,
+                                       otBackboneRouterNdProxyInfo *aNdProxyInfo)
+{
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint32_t dua;
+
+    OTBR_UNUSED_VARIABLE(aInstance);
+
+    VerifyOrExit(GetDuaIndex(Ip6Address(aDua->mFields.m8), dua) && sIsDuaRegistered[dua]);
+
+    memset(aNdProxyInfo, 0, sizeof(*aNdProxyInfo));
+    error = OT_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    static const option kOptions[] = {
+        {"backbone-ifname", required_argument, nullptr, 'B'},
+        {"host-ifname", required_argument, nullptr, 'I'},
+        {"host-netns", required_argument, nullptr, 'N'},
+        {"duas", required_argument, nullptr, 'n'},
+        {"rate", required_argument, nullptr, 'r'},
+        {"duration", required_argument, nullptr, 'd'},
+        {"timeout", required_argument, nullptr, 't'},
+        {"max-p99", required_argument, nullptr, 'p'},
+        {"max-drop", required_argument, nullptr, 'D'},
+        {"verbose", no_argument, nullptr, 'v'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+    Options                  options;
+    std::vector<PhaseResult> results;
+    int                      opt;
+
+    while ((opt = getopt_long(argc, argv, "B:I:N:n:r:d:t:p:D:vh", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case 'B':
+            options.mBackboneIfName = optarg;
+            break;
+        case 'I':
+            options.mHostIfName = optarg;
+            break;
+        case 'N':
+            options.mHostNetns = optarg;
+            break;
+        case 'n':
+            valid = ParseUint32(optarg, options.mNumDuas) && options.mNumDuas > 0 && options.mNumDuas <= kMaxNumDuas;
+            break;
+        case 'r':
+            valid = ParseUint32(optarg, options.mRate);
+            break;
+        case 'd':
+            valid = ParseUint32(optarg, options.mDuration);
+            break;
+        case 't':
+            valid = ParseUint32(optarg, options.mTimeout);
+            break;
+        case 'p':
+            valid = ParseUint32(optarg, options.mMaxP99Latency);
+            break;
+        case 'D':
+            valid = ParseDouble(optarg, options.mMaxDropRate);
+            break;
+        case 'v':
+            options.mVerbose = true;
+            break;
+        case 'h':
+            PrintUsage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            valid = false;
+            break;
+        }
+
+        if (!valid)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.mBackboneIfName == nullptr || options.mHostIfName == nullptr)
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    otbrLogInit("otbr-nd-proxy-benchmark", options.mVerbose ? OTBR_LOG_DEBUG : OTBR_LOG_WARNING, true);
+
+    {
+        Benchmark benchmark(options);
+        otbrError error = benchmark.Run(results);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            fprintf(stderr, "Failed to start the ND Proxy manager: %s\n", otbrErrorString(error));
+            return EXIT_FAILURE;
+        }
+    }
+
+    return Report(options, results) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
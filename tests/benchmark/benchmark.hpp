@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a minimal microbenchmark harness.
+ */
+
+#ifndef OTBR_TESTS_BENCHMARK_BENCHMARK_HPP_
+#define OTBR_TESTS_BENCHMARK_BENCHMARK_HPP_
+
+#include <stdint.h>
+
+namespace otbr {
+namespace Benchmark {
+
+/**
+ * This class represents the state of one run of a benchmark.
+ *
+ * A benchmark repeats the measured code while `KeepRunning()` returns true.
+ *
+ */
+class State
+{
+public:
+    /**
+     * The constructor of a benchmark run.
+     *
+     * @param[in]  aIterations  The number of iterations of the run.
+     *
+     */
+    explicit State(uint64_t aIterations)
+        : mRemaining(aIterations)
+        , mBytesPerIteration(0)
+    {
+    }
+
+    /**
+     * This method indicates whether the measured code should run once more.
+     *
+     * @returns  Whether the measured code should run once more.
+     *
+     */
+    bool KeepRunning(void) { return mRemaining-- != 0; }
+
+    /**
+     * This method sets the number of bytes processed by each iteration, to report the throughput.
+     *
+     * @param[in]  aBytes  The number of bytes processed by each iteration.
+     *
+     */
+    void SetBytesPerIteration(uint64_t aBytes) { mBytesPerIteration = aBytes; }
+
+    /**
+     * This method returns the number of bytes processed by each iteration.
+     *
+     * @returns  The number of bytes processed by each iteration.
+     *
+     */
+    uint64_t GetBytesPerIteration(void) const { return mBytesPerIteration; }
+
+private:
+    uint64_t mRemaining;
+    uint64_t mBytesPerIteration;
+};
+
+typedef void (*Function)(State &aState);
+
+/**
+ * This class registers a benchmark at static initialization.
+ *
+ */
+class Registration
+{
+public:
+    /**
+     * The constructor registers a benchmark.
+     *
+     * @param[in]  aName      The name of the benchmark.
+     * @param[in]  aFunction  The benchmark function.
+     *
+     */
+    Registration(const char *aName, Function aFunction);
+};
+
+/**
+ * This function keeps the compiler from optimizing away the computation of a value.
+ *
+ * @param[in]  aValue  The value.
+ *
+ */
+template <typename T> inline void DoNotOptimize(const T &aValue)
+{
+    asm volatile("" : : "r,m"(aValue) : "memory");
+}
+
+} // namespace Benchmark
+} // namespace otbr
+
+/**
+ * This macro defines and registers a benchmark.
+ *
+ * @param[in]  aName  The name of the benchmark, which is also the name of the benchmark function.
+ *
+ */
+#define OTBR_BENCHMARK(aName)                                                   \
+    static void                          aName(otbr::Benchmark::State &aState); \
+    static otbr::Benchmark::Registration sRegistration##aName(#aName, aName);   \
+    static void                          aName(otbr::Benchmark::State &aState)
+
+#endif // OTBR_TESTS_BENCHMARK_BENCHMARK_HPP_
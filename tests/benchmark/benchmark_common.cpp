@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "common/dns_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+
+#include "benchmark.hpp"
+
+static const char kServiceInstanceName[] = "My Service Instance._meshcop._udp.default.service.arpa.";
+
+static void ProcessTasks(otbr::TaskRunner &aTaskRunner)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    aTaskRunner.Process(mainloop);
+}
+
+OTBR_BENCHMARK(TaskRunnerPostAndProcess)
+{
+    otbr::TaskRunner taskRunner;
+    uint64_t         counter = 0;
+
+    while (aState.KeepRunning())
+    {
+        taskRunner.Post([&counter]() { ++counter; });
+        ProcessTasks(taskRunner);
+    }
+
+    otbr::Benchmark::DoNotOptimize(counter);
+}
+
+OTBR_BENCHMARK(TaskRunnerPostBatchOf64)
+{
+    otbr::TaskRunner taskRunner;
+    uint64_t         counter = 0;
+
+    while (aState.KeepRunning())
+    {
+        for (int i = 0; i < 64; ++i)
+        {
+            taskRunner.Post([&counter]() { ++counter; });
+        }
+
+        ProcessTasks(taskRunner);
+    }
+
+    otbr::Benchmark::DoNotOptimize(counter);
+}
+
+OTBR_BENCHMARK(TaskRunnerPostDelayedAndCancel)
+{
+    otbr::TaskRunner taskRunner;
+
+    while (aState.KeepRunning())
+    {
+        taskRunner.Post(otbr::Milliseconds(1000), []() {}).Cancel();
+    }
+}
+
+OTBR_BENCHMARK(Ip6AddressToString)
+{
+    otbr::Ip6Address address;
+
+    otbr::Ip6Address::FromString("fd00:db8:0:0:0:ff:fe00:fc10", address);
+
+    while (aState.KeepRunning())
+    {
+        std::string string = address.ToString();
+
+        otbr::Benchmark::DoNotOptimize(string);
+    }
+}
+
+OTBR_BENCHMARK(Ip6AddressToStringBuffer)
+{
+    otbr::Ip6Address address;
+    char             buffer[otbr::Ip6Address::kStringSize];
+
+    otbr::Ip6Address::FromString("fd00:db8:0:0:0:ff:fe00:fc10", address);
+
+    while (aState.KeepRunning())
+    {
+        otbr::Benchmark::DoNotOptimize(address.ToString(buffer));
+    }
+}
+
+OTBR_BENCHMARK(DnsSplitFullDnsName)
+{
+    const std::string name = kServiceInstanceName;
+
+    aState.SetBytesPerIteration(name.size());
+
+    while (aState.KeepRunning())
+    {
+        DnsNameInfo info = SplitFullDnsName(name);
+
+        otbr::Benchmark::DoNotOptimize(info);
+    }
+}
+
+OTBR_BENCHMARK(DnsParseFullDnsName)
+{
+    aState.SetBytesPerIteration(sizeof(kServiceInstanceName) - 1);
+
+    while (aState.KeepRunning())
+    {
+        DnsNameParts parts = ParseFullDnsName(kServiceInstanceName);
+
+        otbr::Benchmark::DoNotOptimize(parts);
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/types.hpp"
+
+#include "benchmark.hpp"
+
+using otbr::DBus::ChildInfo;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::TupleToDBusMessage;
+
+static std::vector<ChildInfo> MakeChildTable(void)
+{
+    std::vector<ChildInfo> childTable(32);
+
+    for (size_t i = 0; i < childTable.size(); ++i)
+    {
+        childTable[i].mExtAddress = 0x18b4300000000000ull + i;
+        childTable[i].mTimeout    = 240;
+        childTable[i].mRloc16     = static_cast<uint16_t>(0x4000 + i + 1);
+        childTable[i].mChildId    = static_cast<uint16_t>(i + 1);
+    }
+
+    return childTable;
+}
+
+OTBR_BENCHMARK(DBusEncodeChildTable)
+{
+    std::tuple<std::vector<ChildInfo>> values(MakeChildTable());
+
+    while (aState.KeepRunning())
+    {
+        DBusMessage *message = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+        otbr::Benchmark::DoNotOptimize(TupleToDBusMessage(*message, values));
+        dbus_message_unref(message);
+    }
+}
+
+OTBR_BENCHMARK(DBusDecodeChildTable)
+{
+    std::tuple<std::vector<ChildInfo>> values(MakeChildTable());
+    DBusMessage *                      message = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+    TupleToDBusMessage(*message, values);
+
+    while (aState.KeepRunning())
+    {
+        std::tuple<std::vector<ChildInfo>> decoded;
+
+        otbr::Benchmark::DoNotOptimize(DBusMessageToTuple(*message, decoded));
+    }
+
+    dbus_message_unref(message);
+}
+
+OTBR_BENCHMARK(DBusEncodeDecodeBytesAndString)
+{
+    std::tuple<std::vector<uint8_t>, std::string> values(std::vector<uint8_t>(256, 0x5a), "OpenThread-1234");
+
+    aState.SetBytesPerIteration(std::get<0>(values).size() + std::get<1>(values).size());
+
+    while (aState.KeepRunning())
+    {
+        DBusMessage *                                 message = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        std::tuple<std::vector<uint8_t>, std::string> decoded;
+
+        TupleToDBusMessage(*message, values);
+        otbr::Benchmark::DoNotOptimize(DBusMessageToTuple(*message, decoded));
+        dbus_message_unref(message);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "rest/diag_record.hpp"
+#include "rest/json.hpp"
+
+#include "benchmark.hpp"
+
+using otbr::rest::DiagRecord;
+using otbr::rest::NodeInfo;
+
+namespace Json = otbr::rest::Json;
+
+static std::vector<DiagRecord> MakeDiagSet(void)
+{
+    std::vector<DiagRecord> diagSet(16);
+
+    for (size_t i = 0; i < diagSet.size(); ++i)
+    {
+        otNetworkDiagTlv tlv;
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+        memset(tlv.mData.mExtAddress.m8, static_cast<int>(i), sizeof(tlv.mData.mExtAddress.m8));
+        diagSet[i].Append(tlv);
+
+        tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+        tlv.mData.mAddr16 = static_cast<uint16_t>(i << 10);
+        diagSet[i].Append(tlv);
+
+        tlv.mType                          = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA;
+        tlv.mData.mLeaderData.mPartitionId = 0x12345678;
+        tlv.mData.mLeaderData.mWeighting   = 64;
+        diagSet[i].Append(tlv);
+
+        tlv.mType                                  = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+        tlv.mData.mMacCounters.mIfInUcastPkts      = static_cast<uint32_t>(1000 + i);
+        tlv.mData.mMacCounters.mIfOutUcastPkts     = static_cast<uint32_t>(2000 + i);
+        tlv.mData.mMacCounters.mIfInBroadcastPkts  = 300;
+        tlv.mData.mMacCounters.mIfOutBroadcastPkts = 400;
+        diagSet[i].Append(tlv);
+    }
+
+    return diagSet;
+}
+
+static NodeInfo MakeNodeInfo(void)
+{
+    static const uint8_t kExtPanId[]   = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+    static const uint8_t kExtAddress[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+    NodeInfo             node;
+
+    memset(&node.mRlocAddress, 0, sizeof(node.mRlocAddress));
+    memset(&node.mLeaderData, 0, sizeof(node.mLeaderData));
+    node.mRole        = 4;
+    node.mNumOfRouter = 3;
+    node.mRloc16      = 0x4400;
+    node.mExtPanId    = kExtPanId;
+    node.mExtAddress  = kExtAddress;
+    node.mNetworkName = "OpenThread-1234";
+
+    return node;
+}
+
+OTBR_BENCHMARK(JsonNumber2JsonString)
+{
+    uint32_t number = 0;
+
+    while (aState.KeepRunning())
+    {
+        std::string string = Json::Number2JsonString(number++);
+
+        otbr::Benchmark::DoNotOptimize(string);
+    }
+}
+
+OTBR_BENCHMARK(JsonNode2JsonString)
+{
+    NodeInfo node = MakeNodeInfo();
+
+    while (aState.KeepRunning())
+    {
+        std::string string = Json::Node2JsonString(node);
+
+        otbr::Benchmark::DoNotOptimize(string);
+    }
+}
+
+OTBR_BENCHMARK(JsonDiag2JsonString)
+{
+    std::vector<DiagRecord> diagSet = MakeDiagSet();
+
+    while (aState.KeepRunning())
+    {
+        std::string string = Json::Diag2JsonString(diagSet);
+
+        otbr::Benchmark::DoNotOptimize(string);
+    }
+}
+
+OTBR_BENCHMARK(CborDiag2JsonString)
+{
+    std::vector<DiagRecord> diagSet = MakeDiagSet();
+
+    Json::SetFormat(otbr::JsonWriter::kFormatCbor);
+
+    while (aState.KeepRunning())
+    {
+        std::string string = Json::Diag2JsonString(diagSet);
+
+        otbr::Benchmark::DoNotOptimize(string);
+    }
+
+    Json::SetFormat(otbr::JsonWriter::kFormatJson);
+}
@@ -0,0 +1,145 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+
+#include "benchmark.hpp"
+
+using otbr::rest::Parser;
+using otbr::rest::Request;
+
+static const char kRequest[] = "GET /node/rloc16 HTTP/1.1\r\n"
+                               "Host: [fd00::1]:8081\r\n"
+                               "User-Agent: otbr-benchmark\r\n"
+                               "Accept: application/json\r\n"
+                               "\r\n";
+
+static const char kPostRequest[] = "POST /node/dataset/active HTTP/1.1\r\n"
+                                   "Host: [fd00::1]:8081\r\n"
+                                   "Content-Type: application/json\r\n"
+                                   "Content-Length: 59\r\n"
+                                   "\r\n"
+                                   "{\"NetworkName\":\"OpenThread-1234\",\"Channel\":15,\"PanId\":4660}";
+
+static std::string MakePipelinedInput(void)
+{
+    std::string input;
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        input += kRequest;
+        input += kPostRequest;
+    }
+
+    return input;
+}
+
+/**
+ * This function parses requests the way a Rest Server connection does, feeding the input in fragments and resuming
+ * the parser after each complete request.
+ *
+ * @param[in]  aInput         The received input.
+ * @param[in]  aFragmentSize  The max number of bytes fed to the parser at a time.
+ *
+ * @returns  The number of complete requests.
+ *
+ */
+static size_t ParseRequests(const std::string &aInput, size_t aFragmentSize)
+{
+    Request     request;
+    Parser      parser(&request);
+    std::string pending;
+    size_t      count = 0;
+
+    parser.Init();
+
+    for (size_t offset = 0; offset < aInput.size(); offset += aFragmentSize)
+    {
+        pending.append(aInput, offset, aFragmentSize);
+
+        while (!pending.empty())
+        {
+            size_t parsed = parser.Process(pending.data(), pending.size());
+
+            if (!request.IsComplete())
+            {
+                pending.clear();
+                break;
+            }
+
+            ++count;
+            otbr::Benchmark::DoNotOptimize(request.GetUrl());
+            otbr::Benchmark::DoNotOptimize(request.GetBody());
+            pending.erase(0, parsed);
+            request.Reset();
+            parser.Resume();
+        }
+    }
+
+    return count;
+}
+
+OTBR_BENCHMARK(RestParserSingle)
+{
+    std::string input = kPostRequest;
+
+    while (aState.KeepRunning())
+    {
+        otbr::Benchmark::DoNotOptimize(ParseRequests(input, input.size()));
+    }
+
+    aState.SetBytesPerIteration(input.size());
+}
+
+OTBR_BENCHMARK(RestParserPipelined)
+{
+    std::string input = MakePipelinedInput();
+
+    while (aState.KeepRunning())
+    {
+        otbr::Benchmark::DoNotOptimize(ParseRequests(input, input.size()));
+    }
+
+    aState.SetBytesPerIteration(input.size());
+}
+
+OTBR_BENCHMARK(RestParserFragmented)
+{
+    std::string input = MakePipelinedInput();
+
+    while (aState.KeepRunning())
+    {
+        // Splits headers and bodies at odd places, like a slow client over a lossy link.
+        otbr::Benchmark::DoNotOptimize(ParseRequests(input, 7));
+    }
+
+    aState.SetBytesPerIteration(input.size());
+}
@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "utils/crc16.hpp"
+#include "utils/hex.hpp"
+#include "utils/pskc.hpp"
+#include "utils/steering_data.hpp"
+
+#include "benchmark.hpp"
+
+static const uint8_t kExtPanId[]    = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+static const char    kNetworkName[] = "OpenThread-1234";
+
+OTBR_BENCHMARK(UtilsBytes2Hex)
+{
+    uint8_t bytes[64];
+    char    hex[sizeof(bytes) * 2 + 1];
+
+    for (size_t i = 0; i < sizeof(bytes); ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 37);
+    }
+
+    aState.SetBytesPerIteration(sizeof(bytes));
+
+    while (aState.KeepRunning())
+    {
+        otbr::Benchmark::DoNotOptimize(otbr::Utils::Bytes2Hex(bytes, sizeof(bytes), hex));
+    }
+}
+
+OTBR_BENCHMARK(UtilsHex2Bytes)
+{
+    const char hex[] = "00112233445566778899aabbccddeeff00112233445566778899aabbccddeeff";
+    uint8_t    bytes[sizeof(hex) / 2];
+
+    aState.SetBytesPerIteration(sizeof(hex) - 1);
+
+    while (aState.KeepRunning())
+    {
+        otbr::Benchmark::DoNotOptimize(otbr::Utils::Hex2Bytes(hex, bytes, sizeof(bytes)));
+    }
+}
+
+OTBR_BENCHMARK(Crc16Ccitt1280Bytes)
+{
+    otbr::Crc16 crc(otbr::Crc16::kCcitt);
+    uint8_t     frame[1280];
+
+    memset(frame, 0x5a, sizeof(frame));
+    aState.SetBytesPerIteration(sizeof(frame));
+
+    while (aState.KeepRunning())
+    {
+        crc.Init();
+        crc.Update(frame, sizeof(frame));
+        otbr::Benchmark::DoNotOptimize(crc.Get());
+    }
+}
+
+OTBR_BENCHMARK(SteeringDataComputeBloomFilter)
+{
+    otbr::SteeringData steeringData;
+    uint8_t            eui64[8] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+    uint8_t            joinerId[8];
+
+    otbr::SteeringData::ComputeJoinerId(eui64, joinerId);
+    steeringData.Init(16);
+
+    while (aState.KeepRunning())
+    {
+        steeringData.ComputeBloomFilter(joinerId);
+        otbr::Benchmark::DoNotOptimize(steeringData.GetBloomFilter()[0]);
+    }
+}
+
+OTBR_BENCHMARK(SteeringDataComputeJoinerId)
+{
+    uint8_t eui64[8] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+    uint8_t joinerId[8];
+
+    while (aState.KeepRunning())
+    {
+        otbr::SteeringData::ComputeJoinerId(eui64, joinerId);
+        otbr::Benchmark::DoNotOptimize(joinerId[0]);
+    }
+}
+
+OTBR_BENCHMARK(PskcComputeCached)
+{
+    otbr::Psk::Pskc pskc;
+
+    while (aState.KeepRunning())
+    {
+        otbr::Benchmark::DoNotOptimize(pskc.ComputePskc(kExtPanId, kNetworkName, "123456"));
+    }
+}
+
+OTBR_BENCHMARK(PskcComputeUncached)
+{
+    otbr::Psk::Pskc pskc;
+    unsigned        counter = 0;
+    char            passphrase[16];
+
+    while (aState.KeepRunning())
+    {
+        // A different passphrase each time runs the key derivation.
+        snprintf(passphrase, sizeof(passphrase), "pass%u", counter++);
+        otbr::Benchmark::DoNotOptimize(pskc.ComputePskc(kExtPanId, kNetworkName, passphrase));
+    }
+}
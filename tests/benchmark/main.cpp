@@ -0,0 +1,252 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the runner of the microbenchmarks.
+ *
+ * Each benchmark is calibrated to run for at least the min time, then repeated. The median, min and max time per
+ * iteration of the repetitions are reported, as text or as JSON for comparing builds.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+
+namespace otbr {
+namespace Benchmark {
+
+namespace {
+
+struct Entry
+{
+    const char *mName;
+    Function    mFunction;
+};
+
+struct Result
+{
+    const char *mName;
+    uint64_t    mIterations;
+    double      mMedianNs;
+    double      mMinNs;
+    double      mMaxNs;
+    double      mBytesPerSecond;
+};
+
+std::vector<Entry> &GetEntries(void)
+{
+    static std::vector<Entry> sEntries;
+
+    return sEntries;
+}
+
+double RunOnce(Function aFunction, uint64_t aIterations, uint64_t &aBytesPerIteration)
+{
+    State state(aIterations);
+    auto  start = std::chrono::steady_clock::now();
+
+    aFunction(state);
+    aBytesPerIteration = state.GetBytesPerIteration();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+Result Run(const Entry &aEntry, double aMinTime, unsigned aRepetitions)
+{
+    Result              result;
+    uint64_t            iterations = 1;
+    uint64_t            bytesPerIteration;
+    double              elapsed;
+    std::vector<double> times;
+
+    // Grow the number of iterations until a run takes the min time, predicting from the last run.
+    while ((elapsed = RunOnce(aEntry.mFunction, iterations, bytesPerIteration)) < aMinTime &&
+           iterations < (UINT64_C(1) << 40))
+    {
+        double scale = elapsed > 0 ? aMinTime * 1.4 / elapsed : 10;
+
+        iterations = static_cast<uint64_t>(iterations * std::min(std::max(scale, 2.0), 10.0));
+    }
+
+    for (unsigned i = 0; i < aRepetitions; ++i)
+    {
+        times.push_back(RunOnce(aEntry.mFunction, iterations, bytesPerIteration) * 1e9 / iterations);
+    }
+
+    std::sort(times.begin(), times.end());
+
+    result.mName           = aEntry.mName;
+    result.mIterations     = iterations;
+    result.mMedianNs       = times[times.size() / 2];
+    result.mMinNs          = times.front();
+    result.mMaxNs          = times.back();
+    result.mBytesPerSecond = bytesPerIteration * 1e9 / result.mMedianNs;
+
+    return result;
+}
+
+void PrintText(const std::vector<Result> &aResults)
+{
+    printf("%-40s %14s %14s %14s %12s %14s\n", "benchmark", "median(ns)", "min(ns)", "max(ns)", "iterations",
+           "bytes/s");
+
+    for (const Result &result : aResults)
+    {
+        printf("%-40s %14.1f %14.1f %14.1f %12llu %14.0f\n", result.mName, result.mMedianNs, result.mMinNs,
+               result.mMaxNs, static_cast<unsigned long long>(result.mIterations), result.mBytesPerSecond);
+    }
+}
+
+void PrintJson(const std::vector<Result> &aResults, double aMinTime, unsigned aRepetitions)
+{
+    char   date[32];
+    char   hostName[64] = "";
+    time_t now          = time(nullptr);
+
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+    gethostname(hostName, sizeof(hostName) - 1);
+
+    printf("{\n  \"context\": {\n");
+    printf("    \"date\": \"%s\",\n", date);
+    printf("    \"host_name\": \"%s\",\n", hostName);
+    printf("    \"num_cpus\": %ld,\n", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("    \"min_time\": %g,\n", aMinTime);
+    printf("    \"repetitions\": %u\n", aRepetitions);
+    printf("  },\n  \"benchmarks\": [");
+
+    for (size_t i = 0; i < aResults.size(); ++i)
+    {
+        const Result &result = aResults[i];
+
+        printf("%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"real_time\": %.3f, \"min_real_time\": %.3f, "
+               "\"max_real_time\": %.3f, \"time_unit\": \"ns\", \"bytes_per_second\": %.0f}",
+               i == 0 ? "" : ",", result.mName, static_cast<unsigned long long>(result.mIterations), result.mMedianNs,
+               result.mMinNs, result.mMaxNs, result.mBytesPerSecond);
+    }
+
+    printf("\n  ]\n}\n");
+}
+
+void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [--filter=SUBSTRING] [--min-time=SECONDS] [--repetitions=COUNT] [--format=text|json] "
+            "[--list]\n",
+            aProgram);
+}
+
+} // namespace
+
+Registration::Registration(const char *aName, Function aFunction)
+{
+    GetEntries().push_back({aName, aFunction});
+}
+
+} // namespace Benchmark
+} // namespace otbr
+
+int main(int argc, char *argv[])
+{
+    using namespace otbr::Benchmark;
+
+    const char *        filter      = "";
+    double              minTime     = 0.5;
+    unsigned            repetitions = 5;
+    bool                json        = false;
+    bool                list        = false;
+    std::vector<Result> results;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "--filter=", 9) == 0)
+        {
+            filter = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--min-time=", 11) == 0)
+        {
+            minTime = atof(argv[i] + 11);
+        }
+        else if (strncmp(argv[i], "--repetitions=", 14) == 0)
+        {
+            repetitions = std::max(1, atoi(argv[i] + 14));
+        }
+        else if (strcmp(argv[i], "--format=json") == 0)
+        {
+            json = true;
+        }
+        else if (strcmp(argv[i], "--format=text") == 0)
+        {
+            json = false;
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            list = true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::sort(GetEntries().begin(), GetEntries().end(),
+              [](const Entry &aLhs, const Entry &aRhs) { return strcmp(aLhs.mName, aRhs.mName) < 0; });
+
+    for (const Entry &entry : GetEntries())
+    {
+        if (strstr(entry.mName, filter) == nullptr)
+        {
+            continue;
+        }
+
+        if (list)
+        {
+            printf("%s\n", entry.mName);
+            continue;
+        }
+
+        results.push_back(Run(entry, minTime, repetitions));
+    }
+
+    if (!list)
+    {
+        json ? PrintJson(results, minTime, repetitions) : PrintText(results);
+    }
+
+    return EXIT_SUCCESS;
+}
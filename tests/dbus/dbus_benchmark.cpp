@@ -0,0 +1,800 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a throughput and latency benchmark of the d-bus server and client.
+ *
+ * The benchmark runs a `DBusAgent` with a simulated radio on the bus given by `DBUS_SYSTEM_BUS_ADDRESS`, so that a
+ * private bus can be used. It reports the QPS and latencies of property reads, with plain, pipelined, cached and
+ * bulk calls, the latencies of method calls, the latencies of delivering a signal to a number of subscribers and
+ * the throughput of encoding and decoding large types.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <dbus/dbus.h>
+#include <openthread/instance.h>
+#include <openthread/openthread-system.h>
+#include <openthread/platform/misc.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "dbus/client/thread_api_dbus.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/server/dbus_agent.hpp"
+#include "dbus/server/dbus_object.hpp"
+
+using namespace otbr;
+using namespace otbr::DBus;
+
+namespace {
+
+constexpr uint32_t kVectorSize = 64 * 1024; // Bytes of the byte vector encoded and decoded.
+
+struct Options
+{
+    const char *mInterfaceName = "wpan0";
+    const char *mRadioUrl      = nullptr;
+    uint32_t    mClients       = 4;   // Client connections of the property and method phases.
+    uint32_t    mWindow        = 16;  // Outstanding calls per client of the pipelined phase.
+    uint32_t    mSubscribers   = 16;  // Subscriber connections of the signal phase.
+    uint32_t    mSignals       = 200; // Signals sent in the signal phase.
+    uint32_t    mEntries       = 511; // Child entries encoded and decoded.
+    uint32_t    mDuration      = 3;   // Seconds of a phase.
+    uint32_t    mMaxP99Latency = 0;   // Milliseconds, zero means no limit.
+    bool        mVerbose       = false;
+};
+
+struct PhaseResult
+{
+    std::string               mName;
+    uint64_t                  mRequests = 0;
+    uint64_t                  mErrors   = 0;
+    uint64_t                  mBytes    = 0; // Bytes encoded or decoded.
+    std::vector<Microseconds> mLatencies;
+    Microseconds              mWallTime{0};
+
+    void Merge(const PhaseResult &aResult)
+    {
+        mRequests += aResult.mRequests;
+        mErrors += aResult.mErrors;
+        mBytes += aResult.mBytes;
+        mLatencies.insert(mLatencies.end(), aResult.mLatencies.begin(), aResult.mLatencies.end());
+    }
+};
+
+struct DBusConnectionDeleter
+{
+    void operator()(DBusConnection *aConnection)
+    {
+        dbus_connection_close(aConnection);
+        dbus_connection_unref(aConnection);
+    }
+};
+
+using UniqueDBusConnection = std::unique_ptr<DBusConnection, DBusConnectionDeleter>;
+
+Microseconds GetElapsed(Timepoint aStart)
+{
+    return std::chrono::duration_cast<Microseconds>(Clock::now() - aStart);
+}
+
+UniqueDBusConnection NewConnection(void)
+{
+    DBusError      error;
+    DBusConnection *connection;
+
+    dbus_error_init(&error);
+    connection = dbus_bus_get_private(DBUS_BUS_SYSTEM, &error);
+
+    if (connection == nullptr)
+    {
+        fprintf(stderr, "Failed to connect to the bus: %s\n", error.message);
+    }
+    else
+    {
+        dbus_connection_set_exit_on_disconnect(connection, false);
+    }
+
+    dbus_error_free(&error);
+
+    return UniqueDBusConnection(connection);
+}
+
+/**
+ * This class runs the NCP controller and the d-bus agent on their own thread.
+ *
+ */
+class Server
+{
+public:
+    explicit Server(const Options &aOptions)
+        : mNcp(aOptions.mInterfaceName, {aOptions.mRadioUrl}, "")
+        , mDBusAgent(aOptions.mInterfaceName, &mNcp)
+        , mStopped(false)
+    {
+    }
+
+    ~Server(void) { Stop(); }
+
+    otbrError Start(void)
+    {
+        otbrError error;
+
+        SuccessOrExit(error = mNcp.Init());
+        SuccessOrExit(error = mDBusAgent.Init());
+
+        MainloopManager::GetInstance().AddMainloopProcessor(&mNcp, "ncp");
+        MainloopManager::GetInstance().AddMainloopProcessor(&mDBusAgent, "dbus");
+        mThread = std::thread(&Server::Run, this);
+
+    exit:
+        return error;
+    }
+
+    void Stop(void)
+    {
+        VerifyOrExit(mThread.joinable());
+
+        mStopped = true;
+        mThread.join();
+        MainloopManager::GetInstance().RemoveMainloopProcessor(&mDBusAgent);
+        MainloopManager::GetInstance().RemoveMainloopProcessor(&mNcp);
+
+    exit:
+        return;
+    }
+
+private:
+    void Run(void)
+    {
+        MainloopManager &mainloopManager = MainloopManager::GetInstance();
+
+        while (!mStopped)
+        {
+            MainloopContext mainloop;
+
+            mainloop.mMaxFd   = -1;
+            mainloop.mTimeout = {0, 100 * 1000}; // Wakes up regularly to check whether to stop.
+
+            FD_ZERO(&mainloop.mReadFdSet);
+            FD_ZERO(&mainloop.mWriteFdSet);
+            FD_ZERO(&mainloop.mErrorFdSet);
+
+            mainloopManager.Update(mainloop);
+
+            if (mainloopManager.Poll(mainloop) >= 0)
+            {
+                mainloopManager.Process(mainloop);
+            }
+            else if (errno != EINTR)
+            {
+                otbrLogErr("Failed to poll the mainloop: %s", strerror(errno));
+                break;
+            }
+        }
+    }
+
+    Ncp::ControllerOpenThread mNcp;
+    DBusAgent                 mDBusAgent;
+    std::atomic<bool>         mStopped;
+    std::thread               mThread;
+};
+
+/**
+ * This class sends the signals of the signal phase, as the d-bus agent would send a property change.
+ *
+ */
+class SignalSender : public DBusObject
+{
+public:
+    explicit SignalSender(DBusConnection *aConnection)
+        : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX "benchmark")
+        , mConnection(aConnection)
+    {
+    }
+
+    void Send(const std::string &aRoleName)
+    {
+        SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE, aRoleName);
+        FlushPropertyChangedSignals();
+        dbus_connection_flush(mConnection);
+    }
+
+private:
+    DBusConnection *mConnection;
+};
+
+class Benchmark
+{
+public:
+    explicit Benchmark(const Options &aOptions)
+        : mOptions(aOptions)
+    {
+    }
+
+    otbrError Run(std::vector<PhaseResult> &aResults);
+
+private:
+    using ClientTask = std::function<void(ThreadApiDBus &aApi, DBusConnection &aConnection, PhaseResult &aResult)>;
+
+    void RunClients(PhaseResult &aResult, const char *aName, const ClientTask &aTask);
+    void RunSignals(PhaseResult &aResult);
+    void RunCodec(PhaseResult &aResult, const char *aName, uint64_t aBytes, const std::function<bool(void)> &aTask);
+    bool IsRunning(void) const { return Clock::now() < mDeadline; }
+
+    template <typename Function> void Measure(PhaseResult &aResult, Function aFunction)
+    {
+        Timepoint start = Clock::now();
+
+        if (aFunction() != ClientError::ERROR_NONE)
+        {
+            ++aResult.mErrors;
+        }
+
+        aResult.mLatencies.push_back(GetElapsed(start));
+        ++aResult.mRequests;
+    }
+
+    void GetPipelined(ThreadApiDBus &aApi, DBusConnection &aConnection, PhaseResult &aResult) const;
+
+    const Options &mOptions;
+    Timepoint      mDeadline;
+};
+
+void Benchmark::RunClients(PhaseResult &aResult, const char *aName, const ClientTask &aTask)
+{
+    std::vector<PhaseResult> results(mOptions.mClients);
+    std::vector<std::thread> clients;
+    Timepoint                start = Clock::now();
+
+    aResult.mName = aName;
+    mDeadline     = start + std::chrono::seconds(mOptions.mDuration);
+
+    for (PhaseResult &result : results)
+    {
+        clients.emplace_back([this, &aTask, &result]() {
+            UniqueDBusConnection connection = NewConnection();
+
+            if (connection == nullptr)
+            {
+                ++result.mErrors;
+            }
+            else
+            {
+                ThreadApiDBus api(connection.get(), mOptions.mInterfaceName);
+
+                aTask(api, *connection, result);
+            }
+        });
+    }
+
+    for (size_t i = 0; i < clients.size(); i++)
+    {
+        clients[i].join();
+        aResult.Merge(results[i]);
+    }
+
+    aResult.mWallTime = GetElapsed(start);
+}
+
+void Benchmark::GetPipelined(ThreadApiDBus &aApi, DBusConnection &aConnection, PhaseResult &aResult) const
+{
+    uint32_t outstanding = 0;
+
+    // The latency of a call is measured from sending the request to handling the reply.
+    while (IsRunning() || outstanding > 0)
+    {
+        while (IsRunning() && outstanding < mOptions.mWindow)
+        {
+            Timepoint   start = Clock::now();
+            ClientError error;
+
+            error = aApi.GetPropertyAsync<uint16_t>(
+                OTBR_DBUS_PROPERTY_RLOC16, [&aResult, &outstanding, start](ClientError aError, const uint16_t &) {
+                    aResult.mLatencies.push_back(GetElapsed(start));
+                    aResult.mErrors += (aError != ClientError::ERROR_NONE);
+                    --outstanding;
+                });
+
+            ++aResult.mRequests;
+
+            if (error != ClientError::ERROR_NONE)
+            {
+                ++aResult.mErrors;
+                break;
+            }
+
+            ++outstanding;
+        }
+
+        if (!dbus_connection_read_write_dispatch(&aConnection, 100))
+        {
+            aResult.mErrors += outstanding;
+            break;
+        }
+    }
+}
+
+void Benchmark::RunSignals(PhaseResult &aResult)
+{
+    UniqueDBusConnection     connection = NewConnection();
+    std::atomic<uint32_t>    received(0);
+    std::atomic<uint32_t>    subscribed(0);
+    std::atomic<bool>        stopped(false);
+    std::vector<std::thread> subscribers;
+    Timepoint                start = Clock::now();
+
+    aResult.mName = "signal";
+    VerifyOrExit(connection != nullptr, ++aResult.mErrors);
+
+    for (uint32_t i = 0; i < mOptions.mSubscribers; i++)
+    {
+        subscribers.emplace_back([this, &received, &subscribed, &stopped]() {
+            UniqueDBusConnection subscriberConnection = NewConnection();
+
+            VerifyOrExit(subscriberConnection != nullptr);
+
+            {
+                ThreadApiDBus api(subscriberConnection.get(), mOptions.mInterfaceName);
+
+                api.AddDeviceRoleHandler([&received](DeviceRole) { ++received; });
+                ++subscribed;
+
+                while (!stopped && dbus_connection_read_write_dispatch(subscriberConnection.get(), 10))
+                {
+                }
+            }
+
+        exit:
+            return;
+        });
+    }
+
+    mDeadline = Clock::now() + std::chrono::seconds(mOptions.mDuration);
+
+    while (subscribed < mOptions.mSubscribers && IsRunning())
+    {
+        std::this_thread::sleep_for(Milliseconds(1));
+    }
+
+    {
+        SignalSender sender(connection.get());
+
+        VerifyOrExit(sender.Init() == OTBR_ERROR_NONE, ++aResult.mErrors);
+        start = Clock::now();
+
+        for (uint32_t i = 0; i < mOptions.mSignals; i++)
+        {
+            Timepoint signalStart = Clock::now();
+            uint32_t  expected    = (i + 1) * mOptions.mSubscribers;
+
+            // The role alternates so that every signal is a real change.
+            sender.Send(i % 2 ? OTBR_ROLE_NAME_ROUTER : OTBR_ROLE_NAME_LEADER);
+            mDeadline = signalStart + std::chrono::seconds(mOptions.mDuration);
+
+            while (received < expected && IsRunning())
+            {
+                std::this_thread::yield();
+            }
+
+            ++aResult.mRequests;
+
+            if (received < expected)
+            {
+                ++aResult.mErrors;
+                break;
+            }
+
+            aResult.mLatencies.push_back(GetElapsed(signalStart));
+        }
+    }
+
+exit:
+    aResult.mWallTime = GetElapsed(start);
+    stopped           = true;
+
+    for (std::thread &subscriber : subscribers)
+    {
+        subscriber.join();
+    }
+}
+
+void Benchmark::RunCodec(PhaseResult &                   aResult,
+                         const char *                    aName,
+                         uint64_t                        aBytes,
+                         const std::function<bool(void)> &aTask)
+{
+    Timepoint start = Clock::now();
+
+    aResult.mName = aName;
+    mDeadline     = start + std::chrono::seconds(mOptions.mDuration);
+
+    while (IsRunning())
+    {
+        Timepoint taskStart = Clock::now();
+        bool      succeeded = aTask();
+
+        aResult.mLatencies.push_back(GetElapsed(taskStart));
+        ++aResult.mRequests;
+        aResult.mErrors += !succeeded;
+        aResult.mBytes += aBytes;
+    }
+
+    aResult.mWallTime = GetElapsed(start);
+}
+
+uint64_t GetMessageSize(DBusMessage &aMessage)
+{
+    char *data;
+    int   length;
+
+    VerifyOrExit(dbus_message_marshal(&aMessage, &data, &length), length = 0);
+    dbus_free(data);
+
+exit:
+    return static_cast<uint64_t>(length);
+}
+
+template <typename ValueType> bool Encode(const ValueType &aValue)
+{
+    UniqueDBusMessage message(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+
+    return message != nullptr && TupleToDBusMessage(*message, std::tie(aValue)) == OTBR_ERROR_NONE;
+}
+
+template <typename ValueType> bool Decode(DBusMessage &aMessage)
+{
+    ValueType value;
+    auto      args = std::tie(value);
+
+    return DBusMessageToTuple(aMessage, args) == OTBR_ERROR_NONE;
+}
+
+otbrError Benchmark::Run(std::vector<PhaseResult> &aResults)
+{
+    otbrError              error = OTBR_ERROR_NONE;
+    Server                 server(mOptions);
+    std::vector<ChildInfo> children(mOptions.mEntries);
+    std::vector<uint8_t>   bytes(kVectorSize);
+    UniqueDBusMessage      childrenMessage(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+    UniqueDBusMessage      bytesMessage(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+    uint64_t               childrenSize;
+    uint64_t               bytesSize;
+
+    aResults.resize(12);
+
+    // Encoding and decoding don't need the bus, they run first so that the server doesn't compete for the CPU.
+    for (uint32_t i = 0; i < mOptions.mEntries; i++)
+    {
+        children[i].mExtAddress = i;
+        children[i].mRloc16     = static_cast<uint16_t>(i);
+    }
+
+    VerifyOrExit(childrenMessage != nullptr && bytesMessage != nullptr, error = OTBR_ERROR_DBUS);
+    SuccessOrExit(error = TupleToDBusMessage(*childrenMessage, std::tie(children)));
+    SuccessOrExit(error = TupleToDBusMessage(*bytesMessage, std::tie(bytes)));
+    childrenSize = GetMessageSize(*childrenMessage);
+    bytesSize    = GetMessageSize(*bytesMessage);
+
+    RunCodec(aResults[0], "enc-child", childrenSize, [&children]() { return Encode(children); });
+    RunCodec(aResults[1], "dec-child", childrenSize,
+             [&childrenMessage]() { return Decode<std::vector<ChildInfo>>(*childrenMessage); });
+    RunCodec(aResults[2], "enc-bytes", bytesSize, [&bytes]() { return Encode(bytes); });
+    RunCodec(aResults[3], "dec-bytes", bytesSize,
+             [&bytesMessage]() { return Decode<std::vector<uint8_t>>(*bytesMessage); });
+
+    SuccessOrExit(error = server.Start());
+
+    RunClients(aResults[4], "get", [this](ThreadApiDBus &aApi, DBusConnection &, PhaseResult &aResult) {
+        uint16_t rloc16;
+
+        while (IsRunning())
+        {
+            Measure(aResult, [&aApi, &rloc16]() { return aApi.GetRloc16(rloc16); });
+        }
+    });
+
+    RunClients(aResults[5], "get-async", [this](ThreadApiDBus &aApi, DBusConnection &aConn, PhaseResult &aResult) {
+        GetPipelined(aApi, aConn, aResult);
+    });
+
+    RunClients(aResults[6], "get-cached", [this](ThreadApiDBus &aApi, DBusConnection &, PhaseResult &aResult) {
+        uint16_t rloc16;
+
+        aApi.SetPropertyCacheEnabled(true, Milliseconds(1000));
+
+        while (IsRunning())
+        {
+            Measure(aResult, [&aApi, &rloc16]() { return aApi.GetRloc16(rloc16); });
+        }
+    });
+
+    // One bulk call reads four properties.
+    RunClients(aResults[7], "get-bulk", [this](ThreadApiDBus &aApi, DBusConnection &, PhaseResult &aResult) {
+        uint16_t    rloc16;
+        uint16_t    panId;
+        uint8_t     routerId;
+        std::string networkName;
+
+        while (IsRunning())
+        {
+            Measure(aResult, [&]() {
+                return aApi.GetProperties({OTBR_DBUS_PROPERTY_RLOC16, OTBR_DBUS_PROPERTY_PANID,
+                                           OTBR_DBUS_PROPERTY_ROUTER_ID, OTBR_DBUS_PROPERTY_NETWORK_NAME},
+                                          rloc16, panId, routerId, networkName);
+            });
+        }
+    });
+
+    RunClients(aResults[8], "introspect", [this](ThreadApiDBus &, DBusConnection &aConnection, PhaseResult &aResult) {
+        std::string objectPath = std::string(OTBR_DBUS_OBJECT_PREFIX) + mOptions.mInterfaceName;
+        std::string serverName = std::string(OTBR_DBUS_SERVER_PREFIX) + mOptions.mInterfaceName;
+
+        while (IsRunning())
+        {
+            Measure(aResult, [&]() {
+                UniqueDBusMessage message(dbus_message_new_method_call(
+                    serverName.c_str(), objectPath.c_str(), DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD));
+                UniqueDBusMessage reply;
+
+                VerifyOrExit(message != nullptr);
+                reply = UniqueDBusMessage(dbus_connection_send_with_reply_and_block(
+                    &aConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, nullptr));
+
+            exit:
+                return (reply != nullptr && dbus_message_get_type(reply.get()) == DBUS_MESSAGE_TYPE_METHOD_RETURN)
+                           ? ClientError::ERROR_NONE
+                           : ClientError::ERROR_DBUS;
+            });
+        }
+    });
+
+    RunClients(aResults[9], "child-page", [this](ThreadApiDBus &aApi, DBusConnection &, PhaseResult &aResult) {
+        std::vector<ChildInfo> page;
+        uint16_t               total;
+
+        while (IsRunning())
+        {
+            Measure(aResult, [&]() { return aApi.GetChildTablePage(0, 64, page, total); });
+        }
+    });
+
+    RunClients(aResults[10], "child-table", [this](ThreadApiDBus &aApi, DBusConnection &, PhaseResult &aResult) {
+        std::vector<ChildInfo> childTable;
+
+        while (IsRunning())
+        {
+            Measure(aResult, [&]() { return aApi.GetChildTable(childTable); });
+        }
+    });
+
+    RunSignals(aResults[11]);
+
+exit:
+    return error;
+}
+
+Microseconds GetPercentile(const std::vector<Microseconds> &aSorted, uint32_t aPercent)
+{
+    // The nearest-rank percentile.
+    size_t rank = (aSorted.size() * aPercent + 99) / 100;
+
+    return aSorted.empty() ? Microseconds(0) : aSorted[std::max<size_t>(rank, 1) - 1];
+}
+
+double ToMilliseconds(Microseconds aTime)
+{
+    return aTime.count() / 1000.0;
+}
+
+bool Report(const Options &aOptions, std::vector<PhaseResult> &aResults)
+{
+    bool passed = true;
+
+    printf("D-Bus benchmark: %u clients, %u pipelined calls per client, %u subscribers, %u child entries\n",
+           aOptions.mClients, aOptions.mWindow, aOptions.mSubscribers, aOptions.mEntries);
+    printf("%-11s %9s %7s %10s %9s %9s %9s %9s %10s %9s\n", "phase", "requests", "errors", "qps", "p50(ms)",
+           "p90(ms)", "p99(ms)", "max(ms)", "wall(ms)", "MB/s");
+
+    for (PhaseResult &result : aResults)
+    {
+        double       seconds = result.mWallTime.count() / 1e6;
+        Microseconds p99;
+
+        std::sort(result.mLatencies.begin(), result.mLatencies.end());
+        p99 = GetPercentile(result.mLatencies, 99);
+
+        printf("%-11s %9" PRIu64 " %7" PRIu64 " %10.1f %9.3f %9.3f %9.3f %9.3f %10.3f %9.1f\n", result.mName.c_str(),
+               result.mRequests, result.mErrors, seconds > 0 ? result.mRequests / seconds : 0,
+               ToMilliseconds(GetPercentile(result.mLatencies, 50)),
+               ToMilliseconds(GetPercentile(result.mLatencies, 90)), ToMilliseconds(p99),
+               ToMilliseconds(result.mLatencies.empty() ? Microseconds(0) : result.mLatencies.back()),
+               ToMilliseconds(result.mWallTime), seconds > 0 ? result.mBytes / seconds / 1e6 : 0);
+
+        if (result.mErrors > 0)
+        {
+            passed = false;
+        }
+
+        if (aOptions.mMaxP99Latency > 0 && p99 > Milliseconds(aOptions.mMaxP99Latency))
+        {
+            fprintf(stderr, "The p99 latency of %s exceeds %u ms\n", result.mName.c_str(), aOptions.mMaxP99Latency);
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [options] RADIO_URL\n"
+            "    -I, --thread-ifname <name>  The Thread interface of the d-bus agent, default wpan0.\n"
+            "    -c, --clients <n>           Number of client connections, default 4.\n"
+            "    -w, --window <n>            Number of pipelined calls per client, default 16.\n"
+            "    -s, --subscribers <n>       Number of signal subscribers, default 16.\n"
+            "    -S, --signals <n>           Number of signals sent, default 200.\n"
+            "    -e, --entries <n>           Number of child entries encoded and decoded, default 511.\n"
+            "    -d, --duration <sec>        Seconds of each phase, default 3.\n"
+            "    -p, --max-p99 <ms>          Fail if the p99 latency of a phase exceeds this limit.\n"
+            "    -v, --verbose               Print debug logs.\n"
+            "    -h, --help                  Print this help.\n",
+            aProgram);
+}
+
+bool ParseUint32(const char *aString, uint32_t &aValue)
+{
+    char *        end;
+    unsigned long value = strtoul(aString, &end, 0);
+
+    aValue = static_cast<uint32_t>(value);
+
+    return *aString != '\0' && *end == '\0' && value <= UINT32_MAX;
+}
+
+} // namespace
+
+void otPlatReset(otInstance *aInstance)
+{
+    // A reset of the radio in the middle of a phase would make its numbers meaningless.
+    fprintf(stderr, "The Thread stack was reset during the benchmark\n");
+    otInstanceFinalize(aInstance);
+    otSysDeinit();
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    static const option kOptions[] = {
+        {"thread-ifname", required_argument, nullptr, 'I'},
+        {"clients", required_argument, nullptr, 'c'},
+        {"window", required_argument, nullptr, 'w'},
+        {"subscribers", required_argument, nullptr, 's'},
+        {"signals", required_argument, nullptr, 'S'},
+        {"entries", required_argument, nullptr, 'e'},
+        {"duration", required_argument, nullptr, 'd'},
+        {"max-p99", required_argument, nullptr, 'p'},
+        {"verbose", no_argument, nullptr, 'v'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+    Options                  options;
+    std::vector<PhaseResult> results;
+    int                      opt;
+
+    while ((opt = getopt_long(argc, argv, "I:c:w:s:S:e:d:p:vh", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case 'I':
+            options.mInterfaceName = optarg;
+            break;
+        case 'c':
+            valid = ParseUint32(optarg, options.mClients) && options.mClients > 0;
+            break;
+        case 'w':
+            valid = ParseUint32(optarg, options.mWindow) && options.mWindow > 0;
+            break;
+        case 's':
+            valid = ParseUint32(optarg, options.mSubscribers);
+            break;
+        case 'S':
+            valid = ParseUint32(optarg, options.mSignals);
+            break;
+        case 'e':
+            valid = ParseUint32(optarg, options.mEntries);
+            break;
+        case 'd':
+            valid = ParseUint32(optarg, options.mDuration);
+            break;
+        case 'p':
+            valid = ParseUint32(optarg, options.mMaxP99Latency);
+            break;
+        case 'v':
+            options.mVerbose = true;
+            break;
+        case 'h':
+            PrintUsage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            valid = false;
+            break;
+        }
+
+        if (!valid)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind + 1 != argc)
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    options.mRadioUrl = argv[optind];
+    otbrLogInit("otbr-dbus-benchmark", options.mVerbose ? OTBR_LOG_DEBUG : OTBR_LOG_WARNING, true);
+
+    {
+        Benchmark benchmark(options);
+        otbrError error = benchmark.Run(results);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            fprintf(stderr, "Failed to start the d-bus agent: %s\n", otbrErrorString(error));
+            return EXIT_FAILURE;
+        }
+    }
+
+    return Report(options, results) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
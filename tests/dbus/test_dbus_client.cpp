@@ -27,6 +27,7 @@
  */
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -37,16 +38,22 @@
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
+#include "common/latency_histogram.hpp"
+#include "common/trace.hpp"
 #include "dbus/client/thread_api_dbus.hpp"
 #include "dbus/common/constants.hpp"
 
 using otbr::DBus::ActiveScanResult;
+using otbr::DBus::ChannelEnergy;
+using otbr::DBus::ChannelQuality;
 using otbr::DBus::ClientError;
 using otbr::DBus::DeviceRole;
 using otbr::DBus::ExternalRoute;
 using otbr::DBus::Ip6Prefix;
 using otbr::DBus::LinkModeConfig;
+using otbr::DBus::MainloopStats;
 using otbr::DBus::OnMeshPrefix;
+using otbr::DBus::RadioStats;
 using otbr::DBus::ThreadApiDBus;
 
 #define TEST_ASSERT(x)                                              \
@@ -93,6 +100,125 @@ static void CheckExternalRoute(ThreadApiDBus *aApi, const Ip6Prefix &aPrefix)
     TEST_ASSERT(aApi->RemoveExternalRoute(aPrefix) == OTBR_ERROR_NONE);
 }
 
+static void CheckUpdateNetworkData(ThreadApiDBus *aApi, const OnMeshPrefix &aOnMeshPrefix, const Ip6Prefix &aPrefix)
+{
+    ExternalRoute              route = {};
+    std::vector<ExternalRoute> externalRouteTable;
+
+    route.mPrefix = aPrefix;
+    route.mStable = true;
+
+    TEST_ASSERT(aApi->UpdateNetworkData({aOnMeshPrefix}, {}, {route}, {}) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExternalRoutes(externalRouteTable) == OTBR_ERROR_NONE);
+    TEST_ASSERT(externalRouteTable.size() == 1);
+    TEST_ASSERT(externalRouteTable[0].mPrefix == aPrefix);
+    TEST_ASSERT(aApi->UpdateNetworkData({}, {aOnMeshPrefix.mPrefix}, {}, {aPrefix}) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExternalRoutes(externalRouteTable) == OTBR_ERROR_NONE);
+    TEST_ASSERT(externalRouteTable.empty());
+}
+
+static void CheckJoinerStart(ThreadApiDBus *aApi)
+{
+    TEST_ASSERT(aApi->JoinerStart("ABCDEF", "", "", "", "", "", nullptr) == ClientError::OT_ERROR_NOT_FOUND);
+    TEST_ASSERT(aApi->JoinerStart("ABCDEF", "", "", "", "", "", [](ClientError aJoinError) {
+        TEST_ASSERT(aJoinError == ClientError::OT_ERROR_NOT_FOUND);
+        exit(0);
+    }) == ClientError::ERROR_NONE);
+}
+
+static void CheckChannelSelection(uint32_t                           aChannelMask,
+                                  uint8_t                            aChannel,
+                                  const std::vector<ChannelEnergy> & aEnergies,
+                                  const std::vector<ChannelQuality> &aOccupancies)
+{
+    TEST_ASSERT(aChannelMask & (1U << aChannel));
+
+    // The channel is selected either from the channel monitor or from an energy scan of every channel in the mask.
+    TEST_ASSERT(aEnergies.empty() != aOccupancies.empty());
+
+    if (!aEnergies.empty())
+    {
+        int8_t selectedRssi = INT8_MAX;
+
+        TEST_ASSERT(aEnergies.size() == 3);
+        for (const ChannelEnergy &energy : aEnergies)
+        {
+            TEST_ASSERT(aChannelMask & (1U << energy.mChannel));
+            if (energy.mChannel == aChannel)
+            {
+                selectedRssi = energy.mMaxRssi;
+            }
+        }
+        for (const ChannelEnergy &energy : aEnergies)
+        {
+            TEST_ASSERT(selectedRssi <= energy.mMaxRssi);
+        }
+    }
+    else
+    {
+        uint16_t selectedOccupancy = UINT16_MAX;
+
+        TEST_ASSERT(aOccupancies.size() == 3);
+        for (const ChannelQuality &occupancy : aOccupancies)
+        {
+            TEST_ASSERT(aChannelMask & (1U << occupancy.mChannel));
+            if (occupancy.mChannel == aChannel)
+            {
+                selectedOccupancy = occupancy.mOccupancy;
+            }
+        }
+        for (const ChannelQuality &occupancy : aOccupancies)
+        {
+            TEST_ASSERT(selectedOccupancy <= occupancy.mOccupancy);
+        }
+    }
+}
+
+static const uint32_t kQuietestChannelMask = (1U << 11) | (1U << 15) | (1U << 25);
+
+static void AttachOnQuietestChannel(ThreadApiDBus *aApi, uint64_t aExtPanId, const std::vector<uint8_t> &aMasterKey)
+{
+    TEST_ASSERT(aApi->AttachOnQuietestChannel(
+                    "Test", 0x3456, aExtPanId, aMasterKey, {}, kQuietestChannelMask,
+                    [aApi](ClientError aError, uint8_t aChannel, const std::vector<ChannelEnergy> &aEnergies,
+                           const std::vector<ChannelQuality> &aOccupancies) {
+                        uint16_t channel;
+
+                        TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                        CheckChannelSelection(kQuietestChannelMask, aChannel, aEnergies, aOccupancies);
+                        TEST_ASSERT(aApi->GetChannel(channel) == OTBR_ERROR_NONE);
+                        TEST_ASSERT(channel == aChannel);
+
+                        aApi->FactoryReset(nullptr);
+                        CheckJoinerStart(aApi);
+                    }) == ClientError::ERROR_NONE);
+}
+
+static void CheckAttachOnQuietestChannel(ThreadApiDBus *aApi, uint64_t aExtPanId)
+{
+    std::vector<uint8_t> masterKey = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                      0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+
+    // An empty channel mask is rejected before any channel is scanned.
+    TEST_ASSERT(aApi->AttachOnQuietestChannel(
+                    "Test", 0x3456, aExtPanId, masterKey, {}, 0,
+                    [aApi, aExtPanId, masterKey](ClientError                        aError,
+                                                 uint8_t,
+                                                 const std::vector<ChannelEnergy> & aEnergies,
+                                                 const std::vector<ChannelQuality> &aOccupancies) {
+                        TEST_ASSERT(aError == ClientError::OT_ERROR_INVALID_ARGS);
+                        TEST_ASSERT(aEnergies.empty() && aOccupancies.empty());
+                        AttachOnQuietestChannel(aApi, aExtPanId, masterKey);
+                    }) == ClientError::ERROR_NONE);
+
+    // Only one attach can be in progress.
+    TEST_ASSERT(aApi->AttachOnQuietestChannel(
+                    "Test", 0x3456, aExtPanId, masterKey, {}, kQuietestChannelMask,
+                    [](ClientError, uint8_t, const std::vector<ChannelEnergy> &, const std::vector<ChannelQuality> &) {
+                        TEST_ASSERT(false);
+                    }) == ClientError::OT_ERROR_INVALID_STATE);
+}
+
 int main()
 {
     DBusError                      error;
@@ -100,6 +226,8 @@ int main()
     std::unique_ptr<ThreadApiDBus> api;
     uint64_t                       extpanid = 0xdead00beaf00cafe;
     std::string                    region;
+    MainloopStats                  mainloopStats;
+    size_t                         scanResultCount = 0;
 
     dbus_error_init(&error);
     connection = UniqueDBusConnection(dbus_bus_get(DBUS_BUS_SYSTEM, &error));
@@ -117,7 +245,61 @@ int main()
     TEST_ASSERT(api->GetRadioRegion(region) == ClientError::ERROR_NONE);
     TEST_ASSERT(region == "US");
 
-    api->Scan([&api, extpanid](const std::vector<ActiveScanResult> &aResult) {
+    TEST_ASSERT(api->GetMainloopStats(mainloopStats) == ClientError::ERROR_NONE);
+    TEST_ASSERT(mainloopStats.mIterations > 0);
+    TEST_ASSERT(mainloopStats.mTimerWakeups <= mainloopStats.mIterations);
+    TEST_ASSERT(!mainloopStats.mLatencies.empty());
+
+    {
+        RadioStats radioStats;
+
+        TEST_ASSERT(api->GetRadioStats(radioStats) == ClientError::ERROR_NONE);
+        TEST_ASSERT(radioStats.mTxLatency.mBuckets.size() == otbr::LatencyHistogram::kNumBuckets);
+        TEST_ASSERT(radioStats.mTxLatency.mCount <= radioStats.mTxFrames);
+    }
+
+#if OTBR_ENABLE_TRACE
+    {
+        std::vector<uint8_t> traceDump;
+
+        TEST_ASSERT(api->GetTraceBuffer(traceDump) == ClientError::ERROR_NONE);
+        TEST_ASSERT(traceDump.size() > sizeof(otbr::TraceHeader));
+    }
+#endif
+
+    region.clear();
+    TEST_ASSERT(api->GetProperties({OTBR_DBUS_PROPERTY_RADIO_REGION, OTBR_DBUS_PROPERTY_MAINLOOP_STATS}, region,
+                                   mainloopStats) == ClientError::ERROR_NONE);
+    TEST_ASSERT(region == "US");
+    TEST_ASSERT(mainloopStats.mIterations > 0);
+    TEST_ASSERT(api->GetProperties({OTBR_DBUS_PROPERTY_RADIO_REGION, "NoSuchProperty"}, region, mainloopStats) ==
+                ClientError::OT_ERROR_NOT_FOUND);
+
+    {
+        otbr::Milliseconds age;
+
+        api->SetPropertyCacheEnabled(true, otbr::Milliseconds(60 * 1000));
+        TEST_ASSERT(api->GetRadioRegion(region) == ClientError::ERROR_NONE);
+        TEST_ASSERT(api->GetPropertyCacheAge(OTBR_DBUS_PROPERTY_RADIO_REGION, age) == ClientError::ERROR_NONE);
+        TEST_ASSERT(api->GetRadioRegion(region) == ClientError::ERROR_NONE);
+        TEST_ASSERT(region == "US");
+        TEST_ASSERT(api->SetRadioRegion("US") == ClientError::ERROR_NONE);
+        TEST_ASSERT(api->GetPropertyCacheAge(OTBR_DBUS_PROPERTY_RADIO_REGION, age) == ClientError::OT_ERROR_NOT_FOUND);
+        api->SetPropertyCacheEnabled(false, otbr::Milliseconds(0));
+    }
+
+    TEST_ASSERT(api->SetPropertyAsync(OTBR_DBUS_PROPERTY_RADIO_REGION, std::string("US"), [](ClientError aError) {
+        TEST_ASSERT(aError == ClientError::ERROR_NONE);
+    }) == ClientError::ERROR_NONE);
+    TEST_ASSERT(api->GetPropertyAsync<std::string>(OTBR_DBUS_PROPERTY_RADIO_REGION,
+                                                   [](ClientError aError, const std::string &aRegion) {
+                                                       TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                                                       TEST_ASSERT(aRegion == "US");
+                                                   }) == ClientError::ERROR_NONE);
+
+    TEST_ASSERT(api->AddScanResultHandler([&scanResultCount](const ActiveScanResult &) { ++scanResultCount; }) ==
+                ClientError::ERROR_NONE);
+    api->Scan([&api, extpanid, &scanResultCount](const std::vector<ActiveScanResult> &aResult) {
         LinkModeConfig       cfg       = {true, false, true};
         std::vector<uint8_t> masterKey = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
                                           0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
@@ -127,6 +309,8 @@ int main()
         {
             printf("%s channel %d rssi %d\n", result.mNetworkName.c_str(), result.mChannel, result.mRssi);
         }
+        // The results are streamed as signals before the method returns.
+        TEST_ASSERT(scanResultCount >= aResult.size());
 
         api->SetLinkMode(cfg);
         api->GetLinkMode(cfg);
@@ -153,6 +337,9 @@ int main()
                             int8_t                                txPower;
                             std::vector<otbr::DBus::ChildInfo>    childTable;
                             std::vector<otbr::DBus::NeighborInfo> neighborTable;
+                            std::vector<otbr::DBus::ChildInfo>    childPage;
+                            std::vector<otbr::DBus::NeighborInfo> neighborPage;
+                            uint16_t                              total;
                             uint32_t                              partitionId;
                             uint16_t                              channelResult;
 
@@ -170,6 +357,20 @@ int main()
                             printf("childTable size %zu\n", childTable.size());
                             TEST_ASSERT(neighborTable.size() == 1);
                             TEST_ASSERT(childTable.size() == 1);
+                            TEST_ASSERT(api->GetChildTablePage(0, 10, childPage, total) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(total == 1 && childPage.size() == 1);
+                            TEST_ASSERT(childPage[0].mExtAddress == childTable[0].mExtAddress);
+                            TEST_ASSERT(api->GetChildTablePage(1, 10, childPage, total) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(total == 1 && childPage.empty());
+                            TEST_ASSERT(api->GetNeighborTablePage(0, 0, neighborPage, total) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(total == 1 && neighborPage.empty());
+                            TEST_ASSERT(api->ExportChildTable(childPage) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(childPage.size() == 1);
+                            TEST_ASSERT(childPage[0].mExtAddress == childTable[0].mExtAddress);
+                            TEST_ASSERT(childPage[0].mRloc16 == childTable[0].mRloc16);
+                            TEST_ASSERT(api->ExportNeighborTable(neighborPage) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(neighborPage.size() == 1);
+                            TEST_ASSERT(neighborPage[0].mExtAddress == neighborTable[0].mExtAddress);
                             TEST_ASSERT(api->GetPartitionId(partitionId) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetInstantRssi(rssi) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetRadioTxPower(txPower) == OTBR_ERROR_NONE);
@@ -217,14 +418,10 @@ int main()
                             CheckExternalRoute(api.get(), prefix);
                             TEST_ASSERT(api->AddOnMeshPrefix(onMeshPrefix) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->RemoveOnMeshPrefix(onMeshPrefix.mPrefix) == OTBR_ERROR_NONE);
+                            CheckUpdateNetworkData(api.get(), onMeshPrefix, prefix);
 
                             api->FactoryReset(nullptr);
-                            TEST_ASSERT(api->JoinerStart("ABCDEF", "", "", "", "", "", nullptr) ==
-                                        ClientError::OT_ERROR_NOT_FOUND);
-                            TEST_ASSERT(api->JoinerStart("ABCDEF", "", "", "", "", "", [](ClientError aJoinError) {
-                                TEST_ASSERT(aJoinError == ClientError::OT_ERROR_NOT_FOUND);
-                                exit(0);
-                            }) == ClientError::ERROR_NONE);
+                            CheckAttachOnQuietestChannel(api.get(), extpanid);
                         });
                     });
     });
@@ -43,10 +43,17 @@ public:
         : DBusObject(aConnection, "/io/openthread/testobj")
         , mEnded(false)
         , mCount(0)
+        , mSubscribers(0)
     {
         RegisterMethod("io.openthread", "Ping", std::bind(&TestObject::PingHandler, this, _1));
+        RegisterMethod("io.openthread", "Emit", std::bind(&TestObject::EmitHandler, this, _1));
         RegisterGetPropertyHandler("io.openthread", "Count", std::bind(&TestObject::CountGetHandler, this, _1));
         RegisterSetPropertyHandler("io.openthread", "Count", std::bind(&TestObject::CountSetHandler, this, _1));
+        RegisterGetPropertyHandler("io.openthread", "Subscribers",
+                                   std::bind(&TestObject::SubscribersGetHandler, this, _1));
+        RegisterSubscribableSignal("io.openthread", "Counted", [this](const std::string &, bool aSubscribed) {
+            mSubscribers += aSubscribed ? 1 : -1;
+        });
     }
 
     bool IsEnded(void) const { return mEnded; }
@@ -68,6 +75,32 @@ private:
         return OT_ERROR_NONE;
     }
 
+    otError SubscribersGetHandler(DBusMessageIter &aIter)
+    {
+        DBusMessageEncodeToVariant(&aIter, mSubscribers);
+        return OT_ERROR_NONE;
+    }
+
+    // Sends the `Counted` signal a number of times in a row, to the subscribers within their rate limits.
+    void EmitHandler(DBusRequest &aRequest)
+    {
+        uint32_t count;
+        auto     args  = std::tie(count);
+        otError  error = OT_ERROR_NONE;
+
+        VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE,
+                     error = OT_ERROR_INVALID_ARGS);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            VerifyOrExit(SignalSubscribers("io.openthread", "Counted", std::make_tuple(i)) == OTBR_ERROR_NONE,
+                         error = OT_ERROR_FAILED);
+        }
+
+    exit:
+        aRequest.ReplyOtResult(error);
+    }
+
     void PingHandler(DBusRequest &aRequest)
     {
         uint32_t    id;
@@ -87,6 +120,7 @@ private:
 
     bool    mEnded;
     int32_t mCount;
+    int32_t mSubscribers;
 };
 
 int main()
@@ -0,0 +1,218 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
+
+using otbr::DBus::DBusMessageExtractFromVariant;
+using otbr::DBus::TupleToDBusMessage;
+using otbr::DBus::UniqueDBusMessage;
+
+#define TEST_ASSERT(x)                                              \
+    do                                                              \
+    {                                                               \
+        if (!(x))                                                   \
+        {                                                           \
+            printf("Assert failed at %s:%d\n", __FILE__, __LINE__); \
+            exit(EXIT_FAILURE);                                     \
+        }                                                           \
+    } while (false)
+
+struct DBusConnectionDeleter
+{
+    void operator()(DBusConnection *aConnection)
+    {
+        dbus_connection_close(aConnection);
+        dbus_connection_unref(aConnection);
+    }
+};
+
+using UniqueDBusConnection = std::unique_ptr<DBusConnection, DBusConnectionDeleter>;
+
+static const char kServerName[] = "io.openthread.TestServer";
+static const char kObjectPath[] = "/io/openthread/testobj";
+static const char kInterface[]  = "io.openthread";
+static const int  kTimeout      = 5000;
+
+static UniqueDBusConnection Connect(void)
+{
+    // A private connection of its own for each subscriber, which leaves the bus when closed.
+    UniqueDBusConnection connection(dbus_bus_get_private(DBUS_BUS_SYSTEM, nullptr));
+
+    TEST_ASSERT(connection != nullptr);
+    dbus_connection_set_exit_on_disconnect(connection.get(), false);
+
+    return connection;
+}
+
+template <typename... ArgTypes>
+static bool Call(DBusConnection *                aConnection,
+                 const char *                    aInterface,
+                 const char *                    aMethod,
+                 const std::tuple<ArgTypes...> &aArgs,
+                 UniqueDBusMessage *             aReply = nullptr)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call(kServerName, kObjectPath, aInterface, aMethod));
+    UniqueDBusMessage reply(nullptr);
+    bool              succeeded = false;
+
+    VerifyOrExit(message != nullptr && TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(aConnection, message.get(), kTimeout, nullptr));
+    VerifyOrExit(reply != nullptr && dbus_message_get_type(reply.get()) == DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    succeeded = true;
+
+    if (aReply != nullptr)
+    {
+        *aReply = std::move(reply);
+    }
+
+exit:
+    return succeeded;
+}
+
+static int32_t GetSubscribers(DBusConnection *aConnection)
+{
+    UniqueDBusMessage reply(nullptr);
+    DBusMessageIter   iter;
+    int32_t           subscribers = -1;
+
+    TEST_ASSERT(Call(aConnection, DBUS_INTERFACE_PROPERTIES, "Get", std::make_tuple(kInterface, "Subscribers"),
+                     &reply));
+    TEST_ASSERT(dbus_message_iter_init(reply.get(), &iter));
+    TEST_ASSERT(DBusMessageExtractFromVariant(&iter, subscribers) == OTBR_ERROR_NONE);
+
+    return subscribers;
+}
+
+static int32_t WaitSubscribers(DBusConnection *aConnection, int32_t aExpected)
+{
+    int32_t subscribers = GetSubscribers(aConnection);
+
+    // The bus daemon tells the server about closed connections asynchronously.
+    for (int i = 0; i < 50 && subscribers != aExpected; i++)
+    {
+        usleep(100000);
+        subscribers = GetSubscribers(aConnection);
+    }
+
+    return subscribers;
+}
+
+static uint32_t CountSignals(DBusConnection *aConnection)
+{
+    UniqueDBusMessage message(nullptr);
+    uint32_t          count = 0;
+
+    // The signals are queued for the connection before the reply of a later call, which receives them all.
+    OTBR_UNUSED_VARIABLE(GetSubscribers(aConnection));
+
+    while ((message = UniqueDBusMessage(dbus_connection_pop_message(aConnection))) != nullptr)
+    {
+        if (dbus_message_is_signal(message.get(), kInterface, "Counted"))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+static void TestSubscribeUnsubscribe(void)
+{
+    UniqueDBusConnection subscriber = Connect();
+    UniqueDBusConnection other      = Connect();
+
+    TEST_ASSERT(!Call(subscriber.get(), kInterface, "SubscribeSignal", std::make_tuple("Unknown")));
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "SubscribeSignal", std::make_tuple("Counted")));
+    // Subscribing twice is a no-op.
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "SubscribeSignal", std::make_tuple("Counted")));
+    TEST_ASSERT(GetSubscribers(subscriber.get()) == 1);
+
+    // Only the subscriber receives the signal.
+    TEST_ASSERT(Call(other.get(), kInterface, "Emit", std::make_tuple(uint32_t{1})));
+    TEST_ASSERT(CountSignals(subscriber.get()) == 1);
+    TEST_ASSERT(CountSignals(other.get()) == 0);
+
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "UnsubscribeSignal", std::make_tuple("Counted")));
+    TEST_ASSERT(GetSubscribers(subscriber.get()) == 0);
+    TEST_ASSERT(Call(other.get(), kInterface, "Emit", std::make_tuple(uint32_t{1})));
+    TEST_ASSERT(CountSignals(subscriber.get()) == 0);
+}
+
+static void TestRateLimit(void)
+{
+    UniqueDBusConnection subscriber = Connect();
+    uint32_t             count;
+
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "SubscribeSignal", std::make_tuple("Counted")));
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "Emit", std::make_tuple(uint32_t{OTBR_DBUS_SIGNAL_BURST + 8})));
+    count = CountSignals(subscriber.get());
+
+    // A burst goes through, the rest is dropped until the tokens are refilled.
+    TEST_ASSERT(count >= OTBR_DBUS_SIGNAL_BURST && count < OTBR_DBUS_SIGNAL_BURST + 8);
+
+    usleep(1000000 / OTBR_DBUS_SIGNAL_RATE_LIMIT + 100000);
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "Emit", std::make_tuple(uint32_t{1})));
+    TEST_ASSERT(CountSignals(subscriber.get()) == 1);
+
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "UnsubscribeSignal", std::make_tuple("Counted")));
+}
+
+static void TestSubscriberLeaves(void)
+{
+    UniqueDBusConnection observer   = Connect();
+    UniqueDBusConnection subscriber = Connect();
+
+    TEST_ASSERT(Call(subscriber.get(), kInterface, "SubscribeSignal", std::make_tuple("Counted")));
+    TEST_ASSERT(GetSubscribers(observer.get()) == 1);
+
+    // The server drops the subscriber on the NameOwnerChanged signal of its unique name.
+    subscriber.reset();
+    TEST_ASSERT(WaitSubscribers(observer.get(), 0) == 0);
+}
+
+int main()
+{
+    TestSubscribeUnsubscribe();
+    TestRateLimit();
+    TestSubscriberLeaves();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <string>
+
+#include "common/code_utils.hpp"
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+
+using otbr::rest::Parser;
+using otbr::rest::Request;
+
+/**
+ * This function feeds the fuzzed input to the Rest Server request parser as a connection would receive it.
+ *
+ * The first byte selects the fragment size so that the fuzzer also splits requests at arbitrary places, the rest is
+ * the received byte stream, possibly with several pipelined requests.
+ *
+ */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *aData, size_t aSize)
+{
+    Request     request;
+    Parser      parser(&request);
+    std::string pending;
+    size_t      fragmentSize;
+
+    VerifyOrExit(aSize != 0);
+
+    fragmentSize = (aData[0] == 0) ? aSize : aData[0];
+    ++aData;
+    --aSize;
+
+    parser.Init();
+
+    for (size_t offset = 0; offset < aSize; offset += fragmentSize)
+    {
+        size_t length = (aSize - offset < fragmentSize) ? aSize - offset : fragmentSize;
+
+        pending.append(reinterpret_cast<const char *>(aData) + offset, length);
+
+        while (!pending.empty())
+        {
+            size_t parsed = parser.Process(pending.data(), pending.size());
+
+            if (parsed > pending.size())
+            {
+                abort();
+            }
+
+            if (!request.IsComplete())
+            {
+                // The connection would be closed on parse errors.
+                VerifyOrExit(parser.GetError() == HPE_OK);
+
+                pending.clear();
+                break;
+            }
+
+            // Touch what the handlers read so that the sanitizers check it.
+            (void)request.GetMethod();
+            (void)request.GetUrl().size();
+            (void)request.GetBody().size();
+            (void)parser.ShouldKeepAlive();
+
+            pending.erase(0, parsed);
+            request.Reset();
+            parser.Resume();
+        }
+    }
+
+exit:
+    return 0;
+}
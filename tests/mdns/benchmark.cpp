@@ -0,0 +1,558 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a scale benchmark of the mDNS publisher.
+ *
+ * The benchmark publishes, updates and unpublishes a number of hosts with their services, and reports the
+ * latencies from the publish calls to the publish handlers, the CPU time and the memory usage of every phase.
+ */
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+
+using namespace otbr;
+
+namespace {
+
+const char kServiceType[] = "_otbrbench._udp.";
+
+struct Options
+{
+    uint32_t mNumHosts        = 100;
+    uint32_t mServicesPerHost = 10;
+    uint32_t mTimeout         = 60; // Seconds to wait for the handlers of a phase.
+    uint32_t mMaxP99Latency   = 0;  // Milliseconds, zero means no limit.
+    bool     mBatch           = false;
+    bool     mVerbose         = false;
+};
+
+struct PhaseResult
+{
+    std::string               mName;
+    uint32_t                  mRequests = 0;
+    uint32_t                  mErrors   = 0;
+    uint32_t                  mMissing  = 0;
+    std::vector<Microseconds> mLatencies;
+    Microseconds              mWallTime{0};
+    Microseconds              mUserTime{0};
+    Microseconds              mSystemTime{0};
+    long                      mRssKb    = 0;
+    long                      mMaxRssKb = 0;
+};
+
+class Benchmark
+{
+public:
+    explicit Benchmark(const Options &aOptions)
+        : mOptions(aOptions)
+        , mPublisher(nullptr)
+        , mState(Mdns::Publisher::State::kIdle)
+        , mResult(nullptr)
+    {
+    }
+
+    ~Benchmark(void) { Mdns::Publisher::Destroy(mPublisher); }
+
+    otbrError Run(std::vector<PhaseResult> &aResults);
+
+private:
+    static void HandleState(void *aContext, Mdns::Publisher::State aState)
+    {
+        static_cast<Benchmark *>(aContext)->mState = aState;
+    }
+
+    static void HandleServicePublished(const char *aName, const char *aType, otbrError aError, void *aContext)
+    {
+        static_cast<Benchmark *>(aContext)->HandlePublished(Mdns::Publisher::MakeServiceKey(aName, aType), aError);
+    }
+
+    static void HandleHostPublished(const char *aName, otbrError aError, void *aContext)
+    {
+        static_cast<Benchmark *>(aContext)->HandlePublished(aName, aError);
+    }
+
+    void      HandlePublished(const std::string &aKey, otbrError aError);
+    void      StartRequest(const std::string &aKey);
+    bool      IsFinished(void) const;
+    bool      RunMainloop(Timepoint aDeadline);
+    otbrError WaitForReady(void);
+    void      BeginPhase(PhaseResult &aResult, const char *aName);
+    void      EndPhase(PhaseResult &aResult);
+    void      Publish(uint32_t aVersion);
+    void      Unpublish(void);
+
+    static std::string GetHostName(uint32_t aHost);
+    static std::string GetServiceName(uint32_t aHost, uint32_t aService);
+
+    const Options &                            mOptions;
+    Mdns::Publisher *                          mPublisher;
+    Mdns::Publisher::State                     mState;
+    PhaseResult *                              mResult;
+    std::unordered_map<std::string, Timepoint> mPending; // The start times of the publications, by key.
+    Timepoint                                  mPhaseStart;
+    rusage                                     mPhaseUsage;
+};
+
+Microseconds ToMicroseconds(const timeval &aTime)
+{
+    return FromTimeval<Microseconds>(aTime);
+}
+
+long GetRssKb(void)
+{
+    long  rss  = 0;
+    FILE *file = fopen("/proc/self/statm", "r");
+
+    if (file != nullptr)
+    {
+        long size;
+
+        if (fscanf(file, "%ld %ld", &size, &rss) == 2)
+        {
+            rss *= sysconf(_SC_PAGESIZE) / 1024;
+        }
+        else
+        {
+            rss = 0;
+        }
+
+        fclose(file);
+    }
+
+    return rss;
+}
+
+std::string Benchmark::GetHostName(uint32_t aHost)
+{
+    return "otbr-bench-" + std::to_string(aHost);
+}
+
+std::string Benchmark::GetServiceName(uint32_t aHost, uint32_t aService)
+{
+    return "otbr-bench-" + std::to_string(aHost) + "-" + std::to_string(aService);
+}
+
+void Benchmark::HandlePublished(const std::string &aKey, otbrError aError)
+{
+    auto it = mPending.find(aKey);
+
+    // Handlers may be called again, e.g. when the mDNS daemon restarts.
+    VerifyOrExit(mResult != nullptr && it != mPending.end());
+
+    mResult->mLatencies.push_back(std::chrono::duration_cast<Microseconds>(Clock::now() - it->second));
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        ++mResult->mErrors;
+
+        if (mOptions.mVerbose)
+        {
+            fprintf(stderr, "Failed to publish %s: %s\n", aKey.c_str(), otbrErrorString(aError));
+        }
+    }
+
+    mPending.erase(it);
+
+exit:
+    return;
+}
+
+void Benchmark::StartRequest(const std::string &aKey)
+{
+    mPending[aKey] = Clock::now();
+    ++mResult->mRequests;
+}
+
+bool Benchmark::IsFinished(void) const
+{
+    // Outside of a phase, the mainloop runs until the publisher is ready.
+    return (mResult != nullptr) ? mPending.empty() : (mState == Mdns::Publisher::State::kReady);
+}
+
+bool Benchmark::RunMainloop(Timepoint aDeadline)
+{
+    bool finished;
+
+    while (!(finished = IsFinished()))
+    {
+        MainloopContext mainloop;
+        Timepoint       now = Clock::now();
+        int             rval;
+
+        VerifyOrExit(now < aDeadline);
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = ToTimeval(std::chrono::duration_cast<Microseconds>(aDeadline - now));
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        mPublisher->Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+
+        if (rval < 0 && errno != EINTR)
+        {
+            perror("select");
+            ExitNow();
+        }
+
+        if (rval >= 0)
+        {
+            mPublisher->Process(mainloop);
+        }
+    }
+
+exit:
+    return finished;
+}
+
+otbrError Benchmark::WaitForReady(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mPublisher = Mdns::Publisher::Create(AF_UNSPEC, /* aDomain */ nullptr, HandleState, this);
+    VerifyOrExit(mPublisher != nullptr, error = OTBR_ERROR_MDNS);
+
+    mPublisher->SetPublishServiceHandler(HandleServicePublished, this);
+    mPublisher->SetPublishHostHandler(HandleHostPublished, this);
+
+    SuccessOrExit(error = mPublisher->Start());
+    VerifyOrExit(mState == Mdns::Publisher::State::kReady || RunMainloop(Clock::now() + Seconds(mOptions.mTimeout)),
+                 error = OTBR_ERROR_MDNS);
+
+exit:
+    return error;
+}
+
+void Benchmark::BeginPhase(PhaseResult &aResult, const char *aName)
+{
+    aResult.mName = aName;
+    aResult.mLatencies.reserve(mOptions.mNumHosts * (mOptions.mServicesPerHost + 1));
+    mResult     = &aResult;
+    mPhaseStart = Clock::now();
+    getrusage(RUSAGE_SELF, &mPhaseUsage);
+}
+
+void Benchmark::EndPhase(PhaseResult &aResult)
+{
+    rusage usage;
+
+    RunMainloop(Clock::now() + Seconds(mOptions.mTimeout));
+    getrusage(RUSAGE_SELF, &usage);
+
+    aResult.mWallTime   = std::chrono::duration_cast<Microseconds>(Clock::now() - mPhaseStart);
+    aResult.mUserTime   = ToMicroseconds(usage.ru_utime) - ToMicroseconds(mPhaseUsage.ru_utime);
+    aResult.mSystemTime = ToMicroseconds(usage.ru_stime) - ToMicroseconds(mPhaseUsage.ru_stime);
+    aResult.mRssKb      = GetRssKb();
+    aResult.mMaxRssKb   = usage.ru_maxrss;
+    aResult.mMissing    = static_cast<uint32_t>(mPending.size());
+
+    mPending.clear();
+    mResult = nullptr;
+}
+
+void Benchmark::Publish(uint32_t aVersion)
+{
+    std::string version = std::to_string(aVersion);
+
+    for (uint32_t host = 0; host < mOptions.mNumHosts; host++)
+    {
+        std::string hostName = GetHostName(host);
+        uint8_t     address[16];
+        otbrError   error;
+
+        // fd00::<host>
+        memset(address, 0, sizeof(address));
+        address[0]  = 0xfd;
+        address[12] = static_cast<uint8_t>(host >> 24);
+        address[13] = static_cast<uint8_t>(host >> 16);
+        address[14] = static_cast<uint8_t>(host >> 8);
+        address[15] = static_cast<uint8_t>(host);
+
+        if (mOptions.mBatch)
+        {
+            mPublisher->BeginBatch(hostName.c_str());
+        }
+
+        // The address doesn't change in updates, so only the services are updated.
+        if (aVersion == 0)
+        {
+            StartRequest(hostName);
+            error = mPublisher->PublishHost(hostName.c_str(), {Ip6Address(address)});
+            if (error != OTBR_ERROR_NONE)
+            {
+                HandlePublished(hostName, error);
+            }
+        }
+
+        for (uint32_t service = 0; service < mOptions.mServicesPerHost; service++)
+        {
+            std::string              serviceName = GetServiceName(host, service);
+            std::string              key = Mdns::Publisher::MakeServiceKey(serviceName.c_str(), kServiceType);
+            Mdns::Publisher::TxtList txtList{{"id", serviceName.c_str()}, {"v", version.c_str()}};
+
+            StartRequest(key);
+            error = mPublisher->PublishService(hostName.c_str(), static_cast<uint16_t>(10000 + service),
+                                               serviceName.c_str(), kServiceType, txtList);
+            if (error != OTBR_ERROR_NONE)
+            {
+                HandlePublished(key, error);
+            }
+        }
+
+        if (mOptions.mBatch && (error = mPublisher->CommitBatch()) != OTBR_ERROR_NONE)
+        {
+            // The publish handlers are not called for the publications of a failed batch.
+            if (aVersion == 0)
+            {
+                HandlePublished(hostName, error);
+            }
+
+            for (uint32_t service = 0; service < mOptions.mServicesPerHost; service++)
+            {
+                HandlePublished(Mdns::Publisher::MakeServiceKey(GetServiceName(host, service).c_str(), kServiceType),
+                                error);
+            }
+        }
+    }
+}
+
+void Benchmark::Unpublish(void)
+{
+    for (uint32_t host = 0; host < mOptions.mNumHosts; host++)
+    {
+        for (uint32_t service = 0; service < mOptions.mServicesPerHost; service++)
+        {
+            std::string serviceName = GetServiceName(host, service);
+
+            ++mResult->mRequests;
+            if (mPublisher->UnpublishService(serviceName.c_str(), kServiceType) != OTBR_ERROR_NONE)
+            {
+                ++mResult->mErrors;
+            }
+        }
+
+        ++mResult->mRequests;
+        if (mPublisher->UnpublishHost(GetHostName(host).c_str()) != OTBR_ERROR_NONE)
+        {
+            ++mResult->mErrors;
+        }
+    }
+}
+
+otbrError Benchmark::Run(std::vector<PhaseResult> &aResults)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = WaitForReady());
+
+    aResults.resize(3);
+
+    BeginPhase(aResults[0], "publish");
+    Publish(/* aVersion */ 0);
+    EndPhase(aResults[0]);
+
+    BeginPhase(aResults[1], "update");
+    Publish(/* aVersion */ 1);
+    EndPhase(aResults[1]);
+
+    // Unpublishing has no handler, the phase measures the cost of the calls.
+    BeginPhase(aResults[2], "unpublish");
+    Unpublish();
+    EndPhase(aResults[2]);
+
+exit:
+    return error;
+}
+
+Microseconds GetPercentile(const std::vector<Microseconds> &aSorted, uint32_t aPercent)
+{
+    // The nearest-rank percentile.
+    size_t rank = (aSorted.size() * aPercent + 99) / 100;
+
+    return aSorted.empty() ? Microseconds(0) : aSorted[std::max<size_t>(rank, 1) - 1];
+}
+
+double ToMilliseconds(Microseconds aTime)
+{
+    return aTime.count() / 1000.0;
+}
+
+bool Report(const Options &aOptions, std::vector<PhaseResult> &aResults)
+{
+    bool passed = true;
+
+    printf("mDNS publisher benchmark: %u hosts, %u services per host%s\n", aOptions.mNumHosts,
+           aOptions.mServicesPerHost, aOptions.mBatch ? ", batched" : "");
+    printf("%-10s %8s %7s %7s %9s %9s %9s %9s %10s %9s %9s %9s %9s\n", "phase", "requests", "errors", "missing",
+           "p50(ms)", "p90(ms)", "p99(ms)", "max(ms)", "wall(ms)", "user(ms)", "sys(ms)", "rss(KB)", "maxrss(KB)");
+
+    for (PhaseResult &result : aResults)
+    {
+        Microseconds p99;
+
+        std::sort(result.mLatencies.begin(), result.mLatencies.end());
+        p99 = GetPercentile(result.mLatencies, 99);
+
+        printf("%-10s %8u %7u %7u %9.3f %9.3f %9.3f %9.3f %10.3f %9.3f %9.3f %9ld %9ld\n", result.mName.c_str(),
+               result.mRequests, result.mErrors, result.mMissing,
+               ToMilliseconds(GetPercentile(result.mLatencies, 50)),
+               ToMilliseconds(GetPercentile(result.mLatencies, 90)), ToMilliseconds(p99),
+               ToMilliseconds(result.mLatencies.empty() ? Microseconds(0) : result.mLatencies.back()),
+               ToMilliseconds(result.mWallTime), ToMilliseconds(result.mUserTime),
+               ToMilliseconds(result.mSystemTime), result.mRssKb, result.mMaxRssKb);
+
+        if (result.mErrors > 0 || result.mMissing > 0)
+        {
+            passed = false;
+        }
+
+        if (aOptions.mMaxP99Latency > 0 && p99 > Milliseconds(aOptions.mMaxP99Latency))
+        {
+            fprintf(stderr, "The p99 latency of %s exceeds %u ms\n", result.mName.c_str(), aOptions.mMaxP99Latency);
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "    -H, --hosts <n>         Number of hosts, default 100.\n"
+            "    -s, --services <n>      Number of services per host, default 10.\n"
+            "    -t, --timeout <sec>     Seconds to wait for the publish handlers of a phase, default 60.\n"
+            "    -p, --max-p99 <ms>      Fail if the p99 latency of a phase exceeds this limit.\n"
+            "    -b, --batch             Publish every host with its services in one batch.\n"
+            "    -v, --verbose           Print debug logs and failed publications.\n"
+            "    -h, --help              Print this help.\n",
+            aProgram);
+}
+
+bool ParseUint32(const char *aString, uint32_t &aValue)
+{
+    char *        end;
+    unsigned long value = strtoul(aString, &end, 0);
+
+    aValue = static_cast<uint32_t>(value);
+
+    return *aString != '\0' && *end == '\0' && value <= UINT32_MAX;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    static const option kOptions[] = {
+        {"hosts", required_argument, nullptr, 'H'},   {"services", required_argument, nullptr, 's'},
+        {"timeout", required_argument, nullptr, 't'}, {"max-p99", required_argument, nullptr, 'p'},
+        {"batch", no_argument, nullptr, 'b'},         {"verbose", no_argument, nullptr, 'v'},
+        {"help", no_argument, nullptr, 'h'},          {nullptr, 0, nullptr, 0},
+    };
+
+    Options                  options;
+    std::vector<PhaseResult> results;
+    int                      opt;
+
+    while ((opt = getopt_long(argc, argv, "H:s:t:p:bvh", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case 'H':
+            valid = ParseUint32(optarg, options.mNumHosts);
+            break;
+        case 's':
+            valid = ParseUint32(optarg, options.mServicesPerHost);
+            break;
+        case 't':
+            valid = ParseUint32(optarg, options.mTimeout);
+            break;
+        case 'p':
+            valid = ParseUint32(optarg, options.mMaxP99Latency);
+            break;
+        case 'b':
+            options.mBatch = true;
+            break;
+        case 'v':
+            options.mVerbose = true;
+            break;
+        case 'h':
+            PrintUsage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            valid = false;
+            break;
+        }
+
+        if (!valid)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    otbrLogInit("otbr-mdns-benchmark", options.mVerbose ? OTBR_LOG_DEBUG : OTBR_LOG_WARNING, true);
+
+    {
+        Benchmark benchmark(options);
+        otbrError error = benchmark.Run(results);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            fprintf(stderr, "Failed to start the mDNS publisher: %s\n", otbrErrorString(error));
+            return EXIT_FAILURE;
+        }
+    }
+
+    return Report(options, results) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -96,7 +96,7 @@ void PublishSingleServiceWithCustomHost(void *aContext, Mdns::Publisher::State a
         Mdns::Publisher::TxtList txtList{
             {"nn", "cool"}, {"xp", xpanid, sizeof(xpanid)}, {"tv", "1.1.1"}, {"dd", extAddr, sizeof(extAddr)}};
 
-        error = sContext.mPublisher->PublishHost(hostName, hostAddr, sizeof(hostAddr));
+        error = sContext.mPublisher->PublishHost(hostName, {Ip6Address(hostAddr)});
         SuccessOrDie(error, "cannot publish the host");
 
         error = sContext.mPublisher->PublishService(hostName, 12345, "SingleService", "_meshcop._udp.", txtList);
@@ -123,7 +123,7 @@ void PublishMultipleServicesWithCustomHost(void *aContext, Mdns::Publisher::Stat
         Mdns::Publisher::TxtList txtList{
             {"nn", "cool"}, {"xp", xpanid, sizeof(xpanid)}, {"tv", "1.1.1"}, {"dd", extAddr, sizeof(extAddr)}};
 
-        error = sContext.mPublisher->PublishHost(hostName1, hostAddr, sizeof(hostAddr));
+        error = sContext.mPublisher->PublishHost(hostName1, {Ip6Address(hostAddr)});
         SuccessOrDie(error, "cannot publish the first host");
 
         error = sContext.mPublisher->PublishService(hostName1, 12345, "MultipleService11", "_meshcop._udp.", txtList);
@@ -132,7 +132,7 @@ void PublishMultipleServicesWithCustomHost(void *aContext, Mdns::Publisher::Stat
         error = sContext.mPublisher->PublishService(hostName1, 12345, "MultipleService12", "_meshcop._udp.", txtList);
         SuccessOrDie(error, "cannot publish the second service");
 
-        error = sContext.mPublisher->PublishHost(hostName2, hostAddr, sizeof(hostAddr));
+        error = sContext.mPublisher->PublishHost(hostName2, {Ip6Address(hostAddr)});
         SuccessOrDie(error, "cannot publish the second host");
 
         error = sContext.mPublisher->PublishService(hostName2, 12345, "MultipleService21", "_meshcop._udp.", txtList);
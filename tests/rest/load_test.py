@@ -0,0 +1,313 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+# Load test of the otbr rest server.
+#
+# Each worker thread sends requests picked from a weighted endpoint mix, with a
+# fixed seed per worker so that runs of different builds send the same request
+# sequence. The report (QPS, latency percentiles, error rates and agent CPU) can
+# be saved and used as the baseline of a later run, which then fails if it
+# regresses by more than the allowed ratio.
+#
+
+import argparse
+import http.client
+import json
+import os
+import random
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+DEFAULT_MIX = "/node=4,/node/state=4,/node/rloc16=4,/mainloop-stats=2,/metrics=1,/diagnostics=1"
+
+
+def parse_mix(mix):
+    endpoints = []
+    weights = []
+
+    for item in mix.split(","):
+        path, _, weight = item.partition("=")
+        endpoints.append(path.strip())
+        weights.append(float(weight) if weight else 1.0)
+
+    return endpoints, weights
+
+
+def percentile(sorted_values, ratio):
+    if not sorted_values:
+        return 0.0
+
+    index = min(len(sorted_values) - 1, max(0, int(len(sorted_values) * ratio + 0.5) - 1))
+
+    return sorted_values[index]
+
+
+def find_agent_pid():
+    try:
+        return int(subprocess.check_output(["pgrep", "-o", "otbr-agent"]).split()[0])
+    except (subprocess.CalledProcessError, FileNotFoundError, IndexError, ValueError):
+        return None
+
+
+def read_cpu_seconds(pid):
+    if pid is None:
+        return None
+
+    try:
+        with open("/proc/{}/stat".format(pid)) as stat:
+            # The command name may contain spaces, fields are counted after it.
+            fields = stat.read().rsplit(")", 1)[1].split()
+    except OSError:
+        return None
+
+    # utime and stime are the 14th and 15th fields.
+    return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+
+
+class Worker(threading.Thread):
+
+    def __init__(self, args, endpoints, weights, seed):
+        super().__init__(daemon=True)
+        self.args = args
+        self.endpoints = endpoints
+        self.weights = weights
+        self.random = random.Random(seed)
+        self.connection = None
+        self.recording = False
+        self.stopped = False
+        self.latencies = []
+        self.statuses = {}
+        self.failures = 0
+
+    def connect(self):
+        self.connection = http.client.HTTPConnection(self.args.host, self.args.port, timeout=self.args.timeout)
+
+    def request(self, path):
+        headers = {"Accept": self.args.accept}
+
+        if not self.args.keep_alive:
+            headers["Connection"] = "close"
+
+        if self.connection is None:
+            self.connect()
+
+        self.connection.request("GET", path, headers=headers)
+        response = self.connection.getresponse()
+        response.read()
+
+        if not self.args.keep_alive or response.getheader("Connection") == "close":
+            self.connection.close()
+            self.connection = None
+
+        return response.status
+
+    def run(self):
+        while not self.stopped:
+            path = self.random.choices(self.endpoints, self.weights)[0]
+            start = time.monotonic()
+
+            try:
+                status = self.request(path)
+            except (OSError, http.client.HTTPException):
+                status = None
+                if self.connection is not None:
+                    self.connection.close()
+                    self.connection = None
+
+            latency = time.monotonic() - start
+
+            if not self.recording:
+                continue
+
+            if status is None:
+                self.failures += 1
+            else:
+                self.statuses[status] = self.statuses.get(status, 0) + 1
+                self.latencies.append(latency)
+
+        if self.connection is not None:
+            self.connection.close()
+
+
+def run_load(args):
+    endpoints, weights = parse_mix(args.mix)
+    workers = [Worker(args, endpoints, weights, args.seed + i) for i in range(args.concurrency)]
+    pid = args.agent_pid or find_agent_pid()
+
+    for worker in workers:
+        worker.start()
+
+    time.sleep(args.warmup)
+
+    cpu_start = read_cpu_seconds(pid)
+    start = time.monotonic()
+
+    for worker in workers:
+        worker.recording = True
+
+    time.sleep(args.duration)
+
+    for worker in workers:
+        worker.recording = False
+
+    elapsed = time.monotonic() - start
+    cpu_end = read_cpu_seconds(pid)
+
+    for worker in workers:
+        worker.stopped = True
+
+    for worker in workers:
+        worker.join(args.timeout + 1)
+
+    latencies = sorted(latency for worker in workers for latency in worker.latencies)
+    statuses = {}
+
+    for worker in workers:
+        for status, count in worker.statuses.items():
+            statuses[str(status)] = statuses.get(str(status), 0) + count
+
+    failures = sum(worker.failures for worker in workers)
+    total = len(latencies) + failures
+    errors = failures + sum(count for status, count in statuses.items() if not status.startswith("2"))
+
+    return {
+        "config": {
+            "concurrency": args.concurrency,
+            "keep_alive": args.keep_alive,
+            "mix": args.mix,
+            "accept": args.accept,
+            "duration": args.duration,
+            "seed": args.seed,
+        },
+        "requests": total,
+        "qps": total / elapsed if elapsed > 0 else 0.0,
+        "latency_ms": {
+            "p50": percentile(latencies, 0.50) * 1000,
+            "p99": percentile(latencies, 0.99) * 1000,
+            "p999": percentile(latencies, 0.999) * 1000,
+            "max": (latencies[-1] if latencies else 0.0) * 1000,
+        },
+        "statuses": statuses,
+        "connection_failures": failures,
+        "error_rate": errors / total if total else 0.0,
+        "agent_cpu": (cpu_end - cpu_start) / elapsed if cpu_start is not None and cpu_end is not None else None,
+    }
+
+
+def print_report(report):
+    latency = report["latency_ms"]
+
+    print(" requests : {} ".format(report["requests"]))
+    print(" qps : {:.1f} ".format(report["qps"]))
+    print(" latency ms : p50 {:.2f}, p99 {:.2f}, p999 {:.2f}, max {:.2f} ".format(latency["p50"], latency["p99"],
+                                                                                  latency["p999"], latency["max"]))
+    print(" statuses : {}, connection failures {} ".format(report["statuses"], report["connection_failures"]))
+    print(" error rate : {:.4f} ".format(report["error_rate"]))
+
+    if report["agent_cpu"] is not None:
+        print(" agent cpu : {:.1f}% ".format(report["agent_cpu"] * 100))
+
+
+def check_regression(report, baseline, max_regression):
+    regressions = []
+
+    if report["qps"] < baseline["qps"] * (1 - max_regression):
+        regressions.append("qps {:.1f} < baseline {:.1f}".format(report["qps"], baseline["qps"]))
+
+    for key in ["p50", "p99"]:
+        value = report["latency_ms"][key]
+        limit = baseline["latency_ms"][key] * (1 + max_regression)
+
+        if value > limit:
+            regressions.append("{} {:.2f}ms > baseline {:.2f}ms".format(key, value, baseline["latency_ms"][key]))
+
+    if baseline.get("agent_cpu") and report["agent_cpu"] is not None:
+        # CPU per request, so that a faster build serving more requests is not reported.
+        cost = report["agent_cpu"] / max(report["qps"], 1e-9)
+        baseline_cost = baseline["agent_cpu"] / max(baseline["qps"], 1e-9)
+
+        if cost > baseline_cost * (1 + max_regression):
+            regressions.append("cpu per request {:.3g}s > baseline {:.3g}s".format(cost, baseline_cost))
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load test of the otbr rest server.")
+    parser.add_argument("--host", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8081)
+    parser.add_argument("--concurrency", type=int, default=16, help="number of concurrent clients")
+    parser.add_argument("--duration", type=float, default=30, help="seconds to measure")
+    parser.add_argument("--warmup", type=float, default=3, help="seconds to run before measuring")
+    parser.add_argument("--keep-alive", dest="keep_alive", action="store_true", default=True)
+    parser.add_argument("--no-keep-alive", dest="keep_alive", action="store_false")
+    parser.add_argument("--mix", default=DEFAULT_MIX, help="weighted endpoints, e.g. /node=4,/diagnostics=1")
+    parser.add_argument("--accept", default="application/json", help="Accept header of the requests")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--timeout", type=float, default=10, help="seconds to wait for a response")
+    parser.add_argument("--agent-pid", type=int, default=None, help="pid of otbr-agent, found with pgrep by default")
+    parser.add_argument("--output", help="file to save the report to, as JSON")
+    parser.add_argument("--baseline", help="report of an earlier run to compare with")
+    parser.add_argument("--max-regression", type=float, default=0.2, help="allowed ratio of regression")
+    parser.add_argument("--max-error-rate", type=float, default=0.0, help="allowed ratio of failed requests")
+    args = parser.parse_args()
+
+    # Fail early with a clear message if the server is not up.
+    socket.create_connection((args.host, args.port), args.timeout).close()
+
+    report = run_load(args)
+    print_report(report)
+
+    if args.output:
+        with open(args.output, "w") as output:
+            json.dump(report, output, indent=2, sort_keys=True)
+
+    status = 0
+
+    if report["requests"] == 0 or report["error_rate"] > args.max_error_rate:
+        print(" error rate {:.4f} is over {:.4f} ".format(report["error_rate"], args.max_error_rate))
+        status = 1
+
+    if args.baseline:
+        with open(args.baseline) as baseline:
+            regressions = check_regression(report, json.load(baseline), args.max_regression)
+
+        for regression in regressions:
+            print(" regression : {} ".format(regression))
+
+        if regressions:
+            status = 1
+
+    return status
+
+
+if __name__ == '__main__':
+    sys.exit(main())
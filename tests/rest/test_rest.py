@@ -29,9 +29,12 @@
 
 import urllib.request
 import urllib.error
+import gzip
+import http.client
 import ipaddress
 import json
 import re
+import time
 from threading import Thread
 
 rest_api_addr = "http://0.0.0.0:8081"
@@ -296,6 +299,18 @@ def node_ext_panid_check(data):
     return True
 
 
+def mainloop_stats_check(data):
+    assert data is not None
+
+    assert (type(data) == dict)
+    assert data["Iterations"] > 0
+    assert data["TimerWakeups"] <= data["Iterations"]
+    assert data.get("TimerWakeupsPerSecond", 0) >= 0
+    assert "poll" in data["Latencies"]
+
+    return True
+
+
 def node_test(thread_num):
     url = rest_api_addr + "/node"
 
@@ -406,6 +421,18 @@ def node_ext_panid_test(thread_num):
     print(" /node/ext-panid : all {}, valid {} ".format(thread_num, valid))
 
 
+def mainloop_stats_test(thread_num):
+    url = rest_api_addr + "/mainloop-stats"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [mainloop_stats_check(data) for data in response_data].count(True)
+
+    print(" /mainloop-stats : all {}, valid {} ".format(thread_num, valid))
+
+
 def diagnostics_test(thread_num):
     url = rest_api_addr + "/diagnostics"
 
@@ -428,6 +455,59 @@ def diagnostics_test(thread_num):
         thread_num, has_content, valid))
 
 
+def diagnostics_timeout_test():
+    url = rest_api_addr + "/diagnostics?timeout=500"
+
+    start = time.time()
+    data = [None]
+    get_data_from_url(url, data, 0)
+    assert time.time() - start < 2
+    assert diagnostics_check(data[0]) > 0
+
+    get_error_from_url(rest_api_addr + "/diagnostics?timeout=abc", data, 0)
+    assert data[0].code == 400
+
+    print(" /diagnostics?timeout : valid 1 ")
+
+
+def batch_test():
+    url = rest_api_addr + "/batch?resources=/node/rloc16,/node/state,/node"
+
+    data = [None]
+    get_data_from_url(url, data, 0)
+    assert node_rloc16_check(data[0]["/node/rloc16"])
+    assert node_state_check(data[0]["/node/state"])
+    assert node_check(data[0]["/node"])
+
+    get_error_from_url(rest_api_addr + "/batch", data, 0)
+    assert data[0].code == 400
+
+    for resources in ("/node/rloc16,,/node", "/node/rloc16,", "/node,/node"):
+        get_error_from_url(rest_api_addr + "/batch?resources=" + resources,
+                           data, 0)
+        assert data[0].code == 400
+
+    print(" /batch : valid 1 ")
+
+
+def keep_alive_test(request_num):
+    connection = http.client.HTTPConnection("0.0.0.0", 8081)
+    valid = 0
+
+    for i in range(request_num):
+        connection.request("GET", "/node/state")
+        response = connection.getresponse()
+        assert response.status == 200
+        assert response.getheader("Connection") == "keep-alive"
+        json.loads(response.read())
+        valid += 1
+
+    connection.close()
+
+    print(" keep-alive /node/state : all {}, valid {} ".format(
+        request_num, valid))
+
+
 def error_test(thread_num):
     url = rest_api_addr + "/hello"
 
@@ -440,6 +520,128 @@ def error_test(thread_num):
     print(" /v1/hello : all {}, valid {} ".format(thread_num, valid))
 
 
+def events_test():
+    connection = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    connection.request("GET", "/events")
+    response = connection.getresponse()
+    assert response.status == 200
+    assert response.getheader("Content-Type") == "text/event-stream"
+    assert response.getheader("Content-Length") is None
+
+    connection.close()
+
+    print(" /events : valid 1 ")
+
+
+def cbor_test():
+    connection = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    connection.request("GET", "/node/rloc16", headers={"Accept": "application/cbor"})
+    response = connection.getresponse()
+    body = response.read()
+    assert response.status == 200
+    assert response.getheader("Content-Type") == "application/cbor"
+    # An unsigned integer
+    assert body[0] >> 5 == 0
+
+    connection.request("GET", "/node/rloc16")
+    response = connection.getresponse()
+    assert response.getheader("Content-Type") == "application/json"
+    assert node_rloc16_check(json.loads(response.read()))
+
+    # Repeated Accept headers are combined into one list.
+    connection.putrequest("GET", "/node/rloc16")
+    connection.putheader("Accept", "text/plain")
+    connection.putheader("Accept", "application/cbor")
+    connection.endheaders()
+    response = connection.getresponse()
+    response.read()
+    assert response.getheader("Content-Type") == "application/cbor"
+
+    connection.close()
+
+    print(" cbor : valid 1 ")
+
+
+def gzip_test():
+    connection = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    connection.request("GET", "/diagnostics", headers={"Accept-Encoding": "gzip"})
+    response = connection.getresponse()
+    body = response.read()
+    assert response.status == 200
+
+    # Only bodies larger than the threshold are compressed, and only if the server is built with gzip.
+    if response.getheader("Content-Encoding") == "gzip":
+        assert response.getheader("Content-Length") is None
+        body = gzip.decompress(body)
+    assert diagnostics_check(json.loads(body)) > 0
+
+    connection.close()
+
+    print(" gzip : valid 1 ")
+
+
+def metrics_test():
+    connection = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    connection.request("GET", "/metrics")
+    response = connection.getresponse()
+    body = response.read().decode()
+    assert response.status == 200
+    assert response.getheader("Content-Type").startswith("text/plain")
+
+    for metric in [
+            "otbr_link_tx_frames_total", "otbr_ip6_rx_success_packets_total",
+            "otbr_mainloop_iterations_total", "otbr_rest_connections",
+            "otbr_thread_netif_rx_bytes_per_second"
+    ]:
+        assert re.search(r'^' + metric + r' \d+$', body, re.MULTILINE) is not None
+
+    connection.close()
+
+    print(" /metrics : valid 1 ")
+
+
+def node_counters_test():
+    connection = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    connection.request("GET", "/node/counters?minutes=1")
+    response = connection.getresponse()
+    data = json.loads(response.read().decode())
+    assert response.status == 200
+    assert data["IntervalMs"] > 0
+
+    for interval in data["Intervals"]:
+        assert interval["DurationMs"] > 0
+        assert interval["AgeMs"] <= 60000 + data["IntervalMs"]
+        assert "TxTotal" in interval["MacCounters"]
+        assert "RxSuccess" in interval["Ip6Counters"]
+
+    connection.request("GET", "/node/counters?minutes=abc")
+    response = connection.getresponse()
+    response.read()
+    assert response.status == 400
+
+    connection.close()
+
+    print(" /node/counters : valid 1 ")
+
+
+def uri_too_long_test():
+    connection = http.client.HTTPConnection("0.0.0.0", 8081)
+
+    connection.request("GET", "/node/" + "a" * 1024)
+    response = connection.getresponse()
+    assert response.status == 414
+    assert response.getheader("Connection") == "close"
+
+    connection.close()
+
+    print(" uri too long : valid 1 ")
+
+
 def main():
     node_test(200)
     node_rloc_test(200)
@@ -450,8 +652,18 @@ def main():
     node_leader_data_test(200)
     node_num_of_router_test(200)
     node_ext_panid_test(200)
+    mainloop_stats_test(20)
     diagnostics_test(20)
+    diagnostics_timeout_test()
+    keep_alive_test(20)
     error_test(10)
+    uri_too_long_test()
+    events_test()
+    batch_test()
+    cbor_test()
+    gzip_test()
+    metrics_test()
+    node_counters_test()
 
     return 0
 
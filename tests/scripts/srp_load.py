@@ -0,0 +1,455 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+# SRP registration load simulation.
+#
+# Runs otbr-agent against a simulated RCP and attaches simulated OpenThread
+# CLI nodes as SRP clients, which all register at the same time, as after a
+# power cut. Each round measures:
+#   - the latency from starting the SRP clients to their hosts being
+#     registered,
+#   - the latency from starting the SRP clients to their services being
+#     visible on the local mDNS daemon (Avahi or mDNSResponder),
+#   - the SRP clients not registered in time,
+#   - CPU and peak memory of otbr-agent.
+#
+# The simulation platform limits the number of nodes of a network, so larger
+# loads are made by registering more services per client.
+#
+# Usage:
+#   sudo ./srp_load.py --clients 16 --services 8 --rounds 3 --output report.json
+#
+
+import argparse
+import json
+import os
+import queue
+import re
+import shutil
+import subprocess
+import sys
+import threading
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TOP_BUILDDIR = os.path.abspath(os.environ.get("top_builddir", os.path.join(SCRIPT_DIR, "..", "..")))
+
+SERVICE_TYPE = "_srpload._udp"
+SERVICE_PORT = 12345
+
+# The node id of the RCP of otbr-agent, the SRP clients follow it.
+LEADER_NODE_ID = 1
+
+
+def percentile(sorted_values, ratio):
+    if not sorted_values:
+        return None
+
+    index = min(len(sorted_values) - 1, max(0, int(len(sorted_values) * ratio + 0.5) - 1))
+
+    return sorted_values[index]
+
+
+def summarize(latencies):
+    latencies = sorted(latencies)
+
+    return {
+        "count": len(latencies),
+        "p50": percentile(latencies, 0.50),
+        "p90": percentile(latencies, 0.90),
+        "p99": percentile(latencies, 0.99),
+        "max": latencies[-1] if latencies else None,
+    }
+
+
+class LineReader(threading.Thread):
+    """Reads the lines of a process output into a queue, with the time each one is received."""
+
+    def __init__(self, stream):
+        super().__init__(daemon=True)
+        self.stream = stream
+        self.lines = queue.Queue()
+        self.start()
+
+    def run(self):
+        for line in self.stream:
+            self.lines.put((time.monotonic(), line.rstrip("\r\n")))
+
+
+class CliNode:
+    """A simulated OpenThread CLI node."""
+
+    def __init__(self, ot_cli, node_id):
+        self.node_id = node_id
+        self.process = subprocess.Popen([ot_cli, str(node_id)],
+                                        stdin=subprocess.PIPE,
+                                        stdout=subprocess.PIPE,
+                                        stderr=subprocess.DEVNULL,
+                                        universal_newlines=True,
+                                        bufsize=1)
+        self.reader = LineReader(self.process.stdout)
+
+    def command(self, command, timeout=10):
+        self.process.stdin.write(command + "\n")
+        self.process.stdin.flush()
+
+        output = []
+        deadline = time.monotonic() + timeout
+
+        while True:
+            try:
+                _, line = self.reader.lines.get(timeout=max(0, deadline - time.monotonic()))
+            except queue.Empty:
+                raise RuntimeError("node {}: {!r} timed out".format(self.node_id, command))
+
+            # Strip the prompt, the CLI prints it without a newline.
+            line = re.sub(r"^(> )+", "", line)
+
+            if line == "Done":
+                return output
+
+            if line.startswith("Error"):
+                raise RuntimeError("node {}: {!r} failed: {}".format(self.node_id, command, line))
+
+            if line and line != command:
+                output.append(line)
+
+    def close(self):
+        self.process.kill()
+        self.process.wait()
+
+
+class Agent:
+    """The otbr-agent under test."""
+
+    def __init__(self, args):
+        self.ot_ctl = args.ot_ctl
+        self.process = subprocess.Popen([
+            args.agent, "-I", args.interface, "-d", str(args.log_level),
+            "spinel+hdlc+forkpty://{}?forkpty-arg={}".format(args.ot_rcp, LEADER_NODE_ID)
+        ])
+        self.pid = None
+
+        # The process started is the agent unless a wrapper like sudo is used.
+        for _ in range(50):
+            try:
+                self.pid = int(subprocess.check_output(["pgrep", "-n", "-x", "otbr-agent"]).split()[0])
+                break
+            except subprocess.CalledProcessError:
+                time.sleep(0.1)
+
+    def ctl(self, *command):
+        return subprocess.check_output([self.ot_ctl] + list(command), universal_newlines=True).splitlines()
+
+    def read_usage(self):
+        """Returns the CPU seconds and the resident memory in KiB of the agent."""
+        try:
+            with open("/proc/{}/stat".format(self.pid)) as stat:
+                fields = stat.read().rsplit(")", 1)[1].split()
+            with open("/proc/{}/status".format(self.pid)) as status:
+                rss = int(re.search(r"^VmRSS:\s+(\d+)", status.read(), re.MULTILINE).group(1))
+        except (OSError, TypeError, AttributeError):
+            return None, None
+
+        return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK"), rss
+
+    def close(self):
+        self.process.terminate()
+
+        try:
+            self.process.wait(10)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+            self.process.wait()
+
+
+class UsageSampler(threading.Thread):
+    """Samples the agent CPU and memory in the background."""
+
+    def __init__(self, agent, interval=0.2):
+        super().__init__(daemon=True)
+        self.agent = agent
+        self.interval = interval
+        self.stopped = threading.Event()
+        self.peak_rss = 0
+        self.cpu_start, _ = agent.read_usage()
+        self.cpu_end = self.cpu_start
+        self.start_time = time.monotonic()
+        self.end_time = self.start_time
+        self.start()
+
+    def run(self):
+        while not self.stopped.wait(self.interval):
+            cpu, rss = self.agent.read_usage()
+
+            if cpu is not None:
+                self.cpu_end = cpu
+                self.end_time = time.monotonic()
+                self.peak_rss = max(self.peak_rss, rss)
+
+    def stop(self):
+        self.stopped.set()
+        self.join()
+
+        if self.cpu_start is None or self.end_time <= self.start_time:
+            return {"cpu_seconds": None, "cpu_ratio": None, "peak_rss_kib": None}
+
+        cpu = self.cpu_end - self.cpu_start
+
+        return {
+            "cpu_seconds": cpu,
+            "cpu_ratio": cpu / (self.end_time - self.start_time),
+            "peak_rss_kib": self.peak_rss,
+        }
+
+
+class MdnsBrowser:
+    """Records the time each service instance of the test type becomes visible on mDNS."""
+
+    def __init__(self):
+        if shutil.which("avahi-browse"):
+            command = ["avahi-browse", "-prk", SERVICE_TYPE]
+            self.pattern = re.compile(r"^=;[^;]*;[^;]*;([^;]+);" + re.escape(SERVICE_TYPE) + ";")
+        elif shutil.which("dns-sd"):
+            command = ["dns-sd", "-B", SERVICE_TYPE, "local."]
+            self.pattern = re.compile(r"\sAdd\s.*" + re.escape(SERVICE_TYPE) + r"\.\s+(.+)$")
+        else:
+            raise RuntimeError("neither avahi-browse nor dns-sd is found")
+
+        self.process = subprocess.Popen(command,
+                                        stdout=subprocess.PIPE,
+                                        stderr=subprocess.DEVNULL,
+                                        universal_newlines=True,
+                                        bufsize=1)
+        self.reader = LineReader(self.process.stdout)
+        self.visible = {}
+
+    def poll(self):
+        while True:
+            try:
+                timestamp, line = self.reader.lines.get_nowait()
+            except queue.Empty:
+                return
+
+            match = self.pattern.search(line)
+
+            if match:
+                # avahi-browse escapes the instance names in parsable mode.
+                name = re.sub(r"\\(\d{3})", lambda m: chr(int(m.group(1))), match.group(1).strip())
+                self.visible.setdefault(name, timestamp)
+
+    def reset(self):
+        self.poll()
+        self.visible.clear()
+
+    def close(self):
+        self.process.kill()
+        self.process.wait()
+
+
+def form_network(agent):
+    agent.ctl("factoryreset")
+    time.sleep(2)
+    agent.ctl("dataset", "init", "new")
+    agent.ctl("dataset", "commit", "active")
+    agent.ctl("ifconfig", "up")
+    agent.ctl("thread", "start")
+
+    for _ in range(30):
+        if agent.ctl("state")[0] == "leader":
+            break
+        time.sleep(1)
+    else:
+        raise RuntimeError("the agent did not become leader")
+
+    agent.ctl("srp", "server", "enable")
+
+    return agent.ctl("dataset", "active", "-x")[0]
+
+
+def attach_clients(args, dataset):
+    clients = []
+
+    for i in range(args.clients):
+        client = CliNode(args.ot_cli, LEADER_NODE_ID + 1 + i)
+        client.command("dataset set active {}".format(dataset))
+        client.command("ifconfig up")
+        # Children keep the leader from being slowed down by router upgrades of all clients.
+        client.command("routerselectionjitter 120")
+        client.command("thread start")
+        clients.append(client)
+
+    deadline = time.monotonic() + args.attach_timeout
+
+    for client in clients:
+        while client.command("state")[0] not in ("child", "router", "leader"):
+            if time.monotonic() > deadline:
+                raise RuntimeError("node {} did not attach".format(client.node_id))
+            time.sleep(0.5)
+
+    return clients
+
+
+def configure_clients(args, clients):
+    for index, client in enumerate(clients):
+        host = "load-host-{}".format(index)
+
+        client.command("srp client host name {}".format(host))
+        client.command("srp client host address {}".format(client.command("ipaddr mleid")[0]))
+
+        for service in range(args.services):
+            client.command("srp client service add {}-{} {} {}".format(host, service, SERVICE_TYPE, SERVICE_PORT))
+
+
+def run_round(args, agent, clients, browser):
+    expected = {
+        "load-host-{}-{}".format(index, service) for index in range(len(clients)) for service in range(args.services)
+    }
+    registered = {}
+
+    browser.reset()
+    sampler = UsageSampler(agent)
+    start = time.monotonic()
+
+    # All clients start at once, like devices re-registering after a power cut.
+    for client in clients:
+        client.command("srp client autostart enable")
+
+    deadline = start + args.timeout
+
+    while time.monotonic() < deadline:
+        browser.poll()
+
+        for index, client in enumerate(clients):
+            if index not in registered and "state:Registered" in " ".join(client.command("srp client host")):
+                registered[index] = time.monotonic() - start
+
+        if len(registered) == len(clients) and expected.issubset(browser.visible):
+            break
+
+        time.sleep(args.poll_interval)
+
+    usage = sampler.stop()
+    visible = [browser.visible[name] - start for name in expected if name in browser.visible]
+
+    # Stop the clients and remove their registrations, so that the next round registers from scratch.
+    for client in clients:
+        client.command("srp client autostart disable")
+        client.command("srp client stop")
+
+    agent.ctl("srp", "server", "disable")
+    time.sleep(1)
+    agent.ctl("srp", "server", "enable")
+
+    return {
+        "hosts_registered": summarize(registered.values()),
+        "services_visible": summarize(visible),
+        "hosts_timed_out": len(clients) - len(registered),
+        "services_not_visible": len(expected) - len(visible),
+        "agent": usage,
+    }
+
+
+def print_round(index, result):
+    def format_summary(summary):
+        if not summary["count"]:
+            return "none"
+        return "p50 {:.2f}s, p90 {:.2f}s, p99 {:.2f}s, max {:.2f}s".format(summary["p50"], summary["p90"],
+                                                                          summary["p99"], summary["max"])
+
+    agent = result["agent"]
+
+    print(" round {} ".format(index))
+    print("  hosts registered : {}, {} timed out ".format(format_summary(result["hosts_registered"]),
+                                                           result["hosts_timed_out"]))
+    print("  services visible on mDNS : {}, {} missing ".format(format_summary(result["services_visible"]),
+                                                                 result["services_not_visible"]))
+
+    if agent["cpu_seconds"] is not None:
+        print("  agent : cpu {:.2f}s ({:.1f}%), peak rss {} KiB ".format(agent["cpu_seconds"], agent["cpu_ratio"] * 100,
+                                                                        agent["peak_rss_kib"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SRP registration load simulation.")
+    parser.add_argument("--clients", type=int, default=8, help="number of simulated SRP client nodes")
+    parser.add_argument("--services", type=int, default=4, help="number of services of each client")
+    parser.add_argument("--rounds", type=int, default=3, help="number of simultaneous registration rounds")
+    parser.add_argument("--timeout", type=float, default=120, help="seconds to wait for each round")
+    parser.add_argument("--attach-timeout", type=float, default=300, help="seconds to wait for clients to attach")
+    parser.add_argument("--poll-interval", type=float, default=0.2, help="seconds between polls of the clients")
+    parser.add_argument("--agent", default=os.path.join(TOP_BUILDDIR, "src", "agent", "otbr-agent"))
+    parser.add_argument("--ot-ctl", default=os.path.join(TOP_BUILDDIR, "third_party", "openthread", "repo", "src",
+                                                         "posix", "ot-ctl"))
+    parser.add_argument("--ot-rcp", default=shutil.which("ot-rcp"))
+    parser.add_argument("--ot-cli", default=shutil.which("ot-cli-ftd"))
+    parser.add_argument("--interface", default="wpan0")
+    parser.add_argument("--log-level", type=int, default=5)
+    parser.add_argument("--output", help="file to save the report to, as JSON")
+    args = parser.parse_args()
+
+    agent = None
+    browser = None
+    clients = []
+    report = {"clients": args.clients, "services_per_client": args.services, "rounds": []}
+    status = 0
+
+    try:
+        agent = Agent(args)
+        time.sleep(2)
+        dataset = form_network(agent)
+        clients = attach_clients(args, dataset)
+        configure_clients(args, clients)
+        browser = MdnsBrowser()
+
+        for index in range(args.rounds):
+            result = run_round(args, agent, clients, browser)
+            report["rounds"].append(result)
+            print_round(index, result)
+
+            if result["hosts_timed_out"] or result["services_not_visible"]:
+                status = 1
+    finally:
+        if browser is not None:
+            browser.close()
+
+        for client in clients:
+            client.close()
+
+        if agent is not None:
+            agent.close()
+
+    if args.output:
+        with open(args.output, "w") as output:
+            json.dump(report, output, indent=2, sort_keys=True)
+
+    return status
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,219 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a micro-benchmark of the CRC16 computations.
+ *
+ * The benchmark compares the former bit-by-bit CRC16 computation with the table-driven ones, byte by byte and
+ * sliced, over joiner IDs as used by the steering data and over larger buffers. It fails if the results differ.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils/crc16.hpp"
+#include "utils/steering_data.hpp"
+
+using namespace otbr;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// The former bit-by-bit implementation of `Crc16::Update()`, as the baseline.
+uint16_t UpdateBitwise(uint16_t aPolynomial, uint16_t aCrc, const uint8_t *aData, size_t aLength)
+{
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aCrc = aCrc ^ static_cast<uint16_t>(aData[i] << 8);
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            aCrc = (aCrc & 0x8000) ? static_cast<uint16_t>(static_cast<uint16_t>(aCrc << 1) ^ aPolynomial)
+                                   : static_cast<uint16_t>(aCrc << 1);
+        }
+    }
+
+    return aCrc;
+}
+
+uint16_t UpdateBytewise(Crc16::Polynomial aPolynomial, const uint8_t *aData, size_t aLength)
+{
+    Crc16 crc(aPolynomial);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        crc.Update(aData[i]);
+    }
+
+    return crc.Get();
+}
+
+uint16_t UpdateSliced(Crc16::Polynomial aPolynomial, const uint8_t *aData, size_t aLength)
+{
+    Crc16 crc(aPolynomial);
+
+    crc.Update(aData, aLength);
+
+    return crc.Get();
+}
+
+struct Result
+{
+    double   mNanosecondsPerByte;
+    uint16_t mChecksum;
+};
+
+// Runs `aCompute` over every `aChunkLength` bytes of `aData`, `aIterations` times.
+template <typename Compute>
+Result Measure(const std::vector<uint8_t> &aData, size_t aChunkLength, uint32_t aIterations, Compute aCompute)
+{
+    Result            result = {0, 0};
+    Clock::time_point start  = Clock::now();
+
+    for (uint32_t iteration = 0; iteration < aIterations; iteration++)
+    {
+        for (size_t offset = 0; offset + aChunkLength <= aData.size(); offset += aChunkLength)
+        {
+            result.mChecksum ^= aCompute(&aData[offset], aChunkLength);
+        }
+    }
+
+    result.mNanosecondsPerByte = std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+                                 (static_cast<double>(aData.size() / aChunkLength * aChunkLength) * aIterations);
+
+    return result;
+}
+
+bool RunCase(const char *aName, Crc16::Polynomial aPolynomial, size_t aChunkLength, const std::vector<uint8_t> &aData,
+             uint32_t aIterations)
+{
+    Result bitwise = Measure(aData, aChunkLength, aIterations, [aPolynomial](const uint8_t *aBytes, size_t aLength) {
+        return UpdateBitwise(aPolynomial, 0, aBytes, aLength);
+    });
+    Result bytewise = Measure(aData, aChunkLength, aIterations, [aPolynomial](const uint8_t *aBytes, size_t aLength) {
+        return UpdateBytewise(aPolynomial, aBytes, aLength);
+    });
+    Result sliced = Measure(aData, aChunkLength, aIterations, [aPolynomial](const uint8_t *aBytes, size_t aLength) {
+        return UpdateSliced(aPolynomial, aBytes, aLength);
+    });
+    bool match;
+
+    match = (bitwise.mChecksum == bytewise.mChecksum && bitwise.mChecksum == sliced.mChecksum);
+    printf("%-24s %10.3f %10.3f %10.3f %8.1fx %s\n", aName, bitwise.mNanosecondsPerByte, bytewise.mNanosecondsPerByte,
+           sliced.mNanosecondsPerByte, bitwise.mNanosecondsPerByte / sliced.mNanosecondsPerByte,
+           match ? "" : "MISMATCH");
+
+    return match;
+}
+
+void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "    -i, --iterations <n>    Number of passes over the data, default 1000.\n"
+            "    -j, --joiners <n>       Number of joiner IDs, default 512.\n"
+            "    -h, --help              Print this help.\n",
+            aProgram);
+}
+
+bool ParseUint32(const char *aString, uint32_t &aValue)
+{
+    char *        end;
+    unsigned long value = strtoul(aString, &end, 0);
+
+    aValue = static_cast<uint32_t>(value);
+
+    return *aString != '\0' && *end == '\0' && value > 0 && value <= UINT32_MAX;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    static const option kOptions[] = {
+        {"iterations", required_argument, nullptr, 'i'},
+        {"joiners", required_argument, nullptr, 'j'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    uint32_t             iterations = 1000;
+    uint32_t             numJoiners = 512;
+    std::vector<uint8_t> data;
+    bool                 match = true;
+    int                  opt;
+
+    while ((opt = getopt_long(argc, argv, "i:j:h", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case 'i':
+            valid = ParseUint32(optarg, iterations);
+            break;
+        case 'j':
+            valid = ParseUint32(optarg, numJoiners);
+            break;
+        case 'h':
+            PrintUsage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            valid = false;
+            break;
+        }
+
+        if (!valid)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    data.resize(static_cast<size_t>(numJoiners) * SteeringData::kSizeJoinerId);
+    srand(0);
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(rand());
+    }
+
+    printf("%-24s %10s %10s %10s %9s\n", "case (ns/byte)", "bitwise", "bytewise", "sliced", "speedup");
+    match &= RunCase("ccitt joiner-id", Crc16::kCcitt, SteeringData::kSizeJoinerId, data, iterations);
+    match &= RunCase("ansi joiner-id", Crc16::kAnsi, SteeringData::kSizeJoinerId, data, iterations);
+    match &= RunCase("ccitt buffer", Crc16::kCcitt, data.size(), data, iterations);
+    match &= RunCase("ansi buffer", Crc16::kAnsi, data.size(), data, iterations);
+    match &= RunCase("ccitt odd-length", Crc16::kCcitt, 13, data, iterations);
+
+    return match ? EXIT_SUCCESS : EXIT_FAILURE;
+}
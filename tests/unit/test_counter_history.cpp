@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "agent/counter_history.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::Ncp::CounterHistory;
+
+namespace {
+
+CounterHistory::Sample MakeSample(Timepoint aTime, uint32_t aTxTotal, uint32_t aRxSuccess)
+{
+    CounterHistory::Sample sample = {};
+
+    sample.mTime                  = aTime;
+    sample.mMacCounters.mTxTotal  = aTxTotal;
+    sample.mIpCounters.mRxSuccess = aRxSuccess;
+    sample.mCcaFailureRate        = static_cast<uint16_t>(aTxTotal);
+
+    return sample;
+}
+
+} // namespace
+
+TEST_GROUP(CounterHistory){};
+
+TEST(CounterHistory, TestIntervals)
+{
+    CounterHistory history(4);
+    Timepoint      start = Timepoint() + Milliseconds(1000);
+
+    CHECK(history.GetIntervals(Milliseconds::zero()).empty());
+
+    history.Record(MakeSample(start, 10, 100));
+    CHECK(history.GetIntervals(Milliseconds::zero()).empty());
+
+    history.Record(MakeSample(start + Milliseconds(1000), 30, 150));
+    history.Record(MakeSample(start + Milliseconds(3000), 90, 150));
+
+    std::vector<CounterHistory::Interval> intervals = history.GetIntervals(Milliseconds::zero());
+
+    CHECK_EQUAL(2u, intervals.size());
+    CHECK_EQUAL(1000, intervals[0].mDuration.count());
+    CHECK_EQUAL(20u, intervals[0].mMacCounters.mTxTotal);
+    CHECK_EQUAL(50u, intervals[0].mIpCounters.mRxSuccess);
+    CHECK_EQUAL(30u, intervals[0].mCcaFailureRate);
+
+    // The rate of a counter is its increase over the duration of the interval.
+    CHECK_EQUAL(2000, intervals[1].mDuration.count());
+    CHECK_EQUAL(60u, intervals[1].mMacCounters.mTxTotal);
+    CHECK_EQUAL(0u, intervals[1].mIpCounters.mRxSuccess);
+    CHECK_EQUAL(30.0, intervals[1].mMacCounters.mTxTotal * 1000.0 / intervals[1].mDuration.count());
+    CHECK(intervals[1].mEnd == start + Milliseconds(3000));
+
+    // Only the intervals ending after the start of the period are returned.
+    intervals = history.GetIntervals(Milliseconds(1500));
+    CHECK_EQUAL(1u, intervals.size());
+    CHECK_EQUAL(60u, intervals[0].mMacCounters.mTxTotal);
+
+    history.Clear();
+    CHECK(history.GetIntervals(Milliseconds::zero()).empty());
+}
+
+TEST(CounterHistory, TestWrapAround)
+{
+    CounterHistory history(2);
+    Timepoint      start = Timepoint() + Milliseconds(1000);
+
+    CHECK_EQUAL(2u, history.GetCapacity());
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        history.Record(MakeSample(start + Milliseconds(1000 * i), i * i, 0));
+    }
+
+    // The oldest intervals are dropped, the last two are between samples 7, 8 and 9.
+    std::vector<CounterHistory::Interval> intervals = history.GetIntervals(Milliseconds::zero());
+
+    CHECK_EQUAL(2u, intervals.size());
+    CHECK_EQUAL(15u, intervals[0].mMacCounters.mTxTotal);
+    CHECK_EQUAL(17u, intervals[1].mMacCounters.mTxTotal);
+    CHECK(intervals[0].mEnd == start + Milliseconds(8000));
+    CHECK(intervals[1].mEnd == start + Milliseconds(9000));
+}
+
+TEST(CounterHistory, TestCounterReset)
+{
+    CounterHistory history(4);
+    Timepoint      start = Timepoint() + Milliseconds(1000);
+
+    history.Record(MakeSample(start, 1000, 500));
+    history.Record(MakeSample(start + Milliseconds(1000), 7, 600));
+
+    // A counter which went backwards was reset, it counts from zero.
+    std::vector<CounterHistory::Interval> intervals = history.GetIntervals(Milliseconds::zero());
+
+    CHECK_EQUAL(1u, intervals.size());
+    CHECK_EQUAL(7u, intervals[0].mMacCounters.mTxTotal);
+    CHECK_EQUAL(100u, intervals[0].mIpCounters.mRxSuccess);
+}
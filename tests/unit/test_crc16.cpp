@@ -0,0 +1,70 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/crc16.hpp"
+
+TEST_GROUP(Crc16){};
+
+static uint16_t ComputeCrc16(otbr::Crc16::Polynomial aPolynomial, const char *aData, size_t aSplit)
+{
+    const uint8_t *data   = reinterpret_cast<const uint8_t *>(aData);
+    size_t         length = strlen(aData);
+    otbr::Crc16    crc(aPolynomial);
+
+    crc.Update(data, aSplit);
+    crc.Update(data + aSplit, length - aSplit);
+
+    return crc.Get();
+}
+
+TEST(Crc16, TestCheckValues)
+{
+    const char  kCheckData[] = "123456789";
+    otbr::Crc16 ccitt(otbr::Crc16::kCcitt);
+    otbr::Crc16 ansi(otbr::Crc16::kAnsi);
+
+    for (const char *c = kCheckData; *c != '\0'; c++)
+    {
+        ccitt.Update(static_cast<uint8_t>(*c));
+        ansi.Update(static_cast<uint8_t>(*c));
+    }
+
+    // CRC-16/XMODEM and CRC-16/UMTS check values.
+    CHECK_EQUAL(0x31c3, ccitt.Get());
+    CHECK_EQUAL(0xfee8, ansi.Get());
+
+    for (size_t split = 0; split <= sizeof(kCheckData) - 1; split++)
+    {
+        CHECK_EQUAL(0x31c3, ComputeCrc16(otbr::Crc16::kCcitt, kCheckData, split));
+        CHECK_EQUAL(0xfee8, ComputeCrc16(otbr::Crc16::kAnsi, kCheckData, split));
+    }
+}
@@ -178,6 +178,35 @@ TEST(DBusMessage, TestVectorMessage)
     dbus_message_unref(msg);
 }
 
+TEST(DBusMessage, TestFixedArrayReplacesValue)
+{
+    DBusMessage *                            msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<vector<int8_t>, vector<uint8_t>>   setVals({-1, 0, 1}, {});
+    tuple<vector<int8_t>, vector<uint8_t>>   getVals({}, {0xff});
+    tuple<array<string, 2>, vector<int32_t>> setStrings({"hello", "world"}, {});
+    tuple<vector<string>, vector<int32_t>>   getStrings({}, {1, 2});
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(setVals == getVals);
+
+    dbus_message_unref(msg);
+
+    msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setStrings) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getStrings) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(getStrings) == vector<string>({"hello", "world"}));
+    CHECK(std::get<1>(getStrings).empty());
+
+    dbus_message_unref(msg);
+}
+
 TEST(DBusMessage, TestArrayMessage)
 {
     DBusMessage *            msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -231,6 +260,31 @@ TEST(DBusMessage, TestStructMessage)
     dbus_message_unref(msg);
 }
 
+TEST(DBusMessage, TestStructArrayReusesContainer)
+{
+    DBusMessage *                 msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<vector<TestStruct>>     setVals({{1, 0xf0a, "test1"}, {2, 0xf0b, "test2"}});
+    tuple<vector<TestStruct>>     getVals({{7, 7, "stale1"}, {8, 8, "stale2"}, {9, 9, "stale3"}});
+    vector<TestStruct> &          structs = std::get<0>(getVals);
+    const TestStruct *            data;
+    vector<TestStruct>::size_type capacity;
+
+    structs.reserve(8);
+    data     = structs.data();
+    capacity = structs.capacity();
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(setVals == getVals);
+    CHECK(structs.data() == data);
+    CHECK(structs.capacity() == capacity);
+
+    dbus_message_unref(msg);
+}
+
 TEST(DBusMessage, TestOtbrChannelQuality)
 {
     DBusMessage *                                  msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -0,0 +1,254 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dbus/common/table_blob.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::DBus::ChildInfo;
+using otbr::DBus::CreateSealedMemfd;
+using otbr::DBus::DecodeTableBlob;
+using otbr::DBus::DecodeTableMemfd;
+using otbr::DBus::EncodeTableBlob;
+using otbr::DBus::kTableBlobHeaderSize;
+using otbr::DBus::NeighborInfo;
+
+static ChildInfo MakeChild(uint16_t aChildId)
+{
+    ChildInfo child;
+
+    child.mExtAddress         = 0x1122334455667700ull + aChildId;
+    child.mTimeout            = 240;
+    child.mAge                = 3;
+    child.mRloc16             = 0x2800 | aChildId;
+    child.mChildId            = aChildId;
+    child.mNetworkDataVersion = 7;
+    child.mLinkQualityIn      = 3;
+    child.mAverageRssi        = -40;
+    child.mLastRssi           = -128;
+    child.mFrameErrorRate     = 0xffff;
+    child.mMessageErrorRate   = 0x1234;
+    child.mRxOnWhenIdle       = (aChildId % 2) == 0;
+    child.mFullThreadDevice   = false;
+    child.mFullNetworkData    = true;
+    child.mIsStateRestoring   = (aChildId % 3) == 0;
+
+    return child;
+}
+
+static void CheckChild(const ChildInfo &aExpected, const ChildInfo &aActual)
+{
+    CHECK_EQUAL(aExpected.mExtAddress, aActual.mExtAddress);
+    CHECK_EQUAL(aExpected.mTimeout, aActual.mTimeout);
+    CHECK_EQUAL(aExpected.mAge, aActual.mAge);
+    CHECK_EQUAL(aExpected.mRloc16, aActual.mRloc16);
+    CHECK_EQUAL(aExpected.mChildId, aActual.mChildId);
+    CHECK_EQUAL(aExpected.mNetworkDataVersion, aActual.mNetworkDataVersion);
+    CHECK_EQUAL(aExpected.mLinkQualityIn, aActual.mLinkQualityIn);
+    CHECK_EQUAL(aExpected.mAverageRssi, aActual.mAverageRssi);
+    CHECK_EQUAL(aExpected.mLastRssi, aActual.mLastRssi);
+    CHECK_EQUAL(aExpected.mFrameErrorRate, aActual.mFrameErrorRate);
+    CHECK_EQUAL(aExpected.mMessageErrorRate, aActual.mMessageErrorRate);
+    CHECK_EQUAL(aExpected.mRxOnWhenIdle, aActual.mRxOnWhenIdle);
+    CHECK_EQUAL(aExpected.mFullThreadDevice, aActual.mFullThreadDevice);
+    CHECK_EQUAL(aExpected.mFullNetworkData, aActual.mFullNetworkData);
+    CHECK_EQUAL(aExpected.mIsStateRestoring, aActual.mIsStateRestoring);
+}
+
+TEST_GROUP(TableBlob){};
+
+TEST(TableBlob, TestChildTableRoundTrip)
+{
+    std::vector<ChildInfo> children;
+    std::vector<ChildInfo> decoded;
+    std::vector<uint8_t>   blob;
+
+    for (uint16_t i = 1; i <= 10; i++)
+    {
+        children.push_back(MakeChild(i));
+    }
+
+    EncodeTableBlob(children, blob);
+    CHECK_EQUAL(OTBR_ERROR_NONE, DecodeTableBlob(blob.data(), blob.size(), decoded));
+    CHECK_EQUAL(children.size(), decoded.size());
+
+    for (size_t i = 0; i < children.size(); i++)
+    {
+        CheckChild(children[i], decoded[i]);
+    }
+
+    children.clear();
+    EncodeTableBlob(children, blob);
+    CHECK_EQUAL(kTableBlobHeaderSize, blob.size());
+    CHECK_EQUAL(OTBR_ERROR_NONE, DecodeTableBlob(blob.data(), blob.size(), decoded));
+    CHECK_TRUE(decoded.empty());
+}
+
+TEST(TableBlob, TestNeighborTableRoundTrip)
+{
+    NeighborInfo              neighbor = {};
+    std::vector<NeighborInfo> neighbors;
+    std::vector<NeighborInfo> decoded;
+    std::vector<uint8_t>      blob;
+
+    neighbor.mExtAddress       = 0xdead00beef00cafeull;
+    neighbor.mAge              = 12;
+    neighbor.mRloc16           = 0x5c00;
+    neighbor.mLinkFrameCounter = 0x01020304;
+    neighbor.mMleFrameCounter  = 0xfffffffe;
+    neighbor.mLinkQualityIn    = 2;
+    neighbor.mAverageRssi      = -70;
+    neighbor.mLastRssi         = -72;
+    neighbor.mFrameErrorRate   = 10;
+    neighbor.mMessageErrorRate = 20;
+    neighbor.mFullThreadDevice = true;
+    neighbor.mIsChild          = true;
+    neighbors.push_back(neighbor);
+
+    EncodeTableBlob(neighbors, blob);
+    CHECK_EQUAL(OTBR_ERROR_NONE, DecodeTableBlob(blob.data(), blob.size(), decoded));
+    CHECK_EQUAL(1u, decoded.size());
+    CHECK_EQUAL(neighbor.mExtAddress, decoded[0].mExtAddress);
+    CHECK_EQUAL(neighbor.mAge, decoded[0].mAge);
+    CHECK_EQUAL(neighbor.mRloc16, decoded[0].mRloc16);
+    CHECK_EQUAL(neighbor.mLinkFrameCounter, decoded[0].mLinkFrameCounter);
+    CHECK_EQUAL(neighbor.mMleFrameCounter, decoded[0].mMleFrameCounter);
+    CHECK_EQUAL(neighbor.mLinkQualityIn, decoded[0].mLinkQualityIn);
+    CHECK_EQUAL(neighbor.mAverageRssi, decoded[0].mAverageRssi);
+    CHECK_EQUAL(neighbor.mLastRssi, decoded[0].mLastRssi);
+    CHECK_EQUAL(neighbor.mFrameErrorRate, decoded[0].mFrameErrorRate);
+    CHECK_EQUAL(neighbor.mMessageErrorRate, decoded[0].mMessageErrorRate);
+    CHECK_FALSE(decoded[0].mRxOnWhenIdle);
+    CHECK_TRUE(decoded[0].mFullThreadDevice);
+    CHECK_FALSE(decoded[0].mFullNetworkData);
+    CHECK_TRUE(decoded[0].mIsChild);
+}
+
+TEST(TableBlob, TestRejectMalformedBlob)
+{
+    std::vector<ChildInfo>    children{MakeChild(1), MakeChild(2)};
+    std::vector<ChildInfo>    decoded;
+    std::vector<NeighborInfo> neighbors;
+    std::vector<uint8_t>      blob;
+    std::vector<uint8_t>      corrupted;
+
+    EncodeTableBlob(children, blob);
+
+    // Truncated records and headers.
+    CHECK_EQUAL(OTBR_ERROR_PARSE, DecodeTableBlob(blob.data(), blob.size() - 1, decoded));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, DecodeTableBlob(blob.data(), kTableBlobHeaderSize - 1, decoded));
+
+    // A child table is not a neighbor table.
+    CHECK_EQUAL(OTBR_ERROR_PARSE, DecodeTableBlob(blob.data(), blob.size(), neighbors));
+
+    // A record count not matching the length.
+    corrupted = blob;
+    corrupted[8]++;
+    CHECK_EQUAL(OTBR_ERROR_PARSE, DecodeTableBlob(corrupted.data(), corrupted.size(), decoded));
+
+    // An unknown version.
+    corrupted = blob;
+    corrupted[4]++;
+    CHECK_EQUAL(OTBR_ERROR_PARSE, DecodeTableBlob(corrupted.data(), corrupted.size(), decoded));
+}
+
+TEST(TableBlob, TestAcceptLongerRecords)
+{
+    std::vector<ChildInfo> children{MakeChild(1), MakeChild(2)};
+    std::vector<ChildInfo> decoded;
+    std::vector<uint8_t>   blob;
+    std::vector<uint8_t>   extended;
+    size_t                 recordSize;
+
+    EncodeTableBlob(children, blob);
+    recordSize = (blob.size() - kTableBlobHeaderSize) / children.size();
+
+    // Append one unknown byte to every record, as a newer agent would.
+    extended.assign(blob.begin(), blob.begin() + kTableBlobHeaderSize);
+    extended[6] = static_cast<uint8_t>(recordSize + 1);
+
+    for (size_t i = 0; i < children.size(); i++)
+    {
+        auto record = blob.begin() + static_cast<long>(kTableBlobHeaderSize + i * recordSize);
+
+        extended.insert(extended.end(), record, record + static_cast<long>(recordSize));
+        extended.push_back(0xa5);
+    }
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, DecodeTableBlob(extended.data(), extended.size(), decoded));
+    CHECK_EQUAL(2u, decoded.size());
+    CheckChild(children[0], decoded[0]);
+    CheckChild(children[1], decoded[1]);
+}
+
+TEST(TableBlob, TestSealedMemfd)
+{
+    std::vector<ChildInfo> children{MakeChild(1), MakeChild(2), MakeChild(3)};
+    std::vector<ChildInfo> decoded;
+    std::vector<uint8_t>   blob;
+    int                    fd = -1;
+
+    EncodeTableBlob(children, blob);
+    CHECK_EQUAL(OTBR_ERROR_NONE, CreateSealedMemfd("test-child-table", blob, fd));
+    CHECK_TRUE(fd >= 0);
+
+    // The receiver cannot modify the blob either.
+    CHECK_EQUAL(-1, write(fd, blob.data(), 1));
+    CHECK_EQUAL(-1, ftruncate(fd, 0));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, DecodeTableMemfd(fd, decoded));
+    CHECK_EQUAL(children.size(), decoded.size());
+    CheckChild(children[2], decoded[2]);
+    close(fd);
+}
+
+TEST(TableBlob, TestRejectUnsealedMemfd)
+{
+    std::vector<ChildInfo> children{MakeChild(1)};
+    std::vector<ChildInfo> decoded;
+    std::vector<uint8_t>   blob;
+    int                    fd = memfd_create("test-unsealed", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+    EncodeTableBlob(children, blob);
+    CHECK_TRUE(fd >= 0);
+    CHECK_EQUAL(static_cast<ssize_t>(blob.size()), write(fd, blob.data(), blob.size()));
+
+    // A sender keeping write access could change the blob while it is decoded.
+    CHECK_EQUAL(OTBR_ERROR_PARSE, DecodeTableMemfd(fd, decoded));
+
+    CHECK_EQUAL(0, fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_WRITE));
+    CHECK_EQUAL(OTBR_ERROR_NONE, DecodeTableMemfd(fd, decoded));
+    CHECK_EQUAL(1u, decoded.size());
+    close(fd);
+}
@@ -66,6 +66,20 @@ static void CheckSplitFullDnsName(const std::string &aFullName,
     CHECK_EQUAL(aServiceName, info.mServiceName);
     CHECK_EQUAL(aHostName, info.mHostName);
     CHECK_EQUAL(aDomain, info.mDomain);
+
+    {
+        // The parsed name is followed by garbage to ensure the parser honors the given length.
+        std::string  buffer = aFullName + ".garbage._udp";
+        DnsNameParts parts  = ParseFullDnsName(buffer.data(), aFullName.length());
+
+        CHECK_EQUAL(aIsServiceInstance, parts.IsServiceInstance());
+        CHECK_EQUAL(aIsService, parts.IsService());
+        CHECK_EQUAL(aIsHost, parts.IsHost());
+        CHECK(parts.mInstanceName.Equals(aInstanceName));
+        CHECK(parts.mServiceName.Equals(aServiceName));
+        CHECK(parts.mHostName.Equals(aHostName));
+        CHECK_EQUAL(aDomain, parts.mDomain.ToString() + ".");
+    }
 }
 
 TEST(DnsUtils, TestSplitFullDnsName)
@@ -95,3 +109,28 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestSplitFullNameWrappers)
+{
+    std::string instanceName = "stale instance name longer than the small string buffer";
+    std::string type;
+    std::string hostName;
+    std::string domain;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                SplitFullServiceInstanceName("ins1._ipps._tcp.default.service.arpa.", instanceName, type, domain));
+    CHECK_EQUAL("ins1", instanceName);
+    CHECK_EQUAL("_ipps._tcp", type);
+    CHECK_EQUAL("default.service.arpa.", domain);
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, SplitFullServiceInstanceName("_ipps._tcp.local", instanceName, type, domain));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, SplitFullServiceName("_meshcop._udp.local", type, domain));
+    CHECK_EQUAL("_meshcop._udp", type);
+    CHECK_EQUAL("local.", domain);
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, SplitFullServiceName("host.local", type, domain));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, SplitFullHostName("host.local.", hostName, domain));
+    CHECK_EQUAL("host", hostName);
+    CHECK_EQUAL("local.", domain);
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, SplitFullHostName("ins1._ipps._tcp.local", hostName, domain));
+}
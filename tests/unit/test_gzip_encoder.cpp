@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string>
+
+#include <string.h>
+#include <zlib.h>
+
+#include "utils/gzip_encoder.hpp"
+
+TEST_GROUP(GzipEncoder){};
+
+static void Gunzip(const std::string &aGzip, std::string &aOutput)
+{
+    z_stream stream;
+    uint8_t  buffer[256];
+    int      rval;
+
+    memset(&stream, 0, sizeof(stream));
+    CHECK_EQUAL(Z_OK, inflateInit2(&stream, 15 + 16));
+    stream.next_in  = reinterpret_cast<Bytef *>(const_cast<char *>(aGzip.data()));
+    stream.avail_in = static_cast<uInt>(aGzip.size());
+
+    do
+    {
+        stream.next_out  = buffer;
+        stream.avail_out = sizeof(buffer);
+        rval             = inflate(&stream, Z_NO_FLUSH);
+        CHECK(rval == Z_OK || rval == Z_STREAM_END);
+        aOutput.append(reinterpret_cast<char *>(buffer), sizeof(buffer) - stream.avail_out);
+    } while (rval != Z_STREAM_END);
+
+    inflateEnd(&stream);
+}
+
+TEST(GzipEncoder, TestEncodeInPieces)
+{
+    otbr::GzipEncoder encoder;
+    std::string       input;
+    std::string       gzip;
+    std::string       output;
+    uint8_t           buffer[64];
+    size_t            length;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        input += "{\"RxOnWhenIdle\":1,\"DeviceType\":" + std::to_string(i % 2) + "}";
+    }
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, encoder.Start(input.data(), input.size()));
+
+    while (!encoder.IsFinished())
+    {
+        length = encoder.Encode(buffer, sizeof(buffer));
+        CHECK(length == sizeof(buffer) || encoder.IsFinished());
+        gzip.append(reinterpret_cast<char *>(buffer), length);
+    }
+
+    CHECK_EQUAL(0, encoder.Encode(buffer, sizeof(buffer)));
+    CHECK(gzip.size() < input.size() / 10);
+    Gunzip(gzip, output);
+    CHECK(input == output);
+}
+
+TEST(GzipEncoder, TestRestart)
+{
+    otbr::GzipEncoder encoder;
+    const std::string first  = "first";
+    const std::string second = "second";
+    std::string       output;
+    uint8_t           buffer[128];
+    size_t            length;
+
+    // Restart in the middle of an encoding.
+    CHECK_EQUAL(OTBR_ERROR_NONE, encoder.Start(first.data(), first.size()));
+    CHECK_EQUAL(OTBR_ERROR_NONE, encoder.Start(second.data(), second.size()));
+
+    length = encoder.Encode(buffer, sizeof(buffer));
+    CHECK(encoder.IsFinished());
+    Gunzip(std::string(reinterpret_cast<char *>(buffer), length), output);
+    CHECK(second == output);
+
+    // The empty input is a valid gzip stream as well.
+    CHECK_EQUAL(OTBR_ERROR_NONE, encoder.Start(nullptr, 0));
+    length = encoder.Encode(buffer, sizeof(buffer));
+    CHECK(encoder.IsFinished());
+    output.clear();
+    Gunzip(std::string(reinterpret_cast<char *>(buffer), length), output);
+    CHECK(output.empty());
+    encoder.Stop();
+}
@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/hex.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/hex_codec.hpp"
+
+TEST_GROUP(Hex){};
+
+TEST(Hex, TestBytes2Hex)
+{
+    const uint8_t kBytes[] = {0x00, 0x01, 0x7f, 0x80, 0xab, 0xff};
+    char          hex[sizeof(kBytes) * 2 + 1];
+
+    CHECK_EQUAL(sizeof(kBytes) * 2, otbr::Utils::Bytes2Hex(kBytes, sizeof(kBytes), hex));
+    STRCMP_EQUAL("00017F80ABFF", hex);
+
+    CHECK_EQUAL(0, otbr::Utils::Bytes2Hex(kBytes, 0, hex));
+    STRCMP_EQUAL("", hex);
+}
+
+TEST(Hex, TestLong2Hex)
+{
+    char hex[sizeof(uint64_t) * 2 + 1];
+
+    CHECK_EQUAL(16, otbr::Utils::Long2Hex(0x0123456789abcdefULL, hex));
+    STRCMP_EQUAL("EFCDAB8967452301", hex);
+}
+
+TEST(Hex, TestHex2Bytes)
+{
+    uint8_t bytes[4];
+
+    CHECK_EQUAL(4, otbr::Utils::Hex2Bytes("00aB7fFf", bytes, sizeof(bytes)));
+    CHECK_EQUAL(0x00, bytes[0]);
+    CHECK_EQUAL(0xab, bytes[1]);
+    CHECK_EQUAL(0x7f, bytes[2]);
+    CHECK_EQUAL(0xff, bytes[3]);
+
+    // An odd leading digit makes a byte on its own.
+    CHECK_EQUAL(2, otbr::Utils::Hex2Bytes("abc", bytes, sizeof(bytes)));
+    CHECK_EQUAL(0x0a, bytes[0]);
+    CHECK_EQUAL(0xbc, bytes[1]);
+
+    CHECK_EQUAL(0, otbr::Utils::Hex2Bytes("", bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("0g", bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("g", bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("0011223344", bytes, sizeof(bytes)));
+}
+
+TEST(Hex, TestHexCodecRoundTrip)
+{
+    uint8_t bytes[256];
+    uint8_t decoded[256];
+    char    hex[sizeof(bytes) * 2 + 1];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    otbr::HexCodec::Encode(bytes, sizeof(bytes), hex, /* aLowerCase */ true);
+    hex[sizeof(bytes) * 2] = '\0';
+    CHECK(strncmp(hex, "000102", 6) == 0);
+    CHECK(strcmp(hex + sizeof(bytes) * 2 - 4, "feff") == 0);
+
+    CHECK_EQUAL(static_cast<int>(sizeof(decoded)), otbr::Utils::Hex2Bytes(hex, decoded, sizeof(decoded)));
+    CHECK(memcmp(bytes, decoded, sizeof(bytes)) == 0);
+
+    for (int c = 0; c < 256; c++)
+    {
+        bool isDigit = ('0' <= c && c <= '9') || ('a' <= c && c <= 'f') || ('A' <= c && c <= 'F');
+
+        CHECK_EQUAL(isDigit, otbr::HexCodec::DecodeDigit(static_cast<char>(c)) >= 0);
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/inline_task.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::InlineTask;
+
+namespace {
+
+class MoveOnlyCallable
+{
+public:
+    MoveOnlyCallable(std::unique_ptr<int> aValue, int &aResult)
+        : mValue(std::move(aValue))
+        , mResult(aResult)
+    {
+    }
+
+    void operator()(void) { mResult = *mValue; }
+
+private:
+    std::unique_ptr<int> mValue;
+    int &                mResult;
+};
+
+} // namespace
+
+TEST_GROUP(InlineTask){};
+
+TEST(InlineTask, TestEmpty)
+{
+    InlineTask task;
+    InlineTask other(nullptr);
+
+    CHECK_FALSE(static_cast<bool>(task));
+    CHECK_FALSE(static_cast<bool>(other));
+
+    task = std::move(other);
+    CHECK_FALSE(static_cast<bool>(task));
+}
+
+TEST(InlineTask, TestMoveOnlyCallable)
+{
+    int        result = 0;
+    InlineTask task(MoveOnlyCallable(std::unique_ptr<int>(new int(1)), result));
+    InlineTask moved;
+
+    CHECK_TRUE(static_cast<bool>(task));
+
+    moved = std::move(task);
+    CHECK_FALSE(static_cast<bool>(task));
+    CHECK_TRUE(static_cast<bool>(moved));
+
+    moved();
+    CHECK_EQUAL(1, result);
+}
+
+TEST(InlineTask, TestInlineAndHeapCallables)
+{
+    std::string           str;
+    std::array<char, 256> large{};
+    std::shared_ptr<int>  counter = std::make_shared<int>(0);
+    auto                  small   = [&str]() { str.push_back('a'); };
+    auto                  big     = [&str, large]() { str.push_back(large[0] == 0 ? 'b' : 'x'); };
+
+    CHECK_TRUE(InlineTask::IsInline<decltype(small)>());
+    CHECK_FALSE(InlineTask::IsInline<decltype(big)>());
+
+    {
+        InlineTask smallTask(small);
+        InlineTask bigTask(big);
+        InlineTask movedBigTask(std::move(bigTask));
+        InlineTask counterTask([counter]() { ++*counter; });
+
+        smallTask();
+        movedBigTask();
+        counterTask();
+        CHECK_EQUAL(2, counter.use_count());
+    }
+
+    // The callables are destroyed with their tasks.
+    CHECK_EQUAL(1, counter.use_count());
+    CHECK_EQUAL(1, *counter);
+    STRCMP_EQUAL("ab", str.c_str());
+}
@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/interned_name.hpp"
+
+#include <string>
+#include <unordered_set>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::InternedName;
+using otbr::NamePool;
+
+TEST_GROUP(InternedName){};
+
+TEST(InternedName, TestSharing)
+{
+    size_t       size = NamePool::Get().GetSize();
+    InternedName name1("host1.local.");
+    InternedName name2(std::string("host1.local."));
+    InternedName name3("host2.local.");
+
+    CHECK(name1 == name2);
+    CHECK(&name1.GetString() == &name2.GetString());
+    CHECK(name1 != name3);
+    CHECK(name1 == "host1.local.");
+    CHECK(name1 == std::string("host1.local."));
+    CHECK(name3 != "host1.local.");
+    CHECK(name1 < name3);
+    UNSIGNED_LONGS_EQUAL(size + 2, NamePool::Get().GetSize());
+
+    std::unordered_set<InternedName, otbr::InternedNameHash> names{name1, name2, name3};
+
+    UNSIGNED_LONGS_EQUAL(2, names.size());
+}
+
+TEST(InternedName, TestEmpty)
+{
+    size_t       size = NamePool::Get().GetSize();
+    InternedName name1;
+    InternedName name2("");
+
+    CHECK(name1.empty());
+    CHECK(name1 == name2);
+    CHECK(name1 == "");
+    UNSIGNED_LONGS_EQUAL(0, name1.size());
+    UNSIGNED_LONGS_EQUAL(size, NamePool::Get().GetSize());
+}
+
+TEST(InternedName, TestRelease)
+{
+    size_t       size = NamePool::Get().GetSize();
+    InternedName found;
+
+    CHECK_FALSE(NamePool::Get().Find("service.local.", found));
+
+    {
+        InternedName name("service.local.");
+        InternedName copy = name;
+
+        UNSIGNED_LONGS_EQUAL(size + 1, NamePool::Get().GetSize());
+        CHECK(NamePool::Get().Find("service.local.", found));
+        CHECK(found == name);
+        STRCMP_EQUAL("service.local.", found.c_str());
+    }
+
+    // The found name still refers to the string.
+    UNSIGNED_LONGS_EQUAL(size + 1, NamePool::Get().GetSize());
+    found = InternedName();
+    UNSIGNED_LONGS_EQUAL(size, NamePool::Get().GetSize());
+    CHECK_FALSE(NamePool::Get().Find("service.local.", found));
+    CHECK(found.empty());
+}
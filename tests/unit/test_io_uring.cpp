@@ -0,0 +1,174 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/io_uring.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/mainloop_manager.hpp"
+
+namespace {
+
+void RunIterations(int aIterations)
+{
+    for (int i = 0; i < aIterations; i++)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {0, 10000};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(mainloop);
+        otbr::MainloopManager::GetInstance().Poll(mainloop);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(IoUring){};
+
+TEST(IoUring, TestReadWaitsForData)
+{
+    otbr::IoUring &ioUring = otbr::IoUring::Get();
+    int            fds[2];
+    int            completions = 0;
+    std::string    received;
+
+    if (!ioUring.IsAvailable())
+    {
+        return;
+    }
+
+    // The sockets of the Rest server are non-blocking as well.
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+
+    CHECK(ioUring.Read(fds[0], 64, [&](int aResult, const uint8_t *aData) {
+        ++completions;
+
+        if (aResult > 0)
+        {
+            received.assign(reinterpret_cast<const char *>(aData), static_cast<size_t>(aResult));
+        }
+    }) != nullptr);
+
+    // An idle socket completes nothing rather than -EAGAIN over and over.
+    RunIterations(5);
+    LONGS_EQUAL(0, completions);
+
+    CHECK(write(fds[1], "hello", 5) == 5);
+    RunIterations(5);
+    LONGS_EQUAL(1, completions);
+    STRCMP_EQUAL("hello", received.c_str());
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(IoUring, TestWriteWaitsForWindow)
+{
+    otbr::IoUring &ioUring = otbr::IoUring::Get();
+    int            fds[2];
+    int            completions = 0;
+    char           buffer[4096];
+    struct iovec   iov = {buffer, sizeof(buffer)};
+
+    if (!ioUring.IsAvailable())
+    {
+        return;
+    }
+
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+    memset(buffer, 'a', sizeof(buffer));
+
+    // Fill the socket so that the peer has no receive window left.
+    while (write(fds[0], buffer, sizeof(buffer)) > 0)
+    {
+    }
+    LONGS_EQUAL(EAGAIN, errno);
+
+    CHECK(ioUring.Writev(fds[0], &iov, 1, [&](int aResult, const uint8_t *) {
+        ++completions;
+        CHECK(aResult > 0);
+    }) != nullptr);
+
+    RunIterations(5);
+    LONGS_EQUAL(0, completions);
+
+    while (read(fds[1], buffer, sizeof(buffer)) > 0)
+    {
+    }
+    RunIterations(5);
+    LONGS_EQUAL(1, completions);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(IoUring, TestCancelWaitingRead)
+{
+    otbr::IoUring &           ioUring = otbr::IoUring::Get();
+    int                       fds[2];
+    int                       completions = 0;
+    otbr::IoUring::Operation *operation;
+
+    if (!ioUring.IsAvailable())
+    {
+        return;
+    }
+
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+
+    operation = ioUring.Read(fds[0], 64, [&](int, const uint8_t *) { ++completions; });
+    CHECK(operation != nullptr);
+    RunIterations(2);
+
+    ioUring.Cancel(operation);
+    CHECK(write(fds[1], "hello", 5) == 5);
+    RunIterations(5);
+    LONGS_EQUAL(0, completions);
+
+    // The socket still has the data, the cancelled read never took it.
+    {
+        char buffer[8];
+
+        LONGS_EQUAL(5, read(fds[0], buffer, sizeof(buffer)));
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <vector>
+
+#include "utils/joiner_info.hpp"
+
+TEST_GROUP(JoinerInfo){};
+
+TEST(JoinerInfo, TestParseJoinerInfo)
+{
+    const uint8_t eui64[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02};
+    otJoinerInfo  joiner;
+
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("*", "J01NME", joiner));
+    CHECK_EQUAL(OT_JOINER_INFO_TYPE_ANY, joiner.mType);
+    STRCMP_EQUAL("J01NME", joiner.mPskd.m8);
+
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("18b4300000000002", "J01NME", joiner));
+    CHECK_EQUAL(OT_JOINER_INFO_TYPE_EUI64, joiner.mType);
+    MEMCMP_EQUAL(eui64, joiner.mSharedId.mEui64.m8, sizeof(eui64));
+
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("0xabc/12", "J01NME", joiner));
+    CHECK_EQUAL(OT_JOINER_INFO_TYPE_DISCERNER, joiner.mType);
+    CHECK_EQUAL(0xabc, joiner.mSharedId.mDiscerner.mValue);
+    CHECK_EQUAL(12, joiner.mSharedId.mDiscerner.mLength);
+}
+
+TEST(JoinerInfo, TestParseInvalidJoinerInfo)
+{
+    otJoinerInfo joiner;
+
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("*", "J01NM", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("*", "J01NMI", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("*", "j01nme", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("18b43000000000", "J01NME", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("18b430000000000g", "J01NME", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("0xabc/8", "J01NME", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("0xabc/0", "J01NME", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("-1/12", "J01NME", joiner));
+    CHECK_EQUAL(OT_ERROR_INVALID_ARGS, otbr::Utils::ParseJoinerInfo("/12", "J01NME", joiner));
+}
+
+TEST(JoinerInfo, TestContainsJoiner)
+{
+    std::vector<otJoinerInfo> joiners(2);
+    otJoinerInfo              joiner;
+
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("18b4300000000002", "J01NME", joiners[0]));
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("0xabc/12", "J01NME", joiners[1]));
+
+    // Only the id of a joiner tells whether the commissioner already has it, not its PSKd.
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("18b4300000000002", "P4SSW0RD", joiner));
+    CHECK(otbr::Utils::ContainsJoiner(joiners, joiner));
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("0xabc/12", "P4SSW0RD", joiner));
+    CHECK(otbr::Utils::ContainsJoiner(joiners, joiner));
+
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("18b4300000000003", "J01NME", joiner));
+    CHECK_FALSE(otbr::Utils::ContainsJoiner(joiners, joiner));
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("0xabc/13", "J01NME", joiner));
+    CHECK_FALSE(otbr::Utils::ContainsJoiner(joiners, joiner));
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("*", "J01NME", joiner));
+    CHECK_FALSE(otbr::Utils::ContainsJoiner(joiners, joiner));
+
+    joiners.push_back(joiner);
+    CHECK(otbr::Utils::ContainsJoiner(joiners, joiner));
+}
+
+TEST(JoinerInfo, TestComputeSteeringData)
+{
+    const char *const         eui64s[] = {"18b4300000000002", "18b4300000000003"};
+    std::vector<otJoinerInfo> joiners(2);
+    uint8_t                   joinerIds[2][otbr::SteeringData::kSizeJoinerId];
+    otbr::SteeringData        expected;
+    otbr::SteeringData        steeringData;
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo(eui64s[i], "J01NME", joiners[i]));
+        otbr::SteeringData::ComputeJoinerId(joiners[i].mSharedId.mEui64.m8, joinerIds[i]);
+    }
+
+    expected.Init(otbr::SteeringData::ComputeLength(2));
+    expected.ComputeBloomFilter(&joinerIds[0][0], 2);
+
+    otbr::Utils::ComputeSteeringData(joiners, steeringData);
+    CHECK_EQUAL(expected.GetLength(), steeringData.GetLength());
+    MEMCMP_EQUAL(expected.GetBloomFilter(), steeringData.GetBloomFilter(), expected.GetLength());
+
+    // Any joiner allowed sets all the bits of the steering data.
+    joiners.resize(3);
+    CHECK_EQUAL(OT_ERROR_NONE, otbr::Utils::ParseJoinerInfo("*", "J01NME", joiners[2]));
+    otbr::Utils::ComputeSteeringData(joiners, steeringData);
+    CHECK_EQUAL(1, steeringData.GetLength());
+    CHECK_EQUAL(0xff, steeringData.GetBloomFilter()[0]);
+}
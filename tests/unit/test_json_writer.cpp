@@ -0,0 +1,156 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <limits>
+
+#include "utils/json_writer.hpp"
+
+TEST_GROUP(JsonWriter){};
+
+static void WriteDocument(otbr::JsonWriter &aWriter)
+{
+    const uint8_t bytes[] = {0x01, 0xab, 0xff};
+
+    aWriter.BeginObject();
+    aWriter.Key("Number").Uint(42);
+    aWriter.Key("Negative").Int(-7);
+    aWriter.Key("Hex").Hex(bytes, sizeof(bytes));
+    aWriter.Key("Array").BeginArray().Uint(1).Bool(true).Null().EndArray();
+    aWriter.Key("Object").BeginObject().Key("Name").String("ot-br").EndObject();
+    aWriter.Key("Empty").BeginArray().EndArray();
+    aWriter.EndObject();
+}
+
+TEST(JsonWriter, TestPretty)
+{
+    otbr::JsonWriter writer;
+
+    WriteDocument(writer);
+    STRCMP_EQUAL("{\n"
+                 "\t\"Number\":\t42,\n"
+                 "\t\"Negative\":\t-7,\n"
+                 "\t\"Hex\":\t\"01ABFF\",\n"
+                 "\t\"Array\":\t[1, true, null],\n"
+                 "\t\"Object\":\t{\n"
+                 "\t\t\"Name\":\t\"ot-br\"\n"
+                 "\t},\n"
+                 "\t\"Empty\":\t[]\n"
+                 "}",
+                 writer.GetString().c_str());
+}
+
+TEST(JsonWriter, TestCompact)
+{
+    otbr::JsonWriter writer(/* aCompact */ true);
+
+    WriteDocument(writer);
+    STRCMP_EQUAL("{\"Number\":42,\"Negative\":-7,\"Hex\":\"01ABFF\",\"Array\":[1,true,null],"
+                 "\"Object\":{\"Name\":\"ot-br\"},\"Empty\":[]}",
+                 writer.GetString().c_str());
+}
+
+TEST(JsonWriter, TestReset)
+{
+    otbr::JsonWriter writer(/* aCompact */ true);
+
+    writer.BeginArray().Uint(1).Uint(2).EndArray();
+    writer.Reset();
+    writer.BeginArray().Uint(3).EndArray();
+    STRCMP_EQUAL("[3]", writer.GetString().c_str());
+}
+
+TEST(JsonWriter, TestEscape)
+{
+    otbr::JsonWriter writer;
+
+    writer.String("a\"b\\c\nd\te\x01");
+    STRCMP_EQUAL("\"a\\\"b\\\\c\\nd\\te\\u0001\"", writer.GetString().c_str());
+}
+
+TEST(JsonWriter, TestNullString)
+{
+    otbr::JsonWriter writer(/* aCompact */ true);
+
+    writer.BeginArray().String(static_cast<const char *>(nullptr)).String("a").EndArray();
+    STRCMP_EQUAL("[null,\"a\"]", writer.GetString().c_str());
+}
+
+TEST(JsonWriter, TestNumbers)
+{
+    otbr::JsonWriter writer(/* aCompact */ true);
+
+    writer.BeginArray();
+    writer.Uint(std::numeric_limits<uint64_t>::max());
+    writer.Int(std::numeric_limits<int64_t>::min());
+    writer.Double(0.5);
+    writer.Double(0.1);
+    writer.Double(std::numeric_limits<double>::infinity());
+    writer.EndArray();
+    STRCMP_EQUAL("[18446744073709551615,-9223372036854775808,0.5,0.1,null]", writer.GetString().c_str());
+}
+
+TEST(JsonWriter, TestRaw)
+{
+    otbr::JsonWriter writer(/* aCompact */ true);
+
+    writer.BeginObject().Key("A").Raw("[1,2]").Key("B").Raw("\"b\"").EndObject();
+    STRCMP_EQUAL("{\"A\":[1,2],\"B\":\"b\"}", writer.GetString().c_str());
+}
+
+TEST(JsonWriter, TestCbor)
+{
+    otbr::JsonWriter writer;
+    const uint8_t    expected[] = {
+        0xbf, 0x66, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x18, 0x2a, 0x68, 0x4e, 0x65, 0x67, 0x61, 0x74, 0x69,
+        0x76, 0x65, 0x26, 0x63, 0x48, 0x65, 0x78, 0x43, 0x01, 0xab, 0xff, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79,
+        0x9f, 0x01, 0xf5, 0xf6, 0xff, 0x66, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0xbf, 0x64, 0x4e, 0x61, 0x6d,
+        0x65, 0x65, 0x6f, 0x74, 0x2d, 0x62, 0x72, 0xff, 0x65, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x9f, 0xff, 0xff,
+    };
+
+    writer.SetFormat(otbr::JsonWriter::kFormatCbor);
+    WriteDocument(writer);
+    LONGS_EQUAL(sizeof(expected), writer.GetString().size());
+    MEMCMP_EQUAL(expected, writer.GetString().data(), sizeof(expected));
+}
+
+TEST(JsonWriter, TestCborNumbers)
+{
+    otbr::JsonWriter writer;
+    const uint8_t    expected[] = {
+        0x9f, 0x17, 0x19, 0x01, 0xf4, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x39, 0x01,
+        0xf3, 0xfa, 0x3f, 0xc0, 0x00, 0x00, 0xfb, 0x3f, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a, 0xff,
+    };
+
+    writer.SetFormat(otbr::JsonWriter::kFormatCbor);
+    writer.BeginArray().Uint(23).Uint(500).Uint(UINT64_C(1) << 32).Int(-1).Int(-500).Double(1.5).Double(0.1);
+    writer.EndArray();
+    LONGS_EQUAL(sizeof(expected), writer.GetString().size());
+    MEMCMP_EQUAL(expected, writer.GetString().data(), sizeof(expected));
+}
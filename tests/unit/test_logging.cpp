@@ -34,6 +34,12 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
 #include "common/logging.hpp"
 
 TEST_GROUP(Logging){};
@@ -112,3 +118,289 @@ TEST(Logging, TestLoggingDump)
     sprintf(cmd, "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     CHECK(0 == system(cmd));
 }
+
+static int sEvaluations = 0;
+
+static const char *CountEvaluation(void)
+{
+    sEvaluations++;
+    return "evaluated";
+}
+
+TEST(Logging, TestLoggingArgumentsEvaluatedOnlyWhenEnabled)
+{
+    char ident[32];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+
+    sEvaluations = 0;
+    otbrLogDebug("cool-lazy %s", CountEvaluation());
+    CHECK_EQUAL(0, sEvaluations);
+
+    otbrLogInfo("cool-lazy %s", CountEvaluation());
+    CHECK_EQUAL(1, sEvaluations);
+
+    otbrLogResult(OTBR_ERROR_NONE, "cool-lazy %s", CountEvaluation());
+    CHECK_EQUAL(2, sEvaluations);
+
+    otbrLogDeinit();
+}
+
+TEST(Logging, TestLoggingSevereArgumentsEvaluatedOnlyWhenEnabled)
+{
+    char ident[32];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_ERR, true);
+
+    sEvaluations = 0;
+    otbrLogWarning("cool-lazy %s", CountEvaluation());
+    CHECK_EQUAL(0, sEvaluations);
+
+    otbrLogErr("cool-lazy %s", CountEvaluation());
+    CHECK_EQUAL(1, sEvaluations);
+
+    otbrLogDeinit();
+}
+
+TEST(Logging, TestLoggingRateLimited)
+{
+    char ident[32];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+
+    sEvaluations = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        otbrLogInfoRateLimited("cool-limited %s", CountEvaluation());
+    }
+    CHECK_EQUAL(OTBR_LOG_RATE_LIMIT_BURST, sEvaluations);
+
+    // Debug messages are below the log level, so they neither take tokens nor evaluate their arguments.
+    sEvaluations = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        otbrLogDebugRateLimited("cool-limited %s", CountEvaluation());
+    }
+    CHECK_EQUAL(0, sEvaluations);
+
+    otbrLogDeinit();
+}
+
+TEST(Logging, TestLogRateLimiterRefills)
+{
+    otbr::LogRateLimiter limiter;
+    uint32_t             suppressed = 0;
+    otbr::Timepoint      now        = otbr::Timepoint() + otbr::Milliseconds(1000);
+
+    for (int i = 0; i < OTBR_LOG_RATE_LIMIT_BURST; i++)
+    {
+        CHECK(limiter.Allow(suppressed, now));
+        CHECK_EQUAL(0, suppressed);
+    }
+
+    CHECK(!limiter.Allow(suppressed, now));
+    CHECK(!limiter.Allow(suppressed, now));
+
+    // No token is regained before a full interval has passed.
+    CHECK(!limiter.Allow(suppressed, now + otbr::Milliseconds(OTBR_LOG_RATE_LIMIT_INTERVAL - 1)));
+
+    now += otbr::Milliseconds(OTBR_LOG_RATE_LIMIT_INTERVAL);
+    CHECK(limiter.Allow(suppressed, now));
+    CHECK_EQUAL(3, suppressed);
+    CHECK(!limiter.Allow(suppressed, now));
+
+    // The bucket never holds more than a burst.
+    now += otbr::Milliseconds(OTBR_LOG_RATE_LIMIT_INTERVAL * (OTBR_LOG_RATE_LIMIT_BURST + 10));
+    for (int i = 0; i < OTBR_LOG_RATE_LIMIT_BURST; i++)
+    {
+        CHECK(limiter.Allow(suppressed, now));
+    }
+    CHECK(!limiter.Allow(suppressed, now));
+}
+
+TEST(Logging, TestLoggingAsync)
+{
+    char ident[32];
+    char cmd[128];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+    otbrLogEnableAsync(OTBR_LOG_OVERFLOW_DROP_NEWEST);
+    otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "cool-async");
+    otbrLogDeinit();
+    sleep(0);
+
+    CHECK(otbrLogGetDroppedCount() == 0);
+    sprintf(cmd, "grep '%s.*cool-async' /var/log/syslog", ident);
+    CHECK(0 == system(cmd));
+}
+
+TEST(Logging, TestLoggingAsyncDropsVerboseOnOverflow)
+{
+    char ident[32];
+    char cmd[128];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+    otbrLogEnableAsync(OTBR_LOG_OVERFLOW_DROP_VERBOSE);
+
+    // Far more messages than the ring buffer holds, faster than they are written.
+    for (int i = 0; i < 10000; i++)
+    {
+        otbrLogInfo("cool-flood %d", i);
+    }
+
+    otbrLogErr("cool-severe");
+    otbrLogDeinit();
+    sleep(0);
+
+    CHECK(otbrLogGetDroppedCount() > 0);
+    sprintf(cmd, "grep '%s.*cool-severe' /var/log/syslog", ident);
+    CHECK(0 == system(cmd));
+    sprintf(cmd, "grep '%s.*log messages were dropped' /var/log/syslog", ident);
+    CHECK(0 == system(cmd));
+}
+
+static std::string ReadFile(const std::string &aPath)
+{
+    std::ifstream     file(aPath);
+    std::stringstream content;
+
+    content << file.rdbuf();
+
+    return content.str();
+}
+
+TEST(Logging, TestLoggingFile)
+{
+    char        path[64];
+    std::string content;
+
+    sprintf(path, "/tmp/otbr-test-%d.log", static_cast<int>(getpid()));
+    unlink(path);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false);
+    CHECK(otbrLogEnableFile(path, 0) == OTBR_ERROR_NONE);
+    otbrLogInfo("cool-file %d", 1);
+
+    // Only severe messages are written right away.
+    CHECK(ReadFile(path).find("cool-file") == std::string::npos);
+    otbrLogErr("cool-file-severe");
+    content = ReadFile(path);
+    CHECK(content.find("otbr-test[") != std::string::npos);
+    CHECK(content.find("[INFO]-TEST----: cool-file 1\n") != std::string::npos);
+    CHECK(content.find("[ERR ]-TEST----: cool-file-severe\n") != std::string::npos);
+
+    otbrLogInfo("cool-file-last");
+    otbrLogDeinit();
+    CHECK(ReadFile(path).find("cool-file-last\n") != std::string::npos);
+
+    unlink(path);
+}
+
+TEST(Logging, TestLoggingFilePrefix)
+{
+    char        path[64];
+    std::string content;
+
+    sprintf(path, "/tmp/otbr-test-%d.log", static_cast<int>(getpid()));
+    unlink(path);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false);
+    CHECK(otbrLogEnableFile(path, 0) == OTBR_ERROR_NONE);
+    otbrLog(OTBR_LOG_INFO, "LONGTAGNAME", "cool-long-tag");
+    otbrLog(OTBR_LOG_INFO, "SEVNCHR", "cool-full-tag");
+    otbrLog(OTBR_LOG_INFO, "", "cool-no-tag");
+    otbrLogDeinit();
+
+    content = ReadFile(path);
+    CHECK(content.find("[INFO]-LONGTAG-: cool-long-tag\n") != std::string::npos);
+    CHECK(content.find("[INFO]-SEVNCHR-: cool-full-tag\n") != std::string::npos);
+    CHECK(content.find("[INFO]: cool-no-tag\n") != std::string::npos);
+
+    unlink(path);
+}
+
+TEST(Logging, TestLoggingAsyncFlush)
+{
+    char              path[64];
+    std::atomic<bool> stopping(false);
+    std::thread       logger;
+
+    sprintf(path, "/tmp/otbr-test-%d.log", static_cast<int>(getpid()));
+    unlink(path);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false);
+    CHECK(otbrLogEnableFile(path, 0) == OTBR_ERROR_NONE);
+    otbrLogEnableAsync(OTBR_LOG_OVERFLOW_DROP_NEWEST);
+
+    // Flushing is safe while another thread keeps logging.
+    logger = std::thread([&stopping]() {
+        while (!stopping)
+        {
+            otbrLogInfo("cool-busy");
+        }
+    });
+
+    otbrLogInfo("cool-flushed");
+    otbrLogFlush();
+    CHECK(ReadFile(path).find("cool-flushed\n") != std::string::npos);
+
+    stopping = true;
+    logger.join();
+    otbrLogDeinit();
+
+    unlink(path);
+}
+
+TEST(Logging, TestLoggingFileRotation)
+{
+    char        path[64];
+    std::string rotated;
+
+    sprintf(path, "/tmp/otbr-test-%d.log", static_cast<int>(getpid()));
+    rotated = std::string(path) + ".1";
+    unlink(path);
+    unlink(rotated.c_str());
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false);
+    CHECK(otbrLogEnableFile(path, 1024) == OTBR_ERROR_NONE);
+
+    for (int i = 0; i < 100; i++)
+    {
+        otbrLogErr("cool-rotate %d", i);
+    }
+
+    otbrLogDeinit();
+
+    CHECK(ReadFile(path).size() <= 1024);
+    CHECK(ReadFile(path).find("cool-rotate 99\n") != std::string::npos);
+    CHECK(ReadFile(rotated).size() <= 1024);
+    CHECK(ReadFile(rotated).find("cool-rotate") != std::string::npos);
+
+    for (int i = 1; i <= OTBR_LOG_FILE_ROTATIONS; i++)
+    {
+        unlink((std::string(path) + "." + std::to_string(i)).c_str());
+    }
+    unlink(path);
+}
+
+TEST(Logging, TestLoggingFileAsync)
+{
+    char path[64];
+
+    sprintf(path, "/tmp/otbr-test-%d.log", static_cast<int>(getpid()));
+    unlink(path);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false);
+    CHECK(otbrLogEnableFile(path, 0) == OTBR_ERROR_NONE);
+    otbrLogEnableAsync(OTBR_LOG_OVERFLOW_DROP_NEWEST);
+    otbrLogInfo("cool-file-async");
+    otbrLogDeinit();
+
+    CHECK(ReadFile(path).find("cool-file-async\n") != std::string::npos);
+    unlink(path);
+}
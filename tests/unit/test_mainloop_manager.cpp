@@ -0,0 +1,378 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
+
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+namespace {
+
+class PipeProcessor : public otbr::MainloopProcessor
+{
+public:
+    PipeProcessor(void)
+        : mReadable(false)
+    {
+        Open();
+    }
+
+    ~PipeProcessor(void) { Close(); }
+
+    void Open(void)
+    {
+        int fds[2];
+
+        CHECK_EQUAL(0, pipe(fds));
+        mReadFd  = fds[0];
+        mWriteFd = fds[1];
+    }
+
+    void Close(void)
+    {
+        otbr::MainloopManager::GetInstance().RemoveFd(mReadFd);
+        close(mReadFd);
+        close(mWriteFd);
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override
+    {
+        FD_SET(mReadFd, &aMainloop.mReadFdSet);
+
+        if (mReadFd > aMainloop.mMaxFd)
+        {
+            aMainloop.mMaxFd = mReadFd;
+        }
+    }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        mReadable = FD_ISSET(mReadFd, &aMainloop.mReadFdSet);
+    }
+
+    int  mReadFd;
+    int  mWriteFd;
+    bool mReadable;
+};
+
+class NowProcessor : public otbr::MainloopProcessor
+{
+public:
+    void Update(otbr::MainloopContext &aMainloop) override
+    {
+        OTBR_UNUSED_VARIABLE(aMainloop);
+        mUpdateNow = otbr::MainloopManager::GetInstance().GetNow();
+    }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        OTBR_UNUSED_VARIABLE(aMainloop);
+        mProcessNow = otbr::MainloopManager::GetInstance().GetNow();
+    }
+
+    otbr::Timepoint mUpdateNow;
+    otbr::Timepoint mProcessNow;
+};
+
+int RunOnce(otbr::MainloopManager &aManager, long aTimeoutUs)
+{
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, aTimeoutUs};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aManager.Update(mainloop);
+    rval = aManager.Poll(mainloop);
+    aManager.Process(mainloop);
+
+    return rval;
+}
+
+} // namespace
+
+TEST_GROUP(MainloopManager){};
+
+TEST(MainloopManager, TestPollReadable)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    PipeProcessor          processor;
+
+    manager.AddMainloopProcessor(&processor);
+
+    CHECK_EQUAL(0, RunOnce(manager, 1000));
+    CHECK_FALSE(processor.mReadable);
+
+    CHECK_EQUAL(1, write(processor.mWriteFd, "x", 1));
+    CHECK_EQUAL(1, RunOnce(manager, 1000));
+    CHECK_TRUE(processor.mReadable);
+
+    manager.RemoveMainloopProcessor(&processor);
+}
+
+TEST(MainloopManager, TestReopenFd)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    PipeProcessor          processor;
+    int                    oldReadFd;
+
+    manager.AddMainloopProcessor(&processor);
+    CHECK_EQUAL(0, RunOnce(manager, 1000));
+
+    // The new pipe is expected to reuse the same file descriptor numbers.
+    oldReadFd = processor.mReadFd;
+    processor.Close();
+    processor.Open();
+    CHECK_EQUAL(oldReadFd, processor.mReadFd);
+
+    CHECK_EQUAL(1, write(processor.mWriteFd, "x", 1));
+    CHECK_EQUAL(1, RunOnce(manager, 100000));
+    CHECK_TRUE(processor.mReadable);
+
+    manager.RemoveMainloopProcessor(&processor);
+}
+
+TEST(MainloopManager, TestRegisterFd)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    int                    fds[2];
+    int                    counter = 0;
+
+    CHECK_EQUAL(0, pipe(fds));
+    manager.RegisterFd(fds[0], otbr::MainloopManager::kEventReadable, [&](uint8_t aEvents) {
+        CHECK_EQUAL(otbr::MainloopManager::kEventReadable, aEvents);
+        ++counter;
+    });
+
+    CHECK_EQUAL(0, RunOnce(manager, 1000));
+    CHECK_EQUAL(0, counter);
+
+    CHECK_EQUAL(1, write(fds[1], "x", 1));
+    CHECK_EQUAL(1, RunOnce(manager, 1000));
+    CHECK_EQUAL(1, counter);
+
+    // Paused file descriptors are not reported.
+    manager.UpdateFd(fds[0], 0);
+    CHECK_EQUAL(0, RunOnce(manager, 1000));
+    CHECK_EQUAL(1, counter);
+
+    manager.UpdateFd(fds[0], otbr::MainloopManager::kEventReadable);
+    CHECK_EQUAL(1, RunOnce(manager, 1000));
+    CHECK_EQUAL(2, counter);
+
+    manager.UnregisterFd(fds[0]);
+    CHECK_EQUAL(0, RunOnce(manager, 1000));
+    CHECK_EQUAL(2, counter);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestRegisterFdHangup)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    int                    fds[2];
+    uint8_t                events = 0;
+
+    CHECK_EQUAL(0, pipe(fds));
+    manager.RegisterFd(fds[0], otbr::MainloopManager::kEventReadable, [&](uint8_t aEvents) { events = aEvents; });
+
+    close(fds[1]);
+    CHECK_EQUAL(1, RunOnce(manager, 1000));
+    CHECK(events & otbr::MainloopManager::kEventReadable);
+#if OTBR_ENABLE_EPOLL
+    CHECK(events & otbr::MainloopManager::kEventHangup);
+#endif
+
+    manager.UnregisterFd(fds[0]);
+    close(fds[0]);
+}
+
+TEST(MainloopManager, TestUnregisterFdInHandler)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    int                    fds[2];
+    int                    counter = 0;
+
+    CHECK_EQUAL(0, pipe(fds));
+    CHECK_EQUAL(1, write(fds[1], "x", 1));
+
+    manager.RegisterFd(fds[0], otbr::MainloopManager::kEventReadable, [&](uint8_t) {
+        ++counter;
+        manager.UnregisterFd(fds[0]);
+        manager.UnregisterFd(fds[1]);
+    });
+    manager.RegisterFd(fds[1], otbr::MainloopManager::kEventWritable, [&](uint8_t) {
+        ++counter;
+        manager.UnregisterFd(fds[0]);
+        manager.UnregisterFd(fds[1]);
+    });
+
+    CHECK_EQUAL(2, RunOnce(manager, 1000));
+    CHECK_EQUAL(1, counter);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestStats)
+{
+    otbr::MainloopManager &       manager = otbr::MainloopManager::GetInstance();
+    PipeProcessor                 processor;
+    otbr::MainloopManager::Stats  stats;
+    const otbr::LatencyHistogram *update  = nullptr;
+    const otbr::LatencyHistogram *process = nullptr;
+
+    manager.AddMainloopProcessor(&processor, "pipe");
+    manager.ResetStats();
+
+    RunOnce(manager, 1000);
+    RunOnce(manager, 1000);
+
+    stats = manager.GetStats();
+    CHECK_EQUAL(2, stats.mIterations);
+
+    for (const auto &latency : stats.mLatencies)
+    {
+        if (latency.mName == "poll")
+        {
+            CHECK_EQUAL(2, latency.mHistogram.GetCount());
+            CHECK_TRUE(latency.mHistogram.GetTotal() >= std::chrono::microseconds(2000));
+        }
+        else if (latency.mName == "pipe.update")
+        {
+            update = &latency.mHistogram;
+        }
+        else if (latency.mName == "pipe.process")
+        {
+            process = &latency.mHistogram;
+        }
+    }
+
+    CHECK_TRUE(update != nullptr && update->GetCount() == 2);
+    CHECK_TRUE(process != nullptr && process->GetCount() == 2);
+
+    manager.ResetStats();
+    CHECK_EQUAL(0, manager.GetStats().mIterations);
+
+    manager.RemoveMainloopProcessor(&processor);
+}
+
+TEST(MainloopManager, TestTimerSlack)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    NowProcessor           first;
+    NowProcessor           second;
+
+    manager.AddMainloopProcessor(&first, "first");
+    manager.AddMainloopProcessor(&second, "second");
+    manager.SetTimerSlack(otbr::Milliseconds(50));
+    manager.ResetStats();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        CHECK_EQUAL(0, RunOnce(manager, 1000));
+
+        // All processors see the same time in an iteration.
+        CHECK_TRUE(first.mUpdateNow == second.mUpdateNow);
+        CHECK_TRUE(first.mProcessNow == second.mProcessNow);
+        CHECK_TRUE(first.mUpdateNow < first.mProcessNow);
+    }
+
+    CHECK_EQUAL(3, manager.GetStats().mTimerWakeups);
+
+    manager.SetTimerSlack(otbr::Milliseconds::zero());
+    manager.RemoveMainloopProcessor(&second);
+    manager.RemoveMainloopProcessor(&first);
+}
+
+TEST(MainloopManager, TestCoalesceTimeout)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    otbr::Timepoint        now(otbr::Milliseconds(1000));
+    otbr::MainloopContext  mainloop;
+
+    manager.SetTimerSlack(otbr::Milliseconds(50));
+
+    // The deadline is postponed to the next multiple of the slack, relative to the start of the poll.
+    mainloop.mTimeout = {0, 30000};
+    manager.CoalesceTimeout(mainloop, now, now + otbr::Milliseconds(5));
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_sec);
+    CHECK_EQUAL(45000, mainloop.mTimeout.tv_usec);
+
+    // Deadlines on a multiple of the slack are kept.
+    mainloop.mTimeout = {0, 50000};
+    manager.CoalesceTimeout(mainloop, now, now);
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_sec);
+    CHECK_EQUAL(50000, mainloop.mTimeout.tv_usec);
+
+    // Deadlines already passed when the poll starts expire right away.
+    mainloop.mTimeout = {0, 10000};
+    manager.CoalesceTimeout(mainloop, now, now + otbr::Milliseconds(60));
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_sec);
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_usec);
+
+    // Zero timeouts are not postponed.
+    mainloop.mTimeout = {0, 0};
+    manager.CoalesceTimeout(mainloop, now, now);
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_sec);
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_usec);
+
+    // Timeouts are kept without a slack.
+    manager.SetTimerSlack(otbr::Milliseconds::zero());
+    mainloop.mTimeout = {0, 30000};
+    manager.CoalesceTimeout(mainloop, now, now + otbr::Milliseconds(5));
+    CHECK_EQUAL(0, mainloop.mTimeout.tv_sec);
+    CHECK_EQUAL(30000, mainloop.mTimeout.tv_usec);
+}
+
+TEST(MainloopManager, TestLatencyHistogram)
+{
+    otbr::LatencyHistogram histogram;
+
+    histogram.Record(std::chrono::microseconds(0));
+    histogram.Record(std::chrono::microseconds(1));
+    histogram.Record(std::chrono::microseconds(3));
+    histogram.Record(std::chrono::microseconds(4));
+    histogram.Record(std::chrono::hours(1));
+
+    CHECK_EQUAL(5, histogram.GetCount());
+    CHECK_EQUAL(1, histogram.GetBucketCount(0));
+    CHECK_EQUAL(1, histogram.GetBucketCount(1));
+    CHECK_EQUAL(1, histogram.GetBucketCount(2));
+    CHECK_EQUAL(1, histogram.GetBucketCount(3));
+    CHECK_EQUAL(1, histogram.GetBucketCount(otbr::LatencyHistogram::kNumBuckets - 1));
+    CHECK_TRUE(histogram.GetMax() == std::chrono::hours(1));
+    CHECK_TRUE(otbr::LatencyHistogram::GetBucketUpperBound(3) == std::chrono::microseconds(8));
+}
@@ -0,0 +1,210 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "mdns/mdns.hpp"
+
+TEST_GROUP(Mdns){};
+
+TEST(Mdns, TestMakeServiceKey)
+{
+    using otbr::Mdns::Publisher;
+
+    CHECK(Publisher::MakeServiceKey("foo", "_srv._udp") == Publisher::MakeServiceKey("foo", "_srv._udp."));
+    CHECK(Publisher::MakeServiceKey("foo", "_srv._udp") != Publisher::MakeServiceKey("bar", "_srv._udp"));
+    CHECK(Publisher::MakeServiceKey("foo", "_srv._udp") != Publisher::MakeServiceKey("foo", "_srv._tcp"));
+    CHECK(Publisher::MakeServiceKey("a.b", "_c") != Publisher::MakeServiceKey("a", "b._c"));
+    CHECK(Publisher::MakeServiceKey("", "_srv._udp") != Publisher::MakeServiceKey("_srv._udp", ""));
+}
+
+namespace {
+
+class FakePublisher : public otbr::Mdns::Publisher
+{
+public:
+    otbrError Start(void) override { return OTBR_ERROR_NONE; }
+    void      Stop(void) override {}
+    bool      IsStarted(void) const override { return true; }
+    otbrError PublishService(const char *, uint16_t, const char *, const char *, const TxtData &aTxtData) override
+    {
+        mTxtData.assign(aTxtData.mData, aTxtData.mData + aTxtData.mLength);
+        return OTBR_ERROR_NONE;
+    }
+    using Publisher::PublishService;
+    otbrError UnpublishService(const char *, const char *) override { return OTBR_ERROR_NONE; }
+    otbrError PublishHost(const char *, const AddressList &) override { return OTBR_ERROR_NONE; }
+    otbrError UnpublishHost(const char *) override { return OTBR_ERROR_NONE; }
+    void      Update(otbr::MainloopContext &) override {}
+    void      Process(const otbr::MainloopContext &) override {}
+
+    using Publisher::CancelServicePublication;
+    using Publisher::FinishHostPublication;
+    using Publisher::FinishServicePublication;
+    using Publisher::RecordServiceRename;
+    using Publisher::StartHostPublication;
+    using Publisher::StartServicePublication;
+
+    int mServiceStarts = 0;
+    int mServiceStops  = 0;
+    int mHostStarts    = 0;
+    int mHostStops     = 0;
+
+    std::vector<uint8_t> mTxtData;
+
+protected:
+    void StartServiceSubscription(const std::string &, const std::string &) override { ++mServiceStarts; }
+    void StopServiceSubscription(const std::string &, const std::string &) override { ++mServiceStops; }
+    void StartHostSubscription(const std::string &) override { ++mHostStarts; }
+    void StopHostSubscription(const std::string &) override { ++mHostStops; }
+};
+
+} // namespace
+
+TEST(Mdns, TestSubscriptionRefCount)
+{
+    FakePublisher publisher;
+
+    publisher.SubscribeService("_srv._udp", "");
+    publisher.SubscribeService("_srv._udp.", "");
+    publisher.SubscribeService("_srv._udp", "foo");
+    CHECK_EQUAL(2, publisher.mServiceStarts);
+    CHECK_EQUAL(2u, publisher.GetServiceSubscriptionCount("_srv._udp", ""));
+    CHECK_EQUAL(1u, publisher.GetServiceSubscriptionCount("_srv._udp", "foo"));
+
+    publisher.UnsubscribeService("_srv._udp", "");
+    CHECK_EQUAL(0, publisher.mServiceStops);
+    publisher.UnsubscribeService("_srv._udp", "");
+    publisher.UnsubscribeService("_srv._udp", "foo");
+    CHECK_EQUAL(2, publisher.mServiceStops);
+    CHECK_EQUAL(0u, publisher.GetServiceSubscriptionCount("_srv._udp", ""));
+
+    publisher.SubscribeHost("host");
+    publisher.SubscribeHost("host");
+    CHECK_EQUAL(1, publisher.mHostStarts);
+    CHECK_EQUAL(2u, publisher.GetHostSubscriptionCount("host"));
+    publisher.UnsubscribeHost("host");
+    publisher.UnsubscribeHost("host");
+    CHECK_EQUAL(1, publisher.mHostStops);
+    CHECK_EQUAL(0u, publisher.GetHostSubscriptionCount("host"));
+
+    publisher.SubscribeService("_srv._udp", "");
+    CHECK_EQUAL(3, publisher.mServiceStarts);
+    publisher.UnsubscribeService("_srv._udp", "");
+}
+
+TEST(Mdns, TestPublishTxtList)
+{
+    FakePublisher                  publisher;
+    otbr::Mdns::Publisher::TxtList txtList{{"a", "1"}, {"bc", ""}};
+    const uint8_t                  expected[] = {3, 'a', '=', '1', 3, 'b', 'c', '='};
+    otbr::Mdns::Publisher::TxtList tooLong{{std::string(255, 'k').c_str(), ""}};
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, publisher.PublishService(nullptr, 1, "foo", "_srv._udp", txtList));
+    CHECK_EQUAL(sizeof(expected), publisher.mTxtData.size());
+    MEMCMP_EQUAL(expected, publisher.mTxtData.data(), sizeof(expected));
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, publisher.PublishService(nullptr, 1, "foo", "_srv._udp", tooLong));
+}
+
+TEST(Mdns, TestPublicationStats)
+{
+    FakePublisher                publisher;
+    otbr::Mdns::Publisher::Stats stats;
+    int                          serviceResults = 0;
+
+    publisher.SetPublishServiceHandler(
+        [](const char *, const char *, otbrError, void *aContext) { ++*static_cast<int *>(aContext); },
+        &serviceResults);
+
+    publisher.StartServicePublication("foo", "_srv._udp");
+    publisher.StartServicePublication("bar", "_srv._udp");
+    publisher.StartServicePublication("baz", "_srv._udp");
+    publisher.StartHostPublication("host");
+    stats = publisher.GetStats();
+    CHECK_EQUAL(3u, stats.mServicesInFlight);
+    CHECK_EQUAL(1u, stats.mHostsInFlight);
+
+    publisher.FinishServicePublication("foo", "_srv._udp.", OTBR_ERROR_NONE);
+    publisher.FinishServicePublication("bar", "_srv._udp", OTBR_ERROR_DUPLICATED);
+    publisher.CancelServicePublication("baz", "_srv._udp");
+    publisher.FinishHostPublication("host", OTBR_ERROR_MDNS);
+    publisher.RecordServiceRename();
+    CHECK_EQUAL(2, serviceResults);
+
+    stats = publisher.GetStats();
+    CHECK_EQUAL(0u, stats.mServicesInFlight);
+    CHECK_EQUAL(0u, stats.mHostsInFlight);
+    CHECK_EQUAL(2u, stats.mServiceLatency.GetCount());
+    CHECK_EQUAL(1u, stats.mHostLatency.GetCount());
+    CHECK_EQUAL(2u, stats.mFailures);
+    CHECK_EQUAL(1u, stats.mConflicts);
+    CHECK_EQUAL(1u, stats.mRenames);
+
+    // A result without a publication in flight, e.g. a later conflict, has no latency.
+    publisher.FinishServicePublication("foo", "_srv._udp", OTBR_ERROR_DUPLICATED);
+    stats = publisher.GetStats();
+    CHECK_EQUAL(2u, stats.mServiceLatency.GetCount());
+    CHECK_EQUAL(2u, stats.mConflicts);
+
+    publisher.ResetStats();
+    stats = publisher.GetStats();
+    CHECK_EQUAL(0u, stats.mServiceLatency.GetCount());
+    CHECK_EQUAL(0u, stats.mFailures);
+}
+
+TEST(Mdns, TestRepeatedPublication)
+{
+    FakePublisher publisher;
+
+    // Only the first attempt owns the publication, which a failure of a later attempt must not cancel.
+    CHECK(publisher.StartServicePublication("foo", "_srv._udp"));
+    CHECK(!publisher.StartServicePublication("foo", "_srv._udp"));
+    CHECK(publisher.StartHostPublication("host"));
+    CHECK(!publisher.StartHostPublication("host"));
+    CHECK_EQUAL(1u, publisher.GetStats().mServicesInFlight);
+    CHECK_EQUAL(1u, publisher.GetStats().mHostsInFlight);
+
+    publisher.FinishServicePublication("foo", "_srv._udp", OTBR_ERROR_NONE);
+    CHECK(publisher.StartServicePublication("foo", "_srv._udp"));
+}
+
+TEST(Mdns, TestMakeAddressSet)
+{
+    using otbr::Ip6Address;
+    using otbr::Mdns::Publisher;
+
+    Ip6Address omr(0x0001);
+    Ip6Address eid(0x0002);
+
+    CHECK(Publisher::MakeAddressSet({omr, eid}) == Publisher::MakeAddressSet({eid, omr}));
+    CHECK(Publisher::MakeAddressSet({omr, eid, omr}) == Publisher::MakeAddressSet({eid, omr}));
+    CHECK_EQUAL(2u, Publisher::MakeAddressSet({eid, omr, eid}).size());
+    CHECK(Publisher::MakeAddressSet({omr}) != Publisher::MakeAddressSet({eid}));
+    CHECK(Publisher::MakeAddressSet({}).empty());
+}
@@ -0,0 +1,91 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/memory_usage.hpp"
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(MemoryUsage){};
+
+TEST(MemoryUsage, TestEstimations)
+{
+    std::string                  shortString = "a";
+    std::string                  longString(100, 'a');
+    std::vector<uint32_t>        vector(10);
+    std::list<uint64_t>          list(3);
+    std::map<int, int>           tree{{1, 1}, {2, 2}};
+    std::unordered_map<int, int> hashTable{{1, 1}};
+
+    UNSIGNED_LONGS_EQUAL(0, otbr::MemoryUsage::GetHeapSize(shortString));
+    CHECK(otbr::MemoryUsage::GetHeapSize(longString) > 100);
+    UNSIGNED_LONGS_EQUAL(vector.capacity() * sizeof(uint32_t), otbr::MemoryUsage::GetHeapSize(vector));
+    UNSIGNED_LONGS_EQUAL(3 * (sizeof(uint64_t) + otbr::MemoryUsage::kListNodeOverhead),
+                         otbr::MemoryUsage::GetListSize(list));
+    UNSIGNED_LONGS_EQUAL(2 * (sizeof(std::pair<const int, int>) + otbr::MemoryUsage::kTreeNodeOverhead),
+                         otbr::MemoryUsage::GetTreeSize(tree));
+    CHECK(otbr::MemoryUsage::GetHashTableSize(hashTable) >=
+          sizeof(std::pair<const int, int>) + otbr::MemoryUsage::kHashNodeOverhead);
+}
+
+TEST(MemoryUsage, TestReporter)
+{
+    otbr::MetricsRegistry registry;
+    std::string           output;
+    size_t                numEntries = 2;
+
+    {
+        otbr::MemoryReporter reporter(
+            "test_entries", "Test entries.", "test_memory_bytes", "Test memory.",
+            [&numEntries](size_t &aNumEntries, size_t &aNumBytes) {
+                aNumEntries = numEntries;
+                aNumBytes   = numEntries * 16;
+            },
+            registry);
+
+        registry.Render(output);
+        STRCMP_EQUAL("# HELP test_entries Test entries.\n"
+                     "# TYPE test_entries gauge\n"
+                     "test_entries 2\n"
+                     "# HELP test_memory_bytes Test memory.\n"
+                     "# TYPE test_memory_bytes gauge\n"
+                     "test_memory_bytes 32\n",
+                     output.c_str());
+    }
+
+    // The metrics keep their last values once the reporter is destroyed.
+    numEntries = 3;
+    output.clear();
+    registry.Render(output);
+    LONGS_EQUAL(2, registry.AddGauge("test_entries", "Test entries.").Get());
+}
@@ -0,0 +1,140 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/metrics_registry.hpp"
+
+#include <thread>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(MetricsRegistry){};
+
+TEST(MetricsRegistry, TestCounterAndGauge)
+{
+    otbr::MetricsRegistry registry;
+    std::string           output;
+
+    otbr::MetricsRegistry::Counter &counter = registry.AddCounter("test_events_total", "Test events.");
+    otbr::MetricsRegistry::Gauge &  gauge   = registry.AddGauge("test_open", "Test open.");
+
+    counter.Increment();
+    counter.Increment(2);
+    gauge.Set(5);
+    gauge.Add(-7);
+
+    // Registering a name again returns the same metric.
+    POINTERS_EQUAL(&counter, &registry.AddCounter("test_events_total", "Test events."));
+
+    registry.Render(output);
+    STRCMP_EQUAL("# HELP test_events_total Test events.\n"
+                 "# TYPE test_events_total counter\n"
+                 "test_events_total 3\n"
+                 "# HELP test_open Test open.\n"
+                 "# TYPE test_open gauge\n"
+                 "test_open -2\n",
+                 output.c_str());
+}
+
+TEST(MetricsRegistry, TestHistogram)
+{
+    static const uint64_t kBounds[] = {1000, 10000};
+
+    otbr::MetricsRegistry            registry;
+    std::string                      output;
+    otbr::MetricsRegistry::Histogram &histogram =
+        registry.AddHistogram("test_latency_seconds", "Test latency.", kBounds, 2, 1e-6);
+
+    histogram.Observe(500);
+    histogram.Observe(1000);
+    histogram.Observe(5000);
+    histogram.Observe(20000);
+
+    UNSIGNED_LONGS_EQUAL(2, histogram.GetBucketCount(0));
+    UNSIGNED_LONGS_EQUAL(1, histogram.GetBucketCount(1));
+    UNSIGNED_LONGS_EQUAL(1, histogram.GetBucketCount(2));
+    UNSIGNED_LONGS_EQUAL(4, histogram.GetCount());
+
+    registry.Render(output);
+    STRCMP_EQUAL("# HELP test_latency_seconds Test latency.\n"
+                 "# TYPE test_latency_seconds histogram\n"
+                 "test_latency_seconds_bucket{le=\"0.001\"} 2\n"
+                 "test_latency_seconds_bucket{le=\"0.01\"} 3\n"
+                 "test_latency_seconds_bucket{le=\"+Inf\"} 4\n"
+                 "test_latency_seconds_sum 0.0265\n"
+                 "test_latency_seconds_count 4\n",
+                 output.c_str());
+}
+
+TEST(MetricsRegistry, TestCollector)
+{
+    otbr::MetricsRegistry              registry;
+    std::string                        output;
+    int                                numRuns = 0;
+    otbr::MetricsRegistry::Gauge &     gauge   = registry.AddGauge("test_size", "Test size.");
+    otbr::MetricsRegistry::CollectorId id = registry.AddCollector([&gauge, &numRuns]() { gauge.Set(++numRuns); });
+
+    registry.Render(output);
+    STRCMP_EQUAL("# HELP test_size Test size.\n"
+                 "# TYPE test_size gauge\n"
+                 "test_size 1\n",
+                 output.c_str());
+
+    // A removed collector is not run anymore, the gauge keeps its last value.
+    registry.RemoveCollector(id);
+    output.clear();
+    registry.Render(output);
+    LONGS_EQUAL(1, numRuns);
+    LONGS_EQUAL(1, gauge.Get());
+}
+
+TEST(MetricsRegistry, TestConcurrentIncrements)
+{
+    static constexpr int kNumThreads    = 4;
+    static constexpr int kNumIncrements = 10000;
+
+    otbr::MetricsRegistry           registry;
+    otbr::MetricsRegistry::Counter &counter = registry.AddCounter("test_events_total", "Test events.");
+    std::thread                     threads[kNumThreads];
+
+    for (std::thread &thread : threads)
+    {
+        thread = std::thread([&counter]() {
+            for (int i = 0; i < kNumIncrements; ++i)
+            {
+                counter.Increment();
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    UNSIGNED_LONGS_EQUAL(kNumThreads * kNumIncrements, counter.Get());
+}
@@ -0,0 +1,109 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/mpsc_ring_buffer.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(MpscRingBuffer){};
+
+TEST(MpscRingBuffer, TestPushPopInOrderUntilFull)
+{
+    otbr::MpscRingBuffer<int, 4> ring;
+    int                          value;
+
+    CHECK_FALSE(ring.TryPop(value));
+
+    for (int i = 0; i < 4; i++)
+    {
+        CHECK_TRUE(ring.TryPush(i));
+    }
+
+    CHECK_FALSE(ring.TryPush(4));
+    CHECK(ring.GetSize() == 4);
+
+    CHECK_TRUE(ring.TryPop(value));
+    CHECK_EQUAL(0, value);
+    CHECK_TRUE(ring.TryPush(4));
+
+    for (int i = 1; i <= 4; i++)
+    {
+        CHECK_TRUE(ring.TryPop(value));
+        CHECK_EQUAL(i, value);
+    }
+
+    CHECK_FALSE(ring.TryPop(value));
+    CHECK(ring.GetSize() == 0);
+}
+
+TEST(MpscRingBuffer, TestConcurrentProducers)
+{
+    static constexpr int kProducers = 4;
+    static constexpr int kValues    = 10000;
+
+    otbr::MpscRingBuffer<int, 64> ring;
+    std::vector<std::thread>      producers;
+    int                           lastValues[kProducers];
+    int                           value;
+
+    for (int i = 0; i < kProducers; i++)
+    {
+        lastValues[i] = -1;
+        producers.emplace_back([&ring, i]() {
+            for (int j = 0; j < kValues; j++)
+            {
+                while (!ring.TryPush(i * kValues + j))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Every value is popped exactly once, in the order of its producer.
+    for (int popped = 0; popped < kProducers * kValues;)
+    {
+        if (ring.TryPop(value))
+        {
+            CHECK_EQUAL(lastValues[value / kValues] + 1, value % kValues);
+            lastValues[value / kValues] = value % kValues;
+            popped++;
+        }
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    CHECK_FALSE(ring.TryPop(value));
+}
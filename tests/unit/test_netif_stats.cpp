@@ -0,0 +1,144 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/netif_stats.hpp"
+
+#include <errno.h>
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::NetifStatsSampler;
+
+namespace {
+
+size_t BuildStatsReply(uint8_t *aBuffer, uint32_t aSequence, const struct rtnl_link_stats64 &aStats)
+{
+    struct nlmsghdr *    header = reinterpret_cast<struct nlmsghdr *>(aBuffer);
+    struct if_stats_msg *msg    = static_cast<struct if_stats_msg *>(NLMSG_DATA(header));
+    struct rtattr *      attr =
+        reinterpret_cast<struct rtattr *>(reinterpret_cast<uint8_t *>(msg) + NLMSG_ALIGN(sizeof(*msg)));
+
+    memset(msg, 0, sizeof(*msg));
+    attr->rta_type = IFLA_STATS_LINK_64;
+    attr->rta_len  = RTA_LENGTH(sizeof(aStats));
+    memcpy(RTA_DATA(attr), &aStats, sizeof(aStats));
+
+    header->nlmsg_len   = NLMSG_SPACE(sizeof(*msg)) + RTA_SPACE(sizeof(aStats));
+    header->nlmsg_type  = RTM_NEWSTATS;
+    header->nlmsg_flags = 0;
+    header->nlmsg_seq   = aSequence;
+    header->nlmsg_pid   = 0;
+
+    return header->nlmsg_len;
+}
+
+} // namespace
+
+TEST_GROUP(NetifStats){};
+
+TEST(NetifStats, TestParseStatsReply)
+{
+    alignas(struct nlmsghdr) uint8_t buffer[512];
+    struct rtnl_link_stats64         stats;
+    NetifStatsSampler::Counters      counters;
+    size_t                           length;
+
+    memset(&stats, 0, sizeof(stats));
+    stats.rx_bytes   = 1000;
+    stats.tx_bytes   = 2000;
+    stats.rx_packets = 10;
+    stats.tx_packets = 20;
+    stats.rx_dropped = 1;
+    stats.tx_dropped = 2;
+
+    length = BuildStatsReply(buffer, 7, stats);
+
+    CHECK(NetifStatsSampler::ParseStatsReply(buffer, length, 8, counters) == OTBR_ERROR_NOT_FOUND);
+    CHECK(NetifStatsSampler::ParseStatsReply(buffer, length, 7, counters) == OTBR_ERROR_NONE);
+    UNSIGNED_LONGS_EQUAL(1000, counters.mRxBytes);
+    UNSIGNED_LONGS_EQUAL(2000, counters.mTxBytes);
+    UNSIGNED_LONGS_EQUAL(10, counters.mRxPackets);
+    UNSIGNED_LONGS_EQUAL(20, counters.mTxPackets);
+    UNSIGNED_LONGS_EQUAL(3, counters.mDrops);
+}
+
+TEST(NetifStats, TestParseErrorReply)
+{
+    alignas(struct nlmsghdr) uint8_t buffer[NLMSG_SPACE(sizeof(struct nlmsgerr))];
+    struct nlmsghdr *                header = reinterpret_cast<struct nlmsghdr *>(buffer);
+    struct nlmsgerr *                err    = static_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+    NetifStatsSampler::Counters      counters;
+
+    memset(buffer, 0, sizeof(buffer));
+    header->nlmsg_len  = NLMSG_LENGTH(sizeof(struct nlmsgerr));
+    header->nlmsg_type = NLMSG_ERROR;
+    header->nlmsg_seq  = 3;
+    err->error         = -ENODEV;
+
+    CHECK(NetifStatsSampler::ParseStatsReply(buffer, header->nlmsg_len, 3, counters) == OTBR_ERROR_ERRNO);
+    LONGS_EQUAL(ENODEV, errno);
+}
+
+TEST(NetifStats, TestComputeRates)
+{
+    NetifStatsSampler::Counters previous;
+    NetifStatsSampler::Counters current;
+    NetifStatsSampler::Rates    rates;
+
+    previous.mRxBytes   = 1000;
+    previous.mTxBytes   = 5000;
+    previous.mRxPackets = 10;
+    current.mRxBytes    = 6000;
+    current.mTxBytes    = 4000;
+    current.mRxPackets  = 30;
+    current.mDrops      = 4;
+
+    rates = NetifStatsSampler::ComputeRates(previous, current, otbr::Milliseconds(2000));
+    UNSIGNED_LONGS_EQUAL(2500, rates.mRxBytes);
+    UNSIGNED_LONGS_EQUAL(0, rates.mTxBytes);
+    UNSIGNED_LONGS_EQUAL(10, rates.mRxPackets);
+    UNSIGNED_LONGS_EQUAL(0, rates.mTxPackets);
+    UNSIGNED_LONGS_EQUAL(2, rates.mDrops);
+
+    rates = NetifStatsSampler::ComputeRates(previous, current, otbr::Milliseconds(0));
+    UNSIGNED_LONGS_EQUAL(0, rates.mRxBytes);
+}
+
+TEST(NetifStats, TestSampleMissingInterface)
+{
+    otbr::MetricsRegistry registry;
+    NetifStatsSampler     sampler(registry);
+
+    sampler.AddInterface(NetifStatsSampler::Role::kThread, "otbr-test-none");
+    CHECK(sampler.Sample(otbr::Clock::now()) == OTBR_ERROR_NONE);
+    UNSIGNED_LONGS_EQUAL(0, sampler.GetRates(NetifStatsSampler::Role::kThread).mRxBytes);
+}
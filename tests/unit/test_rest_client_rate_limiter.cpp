@@ -0,0 +1,90 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "rest/client_rate_limiter.hpp"
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::rest::ClientRateLimiter;
+
+TEST_GROUP(ClientRateLimiter){};
+
+TEST(ClientRateLimiter, TestBurstAndRefill)
+{
+    ClientRateLimiter limiter(/* aRate */ 10, /* aBurst */ 3, /* aMaxClients */ 4);
+    Timepoint         now = Timepoint() + Milliseconds(1000);
+
+    CHECK(limiter.Admit(1, now));
+    CHECK(limiter.Admit(1, now));
+    CHECK(limiter.Admit(1, now));
+    CHECK(!limiter.Admit(1, now));
+
+    // Other clients have buckets of their own.
+    CHECK(limiter.Admit(2, now));
+
+    // One token is refilled every 100 ms.
+    CHECK(!limiter.Admit(1, now + Milliseconds(50)));
+    CHECK(limiter.Admit(1, now + Milliseconds(150)));
+    CHECK(!limiter.Admit(1, now + Milliseconds(150)));
+
+    // The bucket never holds more than a burst.
+    now += Milliseconds(10000);
+    CHECK(limiter.Admit(1, now));
+    CHECK(limiter.Admit(1, now));
+    CHECK(limiter.Admit(1, now));
+    CHECK(!limiter.Admit(1, now));
+}
+
+TEST(ClientRateLimiter, TestEvictIdleClients)
+{
+    ClientRateLimiter limiter(/* aRate */ 1, /* aBurst */ 2, /* aMaxClients */ 3);
+    Timepoint         now = Timepoint() + Milliseconds(1000);
+
+    for (uint32_t client = 1; client <= 3; ++client)
+    {
+        CHECK(limiter.Admit(client, now + Milliseconds(client)));
+    }
+    CHECK_EQUAL(3u, limiter.GetClientCount());
+
+    // No bucket has refilled, so the one idle for the longest time gives way to the new client.
+    CHECK(limiter.Admit(4, now + Milliseconds(10)));
+    CHECK_EQUAL(3u, limiter.GetClientCount());
+
+    // Client 2 keeps its bucket, client 1 starts over with a full one.
+    CHECK(limiter.Admit(2, now + Milliseconds(10)));
+    CHECK(!limiter.Admit(2, now + Milliseconds(10)));
+    CHECK(limiter.Admit(1, now + Milliseconds(20)));
+    CHECK(limiter.Admit(1, now + Milliseconds(20)));
+    CHECK_EQUAL(3u, limiter.GetClientCount());
+
+    // All the buckets have refilled after a while, they are all dropped for a new client.
+    CHECK(limiter.Admit(5, now + Milliseconds(5000)));
+    CHECK_EQUAL(1u, limiter.GetClientCount());
+}
@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "rest/diag_record.hpp"
+
+using otbr::rest::DiagRecord;
+
+TEST_GROUP(DiagRecord){};
+
+TEST(DiagRecord, TestEmpty)
+{
+    DiagRecord       record;
+    otNetworkDiagTlv tlv;
+    size_t           offset = 0;
+
+    CHECK_EQUAL(0, record.GetSize());
+    CHECK(!record.GetNext(offset, tlv));
+    CHECK_EQUAL(0, offset);
+}
+
+TEST(DiagRecord, TestRoundTrip)
+{
+    DiagRecord       record;
+    otNetworkDiagTlv tlv;
+    otNetworkDiagTlv next;
+    size_t           offset = 0;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+    for (uint8_t i = 0; i < sizeof(tlv.mData.mExtAddress.m8); i++)
+    {
+        tlv.mData.mExtAddress.m8[i] = i + 1;
+    }
+    record.Append(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = 0x1c00;
+    record.Append(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA;
+    tlv.mData.mNetworkData.mCount = 3;
+    tlv.mData.mNetworkData.m8[0]  = 0x08;
+    tlv.mData.mNetworkData.m8[1]  = 0x01;
+    tlv.mData.mNetworkData.m8[2]  = 0xff;
+    record.Append(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                                     = OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST;
+    tlv.mData.mIp6AddrList.mCount                 = 2;
+    tlv.mData.mIp6AddrList.mList[0].mFields.m8[0] = 0xfd;
+    tlv.mData.mIp6AddrList.mList[1].mFields.m8[0] = 0xfe;
+    record.Append(tlv);
+
+    // Only the used part of every TLV is stored.
+    CHECK(record.GetSize() < sizeof(tlv));
+
+    memset(&next, 0xa5, sizeof(next));
+    CHECK(record.GetNext(offset, next));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS, next.mType);
+    for (uint8_t i = 0; i < sizeof(next.mData.mExtAddress.m8); i++)
+    {
+        CHECK_EQUAL(i + 1, next.mData.mExtAddress.m8[i]);
+    }
+
+    CHECK(record.GetNext(offset, next));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS, next.mType);
+    CHECK_EQUAL(0x1c00, next.mData.mAddr16);
+
+    CHECK(record.GetNext(offset, next));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA, next.mType);
+    CHECK_EQUAL(3, next.mData.mNetworkData.mCount);
+    CHECK_EQUAL(0x08, next.mData.mNetworkData.m8[0]);
+    CHECK_EQUAL(0x01, next.mData.mNetworkData.m8[1]);
+    CHECK_EQUAL(0xff, next.mData.mNetworkData.m8[2]);
+
+    CHECK(record.GetNext(offset, next));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST, next.mType);
+    CHECK_EQUAL(2, next.mData.mIp6AddrList.mCount);
+    CHECK_EQUAL(0xfd, next.mData.mIp6AddrList.mList[0].mFields.m8[0]);
+    CHECK_EQUAL(0xfe, next.mData.mIp6AddrList.mList[1].mFields.m8[0]);
+
+    CHECK(!record.GetNext(offset, next));
+    CHECK_EQUAL(record.GetSize(), offset);
+}
+
+TEST(DiagRecord, TestEmptyTable)
+{
+    DiagRecord       record;
+    otNetworkDiagTlv tlv;
+    size_t           offset = 0;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+    record.Append(tlv);
+
+    // The count of an empty table is still stored.
+    memset(&tlv, 0xa5, sizeof(tlv));
+    CHECK(record.GetNext(offset, tlv));
+    CHECK_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE, tlv.mType);
+    CHECK_EQUAL(0, tlv.mData.mChildTable.mCount);
+    CHECK(!record.GetNext(offset, tlv));
+}
@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <unistd.h>
+
+#include <sys/socket.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "rest/event_stream.hpp"
+
+using otbr::Timepoint;
+using otbr::rest::EventStream;
+
+TEST_GROUP(EventStream){};
+
+// Opens a connected pair of sockets, the first one with a small send buffer is the server side of the stream.
+static void OpenSockets(int aFds[2])
+{
+    int size = 4096;
+
+    CHECK_EQUAL(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, aFds));
+    CHECK_EQUAL(0, setsockopt(aFds[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)));
+}
+
+// Reads everything the client side has received so far.
+static size_t Drain(int aFd, std::string &aReceived)
+{
+    char    buf[4096];
+    ssize_t received;
+    size_t  total = 0;
+
+    while ((received = read(aFd, buf, sizeof(buf))) > 0)
+    {
+        aReceived.append(buf, static_cast<size_t>(received));
+        total += static_cast<size_t>(received);
+    }
+
+    return total;
+}
+
+TEST(EventStream, TestPingIdleStream)
+{
+    EventStream stream;
+    Timepoint   now = otbr::Clock::now();
+    std::string received;
+    int         fds[2];
+
+    OpenSockets(fds);
+    stream.Start(now);
+    CHECK(stream.GetDeadline() == now + EventStream::kPingInterval);
+
+    // No comment is due before the deadline.
+    CHECK_EQUAL(OTBR_ERROR_NONE, stream.Process(fds[0], now + EventStream::kPingInterval / 2));
+    CHECK_EQUAL(0u, Drain(fds[1], received));
+
+    now = stream.GetDeadline();
+    CHECK_EQUAL(OTBR_ERROR_NONE, stream.Process(fds[0], now));
+    CHECK_FALSE(stream.HasPending());
+    CHECK(stream.GetDeadline() == now + EventStream::kPingInterval);
+    Drain(fds[1], received);
+    STRCMP_EQUAL(":\n\n", received.c_str());
+
+    // Sending an event postpones the next comment.
+    now += EventStream::kPingInterval / 2;
+    CHECK_EQUAL(OTBR_ERROR_NONE, stream.Send(fds[0], "data: x\n\n", now));
+    CHECK(stream.GetDeadline() == now + EventStream::kPingInterval);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(EventStream, TestStalledStream)
+{
+    EventStream       stream;
+    Timepoint         now = otbr::Clock::now();
+    const std::string event(1024, 'x');
+    std::string       received;
+    size_t            backlog;
+    size_t            sent = 0;
+    int               fds[2];
+
+    OpenSockets(fds);
+    stream.Start(now);
+
+    // The client doesn't read, fill its socket until the events are pending.
+    while (!stream.HasPending())
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, stream.Send(fds[0], event, now));
+        sent += event.size();
+    }
+
+    backlog = stream.GetBacklog();
+
+    // Every deadline of a stalled stream is in the future and no comments pile up behind the pending events.
+    for (int i = 0; i < 100; i++)
+    {
+        now = stream.GetDeadline();
+        CHECK_EQUAL(OTBR_ERROR_NONE, stream.Process(fds[0], now));
+        CHECK(stream.GetDeadline() > now);
+        CHECK_EQUAL(backlog, stream.GetBacklog());
+    }
+
+    // An event beyond the backlog limit is refused, so that the slow client is disconnected.
+    CHECK_EQUAL(OTBR_ERROR_BUSY, stream.Send(fds[0], std::string(EventStream::kMaxBacklog, 'y'), now));
+    CHECK_EQUAL(backlog, stream.GetBacklog());
+
+    // The pending events are sent once the client reads again.
+    while (stream.HasPending())
+    {
+        Drain(fds[1], received);
+        CHECK_EQUAL(OTBR_ERROR_NONE, stream.Flush(fds[0], now));
+    }
+
+    Drain(fds[1], received);
+    CHECK_EQUAL(sent, received.size());
+    CHECK(received == std::string(sent, 'x'));
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(EventStream, TestClosedClient)
+{
+    EventStream stream;
+    Timepoint   now = otbr::Clock::now();
+    int         fds[2];
+
+    OpenSockets(fds);
+    stream.Start(now);
+    close(fds[1]);
+
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, stream.Send(fds[0], "data: x\n\n", now));
+    close(fds[0]);
+}
@@ -0,0 +1,73 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/startup_profiler.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(StartupProfiler){};
+
+TEST(StartupProfiler, TestPhases)
+{
+    otbr::Timepoint       start = otbr::Clock::now();
+    otbr::StartupProfiler profiler(start);
+
+    CHECK_FALSE(profiler.IsFinished());
+    CHECK_TRUE(profiler.GetPhases().empty());
+
+    profiler.EndPhase("first", start + otbr::Milliseconds(20));
+    profiler.EndPhase("second", start + otbr::Milliseconds(25));
+
+    UNSIGNED_LONGS_EQUAL(2, profiler.GetPhases().size());
+    STRCMP_EQUAL("first", profiler.GetPhases()[0].mName);
+    STRCMP_EQUAL("second", profiler.GetPhases()[1].mName);
+    CHECK_TRUE(profiler.GetPhases()[0].mDuration == otbr::Milliseconds(20));
+    CHECK_TRUE(profiler.GetPhases()[0].mEnd == otbr::Milliseconds(20));
+    CHECK_TRUE(profiler.GetPhases()[1].mDuration == otbr::Milliseconds(5));
+    CHECK_TRUE(profiler.GetPhases()[1].mEnd == otbr::Milliseconds(25));
+    CHECK_TRUE(profiler.GetDuration(start + otbr::Milliseconds(30)) == otbr::Milliseconds(30));
+}
+
+TEST(StartupProfiler, TestFinish)
+{
+    otbr::Timepoint       start = otbr::Clock::now();
+    otbr::StartupProfiler profiler(start);
+
+    profiler.EndPhase("only", start + otbr::Milliseconds(10));
+    profiler.Finish(start + otbr::Milliseconds(15));
+
+    CHECK_TRUE(profiler.IsFinished());
+    CHECK_TRUE(profiler.GetDuration(start + otbr::Milliseconds(100)) == otbr::Milliseconds(15));
+
+    // Phases ending after the startup and finishing again are ignored.
+    profiler.EndPhase("late", start + otbr::Milliseconds(40));
+    profiler.Finish(start + otbr::Milliseconds(50));
+
+    UNSIGNED_LONGS_EQUAL(1, profiler.GetPhases().size());
+    CHECK_TRUE(profiler.GetDuration(start + otbr::Milliseconds(100)) == otbr::Milliseconds(15));
+}
@@ -0,0 +1,70 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/steering_data.hpp"
+
+TEST_GROUP(SteeringData){};
+
+TEST(SteeringData, TestComputeBloomFilter)
+{
+    const uint8_t eui64s[][otbr::SteeringData::kSizeJoinerId] = {
+        {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02},
+        {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03},
+    };
+    const uint8_t expected[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    };
+    uint8_t            joinerIds[2][otbr::SteeringData::kSizeJoinerId];
+    otbr::SteeringData batch;
+    otbr::SteeringData incremental;
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        otbr::SteeringData::ComputeJoinerId(eui64s[i], joinerIds[i]);
+    }
+
+    batch.Init(sizeof(expected));
+    batch.ComputeBloomFilter(&joinerIds[0][0], 2);
+    MEMCMP_EQUAL(expected, batch.GetBloomFilter(), sizeof(expected));
+
+    incremental.Init(sizeof(expected));
+    incremental.ComputeBloomFilter(joinerIds[0]);
+    incremental.ComputeBloomFilter(joinerIds[1]);
+    MEMCMP_EQUAL(expected, incremental.GetBloomFilter(), sizeof(expected));
+}
+
+TEST(SteeringData, TestComputeLength)
+{
+    CHECK_EQUAL(1, otbr::SteeringData::ComputeLength(0));
+    CHECK_EQUAL(3, otbr::SteeringData::ComputeLength(1));
+    CHECK_EQUAL(15, otbr::SteeringData::ComputeLength(6));
+    CHECK_EQUAL(otbr::SteeringData::kMaxSizeOfBloomFilter, otbr::SteeringData::ComputeLength(7));
+    CHECK_EQUAL(otbr::SteeringData::kMaxSizeOfBloomFilter, otbr::SteeringData::ComputeLength(500));
+}
@@ -0,0 +1,48 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/system_utils.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(SystemUtils){};
+
+TEST(SystemUtils, TestExecuteCommandArgv)
+{
+    const char *kTrue[]           = {"true", nullptr};
+    const char *kExitCode[]       = {"sh", "-c", "exit 3", nullptr};
+    const char *kNoQuoting[]      = {"sh", "-c", "test \"$0\" = 'a b;c'", "a b;c", nullptr};
+    const char *kNotExisting[]    = {"otbr-not-existing-program", nullptr};
+    const char *kKilledBySignal[] = {"sh", "-c", "kill -9 $$", nullptr};
+
+    CHECK_EQUAL(0, otbr::SystemUtils::ExecuteCommand(kTrue));
+    CHECK_EQUAL(3, otbr::SystemUtils::ExecuteCommand(kExitCode));
+    CHECK_EQUAL(0, otbr::SystemUtils::ExecuteCommand(kNoQuoting));
+    CHECK(otbr::SystemUtils::ExecuteCommand(kNotExisting) != 0);
+    CHECK_EQUAL(-1, otbr::SystemUtils::ExecuteCommand(kKilledBySignal));
+}
@@ -179,6 +179,56 @@ TEST(TaskRunner, TestPostAndWait)
     CHECK_EQUAL(10, counter.load());
 }
 
+TEST(TaskRunner, TestPostAsync)
+{
+    otbr::TaskRunner              taskRunner;
+    std::vector<std::future<int>> futures;
+    std::thread                   thread([&]() {
+        for (int i = 0; i < 10; ++i)
+        {
+            futures.push_back(taskRunner.PostAsync<int>([i]() { return i * i; }));
+        }
+    });
+
+    thread.join();
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {0, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        CHECK_TRUE(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                          &mainloop.mTimeout) >= 0);
+        taskRunner.Process(mainloop);
+    }
+
+    CHECK_TRUE(futures.size() == 10);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        CHECK_EQUAL(i * i, futures[i].get());
+    }
+}
+
+TEST(TaskRunner, TestPostAndWaitTimeout)
+{
+    otbr::TaskRunner taskRunner;
+    int              result = 0;
+    otbrError        error;
+
+    // Nobody runs the mainloop, so the task cannot complete in time.
+    error = taskRunner.PostAndWait<int>([]() { return 1; }, std::chrono::milliseconds(10), result);
+    CHECK_EQUAL(OTBR_ERROR_TIMEOUT, error);
+    CHECK_EQUAL(0, result);
+}
+
 TEST(TaskRunner, TestDelayedTasks)
 {
     std::atomic<int>         counter{0};
@@ -252,6 +302,50 @@ TEST(TaskRunner, TestDelayedTasksOrder)
     STRCMP_EQUAL("bac", str.c_str());
 }
 
+TEST(TaskRunner, TestCancelAndRescheduleDelayedTasks)
+{
+    std::string                  str;
+    otbr::TaskRunner             taskRunner;
+    otbr::TaskRunner::TaskHandle handleA;
+    otbr::TaskRunner::TaskHandle handleB;
+    otbr::TaskRunner::TaskHandle handleC;
+
+    handleA = taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('a'); });
+    handleB = taskRunner.Post(std::chrono::milliseconds(20), [&]() { str.push_back('b'); });
+    handleC = taskRunner.Post(std::chrono::milliseconds(30), [&]() { str.push_back('c'); });
+
+    CHECK_TRUE(handleB.Cancel());
+    CHECK_FALSE(handleB.Cancel());
+    CHECK_FALSE(handleB.Reschedule(std::chrono::milliseconds(0)));
+    CHECK_TRUE(handleC.Reschedule(std::chrono::milliseconds(0)));
+    CHECK_FALSE(otbr::TaskRunner::TaskHandle().Cancel());
+
+    while (str.size() < 2)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        CHECK_TRUE(rval >= 0 || errno == EINTR);
+
+        taskRunner.Process(mainloop);
+    }
+
+    // The rescheduled task runs first, and the cancelled task never runs.
+    STRCMP_EQUAL("ca", str.c_str());
+    CHECK_FALSE(handleA.Cancel());
+    CHECK_FALSE(handleC.Reschedule(std::chrono::milliseconds(10)));
+}
+
 TEST(TaskRunner, TestAllAPIs)
 {
     std::atomic<int>         counter{0};
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/thread_schedule.hpp"
+
+#include <thread>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(ThreadSchedule){};
+
+TEST(ThreadSchedule, TestParsePolicy)
+{
+    otbr::ThreadSchedule schedule;
+
+    CHECK(otbr::ParseSchedulePolicy("fifo:50", schedule) == OTBR_ERROR_NONE);
+    LONGS_EQUAL(SCHED_FIFO, schedule.mPolicy);
+    LONGS_EQUAL(50, schedule.mPriority);
+
+    CHECK(otbr::ParseSchedulePolicy("rr:1", schedule) == OTBR_ERROR_NONE);
+    LONGS_EQUAL(SCHED_RR, schedule.mPolicy);
+    LONGS_EQUAL(1, schedule.mPriority);
+
+    CHECK(otbr::ParseSchedulePolicy("other:-5", schedule) == OTBR_ERROR_NONE);
+    LONGS_EQUAL(SCHED_OTHER, schedule.mPolicy);
+    LONGS_EQUAL(0, schedule.mPriority);
+    LONGS_EQUAL(-5, schedule.mNice);
+
+    CHECK(otbr::ParseSchedulePolicy("other", schedule) == OTBR_ERROR_NONE);
+    LONGS_EQUAL(0, schedule.mNice);
+
+    CHECK(otbr::ParseSchedulePolicy("fifo", schedule) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseSchedulePolicy("fifo:0", schedule) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseSchedulePolicy("fifo:100", schedule) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseSchedulePolicy("rr:5x", schedule) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseSchedulePolicy("other:20", schedule) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseSchedulePolicy("batch", schedule) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseSchedulePolicy("fifo50", schedule) == OTBR_ERROR_INVALID_ARGS);
+    LONGS_EQUAL(SCHED_OTHER, schedule.mPolicy);
+}
+
+TEST(ThreadSchedule, TestParseCpuList)
+{
+    cpu_set_t cpus;
+
+    CHECK(otbr::ParseCpuList("0,2-3", cpus) == OTBR_ERROR_NONE);
+    LONGS_EQUAL(3, CPU_COUNT(&cpus));
+    CHECK(CPU_ISSET(0, &cpus));
+    CHECK(!CPU_ISSET(1, &cpus));
+    CHECK(CPU_ISSET(2, &cpus));
+    CHECK(CPU_ISSET(3, &cpus));
+
+    CHECK(otbr::ParseCpuList("5", cpus) == OTBR_ERROR_NONE);
+    LONGS_EQUAL(1, CPU_COUNT(&cpus));
+    CHECK(CPU_ISSET(5, &cpus));
+
+    CHECK(otbr::ParseCpuList("", cpus) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseCpuList("1,", cpus) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseCpuList("3-1", cpus) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseCpuList("-1", cpus) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseCpuList("1;2", cpus) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(otbr::ParseCpuList("100000", cpus) == OTBR_ERROR_INVALID_ARGS);
+}
+
+TEST(ThreadSchedule, TestApplyHousekeepingSchedule)
+{
+    otbr::ThreadSchedule schedule;
+    otbr::ThreadSchedule applied;
+    otbrError            error = OTBR_ERROR_ERRNO;
+
+    CHECK(otbr::ApplyHousekeepingSchedule() == OTBR_ERROR_NONE);
+
+    // Raising the niceness needs no privileges.
+    CHECK(otbr::GetThreadSchedule(schedule) == OTBR_ERROR_NONE);
+    schedule.mPolicy = SCHED_OTHER;
+    schedule.mNice   = 19;
+    otbr::SetHousekeepingSchedule(schedule);
+
+    std::thread([&error, &applied]() {
+        error = otbr::ApplyHousekeepingSchedule();
+        CHECK(otbr::GetThreadSchedule(applied) == OTBR_ERROR_NONE);
+    }).join();
+
+    CHECK(error == OTBR_ERROR_NONE);
+    LONGS_EQUAL(SCHED_OTHER, applied.mPolicy);
+    LONGS_EQUAL(19, applied.mNice);
+    CHECK(CPU_EQUAL(&schedule.mCpus, &applied.mCpus));
+
+    otbr::ClearHousekeepingSchedule();
+    CHECK(otbr::ApplyHousekeepingSchedule() == OTBR_ERROR_NONE);
+}
@@ -0,0 +1,189 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <string>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::TimerWheel;
+
+TEST_GROUP(TimerWheel){};
+
+TEST(TimerWheel, TestEmpty)
+{
+    Timepoint        start = otbr::Clock::now();
+    TimerWheel       wheel(start);
+    TimerWheel::Task task;
+
+    CHECK_TRUE(wheel.IsEmpty());
+    CHECK_TRUE(wheel.GetNextDeadline() == Timepoint::max());
+    CHECK_FALSE(wheel.PopExpired(start + Milliseconds(1000), task));
+}
+
+TEST(TimerWheel, TestExpireInOrder)
+{
+    Timepoint        start = otbr::Clock::now();
+    TimerWheel       wheel(start);
+    TimerWheel::Task task;
+    std::string      str;
+
+    wheel.Add(start + Milliseconds(10), [&]() { str.push_back('a'); });
+    wheel.Add(start + Milliseconds(9), [&]() { str.push_back('b'); });
+    wheel.Add(start + Milliseconds(10), [&]() { str.push_back('c'); });
+
+    CHECK_TRUE(wheel.GetNextDeadline() == start + Milliseconds(9));
+    CHECK_FALSE(wheel.PopExpired(start + Milliseconds(8), task));
+
+    while (wheel.PopExpired(start + Milliseconds(10), task))
+    {
+        task();
+    }
+
+    STRCMP_EQUAL("bac", str.c_str());
+    CHECK_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, TestAllLevels)
+{
+    // Deadlines in every level of the wheel and in the overflow list.
+    const std::vector<int64_t> kDelays = {1, 63, 64, 65, 4095, 4096, 300000, 16777215, 16777216, 40000000};
+    Timepoint                  start   = otbr::Clock::now();
+    TimerWheel                 wheel(start);
+    TimerWheel::Task           task;
+    std::vector<int64_t>       expired;
+    Timepoint                  now = start;
+
+    for (auto it = kDelays.rbegin(); it != kDelays.rend(); ++it)
+    {
+        int64_t delay = *it;
+
+        wheel.Add(start + Milliseconds(delay), [&expired, delay]() { expired.push_back(delay); });
+    }
+
+    while (!wheel.IsEmpty())
+    {
+        Timepoint deadline = wheel.GetNextDeadline();
+
+        CHECK_TRUE(deadline >= now);
+        CHECK_FALSE(deadline > now && wheel.PopExpired(deadline - Milliseconds(1), task));
+
+        now = deadline;
+        CHECK_TRUE(wheel.PopExpired(now, task));
+        task();
+    }
+
+    CHECK_TRUE(kDelays == expired);
+}
+
+TEST(TimerWheel, TestAddWhileAdvancing)
+{
+    Timepoint        start = otbr::Clock::now();
+    TimerWheel       wheel(start);
+    TimerWheel::Task task;
+    int              counter = 0;
+
+    wheel.Add(start + Milliseconds(5000), [&]() { ++counter; });
+    CHECK_FALSE(wheel.PopExpired(start + Milliseconds(4990), task));
+
+    // Deadlines in the past expire immediately.
+    wheel.Add(start + Milliseconds(100), [&]() { counter += 10; });
+    wheel.Add(start + Milliseconds(4999), [&]() { counter += 100; });
+    CHECK_TRUE(wheel.GetNextDeadline() <= start + Milliseconds(4990));
+
+    while (wheel.PopExpired(start + Milliseconds(5000), task))
+    {
+        task();
+    }
+
+    CHECK_EQUAL(111, counter);
+}
+
+TEST(TimerWheel, TestCancel)
+{
+    Timepoint           start = otbr::Clock::now();
+    TimerWheel          wheel(start);
+    TimerWheel::Task    task;
+    std::string         str;
+    TimerWheel::TimerId a;
+    TimerWheel::TimerId b;
+
+    a = wheel.Add(start + Milliseconds(10), [&]() { str.push_back('a'); });
+    b = wheel.Add(start + Milliseconds(5000), [&]() { str.push_back('b'); });
+    wheel.Add(start + Milliseconds(20), [&]() { str.push_back('c'); });
+
+    CHECK_TRUE(wheel.Cancel(a));
+    CHECK_FALSE(wheel.Cancel(a));
+    CHECK_TRUE(wheel.GetNextDeadline() == start + Milliseconds(20));
+
+    CHECK_TRUE(wheel.Cancel(b));
+    CHECK_FALSE(wheel.Cancel(TimerWheel::kInvalidTimerId));
+
+    while (wheel.PopExpired(start + Milliseconds(10000), task))
+    {
+        task();
+    }
+
+    STRCMP_EQUAL("c", str.c_str());
+    CHECK_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, TestReschedule)
+{
+    Timepoint           start = otbr::Clock::now();
+    TimerWheel          wheel(start);
+    TimerWheel::Task    task;
+    std::string         str;
+    TimerWheel::TimerId a;
+
+    a = wheel.Add(start + Milliseconds(10), [&]() { str.push_back('a'); });
+    wheel.Add(start + Milliseconds(20), [&]() { str.push_back('b'); });
+
+    CHECK_TRUE(wheel.Reschedule(a, start + Milliseconds(100000)));
+    CHECK_TRUE(wheel.GetNextDeadline() == start + Milliseconds(20));
+
+    while (wheel.PopExpired(start + Milliseconds(50), task))
+    {
+        task();
+    }
+
+    STRCMP_EQUAL("b", str.c_str());
+
+    CHECK_TRUE(wheel.Reschedule(a, start + Milliseconds(60)));
+    CHECK_TRUE(wheel.GetNextDeadline() == start + Milliseconds(60));
+    CHECK_TRUE(wheel.PopExpired(start + Milliseconds(60), task));
+    task();
+
+    STRCMP_EQUAL("ba", str.c_str());
+    CHECK_FALSE(wheel.Reschedule(a, start + Milliseconds(70)));
+    CHECK_TRUE(wheel.IsEmpty());
+}
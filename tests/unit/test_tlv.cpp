@@ -0,0 +1,126 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/tlv.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Tlv;
+using otbr::TlvIndex;
+using otbr::TlvInfo;
+using otbr::TlvView;
+
+struct Iid
+{
+    uint8_t m8[8];
+};
+
+typedef TlvInfo<otbr::Meshcop::kJoinerIid, Iid> JoinerIidTlv;
+
+TEST_GROUP(Tlv){};
+
+TEST(Tlv, TestTlvViewIterates)
+{
+    const uint8_t kTlvs[] = {
+        0x10, 0x01, 0x01,                                           // State
+        0x0b, 0x02, 0x12, 0x34,                                     // Commissioner Session Id
+        0x13, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, // Joiner IID
+        0x30, 0xff, 0x00, 0x01, 0xaa,                               // UDP Encapsulation, extended length
+        0x10, 0x01, 0xff,                                           // Duplicated State
+    };
+    const uint8_t kTypes[] = {0x10, 0x0b, 0x13, 0x30, 0x10};
+    TlvView       view(kTlvs, sizeof(kTlvs));
+    size_t        count = 0;
+
+    CHECK(view.IsValid());
+    CHECK_EQUAL(sizeof(kTlvs), view.GetLength());
+
+    for (const Tlv &tlv : view)
+    {
+        CHECK(count < sizeof(kTypes));
+        CHECK_EQUAL(kTypes[count], tlv.GetType());
+        count++;
+    }
+    CHECK_EQUAL(sizeof(kTypes), count);
+
+    CHECK_EQUAL(0x1234, view.Find(otbr::Meshcop::kCommissionerSessionId)->GetValueUInt16());
+    CHECK_EQUAL(1, view.Find(otbr::Meshcop::kState)->GetValueUInt8());
+    CHECK_EQUAL(1, view.Find(otbr::Meshcop::kUdpEncapsulation)->GetLength());
+    CHECK(view.Find(otbr::Meshcop::kSteeringData) == nullptr);
+    CHECK_EQUAL(7, view.Find<JoinerIidTlv>()->m8[7]);
+}
+
+TEST(Tlv, TestTlvViewRejectsTruncated)
+{
+    const uint8_t kTruncatedValue[]  = {0x10, 0x01, 0x01, 0x0b, 0x02, 0x12};
+    const uint8_t kTruncatedHeader[] = {0x10, 0x01, 0x01, 0x30, 0xff, 0x00};
+    const uint8_t kShortValue[]      = {0x13, 0x02, 0x00, 0x01};
+
+    {
+        TlvView view(kTruncatedValue, sizeof(kTruncatedValue));
+
+        CHECK(!view.IsValid());
+        CHECK_EQUAL(3, view.GetLength());
+        CHECK(view.Find(otbr::Meshcop::kState) != nullptr);
+        CHECK(view.Find(otbr::Meshcop::kCommissionerSessionId) == nullptr);
+    }
+
+    {
+        TlvView view(kTruncatedHeader, sizeof(kTruncatedHeader));
+
+        CHECK(!view.IsValid());
+        CHECK_EQUAL(3, view.GetLength());
+    }
+
+    {
+        TlvView view(kShortValue, sizeof(kShortValue));
+
+        CHECK(view.IsValid());
+        CHECK(view.Find(otbr::Meshcop::kJoinerIid) != nullptr);
+        CHECK(view.Find<JoinerIidTlv>() == nullptr);
+    }
+
+    CHECK(TlvView(nullptr, 0).IsValid());
+    CHECK(TlvView(nullptr, 0).begin() == TlvView(nullptr, 0).end());
+}
+
+TEST(Tlv, TestTlvIndex)
+{
+    const uint8_t kTlvs[] = {
+        0x10, 0x01, 0x01,                                           // State
+        0x13, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, // Joiner IID
+        0x10, 0x01, 0xff,                                           // Duplicated State
+    };
+    TlvView  view(kTlvs, sizeof(kTlvs));
+    TlvIndex index(view);
+
+    CHECK(index.Find(otbr::Meshcop::kState) == view.Find(otbr::Meshcop::kState));
+    CHECK_EQUAL(1, index.Find(otbr::Meshcop::kState)->GetValueUInt8());
+    CHECK(index.Find<JoinerIidTlv>() == view.Find<JoinerIidTlv>());
+    CHECK(index.Find(otbr::Meshcop::kSteeringData) == nullptr);
+}
@@ -0,0 +1,183 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/trace.hpp"
+
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::TraceBuffer;
+using otbr::TraceEvent;
+using otbr::TraceHeader;
+using otbr::TraceRecord;
+
+static void ParseDump(const std::vector<uint8_t> &aDump, TraceHeader &aHeader, std::vector<TraceRecord> &aRecords)
+{
+    CHECK(aDump.size() >= sizeof(aHeader));
+    memcpy(&aHeader, aDump.data(), sizeof(aHeader));
+    CHECK_EQUAL(TraceHeader::kMagic, aHeader.mMagic);
+    CHECK_EQUAL(TraceHeader::kVersion, aHeader.mVersion);
+    CHECK_EQUAL(sizeof(TraceRecord), aHeader.mRecordSize);
+    CHECK_EQUAL(sizeof(aHeader) + aHeader.mNumRecords * sizeof(TraceRecord), aDump.size());
+
+    aRecords.resize(aHeader.mNumRecords);
+    memcpy(aRecords.data(), aDump.data() + sizeof(aHeader), aRecords.size() * sizeof(TraceRecord));
+}
+
+TEST_GROUP(TraceBuffer){};
+
+TEST(TraceBuffer, TestRecordAndDump)
+{
+    TraceHeader              header;
+    std::vector<TraceRecord> records;
+
+    TraceBuffer::Clear();
+    ParseDump(TraceBuffer::Dump(), header, records);
+    CHECK_EQUAL(0, header.mNumRecorded);
+    CHECK(records.empty());
+
+    TraceBuffer::Record(TraceEvent::kMainloopPoll, 1, 2);
+    TraceBuffer::Record(TraceEvent::kSrpUpdate, 3, 4, 5);
+
+    ParseDump(TraceBuffer::Dump(), header, records);
+    CHECK_EQUAL(2, header.mNumRecorded);
+    CHECK_EQUAL(2, records.size());
+
+    CHECK_EQUAL(static_cast<uint32_t>(TraceEvent::kMainloopPoll), records[0].mEvent);
+    CHECK_EQUAL(1, records[0].mArgs[0]);
+    CHECK_EQUAL(2, records[0].mArgs[1]);
+    CHECK_EQUAL(0, records[0].mArgs[2]);
+    CHECK_EQUAL(static_cast<uint32_t>(TraceEvent::kSrpUpdate), records[1].mEvent);
+    CHECK_EQUAL(5, records[1].mArgs[2]);
+
+    CHECK(records[0].mTimestamp <= records[1].mTimestamp);
+    CHECK(records[1].mTimestamp <= header.mTimestamp);
+}
+
+TEST(TraceBuffer, TestOldestRecordsOverwritten)
+{
+    TraceHeader              header;
+    std::vector<TraceRecord> records;
+
+    TraceBuffer::Clear();
+
+    for (uint32_t i = 0; i < TraceBuffer::kCapacity + 5; i++)
+    {
+        TraceBuffer::Record(TraceEvent::kRestRequest, i);
+    }
+
+    ParseDump(TraceBuffer::Dump(), header, records);
+    CHECK_EQUAL(TraceBuffer::kCapacity + 5, header.mNumRecorded);
+    CHECK_EQUAL(TraceBuffer::kCapacity, records.size());
+
+    for (uint32_t i = 0; i < records.size(); i++)
+    {
+        CHECK_EQUAL(i + 5, records[i].mArgs[0]);
+    }
+}
+
+TEST(TraceBuffer, TestDumpToFile)
+{
+    char                     path[] = "/tmp/otbr-test-trace-XXXXXX";
+    int                      fd     = mkstemp(path);
+    std::vector<uint8_t>     dump(sizeof(TraceHeader) + TraceBuffer::kCapacity * sizeof(TraceRecord) + 1);
+    TraceHeader              header;
+    std::vector<TraceRecord> records;
+    FILE *                   file;
+
+    CHECK(fd >= 0);
+    close(fd);
+    TraceBuffer::Clear();
+
+    // Wrap around the end of the ring, which is written in two parts.
+    for (uint32_t i = 0; i < TraceBuffer::kCapacity + 3; i++)
+    {
+        TraceBuffer::Record(TraceEvent::kNdProxyMulticastNs, i);
+    }
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, TraceBuffer::DumpToFile(path));
+
+    file = fopen(path, "rb");
+    CHECK(file != nullptr);
+    dump.resize(fread(dump.data(), 1, dump.size(), file));
+    fclose(file);
+    unlink(path);
+
+    ParseDump(dump, header, records);
+    CHECK_EQUAL(TraceBuffer::kCapacity, records.size());
+
+    for (uint32_t i = 0; i < records.size(); i++)
+    {
+        CHECK_EQUAL(i + 3, records[i].mArgs[0]);
+    }
+}
+
+TEST(TraceBuffer, TestDumpToFileReplacesSymlink)
+{
+    char        victim[] = "/tmp/otbr-test-trace-victim-XXXXXX";
+    int         fd       = mkstemp(victim);
+    std::string path     = std::string(victim) + ".trace";
+    struct stat info;
+    char        content[8];
+
+    CHECK(fd >= 0);
+    CHECK_EQUAL(5, write(fd, "keep\n", 5));
+    close(fd);
+    CHECK_EQUAL(0, symlink(victim, path.c_str()));
+
+    // The symlink is replaced by the dump, the file it points to is left alone.
+    CHECK_EQUAL(OTBR_ERROR_NONE, TraceBuffer::DumpToFile(path.c_str()));
+    CHECK_EQUAL(0, lstat(path.c_str(), &info));
+    CHECK(S_ISREG(info.st_mode));
+    CHECK_EQUAL(0600u, info.st_mode & 0777);
+
+    fd = open(victim, O_RDONLY);
+    CHECK_EQUAL(5, read(fd, content, sizeof(content)));
+    close(fd);
+    CHECK(memcmp(content, "keep\n", 5) == 0);
+
+    unlink(path.c_str());
+    unlink(victim);
+}
+
+TEST(TraceBuffer, TestEventToString)
+{
+    STRCMP_EQUAL("MainloopPoll", TraceBuffer::EventToString(static_cast<uint32_t>(TraceEvent::kMainloopPoll)));
+    STRCMP_EQUAL("NdProxyNeighborAdvert",
+                 TraceBuffer::EventToString(static_cast<uint32_t>(TraceEvent::kNdProxyNeighborAdvert)));
+    STRCMP_EQUAL("Unknown", TraceBuffer::EventToString(static_cast<uint32_t>(TraceEvent::kNumEvents)));
+}
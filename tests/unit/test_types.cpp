@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/types.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+using otbr::MacAddress;
+
+TEST_GROUP(Types){};
+
+TEST(Types, TestIp6AddressToString)
+{
+    static const struct
+    {
+        const char *mInput;
+        const char *mExpected;
+    } kTestCases[] = {
+        {"::", "::"},
+        {"::1", "::1"},
+        {"fe80::1", "fe80::1"},
+        {"fd00:db8:0:0:1::", "fd00:db8:0:0:1::"},
+        {"2001:db8:1:2:3:4:5:6", "2001:db8:1:2:3:4:5:6"},
+        {"ff02::1:ff00:1234", "ff02::1:ff00:1234"},
+        {"ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"},
+        {"::ffff:192.168.1.1", "::ffff:192.168.1.1"},
+        {"::192.168.1.1", "::192.168.1.1"},
+        // The longest run of zero words is compressed, the leftmost one on a tie.
+        {"1:0:0:1:0:0:0:1", "1:0:0:1::1"},
+        {"1:0:0:1:0:0:1:1", "1::1:0:0:1:1"},
+        // A single zero word is never compressed.
+        {"1:0:2:3:4:5:6:7", "1:0:2:3:4:5:6:7"},
+    };
+    char buffer[Ip6Address::kStringSize];
+
+    for (const auto &testCase : kTestCases)
+    {
+        Ip6Address address;
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(testCase.mInput, address));
+        STRCMP_EQUAL(testCase.mExpected, address.ToString(buffer));
+        STRCMP_EQUAL(testCase.mExpected, address.ToString().c_str());
+    }
+}
+
+TEST(Types, TestIp6PrefixToString)
+{
+    Ip6Prefix prefix;
+    char      buffer[Ip6Prefix::kStringSize];
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("fd00:1234::", prefix.mPrefix));
+    prefix.mLength = 64;
+    STRCMP_EQUAL("fd00:1234::/64", prefix.ToString(buffer));
+    STRCMP_EQUAL("fd00:1234::/64", prefix.ToString().c_str());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", prefix.mPrefix));
+    prefix.mLength = 128;
+    STRCMP_EQUAL("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128", prefix.ToString(buffer));
+}
+
+TEST(Types, TestMacAddressToString)
+{
+    static const uint8_t kMac[] = {0x00, 0x1a, 0x2b, 0x3c, 0xd4, 0xff};
+    MacAddress           mac;
+    char                 buffer[MacAddress::kStringSize];
+
+    STRCMP_EQUAL("00:00:00:00:00:00", mac.ToString(buffer));
+
+    memcpy(mac.m8, kMac, sizeof(kMac));
+    STRCMP_EQUAL("00:1a:2b:3c:d4:ff", mac.ToString(buffer));
+    STRCMP_EQUAL("00:1a:2b:3c:d4:ff", mac.ToString().c_str());
+}
@@ -0,0 +1,122 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/websocket.hpp"
+
+using namespace otbr::Utils;
+
+TEST_GROUP(WebSocket){};
+
+TEST(WebSocket, TestComputeAccept)
+{
+    // The example of RFC 6455, section 1.3.
+    STRCMP_EQUAL("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=", ComputeWebSocketAccept("dGhlIHNhbXBsZSBub25jZQ==").c_str());
+}
+
+TEST(WebSocket, TestAppendFrame)
+{
+    std::string frame;
+    std::string payload(300, 'x');
+
+    // The examples of RFC 6455, section 5.7.
+    AppendWebSocketFrame(kWebSocketText, "Hello", frame);
+    CHECK(frame == std::string("\x81\x05Hello", 7));
+
+    frame.clear();
+    AppendWebSocketFrame(kWebSocketBinary, std::string(256, '\0'), frame);
+    CHECK_EQUAL(4 + 256, frame.size());
+    CHECK(frame.compare(0, 4, "\x82\x7e\x01\x00", 4) == 0);
+
+    frame.clear();
+    AppendWebSocketFrame(kWebSocketBinary, std::string(65536, '\0'), frame);
+    CHECK_EQUAL(10 + 65536, frame.size());
+    CHECK(frame.compare(0, 10, "\x82\x7f\x00\x00\x00\x00\x00\x01\x00\x00", 10) == 0);
+
+    // Frames are appended.
+    frame.clear();
+    AppendWebSocketFrame(kWebSocketText, payload, frame);
+    AppendWebSocketFrame(kWebSocketPong, "", frame);
+    CHECK_EQUAL(4 + payload.size() + 2, frame.size());
+    CHECK(frame.compare(frame.size() - 2, 2, "\x8a\x00", 2) == 0);
+}
+
+TEST(WebSocket, TestParseMaskedFrame)
+{
+    const uint8_t        frame[] = {0x81, 0x85, 0x37, 0xfa, 0x21, 0x3d, 0x7f, 0x9f, 0x4d, 0x51, 0x58};
+    WebSocketFrameHeader header;
+    std::string          payload;
+
+    CHECK_EQUAL(6, GetWebSocketHeaderLength(frame));
+    CHECK_TRUE(ParseWebSocketHeader(frame, header));
+    CHECK_TRUE(header.mFin);
+    CHECK_EQUAL(kWebSocketText, header.mOpcode);
+    CHECK_TRUE(header.mMasked);
+    CHECK_EQUAL(5, header.mPayloadLength);
+
+    payload.assign(reinterpret_cast<const char *>(frame) + 6, 5);
+    UnmaskWebSocketPayload(header, payload);
+    STRCMP_EQUAL("Hello", payload.c_str());
+}
+
+TEST(WebSocket, TestParseExtendedLength)
+{
+    const uint8_t        frame16[] = {0x82, 0xfe, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04};
+    const uint8_t        frame64[] = {0x02, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00};
+    WebSocketFrameHeader header;
+
+    CHECK_EQUAL(sizeof(frame16), GetWebSocketHeaderLength(frame16));
+    CHECK_TRUE(ParseWebSocketHeader(frame16, header));
+    CHECK_EQUAL(256, header.mPayloadLength);
+    CHECK_EQUAL(0x04, header.mMaskKey[3]);
+
+    CHECK_EQUAL(sizeof(frame64), GetWebSocketHeaderLength(frame64));
+    CHECK_TRUE(ParseWebSocketHeader(frame64, header));
+    CHECK_FALSE(header.mFin);
+    CHECK_FALSE(header.mMasked);
+    CHECK_EQUAL(65536, header.mPayloadLength);
+}
+
+TEST(WebSocket, TestRejectMalformedHeader)
+{
+    const uint8_t        reserved[]       = {0xc1, 0x00};
+    const uint8_t        fragmentedPing[] = {0x09, 0x00};
+    const uint8_t        oversizedClose[] = {0x88, 0x7e, 0x00, 0x7e};
+    const uint8_t        sign64[]         = {0x82, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    const uint8_t        longestClose[]   = {0x88, 0x7d};
+    WebSocketFrameHeader header;
+
+    CHECK_FALSE(ParseWebSocketHeader(reserved, header));
+    CHECK_FALSE(ParseWebSocketHeader(fragmentedPing, header));
+    CHECK_FALSE(ParseWebSocketHeader(oversizedClose, header));
+    CHECK_FALSE(ParseWebSocketHeader(sign64, header));
+    CHECK_TRUE(ParseWebSocketHeader(longestClose, header));
+}
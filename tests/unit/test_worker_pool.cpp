@@ -0,0 +1,192 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/worker_pool.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <CppUTest/TestHarness.h>
+
+namespace {
+
+void RunTasks(otbr::TaskRunner &aTaskRunner)
+{
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+    CHECK_TRUE(rval >= 0 || errno == EINTR);
+
+    aTaskRunner.Process(mainloop);
+}
+
+} // namespace
+
+TEST_GROUP(WorkerPool){};
+
+TEST(WorkerPool, TestCompletionOnMainloop)
+{
+    otbr::TaskRunner taskRunner;
+    otbr::WorkerPool workerPool(taskRunner);
+    std::thread::id  mainloopThread = std::this_thread::get_id();
+    std::thread::id  workerThread;
+    int              result = 0;
+
+    workerPool.Post<int>(
+        [&]() {
+            workerThread = std::this_thread::get_id();
+            return 42;
+        },
+        [&](int aResult) {
+            CHECK_TRUE(std::this_thread::get_id() == mainloopThread);
+            result = aResult;
+        });
+
+    while (result == 0)
+    {
+        RunTasks(taskRunner);
+    }
+
+    CHECK_EQUAL(42, result);
+    CHECK_TRUE(workerThread != mainloopThread);
+}
+
+TEST(WorkerPool, TestSerialKey)
+{
+    otbr::TaskRunner taskRunner;
+    std::string      str;
+    std::atomic<int> completed{0};
+    int              key;
+
+    // The braces here make sure that all jobs are finished before checking the results.
+    {
+        otbr::WorkerPool workerPool(taskRunner, 4, 26);
+
+        for (char c = 'a'; c <= 'z'; ++c)
+        {
+            workerPool.Post(
+                [&str, c]() {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    str.push_back(c);
+                },
+                [&completed]() { ++completed; }, &key);
+        }
+    }
+
+    while (completed.load() < 26)
+    {
+        RunTasks(taskRunner);
+    }
+
+    STRCMP_EQUAL("abcdefghijklmnopqrstuvwxyz", str.c_str());
+}
+
+TEST(WorkerPool, TestConcurrentJobs)
+{
+    otbr::TaskRunner taskRunner;
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    // The braces here make sure that all jobs are finished before checking the results.
+    {
+        otbr::WorkerPool workerPool(taskRunner, 4, 8);
+
+        for (int i = 0; i < 8; ++i)
+        {
+            workerPool.Post(
+                [&]() {
+                    int current = ++running;
+                    int max     = maxRunning.load();
+
+                    while (current > max && !maxRunning.compare_exchange_weak(max, current))
+                    {
+                    }
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    --running;
+                },
+                nullptr);
+        }
+    }
+
+    CHECK_TRUE(maxRunning.load() > 1);
+}
+
+TEST(WorkerPool, TestPostBusy)
+{
+    otbr::TaskRunner  taskRunner;
+    std::atomic<bool> isStarted{false};
+    std::atomic<bool> isReleased{false};
+    std::atomic<int>  completed{0};
+
+    // The braces here make sure that all jobs are finished before checking the results.
+    {
+        otbr::WorkerPool workerPool(taskRunner, 1, 1);
+        otbrError        error = workerPool.Post(
+            [&]() {
+                isStarted = true;
+
+                while (!isReleased)
+                {
+                    std::this_thread::yield();
+                }
+            },
+            [&completed]() { ++completed; });
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, error);
+
+        while (!isStarted)
+        {
+            std::this_thread::yield();
+        }
+
+        // The only worker is running the first job, so the second job fills the queue.
+        CHECK_EQUAL(OTBR_ERROR_NONE, workerPool.Post([]() {}, [&completed]() { ++completed; }));
+        CHECK_EQUAL(OTBR_ERROR_BUSY, workerPool.Post([]() {}, [&completed]() { ++completed; }));
+
+        isReleased = true;
+    }
+
+    while (completed.load() < 2)
+    {
+        RunTasks(taskRunner);
+    }
+
+    CHECK_EQUAL(2, completed.load());
+}
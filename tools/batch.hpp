@@ -0,0 +1,169 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the batch mode shared by the command line tools.
+ */
+
+#ifndef OTBR_TOOLS_BATCH_HPP_
+#define OTBR_TOOLS_BATCH_HPP_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace otbr {
+namespace Tools {
+
+enum
+{
+    kBatchChunkSize = 4096, ///< The max number of inputs read before they are processed.
+    kMaxBatchJobs   = 256,  ///< The max number of worker threads.
+};
+
+/**
+ * This function returns the default number of worker threads of the batch mode.
+ *
+ * @returns The number of online CPU cores, or 1 if it is unknown.
+ *
+ */
+inline unsigned GetDefaultBatchJobs(void)
+{
+    unsigned numJobs = std::thread::hardware_concurrency();
+
+    return numJobs > 0 ? std::min<unsigned>(numJobs, kMaxBatchJobs) : 1;
+}
+
+/**
+ * This function parses the number of worker threads of the batch mode.
+ *
+ * @param[in]  aArg  The argument given to `-j`.
+ *
+ * @returns The number of worker threads, or 0 if @p aArg is not a number between 1 and `kMaxBatchJobs`.
+ *
+ */
+inline unsigned ParseBatchJobs(const char *aArg)
+{
+    char *        end;
+    unsigned long numJobs = strtoul(aArg, &end, 10);
+
+    return (*aArg != '\0' && *end == '\0' && numJobs > 0 && numJobs <= kMaxBatchJobs) ? numJobs : 0;
+}
+
+/**
+ * This function processes inputs in batch.
+ *
+ * Inputs are read from @p aInput one per line, processed by up to @p aNumJobs threads and the result of each input is
+ * written to the standard output as one line, in the order of the inputs. Inputs are read in chunks, so results are
+ * written before the whole input is read.
+ *
+ * Each thread owns a `Context`, which is default constructed once and reused for all inputs processed by the thread.
+ *
+ * @param[in]  aInput    The input file.
+ * @param[in]  aNumJobs  The number of worker threads.
+ * @param[in]  aProcess  The function processing one input, called as `aProcess(context, input, result)` and
+ *                       returning whether the input is valid. @p result is written as is for invalid inputs too.
+ *
+ * @returns Whether all inputs are valid.
+ *
+ */
+template <typename Context>
+bool RunBatch(FILE *                                                                  aInput,
+              unsigned                                                                aNumJobs,
+              const std::function<bool(Context &, const std::string &, std::string &)> &aProcess)
+{
+    std::vector<std::string> inputs(kBatchChunkSize);
+    std::vector<std::string> results(kBatchChunkSize);
+    std::vector<char>        valid(kBatchChunkSize);
+    std::vector<Context>     contexts(std::max(aNumJobs, 1u));
+    char *                   line     = nullptr;
+    size_t                   capacity = 0;
+    bool                     allValid = true;
+    bool                     eof      = false;
+
+    while (!eof)
+    {
+        std::atomic<size_t>      next(0);
+        std::vector<std::thread> workers;
+        size_t                   count = 0;
+        ssize_t                  length;
+
+        while (count < kBatchChunkSize && (length = getline(&line, &capacity, aInput)) >= 0)
+        {
+            while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r'))
+            {
+                --length;
+            }
+            inputs[count++].assign(line, static_cast<size_t>(length));
+        }
+        eof = (count < kBatchChunkSize);
+
+        auto work = [&](Context &aContext) {
+            for (size_t i = next++; i < count; i = next++)
+            {
+                valid[i] = aProcess(aContext, inputs[i], results[i]);
+            }
+        };
+
+        for (size_t i = 1; i < contexts.size() && i < count; i++)
+        {
+            workers.emplace_back(work, std::ref(contexts[i]));
+        }
+        work(contexts[0]);
+
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            allValid = allValid && valid[i];
+            fwrite(results[i].data(), 1, results[i].size(), stdout);
+            fputc('\n', stdout);
+        }
+    }
+
+    free(line);
+
+    return allValid && !ferror(aInput);
+}
+
+} // namespace Tools
+} // namespace otbr
+
+#endif // OTBR_TOOLS_BATCH_HPP_
@@ -32,8 +32,12 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <sysexits.h>
 
+#include <string>
+
+#include "batch.hpp"
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
@@ -53,57 +57,144 @@ void help(void)
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
            "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc --batch [-j JOBS] [FILE]\n"
+           "    Computes the PSKc of each line of FILE, or of the standard input if no FILE is given, on JOBS\n"
+           "    threads (all cores by default). Each line contains PASSPHRASE, EXTPANID and NETWORK_NAME separated\n"
+           "    by tabs, and one PSKc or error is written per line.\n"
            "EXAMPLE:\n"
            "    pskc 654321 1122334455667788 OpenThread\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+/**
+ * This function validates the arguments and computes the PSKc.
+ *
+ * @param[in]   aComputer     The PSKc computer.
+ * @param[in]   aPassphrase   The passphrase.
+ * @param[in]   aExtPanId     The extended PAN ID in hex.
+ * @param[in]   aNetworkName  The network name.
+ * @param[out]  aResult       The PSKc in hex on success, or the error message otherwise.
+ *
+ * @returns Whether the PSKc is computed.
+ *
+ */
+bool ComputePskc(otbr::Psk::Pskc &aComputer,
+                 const char *     aPassphrase,
+                 const char *     aExtPanId,
+                 const char *     aNetworkName,
+                 std::string &    aResult)
 {
-    uint8_t extpanid[kSizeExtPanId];
-    size_t  length;
-    int     ret = -1;
-
-    otbr::Psk::Pskc pskcComputer;
-    const uint8_t * pskc;
+    uint8_t        extpanid[kSizeExtPanId];
+    size_t         length;
+    bool           ok = false;
+    const uint8_t *pskc;
+    char           hex[3];
 
     length = strlen(aPassphrase);
-    VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
-    VerifyOrExit(length <= kMaxPassphrase,
-                 printf("PASSPHRASE Passphrase must be no more than %d bytes.\n", kMaxPassphrase));
+    VerifyOrExit(length > 0, aResult = "PASSPHRASE must not be empty.");
+    VerifyOrExit(length <= kMaxPassphrase, aResult = "PASSPHRASE Passphrase must be no more than " +
+                                                     std::to_string(kMaxPassphrase) + " bytes.");
 
     length = strlen(aExtPanId);
-    VerifyOrExit(length == kSizeExtPanId * 2, printf("EXTPANID length must be %d bytes.\n", kSizeExtPanId));
+    VerifyOrExit(length == kSizeExtPanId * 2,
+                 aResult = "EXTPANID length must be " + std::to_string(kSizeExtPanId) + " bytes.");
     for (size_t i = 0; i < length; i++)
     {
         VerifyOrExit((aExtPanId[i] <= '9' && aExtPanId[i] >= '0') || (aExtPanId[i] <= 'f' && aExtPanId[i] >= 'a') ||
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
-                     printf("EXTPANID must be encoded in hex.\n"));
+                     aResult = "EXTPANID must be encoded in hex.");
     }
     otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
 
     length = strlen(aNetworkName);
-    VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
-    VerifyOrExit(length <= kMaxNetworkName,
-                 printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
+    VerifyOrExit(length > 0, aResult = "NETWORK_NAME must not be empty.");
+    VerifyOrExit(length <= kMaxNetworkName, aResult = "NETWOR_KNAME length must be no more than " +
+                                                      std::to_string(kMaxNetworkName) + " bytes.");
+
+    pskc = aComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
+    aResult.clear();
+    for (int i = 0; i < OT_PSKC_LENGTH; i++)
+    {
+        snprintf(hex, sizeof(hex), "%02x", pskc[i]);
+        aResult += hex;
+    }
+    ok = true;
+
+exit:
+    return ok;
+}
+
+bool ComputeBatchPskc(otbr::Psk::Pskc &aComputer, const std::string &aLine, std::string &aResult)
+{
+    size_t      first  = aLine.find('\t');
+    size_t      second = (first == std::string::npos) ? first : aLine.find('\t', first + 1);
+    bool        ok     = false;
+    std::string passphrase;
+    std::string extPanId;
+
+    VerifyOrExit(second != std::string::npos && aLine.find('\t', second + 1) == std::string::npos,
+                 aResult = "error: expected PASSPHRASE, EXTPANID and NETWORK_NAME separated by tabs.");
+
+    passphrase.assign(aLine, 0, first);
+    extPanId.assign(aLine, first + 1, second - first - 1);
+
+    ok = ComputePskc(aComputer, passphrase.c_str(), extPanId.c_str(), aLine.c_str() + second + 1, aResult);
+    if (!ok)
+    {
+        aResult.insert(0, "error: ");
+    }
+
+exit:
+    return ok;
+}
+
+int RunBatch(int argc, char *argv[])
+{
+    int      ret     = EX_USAGE;
+    FILE *   input   = stdin;
+    unsigned numJobs = otbr::Tools::GetDefaultBatchJobs();
+    int      i       = 2;
+
+    if (i < argc && !strcmp(argv[i], "-j"))
+    {
+        VerifyOrExit(i + 1 < argc, help());
+        numJobs = otbr::Tools::ParseBatchJobs(argv[i + 1]);
+        VerifyOrExit(numJobs > 0, fprintf(stderr, "Invalid number of jobs: %s\n", argv[i + 1]));
+        i += 2;
+    }
+
+    VerifyOrExit(i + 1 >= argc, help());
 
-    pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
-    for (int i = 0; i < 16; i++)
+    if (i < argc)
     {
-        printf("%02x", pskc[i]);
+        input = fopen(argv[i], "r");
+        VerifyOrExit(input != nullptr, ret = EX_NOINPUT; fprintf(stderr, "Failed to open %s\n", argv[i]));
     }
-    printf("\n");
-    ret = 0;
+
+    ret = otbr::Tools::RunBatch<otbr::Psk::Pskc>(input, numJobs, ComputeBatchPskc) ? EX_OK : EX_DATAERR;
 
 exit:
+    if (input != nullptr && input != stdin)
+    {
+        fclose(input);
+    }
+
     return ret;
 }
 
 int main(int argc, char *argv[])
 {
-    int ret = 0;
+    int             ret = 0;
+    otbr::Psk::Pskc computer;
+    std::string     result;
+
+    if (argc >= 2 && !strcmp(argv[1], "--batch"))
+    {
+        ExitNow(ret = RunBatch(argc, argv));
+    }
 
     VerifyOrExit(argc == 4, help(), ret = EX_USAGE);
-    ret = printPSKc(argv[1], argv[2], argv[3]);
+    ret = ComputePskc(computer, argv[1], argv[2], argv[3], result) ? 0 : -1;
+    printf("%s\n", result.c_str());
 
 exit:
     return ret;
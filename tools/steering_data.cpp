@@ -34,8 +34,13 @@
 #include <mbedtls/sha256.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sysexits.h>
 
+#include <string>
+#include <vector>
+
+#include "batch.hpp"
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/steering_data.hpp"
@@ -45,67 +50,174 @@ void help(void)
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data --batch [-j JOBS] [FILE]\n"
+           "    Computes the steering data of each line of FILE, or of the standard input if no FILE is given, on\n"
+           "    JOBS threads (all cores by default). Each line contains [LENGTH] <JOINER_ID> ... separated by spaces,\n"
+           "    and one steering data or error is written per line.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
            "    steering-data 18b4300000000001 18b4300000000002\n");
 }
 
-int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
+/**
+ * This structure holds the state reused for computing steering data.
+ *
+ */
+struct SteeringDataContext
 {
-    int ret = -1;
+    otbr::SteeringData        mComputer;
+    std::vector<uint8_t>      mJoinerIds;
+    std::vector<char>         mLine;
+    std::vector<const char *> mArgs;
+};
+
+bool ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
+{
+    bool ok = false;
 
     VerifyOrExit(strlen(aEui64) == otbr::SteeringData::kSizeJoinerId * 2);
     VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aJoinerId, otbr::SteeringData::kSizeJoinerId) ==
                  otbr::SteeringData::kSizeJoinerId);
     otbr::SteeringData::ComputeJoinerId(aJoinerId, aJoinerId);
-    ret = 0;
+    ok = true;
 
 exit:
-    if (ret != 0)
+    return ok;
+}
+
+/**
+ * This function validates the arguments and computes the steering data.
+ *
+ * @param[in]   aContext  The reused state.
+ * @param[in]   aArgs     The arguments, `[LENGTH] <JOINER_ID> ...`.
+ * @param[in]   aNumArgs  The number of arguments.
+ * @param[out]  aResult   The steering data in hex on success, or the error message otherwise.
+ *
+ * @returns Whether the steering data is computed.
+ *
+ */
+bool ComputeSteeringData(SteeringDataContext &aContext,
+                         const char *const *  aArgs,
+                         size_t               aNumArgs,
+                         std::string &        aResult)
+{
+    bool   ok     = false;
+    int    length = 16;
+    size_t i      = 0;
+    char   hex[3];
+
+    VerifyOrExit(aNumArgs > 0, aResult = "Missing JOINER_ID");
+
+    if (strlen(aArgs[i]) != otbr::SteeringData::kSizeJoinerId * 2)
     {
-        fprintf(stderr, "Invalid EUI64: %s", aEui64);
+        length = atoi(aArgs[i]);
+        VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
+                     aResult = "Invalid bloom filter length: " + std::to_string(length));
+
+        ++i;
     }
 
-    return ret;
+    aContext.mComputer.Init(static_cast<uint8_t>(length));
+    aContext.mJoinerIds.resize((aNumArgs - i) * otbr::SteeringData::kSizeJoinerId);
+
+    for (uint8_t *joinerId = aContext.mJoinerIds.data(); i < aNumArgs;
+         ++i, joinerId += otbr::SteeringData::kSizeJoinerId)
+    {
+        VerifyOrExit(ComputeJoinerId(aArgs[i], joinerId), aResult = std::string("Invalid EUI64 : ") + aArgs[i]);
+    }
+
+    aContext.mComputer.ComputeBloomFilter(aContext.mJoinerIds.data(),
+                                          aContext.mJoinerIds.size() / otbr::SteeringData::kSizeJoinerId);
+
+    aResult.clear();
+    for (i = 0; i < static_cast<size_t>(length); i++)
+    {
+        snprintf(hex, sizeof(hex), "%02x", aContext.mComputer.GetBloomFilter()[i]);
+        aResult += hex;
+    }
+    ok = true;
+
+exit:
+    return ok;
 }
 
-int main(int argc, char *argv[])
+bool ComputeBatchSteeringData(SteeringDataContext &aContext, const std::string &aLine, std::string &aResult)
 {
-    otbr::SteeringData computer;
-    int                ret    = EX_USAGE;
-    int                length = 16;
-    int                i      = 1;
+    bool  ok;
+    char *savePtr;
+
+    // Split a copy of the line in place into the arguments.
+    aContext.mLine.assign(aLine.c_str(), aLine.c_str() + aLine.size() + 1);
+    aContext.mArgs.clear();
+    for (char *arg = strtok_r(aContext.mLine.data(), " \t", &savePtr); arg != nullptr;
+         arg       = strtok_r(nullptr, " \t", &savePtr))
+    {
+        aContext.mArgs.push_back(arg);
+    }
 
-    if (argc < 2)
+    ok = ComputeSteeringData(aContext, aContext.mArgs.data(), aContext.mArgs.size(), aResult);
+    if (!ok)
     {
-        ExitNow(help());
+        aResult.insert(0, "error: ");
     }
 
-    if (strlen(argv[i]) != otbr::SteeringData::kSizeJoinerId * 2)
+    return ok;
+}
+
+int RunBatch(int argc, char *argv[])
+{
+    int      ret     = EX_USAGE;
+    FILE *   input   = stdin;
+    unsigned numJobs = otbr::Tools::GetDefaultBatchJobs();
+    int      i       = 2;
+
+    if (i < argc && !strcmp(argv[i], "-j"))
     {
-        length = atoi(argv[i]);
-        VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
-                     fprintf(stderr, "Invalid bloom filter length: %d\n", length));
+        VerifyOrExit(i + 1 < argc, help());
+        numJobs = otbr::Tools::ParseBatchJobs(argv[i + 1]);
+        VerifyOrExit(numJobs > 0, fprintf(stderr, "Invalid number of jobs: %s\n", argv[i + 1]));
+        i += 2;
+    }
 
-        ++i;
+    VerifyOrExit(i + 1 >= argc, help());
+
+    if (i < argc)
+    {
+        input = fopen(argv[i], "r");
+        VerifyOrExit(input != nullptr, ret = EX_NOINPUT; fprintf(stderr, "Failed to open %s\n", argv[i]));
     }
 
-    computer.Init(static_cast<uint8_t>(length));
+    ret = otbr::Tools::RunBatch<SteeringDataContext>(input, numJobs, ComputeBatchSteeringData) ? EX_OK : EX_DATAERR;
 
-    for (; i < argc; ++i)
+exit:
+    if (input != nullptr && input != stdin)
     {
-        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+        fclose(input);
+    }
 
-        VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
-        computer.ComputeBloomFilter(joinerId);
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    SteeringDataContext context;
+    std::string         result;
+    int                 ret = EX_USAGE;
+
+    if (argc < 2)
+    {
+        ExitNow(help());
     }
 
-    for (i = 0; i < length; i++)
+    if (!strcmp(argv[1], "--batch"))
     {
-        printf("%02x", computer.GetBloomFilter()[i]);
+        ExitNow(ret = RunBatch(argc, argv));
     }
-    printf("\n");
+
+    VerifyOrExit(ComputeSteeringData(context, argv + 1, static_cast<size_t>(argc - 1), result),
+                 fprintf(stderr, "%s\n", result.c_str()));
+    printf("%s\n", result.c_str());
 
     ret = EX_OK;
 
@@ -0,0 +1,109 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a tool to decode trace dumps of otbr-agent.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/trace.hpp"
+
+void help(void)
+{
+    printf("otbr-trace-decode - decode a trace dump of otbr-agent\n"
+           "SYNTAX:\n"
+           "    otbr-trace-decode [FILE]\n"
+           "    Decodes the standard input if no FILE is given. Dumps are written by otbr-agent to\n"
+           "    " OTBR_TRACE_DUMP_FILE " on SIGUSR2, or read from the TraceBuffer D-Bus property.\n"
+           "OUTPUT:\n"
+           "    <milliseconds before the dump> <event> <arg0> <arg1> <arg2>\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int                            ret  = EX_DATAERR;
+    FILE *                         file = stdin;
+    otbr::TraceHeader              header;
+    std::vector<otbr::TraceRecord> records;
+
+    if (argc > 2 || (argc == 2 && (!strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))))
+    {
+        help();
+        ExitNow(ret = EX_USAGE);
+    }
+
+    if (argc == 2)
+    {
+        file = fopen(argv[1], "rb");
+        VerifyOrExit(file != nullptr, ret = EX_NOINPUT; fprintf(stderr, "Failed to open %s\n", argv[1]));
+    }
+
+    VerifyOrExit(fread(&header, sizeof(header), 1, file) == 1, fprintf(stderr, "Truncated trace header\n"));
+    VerifyOrExit(header.mMagic == otbr::TraceHeader::kMagic,
+                 fprintf(stderr, "Not a trace dump, or dumped on a host of different byte order\n"));
+    VerifyOrExit(header.mVersion == otbr::TraceHeader::kVersion,
+                 fprintf(stderr, "Unsupported trace dump version %" PRIu32 "\n", header.mVersion));
+    VerifyOrExit(header.mRecordSize == sizeof(otbr::TraceRecord),
+                 fprintf(stderr, "Unsupported trace record size %" PRIu32 "\n", header.mRecordSize));
+
+    records.resize(header.mNumRecords);
+    VerifyOrExit(fread(records.data(), sizeof(otbr::TraceRecord), records.size(), file) == records.size(),
+                 fprintf(stderr, "Truncated trace records\n"));
+
+    printf("# %" PRIu32 " records, %" PRIu64 " recorded\n", header.mNumRecords, header.mNumRecorded);
+
+    for (const otbr::TraceRecord &record : records)
+    {
+        // Records torn by a concurrent dump or never written are skipped.
+        if (record.mEvent == static_cast<uint32_t>(otbr::TraceEvent::kNone) || record.mTimestamp > header.mTimestamp)
+        {
+            continue;
+        }
+
+        printf("%.3f %s %" PRIu32 " %" PRIu32 " %" PRIu32 "\n", (header.mTimestamp - record.mTimestamp) / 1e6,
+               otbr::TraceBuffer::EventToString(record.mEvent), record.mArgs[0], record.mArgs[1], record.mArgs[2]);
+    }
+
+    ret = EX_OK;
+
+exit:
+    if (file != nullptr && file != stdin)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}